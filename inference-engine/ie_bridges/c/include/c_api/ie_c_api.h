@@ -53,6 +53,7 @@ typedef struct ie_network ie_network_t;
 typedef struct ie_executable ie_executable_network_t;
 typedef struct ie_infer_request ie_infer_request_t;
 typedef struct ie_blob ie_blob_t;
+typedef struct ie_completion_queue ie_completion_queue_t;
 
 /**
  * @struct ie_version
@@ -294,6 +295,15 @@ typedef struct ie_complete_call_back {
     void *args;
 } ie_complete_call_back_t;
 
+/**
+ * @struct ie_blob_release_call_back
+ * @brief Release callback definition for the user memory wrapped by a blob
+ */
+typedef struct ie_blob_release_call_back {
+    void (INFERENCE_ENGINE_C_API_CALLBACK *releaseCallBackFunc)(void *ptr, void *args);
+    void *args;
+} ie_blob_release_call_back_t;
+
 /**
  * @struct ie_available_devices
  * @brief Represent all available devices.
@@ -595,6 +605,18 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_get_blob(ie_i
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_blob(ie_infer_request_t *infer_request, const char *name, const ie_blob_t *blob);
 
+/**
+ * @brief Sets several input/output blobs to inference in one call.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param names An array of names of input or output blobs.
+ * @param blobs An array of blobs, the blob with the same index is set for every name.
+ * @param count A number of elements in the arrays.
+ * @return Status code of the operation: OK(0) for success. The blobs are set in order up to the first failure.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_blobs(ie_infer_request_t *infer_request, const char *const *names,
+                                                                            const ie_blob_t *const *blobs, size_t count);
+
 /**
  * @brief Starts synchronous inference of the infer request and fill outputs.
  * @ingroup InferRequest
@@ -641,6 +663,49 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_wait(ie_infer
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_batch(ie_infer_request_t *infer_request, const size_t size);
 
+/**
+ * @brief Creates a completion queue, to which many infer requests report their completion instead of calling
+ * a callback per request.
+ * @ingroup InferRequest
+ * @param queue A pointer to the newly created completion queue.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_create(ie_completion_queue_t **queue);
+
+/**
+ * @brief Releases memory occupied by ie_completion_queue_t instance. Requests still reporting to the queue
+ * keep its internal state alive, but their completions can't be received anymore.
+ * @ingroup InferRequest
+ * @param queue A pointer to the completion queue to free memory.
+ */
+INFERENCE_ENGINE_C_API(void) ie_completion_queue_free(ie_completion_queue_t **queue);
+
+/**
+ * @brief Makes the infer request report completion of asynchronous inference to the queue.
+ * It replaces a callback set with ie_infer_set_completion_callback.
+ * @ingroup InferRequest
+ * @param infer_request A pointer to ie_infer_request_t instance.
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param user_data A value returned together with the request by ie_completion_queue_wait.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request,
+                                                                                       ie_completion_queue_t *queue, void *user_data);
+
+/**
+ * @brief Waits for the next completed infer request of the queue. Requests are returned in order of completion.
+ * @ingroup InferRequest
+ * @param queue A pointer to ie_completion_queue_t instance.
+ * @param timeout Maximum duration in milliseconds to block for, 0 returns immediately, -1 waits until a request completes.
+ * @param infer_request A pointer to the completed request.
+ * @param user_data A pointer to the value passed to ie_infer_request_set_completion_queue for the request.
+ * @param infer_status A pointer to the status of the completed inference, may be NULL.
+ * @return Status code of the operation: OK(0) if a request is returned, RESULT_NOT_READY if the timeout elapsed.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_completion_queue_wait(ie_completion_queue_t *queue, const int64_t timeout,
+                                                                          ie_infer_request_t **infer_request, void **user_data,
+                                                                          IEStatusCode *infer_status);
+
 /** @} */ // end of InferRequest
 
 // Network
@@ -912,6 +977,22 @@ INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_make_memory(const tens
  */
 INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDesc, void *ptr, size_t size, ie_blob_t **blob);
 
+/**
+ * @brief Creates a blob with the given tensor descriptor which wraps the user memory without copying it.
+ * The release callback is called once the memory is referenced neither by the blob nor by infer requests it was set to.
+ * @ingroup Blob
+ * @param tensorDesc Tensor descriptor for Blob creation.
+ * @param ptr Pointer to the user memory.
+ * @param size Length of the user memory array.
+ * @param release A callback to be called with the ptr and its args to release the memory, the struct is copied.
+ * @param blob A pointer to the newly created blob.
+ * @return Status code of the operation: OK(0) for success.
+ */
+INFERENCE_ENGINE_C_API(IE_NODISCARD IEStatusCode) ie_blob_make_memory_from_preallocated_with_release(const tensor_desc_t *tensorDesc,
+                                                                                                    void *ptr, size_t size,
+                                                                                                    const ie_blob_release_call_back_t *release,
+                                                                                                    ie_blob_t **blob);
+
 /**
  * @brief Creates a blob describing given roi_t instance based on the given blob with pre-allocated memory.
  * @ingroup Blob
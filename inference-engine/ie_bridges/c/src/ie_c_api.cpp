@@ -14,6 +14,10 @@
 #include <chrono>
 #include <tuple>
 #include <memory>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
 #include <ie_extension.h>
 #include "inference_engine.hpp"
 #include "details/ie_exception.hpp"
@@ -54,6 +58,25 @@ struct ie_blob {
     IE::Blob::Ptr object;
 };
 
+/**
+ * @struct ie_completion_queue
+ * @brief This struct keeps completed infer requests until the application waits for them
+ */
+struct ie_completion_queue {
+    struct Completion {
+        ie_infer_request_t *request;
+        void *user_data;
+        IEStatusCode status;
+    };
+    struct Queue {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::deque<Completion> completions;
+    };
+    // shared with completion callbacks of the requests
+    std::shared_ptr<Queue> object;
+};
+
 /**
  * @struct ie_network
  * @brief This is the main interface to describe the NN topology
@@ -1285,6 +1308,28 @@ IEStatusCode ie_infer_request_set_blob(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_infer_request_set_blobs(ie_infer_request_t *infer_request, const char *const *names,
+                                        const ie_blob_t *const *blobs, size_t count) {
+    if (infer_request == nullptr || (count != 0 && (names == nullptr || blobs == nullptr))) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        for (size_t i = 0; i < count; ++i) {
+            if (names[i] == nullptr || blobs[i] == nullptr) {
+                return IEStatusCode::GENERAL_ERROR;
+            }
+            infer_request->object.SetBlob(names[i], blobs[i]->object);
+        }
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_infer_request_infer(ie_infer_request_t *infer_request) {
     IEStatusCode status = IEStatusCode::OK;
 
@@ -1384,6 +1429,86 @@ IEStatusCode ie_infer_request_set_batch(ie_infer_request_t *infer_request, const
     return status;
 }
 
+IEStatusCode ie_completion_queue_create(ie_completion_queue_t **queue) {
+    if (queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        std::unique_ptr<ie_completion_queue_t> _queue(new ie_completion_queue_t);
+        _queue->object = std::make_shared<ie_completion_queue_t::Queue>();
+        *queue = _queue.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+void ie_completion_queue_free(ie_completion_queue_t **queue) {
+    if (queue) {
+        delete *queue;
+        *queue = NULL;
+    }
+}
+
+IEStatusCode ie_infer_request_set_completion_queue(ie_infer_request_t *infer_request, ie_completion_queue_t *queue, void *user_data) {
+    if (infer_request == nullptr || queue == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        auto object = queue->object;
+        std::function<void(IE::InferRequest, IE::StatusCode)> push = [object, infer_request, user_data](IE::InferRequest, IE::StatusCode code) {
+            // the map is shared by threads completing requests, so it must not be modified by a lookup
+            auto status = status_map.find(code);
+            {
+                std::lock_guard<std::mutex> lock(object->mutex);
+                object->completions.push_back({infer_request, user_data, status != status_map.end() ? status->second : IEStatusCode::UNEXPECTED});
+            }
+            object->cv.notify_one();
+        };
+        // pushing to the queue doesn't block, so it is done by the thread which completes the request
+        infer_request->object.SetCompletionCallback(push, [](const std::function<void()>& call) { call(); });
+    } catch (const IE::details::InferenceEngineException& e) {
+        return e.hasStatus() ? status_map[e.getStatus()] : IEStatusCode::UNEXPECTED;
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
+IEStatusCode ie_completion_queue_wait(ie_completion_queue_t *queue, const int64_t timeout,
+                                      ie_infer_request_t **infer_request, void **user_data, IEStatusCode *infer_status) {
+    if (queue == nullptr || infer_request == nullptr || user_data == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    try {
+        auto& object = *queue->object;
+        std::unique_lock<std::mutex> lock(object.mutex);
+        auto ready = [&object] { return !object.completions.empty(); };
+        if (timeout < 0) {
+            object.cv.wait(lock, ready);
+        } else if (!object.cv.wait_for(lock, std::chrono::milliseconds(timeout), ready)) {
+            return IEStatusCode::RESULT_NOT_READY;
+        }
+        const auto completion = object.completions.front();
+        object.completions.pop_front();
+
+        *infer_request = completion.request;
+        *user_data = completion.user_data;
+        if (infer_status) {
+            *infer_status = completion.status;
+        }
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return IEStatusCode::OK;
+}
+
 IEStatusCode ie_blob_make_memory(const tensor_desc_t *tensorDesc, ie_blob_t **blob) {
     if (tensorDesc == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
@@ -1519,6 +1644,35 @@ IEStatusCode ie_blob_make_memory_from_preallocated(const tensor_desc_t *tensorDe
     return status;
 }
 
+IEStatusCode ie_blob_make_memory_from_preallocated_with_release(const tensor_desc_t *tensorDesc, void *ptr, size_t size,
+                                                              const ie_blob_release_call_back_t *release, ie_blob_t **blob) {
+    if (release == nullptr || release->releaseCallBackFunc == nullptr || blob == nullptr) {
+        return IEStatusCode::GENERAL_ERROR;
+    }
+
+    ie_blob_t *preallocated = nullptr;
+    IEStatusCode status = ie_blob_make_memory_from_preallocated(tensorDesc, ptr, size, &preallocated);
+    if (status != IEStatusCode::OK) {
+        return status;
+    }
+
+    std::unique_ptr<ie_blob_t> _blob(preallocated);
+    try {
+        auto object = _blob->object;
+        auto callback = *release;
+        // the deleter is called after the last reference to the blob is dropped, including references of infer requests
+        _blob->object = IE::Blob::Ptr(object.get(), [object, callback, ptr](IE::Blob *) mutable {
+            object.reset();
+            callback.releaseCallBackFunc(ptr, callback.args);
+        });
+        *blob = _blob.release();
+    } catch (...) {
+        return IEStatusCode::UNEXPECTED;
+    }
+
+    return status;
+}
+
 IEStatusCode ie_blob_make_memory_with_roi(const ie_blob_t *inputBlob, const roi_t *roi, ie_blob_t **blob) {
     if (inputBlob == nullptr || roi == nullptr || blob == nullptr) {
         return IEStatusCode::GENERAL_ERROR;
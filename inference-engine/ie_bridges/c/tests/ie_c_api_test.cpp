@@ -1262,6 +1262,33 @@ TEST(ie_blob_make_memory_from_preallocated, makeMemoryfromPreallocated) {
     ie_blob_free(&blob);
 }
 
+void release_callback(void *ptr, void *args) {
+    *static_cast<void **>(args) = ptr;
+}
+
+TEST(ie_blob_make_memory_from_preallocated_with_release, releaseIsCalledAfterBlobFree) {
+    dimensions_t dim_t = {4, {1, 3, 4, 4}};
+    tensor_desc tensor;
+    tensor.dims = dim_t;
+    tensor.precision = precision_e::U8;
+    tensor.layout = layout_e::NCHW;
+    uint8_t array[1][3][4][4]= {0};
+
+    void *released = nullptr;
+    ie_blob_release_call_back_t release = {release_callback, &released};
+    ie_blob_t *blob = nullptr;
+    IE_EXPECT_OK(ie_blob_make_memory_from_preallocated_with_release(&tensor, &array, 48, &release, &blob));
+    ASSERT_NE(nullptr, blob);
+
+    ie_blob_buffer_t buffer;
+    IE_EXPECT_OK(ie_blob_get_buffer(blob, &buffer));
+    EXPECT_EQ(static_cast<void *>(&array), buffer.buffer);
+    EXPECT_EQ(nullptr, released);
+
+    ie_blob_free(&blob);
+    EXPECT_EQ(static_cast<void *>(&array), released);
+}
+
 TEST(ie_blob_make_memory_with_roi, makeMemorywithROI) {
 
     dimensions_t dim_t;
@@ -1495,6 +1522,72 @@ TEST(ie_infer_set_completion_callback, setCallback) {
     ie_core_free(&core);
 }
 
+TEST(ie_completion_queue, requestsAreReportedToQueue) {
+    ie_core_t *core = nullptr;
+    IE_ASSERT_OK(ie_core_create("", &core));
+    ASSERT_NE(nullptr, core);
+
+    ie_network_t *network = nullptr;
+    IE_EXPECT_OK(ie_core_read_network(core, xml, bin, &network));
+    EXPECT_NE(nullptr, network);
+
+    IE_EXPECT_OK(ie_network_set_input_precision(network, "data", precision_e::U8));
+
+    const char *device_name = "CPU";
+    ie_config_t config = {nullptr, nullptr, nullptr};
+    ie_executable_network_t *exe_network = nullptr;
+    IE_EXPECT_OK(ie_core_load_network(core, network, device_name, &config, &exe_network));
+    EXPECT_NE(nullptr, exe_network);
+
+    ie_completion_queue_t *queue = nullptr;
+    IE_ASSERT_OK(ie_completion_queue_create(&queue));
+
+    cv::Mat image = cv::imread(input_image);
+    ie_infer_request_t *infer_requests[2] = {nullptr, nullptr};
+    ie_blob_t *blobs[2] = {nullptr, nullptr};
+    int ids[2] = {0, 1};
+    for (int i = 0; i < 2; ++i) {
+        IE_EXPECT_OK(ie_exec_network_create_infer_request(exe_network, &infer_requests[i]));
+        ASSERT_NE(nullptr, infer_requests[i]);
+
+        tensor_desc_t tensor = {layout_e::NCHW, {4, {1, 3, 224, 224}}, precision_e::U8};
+        IE_EXPECT_OK(ie_blob_make_memory(&tensor, &blobs[i]));
+        Mat2Blob(image, blobs[i]);
+        const char *names[] = {"data"};
+        const ie_blob_t *inputs[] = {blobs[i]};
+        IE_EXPECT_OK(ie_infer_request_set_blobs(infer_requests[i], names, inputs, 1));
+        IE_EXPECT_OK(ie_infer_request_set_completion_queue(infer_requests[i], queue, &ids[i]));
+    }
+
+    ie_infer_request_t *completed = nullptr;
+    void *user_data = nullptr;
+    EXPECT_EQ(IEStatusCode::RESULT_NOT_READY, ie_completion_queue_wait(queue, 0, &completed, &user_data, nullptr));
+
+    for (int i = 0; i < 2; ++i) {
+        IE_EXPECT_OK(ie_infer_request_infer_async(infer_requests[i]));
+    }
+
+    bool seen[2] = {false, false};
+    for (int i = 0; i < 2 && !HasFailure(); ++i) {
+        IEStatusCode infer_status = IEStatusCode::GENERAL_ERROR;
+        IE_EXPECT_OK(ie_completion_queue_wait(queue, -1, &completed, &user_data, &infer_status));
+        IE_EXPECT_OK(infer_status);
+        const int id = *static_cast<int *>(user_data);
+        EXPECT_EQ(infer_requests[id], completed);
+        seen[id] = true;
+    }
+    EXPECT_TRUE(seen[0] && seen[1]);
+
+    for (int i = 0; i < 2; ++i) {
+        ie_blob_free(&blobs[i]);
+        ie_infer_request_free(&infer_requests[i]);
+    }
+    ie_completion_queue_free(&queue);
+    ie_exec_network_free(&exe_network);
+    ie_network_free(&network);
+    ie_core_free(&core);
+}
+
 TEST(ie_blob_make_memory_nv12, makeNV12Blob) {
     dimensions_t dim_y = {4, {1, 1, 8, 12}}, dim_uv = {4, {1, 2, 4, 6}};
     tensor_desc tensor_y, tensor_uv;
@@ -48,6 +48,12 @@ cdef class ExecutableNetwork:
     cdef public:
         _requests, _infer_requests
 
+cdef class AsyncInferQueue:
+    cdef unique_ptr[C.AsyncInferQueue] impl
+    cdef _process_completed(self)
+    cdef public:
+        _exec_net, _requests, _userdata, _callback
+
 cdef class IECore:
     cdef C.IECore impl
     cpdef IENetwork read_network(self, model : [str, bytes, os.PathLike], weights : [str, bytes, os.PathLike] = ?, bool init_from_buffer = ?)
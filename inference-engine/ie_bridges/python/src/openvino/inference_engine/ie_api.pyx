@@ -169,7 +169,9 @@ cdef class Blob:
                 fp32_array_memview = self._array_data
                 self._ptr = C.make_shared_blob[float](c_tensor_desc, &fp32_array_memview[0], fp32_array_memview.shape[0])
             elif precision == "FP16":
-                raise RuntimeError("Currently, it's impossible to set_blob with FP16 precision")
+                # there is no half type on Cython side, the memory is shared as int16
+                I16_array_memview = self._array_data.view(np.int16)
+                self._ptr = C.make_shared_blob[int16_t](c_tensor_desc, &I16_array_memview[0], I16_array_memview.shape[0])
             elif precision == "I16":
                 I16_array_memview = self._array_data
                 self._ptr = C.make_shared_blob[int16_t](c_tensor_desc, &I16_array_memview[0], I16_array_memview.shape[0])
@@ -944,6 +946,85 @@ cdef class ExecutableNetwork:
     cpdef get_idle_request_id(self):
         return deref(self.impl).getIdleRequestId()
 
+## This class provides a pool of infer requests of `ExecutableNetwork` which schedules them on C++ side.
+#  The GIL is released while waiting for an idle request and while starting inference. Completions are
+#  collected without the GIL and the callback is called for all of them at once from `start_async()`
+#  and `wait_all()`, so the GIL is not acquired per request.
+#
+#  \note Requests of the executable network should not be started directly while the queue exists.
+#
+#  Usage example:\n
+#  ```python
+#  ie_core = IECore()
+#  net = ie_core.read_network(model=path_to_xml_file, weights=path_to_bin_file)
+#  exec_net = ie_core.load_network(network=net, device_name="CPU", num_requests=4)
+#  results = {}
+#  def callback(request, userdata, status):
+#      results[userdata] = deepcopy(request.output_blobs['prob'].buffer)
+#  infer_queue = AsyncInferQueue(exec_net)
+#  infer_queue.set_callback(callback)
+#  for i, img in enumerate(images):
+#      infer_queue.start_async({'data': img}, userdata=i)
+#  infer_queue.wait_all()
+#  ```
+cdef class AsyncInferQueue:
+    ## Creates the queue over all infer requests of `exec_net`
+    #  @param exec_net: An `ExecutableNetwork` instance. The queue keeps a reference to it.
+    def __init__(self, ExecutableNetwork exec_net):
+        self._exec_net = exec_net
+        self._requests = exec_net.requests
+        self._userdata = [None] * len(self._requests)
+        self._callback = None
+        self.impl.reset(new C.AsyncInferQueue(deref(exec_net.impl)))
+
+    def __dealloc__(self):
+        # waits for running requests, whose completion does not need the GIL
+        with nogil:
+            self.impl.reset()
+
+    ## Sets a function that is called as `callback(request, userdata, status)` for every completed request
+    #  from `start_async()` and `wait_all()`
+    def set_callback(self, callback):
+        self._callback = callback
+
+    ## Waits for an idle infer request and starts asynchronous inference on it
+    #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper
+    #                 shape with input data for the layer
+    #  @param userdata: Any object passed to the callback when the request completes
+    #  @return Index of the started infer request
+    def start_async(self, inputs=None, userdata=None):
+        cdef int request_id
+        with nogil:
+            request_id = deref(self.impl).getIdleRequestId()
+        # the taken request could have completed since last call, report it before reuse
+        self._process_completed()
+        if inputs is not None:
+            self._requests[request_id]._fill_inputs(inputs)
+        self._userdata[request_id] = userdata
+        with nogil:
+            deref(self.impl).startAsync(request_id)
+        return request_id
+
+    ## Waits until all infer requests are idle and calls the callback for the completed ones
+    def wait_all(self):
+        with nogil:
+            deref(self.impl).waitAll()
+        self._process_completed()
+
+    cdef _process_completed(self):
+        cdef vector[pair[int, int]] completed = deref(self.impl).popCompleted()
+        if self._callback is None:
+            return
+        for item in completed:
+            self._callback(self._requests[item.first], self._userdata[item.first], item.second)
+
+    def __len__(self):
+        return len(self._requests)
+
+    ## Infer request of the queue by index
+    def __getitem__(self, index):
+        return self._requests[index]
+
 ctypedef extern void (*cb_type)(void*, int) with gil
 
 ## This class provides an interface to infer requests of `ExecutableNetwork` and serves to handle infer requests execution
@@ -1013,13 +1094,16 @@ cdef class InferRequest:
         return input_blobs
 
     ## Dictionary that maps output layer names to corresponding Blobs
+    #
+    #  \note Blobs share memory with the infer request, so their data is overwritten by the next inference.
+    #         Use `deepcopy` to keep the results.
     @property
     def output_blobs(self):
         output_blobs = {}
         for output in self._outputs_list:
             blob = Blob()
             deref(self.impl).getBlobPtr(output.encode(), blob._ptr)
-            output_blobs[output] = deepcopy(blob)
+            output_blobs[output] = blob
         return output_blobs
 
     ## Dictionary that maps input layer names to corresponding preprocessing information
@@ -1038,7 +1122,9 @@ cdef class InferRequest:
 
     ## Sets user defined Blob for the infer request
     #  @param blob_name: A name of input blob
-    #  @param blob: Blob object to set for the infer request
+    #  @param blob: Blob object to set for the infer request or `numpy.ndarray`. C-contiguous array is used
+    #               without copying with the precision, dims and layout of the current blob. The infer request
+    #               keeps the array alive.
     #  @param preprocess_info: PreProcessInfo object to set for the infer request.
     #  @return None
     #
@@ -1052,12 +1138,19 @@ cdef class InferRequest:
     #  blob = Blob(td, blob_data)
     #  exec_net.requests[0].set_blob(blob_name="input_blob_name", blob=blob),
     #  ```
-    def set_blob(self, blob_name : str, blob : Blob, preprocess_info: PreProcessInfo = None):
+    def set_blob(self, blob_name : str, blob : [Blob, np.ndarray], preprocess_info: PreProcessInfo = None):
+        cdef Blob c_blob
+        if isinstance(blob, np.ndarray):
+            c_blob = Blob()
+            deref(self.impl).getBlobPtr(blob_name.encode(), c_blob._ptr)
+            c_blob = Blob(c_blob.tensor_desc, blob)
+        else:
+            c_blob = blob
         if preprocess_info:
-            deref(self.impl).setBlob(blob_name.encode(), blob._ptr, deref(preprocess_info._ptr))
+            deref(self.impl).setBlob(blob_name.encode(), c_blob._ptr, deref(preprocess_info._ptr))
         else:
-            deref(self.impl).setBlob(blob_name.encode(), blob._ptr)
-        self._user_blobs[blob_name] = blob
+            deref(self.impl).setBlob(blob_name.encode(), c_blob._ptr)
+        self._user_blobs[blob_name] = c_blob
     ## Starts synchronous inference of the infer request and fill outputs array
     #
     #  @param inputs: A dictionary that maps input layer names to `numpy.ndarray` objects of proper shape with
@@ -1220,9 +1313,10 @@ cdef class InferRequest:
         deref(self.impl).setBatch(size)
 
     def _fill_inputs(self, inputs):
+        input_blobs = self.input_blobs
         for k, v in inputs.items():
             assert k in self._inputs_list, "No input with name {} found in network".format(k)
-            self.input_blobs[k].buffer[:] = v
+            input_blobs[k].buffer[:] = v
 
 
 ## This class contains the information about the network model read from IR and allows you to manipulate with
@@ -1484,10 +1578,9 @@ cdef class BlobBuffer:
     cdef char*_get_blob_format(self, const CTensorDesc & desc):
         cdef Precision precision = desc.getPrecision()
         name = bytes(precision.name()).decode()
-        # todo: half floats
         precision_to_format = {
             'FP32': 'f',  # float
-            'FP16': 'h',  # signed short
+            'FP16': 'e',  # half float
             'U8': 'B',  # unsigned char
             'U16': 'H',  # unsigned short
             'I8': 'b',  # signed char
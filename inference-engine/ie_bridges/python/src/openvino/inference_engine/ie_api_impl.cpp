@@ -377,16 +377,20 @@ void InferenceEnginePython::InferRequestWrap::setBatch(int size) {
 }
 
 void latency_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
-    if (code != InferenceEngine::StatusCode::OK) {
-        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
-    }
     InferenceEnginePython::InferRequestWrap *requestWrap;
     InferenceEngine::ResponseDesc dsc;
     request->GetUserData(reinterpret_cast<void **>(&requestWrap), &dsc);
+    // AsyncInferQueue reports failed requests with their status code
+    if (code != InferenceEngine::StatusCode::OK && !requestWrap->queue_callback) {
+        THROW_IE_EXCEPTION << "Async Infer Request failed with status code " << code;
+    }
     auto end_time = Time::now();
     auto execTime = std::chrono::duration_cast<ns>(end_time - requestWrap->start_time);
     requestWrap->exec_time = static_cast<double>(execTime.count()) * 0.000001;
     requestWrap->request_queue_ptr->setRequestIdle(requestWrap->index);
+    if (requestWrap->queue_callback) {
+        requestWrap->queue_callback(requestWrap->index, code);
+    }
     if (requestWrap->user_callback) {
         requestWrap->user_callback(requestWrap->user_data, code);
     }
@@ -523,6 +527,57 @@ void InferenceEnginePython::IEExecNetwork::createInferRequests(int num_requests)
     }
 }
 
+InferenceEnginePython::AsyncInferQueue::AsyncInferQueue(IEExecNetwork &exec_network) :
+        requests(exec_network.infer_requests) {
+    for (auto &request : requests) {
+        idle_ids.push(request.index);
+        request.queue_callback = [this](int index, int status) {
+            std::lock_guard<std::mutex> lock(mutex);
+            completed.emplace_back(index, status);
+            idle_ids.push(index);
+            cv.notify_all();
+        };
+    }
+}
+
+InferenceEnginePython::AsyncInferQueue::~AsyncInferQueue() {
+    waitAll();
+    for (auto &request : requests) {
+        request.queue_callback = nullptr;
+    }
+}
+
+int InferenceEnginePython::AsyncInferQueue::getIdleRequestId() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return !idle_ids.empty(); });
+    int index = idle_ids.front();
+    idle_ids.pop();
+    return index;
+}
+
+void InferenceEnginePython::AsyncInferQueue::startAsync(int index) {
+    try {
+        requests[index].infer_async();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        idle_ids.push(index);
+        cv.notify_all();
+        throw;
+    }
+}
+
+void InferenceEnginePython::AsyncInferQueue::waitAll() {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [this] { return idle_ids.size() == requests.size(); });
+}
+
+std::vector<std::pair<int, int>> InferenceEnginePython::AsyncInferQueue::popCompleted() {
+    std::vector<std::pair<int, int>> result;
+    std::lock_guard<std::mutex> lock(mutex);
+    result.swap(completed);
+    return result;
+}
+
 InferenceEnginePython::IENetwork
 InferenceEnginePython::IECore::readNetwork(const std::string& modelPath, const std::string& binPath) {
     InferenceEngine::CNNNetwork net = actual.ReadNetwork(modelPath, binPath);
@@ -19,6 +19,7 @@
 #include <chrono>
 #include <queue>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
 
 #include <ie_extension.h>
@@ -100,6 +101,8 @@ struct InferRequestWrap {
     cy_callback user_callback;
     void *user_data;
     IdleInferRequestQueue::Ptr  request_queue_ptr;
+    // set by AsyncInferQueue, called on completion from Inference Engine thread without GIL
+    std::function<void(int, int)> queue_callback;
 
     void infer();
 
@@ -151,6 +154,34 @@ struct IEExecNetwork {
 };
 
 
+/**
+ * Pool of infer requests of executable network with completion queue on C++ side. Requests
+ * are taken and started without GIL, and completions are collected to be reported to Python
+ * in batches from the thread that uses the queue.
+ */
+struct AsyncInferQueue {
+    std::vector<InferRequestWrap> &requests;
+    std::queue<int> idle_ids;
+    // (request index, status code) of requests completed since last popCompleted
+    std::vector<std::pair<int, int>> completed;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    explicit AsyncInferQueue(IEExecNetwork &exec_network);
+    ~AsyncInferQueue();
+
+    // blocks until any request is idle and reserves it
+    int getIdleRequestId();
+
+    void startAsync(int index);
+
+    // blocks until all requests are idle
+    void waitAll();
+
+    std::vector<std::pair<int, int>> popCompleted();
+};
+
+
 struct IECore {
     InferenceEngine::Core actual;
     explicit IECore(const std::string & xmlConfigFile = std::string());
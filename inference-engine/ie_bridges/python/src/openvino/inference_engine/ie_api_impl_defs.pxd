@@ -190,6 +190,13 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         void setBatch(int size) except +
         void setCyCallback(void (*)(void*, int), void *) except +
 
+    cdef cppclass AsyncInferQueue:
+        AsyncInferQueue(IEExecNetwork & exec_network) except +
+        int getIdleRequestId() nogil
+        void startAsync(int index) nogil except +
+        void waitAll() nogil
+        vector[pair[int, int]] popCompleted()
+
     cdef cppclass IECore:
         IECore() except +
         IECore(const string & xml_config_file) except +
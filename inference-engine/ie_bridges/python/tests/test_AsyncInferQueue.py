@@ -0,0 +1,75 @@
+import numpy as np
+import os
+import pytest
+
+from openvino.inference_engine import ie_api as ie
+from conftest import model_path, image_path
+
+is_myriad = os.environ.get("TEST_DEVICE") == "MYRIAD"
+test_net_xml, test_net_bin = model_path(is_myriad)
+path_to_img = image_path()
+
+
+def read_image():
+    import cv2
+    n, c, h, w = (1, 3, 32, 32)
+    image = cv2.imread(path_to_img)
+    if image is None:
+        raise FileNotFoundError("Input image not found")
+
+    image = cv2.resize(image, (h, w)) / 255
+    image = image.transpose((2, 0, 1)).astype(np.float32)
+    image = image.reshape((n, c, h, w))
+    return image
+
+
+def load_queue(device, num_requests):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(net, device, num_requests=num_requests)
+    return ie.AsyncInferQueue(exec_net)
+
+
+def test_len(device):
+    infer_queue = load_queue(device, 3)
+    assert len(infer_queue) == 3
+    assert isinstance(infer_queue[0], ie.InferRequest)
+
+
+def test_callbacks(device):
+    infer_queue = load_queue(device, 4)
+    img = read_image()
+    results = {}
+
+    def callback(request, userdata, status):
+        assert status == ie.StatusCode.OK
+        results[userdata] = np.argmax(request.output_blobs['fc_out'].buffer)
+
+    infer_queue.set_callback(callback)
+    for i in range(10):
+        request_id = infer_queue.start_async({'data': img}, userdata=i)
+        assert 0 <= request_id < len(infer_queue)
+    infer_queue.wait_all()
+    assert results == {i: 2 for i in range(10)}
+
+
+def test_without_callback(device):
+    infer_queue = load_queue(device, 2)
+    img = read_image()
+    request_id = infer_queue.start_async({'data': img})
+    infer_queue.wait_all()
+    assert np.argmax(infer_queue[request_id].output_blobs['fc_out'].buffer) == 2
+
+
+def test_callback_exception(device):
+    infer_queue = load_queue(device, 1)
+    img = read_image()
+
+    def callback(request, userdata, status):
+        raise RuntimeError("callback failed")
+
+    infer_queue.set_callback(callback)
+    infer_queue.start_async({'data': img})
+    with pytest.raises(RuntimeError) as e:
+        infer_queue.wait_all()
+    assert "callback failed" in str(e.value)
@@ -46,7 +46,6 @@ def test_write_to_buffer_fp32():
     assert np.array_equal(blob.buffer, ones_arr)
 
 
-@pytest.mark.skip(reason="Need to figure out how to implement right conversion")
 def test_write_to_buffer_fp16():
     tensor_desc = TensorDesc("FP16", [1, 3, 127, 127], "NCHW")
     array = np.zeros(shape=(1, 3, 127, 127), dtype=np.float16)
@@ -270,9 +270,10 @@ def test_infer_modify_outputs(device):
     outputs0['fc_out'][:] = np.zeros(shape=(1, 10), dtype=np.float32)
     outputs1 = request.output_blobs
     assert np.argmax(outputs1['fc_out'].buffer) == 2
+    # output blobs share memory with the request
     outputs1['fc_out'].buffer[:] = np.ones(shape=(1, 10), dtype=np.float32)
     outputs2 = request.output_blobs
-    assert np.argmax(outputs2['fc_out'].buffer) == 2
+    assert np.array_equal(outputs2['fc_out'].buffer, np.ones(shape=(1, 10), dtype=np.float32))
     del exec_net
     del ie_core
     del net
@@ -454,6 +455,20 @@ def test_blob_setter(device):
     assert np.allclose(res_1, res_2, atol=1e-2, rtol=1e-2)
 
 
+def test_blob_setter_numpy(device):
+    ie_core = ie.IECore()
+    net = ie_core.read_network(test_net_xml, test_net_bin)
+    exec_net = ie_core.load_network(network=net, device_name=device, num_requests=1)
+    img = read_image()
+    request = exec_net.requests[0]
+    request.set_blob('data', img)
+    # the array memory is used by the request without copying
+    img[:] = read_image()
+    assert np.shares_memory(request.input_blobs['data'].buffer, img)
+    request.infer()
+    assert np.argmax(request.output_blobs['fc_out'].buffer) == 2
+
+
 def test_blob_setter_with_preprocess(device):
     ie_core = ie.IECore()
     net = ie_core.read_network(test_net_xml, test_net_bin)
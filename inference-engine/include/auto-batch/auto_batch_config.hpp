@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for Auto-Batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file auto_batch_config.hpp
+ */
+
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Auto-Batching plugin configuration
+ */
+namespace AutoBatchConfigParams {
+
+/**
+ * @def AUTO_BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides an AUTO_BATCH-mangled name for configuration key with name `name`
+ */
+#define AUTO_BATCH_CONFIG_KEY(name) InferenceEngine::AutoBatchConfigParams::_CONFIG_KEY(AUTO_BATCH_##name)
+
+#define DECLARE_AUTO_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(AUTO_BATCH_##name)
+
+/**
+ * @brief A device to execute batched requests on, e.g. "CPU" or "GPU.1".
+ * The key is also set by the Core when the "BATCH:<device>" device name is used
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(DEVICE);
+
+/**
+ * @brief The maximum number of batch-1 requests combined into a single batched request (8 by default).
+ * The network is reshaped to this batch size when it is loaded to the device
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(SIZE);
+
+/**
+ * @brief The maximum time in milliseconds a request waits for other requests to fill the batch (100 by default).
+ * When the timeout elapses, the batch is executed with the requests that are collected so far
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace AutoBatchConfigParams
+}  // namespace InferenceEngine
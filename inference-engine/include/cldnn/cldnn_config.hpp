@@ -72,6 +72,50 @@ DECLARE_CLDNN_CONFIG_KEY(ENABLE_FP16_FOR_QUANTIZED_MODELS);
 */
 DECLARE_CLDNN_CONFIG_KEY(NV12_TWO_INPUTS);
 
+/**
+* @brief This key limits the total size (in megabytes) of compiled OpenCL programs stored in the directory set by
+* CONFIG_KEY(CACHE_DIR). When the limit is exceeded, the least recently used programs are removed.
+* This option should be used with an unsigned integer value, 0 (default) means no limit.
+*/
+DECLARE_CLDNN_CONFIG_KEY(KERNELS_CACHE_MAX_SIZE);
+
+/**
+* @brief This key sets the maximum number of host threads used to compile OpenCL programs during LoadNetwork.
+* This option should be used with an unsigned integer value. By default, and if the value is 0 or exceeds
+* the number of hardware threads, all hardware threads are used.
+*/
+DECLARE_CLDNN_CONFIG_KEY(MAX_NUM_THREADS);
+
+/**
+* @brief This key enables lazy compilation of kernels of rarely executed subgraphs (e.g. condition branches).
+* They are compiled in the background after LoadNetwork, and the first execution which needs a kernel that is not
+* built yet waits for it. Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(LAZY_KERNELS_COMPILATION);
+
+/**
+* @brief This key enables parallel execution of independent branches of a network (e.g. Inception blocks) by ordering
+* kernels in the out-of-order OpenCL queue with events of their inputs instead of queue barriers. It mostly improves
+* latency of wide graphs, it has effect only if the OpenCL driver supports out-of-order queues. Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(PARALLEL_BRANCHES);
+
+/**
+* @brief This key limits the device memory (in megabytes) used by all streams of a network set by
+* CONFIG_KEY(GPU_THROUGHPUT_STREAMS). Streams which don't fit into the limit are not created, so the network is loaded
+* with fewer streams instead of failing; LoadNetwork throws if even the first stream exceeds the limit.
+* This option should be used with an unsigned integer value, 0 (default) means the global memory size of the device.
+* Current usage is reported by the METRIC_KEY(GPU_MEMORY_STATISTICS) metric of an executable network.
+*/
+DECLARE_CLDNN_CONFIG_KEY(DEVICE_MEMORY_LIMIT);
+
+/**
+* @brief This key makes dynamic batch (CONFIG_KEY(DYN_BATCH_ENABLED)) use a single network compiled for the maximal
+* batch instead of a network per power of two batch. It saves device memory and load time, kernels which support
+* it skip batches above the one set by SetBatch(), other kernels compute all batches. Turned off by default.
+*/
+DECLARE_CLDNN_CONFIG_KEY(DYN_BATCH_SINGLE_NETWORK);
+
 
 }  // namespace CLDNNConfigParams
 }  // namespace InferenceEngine
@@ -123,6 +123,21 @@ public:
         return std::make_shared<InferRequest>(req, plg);
     }
 
+    /**
+     * @copybrief IExecutableNetwork::StartAsyncBatch
+     *
+     * Wraps IExecutableNetwork::StartAsyncBatch.
+     * @param requests Requests created by the executable network
+     */
+    void StartAsyncBatch(std::vector<InferRequest>& requests) {
+        std::vector<IInferRequest::Ptr> actualRequests;
+        actualRequests.reserve(requests.size());
+        for (auto&& request : requests) {
+            actualRequests.emplace_back(static_cast<IInferRequest::Ptr&>(request));
+        }
+        CALL_STATUS_FNC(StartAsyncBatch, actualRequests);
+    }
+
     /**
      * @copybrief IExecutableNetwork::Export
      *
@@ -54,6 +54,27 @@ public:
     }
 };
 
+/**
+ * @brief Passes calls of the wrapped callback to an application provided post function, e.g. a function which
+ * schedules the call on an event loop
+ */
+template <class P>
+class PostedCompletionCallbackWrapper : public ICompletionCallbackWrapper {
+    std::shared_ptr<ICompletionCallbackWrapper> callback;
+    P post;
+
+public:
+    PostedCompletionCallbackWrapper(const std::shared_ptr<ICompletionCallbackWrapper>& callback, const P& post)
+        : callback(callback), post(post) {}
+
+    void call(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) const noexcept override {
+        auto wrapped = callback;
+        post([wrapped, request, code] {
+            wrapped->call(request, code);
+        });
+    }
+};
+
 }  // namespace details
 
 /**
@@ -207,6 +228,17 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @brief Sets a scheduling priority and a deadline of all the following asynchronous inference calls for this
+     * request.
+     *
+     * @param priority A priority of the request, requests with greater priority are started first
+     * @param deadline_ms A deadline in milliseconds since the start of inference, 0 means no deadline
+     */
+    void SetPriority(const int priority, const int64_t deadline_ms = 0) {
+        CALL_STATUS_FNC(SetPriority, priority, deadline_ms);
+    }
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      *
@@ -251,6 +283,25 @@ public:
         actual->SetCompletionCallback(callWrapper);
     }
 
+    /**
+     * @copybrief IInferRequest::SetImmediateCompletionCallback
+     *
+     * Wraps IInferRequest::SetImmediateCompletionCallback. The thread which completes the request passes the callback
+     * to the post function, so the application can handle many requests on its own threads without blocking waits
+     * and without a handoff through the callback thread of the plugin.
+     *
+     * @param callbackToSet Lambda callback object which will be called on processing finish.
+     * @param post A function object which accepts a `std::function<void()>` and schedules its call. It must not block
+     * or throw.
+     */
+    template <class T, class P>
+    void SetCompletionCallback(const T& callbackToSet, const P& post) {
+        std::shared_ptr<details::ICompletionCallbackWrapper> wrapped(new details::CompletionCallbackWrapper<T>(callbackToSet));
+        callback.reset(new details::PostedCompletionCallbackWrapper<P>(wrapped, post));
+        CALL_STATUS_FNC(SetUserData, callback.get());
+        actual->SetImmediateCompletionCallback(callWrapper);
+    }
+
     /**
      * @copybrief IExecutableNetwork::QueryState
      *
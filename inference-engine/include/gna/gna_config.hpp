@@ -79,7 +79,9 @@ DECLARE_GNA_CONFIG_VALUE(AVX2);
 DECLARE_GNA_CONFIG_VALUE(AVX2_EXACT);
 
 /**
-* @brief if enabled produced minimum memory footprint for loaded network in GNA memory, default value is YES
+* @brief if enabled produced minimum memory footprint for loaded network in GNA memory, default value is NO.
+* Intermediate buffers, which are not used by the same layers, share memory, and activations overwrite their inputs,
+* if the inputs are not used by other layers
 */
 DECLARE_GNA_CONFIG_KEY(COMPACT_MODE);
 
@@ -100,5 +102,39 @@ DECLARE_GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN);
 * of issuing. Additionally, in this case, software modes do not implement any serializations.
 */
 DECLARE_GNA_CONFIG_KEY(LIB_N_THREADS);
+
+/**
+* @brief Number of GNA request configurations, each with its own copy of input, output and intermediate buffers,
+* created for the executable network. Up to this number of infer requests can be queued to the device at once,
+* so host-side input import of one request overlaps with device execution of the others.
+* Default value is 1, the effective value is never less than GNA_LIB_N_THREADS.
+* Networks with memory layers always use one request configuration.
+*/
+DECLARE_GNA_CONFIG_KEY(REQUESTS_NUM);
+
+/**
+* @brief If enabled, network with memory layers and batch size greater than 1 is compiled for a single frame,
+* and frames of the batch are inferred one by one within one infer request, so memory layers are updated
+* after every frame exactly as if each frame was inferred by a separate request. Default value is NO,
+* in that case the whole batch is inferred at once and memory layers are updated once per request.
+*/
+DECLARE_GNA_CONFIG_KEY(SEQUENTIAL_BATCH);
 }  // namespace GNAConfigParams
+
+/**
+ * @def GNA_METRIC_KEY(name)
+ * @brief Shortcut for defining GNA metrics
+ */
+#define GNA_METRIC_KEY(name) METRIC_KEY(GNA_##name)
+#define DECLARE_GNA_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(GNA_##name, __VA_ARGS__)
+
+namespace Metrics {
+
+/**
+* @brief Metric to get size in bytes of GNA memory occupied by the loaded network,
+* including buffers of all its request configurations, String value is METRIC_GNA_MEMORY_FOOTPRINT
+*/
+DECLARE_GNA_METRIC_KEY(MEMORY_FOOTPRINT, uint64_t);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
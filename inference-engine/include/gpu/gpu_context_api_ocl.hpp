@@ -225,6 +225,26 @@ static inline Blob::Ptr make_shared_blob(const TensorDesc& desc, ClContext::Ptr
     return std::dynamic_pointer_cast<Blob>(ctx->CreateBlob(desc));
 }
 
+/**
+ * @brief This function is used to create a blob in host memory allocated by GPU plugin within the given context.
+ * Input and output data of such blobs is accessed with buffer() and is not copied between host and device memory
+ * during inference. Memory of destroyed blobs is pooled in the context and reused by new blobs of the same layout
+ * @param desc A tensor descriptor object representing remote blob configuration
+ * @param ctx A remote context used to create remote blob
+ * @return A remote blob instance
+ */
+static inline Blob::Ptr make_shared_host_blob(const TensorDesc& desc, RemoteContext::Ptr ctx) {
+    auto casted = std::dynamic_pointer_cast<ClContext>(ctx);
+    if (nullptr == casted) {
+        THROW_IE_EXCEPTION << "Invalid remote context passed";
+    }
+
+    ParamMap params = {
+        { GPU_PARAM_KEY(SHARED_MEM_TYPE), GPU_PARAM_VALUE(USM_HOST_BUFFER) }
+    };
+    return std::dynamic_pointer_cast<Blob>(casted->CreateBlob(desc, params));
+}
+
 /**
  * @brief This function is used to obtain remote blob object from user-supplied cl::Buffer wrapper object
  * @param desc A tensor descriptor object representing remote blob configuration
@@ -90,6 +90,11 @@ DECLARE_GPU_PARAM_VALUE(VA_SURFACE);
 * @brief Shared D3D buffer blob
 */
 DECLARE_GPU_PARAM_VALUE(DX_BUFFER);
+/**
+* @brief Host memory blob allocated by the plugin, which is read and written by the device without staging copies.
+* USM host memory is used if the device supports it, otherwise a mapped OpenCL buffer
+*/
+DECLARE_GPU_PARAM_VALUE(USM_HOST_BUFFER);
 
 /**
 * @brief This key identifies OpenCL memory handle
@@ -35,5 +35,13 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of moving small subgraphs to a neighbour device when layers are assigned with
+ * the default fallback policy and the estimated cost of computations and transfers between devices decreases.
+ * Layers are moved only to devices which support them. Affinities set by a user are never changed.
+ * This option should be used with values: CONFIG_VALUE(YES) (default) or CONFIG_VALUE(NO)
+ */
+DECLARE_HETERO_CONFIG_KEY(MERGE_SUBGRAPHS);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
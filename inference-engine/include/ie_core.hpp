@@ -9,6 +9,8 @@
  */
 #pragma once
 
+#include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -21,6 +23,51 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief This class tracks a network loading started by Core::LoadNetworkAsync.
+ *
+ * Copies of the object refer to the same loading. Destruction of the last copy waits for the loading to finish.
+ */
+class INFERENCE_ENGINE_API_CLASS(LoadNetworkTask) {
+public:
+    /**
+     * @brief A callback called with a name of a LoadNetwork phase (for example, "Transformations" or
+     *        "KernelCompilation") when the phase starts. It may be called from plugin threads and must not throw.
+     */
+    using ProgressCallback = std::function<void(const std::string& phase)>;
+
+    /**
+     * @brief Waits for the loading to finish
+     * @return An executable network
+     * @throws An exception of LoadNetwork, including the one of a cancelled loading
+     */
+    ExecutableNetwork Get() const;
+
+    /**
+     * @brief Waits for the loading to finish at most a given time
+     * @param timeout Maximum time to wait
+     * @return `true` if the loading is finished and Get does not block
+     */
+    bool WaitFor(std::chrono::milliseconds timeout) const;
+
+    /**
+     * @brief Requests cancellation of the loading. A plugin stops before its next LoadNetwork phase and Get throws,
+     *        a network which is already loaded is returned as usual.
+     */
+    void Cancel() noexcept;
+
+    /**
+     * @brief Returns a LoadNetwork phase in progress
+     * @return A phase name or an empty string if the plugin has not reported any phase yet
+     */
+    std::string GetPhase() const;
+
+private:
+    friend class Core;
+    struct State;
+    std::shared_ptr<State> _state;
+};
+
 /**
  * @brief This class represents Inference Engine Core entity.
  *
@@ -85,6 +132,8 @@ public:
      * `InferenceEngine::Core::ReadNetwork(const std::string& model, const Blob::CPtr& weights) const`
      * function overload which takes a filesystem path to the model.
      * For ONNX case the second parameter should contain empty blob.
+     * @note Constants of the read network reference the data of the weights blob without copying,
+     * so memory of a blob created on top of a user buffer must stay valid while the network is used.
      * @return CNNNetwork
      */
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const;
@@ -105,6 +154,24 @@ public:
         const CNNNetwork& network, const std::string& deviceName,
         const std::map<std::string, std::string>& config = {});
 
+    /**
+     * @brief Starts creation of an executable network from a network object in a background thread.
+     *
+     * Several networks started this way are loaded in parallel, the network object must not be changed until its
+     * loading is finished.
+     *
+     * @param network CNNNetwork object acquired from Core::ReadNetwork
+     * @param deviceName Name of device to load network to
+     * @param config Optional map of pairs: (config parameter name, config parameter value) relevant only for this load
+     * operation
+     * @param progress Optional callback notified about started LoadNetwork phases
+     * @return An object to wait for, cancel or track the loading
+     */
+    LoadNetworkTask LoadNetworkAsync(
+        const CNNNetwork& network, const std::string& deviceName,
+        const std::map<std::string, std::string>& config = {},
+        LoadNetworkTask::ProgressCallback progress = {});
+
     /**
      * @brief Registers extension
      * @param extension Pointer to already loaded extension
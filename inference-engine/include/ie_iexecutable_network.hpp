@@ -165,6 +165,18 @@ public:
      * @return code of the operation. InferenceEngine::OK if succeeded
      */
     virtual StatusCode GetContext(RemoteContext::Ptr& pContext, ResponseDesc* resp) const noexcept = 0;
+
+    /**
+     * @brief Starts inference of several requests created by this executable network in asynchronous mode.
+     *
+     * The requests are submitted to the plugin at once, which is cheaper than a StartAsync call per request.
+     * Requests created by other executable networks are started one by one.
+     *
+     * @param requests Requests to start
+     * @param resp Pointer to the response message that holds a description of an error if any occurred
+     * @return code of the operation. InferenceEngine::OK if succeeded
+     */
+    virtual StatusCode StartAsyncBatch(const std::vector<IInferRequest::Ptr>& requests, ResponseDesc* resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
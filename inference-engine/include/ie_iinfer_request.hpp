@@ -149,6 +149,18 @@ public:
      */
     virtual StatusCode SetCompletionCallback(CompletionCallback callback) noexcept = 0;
 
+    /**
+     * @brief Sets a callback function that will be called on success or failure of asynchronous request by the
+     * thread which completes the request, without passing it to a separate callback thread of the plugin
+     *
+     * The callback must not block, it is intended to post the completion to an application executor or event loop.
+     * The callback replaces the one set by SetCompletionCallback
+     *
+     * @param callback A function to be called
+     * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
+     */
+    virtual StatusCode SetImmediateCompletionCallback(CompletionCallback callback) noexcept = 0;
+
     /**
      * @brief Gets arbitrary data for the request and stores a pointer to a pointer to the obtained data
      *
@@ -179,6 +191,23 @@ public:
      */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc* resp) noexcept = 0;
 
+    /**
+     * @brief Sets a scheduling priority and a deadline of all the following asynchronous inference calls for this
+     * request.
+     *
+     * Plugins which support priorities start pipeline stages of requests with greater priority first and, among
+     * requests of the same priority, the ones with earlier deadline. Requests have priority 0 and no deadline by
+     * default, requests of negative priority wait for requests of default priority. A missed deadline doesn't cancel
+     * the inference.
+     *
+     * @param priority A priority of the request
+     * @param deadline_ms A deadline in milliseconds since the start of inference, 0 means no deadline
+     * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if
+     * occurred)
+     * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
+     */
+    virtual StatusCode SetPriority(int priority, int64_t deadline_ms, ResponseDesc* resp) noexcept = 0;
+
     /**
     * @brief Gets state control interface for given infer request.
     *
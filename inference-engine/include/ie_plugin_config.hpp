@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -129,6 +130,24 @@ DECLARE_METRIC_KEY(RANGE_FOR_STREAMS, std::tuple<unsigned int, unsigned int>);
  */
 DECLARE_METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS, std::tuple<unsigned int, unsigned int, unsigned int>);
 
+/**
+ * @brief Metric to get a bool value which is true when a device supports compiled network export and import.
+ *
+ * Such devices can take part in the Core level compiled network cache enabled by CONFIG_KEY(CACHE_DIR).
+ * String value is "IMPORT_EXPORT_SUPPORT"
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
+/**
+ * @brief Metric to get a string which identifies hosts able to import networks exported by a device on this host.
+ *
+ * For the CPU device it lists the ISA extensions and the kernel library version which define the selected kernels.
+ * The Core level compiled network cache keeps a separate blob for every value, so one cache directory can be shared
+ * by a heterogeneous set of machines.
+ * String value is "IMPORT_EXPORT_FINGERPRINT"
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_FINGERPRINT, std::string);
+
 /**
  * @brief Metric to get an unsigned int value of number of waiting infer request.
  *
@@ -158,6 +177,76 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get a number of inferences on the CPU which found a graph compiled for their input shapes in the cache.
+ * Reported when PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES is enabled.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_HITS, unsigned int);
+
+/**
+ * @brief Metric to get a number of input shape sets compiled by the CPU plugin because they were not found in the cache.
+ * Reported when PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES is enabled.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_MISSES, unsigned int);
+
+/**
+ * @brief Metric to get a number of tasks queued to the inference streams executor and not started yet.
+ * The metric is collected while inference is running.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(QUEUED_TASKS, unsigned int);
+
+/**
+ * @brief Metric to get a number of inference streams which are executing requests at the moment.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(BUSY_STREAMS, unsigned int);
+
+/**
+ * @brief Metric to get a number of infer requests completed since the network was loaded.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(COMPLETED_INFER_REQUESTS, unsigned int);
+
+/**
+ * @brief Metric to get a rate of completed infer requests since the previous query of the metric.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(INFER_REQUESTS_PER_SECOND, float);
+
+/**
+ * @brief Metric to get a cumulative histogram of infer request latencies: a map from a bucket upper bound in
+ * milliseconds (powers of two microseconds) to a number of requests which latency does not exceed the bound.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(INFER_REQUEST_LATENCY_HISTOGRAM, std::map<float, unsigned int>);
+
+/**
+ * @brief Metric to get time spent by LoadNetwork in its phases: a map from a phase name ("Cloning", "Transformations",
+ * "LegacyConversion", "LPT", "GraphInit", "WeightsRepacking", "KernelCompilation", "MemoryAllocation", "CacheExport",
+ * "Other", "Total") to time in milliseconds. Only phases executed by the device are reported.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(LOAD_TIME_BREAKDOWN, std::map<std::string, float>);
+
+/**
+ * @brief Metric to get device memory usage of a GPU executable network in bytes: a map with "<type>_current" and
+ * "<type>_peak" entries for each allocation type ("cl_mem", "usm_host", "usm_shared", "usm_device"), "total_current"
+ * and "total_peak". Networks loaded to the same context share memory, so the values cover all of them.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(GPU_MEMORY_STATISTICS, std::map<std::string, uint64_t>);
+
+/**
+ * @brief Metric to get subgraphs of a HETERO executable network in execution order.
+ * Each string has the form "<device>: <layer>,<layer>,..."
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(HETERO_SUBGRAPHS, std::vector<std::string>);
+
+/**
+ * @brief Metric to get a number of inference requests dispatched to each device of a MULTI executable network
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_DISPATCHED_REQUESTS, std::map<std::string, unsigned int>);
+
+/**
+ * @brief Metric to get a running average of inference latency in milliseconds for each device of a MULTI executable network.
+ * A device without completed requests has zero latency
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_AVERAGE_LATENCIES, std::map<std::string, float>);
+
 }  // namespace Metrics
 
 /**
@@ -198,12 +287,101 @@ DECLARE_CONFIG_KEY(CPU_THREADS_NUM);
  * PluginConfigParams::YES (pinning threads to cores, best for static benchmarks),
  * PluginConfigParams::NUMA (pinning threads to NUMA nodes, best for real-life, contented cases)
  * this is TBB-specific knob, and the only pinning option (beyond 'NO', below) on the Windows*
+ * PluginConfigParams::HYBRID_AWARE (on hybrid CPUs a latency stream is placed on big cores, throughput streams are
+ * distributed between big and little cores with more threads per stream on little cores; same as 'YES' on other CPUs)
  * PluginConfigParams::NO (no pinning for CPU inference threads)
  * All settings are ignored, if the OpenVINO compiled with OpenMP threading and any affinity-related OpenMP's
  * environment variable is set (as affinity is configured explicitly)
  */
 DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 DECLARE_CONFIG_VALUE(NUMA);
+DECLARE_CONFIG_VALUE(HYBRID_AWARE);
+
+/**
+ * @brief The name for setting a directory to share repacked weights of CPU networks between processes.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), the value is a path to an existing directory on a memory
+ * backed file system, e.g. "/dev/shm" (POSIX shared memory) or a hugetlbfs mount point.
+ * Processes which load the same network with the same directory keep one physical copy of weights per NUMA node.
+ * Empty string (default) disables the sharing. Not supported on Windows*.
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WEIGHTS_DIR);
+
+/**
+ * @brief The name for setting huge pages for large memory buffers of the CPU plugin.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES (intermediate tensors, repacked weights and infer request blobs of at least 2 MB are
+ * placed to reserved huge pages if available, otherwise to transparent huge pages)
+ * PluginConfigParams::NO (default, regular memory allocation)
+ * Huge pages reduce TLB misses of large networks, regular pages are used on platforms without their support.
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+
+/**
+ * @brief The name for setting zero copy access to states of stateful networks on the CPU plugin.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES (a blob passed to IVariableState::SetState() becomes the state storage and
+ * IVariableState::GetState() returns a blob sharing memory with the state, so the blobs are valid and must not be
+ * modified until the next inference or Reset())
+ * PluginConfigParams::NO (default, the state is copied)
+ * Blobs which layout or precision differs from the state are copied regardless of the option.
+ */
+DECLARE_CONFIG_KEY(CPU_ZERO_COPY_STATES);
+
+/**
+ * @brief The name for setting sparse weights kernels of the CPU plugin.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), the value is a floating point number in the [0, 1] range.
+ * FP32 FullyConnected layers whose fraction of zero weight blocks (16 output channels by one input channel)
+ * is not less than the value keep only non-zero blocks of weights and are executed by a block sparse kernel.
+ * 0 (default) disables the sparse kernels.
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_WEIGHTS_THRESHOLD);
+
+/**
+ * @brief The name for setting a precision of weights of the CPU plugin FullyConnected layers.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * "FP16", "BF16" (weights are rounded to the precision) or "I8" (weights are quantized symmetrically with a scale per
+ * output channel), PluginConfigParams::NO (default) keeps the weights in FP32.
+ * It applies to FP32 FullyConnected layers with constant weights: activations are not quantized and weights are
+ * decompressed during the execution, which reduces memory traffic of small batches at the cost of accuracy.
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_COMPRESSION);
+
+/**
+ * @brief The name for setting depth-first execution of the CPU plugin.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * Consecutive convolution, pooling, eltwise and reorder layers of a batched network are executed a few images
+ * at a time, so intermediate tensors of the images stay in the L2 cache between the layers.
+ */
+DECLARE_CONFIG_KEY(CPU_DEPTH_FIRST_EXECUTION);
+
+/**
+ * @brief The name for setting the graph-wide layout planning of the CPU plugin.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES (default) or PluginConfigParams::NO.
+ * Layouts of the layers are chosen for the whole graph to minimize the number and the size of the reorders
+ * between them, instead of each layer following the layouts of its inputs.
+ */
+DECLARE_CONFIG_KEY(CPU_LAYOUT_PLANNING);
+
+/**
+ * @brief The name for setting concurrent execution of independent branches of the CPU plugin graphs.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * Layers which don't depend on each other, e.g. branches of Inception blocks, are executed concurrently by threads
+ * of a stream, which reduces the latency of wide networks with small layers. Intermediate tensors of concurrent
+ * layers can't reuse each other's memory, so the network may need more memory. The option has effect only if the
+ * plugin is built with TBB threading.
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
 
 /**
  * @brief Optimize CPU execution to maximize throughput.
@@ -212,13 +390,151 @@ DECLARE_CONFIG_VALUE(NUMA);
  * - KEY_CPU_THROUGHPUT_NUMA creates as many streams as needed to accommodate NUMA and avoid associated penalties
  * - KEY_CPU_THROUGHPUT_AUTO creates bare minimum of streams to improve the performance,
  *   this is the most portable option if you have no insights into how many cores you target machine will have
- *   (and what is the optimal number of streams)
+ *   (and what is the optimal number of streams). On hybrid CPUs streams of little cores are counted
+ *   with twice more threads per stream
  * - finally, specifying the positive integer value creates the requested number of streams
  */
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief The name for setting work stealing scheduling of CPU streams.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES (each stream has own task queue, idle streams take pending tasks of busy ones)
+ * PluginConfigParams::NO (default, all streams take tasks from one shared queue)
+ */
+DECLARE_CONFIG_KEY(CPU_WORK_STEALING);
+
+/**
+ * @brief The name for setting affinity of infer requests to CPU streams.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES (every infer request gets a home stream which executes it unless the stream is busy,
+ * so the request works with the same stream graph and the same cores from call to call)
+ * PluginConfigParams::NO (default, infer requests are executed by any stream)
+ */
+DECLARE_CONFIG_KEY(CPU_REQUEST_STREAM_AFFINITY);
+
+/**
+ * @brief The name for setting sharing of CPU streams between executable networks.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES (infer requests of all networks loaded with the option and the same streams settings are
+ * executed by one pool of streams, so hosting many networks doesn't oversubscribe cores)
+ * PluginConfigParams::NO (default, a network reuses streams of another one only if they are idle)
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS);
+
+/**
+ * @brief The name for setting a priority class of infer requests of a network executed by shared CPU streams.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), the option has effect with KEY_CPU_SHARED_STREAMS and should
+ * be used with values:
+ * - CPU_PRIORITY_LATENCY: requests are taken by streams before requests of batch networks and preempt them
+ *   between layers, the preempted inference continues when the latency requests are done
+ * - CPU_PRIORITY_BATCH (default): requests are executed in FIFO order
+ */
+DECLARE_CONFIG_VALUE(CPU_PRIORITY_LATENCY);
+DECLARE_CONFIG_VALUE(CPU_PRIORITY_BATCH);
+DECLARE_CONFIG_KEY(CPU_STREAMS_PRIORITY);
+
+/**
+ * @brief The name for setting a number of CPU streams dedicated to latency-critical infer requests.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), the value is a number of streams out of KEY_CPU_THROUGHPUT_STREAMS
+ * which execute only requests started with a positive InferRequest::SetPriority() level and requests of networks with
+ * CPU_PRIORITY_LATENCY, other streams don't take such requests. Should be less than the number of streams,
+ * 0 (default) means all the streams execute all the requests
+ */
+DECLARE_CONFIG_KEY(CPU_LATENCY_STREAMS);
+
+/**
+ * @brief The name for setting a number of threads of each stream set by KEY_CPU_LATENCY_STREAMS.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), the rest of threads is distributed between other streams.
+ * 0 (default) means latency streams have the same number of threads as other streams
+ */
+DECLARE_CONFIG_KEY(CPU_THREADS_PER_LATENCY_STREAM);
+
+/**
+ * @brief The name for setting autoscaling of the number of CPU streams which take infer requests.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), the value is the least number of active streams.
+ * Graphs are created for all KEY_CPU_THROUGHPUT_STREAMS streams, but while the number of running and queued requests
+ * stays below the number of active streams for a second, the streams over it are parked and keep their graphs.
+ * Parked streams are activated at once when queued requests outnumber idle active streams.
+ * 0 (default) means all the streams are always active, the option has no effect with KEY_CPU_LATENCY_STREAMS
+ */
+DECLARE_CONFIG_KEY(CPU_MIN_ACTIVE_STREAMS);
+
+/**
+ * @brief The name for setting warm-up of CPU networks at LoadNetwork().
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES (each stream infers its graph once with zero inputs while the network is loaded, so worker
+ * threads are started, memory of the graph is paged in and lazily generated kernels are ready before the first
+ * infer request, networks with memory states are not inferred to keep the states initial)
+ * PluginConfigParams::NO (default)
+ */
+DECLARE_CONFIG_KEY(CPU_WARM_UP);
+
+/**
+ * @brief The name for setting sampling of hardware events around execution of each primitive of CPU networks.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ * Average numbers of CPU cycles, retired instructions and last level cache misses of each primitive are reported in
+ * runtime information of the execution graph (ExecutableNetwork::GetExecGraphInfo()). Events are counted with
+ * perf_event_open for all threads of the process, so the option is supported on Linux only and values include work
+ * of concurrently executed infer requests. Sampling adds a few system calls per thread for each primitive.
+ */
+DECLARE_CONFIG_KEY(CPU_HW_PERF_COUNT);
+
+/**
+ * @brief The name for setting sampling of the CPU performance counters.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), the value is a positive integer N, 1 is the default.
+ * Counters enabled by KEY_PERF_COUNT or KEY_CPU_HW_PERF_COUNT are measured only during every N-th inference of each
+ * stream, so they can be kept enabled in production with a negligible overhead.
+ */
+DECLARE_CONFIG_KEY(CPU_PERF_COUNT_PERIOD);
+
+/**
+ * @brief The name for setting execution of CPU networks with input shapes that differ from the loaded ones.
+ *
+ * It is passed to Core::SetConfig() or LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES (input blobs of any dimensions with the same rank can be set to infer requests, the network
+ * is reshaped and compiled once per new set of input shapes, compiled graphs are cached in the executable network)
+ * PluginConfigParams::NO (default, input blobs must have dimensions of the loaded network)
+ * Output blobs are reallocated when their shape changes, so they should be taken with GetBlob() after each inference.
+ * Graphs of all shapes executed by one inference stream share memory for intermediate tensors.
+ * Only networks represented as ngraph::Function are supported, the option cannot be used with KEY_DYN_BATCH_ENABLED.
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES);
+
+/**
+ * @brief The name for setting a number of input shape sets whose compiled graphs are kept when
+ * KEY_CPU_DYNAMIC_SHAPES is enabled.
+ *
+ * The value is a non-negative integer, the default is 16. Graphs of the least recently used shapes are released first,
+ * 0 means that a graph is compiled on each change of input shapes.
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES_CACHE_CAPACITY);
+
+/**
+ * @brief The name for setting sets of input shapes whose graphs are compiled by LoadNetwork when
+ * KEY_CPU_DYNAMIC_SHAPES is enabled.
+ *
+ * The value is a list of profiles separated by ';', a profile lists shapes of inputs as `name[d0,d1,...]` separated by
+ * spaces, for example "data[1,3,224,224];data[1,3,320,320]". Graphs of the profiles are kept for the lifetime of the
+ * executable network in addition to KEY_CPU_DYNAMIC_SHAPES_CACHE_CAPACITY ones and share weights and intermediate
+ * memory with the loaded graph, so the first inference with profile shapes does not compile anything.
+ * Inputs not listed in a profile keep the loaded shapes. The default is an empty string.
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES_PROFILES);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -372,8 +688,37 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
 * The key might enable caching for all plugin or some specific ones, e.g.:
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}) - enables cache for all plugins that might want to use it
 * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}, {"GPU"}) - enables cache only for GPU plugin
+*
+* For devices which report METRIC_KEY(IMPORT_EXPORT_SUPPORT) the Core caches whole compiled networks:
+* Core::LoadNetwork computes a hash of the network, device name and config and imports a previously exported
+* blob from the cache directory on a hit, or compiles the network and exports it into the directory on a miss.
+* If a device also reports METRIC_KEY(IMPORT_EXPORT_FINGERPRINT), blobs exported on hosts with different
+* fingerprints are stored side by side for the same network.
+* The key can also be passed to Core::LoadNetwork directly.
 */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+* @brief This key defines a JSON file a timeline of inference is written to in Chrome trace format.
+*
+* The key is handled by the Core and is accepted by Core::SetConfig() without a device name only.
+* A non-empty value clears recorded events and starts recording, an empty value stops recording and writes the file.
+* The file is also written when the Core which started recording is destroyed.
+* Stages of infer request pipelines of all devices (including HETERO and MULTI) and CPU primitives are recorded
+* to per-thread ring buffers which keep the latest 65536 events of each thread.
+* The file can be opened with chrome://tracing or https://ui.perfetto.dev
+*/
+DECLARE_CONFIG_KEY(TRACE_FILE);
+
+/**
+* @brief The key enables deduplication of constants between networks read by one Core, CONFIG_VALUE(NO) by default.
+*
+* The key is handled by the Core and is accepted by Core::SetConfig() without a device name only.
+* Constants of networks read after the key is set to CONFIG_VALUE(YES) reference one buffer if their types, shapes
+* and contents are equal, so many variants of one model which differ in a few layers keep the common weights once.
+* The key is also passed to the plugins which support it, so they share the repacked copies of such weights.
+*/
+DECLARE_CONFIG_KEY(SHARE_CONSTANTS);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
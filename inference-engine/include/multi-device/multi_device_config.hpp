@@ -34,5 +34,56 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
+/**
+ * @brief Policy used to select a device for the next inference request:
+ * - MULTI_CONFIG_VALUE(DEVICE_PRIORITY) (default) - the first device with an idle request in priorities order
+ * - MULTI_CONFIG_VALUE(ROUND_ROBIN) - devices with idle requests in turn
+ * - MULTI_CONFIG_VALUE(SHORTEST_EXPECTED_COMPLETION) - the device which is expected to complete the request first
+ *   according to a running average of its latency and a number of requests in flight
+ * - MULTI_CONFIG_VALUE(WEIGHTED_THROUGHPUT) - devices get shares of requests proportional to their measured throughput
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(DEVICE_PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(ROUND_ROBIN);
+DECLARE_MULTI_CONFIG_VALUE(SHORTEST_EXPECTED_COMPLETION);
+DECLARE_MULTI_CONFIG_VALUE(WEIGHTED_THROUGHPUT);
+
+/**
+ * @brief Comma-separated devices of MULTI_CONFIG_KEY(DEVICE_PRIORITIES) which networks are compiled in background.
+ * The rest of the devices are loaded by LoadNetwork and serve the requests, e.g. "GPU" with the "GPU,CPU" priorities
+ * gives the CPU time to first inference, the GPU takes the requests once its kernels are compiled
+ */
+DECLARE_MULTI_CONFIG_KEY(BACKGROUND_LOAD_DEVICES);
+
+/**
+ * @brief CONFIG_VALUE(YES) releases the devices loaded by LoadNetwork once the background loads are over,
+ * so the devices which are loaded in background serve the requests alone. CONFIG_VALUE(NO) is the default
+ */
+DECLARE_MULTI_CONFIG_KEY(RELEASE_STAND_IN_DEVICES);
+
+/**
+ * @brief Automatic device selection, the key is set by the Core for the "AUTO" and "AUTO:<devices>" device names.
+ * The value is a comma-separated list of candidate devices, an empty value means all the available devices.
+ * The network is served by the CPU while the network for the selected accelerator is compiled,
+ * the requests are moved to the accelerator once it is ready
+ */
+DECLARE_MULTI_CONFIG_KEY(AUTO_DEVICE_CANDIDATES);
+
+/**
+ * @brief A performance hint for the automatic device selection:
+ * - MULTI_CONFIG_VALUE(LATENCY) (default) - the best device serves the requests with a single stream
+ * - MULTI_CONFIG_VALUE(THROUGHPUT) - the selected accelerator and the CPU serve the requests together
+ *   with the automatic number of streams, the number of requests follows the streams
+ */
+DECLARE_MULTI_CONFIG_KEY(PERFORMANCE_HINT);
+DECLARE_MULTI_CONFIG_VALUE(LATENCY);
+DECLARE_MULTI_CONFIG_VALUE(THROUGHPUT);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
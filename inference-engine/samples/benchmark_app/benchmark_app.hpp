@@ -37,6 +37,21 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for target arrival rate
+static const char qps_message[] = "Optional. Start infer requests at the given rate per second independently of their completion "
+                                  "(open-loop load) instead of restarting them as soon as they complete. Latency then includes "
+                                  "time spent waiting for an idle infer request. Async API only.";
+
+/// @brief message for arrival distribution
+static const char arrival_message[] = "Optional. Distribution of request arrivals when -qps is set: \"fixed\" (default) "
+                                      "for constant intervals or \"poisson\" for exponentially distributed intervals.";
+
+/// @brief message for co-located models
+static const char co_m_message[] = "Optional. Models to run concurrently with the main one to measure co-location, in format "
+                                   "\"<path1>[@<device1>[:<nireq1>]];<path2>...\". Device defaults to -d value and number of "
+                                   "infer requests to optimal one for the device. Co-located models run asynchronously "
+                                   "with random inputs while performance of the main model is measured.";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -82,6 +97,13 @@ static const char report_folder_message[] = "Optional. Path to a folder where st
 // @brief message for exec_graph_path option
 static const char exec_graph_path_message[] = "Optional. Path to a file where to store executable graph information serialized.";
 
+// @brief message for roofline_peak option
+static const char roofline_peak_message[] = "Optional. Peak performance of the device as \"<GFLOP/s>,<GB/s>\". "
+                                            "\"average_counters\" and \"detailed_counters\" reports are extended with "
+                                            "a roofline report which lists achieved GFLOP/s, GB/s and arithmetic intensity "
+                                            "of every executed layer, with the peak values given it also reports "
+                                            "a percent of the attainable performance.";
+
 // @brief message for progress bar option
 static const char progress_message[] = "Optional. Show progress bar (can affect performance measurement). Default values is \"false\".";
 
@@ -142,6 +164,15 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Target rate of infer request arrivals per second, 0 means closed-loop execution
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Distribution of infer request arrivals
+DEFINE_string(arrival, "fixed", arrival_message);
+
+/// @brief Models to run concurrently with the main one
+DEFINE_string(co_m, "", co_m_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 
@@ -170,6 +201,9 @@ DEFINE_string(report_folder, "", report_folder_message);
 /// @brief Path to a file where to store executable graph information serialized
 DEFINE_string(exec_graph_path, "", exec_graph_path_message);
 
+/// @brief Peak GFLOP/s and GB/s of the device for the roofline report
+DEFINE_string(roofline_peak, "", roofline_peak_message);
+
 /// @brief Define flag for showing progress bar <br>
 DEFINE_bool(progress, false, progress_message);
 
@@ -208,6 +242,9 @@ static void showUsage() {
     std::cout << "    -api \"<sync/async>\"       " << api_message << std::endl;
     std::cout << "    -niter \"<integer>\"        " << iterations_count_message << std::endl;
     std::cout << "    -nireq \"<integer>\"        " << infer_requests_count_message << std::endl;
+    std::cout << "    -qps \"<float>\"            " << qps_message << std::endl;
+    std::cout << "    -arrival \"<fixed/poisson>\"" << arrival_message << std::endl;
+    std::cout << "    -co_m \"<models>\"          " << co_m_message << std::endl;
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
@@ -222,6 +259,7 @@ static void showUsage() {
     std::cout << "    -report_type \"<type>\"     " << report_type_message << std::endl;
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
+    std::cout << "    -roofline_peak \"<GFLOP/s>,<GB/s>\" " << roofline_peak_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
 #ifdef USE_OPENCV
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
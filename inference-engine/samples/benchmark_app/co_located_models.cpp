@@ -0,0 +1,111 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "co_located_models.hpp"
+#include "inputs_filling.hpp"
+
+using namespace InferenceEngine;
+
+std::vector<CoLocatedModel> parseCoLocatedModels(const std::string& models_string, const std::string& defaultDevice) {
+    std::vector<CoLocatedModel> models;
+    std::stringstream ss(models_string);
+    std::string item;
+    while (std::getline(ss, item, ';')) {
+        if (item.empty())
+            continue;
+        CoLocatedModel model;
+        model.device = defaultDevice;
+        auto device_pos = item.rfind('@');
+        model.path = item.substr(0, device_pos);
+        if (device_pos != std::string::npos) {
+            model.device = item.substr(device_pos + 1);
+            // device names like HETERO:FPGA,CPU contain ':' too, so only trailing number is nireq
+            auto nireq_pos = model.device.rfind(':');
+            if (nireq_pos != std::string::npos && nireq_pos + 1 < model.device.size() &&
+                std::all_of(model.device.begin() + nireq_pos + 1, model.device.end(), ::isdigit)) {
+                model.nireq = std::stoi(model.device.substr(nireq_pos + 1));
+                model.device = model.device.substr(0, nireq_pos);
+            }
+        }
+        if (model.path.empty() || model.device.empty()) {
+            throw std::logic_error("Incorrect co-located model specification: \"" + item + "\"");
+        }
+        models.push_back(model);
+    }
+    return models;
+}
+
+CoLocatedRunner::CoLocatedRunner(Core& ie, const CoLocatedModel& model) : _model(model) {
+    CNNNetwork cnnNetwork = ie.ReadNetwork(_model.path);
+    _batchSize = cnnNetwork.getBatchSize();
+    for (auto& item : cnnNetwork.getInputsInfo()) {
+        if (isImage(item.second)) {
+            item.second->setPrecision(Precision::U8);
+        }
+    }
+    _exeNetwork = ie.LoadNetwork(cnnNetwork, _model.device);
+
+    uint32_t nireq = _model.nireq;
+    if (nireq == 0) {
+        nireq = _exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    }
+    _queue.reset(new InferRequestsQueue(_exeNetwork, nireq));
+    const ConstInputsDataMap info(_exeNetwork.GetInputsInfo());
+    fillBlobs({}, _batchSize, info, _queue->requests);
+
+    // warming up - out of scope
+    _queue->getIdleRequest()->startAsync();
+    _queue->waitAll();
+    _queue->resetTimes();
+}
+
+CoLocatedRunner::~CoLocatedRunner() {
+    try {
+        stop();
+    } catch (const std::exception& ex) {
+        slog::err << _model.path << ": " << ex.what() << slog::endl;
+    }
+}
+
+void CoLocatedRunner::start() {
+    _thread = std::thread([this] {
+        try {
+            while (!_stop) {
+                auto inferRequest = _queue->getIdleRequest();
+                // rethrows errors of the previous execution of the request
+                inferRequest->wait();
+                inferRequest->startAsync();
+                _iterations++;
+            }
+        } catch (...) {
+            _error = std::current_exception();
+        }
+        _queue->waitAll();
+    });
+}
+
+void CoLocatedRunner::stop() {
+    _stop = true;
+    if (_thread.joinable())
+        _thread.join();
+    if (_error) {
+        auto error = _error;
+        _error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+double CoLocatedRunner::throughput() const {
+    return _batchSize * 1000.0 * _iterations / _queue->getDurationInMilliseconds();
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "infer_request_wrap.hpp"
+
+/// @brief Model which is benchmarked concurrently with the main one to measure co-location
+struct CoLocatedModel {
+    std::string path;
+    std::string device;
+    // 0 means optimal number of infer requests for the device
+    uint32_t nireq = 0;
+};
+
+/// @brief Parses "<path>[@<device>[:<nireq>]];..." list, device defaults to defaultDevice
+std::vector<CoLocatedModel> parseCoLocatedModels(const std::string& models_string, const std::string& defaultDevice);
+
+/// @brief Runs a co-located model in closed loop with random inputs on its own thread
+class CoLocatedRunner final {
+public:
+    CoLocatedRunner(InferenceEngine::Core& ie, const CoLocatedModel& model);
+    ~CoLocatedRunner();
+
+    void start();
+    /// @brief Stops the loop, waits for running requests and rethrows error of the loop if any
+    void stop();
+
+    const CoLocatedModel& model() const {
+        return _model;
+    }
+
+    size_t nireq() const {
+        return _queue->requests.size();
+    }
+
+    size_t iterations() const {
+        return _iterations;
+    }
+
+    const LatencyHistogram& latency() const {
+        return _queue->getLatency();
+    }
+
+    double throughput() const;
+
+private:
+    CoLocatedModel _model;
+    InferenceEngine::ExecutableNetwork _exeNetwork;
+    std::unique_ptr<InferRequestsQueue> _queue;
+    size_t _batchSize = 1;
+    std::atomic<bool> _stop{false};
+    std::atomic<size_t> _iterations{0};
+    std::thread _thread;
+    std::exception_ptr _error;
+};
@@ -16,6 +16,7 @@
 #include <functional>
 
 #include <inference_engine.hpp>
+#include "latency_histogram.hpp"
 #include "statistics_report.hpp"
 
 typedef std::chrono::high_resolution_clock Time;
@@ -42,7 +43,12 @@ public:
     }
 
     void startAsync() {
-        _startTime = Time::now();
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts request which arrived at arrivalTime, so latency includes time it waited before start
+    void startAsync(Time::time_point arrivalTime) {
+        _startTime = arrivalTime;
         _request.StartAsync();
     }
 
@@ -101,17 +107,17 @@ public:
     void resetTimes() {
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
-        _latencies.clear();
+        _latency.reset();
     }
 
-    double getDurationInMilliseconds() {
+    double getDurationInMilliseconds() const {
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
     void putIdleRequest(size_t id,
                         const double latency) {
         std::unique_lock<std::mutex> lock(_mutex);
-        _latencies.push_back(latency);
+        _latency.add(latency);
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -131,8 +137,8 @@ public:
         _cv.wait(lock, [this]{ return _idleIds.size() == requests.size(); });
     }
 
-    std::vector<double> getLatencies() {
-        return _latencies;
+    const LatencyHistogram& getLatency() const {
+        return _latency;
     }
 
     std::vector<InferReqWrap::Ptr> requests;
@@ -143,5 +149,5 @@ private:
     std::condition_variable _cv;
     Time::time_point _startTime;
     Time::time_point _endTime;
-    std::vector<double> _latencies;
+    LatencyHistogram _latency;
 };
@@ -0,0 +1,110 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/// @brief Latency histogram with log-linear buckets of nanoseconds. Memory does not grow with number of samples,
+///        and reported percentiles are at most 1/128 above exact values.
+class LatencyHistogram final {
+public:
+    typedef std::vector<std::pair<double, uint64_t>> Buckets;
+
+    void add(double latencyMs) {
+        const auto value = static_cast<uint64_t>(std::max(latencyMs, 0.0) * 1000000.0);
+        const size_t idx = index(value);
+        if (idx >= _counts.size())
+            _counts.resize(idx + 1, 0);
+        _counts[idx]++;
+        _count++;
+        _sum += latencyMs;
+        _min = std::min(_min, latencyMs);
+        _max = std::max(_max, latencyMs);
+    }
+
+    void reset() {
+        *this = LatencyHistogram();
+    }
+
+    uint64_t count() const {
+        return _count;
+    }
+
+    double min() const {
+        return _count ? _min : 0.0;
+    }
+
+    double max() const {
+        return _count ? _max : 0.0;
+    }
+
+    double average() const {
+        return _count ? _sum / _count : 0.0;
+    }
+
+    /// @brief Returns latency in milliseconds which percent of samples does not exceed
+    double percentile(double percent) const {
+        if (_count == 0)
+            return 0.0;
+        const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percent / 100.0 * _count)));
+        uint64_t seen = 0;
+        for (size_t idx = 0; idx < _counts.size(); idx++) {
+            seen += _counts[idx];
+            if (seen >= rank)
+                return std::min(toMs(highestValue(idx)), _max);
+        }
+        return _max;
+    }
+
+    /// @brief Returns non-empty buckets as pairs of upper bound in milliseconds and number of samples
+    Buckets buckets() const {
+        Buckets result;
+        for (size_t idx = 0; idx < _counts.size(); idx++) {
+            if (_counts[idx])
+                result.emplace_back(toMs(highestValue(idx)), _counts[idx]);
+        }
+        return result;
+    }
+
+private:
+    // values below 2^subBucketBits are exact, every next power of two is split to 2^(subBucketBits - 1) buckets
+    static constexpr unsigned subBucketBits = 8;
+    static constexpr uint64_t subBucketCount = 1ULL << subBucketBits;
+    static constexpr uint64_t subBucketHalfCount = subBucketCount / 2;
+
+    static size_t index(uint64_t value) {
+        if (value < subBucketCount)
+            return static_cast<size_t>(value);
+        unsigned highestBit = 0;
+        for (auto v = value; v >>= 1;)
+            highestBit++;
+        const unsigned shift = highestBit - subBucketBits + 1;
+        return static_cast<size_t>(subBucketCount + (shift - 1) * subBucketHalfCount +
+                                   ((value >> shift) - subBucketHalfCount));
+    }
+
+    static uint64_t highestValue(size_t idx) {
+        if (idx < subBucketCount)
+            return idx;
+        const uint64_t shift = (idx - subBucketCount) / subBucketHalfCount + 1;
+        const uint64_t mantissa = (idx - subBucketCount) % subBucketHalfCount + subBucketHalfCount;
+        return (mantissa << shift) + (1ULL << shift) - 1;
+    }
+
+    static double toMs(uint64_t value) {
+        return static_cast<double>(value) * 0.000001;
+    }
+
+    std::vector<uint64_t> _counts;
+    uint64_t _count = 0;
+    double _sum = 0.0;
+    double _min = std::numeric_limits<double>::max();
+    double _max = 0.0;
+};
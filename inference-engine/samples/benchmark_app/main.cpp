@@ -6,7 +6,9 @@
 #include <chrono>
 #include <memory>
 #include <map>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -19,6 +21,7 @@
 #include <samples/args_helper.hpp>
 
 #include "benchmark_app.hpp"
+#include "co_located_models.hpp"
 #include "infer_request_wrap.hpp"
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
@@ -56,6 +59,18 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
 
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Incorrect -qps value. Please set it to positive number of requests per second.");
+    }
+
+    if (FLAGS_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("-qps option is supported only for async API.");
+    }
+
+    if (FLAGS_arrival != "fixed" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival distribution. Please set -arrival option to `fixed` or `poisson` value.");
+    }
+
     if (!FLAGS_report_type.empty() &&
         FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
@@ -67,6 +82,10 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (!FLAGS_roofline_peak.empty()) {
+        parseRooflinePeak(FLAGS_roofline_peak);
+    }
+
     return true;
 }
 
@@ -94,15 +113,6 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T> &vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ?
-           sortedVec[sortedVec.size() / 2ULL] :
-           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
-}
-
 /**
 * @brief The entry point of the benchmark application
 */
@@ -486,6 +496,12 @@ int main(int argc, char *argv[]) {
         const InferenceEngine::ConstInputsDataMap info(exeNetwork.GetInputsInfo());
         fillBlobs(inputFiles, batchSize, info, inferRequestsQueue.requests);
 
+        std::vector<std::unique_ptr<CoLocatedRunner>> coLocatedRunners;
+        for (auto& model : parseCoLocatedModels(FLAGS_co_m, device_name)) {
+            slog::info << "Loading co-located model " << model.path << " to " << model.device << slog::endl;
+            coLocatedRunners.emplace_back(new CoLocatedRunner(ie, model));
+        }
+
         // ----------------- 10. Measuring performance ------------------------------------------------------------------
         size_t progressCnt = 0;
         size_t progressBarTotalCount = progressBarDefaultTotalCount;
@@ -508,6 +524,9 @@ int main(int argc, char *argv[]) {
             if (!device_ss.str().empty()) {
                 ss << " using " << device_ss.str();
             }
+            if (FLAGS_qps > 0) {
+                ss << ", " << FLAGS_arrival << " arrivals at " << FLAGS_qps << " requests per second";
+            }
         }
         ss << ", limits: ";
         if (duration_seconds > 0) {
@@ -535,7 +554,8 @@ int main(int argc, char *argv[]) {
             inferRequest->startAsync();
         }
         inferRequestsQueue.waitAll();
-        auto duration_ms = double_to_string(inferRequestsQueue.getLatencies()[0]);
+        // there is a single sample after the first inference
+        auto duration_ms = double_to_string(inferRequestsQueue.getLatency().max());
         slog::info << "First inference took " << duration_ms << " ms" << slog::endl;
         if (statistics)
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
@@ -544,9 +564,22 @@ int main(int argc, char *argv[]) {
                                         });
         inferRequestsQueue.resetTimes();
 
+        for (auto& runner : coLocatedRunners) {
+            runner->start();
+        }
+
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // with -qps requests arrive by schedule which does not depend on completions
+        std::mt19937 arrivalGenerator;
+        std::exponential_distribution<double> poissonInterval(FLAGS_qps > 0 ? FLAGS_qps : 1.0);
+        auto nextArrival = startTime;
+        auto nextArrivalInterval = [&] () {
+            double seconds = (FLAGS_arrival == "poisson") ? poissonInterval(arrivalGenerator) : 1.0 / FLAGS_qps;
+            return std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(seconds));
+        };
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
@@ -554,6 +587,11 @@ int main(int argc, char *argv[]) {
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
                (FLAGS_api == "async" && iteration % nireq != 0)) {
+            auto arrivalTime = nextArrival;
+            if (FLAGS_qps > 0) {
+                std::this_thread::sleep_until(arrivalTime);
+                nextArrival += nextArrivalInterval();
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -568,7 +606,12 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (FLAGS_qps > 0) {
+                    // latency includes waiting for the idle request since arrival
+                    inferRequest->startAsync(arrivalTime);
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -589,8 +632,12 @@ int main(int argc, char *argv[]) {
 
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
+        for (auto& runner : coLocatedRunners) {
+            runner->stop();
+        }
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        const LatencyHistogram& latencyHistogram = inferRequestsQueue.getLatency();
+        double latency = latencyHistogram.percentile(50);
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
@@ -605,12 +652,30 @@ int main(int argc, char *argv[]) {
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
+                                                  {"latency p90 (ms)", double_to_string(latencyHistogram.percentile(90))},
+                                                  {"latency p99 (ms)", double_to_string(latencyHistogram.percentile(99))},
+                                                  {"latency p99.9 (ms)", double_to_string(latencyHistogram.percentile(99.9))},
+                                                  {"latency max (ms)", double_to_string(latencyHistogram.max())},
                                           });
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
                                               {"throughput", double_to_string(fps)}
                                       });
+            for (size_t i = 0; i < coLocatedRunners.size(); i++) {
+                const auto& runner = *coLocatedRunners[i];
+                const std::string prefix = "co-located model " + std::to_string(i + 1) + " ";
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {prefix + "path", runner.model().path},
+                                                  {prefix + "target device", runner.model().device},
+                                                  {prefix + "number of parallel infer requests", std::to_string(runner.nireq())},
+                                                  {prefix + "number of iterations", std::to_string(runner.iterations())},
+                                                  {prefix + "latency (ms)", double_to_string(runner.latency().percentile(50))},
+                                                  {prefix + "latency p99 (ms)", double_to_string(runner.latency().percentile(99))},
+                                                  {prefix + "throughput", double_to_string(runner.throughput())},
+                                          });
+            }
         }
 
         progressBar.finish();
@@ -647,17 +712,41 @@ int main(int argc, char *argv[]) {
             }
             if (statistics) {
                 statistics->dumpPerformanceCounters(perfCounts);
+                if (FLAGS_report_type != noCntReport) {
+                    try {
+                        auto peak = FLAGS_roofline_peak.empty() ? std::make_pair(0., 0.) : parseRooflinePeak(FLAGS_roofline_peak);
+                        statistics->dumpRoofline(exeNetwork.GetExecGraphInfo(), peak.first, peak.second);
+                    } catch (const std::exception & ex) {
+                        slog::warn << "Roofline report is not available: " << ex.what() << slog::endl;
+                    }
+                }
             }
         }
 
-        if (statistics)
+        if (statistics) {
             statistics->dump();
+            if (device_name.find("MULTI") == std::string::npos)
+                statistics->dumpLatencyHistogram(latencyHistogram);
+        }
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "Latency percentiles (ms): p90 " << double_to_string(latencyHistogram.percentile(90))
+                      << ", p99 " << double_to_string(latencyHistogram.percentile(99))
+                      << ", p99.9 " << double_to_string(latencyHistogram.percentile(99.9))
+                      << ", max " << double_to_string(latencyHistogram.max()) << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        for (auto& runner : coLocatedRunners) {
+            std::cout << "Co-located " << runner->model().path << " on " << runner->model().device
+                      << " with " << runner->nireq() << " inference requests:" << std::endl;
+            std::cout << "    Count:      " << runner->iterations() << " iterations" << std::endl;
+            std::cout << "    Latency:    " << double_to_string(runner->latency().percentile(50)) << " ms, p99 "
+                      << double_to_string(runner->latency().percentile(99)) << " ms" << std::endl;
+            std::cout << "    Throughput: " << double_to_string(runner->throughput()) << " FPS" << std::endl;
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -8,6 +8,9 @@
 #include <map>
 #include <algorithm>
 
+#include <ngraph/function.hpp>
+#include <ngraph/variant.hpp>
+
 #include "statistics_report.hpp"
 
 void StatisticsReport::addParameters(const Category &category, const Parameters& parameters) {
@@ -132,3 +135,97 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Pefromance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpLatencyHistogram(const LatencyHistogram &histogram) {
+    if (histogram.count() == 0) {
+        slog::info << "Latency histogram is empty. No reports are dumped." << slog::endl;
+        return;
+    }
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_latency_report.csv");
+    dumper << "latency upper bound (ms)" << "count" << "cumulative percent";
+    dumper.endLine();
+    uint64_t cumulative = 0;
+    for (const auto &bucket : histogram.buckets()) {
+        cumulative += bucket.second;
+        dumper << bucket.first << bucket.second << 100.0 * cumulative / histogram.count();
+        dumper.endLine();
+    }
+    slog::info << "Latency histogram report is stored to " << dumper.getFilename() << slog::endl;
+}
+
+void StatisticsReport::dumpRoofline(const InferenceEngine::CNNNetwork &execGraph, double peakGFlops, double peakGBps) {
+    auto function = execGraph.getFunction();
+    if (!function) {
+        return;
+    }
+
+    // keys of the executable graph runtime info filled by plugins
+    auto getValue = [] (const std::shared_ptr<ngraph::Node> &op, const std::string &key, double &value) {
+        const auto &rtInfo = op->get_rt_info();
+        auto it = rtInfo.find(key);
+        if (it == rtInfo.end()) return false;
+        auto str = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(it->second);
+        if (!str) return false;
+        try {
+            value = std::stod(str->get());
+        } catch (const std::exception &) {
+            return false;
+        }
+        return true;
+    };
+
+    struct Row {
+        std::string name;
+        std::string type;
+        double timeMcs;
+        double flops;
+        double bytes;
+    };
+    std::vector<Row> rows;
+    for (const auto &op : function->get_ordered_ops()) {
+        Row row = {op->get_friendly_name(), "", 0., 0., 0.};
+        if (!getValue(op, "execTimeMcs", row.timeMcs) || row.timeMcs <= 0. ||
+            !getValue(op, "estimatedFlops", row.flops) || !getValue(op, "estimatedBytes", row.bytes)) {
+            continue;
+        }
+        auto type = op->get_rt_info().find("layerType");
+        if (type != op->get_rt_info().end()) {
+            if (auto str = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(type->second))
+                row.type = str->get();
+        }
+        rows.push_back(row);
+    }
+    if (rows.empty()) {
+        return;
+    }
+
+    // the most time consuming layers are the first optimization targets
+    std::sort(rows.begin(), rows.end(), [] (const Row &a, const Row &b) { return a.timeMcs > b.timeMcs; });
+
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_roofline_report.csv");
+    dumper << "layerName" << "layerType" << "realTime (ms)" << "GFLOP" << "MB";
+    dumper << "GFLOP/s" << "GB/s" << "FLOP/byte";
+    if (peakGFlops > 0 && peakGBps > 0) {
+        dumper << "bound" << "of attainable (%)";
+    }
+    dumper.endLine();
+
+    for (const auto &row : rows) {
+        // FLOP per microsecond is MFLOP/s
+        const double gflops = row.flops / row.timeMcs / 1000.;
+        const double gbps = row.bytes / row.timeMcs / 1000.;
+        const double intensity = row.bytes > 0. ? row.flops / row.bytes : 0.;
+        dumper << row.name << row.type << row.timeMcs / 1000. << row.flops / 1e9 << row.bytes / 1e6;
+        dumper << gflops << gbps << intensity;
+        if (peakGFlops > 0 && peakGBps > 0) {
+            const bool memoryBound = intensity * peakGBps < peakGFlops;
+            const double attainableGFlops = memoryBound ? intensity * peakGBps : peakGFlops;
+            dumper << (memoryBound ? "memory" : "compute");
+            // layers without arithmetic are compared by the bandwidth
+            dumper << (row.flops > 0. ? 100. * gflops / attainableGFlops : 100. * gbps / peakGBps);
+        }
+        dumper.endLine();
+    }
+
+    slog::info << "Roofline report is stored to " << dumper.getFilename() << slog::endl;
+}
@@ -14,6 +14,8 @@
 #include <samples/slog.hpp>
 #include <samples/csv_dumper.hpp>
 
+#include "latency_histogram.hpp"
+
 // @brief statistics reports types
 static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
@@ -57,6 +59,12 @@ public:
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
+    void dumpLatencyHistogram(const LatencyHistogram &histogram);
+
+    /// @brief Dumps achieved performance of executed layers of the executable graph which has estimated
+    ///        FLOPs and bytes of its nodes. Zero peak values mean the peak of the device is unknown.
+    void dumpRoofline(const InferenceEngine::CNNNetwork &execGraph, double peakGFlops, double peakGBps);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
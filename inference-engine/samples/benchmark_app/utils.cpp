@@ -102,6 +102,22 @@ std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector
     return result;
 }
 
+std::pair<double, double> parseRooflinePeak(const std::string& peak_string) {
+    //  Format: <GFLOP/s>,<GB/s>
+    auto values = split(peak_string, ',');
+    if (values.size() != 2) {
+        throw std::logic_error("Incorrect -roofline_peak value: " + peak_string + ". Expected \"<GFLOP/s>,<GB/s>\".");
+    }
+    try {
+        auto peak = std::make_pair(std::stod(values[0]), std::stod(values[1]));
+        if (peak.first > 0 && peak.second > 0) {
+            return peak;
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::logic_error("Incorrect -roofline_peak value: " + peak_string + ". Peak values should be positive numbers.");
+}
+
 bool adjustShapesBatch(InferenceEngine::ICNNNetwork::InputShapes& shapes,
                        const size_t batch_size, const InferenceEngine::InputsDataMap& input_info) {
     bool updated = false;
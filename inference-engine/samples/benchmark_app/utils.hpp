@@ -7,11 +7,13 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <utility>
 
 std::vector<std::string> parseDevices(const std::string& device_string);
 uint32_t deviceDefaultDeviceDurationInSeconds(const std::string& device);
 std::map<std::string, std::string> parseNStreamsValuePerDevice(const std::vector<std::string>& devices,
                                                                const std::string& values_string);
+std::pair<double, double> parseRooflinePeak(const std::string& peak_string);
 bool updateShapes(InferenceEngine::ICNNNetwork::InputShapes& shapes,
                   const std::string shapes_string, const InferenceEngine::InputsDataMap& input_info);
 bool adjustShapesBatch(InferenceEngine::ICNNNetwork::InputShapes& shapes,
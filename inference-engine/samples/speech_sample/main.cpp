@@ -14,8 +14,12 @@
 #include <string>
 #include <vector>
 #include <utility>
+#include <algorithm>
+#include <cstring>
 #include <time.h>
 #include <thread>
+#include <atomic>
+#include <exception>
 #include <chrono>
 #include <limits>
 #include <iomanip>
@@ -519,9 +523,183 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("Invalid value for 'cw_l' argument. It must be greater than or equal to 0");
     }
 
+    if (FLAGS_nu <= 0) {
+        throw std::logic_error("Invalid value for 'nu' argument. It must be greater than 0");
+    }
+
+    if (FLAGS_nu > 1 && (FLAGS_cw_l > 0 || FLAGS_cw_r > 0)) {
+        throw std::logic_error("Parallel scoring of utterances ('nu' argument) doesn't support context windows");
+    }
+
     return true;
 }
 
+/**
+ * @brief Scores utterances in parallel: every executable network scores one utterance at a time
+ * with its own infer request and memory state, results are reported in order of utterances
+ */
+void ScoreUtterancesInParallel(std::vector<ExecutableNetwork> &executableNets,
+                               const std::vector<std::string> &inputArkFiles,
+                               uint32_t numUtterances,
+                               uint32_t batchSize,
+                               const std::vector<std::string> &inputNames,
+                               const std::string &outputName,
+                               const std::string &outputArkFile,
+                               const std::string &referenceArkFile) {
+    struct UtteranceResult {
+        std::string name;
+        uint32_t numFrames = 0;
+        uint32_t numScoresPerFrame = 0;
+        std::vector<uint8_t> scores;
+        score_error_t totalError;
+        double totalTime = 0.0;
+    };
+
+    std::vector<UtteranceResult> results(numUtterances);
+    std::vector<std::exception_ptr> errors(executableNets.size());
+    std::atomic<uint32_t> nextUtterance{0};
+
+    auto scoreUtterances = [&](size_t netIndex) {
+        try {
+            auto inferRequest = executableNets[netIndex].CreateInferRequest();
+
+            std::vector<MemoryBlob::Ptr> inputBlobs;
+            for (const auto &name : inputNames) {
+                inputBlobs.push_back(as<MemoryBlob>(inferRequest.GetBlob(name)));
+                if (!inputBlobs.back()) {
+                    throw std::logic_error("We expect input blob " + name + " to be inherited from MemoryBlob");
+                }
+            }
+            MemoryBlob::CPtr outputBlob = as<MemoryBlob>(inferRequest.GetBlob(outputName));
+            if (!outputBlob) {
+                throw std::logic_error("We expect output blob " + outputName + " to be inherited from MemoryBlob");
+            }
+            const auto numScoresPerFrame = static_cast<uint32_t>(outputBlob->size() / batchSize);
+
+            for (auto utteranceIndex = nextUtterance++; utteranceIndex < numUtterances; utteranceIndex = nextUtterance++) {
+                auto &result = results[utteranceIndex];
+
+                std::vector<std::vector<uint8_t>> ptrUtterances(inputArkFiles.size());
+                std::vector<uint32_t> numFrameElementsInput(inputArkFiles.size());
+                for (size_t i = 0; i < inputArkFiles.size(); i++) {
+                    uint32_t numBytes(0), numFrames(0), numBytesPerElement(0);
+                    GetKaldiArkInfo(inputArkFiles[i].c_str(), utteranceIndex, nullptr, &numBytes);
+                    ptrUtterances[i].resize(numBytes);
+                    LoadKaldiArkArray(inputArkFiles[i].c_str(), utteranceIndex, result.name, ptrUtterances[i],
+                                      &numFrames, &numFrameElementsInput[i], &numBytesPerElement);
+                    if (i == 0) {
+                        result.numFrames = numFrames;
+                    } else if (numFrames != result.numFrames) {
+                        throw std::logic_error("Number of frames in ark files is different: " +
+                                               std::to_string(result.numFrames) + " and " + std::to_string(numFrames));
+                    }
+                    if (inputBlobs[i]->size() != numFrameElementsInput[i] * batchSize) {
+                        throw std::logic_error("network input size(" + std::to_string(inputBlobs[i]->size()) +
+                                               ") mismatch to ark file size (" +
+                                               std::to_string(numFrameElementsInput[i] * batchSize) + ")");
+                    }
+                }
+
+                std::vector<uint8_t> ptrReferenceScores;
+                uint32_t numFrameElementsReference(0), numBytesPerElementReference(0);
+                if (!referenceArkFile.empty()) {
+                    std::string refUtteranceName;
+                    uint32_t numBytes(0), numFramesReference(0);
+                    GetKaldiArkInfo(referenceArkFile.c_str(), utteranceIndex, nullptr, &numBytes);
+                    ptrReferenceScores.resize(numBytes);
+                    LoadKaldiArkArray(referenceArkFile.c_str(), utteranceIndex, refUtteranceName, ptrReferenceScores,
+                                      &numFramesReference, &numFrameElementsReference, &numBytesPerElementReference);
+                }
+
+                result.numScoresPerFrame = numScoresPerFrame;
+                result.scores.resize(result.numFrames * numScoresPerFrame * sizeof(float));
+                score_error_t frameError;
+                ClearScoreError(&result.totalError);
+                result.totalError.threshold = frameError.threshold = MAX_SCORE_DIFFERENCE;
+
+                // every utterance starts from the initial memory state
+                for (auto &&state : inferRequest.QueryState()) {
+                    state.Reset();
+                }
+
+                auto t0 = Time::now();
+                for (uint32_t frameIndex = 0; frameIndex < result.numFrames; frameIndex += batchSize) {
+                    const auto numFramesThisBatch = std::min(batchSize, result.numFrames - frameIndex);
+                    for (size_t i = 0; i < inputBlobs.size(); i++) {
+                        // locked memory holder should be alive all time while access to its buffer happens
+                        auto minputHolder = inputBlobs[i]->wmap();
+                        const auto frameBytes = numFrameElementsInput[i] * sizeof(float);
+                        std::memcpy(minputHolder.as<void *>(),
+                                    &ptrUtterances[i][frameIndex * frameBytes],
+                                    numFramesThisBatch * frameBytes);
+                    }
+
+                    inferRequest.Infer();
+
+                    // locked memory holder should be alive all time while access to its buffer happens
+                    auto moutputHolder = outputBlob->rmap();
+                    std::memcpy(&result.scores[frameIndex * numScoresPerFrame * sizeof(float)],
+                                moutputHolder.as<const void *>(),
+                                numFramesThisBatch * numScoresPerFrame * sizeof(float));
+                    if (!ptrReferenceScores.empty()) {
+                        CompareScores(moutputHolder.as<float *>(),
+                                      &ptrReferenceScores[frameIndex * numFrameElementsReference * numBytesPerElementReference],
+                                      &frameError,
+                                      numFramesThisBatch,
+                                      numFrameElementsReference);
+                        UpdateScoreError(&frameError, &result.totalError);
+                    }
+                }
+                result.totalTime = std::chrono::duration_cast<ms>(Time::now() - t0).count();
+            }
+        } catch (...) {
+            errors[netIndex] = std::current_exception();
+            // let the other networks stop after their current utterances
+            nextUtterance = numUtterances;
+        }
+    };
+
+    auto t0 = Time::now();
+    std::vector<std::thread> threads;
+    for (size_t netIndex = 1; netIndex < executableNets.size(); netIndex++) {
+        threads.emplace_back(scoreUtterances, netIndex);
+    }
+    scoreUtterances(0);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    ms totalTime = std::chrono::duration_cast<ms>(Time::now() - t0);
+
+    for (const auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    for (uint32_t utteranceIndex = 0; utteranceIndex < numUtterances; ++utteranceIndex) {
+        auto &result = results[utteranceIndex];
+        if (!outputArkFile.empty()) {
+            SaveKaldiArkArray(outputArkFile.c_str(), utteranceIndex != 0, result.name, result.scores.data(),
+                              result.numFrames, result.numScoresPerFrame);
+        }
+
+        std::cout << "Utterance " << utteranceIndex << ": " << std::endl;
+        std::cout << "Total time in Infer (HW and SW):\t" << result.totalTime << " ms"
+                  << std::endl;
+        std::cout << "Frames in utterance:\t\t\t" << result.numFrames << " frames"
+                  << std::endl;
+        std::cout << "Average Infer time per frame:\t\t" << result.totalTime / static_cast<double>(result.numFrames) << " ms"
+                  << std::endl;
+        if (!referenceArkFile.empty()) {
+            printReferenceCompareResults(result.totalError, result.numFrames, std::cout);
+        }
+        std::cout << "End of Utterance " << utteranceIndex << std::endl << std::endl;
+    }
+
+    std::cout << "Total time of scoring " << numUtterances << " utterances by " << executableNets.size()
+              << " networks in parallel:\t" << totalTime.count() << " ms" << std::endl;
+}
+
 /**
  * @brief The entry point for inference engine automatic speech recognition sample
  * @file speech_sample/main.cpp
@@ -711,13 +889,16 @@ int main(int argc, char *argv[]) {
                 network.addOutput(outputs[i], ports[i]);
             }
         }
+        auto loadExecutableNetwork = [&]() {
+            return !FLAGS_m.empty() ? ie.LoadNetwork(network, deviceStr, genericPluginConfig)
+                                    : ie.ImportNetwork(FLAGS_rg.c_str(), deviceStr, genericPluginConfig);
+        };
         if (!FLAGS_m.empty()) {
             slog::info << "Loading model to the device" << slog::endl;
-            executableNet = ie.LoadNetwork(network, deviceStr, genericPluginConfig);
         } else {
             slog::info << "Importing model to the device" << slog::endl;
-            executableNet = ie.ImportNetwork(FLAGS_rg.c_str(), deviceStr, genericPluginConfig);
         }
+        executableNet = loadExecutableNetwork();
         ms loadTime = std::chrono::duration_cast<ms>(Time::now() - t0);
         slog::info << "Model loading time " << loadTime.count() << " ms" << slog::endl;
 
@@ -836,7 +1017,31 @@ int main(int argc, char *argv[]) {
             }
             count_file = reference_name_files.empty() ? 1 : reference_name_files.size();
         }
+        std::vector<ExecutableNetwork> executableNets{executableNet};
+        if (FLAGS_nu > 1) {
+            slog::info << "Loading " << FLAGS_nu - 1 << " more copies of the model to score utterances in parallel" << slog::endl;
+            for (int i = 1; i < FLAGS_nu; i++) {
+                executableNets.push_back(loadExecutableNetwork());
+            }
+            if (FLAGS_pc) {
+                slog::warn << "Performance counters are not reported when utterances are scored in parallel" << slog::endl;
+            }
+        }
         for (size_t next_output = 0; next_output < count_file; next_output++) {
+            if (FLAGS_nu > 1) {
+                std::vector<std::string> inputNames = FLAGS_iname.empty() ? std::vector<std::string>{} : ParseBlobName(FLAGS_iname);
+                if (inputNames.empty()) {
+                    for (const auto &input : cInputInfo) {
+                        inputNames.push_back(input.first);
+                    }
+                }
+                ScoreUtterancesInParallel(executableNets, inputArkFiles, numUtterances, batchSize, inputNames,
+                                          outputs.empty() ? cOutputInfo.rbegin()->first : outputs[next_output],
+                                          FLAGS_o.empty() ? std::string() : output_name_files[next_output],
+                                          FLAGS_r.empty() ? std::string() : reference_name_files[next_output]);
+                continue;
+            }
+
             std::vector<std::vector<uint8_t>> ptrUtterances;
             std::vector<uint8_t> ptrScores;
             std::vector<uint8_t> ptrReferenceScores;
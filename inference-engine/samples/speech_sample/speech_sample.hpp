@@ -71,6 +71,11 @@ static const char batch_size_message[] = "Batch size 1-8 (default 1)";
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for concurrent async" \
 " inference requests on the GNA.";
 
+/// @brief message for number of utterances scored in parallel
+static const char parallel_utterances_message[] = "Optional. Number of utterances scored in parallel (default is 1)." \
+" Every utterance is scored on its own copy of the network with its own infer request and memory state." \
+" Can't be used with the cw_l or cw_r flag.";
+
 /// @brief message for left context window argument
 static const char context_window_message_l[] = "Optional. Number of frames for left context windows (default is 0). " \
                                                "Works only with context window networks."
@@ -149,6 +154,9 @@ DEFINE_int32(bs, 1, batch_size_message);
 /// @brief Number of threads to use for inference on the CPU (also affects Hetero cases)
 DEFINE_int32(nthreads, 1, infer_num_threads_message);
 
+/// @brief Number of utterances scored in parallel (default 1)
+DEFINE_int32(nu, 1, parallel_utterances_message);
+
 /// @brief Right context window size (default 0)
 DEFINE_int32(cw_r, 0, context_window_message_r);
 
@@ -187,6 +195,7 @@ static void showUsage() {
     std::cout << "    -we \"<path>\"            " << write_embedded_model_message << std::endl;
     std::cout << "    -we_gen \"<generation>\"  " << write_embedded_model_generation_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"   " << infer_num_threads_message << std::endl;
+    std::cout << "    -nu \"<integer>\"         " << parallel_utterances_message << std::endl;
     std::cout << "    -cw_l \"<integer>\"       " << context_window_message_l << std::endl;
     std::cout << "    -cw_r \"<integer>\"       " << context_window_message_r << std::endl;
     std::cout << "    -oname \"<string>\"       " << output_layer_names_message << std::endl;
@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <map>
+#include <memory>
+#include <string>
+
+#include "auto_batch_async_infer_request.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
+    const AutoBatchInferRequest::Ptr&           inferRequest,
+    const AutoBatchExecutableNetwork::Ptr&      autoBatchExecutableNetwork,
+    const ITaskExecutor::Ptr&                   callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _autoBatchExecutableNetwork{autoBatchExecutableNetwork},
+    _inferRequest{inferRequest} {
+    // passes the request to the batch collector, the task is executed once the batched request is completed
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_autoBatchExecutableNetwork->Enqueue(_this->_inferRequest.get(), std::move(task));
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        {std::make_shared<ThisRequestExecutor>(this), [this] {
+            auto status = _inferRequest->_batchStatus;
+            if (InferenceEngine::StatusCode::OK != status) {
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
+            }
+            _perfMap = std::move(_inferRequest->_batchPerfMap);
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+void AutoBatchAsyncInferRequest::GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    perfMap = _perfMap;
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+}
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,198 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ie_metric_helpers.hpp"
+#include <cpp_interfaces/base/ie_infer_async_request_base.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+#include <ie_plugin_config.hpp>
+#include "auto_batch_exec_network.hpp"
+#include "auto_batch_async_infer_request.hpp"
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                            networkWithBatch,
+                                                       const size_t                                                         batchSize,
+                                                       const std::chrono::milliseconds                                      timeout,
+                                                       const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
+                                                       const bool                                                           needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _networkWithBatch{networkWithBatch},
+    _batchSize{batchSize},
+    _timeout{timeout},
+    _config{config},
+    _needPerfCounters{needPerfCounters} {
+    _taskExecutor.reset();
+
+    unsigned int numRequests = 1;
+    try {
+        numRequests = std::max(1u, _networkWithBatch.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+    } catch (const details::InferenceEngineException&) {
+        // the device does not report the metric, so the batched requests are executed one by one
+    }
+
+    for (unsigned int i = 0; i < numRequests; ++i) {
+        _workerRequests.emplace_back(new WorkerInferRequest);
+        auto workerRequestPtr = _workerRequests.back().get();
+        workerRequestPtr->_inferRequest = _networkWithBatch.CreateInferRequest();
+        workerRequestPtr->_inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [workerRequestPtr, this] (InferRequest, StatusCode status) mutable {
+                std::map<std::string, InferenceEngineProfileInfo> perfMap;
+                if (_needPerfCounters && StatusCode::OK == status) {
+                    perfMap = workerRequestPtr->_inferRequest.GetPerformanceCounts();
+                }
+                auto tasks = std::move(workerRequestPtr->_tasks);
+                workerRequestPtr->_tasks.clear();
+                for (size_t slot = 0; slot < tasks.size(); ++slot) {
+                    auto inferRequest = tasks[slot]._inferRequest;
+                    inferRequest->_batchStatus = status;
+                    if (StatusCode::OK == status) {
+                        try {
+                            inferRequest->CopyOutputsFromBatch(workerRequestPtr->_inferRequest, _batchSize, slot);
+                            inferRequest->_batchPerfMap = perfMap;
+                        } catch (...) {
+                            inferRequest->_batchStatus = StatusCode::GENERAL_ERROR;
+                        }
+                    }
+                    auto capturedTask = std::move(tasks[slot]._task);
+                    capturedTask();
+                }
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_terminate) {
+                    _idleWorkerRequests.push_back(workerRequestPtr);
+                    _cond.notify_all();
+                }
+            });
+        _idleWorkerRequests.push_back(workerRequestPtr);
+    }
+
+    _collector = std::thread([this] { CollectBatches(); });
+}
+
+void AutoBatchExecutableNetwork::Enqueue(AutoBatchInferRequest* inferRequest, Task task) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pendingRequests.push_back({inferRequest, std::move(task), std::chrono::steady_clock::now()});
+    _cond.notify_all();
+}
+
+void AutoBatchExecutableNetwork::CollectBatches() {
+    while (true) {
+        WorkerInferRequest* workerRequestPtr = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cond.wait(lock, [this] { return _terminate || !_pendingRequests.empty(); });
+            if (_terminate) {
+                return;
+            }
+            // the timeout is counted from the arrival of the oldest request, so no request waits longer than it
+            const auto deadline = _pendingRequests.front()._arrival + _timeout;
+            _cond.wait_until(lock, deadline, [this] { return _terminate || _pendingRequests.size() >= _batchSize; });
+            _cond.wait(lock, [this] { return _terminate || !_idleWorkerRequests.empty(); });
+            if (_terminate) {
+                return;
+            }
+            workerRequestPtr = _idleWorkerRequests.front();
+            _idleWorkerRequests.pop_front();
+            const auto numTasks = std::min(_batchSize, _pendingRequests.size());
+            std::move(_pendingRequests.begin(), _pendingRequests.begin() + numTasks, std::back_inserter(workerRequestPtr->_tasks));
+            _pendingRequests.erase(_pendingRequests.begin(), _pendingRequests.begin() + numTasks);
+        }
+
+        auto& tasks = workerRequestPtr->_tasks;
+        try {
+            for (size_t slot = 0; slot < tasks.size(); ++slot) {
+                tasks[slot]._inferRequest->CopyInputsToBatch(workerRequestPtr->_inferRequest, _batchSize, slot);
+            }
+            // batch items which are not used in this run keep the data of the previous run and their outputs are ignored
+            workerRequestPtr->_inferRequest.StartAsync();
+        } catch (...) {
+            auto failedTasks = std::move(tasks);
+            tasks.clear();
+            for (auto&& failedTask : failedTasks) {
+                failedTask._inferRequest->_batchStatus = StatusCode::GENERAL_ERROR;
+                failedTask._task();
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
+            _idleWorkerRequests.push_back(workerRequestPtr);
+        }
+    }
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+        _cond.notify_all();
+    }
+    _collector.join();
+    /* NOTE: Pending requests hold the executable network, so there are no collected requests here.
+     *       Destructors of the worker requests wait for the completion callbacks that are still running
+     */
+    _workerRequests.clear();
+}
+
+InferenceEngine::InferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                              InferenceEngine::OutputsDataMap networkOutputs) {
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs);
+}
+
+IInferRequest::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    IInferRequest::Ptr asyncRequest;
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    auto asyncTreadSafeImpl = std::make_shared<AutoBatchAsyncInferRequest>(std::static_pointer_cast<AutoBatchInferRequest>(syncRequestImpl),
+                                                                           std::static_pointer_cast<AutoBatchExecutableNetwork>(shared_from_this()),
+                                                                           _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<AutoBatchAsyncInferRequest>(asyncTreadSafeImpl), [](IInferRequest *p) { p->Release(); });
+    asyncTreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+    return asyncRequest;
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        THROW_IE_EXCEPTION << NOT_FOUND_str << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        // enough batch-1 requests to keep every batched request full
+        unsigned int res = static_cast<unsigned int>(_batchSize * _workerRequests.size());
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _networkWithBatch.GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys;
+        for (auto&& value : _config) {
+            configKeys.push_back(value.first);
+        }
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
+    }
+}
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp/ie_executable_network.hpp>
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include "auto_batch_infer_request.hpp"
+
+namespace AutoBatchPlugin {
+
+/**
+ * @brief Collects asynchronous requests of batch-1 infer requests and executes them as a single request
+ *        of the network reshaped to the batch size. A batch is started when `batchSize` requests are collected
+ *        or when the oldest collected request waits longer than `timeout`
+ */
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    struct PendingRequest {
+        AutoBatchInferRequest*                  _inferRequest;
+        InferenceEngine::Task                   _task;
+        std::chrono::steady_clock::time_point   _arrival;
+    };
+    struct WorkerInferRequest {
+        InferenceEngine::InferRequest   _inferRequest;
+        std::vector<PendingRequest>     _tasks;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::ExecutableNetwork&                           networkWithBatch,
+                                        const size_t                                                        batchSize,
+                                        const std::chrono::milliseconds                                     timeout,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>&  config,
+                                        const bool                                                          needPerfCounters = false);
+
+    InferenceEngine::Parameter GetConfig(const std::string &name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string &name) const override;
+    InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
+    InferenceEngine::InferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                      InferenceEngine::OutputsDataMap networkOutputs) override;
+    ~AutoBatchExecutableNetwork() override;
+
+    void Enqueue(AutoBatchInferRequest* inferRequest, InferenceEngine::Task task);
+
+protected:
+    void CollectBatches();
+
+    InferenceEngine::ExecutableNetwork                          _networkWithBatch;
+    size_t                                                      _batchSize = 1;
+    std::chrono::milliseconds                                   _timeout;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    bool                                                        _needPerfCounters = false;
+
+    bool                                                        _terminate = false;
+    std::mutex                                                  _mutex;
+    std::condition_variable                                     _cond;
+    std::deque<PendingRequest>                                  _pendingRequests;
+    std::vector<std::unique_ptr<WorkerInferRequest>>            _workerRequests;
+    std::deque<WorkerInferRequest*>                             _idleWorkerRequests;
+    std::thread                                                 _collector;
+};
+
+}  // namespace AutoBatchPlugin
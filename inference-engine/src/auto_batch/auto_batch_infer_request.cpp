@@ -0,0 +1,70 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <cstring>
+#include <string>
+
+#include "auto_batch_infer_request.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+void CopyBlob(const Blob::Ptr& src, size_t srcOffset, const Blob::Ptr& dst, size_t dstOffset, size_t size, const std::string& name) {
+    if (src->byteSize() < srcOffset + size || dst->byteSize() < dstOffset + size) {
+        THROW_IE_EXCEPTION << "Auto-Batching: blob '" << name << "' size does not match the batched network. "
+                           << "All inputs and outputs of the network should have the batch as the outermost dimension";
+    }
+    std::memcpy(dst->buffer().as<uint8_t*>() + dstOffset, src->cbuffer().as<const uint8_t*>() + srcOffset, size);
+}
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&   networkInputs,
+                                             const OutputsDataMap&  networkOutputs)
+        : InferRequestInternal(networkInputs, networkOutputs) {
+    // Allocate all input blobs
+    for (const auto &it : networkInputs) {
+        Layout l = it.second->getLayout();
+        Precision p = it.second->getPrecision();
+        SizeVector dims = it.second->getTensorDesc().getDims();
+
+        TensorDesc desc = TensorDesc(p, dims, l);
+        _inputs[it.first] = make_blob_with_precision(desc);
+        _inputs[it.first]->allocate();
+    }
+    // Allocate all output blobs
+    for (const auto &it : networkOutputs) {
+        Layout l = it.second->getLayout();
+        Precision p = it.second->getPrecision();
+        SizeVector dims = it.second->getTensorDesc().getDims();
+
+        TensorDesc desc = TensorDesc(p, dims, l);
+        _outputs[it.first] = make_blob_with_precision(desc);
+        _outputs[it.first]->allocate();
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsToBatch(InferRequest& batchedRequest, size_t batchSize, size_t slot) {
+    // this request is already in BUSY state, so using the internal data safely
+    execDataPreprocessing(_inputs, true);
+    for (const auto &it : _networkInputs) {
+        auto &name = it.first;
+        auto batchedBlob = batchedRequest.GetBlob(name);
+        const auto itemSize = batchedBlob->byteSize() / batchSize;
+        CopyBlob(_inputs[name], 0, batchedBlob, slot * itemSize, itemSize, name);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromBatch(InferRequest& batchedRequest, size_t batchSize, size_t slot) {
+    for (const auto &it : _networkOutputs) {
+        auto &name = it.first;
+        auto batchedBlob = batchedRequest.GetBlob(name);
+        const auto itemSize = batchedBlob->byteSize() / batchSize;
+        CopyBlob(batchedBlob, slot * itemSize, _outputs[name], 0, itemSize, name);
+    }
+}
+
+}  // namespace AutoBatchPlugin
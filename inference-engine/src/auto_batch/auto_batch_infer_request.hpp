@@ -0,0 +1,37 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include <cpp/ie_infer_request.hpp>
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+
+namespace AutoBatchPlugin {
+
+class AutoBatchInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&  networkInputs,
+                                   const InferenceEngine::OutputsDataMap& networkOutputs);
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>&) const override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    void InferImpl() override {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
+    }
+    // Auto-Batching impl specific: copies the pre-processed inputs to the `slot`-th batch item of the batched request
+    void CopyInputsToBatch(InferenceEngine::InferRequest& batchedRequest, size_t batchSize, size_t slot);
+    // Auto-Batching impl specific: copies the `slot`-th batch item of the batched request outputs to this request
+    void CopyOutputsFromBatch(InferenceEngine::InferRequest& batchedRequest, size_t batchSize, size_t slot);
+
+    InferenceEngine::StatusCode                                         _batchStatus = InferenceEngine::StatusCode::OK;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _batchPerfMap;
+};
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,222 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+#include <memory>
+#include <map>
+#include <unordered_map>
+
+#include <ie_metric_helpers.hpp>
+#include <ie_algorithm.hpp>
+#include <ie_icore.hpp>
+#include <auto-batch/auto_batch_config.hpp>
+#include <ngraph/graph_util.hpp>
+#include "auto_batch_plugin.hpp"
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+namespace {
+    constexpr size_t defaultBatchSize = 8;
+    constexpr size_t defaultTimeout = 100;
+
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    size_t parseValue(const std::map<std::string, std::string>& config,
+                      const std::string& key, size_t defaultValue, bool allowZero) {
+        auto it = config.find(key);
+        if (it == config.end()) {
+            return defaultValue;
+        }
+        size_t value = 0;
+        try {
+            value = std::stoul(it->second);
+        } catch (...) {
+            THROW_IE_EXCEPTION << "Wrong value for property key " << key << ": " << it->second;
+        }
+        if (value == 0 && !allowZero) {
+            THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected positive integer, but got " << it->second;
+        }
+        return value;
+    }
+
+    size_t parseBatchSize(const std::map<std::string, std::string>& config) {
+        return parseValue(config, AutoBatchConfigParams::KEY_AUTO_BATCH_SIZE, defaultBatchSize, false);
+    }
+
+    std::chrono::milliseconds parseTimeout(const std::map<std::string, std::string>& config) {
+        return std::chrono::milliseconds(parseValue(config, AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT, defaultTimeout, true));
+    }
+
+    std::string getDevice(const std::map<std::string, std::string>& config) {
+        auto device = config.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE);
+        if (device == config.end() || device->second.empty()) {
+            THROW_IE_EXCEPTION << "KEY_AUTO_BATCH_DEVICE key is not set for BATCH device";
+        }
+        return device->second;
+    }
+}  // namespace
+
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+        const std::map<std::string, Parameter> & options) const {
+    if (name == AUTO_BATCH_CONFIG_KEY(DEVICE)) {
+        return { getDevice(_config) };
+    } else if (name == AUTO_BATCH_CONFIG_KEY(SIZE)) {
+        return { std::to_string(parseBatchSize(_config)) };
+    } else if (name == AUTO_BATCH_CONFIG_KEY(TIMEOUT)) {
+        return { std::to_string(parseTimeout(_config).count()) };
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported config key: " << name;
+    }
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string> & config) {
+    // validate the values before they are stored
+    parseBatchSize(config);
+    parseTimeout(config);
+    for (auto && kvp : config) {
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { "BATCH" };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        std::vector<std::string> configKeys = {
+            AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_SIZE,
+            AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT};
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported metric key " << name;
+    }
+}
+
+ExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const ICNNNetwork &network,
+                                                                            const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    if (network.getFunction() == nullptr) {
+        THROW_IE_EXCEPTION << "BATCH device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    const auto device = getDevice(fullConfig);
+    const auto batchSize = parseBatchSize(fullConfig);
+    const auto timeout = parseTimeout(fullConfig);
+
+    // the batched network gets already pre-processed inputs from the batch-1 requests, so only
+    // precisions and layouts are copied from the original network
+    CNNNetwork networkWithBatch{ngraph::clone_function(*network.getFunction())};
+    InputsDataMap inputs;
+    network.getInputsInfo(inputs);
+    for (auto&& input : networkWithBatch.getInputsInfo()) {
+        auto& original = inputs.at(input.first);
+        input.second->setPrecision(original->getPrecision());
+        input.second->setLayout(original->getLayout());
+    }
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+    for (auto&& output : networkWithBatch.getOutputsInfo()) {
+        auto& original = outputs.at(output.first);
+        output.second->setPrecision(original->getPrecision());
+        output.second->setLayout(original->getLayout());
+    }
+    networkWithBatch.setBatchSize(batchSize * network.getBatchSize());
+
+    // every input and output should be split to the batch-1 requests as contiguous batch items
+    auto checkBatched = [&] (const std::string& name, const SizeVector& originalDims, const SizeVector& batchedDims) {
+        if (details::product(batchedDims.begin(), batchedDims.end()) !=
+            batchSize * details::product(originalDims.begin(), originalDims.end())) {
+            THROW_IE_EXCEPTION << "BATCH device cannot batch the network: the batch is not the outermost dimension of '"
+                               << name << "'";
+        }
+    };
+    for (auto&& input : networkWithBatch.getInputsInfo()) {
+        checkBatched(input.first, inputs.at(input.first)->getTensorDesc().getDims(), input.second->getTensorDesc().getDims());
+    }
+    for (auto&& output : networkWithBatch.getOutputsInfo()) {
+        checkBatched(output.first, outputs.at(output.first)->getTensorDesc().getDims(), output.second->getTensorDesc().getDims());
+    }
+
+    DeviceIDParser deviceParser(device);
+    auto deviceConfig = GetSupportedConfig(fullConfig, deviceParser.getDeviceName());
+    auto executableNetwork = GetCore()->LoadNetwork(networkWithBatch, device, deviceConfig);
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
+    networkConfig[AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE] = device;
+    networkConfig[AutoBatchConfigParams::KEY_AUTO_BATCH_SIZE] = std::to_string(batchSize);
+    networkConfig[AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT] = std::to_string(timeout.count());
+    networkConfig.insert(deviceConfig.begin(), deviceConfig.end());
+
+    auto perfConfig = fullConfig.find(PluginConfigParams::KEY_PERF_COUNT);
+    bool enablePerfCounters = (fullConfig.end() != perfConfig) && (perfConfig->second == PluginConfigParams::YES);
+
+    return std::make_shared<AutoBatchExecutableNetwork>(executableNetwork,
+                                                        batchSize,
+                                                        timeout,
+                                                        networkConfig,
+                                                        enablePerfCounters);
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const ICNNNetwork&                        network,
+                                                          const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with BATCH device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    const auto device = getDevice(fullConfig);
+    DeviceIDParser deviceParser(device);
+    auto deviceQr = GetCore()->QueryNetwork(CNNNetwork{ICNNNetwork::Ptr{const_cast<ICNNNetwork*>(&network),
+                                                       [](ICNNNetwork*){}}}, device,
+                                            GetSupportedConfig(fullConfig, deviceParser.getDeviceName()));
+    QueryNetworkResult queryResult;
+    queryResult.rc = StatusCode::OK;
+    for (auto&& layerQr : deviceQr.supportedLayersMap) {
+        queryResult.supportedLayersMap[layerQr.first] = GetName();
+    }
+    return queryResult;
+}
+
+}  // namespace AutoBatchPlugin
@@ -4,6 +4,9 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <thread>
+
 #include <cldnn/cldnn_config.hpp>
 #include "cldnn_config.h"
 #include "cpp_interfaces/exception2status.hpp"
@@ -156,6 +159,55 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& configMap)
                 kernels_cache_dir = val;
                 createDirectory(kernels_cache_dir);
             }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_MAX_SIZE) == 0) {
+            std::stringstream ss(val);
+            uint32_t uVal(0);
+            ss >> uVal;
+            if (ss.fail()) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            kernels_cache_max_size = uVal;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_MAX_NUM_THREADS) == 0) {
+            std::stringstream ss(val);
+            uint32_t uVal(0);
+            ss >> uVal;
+            if (ss.fail()) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            uint32_t maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+            n_threads = static_cast<uint16_t>(uVal == 0 || uVal > maxThreads ? maxThreads : uVal);
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_LAZY_KERNELS_COMPILATION) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                lazy_kernels_compilation = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                lazy_kernels_compilation = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_DEVICE_MEMORY_LIMIT) == 0) {
+            std::stringstream ss(val);
+            uint32_t uVal(0);
+            ss >> uVal;
+            if (ss.fail()) {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+            device_memory_limit = uVal;
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_DYN_BATCH_SINGLE_NETWORK) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                dyn_batch_single_network = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                dyn_batch_single_network = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
+        } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_PARALLEL_BRANCHES) == 0) {
+            if (val.compare(PluginConfigParams::YES) == 0) {
+                parallel_branches = true;
+            } else if (val.compare(PluginConfigParams::NO) == 0) {
+                parallel_branches = false;
+            } else {
+                THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property value by plugin: " << val;
+            }
         } else if (key.compare(CLDNNConfigParams::KEY_CLDNN_SOURCES_DUMPS_DIR) == 0) {
             if (!val.empty()) {
                 sources_dumps_dir = val;
@@ -257,6 +309,21 @@ void Config::adjustKeyMapValues() {
     else
         key_config_map[CLDNNConfigParams::KEY_CLDNN_NV12_TWO_INPUTS] = PluginConfigParams::NO;
 
+    if (lazy_kernels_compilation)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_LAZY_KERNELS_COMPILATION] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_LAZY_KERNELS_COMPILATION] = PluginConfigParams::NO;
+
+    if (parallel_branches)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_PARALLEL_BRANCHES] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_PARALLEL_BRANCHES] = PluginConfigParams::NO;
+
+    if (dyn_batch_single_network)
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_DYN_BATCH_SINGLE_NETWORK] = PluginConfigParams::YES;
+    else
+        key_config_map[CLDNNConfigParams::KEY_CLDNN_DYN_BATCH_SINGLE_NETWORK] = PluginConfigParams::NO;
+
     if (enable_fp16_for_quantized_models)
         key_config_map[CLDNNConfigParams::KEY_CLDNN_ENABLE_FP16_FOR_QUANTIZED_MODELS] = PluginConfigParams::YES;
     else
@@ -298,6 +365,9 @@ void Config::adjustKeyMapValues() {
     key_config_map[CLDNNConfigParams::KEY_CLDNN_GRAPH_DUMPS_DIR] = graph_dumps_dir;
     key_config_map[CLDNNConfigParams::KEY_CLDNN_SOURCES_DUMPS_DIR] = sources_dumps_dir;
     key_config_map[PluginConfigParams::KEY_CACHE_DIR] = kernels_cache_dir;
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_MAX_SIZE] = std::to_string(kernels_cache_max_size);
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_MAX_NUM_THREADS] = std::to_string(n_threads);
+    key_config_map[CLDNNConfigParams::KEY_CLDNN_DEVICE_MEMORY_LIMIT] = std::to_string(device_memory_limit);
 
     key_config_map[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = std::to_string(throughput_streams);
     key_config_map[PluginConfigParams::KEY_DEVICE_ID] = device_id;
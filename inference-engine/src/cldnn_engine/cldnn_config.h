@@ -7,6 +7,8 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <thread>
+#include <algorithm>
 
 #include "ie_blob.h"
 #include "cpp/ie_cnn_network.h"
@@ -36,7 +38,13 @@ struct Config {
                graph_dumps_dir(""),
                sources_dumps_dir(""),
                device_id(""),
-               kernels_cache_dir("") {
+               kernels_cache_dir(""),
+               kernels_cache_max_size(0),
+               n_threads(std::max(static_cast<uint16_t>(std::thread::hardware_concurrency()), static_cast<uint16_t>(1))),
+               lazy_kernels_compilation(false),
+               parallel_branches(false),
+               device_memory_limit(0),
+               dyn_batch_single_network(false) {
         adjustKeyMapValues();
     }
 
@@ -61,6 +69,12 @@ struct Config {
     std::string sources_dumps_dir;
     std::string device_id;
     std::string kernels_cache_dir;
+    uint32_t kernels_cache_max_size;  // in megabytes, 0 means no limit
+    uint16_t n_threads;
+    bool lazy_kernels_compilation;
+    bool parallel_branches;
+    uint32_t device_memory_limit;  // in megabytes, 0 means the global memory size of the device
+    bool dyn_batch_single_network;
 
     std::map<std::string, std::string> key_config_map;
 };
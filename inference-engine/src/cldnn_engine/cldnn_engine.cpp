@@ -46,6 +46,7 @@
 #include <legacy/convert_function_to_cnn_network.hpp>
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_transformer.h>
+#include <ie_load_time_breakdown.hpp>
 
 #include "cldnn_engine.h"
 #include "cldnn_executable_network.h"
@@ -85,7 +86,12 @@ cldnn::device_info clDNNEngine::GetDeviceInfo(const std::map<std::string, std::s
 }
 
 InferenceEngine::ICNNNetwork::Ptr clDNNEngine::CloneAndTransformNetwork(const InferenceEngine::ICNNNetwork& network, CLDNNPlugin::Config config) const {
-    std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
+    LoadTimeScope loadTimeScope(LoadTimePhase::Transformations);
+    std::shared_ptr<ICNNNetwork> clonedNetwork;
+    {
+        LoadTimeScope cloningScope(LoadTimePhase::Cloning);
+        clonedNetwork = cloneNetwork(network);
+    }
     bool baselineIsFP16 = false;
 
     if (clonedNetwork->getFunction()) {
@@ -230,6 +236,7 @@ InferenceEngine::ICNNNetwork::Ptr clDNNEngine::CloneAndTransformNetwork(const In
 
         using namespace ngraph::pass::low_precision;
         if (enableInt8) {
+            LoadTimeScope lptScope(LoadTimePhase::LowPrecisionTransformations);
             auto params = LayerTransformation::Params(
                 true,  // updatePrecisions
                 LayerTransformation::QuantizedTensorAlignment::UpdateLevel,  // quantizedTensorAlignmentOnActivations
@@ -241,6 +248,7 @@ InferenceEngine::ICNNNetwork::Ptr clDNNEngine::CloneAndTransformNetwork(const In
             transformer.transform(nGraphFunc);
         }
 
+        LoadTimeScope legacyConversionScope(LoadTimePhase::LegacyConversion);
         {
             ngraph::pass::Manager manager = ngraph::pass::Manager();
             manager.register_pass<ngraph::pass::ConvertOpSet1ToLegacy>();
@@ -361,6 +369,10 @@ ExecutableNetworkInternal::Ptr clDNNEngine::LoadExeNetworkImpl(const InferenceEn
                context_config.tuningConfig.mode == current_config.tuningConfig.mode &&
                context_config.tuningConfig.cache_file_path == current_config.tuningConfig.cache_file_path &&
                context_config.kernels_cache_dir == current_config.kernels_cache_dir &&
+               context_config.kernels_cache_max_size == current_config.kernels_cache_max_size &&
+               context_config.n_threads == current_config.n_threads &&
+               context_config.lazy_kernels_compilation == current_config.lazy_kernels_compilation &&
+               context_config.parallel_branches == current_config.parallel_branches &&
                context_config.device_id == current_config.device_id;
     };
 
@@ -720,6 +732,7 @@ Parameter clDNNEngine::GetMetric(const std::string& name, const std::map<std::st
             capabilities.push_back(METRIC_VALUE(FP16));
         if (device_info.supports_imad || device_info.supports_immad)
             capabilities.push_back(METRIC_VALUE(INT8));
+        capabilities.push_back(METRIC_VALUE(BATCHED_BLOB));
 
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
     } else if (name == METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS)) {
@@ -34,18 +34,24 @@ using namespace InferenceEngine::details;
 
 namespace CLDNNPlugin {
 
+namespace {
+
+InferenceEngine::ITaskExecutor::Ptr createTaskExecutor(const Config& config) {
+    if (config.throughput_streams > 1) {
+        return std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"CLDNNPlugin executor", config.throughput_streams});
+    } else if (config.exclusiveAsyncRequests) {
+        return ExecutorManager::getInstance()->getExecutor("GPU");
+    } else {
+        return std::make_shared<InferenceEngine::CPUStreamsExecutor>(
+            IStreamsExecutor::Config{"CLDNNPlugin executor", 1});
+    }
+}
+
+}  // namespace
+
 CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, RemoteContext::Ptr context, Config config) :
-    InferenceEngine::ExecutableNetworkThreadSafeDefault{[&]()->InferenceEngine::ITaskExecutor::Ptr {
-        if (config.throughput_streams > 1) {
-            return std::make_shared<InferenceEngine::CPUStreamsExecutor>(
-                IStreamsExecutor::Config{"CLDNNPlugin executor", config.throughput_streams});
-        } else if (config.exclusiveAsyncRequests) {
-            return ExecutorManager::getInstance()->getExecutor("GPU");
-        } else {
-            return std::make_shared<InferenceEngine::CPUStreamsExecutor>(
-                IStreamsExecutor::Config{"CLDNNPlugin executor", 1});
-        }
-    }()},
+    InferenceEngine::ExecutableNetworkThreadSafeDefault{createTaskExecutor(config)},
     m_config(config),
     m_taskExecutor{_taskExecutor} {
     auto casted_context = std::dynamic_pointer_cast<gpu::ClContext>(context);
@@ -57,10 +63,37 @@ CLDNNExecNetwork::CLDNNExecNetwork(InferenceEngine::ICNNNetwork &network, Remote
     m_context = casted_context;
 
     auto graph_base = std::make_shared<CLDNNGraph>(network, m_context, m_config, 0);
-    for (uint16_t n = 0; n < m_config.throughput_streams; n++) {
-        auto graph = n == 0 ? graph_base : std::make_shared<CLDNNGraph>(graph_base, n);
+    m_graphs.push_back(graph_base);
+
+    // Secondary streams share weights with the first one and allocate their own activations. The streams which
+    // don't fit into the device memory limit are dropped, so the network runs with fewer streams instead of failing.
+    auto engine = graph_base->GetEngine();
+    uint64_t memory_limit = m_config.device_memory_limit != 0 ?
+                            static_cast<uint64_t>(m_config.device_memory_limit) * 1024 * 1024 :
+                            engine->get_info().max_global_mem_size;
+    if (m_config.device_memory_limit != 0 && engine->get_temp_used_device_memory_size() > memory_limit) {
+        THROW_IE_EXCEPTION << "Network requires " << engine->get_temp_used_device_memory_size() / (1024 * 1024)
+                           << " MB of device memory, which exceeds the " << CLDNNConfigParams::KEY_CLDNN_DEVICE_MEMORY_LIMIT
+                           << " value of " << m_config.device_memory_limit << " MB";
+    }
+    for (uint16_t n = 1; n < m_config.throughput_streams; n++) {
+        std::shared_ptr<CLDNNGraph> graph;
+        try {
+            graph = std::make_shared<CLDNNGraph>(graph_base, n);
+        } catch (const std::exception&) {
+            break;
+        }
+        if (engine->get_temp_used_device_memory_size() > memory_limit)
+            break;
         m_graphs.push_back(graph);
     }
+
+    if (m_graphs.size() < m_config.throughput_streams) {
+        m_config.throughput_streams = static_cast<uint16_t>(m_graphs.size());
+        m_config.key_config_map[PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS] = std::to_string(m_config.throughput_streams);
+        _taskExecutor = createTaskExecutor(m_config);
+        m_taskExecutor = _taskExecutor;
+    }
 }
 
 InferRequestInternal::Ptr CLDNNExecNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
@@ -121,6 +154,11 @@ InferenceEngine::Parameter CLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(LOAD_TIME_BREAKDOWN));
+        metrics.push_back(METRIC_KEY(GPU_MEMORY_STATISTICS));
+        for (auto&& runtimeMetric : GetRuntimeMetricNames()) {
+            metrics.push_back(runtimeMetric);
+        }
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -130,8 +168,17 @@ InferenceEngine::Parameter CLDNNExecNetwork::GetMetric(const std::string &name)
     } else if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
         unsigned int nr = m_config.throughput_streams * 2u;
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, nr);
+    } else if (name == METRIC_KEY(LOAD_TIME_BREAKDOWN)) {
+        IE_SET_METRIC_RETURN(LOAD_TIME_BREAKDOWN, GetLoadTimeBreakdown());
+    } else if (name == METRIC_KEY(GPU_MEMORY_STATISTICS)) {
+        IE_ASSERT(!m_graphs.empty());
+        IE_SET_METRIC_RETURN(GPU_MEMORY_STATISTICS, m_graphs[0]->GetEngine()->get_memory_statistics());
     } else {
-        THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
+        Parameter runtimeMetric;
+        if (!GetRuntimeMetric(name, runtimeMetric)) {
+            THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
+        }
+        return runtimeMetric;
     }
 }
 
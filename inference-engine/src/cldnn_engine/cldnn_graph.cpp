@@ -27,6 +27,7 @@
 #include <sys/stat.h>
 #include <exec_graph_info.hpp>
 #include <ie_ngraph_utils.hpp>
+#include <ie_load_time_breakdown.hpp>
 #include "generic_ie.hpp"
 #include <ngraph/variant.hpp>
 
@@ -66,7 +67,7 @@ void CLDNNGraph::UpdateLayersMaps() {
 void CLDNNGraph::Build() {
     UpdateLayersMaps();
 
-    if (GetMaxDynamicBatchSize() > 1) {
+    if (GetMaxDynamicBatchSize() > 1 && !IsDynBatchSingleNetwork()) {
         int m_bv_sz = m_program->GetMaxBatchSizeForSingleProgram();
         for (int b = m_bv_sz - 1; b >= 0; b--) {
             auto network = BuildNetwork(m_program->getCompiledProgram(b));
@@ -83,7 +84,11 @@ void CLDNNGraph::Build() {
 }
 
 std::shared_ptr<cldnn::network> CLDNNGraph::BuildNetwork(std::shared_ptr<cldnn::program> program) {
-    auto network = std::make_shared<cldnn::network>(*program, m_stream_id);
+    std::shared_ptr<cldnn::network> network;
+    {
+        LoadTimeScope loadTimeScope(LoadTimePhase::MemoryAllocation);
+        network = std::make_shared<cldnn::network>(*program, m_stream_id);
+    }
 
     if (!m_config.graph_dumps_dir.empty() && m_stream_id == 0) {
         static int net_id = 0;
@@ -56,6 +56,8 @@ public:
     gpu::ClContext::Ptr GetContext() { return m_context; }
     std::shared_ptr<const cldnn::engine> GetEngine() const { return getContextImpl(m_context)->GetEngine(); }
     int GetMaxDynamicBatchSize() const { return getConfig().max_dynamic_batch; }
+    // Dynamic batch is served by one network compiled for the maximal batch
+    bool IsDynBatchSingleNetwork() const { return GetMaxDynamicBatchSize() > 1 && getConfig().dyn_batch_single_network; }
     const std::map<std::string, cldnn::layout>& GetInputLayouts() const { return m_program->getInputLayouts(); }
     size_t GetNetworksCount() const { return m_networks.size(); }
     std::shared_ptr<cldnn::network> GetNetwork(size_t idx = 0) const;
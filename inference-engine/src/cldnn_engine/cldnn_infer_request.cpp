@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cstring>
 #include <string>
 #include <map>
 #include <functional>
@@ -423,8 +424,11 @@ void CLDNNInferRequest::GetBlob(const char *name, Blob::Ptr &data) {
     if (is_input) {
         // ROI blob is returned only if it was set previously. Otherwise default blob is returned.
         auto it = _preProcData.find(name);
+        auto batched = batchedInputs.find(name);
         if (it != _preProcData.end()) {
             data = it->second->getRoiBlob();
+        } else if (batched != batchedInputs.end()) {
+            data = batched->second;
         } else {
             data = _inputs[name];
             checkInputBlob(data, name, foundInput);
@@ -475,6 +479,7 @@ void CLDNNInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
 
     if (is_input) {
         cldnn::primitive_id internalName(name);
+        batchedInputs.erase(name);
 
         if (is_remote) {
             auto inputMem = getBlobImpl(remote_ptr)->getMemory();
@@ -519,6 +524,13 @@ void CLDNNInferRequest::SetBlob(const char *name, const Blob::Ptr &data) {
                 _preProcData[name] = CreatePreprocDataHelper();
                 _preProcData[name]->isApplicable(data, _inputs[name]);
                 _preProcData[name]->setRoiBlob(data);
+            } else if (auto batched = as<BatchedBlob>(data)) {
+                if (m_graph->GetMaxDynamicBatchSize() > 1) {
+                    THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "cannot set batched blob with dynamic batch enabled";
+                }
+                // batch items are copied into the network input memory by PrepareBatchedInput
+                checkBatchedBlob(batched, foundInput);
+                batchedInputs[name] = batched;
             } else {
                 if (compoundBlobPassed) {
                     THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << cannot_set_compound;
@@ -701,6 +713,23 @@ void CLDNNInferRequest::SetBatch(int new_batch) {
     batchInputs.clear();
     batchOutputs.clear();
 
+    if (m_graph->IsDynBatchSingleNetwork()) {
+        // Inputs are passed with the maximal batch and only the first batches of outputs are copied
+        for (auto &input : m_graph->GetInputLayouts()) {
+            batchInputs[input.first] = { { 0, input.second.count() } };
+        }
+
+        for (auto& no : _networkOutputs) {
+            auto sz = m_graph->GetOutputSize(no.first);
+            sz.front() = static_cast<size_t>(new_batch);
+            size_t size = std::accumulate(std::begin(sz), std::end(sz), (size_t)1, std::multiplies<size_t>());
+            batchOutputs[no.first] = { { 0, size } };
+        }
+
+        m_curBatch = new_batch;
+        return;
+    }
+
     // tune expected inputs
     for (auto &input : m_graph->GetInputLayouts()) {
         cldnn::tensor dims = input.second.size;
@@ -794,6 +823,21 @@ void CLDNNInferRequest::execAndParse() {
 }
 
 void CLDNNInferRequest::execAndParseDyn() {
+    if (m_graph->IsDynBatchSingleNetwork()) {
+        auto network = m_graph->GetNetwork();
+        network->set_execution_batch(static_cast<uint32_t>(m_curBatch));
+        auto networkOutputs = network->execute();
+
+        for (auto& no : _networkOutputs) {
+            std::string outputID = m_graph->MapOutputName(no.first);
+            auto outputMemory = networkOutputs.at(outputID).get_memory();
+            Blob::Ptr bptr = _outputs[no.first];
+
+            copyOutputData(outputMemory, bptr, &batchOutputs[no.first][0]);
+        }
+        return;
+    }
+
     std::vector<std::map<cldnn::primitive_id, cldnn::network_output>> networkOutputs(m_graph->GetNetworksCount());
 
     // set up exection and put all graphs into driver queue
@@ -839,8 +883,11 @@ void CLDNNInferRequest::InferImpl() {
             PrepareInputDyn(name, *inputBlob);
         } else {
             auto nv12_ptr = inputBlob->as<NV12Blob>();
+            auto batched = batchedInputs.find(name);
 
-            if (nv12_ptr == nullptr) {
+            if (batched != batchedInputs.end()) {
+                PrepareBatchedInput(name, *batched->second);
+            } else if (nv12_ptr == nullptr) {
                 // regular blob
                 PrepareInput(name, *inputBlob);
             } else {
@@ -948,7 +995,39 @@ void CLDNNInferRequest::PrepareInput(const cldnn::primitive_id &inputName, const
     }
 }
 
+void CLDNNInferRequest::PrepareBatchedInput(const cldnn::primitive_id &inputName, const BatchedBlob &inputBlob) {
+    // Items are written directly into the network input memory one after another, so a batch of separately
+    // allocated images doesn't need to be gathered into one host blob before it is attached to the network
+    auto prec = inputBlob.getTensorDesc().getPrecision();
+    const bool toFloat = prec == Precision::I16 || prec == Precision::U16;
+    const cldnn::memory& memory = inputsMemory.at(toFloat ? inputName + fp32_suffix : inputName);
+    {
+        cldnn::pointer<uint8_t> ptr = memory.pointer<uint8_t>();
+        size_t offset = 0;
+        for (size_t i = 0; i < inputBlob.size(); i++) {
+            auto item = inputBlob.getBlob(i);
+            if (prec == Precision::I16) {
+                copyToFloat<int16_t>(reinterpret_cast<float*>(ptr.data()) + offset, item.get());
+                offset += item->size();
+            } else if (prec == Precision::U16) {
+                copyToFloat<uint16_t>(reinterpret_cast<float*>(ptr.data()) + offset, item.get());
+                offset += item->size();
+            } else {
+                std::memcpy(ptr.data() + offset, item->cbuffer().as<const uint8_t*>(), item->byteSize());
+                offset += item->byteSize();
+            }
+        }
+    }
+    m_graph->GetNetwork()->set_input_data("input:" + inputName, memory);
+}
+
 void CLDNNInferRequest::PrepareInputDyn(const cldnn::primitive_id &inputName, const Blob &inputBlob) {
+    if (m_graph->IsDynBatchSingleNetwork()) {
+        auto inputLayout = m_graph->GetInputLayouts().at(inputName);
+        copyInputData(m_graph->GetNetwork(), inputName, inputLayout, inputBlob, &batchInputs[inputName][0]);
+        return;
+    }
+
     // now try to get execution results
     for (unsigned nb = 0; nb < m_graph->GetNetworksCount(); nb++) {
         unsigned int mask = 1 << nb;
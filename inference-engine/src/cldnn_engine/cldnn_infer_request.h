@@ -59,6 +59,9 @@ protected:
     std::map<std::string, std::vector<buf_info>> batchOutputs;
     InferenceEngine::IStreamsExecutor* streamExecutor = nullptr;
 
+    // batched blobs set for inputs, their items are copied into the input memory at every inference
+    std::map<std::string, InferenceEngine::BatchedBlob::Ptr> batchedInputs;
+
     InferenceEngine::Blob::Ptr createInputBlob(const InferenceEngine::TensorDesc& desc, uint8_t* mem_ptr = nullptr);
     InferenceEngine::Blob::Ptr createOutputBlob(const InferenceEngine::TensorDesc& desc, uint8_t* mem_ptr = nullptr);
     void copyOutputData(const cldnn::memory& outputMemory, InferenceEngine::Blob::Ptr bptr, buf_info* bi = nullptr);
@@ -77,6 +80,7 @@ protected:
 
     void PrepareInput(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
     void PrepareInputDyn(const cldnn::primitive_id &inputName, const InferenceEngine::Blob &inputBlob);
+    void PrepareBatchedInput(const cldnn::primitive_id &inputName, const InferenceEngine::BatchedBlob &inputBlob);
 
 private:
     static const char fp32_suffix[];
@@ -72,6 +72,7 @@
 #include <cfloat>
 #include <algorithm>
 #include "cldnn_program.h"
+#include "ie_load_time_breakdown.hpp"
 #include "simple_math.h"
 #include <description_buffer.hpp>
 #include <cldnn/cldnn_config.hpp>
@@ -198,22 +199,36 @@ void convertArrayPrecision<Precision::FP32, Precision::FP16>(short* dst, const f
     InferenceEngine::PrecisionUtils::f32tof16Arrays(dst, src, nelem, 1.0f, 0.0f);
 }
 
+// Converted blobs keyed by the source data, so layers sharing weights (e.g. unrolled TensorIterator
+// iterations) keep sharing them after the conversion and are uploaded to the device once.
+// The source blob is held as well, so its address can't be reused by another blob during the pass
+using ConvertedBlobs = std::map<const void*, std::pair<Blob::Ptr, Blob::Ptr>>;
+
 template <Precision::ePrecision PREC_FROM, Precision::ePrecision PREC_TO>
-Blob::Ptr convertBlobPrecision(const Blob::Ptr& blob) {
+Blob::Ptr convertBlobPrecision(const Blob::Ptr& blob, ConvertedBlobs& converted) {
     using from_d_type = typename PrecisionTrait<PREC_FROM>::value_type;
     using to_d_type = typename PrecisionTrait<PREC_TO>::value_type;
 
     auto tensor_desc = blob->getTensorDesc();
+    const void* key = blob->cbuffer().as<const void*>();
+    auto it = converted.find(key);
+    if (it != converted.end()) {
+        const auto& known_desc = it->second.second->getTensorDesc();
+        if (known_desc.getDims() == tensor_desc.getDims() && known_desc.getLayout() == tensor_desc.getLayout())
+            return it->second.second;
+    }
+
     Blob::Ptr new_blob = make_shared_blob<to_d_type>(TensorDesc {PREC_TO, tensor_desc.getDims(), tensor_desc.getLayout()});
     new_blob->allocate();
     auto target = new_blob->buffer().as<to_d_type*>();
     auto source = blob->buffer().as<from_d_type*>();
     convertArrayPrecision<PREC_FROM, PREC_TO>(target, source, blob->size());
+    converted[key] = {blob, new_blob};
     return new_blob;
 }
 
 template <Precision::ePrecision PREC_FROM, Precision::ePrecision PREC_TO>
-void convertLayerPrecision(const CNNLayerPtr& layer, bool isOutput = false) {
+void convertLayerPrecision(const CNNLayerPtr& layer, ConvertedBlobs& converted, bool isOutput = false) {
     if (layer->type == "TensorIterator" && dynamic_cast<TensorIterator*>(layer.get()) != nullptr) {
         return;
     }
@@ -236,7 +251,7 @@ void convertLayerPrecision(const CNNLayerPtr& layer, bool isOutput = false) {
 
         if (CLDNNPlugin::Program::LayerTypeFromStr(prev_layer->type) == LayerType::ConstantBlob &&
             CLDNNPlugin::Program::LayerTypeFromStr(layer->type) != LayerType::Quantize) {
-            convertLayerPrecision<Precision::FP32, Precision::FP16>(prev_layer, false);
+            convertLayerPrecision<Precision::FP32, Precision::FP16>(prev_layer, converted, false);
         }
     }
 
@@ -246,10 +261,10 @@ void convertLayerPrecision(const CNNLayerPtr& layer, bool isOutput = false) {
     auto wLayer = dynamic_cast<InferenceEngine::WeightableLayer *>(layer.get());
     if (wLayer) {
         if (wLayer->_weights && wLayer->_weights->getTensorDesc().getPrecision() == PREC_FROM) {
-            wLayer->_weights = convertBlobPrecision<PREC_FROM, PREC_TO>(wLayer->_weights);
+            wLayer->_weights = convertBlobPrecision<PREC_FROM, PREC_TO>(wLayer->_weights, converted);
         }
         if (wLayer->_biases && wLayer->_biases->getTensorDesc().getPrecision() == PREC_FROM) {
-            wLayer->_biases = convertBlobPrecision<PREC_FROM, PREC_TO>(wLayer->_biases);
+            wLayer->_biases = convertBlobPrecision<PREC_FROM, PREC_TO>(wLayer->_biases, converted);
         }
     }
 
@@ -257,7 +272,7 @@ void convertLayerPrecision(const CNNLayerPtr& layer, bool isOutput = false) {
         auto &data = blob.second;
         if (nullptr != data) {
             if (data->getTensorDesc().getPrecision() == PREC_FROM) {
-                data = convertBlobPrecision<PREC_FROM, PREC_TO>(data);
+                data = convertBlobPrecision<PREC_FROM, PREC_TO>(data, converted);
             }
         }
     }
@@ -410,6 +425,7 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
     if (config.enableInt8) {
         if (fqFound && baselineIsFP16 && config.enable_fp16_for_quantized_models) {
             auto layersSorted = BFSSort(network);
+            ConvertedBlobs convertedBlobs;
 
             for (auto& layer : layersSorted) {
                 if (layer == nullptr)
@@ -464,7 +480,7 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
                 };
 
                 if (canReducePrecision(layer)) {
-                    convertLayerPrecision<Precision::FP32, Precision::FP16>(layer, GetNextLayers(layer).empty());
+                    convertLayerPrecision<Precision::FP32, Precision::FP16>(layer, convertedBlobs, GetNextLayers(layer).empty());
                 } else if (canReduceOutputPrecision(layer)) {
                     for (auto &out_data : layer->outData) {
                         if (out_data->getPrecision() == Precision::FP32)
@@ -486,7 +502,7 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
 
     m_max_batch = config.max_dynamic_batch;
 
-    if (config.max_dynamic_batch > 1) {
+    if (config.max_dynamic_batch > 1 && !config.dyn_batch_single_network) {
         for (int b = m_bv_sz - 1; b >= 0; b--) {
             inputLayouts.clear();
             outputDims.clear();
@@ -498,6 +514,8 @@ Program::Program(InferenceEngine::ICNNNetwork& network, std::shared_ptr<const cl
             m_engine->release_pending_memory(0);
         }
     } else {
+        if (config.max_dynamic_batch > 1)
+            changeInputBatch(config.max_dynamic_batch);
         m_programs.emplace_back(BuildProgram(network));
         m_engine->release_pending_memory(0);
     }
@@ -576,6 +594,7 @@ void Program::InitFormat(InferenceEngine::ICNNNetwork &network) {
 }
 
 std::shared_ptr<cldnn::program> Program::BuildProgram(InferenceEngine::ICNNNetwork &network) {
+    LoadTimeScope loadTimeScope(LoadTimePhase::GraphInit);
     cldnn::build_options options;
     if (!m_config.graph_dumps_dir.empty()) {
         options.set_option(cldnn::build_option::graph_dumps_dir(m_config.graph_dumps_dir));
@@ -669,6 +688,8 @@ std::shared_ptr<cldnn::program> Program::BuildProgram(InferenceEngine::ICNNNetwo
     // 5. profit
     p_currentOutputs.clear();
 
+    // clDNN optimizes the topology, reorders weights and compiles kernels while building the program
+    LoadTimeScope compilationScope(LoadTimePhase::KernelCompilation);
     return std::make_shared<cldnn::program>(*m_engine, topology, options);
 }
 
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <memory>
 #include "cldnn_remote_context.h"
 
@@ -23,11 +24,21 @@ CLDNNRemoteBlobImpl::CLDNNRemoteBlobImpl(ClContext::Ptr context,
     _handle(nullptr) {
 }
 
+CLDNNRemoteBlobImpl::~CLDNNRemoteBlobImpl() {
+    deallocate();
+}
+
 ParamMap CLDNNRemoteBlobImpl::getParams() const {
     assert(m_memObject != nullptr);
     auto params = m_memObject->get_internal_params();
 
     switch (m_mem_type) {
+    case BT_USM_HOST_INTERNAL:
+        return{
+            { GPU_PARAM_KEY(SHARED_MEM_TYPE), GPU_PARAM_VALUE(USM_HOST_BUFFER) },
+            { GPU_PARAM_KEY(OCL_CONTEXT), params.context },
+            { GPU_PARAM_KEY(MEM_HANDLE),  params.mem }
+        };
     case BT_BUF_INTERNAL:
     case BT_BUF_SHARED:
         return{
@@ -66,8 +77,16 @@ ParamMap CLDNNRemoteBlobImpl::getParams() const {
 }
 
 bool CLDNNRemoteBlobImpl::deallocate() noexcept {
-    if (m_memObject != nullptr)
+    if (m_memObject != nullptr) {
+        // host memory goes back to the context pool, so the next host blob skips allocation and pinning
+        auto context = m_context.lock();
+        if (m_mem_type == BT_USM_HOST_INTERNAL && context != nullptr && lockedHolder == nullptr) {
+            try {
+                getContextImpl(context)->ReleaseHostMemory(*m_memObject);
+            } catch (...) {}
+        }
         m_memObject.reset();
+    }
     return m_memObject == nullptr;
 }
 
@@ -89,6 +108,9 @@ void CLDNNRemoteBlobImpl::allocate_if_needed() {
         case BlobType::BT_BUF_INTERNAL:
             m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::allocate(*eng, m_layout)));
             break;
+        case BlobType::BT_USM_HOST_INTERNAL:
+            m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(_impl->AcquireHostMemory(m_layout)));
+            break;
         case BlobType::BT_BUF_SHARED:
             m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_buffer(*eng, m_layout, m_mem)));
             break;
@@ -118,12 +140,20 @@ void CLDNNRemoteBlobImpl::allocate_if_needed() {
 void CLDNNRemoteBlobImpl::allocate() noexcept {
     assert(m_memObject == nullptr);
 
-    std::shared_ptr<const cldnn::engine> eng = getContextImpl(m_context.lock())->GetEngine();
+    auto contextImpl = getContextImpl(m_context.lock());
+    std::shared_ptr<const cldnn::engine> eng = contextImpl->GetEngine();
 
     switch (m_mem_type) {
     case BlobType::BT_BUF_INTERNAL:
         m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::allocate(*eng, m_layout)));
         break;
+    case BlobType::BT_USM_HOST_INTERNAL:
+        try {
+            m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(contextImpl->AcquireHostMemory(m_layout)));
+        } catch (...) {
+            m_memObject = nullptr;
+        }
+        break;
     case BlobType::BT_BUF_SHARED:
         m_memObject = std::unique_ptr<cldnn::memory>(new cldnn::memory(cldnn::memory::share_buffer(*eng, m_layout, m_mem)));
         break;
@@ -256,14 +286,17 @@ CLDNNExecutionContextImpl::CLDNNExecutionContextImpl(const std::shared_ptr<IInfe
             m_config.dumpCustomKernels,
             std::string(),
             std::string(),
-            true,
+            m_config.parallel_branches,
             std::string(),
             m_config.sources_dumps_dir,
             m_config.queuePriority,
             m_config.queueThrottle,
             m_config.memory_pool_on,
             m_config.throughput_streams,
-            m_config.kernels_cache_dir));
+            m_config.kernels_cache_dir,
+            static_cast<uint64_t>(m_config.kernels_cache_max_size) * 1024 * 1024,
+            m_config.n_threads,
+            m_config.lazy_kernels_compilation));
 }
 
 ParamMap CLDNNExecutionContextImpl::getParams() const {
@@ -288,4 +321,29 @@ std::string CLDNNExecutionContextImpl::getDeviceName() const noexcept {
     return m_plugin.lock()->GetName();
 }
 
+cldnn::memory CLDNNExecutionContextImpl::AcquireHostMemory(const cldnn::layout& layout) {
+    {
+        std::lock_guard<std::mutex> guard(m_hostMemoryMutex);
+        auto found = std::find_if(m_hostMemoryPool.begin(), m_hostMemoryPool.end(),
+                                  [&](const cldnn::memory& memory) { return memory.get_layout() == layout; });
+        if (found != m_hostMemoryPool.end()) {
+            auto memory = *found;
+            m_hostMemoryPool.erase(found);
+            return memory;
+        }
+    }
+    // lockable memory preferred by the engine is USM host allocation when the device supports it
+    return cldnn::memory::allocate(*m_engine, layout);
+}
+
+void CLDNNExecutionContextImpl::ReleaseHostMemory(const cldnn::memory& memory) {
+    // the pool is bounded to keep memory of blobs with rare layouts from piling up
+    constexpr size_t maxPooledBuffers = 16;
+    std::lock_guard<std::mutex> guard(m_hostMemoryMutex);
+    m_hostMemoryPool.push_back(memory);
+    if (m_hostMemoryPool.size() > maxPooledBuffers) {
+        m_hostMemoryPool.erase(m_hostMemoryPool.begin());
+    }
+}
+
 };  // namespace CLDNNPlugin
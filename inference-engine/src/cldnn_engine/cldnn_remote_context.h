@@ -7,6 +7,8 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 #include <atomic>
 #include <ie_parameter.hpp>
 #include <cpp_interfaces/impl/ie_plugin_internal.hpp>
@@ -38,6 +40,7 @@ public:
         BT_IMG_SHARED,
         BT_SURF_SHARED,
         BT_DX_BUF_SHARED,
+        BT_USM_HOST_INTERNAL,
     };
 
     explicit CLDNNRemoteBlobImpl(gpu::ClContext::Ptr context,
@@ -47,6 +50,8 @@ public:
         uint32_t plane = 0,
         BlobType mem_type = BT_BUF_INTERNAL);
 
+    ~CLDNNRemoteBlobImpl();
+
     void allocate() noexcept;
     bool deallocate() noexcept;
     ParamMap getParams() const;
@@ -233,6 +238,16 @@ public:
         lock.clear(std::memory_order_release);
     }
 
+    /**
+    * @brief Returns host memory released by a destroyed host blob of the same layout or allocates a new one
+    */
+    cldnn::memory AcquireHostMemory(const cldnn::layout& layout);
+
+    /**
+    * @brief Keeps memory of a destroyed host blob for reuse by new host blobs
+    */
+    void ReleaseHostMemory(const cldnn::memory& memory);
+
 protected:
     std::shared_ptr<cldnn::engine> m_engine;
     gpu_handle_param m_va_display;
@@ -241,6 +256,9 @@ protected:
     ContextType m_type;
     std::weak_ptr<IInferencePlugin> m_plugin;
     std::atomic_flag lock;
+
+    std::mutex m_hostMemoryMutex;
+    std::vector<cldnn::memory> m_hostMemoryPool;
 };
 
 template<typename TpublicContextAPI>
@@ -353,7 +371,8 @@ class typedCLDNNExecutionContext : public TpublicContextAPI,
         return ret;
     }
 
-    RemoteBlob::Ptr create_buffer(const TensorDesc& tensorDesc) {
+    RemoteBlob::Ptr create_buffer(const TensorDesc& tensorDesc,
+        CLDNNRemoteBlobImpl::BlobType blob_type = CLDNNRemoteBlobImpl::BlobType::BT_BUF_INTERNAL) {
         cldnn::layout layout(DataTypeFromPrecision(tensorDesc.getPrecision()),
             FormatFromLayout(tensorDesc.getLayout()),
             CldnnTensorFromIEDims(tensorDesc.getDims()));
@@ -363,7 +382,7 @@ class typedCLDNNExecutionContext : public TpublicContextAPI,
             tensorDesc,
             layout,
             nullptr, 0, 0,
-            CLDNNRemoteBlobImpl::BlobType::BT_BUF_INTERNAL);
+            blob_type);
     }
 
     void check_if_shared() {
@@ -393,6 +412,8 @@ public:
             if (GPU_PARAM_VALUE(VA_SURFACE) == memTypeStr) {
                 check_if_shared();
                 return reuse_surf(tensorDesc, params);
+            } else if (GPU_PARAM_VALUE(USM_HOST_BUFFER) == memTypeStr) {
+                return create_buffer(tensorDesc, CLDNNRemoteBlobImpl::BlobType::BT_USM_HOST_INTERNAL);
             } else {
                 CLDNNRemoteBlobImpl::BlobType blob_type;
                 cldnn::shared_handle mem = nullptr;
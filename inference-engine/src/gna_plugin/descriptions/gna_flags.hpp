@@ -9,6 +9,7 @@
 namespace GNAPluginNS {
 struct GNAFlags {
     uint8_t gna_lib_async_threads_num = 1;
+    uint8_t gna_requests_num = 1;
 
     bool compact_mode = false;
     bool exclusive_async_requests = false;
@@ -17,5 +18,6 @@ struct GNAFlags {
     bool sw_fp32 = false;
     bool fake_quantized = false;
     bool performance_counting = false;
+    bool sequential_batch = false;
 };
 }  // namespace GNAPluginNS
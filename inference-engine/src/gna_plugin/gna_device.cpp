@@ -75,17 +75,29 @@ void GNADeviceHelper::propagateSync(const uint32_t requestConfigId, Gna2Accelera
     wait(propagate(requestConfigId, gna2AccelerationMode));
 }
 
+void GNADeviceHelper::setAccelerationMode(const uint32_t requestConfigId, Gna2AccelerationMode gna2AccelerationMode) {
+    std::unique_lock<std::mutex> lockRequests{ requestsSync };
+    auto boundMode = requestConfigsAccelerationMode.find(requestConfigId);
+    if (boundMode != requestConfigsAccelerationMode.end() && boundMode->second == gna2AccelerationMode) {
+        return;
+    }
+    const auto status = Gna2RequestConfigSetAccelerationMode(requestConfigId, gna2AccelerationMode);
+    checkGna2Status(status, "Gna2RequestConfigSetAccelerationMode");
+    requestConfigsAccelerationMode[requestConfigId] = gna2AccelerationMode;
+}
+
 uint32_t GNADeviceHelper::propagate(const uint32_t requestConfigId, Gna2AccelerationMode gna2AccelerationMode) {
     uint32_t reqId{};
     if (gna2AccelerationMode == Gna2AccelerationModeHardware &&
         detectedGnaDevVersion == Gna2DeviceVersionSoftwareEmulation) {
         gnawarn() << "GNA Device not detected, consider using other mode of acceleration";
     }
-    const auto status1 = Gna2RequestConfigSetAccelerationMode(requestConfigId, gna2AccelerationMode);
-    checkGna2Status(status1, "Gna2RequestConfigSetAccelerationMode");
-    const auto status2 = Gna2RequestEnqueue(requestConfigId, &reqId);
-    checkGna2Status(status2, "Gna2RequestEnqueue");
+    // mode is normally bound at request config creation, it changes only by SetConfig of executable network
+    setAccelerationMode(requestConfigId, gna2AccelerationMode);
+    const auto status = Gna2RequestEnqueue(requestConfigId, &reqId);
+    checkGna2Status(status, "Gna2RequestEnqueue");
 
+    std::unique_lock<std::mutex> lockRequests{ requestsSync };
     unwaitedRequestIds.insert(reqId);
 
     return reqId;
@@ -332,7 +344,10 @@ GnaWaitStatus GNADeviceHelper::wait(uint32_t reqId, int64_t millisTimeout) {
     if (status == Gna2StatusWarningDeviceBusy) {
         return GNA_REQUEST_PENDING;
     }
-    unwaitedRequestIds.erase(reqId);
+    {
+        std::unique_lock<std::mutex> lockRequests{ requestsSync };
+        unwaitedRequestIds.erase(reqId);
+    }
     if (status == Gna2StatusDriverQoSTimeoutExceeded) {
         return GNA_REQUEST_ABORTED;
     }
@@ -439,7 +454,11 @@ void GNADeviceHelper::close() {
     GNADeviceClose(nGNAHandle);
     nGNAHandle = 0;
 #else
-    auto requestsToClose = unwaitedRequestIds;
+    std::set<uint32_t> requestsToClose;
+    {
+        std::unique_lock<std::mutex> lockRequests{ requestsSync };
+        requestsToClose = unwaitedRequestIds;
+    }
     for (auto requestId : requestsToClose) {
         try {
             wait(requestId);
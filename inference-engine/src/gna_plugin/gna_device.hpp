@@ -63,6 +63,8 @@ class GNADeviceHelper {
     uint64_t instrumentationTotal[TotalGna2InstrumentationPoints] = {};
     uint32_t instrumentationConfigId = 0;
     std::set<uint32_t> unwaitedRequestIds;
+    std::map<uint32_t, Gna2AccelerationMode> requestConfigsAccelerationMode;
+    std::mutex requestsSync;
 #define MAX_TIMEOUT 500000
 #endif
     bool isPerformanceMeasuring = false;
@@ -113,6 +115,7 @@ public:
                        intel_gna_proc_t nGNAProcType);
 #else
     void setUpActiveList(unsigned req_config_id, uint32_t layerIndex, uint32_t* ptr_active_indices, uint32_t num_active_indices);
+    void setAccelerationMode(const uint32_t requestConfigId, Gna2AccelerationMode gna2AccelerationMode);
     void propagateSync(const uint32_t requestConfigId, Gna2AccelerationMode gna2AccelerationMode);
     uint32_t propagate(const uint32_t requestConfigId, Gna2AccelerationMode gna2AccelerationMode);
 #if GNA_LIB_VER == 2
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <ie_metric_helpers.hpp>
 #include "gna_infer_request.hpp"
 #include "gna_plugin.hpp"
 #include <gna/gna_config.hpp>
@@ -111,6 +112,9 @@ class GNAExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafe
     }
 
     InferenceEngine::Parameter GetMetric(const std::string& name) const override {
+        if (name == METRIC_KEY(LOAD_TIME_BREAKDOWN)) {
+            IE_SET_METRIC_RETURN(LOAD_TIME_BREAKDOWN, GetLoadTimeBreakdown());
+        }
         return plg->GetMetric(name, {});
     }
 };
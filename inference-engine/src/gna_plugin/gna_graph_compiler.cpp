@@ -62,16 +62,20 @@ void GNAGraphCompiler::setPolicy(GNAPluginNS::Policy policyToSet) {
     this->policy = policyToSet;
 }
 
-intel_dnn_component_t * GNAGraphCompiler::find_first_unused_input(InferenceEngine::CNNLayerPtr current) {
-    if (current->insData.empty())
-        return nullptr;
-    auto inData = current->insData.front().lock();
-    if (inData == nullptr)
-        return nullptr;
-
-    auto prev_layer = getCreatorLayer(inData).lock();
-
-    return dnnComponents.findComponent(prev_layer);
+void * GNAGraphCompiler::find_inplace_input(void *ptr_outputs) {
+    for (auto && component : dnnComponents.components) {
+        auto & dnnComponent = component.dnnComponent;
+        if (&dnnComponent.ptr_outputs != ptr_outputs) {
+            continue;
+        }
+        // activation reads each element before writing it, so output may overwrite input of the same width
+        if (dnnComponent.operation == kDnnPiecewiselinearOp &&
+            dnnComponent.num_bytes_per_input == dnnComponent.num_bytes_per_output) {
+            return &dnnComponent.ptr_inputs;
+        }
+        break;
+    }
+    return nullptr;
 }
 
 void GNAGraphCompiler::fillMemoryConnections(std::unordered_map<std::string,
@@ -1968,7 +1972,11 @@ void GNAGraphCompiler::connectOutput(InferenceEngine::CNNLayerPtr layer, void *p
                                              return it != concatItem.second.concatInputLayers.end();
                                          });
                     if (included == concat_connection.end()) {
-                        gnamem->reserve_ptr(&concatLayerInfoItem.gna_ptr, ALIGN64(concatLayerInfoItem.reserved_size), 64);
+                        if (gnaFlags->compact_mode) {
+                            gnamem->reserve_reusable_ptr(&concatLayerInfoItem.gna_ptr, ALIGN64(concatLayerInfoItem.reserved_size), 64);
+                        } else {
+                            gnamem->reserve_ptr(&concatLayerInfoItem.gna_ptr, ALIGN64(concatLayerInfoItem.reserved_size), 64);
+                        }
 
                         std::function<void(GNAConcatLayer, GNAPluginNS::InputDesc&, ConcatConnection&)> allocate_input_recursively =
                             [&allocate_input_recursively](GNAConcatLayer clayer, GNAPluginNS::InputDesc& inputDesc, ConcatConnection& concat_connection) {
@@ -2007,15 +2015,10 @@ void GNAGraphCompiler::connectOutput(InferenceEngine::CNNLayerPtr layer, void *p
         }
     }
 
-    intel_dnn_component_t * unused_input = nullptr;
+    // in compact mode memory of intermediate output is shared with other ones, not used at the same time
     if (gnaFlags->compact_mode) {
-        unused_input = find_first_unused_input(layer);
-        if (unused_input != nullptr) {
-            gnamem->bind_ptr(ptr, &unused_input->ptr_inputs, 0, ALIGN64(num_data_bytes_out));
-        }
-    }
-    // cannot reuse suitable input
-    if (unused_input == nullptr) {
+        gnamem->reserve_reusable_ptr(ptr, ALIGN64(num_data_bytes_out), 64, find_inplace_input(ptr));
+    } else {
         gnamem->reserve_ptr(ptr, ALIGN64(num_data_bytes_out), 64);
     }
 }
@@ -2061,11 +2064,15 @@ GNAPluginNS::ConnectionDetails GNAGraphCompiler::connectInput(CNNLayerPtr layer,
                     << ", and size_requested=" << num_data_bytes_in;
         }
 
+        // input is written before inference starts, so memory it is bound to is used during whole inference
+        auto layerExecOrder = gnamem->exec_order();
+        gnamem->set_exec_order(-1);
         if (connectTo) {
             gnamem->bind_ptr(ptr, &inputDesc->getPtrInputsGlobal(prevLayer->name).front(), offset, ALIGN(num_data_bytes_in, 64));
         } else {
             gnamem->bind_ptr(&inputDesc->getPtrInputsGlobal(prevLayer->name).front(), ptr, offset, ALIGN(num_data_bytes_in, 64));
         }
+        gnamem->set_exec_order(layerExecOrder);
 
         return prevLayer;
     }
@@ -2155,7 +2162,11 @@ GNAPluginNS::ConnectionDetails GNAGraphCompiler::connectInput(CNNLayerPtr layer,
                     THROW_GNA_LAYER_EXCEPTION(layer) <<" invalid allocation request of "
                                                      << num_data_bytes_in << " is more then state tensor size of: " << memorySize + offset;
                 }
+                // state keeps its data between inferences, so memory it is bound to is never shared
+                auto layerExecOrder = gnamem->exec_order();
+                gnamem->set_exec_order(-1);
                 gnamem->bind_ptr(&memoryLayer.gna_ptr, ptr, offset);
+                gnamem->set_exec_order(layerExecOrder);
             }
 
             memoryLayer.reserved_size = ALIGN64(memorySize);
@@ -44,7 +44,10 @@ private:
     CropConnection   crop_connection;
     ConstConnections const_connections;
 
-    intel_dnn_component_t * find_first_unused_input(InferenceEngine::CNNLayerPtr current);
+    /**
+     * @brief returns input pointer of component producing given output, if the output can be placed over its input
+     */
+    void * find_inplace_input(void *ptr_outputs);
 
     static void printTensorDesc(const std::string& name, const InferenceEngine::TensorDesc& desc);
     static void printConvolutionLayer(const InferenceEngine::ConvolutionLayer& layer);
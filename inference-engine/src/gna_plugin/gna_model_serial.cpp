@@ -270,6 +270,9 @@ void GNAModelSerial::Import(void *basePointer,
 
     // once structure has been read lets read whole gna graph
     is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    if (is.gcount() != static_cast<std::streamsize>(gnaGraphSize)) {
+        THROW_GNA_EXCEPTION << "Imported file is truncated: expected " << gnaGraphSize << " bytes of GNA memory, but read " << is.gcount();
+    }
 }
 
 
@@ -529,6 +532,9 @@ void GNAModelSerial::Import(void *basePointer,
 
     // once structure has been read lets read whole gna graph
     is.read(reinterpret_cast<char*>(basePointer), gnaGraphSize);
+    if (is.gcount() != static_cast<std::streamsize>(gnaGraphSize)) {
+        THROW_GNA_EXCEPTION << "Imported file is truncated: expected " << gnaGraphSize << " bytes of GNA memory, but read " << is.gcount();
+    }
 }
 
 /**
@@ -22,6 +22,7 @@
 #include <cpp_interfaces/exception2status.hpp>
 #include <legacy/net_pass.h>
 #include <debug.h>
+#include <ie_load_time_breakdown.hpp>
 #include <gna/gna_config.hpp>
 #include "gna_plugin_config.hpp"
 #include <legacy/ie_util_internal.hpp>
@@ -75,6 +76,7 @@ uint32_t ToByteSize(const Gna2DataType type) {
 
 constexpr uint32_t GNAPluginNS::GNAPlugin::FAKE_REQUEST_CONFIG_ID;
 #endif
+constexpr int32_t GNAPluginNS::GNAPlugin::REQUEST_RESERVED;
 using namespace InferenceEngine;
 using namespace std;
 using namespace GNAPluginNS;
@@ -434,9 +436,15 @@ void GNAPlugin::UpdateInputScaleFromNetwork(InferenceEngine::ICNNNetwork & netwo
 }
 
 void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
+    // legacy passes and quantization are measured as transformations
+    LoadTimeScope loadTimeScope(LoadTimePhase::Transformations);
     std::shared_ptr<InferenceEngine::details::CNNNetworkImpl> convertedNetwork;
     if (_network.getFunction()) {
-        std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(_network);
+        std::shared_ptr<ICNNNetwork> clonedNetwork;
+        {
+            LoadTimeScope cloningScope(LoadTimePhase::Cloning);
+            clonedNetwork = cloneNetwork(_network);
+        }
         const auto& graph = clonedNetwork->getFunction();
         // Disable shape inference (WA for generic operations)
         ngraph::op::GenericIE::DisableReshape noReshape(graph);
@@ -458,9 +466,30 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
                     return node->get_rt_info().count("UNROLL_TI") == 0;
             });
         manager.run_passes(graph);
+        LoadTimeScope legacyConversionScope(LoadTimePhase::LegacyConversion);
         convertedNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(graph, *clonedNetwork);
     }
-    InferenceEngine::ICNNNetwork &network = convertedNetwork ? *convertedNetwork : _network;
+    InferenceEngine::ICNNNetwork &sourceNetwork = convertedNetwork ? *convertedNetwork : _network;
+
+    // with sequential batch, network with memory layers is compiled for a single frame
+    // and frames of the batch go through it one by one, so the state is updated after every frame
+    CNNNetPtr singleFrameNetwork;
+    sequentialFrames = 1;
+    if (gnaFlags->sequential_batch && sourceNetwork.getBatchSize() > 1) {
+        auto starters = CNNNetGetAllInputLayers(sourceNetwork);
+        auto isStateful = std::any_of(starters.begin(), starters.end(), [](CNNLayerPtr layer) {
+            return LayerInfo(layer).isMemory();
+        });
+        if (isStateful) {
+            sequentialFrames = static_cast<uint32_t>(sourceNetwork.getBatchSize());
+            singleFrameNetwork = CNNNetCopy(sourceNetwork);
+            ResponseDesc resp;
+            if (singleFrameNetwork->setBatchSize(1, &resp) != OK) {
+                THROW_GNA_EXCEPTION << "Cannot compile network with memory layers for a single frame: " << resp.msg;
+            }
+        }
+    }
+    InferenceEngine::ICNNNetwork &network = singleFrameNetwork ? *singleFrameNetwork : sourceNetwork;
 
     NetPass::ConvertPrecision(network, Precision::I64, Precision::I32);
     NetPass::ConvertPrecision(network, Precision::U64, Precision::I32);
@@ -576,6 +605,7 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     });
 #endif
 
+    LoadTimeScope graphInitScope(LoadTimePhase::GraphInit);
     auto sortedNet = CNNNetSortTopologicallyEx(*newNet, make_fuzed_order);
 
     // passing policy to compiler
@@ -612,8 +642,11 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     // fill in extra storage with memory layers
     graphCompiler.fillMemoryConnections(memoryPairs);
 
+    // every library thread needs its own request configuration to be busy
+    gnaFlags->gna_requests_num = std::max(gnaFlags->gna_requests_num, gnaFlags->gna_lib_async_threads_num);
     if (!graphCompiler.memory_connection.empty()) {
         gnaFlags->gna_lib_async_threads_num = 1;
+        gnaFlags->gna_requests_num = 1;
     }
 
     if (gnaFlags->sw_fp32) {
@@ -636,13 +669,17 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     }
 
     for (auto && input : inputsDataMap) {
-        inputsDesc->getPtrInputsGlobal(input.first).resize(gnaFlags->gna_lib_async_threads_num);
+        inputsDesc->getPtrInputsGlobal(input.first).resize(gnaFlags->gna_requests_num);
     }
 
     // CreatingLayer primitives
-    for (auto & layer : sortedNoMem) {
+    for (size_t execOrder = 0; execOrder != sortedNoMem.size(); execOrder++) {
+        auto & layer = sortedNoMem[execOrder];
+        // delayed copies are executed after all other layers
+        gnamem->set_exec_order(LayerInfo(layer).isCopyDelayed() ? -1 : static_cast<int>(execOrder));
         graphCompiler.CreateLayerPrimitive(layer);
     }
+    gnamem->set_exec_order(-1);
     for (auto& inputLayer : inputLayers) {
         auto layerInfo = LayerInfo(inputLayer);
         if (layerInfo.isInput() && 0 == inputsDesc->bytes_allocated_for_input[inputLayer->name]) {
@@ -663,7 +700,7 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
         auto & desc = outputsDesc[idx];
         auto quantized = InferenceEngine::getInjectedData<QuantizedLayerParams>(layer);
 
-        desc.ptrs.resize(gnaFlags->gna_lib_async_threads_num);
+        desc.ptrs.resize(gnaFlags->gna_requests_num);
         desc.orientation = component.orientation_out;
         desc.num_bytes_per_element = component.num_bytes_per_output;
         desc.scale_factor = quantized != nullptr ? quantized->_dst_quant.GetScale() : 1.0f;
@@ -721,7 +758,7 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
                     auto &desc = outputsDesc[portId];
                     auto quantized = InferenceEngine::getInjectedData<QuantizedLayerParams>(layer);
 
-                    desc.ptrs.resize(gnaFlags->gna_lib_async_threads_num);
+                    desc.ptrs.resize(gnaFlags->gna_requests_num);
                     // TODO: what is orientation for concat
                     desc.orientation = kDnnInterleavedOrientation;
                     desc.num_bytes_per_element = layer->outData.front()->getPrecision().size();
@@ -752,11 +789,14 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
 
     // reserving more bytes for intermediate data in parallel case - TODO: this works incorrectly in compact mode at lest
     rwSegmentSize = gnamem->getRWBytes();
-    if (gnaFlags->gna_lib_async_threads_num > 1) {
-        gnamem->reserve_ptr(&pParallelExecutionData, gnamem->getRWBytes() * (gnaFlags->gna_lib_async_threads_num - 1), 64);
+    if (gnaFlags->gna_requests_num > 1) {
+        gnamem->reserve_ptr(&pParallelExecutionData, gnamem->getRWBytes() * (gnaFlags->gna_requests_num - 1), 64);
     }
 
-    gnamem->commit();
+    {
+        LoadTimeScope memoryAllocationScope(LoadTimePhase::MemoryAllocation);
+        gnamem->commit();
+    }
 
     dnn->Init(gnamem->getBasePtr(),
              gnamem->getTotalBytes(),
@@ -785,7 +825,7 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     }
 
     // creating same gna RW segment for parallel infer requests
-    for (int i = 1; i != gnaFlags->gna_lib_async_threads_num; i++) {
+    for (int i = 1; i != gnaFlags->gna_requests_num; i++) {
 #if GNA_LIB_VER == 2
         gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>()));
         // this can be improved by just copy all structures, but we are too lazy
@@ -889,7 +929,11 @@ void GNAPlugin::LoadNetwork(ICNNNetwork & _network) {
     dnn->WriteGraphWizModel("gna-blob.dot");
 #endif
 #if GNA_LIB_VER == 2
-    createRequestConfigsForGnaModels();
+    {
+        // GNA models are compiled for the device when request configurations are created
+        LoadTimeScope compilationScope(LoadTimePhase::KernelCompilation);
+        createRequestConfigsForGnaModels();
+    }
 #endif
 }
 
@@ -903,6 +947,8 @@ void GNAPlugin::createRequestConfigsForGnaModels() {
         auto& gnaNnet = std::get<0>(model).get()->obj;
         const auto modelId = gnadevice->createModel(gnaNnet);
         const auto requestConfigId = gnadevice->createRequestConfig(modelId);
+        // acceleration mode is bound once here, not on every propagate
+        gnadevice->setAccelerationMode(requestConfigId, config.pluginGna2AccMode);
         gnaRequestConfigToRequestIdMap.push_back(std::make_tuple(requestConfigId, -1, InferenceEngine::BlobMap()));
     }
 }
@@ -992,26 +1038,80 @@ void RotateFeatures(uint8_t *ptr_feat,
 }
 
 uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &result) {
+    if (sequentialFrames == 1) {
+        return QueueFrame(inputs, result);
+    }
+
+    // state of the network is updated by every frame, so each next frame waits for the previous one,
+    // the last frame is left running to be completed by Wait() as usual
+    for (uint32_t frame = 0; frame + 1 < sequentialFrames; frame++) {
+        auto frameResult = FrameBlobs(result, frame);
+        if (!Wait(QueueFrame(FrameBlobs(inputs, frame), frameResult))) {
+            THROW_GNA_EXCEPTION << "Inference of frame " << frame << " of sequential batch was aborted";
+        }
+    }
+    auto frameResult = FrameBlobs(result, sequentialFrames - 1);
+    return QueueFrame(FrameBlobs(inputs, sequentialFrames - 1), frameResult);
+}
+
+BlobMap GNAPlugin::FrameBlobs(const InferenceEngine::BlobMap &blobs, uint32_t frame) const {
+    BlobMap frameBlobs;
+    for (auto &&blob : blobs) {
+        const auto &desc = blob.second->getTensorDesc();
+        auto dims = desc.getDims();
+        if ((desc.getLayout() != Layout::NC && desc.getLayout() != Layout::NCHW) || dims[0] != sequentialFrames) {
+            THROW_GNA_EXCEPTION << "Expected blob " << blob.first << " of sequential batch to have Layout::NC or Layout::NCHW with "
+                                << sequentialFrames << " frames, but was: " << desc.getLayout() << " " << dims;
+        }
+        dims[0] = 1;
+        auto frameBytes = blob.second->byteSize() / sequentialFrames;
+        frameBlobs[blob.first] = make_blob_with_precision(TensorDesc(desc.getPrecision(), dims, desc.getLayout()),
+                                                          blob.second->buffer().as<uint8_t *>() + frame * frameBytes);
+    }
+    return frameBlobs;
+}
+
+uint32_t GNAPlugin::QueueFrame(const InferenceEngine::BlobMap &inputs, InferenceEngine::BlobMap &result) {
 #if GNA_LIB_VER == 2
     auto& nnets = gnaRequestConfigToRequestIdMap;
 #endif
-    auto freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
-        return std::get<1>(item) == -1;
-    });
+    auto freeNnet = std::end(nnets);
+    {
+        // infer requests are started from different threads, so the slot is reserved before its buffers are filled
+        std::lock_guard<std::mutex> lock(requestsSync);
+        freeNnet = std::find_if(std::begin(nnets), std::end(nnets), [](decltype(nnets.front()) & item) {
+            return std::get<1>(item) == -1;
+        });
+        if (freeNnet != nnets.end()) {
+            std::get<1>(*freeNnet) = REQUEST_RESERVED;
+        }
+    }
 
     if (freeNnet == nnets.end()) {
         if (!graphCompiler.memory_connection.empty()) {
             Wait(0);
             freeNnet = nnets.begin();
+            std::get<1>(*freeNnet) = REQUEST_RESERVED;
         } else {
             THROW_IE_EXCEPTION << as_status << REQUEST_BUSY
                                << "GNA executable network has max of "
-                               << static_cast<uint32_t >(gnaFlags->gna_lib_async_threads_num)
+                               << static_cast<uint32_t >(gnaFlags->gna_requests_num)
                                << " parallel infer requests, please sync one of already running";
         }
     }
 
+    // returns the slot back to the pool if inputs import or propagation throws
+    struct ReservedSlotGuard {
+        decltype(std::get<1>(*freeNnet)) requestId;
+        ~ReservedSlotGuard() {
+            if (requestId == REQUEST_RESERVED) {
+                requestId = -1;
+            }
+        }
+    } reservedSlotGuard{std::get<1>(*freeNnet)};
+
     auto idx = static_cast<uint32_t>(std::distance(std::begin(nnets), freeNnet));
+    std::get<2>(*freeNnet) = result;
 
     int inputNum = 0;
     for (auto &input : inputs) {
@@ -1099,9 +1199,7 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     if (!gnadevice) {
         auto runtime = runtime::FP(dnn);
         runtime.infer();
-        if (freeNnet != nnets.end()) {
-            std::get<1>(*freeNnet) = 1;
-        }
+        std::get<1>(*freeNnet) = 1;
     } else {
 #if GNA_LIB_VER == 1
         auto nnet = std::get<0>(*freeNnet).get();
@@ -1121,10 +1219,6 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap &inputs, Infer
     }
     dnn_dump_write_index++;
 #endif
-    if (freeNnet != nnets.end()) {
-        // TODO: GNA2: Substitute properly when using GNA 2.0 Library setting and CPU
-        std::get<2>(*freeNnet) = result;
-    }
     return idx;
 }
 
@@ -1152,7 +1246,13 @@ GnaWaitStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
         }
     }
 
-    std::get<1>(nnets[request_idx]) = -1;
+    // slot goes back to the pool only after outputs are exported, otherwise the next queued request could overwrite them
+    struct CompletedSlotGuard {
+        decltype(std::get<1>(nnets[request_idx])) requestId;
+        ~CompletedSlotGuard() {
+            requestId = -1;
+        }
+    } completedSlotGuard{std::get<1>(nnets[request_idx])};
     auto &request = std::get<2>(nnets[request_idx]);
 #ifdef PLOT
     if (dnn->num_components() != 0) {
@@ -1284,6 +1384,7 @@ Blob::Ptr GNAPlugin::GetOutputBlob(const std::string& name, InferenceEngine::Pre
     // need to have intermediate blob for interleave conversion
     InferenceEngine::Blob::Ptr outputBlob;
     auto outputDims = outputsDataMap[name]->getTensorDesc().getDims();
+    outputDims[0] *= sequentialFrames;
     outputBlob = make_blob_with_precision(TensorDesc(precision, outputDims, outputDims.size() == 2 ? NC : (outputDims.size() == 3 ? CHW : NCHW)));
     outputBlob->allocate();
     return outputBlob;
@@ -1294,6 +1395,7 @@ Blob::Ptr GNAPlugin::GetInputBlob(const std::string& name, InferenceEngine::Prec
     // need to have intermediate blob for interleave conversion
     // TODO: NCHW format support is experimental = c++ MO did insert reshape, while TF mo - not
     auto inputDims = inputsDataMap[name]->getTensorDesc().getDims();
+    inputDims[0] *= sequentialFrames;
     inputBlob = make_blob_with_precision(TensorDesc(precision, inputDims, inputDims.size() == 2 ? NC : (inputDims.size() == 3 ? CHW : NCHW)));
     inputBlob->allocate();
     return inputBlob;
@@ -1324,9 +1426,15 @@ InferenceEngine::ExecutableNetwork GNAPlugin::ImportNetwork(std::istream& networ
     InitGNADevice();
 
     graphCompiler.setGNAMemoryPtr(gnamem);
+    // imported model has single copy of input, output and intermediate buffers
+    gnaFlags->gna_requests_num = 1;
     void *basePtr = nullptr;
     gnamem->reserve_ptr(&basePtr, header.gnaMemSize);
-    gnamem->commit();
+    // whole model region is read from the stream right into GNA memory, only alignment tail needs clearing
+    gnamem->commit(false);
+    auto heapEnd = reinterpret_cast<uint8_t *>(gnamem->getBasePtr()) + gnamem->getTotalBytes();
+    auto modelEnd = reinterpret_cast<uint8_t *>(basePtr) + header.gnaMemSize;
+    std::fill(modelEnd, heapEnd, 0);
 #if GNA_LIB_VER == 2
     gnaModels.push_back(std::make_tuple(make_shared<CPPWrapper<Gna2Model>>(header.layersCount)));
 #else
@@ -12,6 +12,7 @@
 #include <memory>
 #include <vector>
 #include <tuple>
+#include <mutex>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include "cpp_interfaces/impl/ie_variable_state_internal.hpp"
 #include "descriptions/gna_flags.hpp"
@@ -51,6 +52,11 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
     std::vector<std::tuple<dnn_ptr>> gnaModels;
     std::vector<std::tuple<uint32_t, int64_t, InferenceEngine::BlobMap>> gnaRequestConfigToRequestIdMap;
 #endif
+    /**
+     * @brief - marks request slot taken by infer request whose inputs are not yet queued to GNA
+     */
+    static constexpr int32_t REQUEST_RESERVED = -2;
+    std::mutex requestsSync;
 
 #if GNA_LIB_VER == 2
     uint32_t activeLayerIndex = 0xffffffff;
@@ -79,11 +85,21 @@ class GNAPlugin : public InferenceEngine::IInferencePlugin {
 
     static int GetDeviceVersionFromString(const std::string deviceString);
 
+    uint32_t QueueFrame(const InferenceEngine::BlobMap &input, InferenceEngine::BlobMap &result);
+    /**
+     * @brief views of blobs of sequential batch request on single frame
+     */
+    InferenceEngine::BlobMap FrameBlobs(const InferenceEngine::BlobMap &blobs, uint32_t frame) const;
+
     std::shared_ptr<GNADeviceHelper> gnadevice;
     /**
      * @brief size of RW segment without extra memory for parallel execution
      */
     uint32_t rwSegmentSize = 0;
+    /**
+     * @brief number of frames inferred one by one by a single request of network compiled for one frame
+     */
+    uint32_t sequentialFrames = 1;
 
     InferenceEngine::InputsDataMap inputsDataMap;
     InferenceEngine::OutputsDataMap outputsDataMap;
@@ -182,6 +182,31 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                                     << ", should be greater than 0 and less than 127";
             }
             gnaFlags.gna_lib_async_threads_num = lib_threads;
+        } else if (key == GNA_CONFIG_KEY(REQUESTS_NUM)) {
+            uint64_t requests_num;
+            try {
+                requests_num = std::stoul(value);
+                if (requests_num == 0 || requests_num > (std::numeric_limits<uint8_t>::max()+1) / 2 - 1) {
+                    throw std::out_of_range("");
+                }
+            } catch (std::invalid_argument&) {
+                THROW_GNA_EXCEPTION << "Invalid value of number of requests";
+            } catch (std::out_of_range&) {
+                log << "Unsupported number of GNA requests: " << value
+                    << ", should be greater than 0 and less than 127";
+                THROW_GNA_EXCEPTION << "Unsupported number of GNA requests: " << value
+                                    << ", should be greater than 0 and less than 127";
+            }
+            gnaFlags.gna_requests_num = requests_num;
+        } else if (key == GNA_CONFIG_KEY(SEQUENTIAL_BATCH)) {
+            if (value == PluginConfigParams::YES) {
+                gnaFlags.sequential_batch = true;
+            } else if (value == PluginConfigParams::NO) {
+                gnaFlags.sequential_batch = false;
+            } else {
+                log << "GNA sequential batch should be YES/NO, but not " << value;
+                THROW_GNA_EXCEPTION << "GNA sequential batch should be YES/NO, but not " << value;
+            }
         } else if (key == CONFIG_KEY(SINGLE_THREAD)) {
             if (value == PluginConfigParams::YES) {
                 gnaFlags.gna_openmp_multithreading = false;
@@ -196,7 +221,7 @@ void Config::UpdateFromMap(const std::map<std::string, std::string>& config) {
                                 << " not supported";
         }
 
-        if (gnaFlags.sw_fp32 && gnaFlags.gna_lib_async_threads_num > 1) {
+        if (gnaFlags.sw_fp32 && (gnaFlags.gna_lib_async_threads_num > 1 || gnaFlags.gna_requests_num > 1)) {
             THROW_GNA_EXCEPTION << "GNA plugin does not support async mode on GNA_SW_FP32!";
         }
     }
@@ -253,6 +278,9 @@ void Config::AdjustKeyMapValues() {
     key_config_map[CONFIG_KEY(PERF_COUNT)] =
             gnaFlags.performance_counting ? PluginConfigParams::YES: PluginConfigParams::NO;
     key_config_map[GNA_CONFIG_KEY(LIB_N_THREADS)] = std::to_string(gnaFlags.gna_lib_async_threads_num);
+    key_config_map[GNA_CONFIG_KEY(REQUESTS_NUM)] = std::to_string(gnaFlags.gna_requests_num);
+    key_config_map[GNA_CONFIG_KEY(SEQUENTIAL_BATCH)] =
+            gnaFlags.sequential_batch ? PluginConfigParams::YES: PluginConfigParams::NO;
     key_config_map[CONFIG_KEY(SINGLE_THREAD)] =
             gnaFlags.gna_openmp_multithreading ? PluginConfigParams::NO: PluginConfigParams::YES;
 }
@@ -25,9 +25,13 @@ Parameter GNAPlugin::GetMetric(const std::string& name, const std::map<std::stri
         {METRIC_KEY(AVAILABLE_DEVICES), [this]() {return GetAvailableDevices();}},
         {METRIC_KEY(SUPPORTED_CONFIG_KEYS), [this]() {return config.GetSupportedKeys();}},
         {METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS), [this]() {
-            uint32_t nireq = 1;
+            uint32_t nireq = gnaFlags->gna_requests_num;
             return nireq;
         }},
+        {GNA_METRIC_KEY(MEMORY_FOOTPRINT), [this]() {
+            uint64_t footprint = gnamem ? gnamem->getTotalBytes() : 0;
+            return footprint;
+        }},
         {METRIC_KEY(FULL_DEVICE_NAME), [&options, this]() {
             auto availableDevices = GetAvailableDevices().as<std::vector<std::string>>();
 
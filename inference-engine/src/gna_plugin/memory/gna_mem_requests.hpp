@@ -40,6 +40,11 @@ struct MemRequest {
     size_t _offset = 0;
     // expansion in bytes due to large depended layers
     size_t _padding = 0;
+    // execution order index of layer that submitted request, negative if memory is used during whole inference
+    int _exec_order = -1;
+    // allocation may share memory with other reusable allocations, if layers never use them at the same time,
+    // _ptr_in optionally points to memory the allocation can be placed over, if it is not used by later layers
+    bool _reusable = false;
     MemRequest(rRegion region,
                 rType req,
                 void *ptr_out,
@@ -27,11 +27,11 @@ public:
      * @param alignment
      */
     void push_initializer(void *ptr_out, size_t num_bytes, std::function<void(void * data, size_t size)> initializer, size_t alignment = 1) {
-        futureHeap().push_back({regionType(), ptr_out, num_bytes, initializer, REQUEST_INITIALIZER, alignment});
+        push({regionType(), ptr_out, num_bytes, initializer, REQUEST_INITIALIZER, alignment});
     }
 
     void push_ptr(void *ptr_out, const void *ptr_in, size_t num_bytes, size_t alignment = 1) {
-        futureHeap().push_back({regionType(), REQUEST_STORE, ptr_out, ptr_in, 1, num_bytes, alignment});
+        push({regionType(), REQUEST_STORE, ptr_out, ptr_in, 1, num_bytes, alignment});
     }
 
     /**
@@ -43,7 +43,7 @@ public:
     void push_local_ptr(void *ptr_out, const void *ptr_in, size_t num_bytes, size_t alignment = 1) {
         localStorage().emplace_back(reinterpret_cast<const uint8_t *>(ptr_in),
                                     reinterpret_cast<const uint8_t *>(ptr_in) + num_bytes);
-        futureHeap().push_back({regionType(), REQUEST_STORE, ptr_out, &localStorage().back().front(), 1, num_bytes, alignment});
+        push({regionType(), REQUEST_STORE, ptr_out, &localStorage().back().front(), 1, num_bytes, alignment});
     }
 
     /**
@@ -52,7 +52,20 @@ public:
      * @param num_bytes
      */
     void reserve_ptr(void *ptr_out, size_t num_bytes, size_t alignment = 1)  {
-        futureHeap().push_back({regionType(), REQUEST_ALLOCATE, ptr_out, nullptr, 1, num_bytes, alignment});
+        push({regionType(), REQUEST_ALLOCATE, ptr_out, nullptr, 1, num_bytes, alignment});
+    }
+
+    /**
+     * @brief reserves memory which is used only by layers within its life time, so that it can share memory
+     * with other reusable allocations, which life times do not intersect with its own
+     * @param ptr_out
+     * @param num_bytes
+     * @param alignment
+     * @param inplace_source - memory to place allocation over, if it is not used after current layer
+     */
+    void reserve_reusable_ptr(void *ptr_out, size_t num_bytes, size_t alignment = 1, const void *inplace_source = nullptr) {
+        push({regionType(), REQUEST_ALLOCATE, ptr_out, inplace_source, 1, num_bytes, alignment});
+        futureHeap().back()._reusable = true;
     }
 
     /**
@@ -64,7 +77,7 @@ public:
      *      if that happens - reserved request parameters will be updated before committing memory
      */
     void bind_ptr(void *source, const void *dest, size_t offset = 0, size_t num_bytes = 0)  {
-        futureHeap().push_back({regionType(), REQUEST_BIND, source, dest, 1, num_bytes, 1, offset});
+        push({regionType(), REQUEST_BIND, source, dest, 1, num_bytes, 1, offset});
     }
 
     /**
@@ -73,7 +86,7 @@ public:
      * @param initializer - initialisation routine to be called on allocated memory
      */
     void bind_initializer(void *ptr_out, std::function<void(void * data, size_t size)> initializer)  {
-        futureHeap().push_back({regionType(), ptr_out, 0, initializer, REQUEST_BIND, 1});
+        push({regionType(), ptr_out, 0, initializer, REQUEST_BIND, 1});
     }
 
     /**
@@ -81,7 +94,20 @@ public:
      */
     template<class T>
     void push_value(void *ptr_out, T value, size_t num_elements, size_t alignment = 1) {
-        futureHeap().push_back({regionType(), ptr_out, value, num_elements, alignment});
+        push({regionType(), ptr_out, value, num_elements, alignment});
+    }
+
+    /**
+     * @brief sets execution order index of layer, which memory requests are submitted next,
+     * life time of memory is a range of indexes of layers using it
+     * @param order - negative value means memory is used during whole inference, ex. network inputs or states
+     */
+    void set_exec_order(int order) {
+        execOrder() = order;
+    }
+
+    int exec_order() {
+        return execOrder();
     }
 
     /**
@@ -90,6 +116,13 @@ public:
     virtual rRegion regionType() const = 0;
     virtual std::vector<MemRequest> & futureHeap()  = 0;
     virtual std::list<std::vector<char>> &localStorage() = 0;
+    virtual int &execOrder() = 0;
+
+ private:
+    void push(MemRequest && request) {
+        request._exec_order = execOrder();
+        futureHeap().push_back(std::move(request));
+    }
 };
 }  // namespace memory
 }  // namespace GNAPluginNS
@@ -13,6 +13,9 @@
 #include <list>
 #include <algorithm>
 #include <functional>
+#include <numeric>
+#include <unordered_map>
+#include <memory_solver.hpp>
 #include "gna_lib_ver_selector.hpp"
 
 namespace GNAPluginNS {
@@ -29,6 +32,10 @@ class GNAMemory : public GNAMemRequestsQueue {
     size_t _total = 0;
     size_t _rw_section_size = 0;
     size_t _ro_section_size = 0;
+    // reusable allocations occupy beginning of read/write section, offsets are indexed by request position
+    size_t _reusable_section_size = 0;
+    std::unordered_map<size_t, size_t> _reusable_offsets;
+    int _exec_order = -1;
     Allocator _allocator;
     std::shared_ptr<uint8_t> heap;
     size_t _page_alignment = 1;
@@ -47,6 +54,9 @@ class GNAMemory : public GNAMemRequestsQueue {
         std::list<std::vector<char>> &localStorage() override {
             return _that.get().localStorage();
         }
+        int &execOrder() override {
+            return _that.get().execOrder();
+        }
     };
 
     GNAMemRequestsReadOnlyQueue readOnlyFrontEnd;
@@ -64,8 +74,9 @@ class GNAMemory : public GNAMemRequestsQueue {
 
     /**
      * @brief calculates size required for all requests, allocates memory and updates pointers
+     * @param zeroFill - whether allocated memory is cleared, could be skipped if caller overwrites whole heap anyway
      */
-    void commit() {
+    void commit(bool zeroFill = true) {
         // 1st stage -- looking for expandable bind requests:
         for (auto &originated : _future_heap) {
             if (originated._type & REQUEST_BIND) continue;
@@ -88,17 +99,19 @@ class GNAMemory : public GNAMemRequestsQueue {
         _total = _rw_section_size + _ro_section_size;
 
         // allocation with memory setting to 0 internally
-        heap = allocate(_total);
+        heap = allocate(_total, zeroFill);
         auto setupOffsets = [&](std::function<bool(MemRequest & request)> filter, size_t offset) {
             for (auto &re : _future_heap) {
                 if (re._type == REQUEST_BIND) continue;
                 if (filter(re)) continue;
 
                 auto sz = re._element_size * re._num_elements;
+                auto reusable = _reusable_offsets.find(&re - &_future_heap.front());
+                auto re_offset = reusable != _reusable_offsets.end() ? reusable->second : offset;
 
                 if (re._ptr_out != nullptr) {
-                    auto cptr = heap.get() + offset;
-                    size_t cptr_avail_size = _total - offset;
+                    auto cptr = heap.get() + re_offset;
+                    size_t cptr_avail_size = _total - re_offset;
                     if (re._type & REQUEST_BIND) {
                         cptr = reinterpret_cast<uint8_t*>(*reinterpret_cast<void **>(re._ptr_out));
                         cptr_avail_size = sz;
@@ -135,7 +148,7 @@ class GNAMemory : public GNAMemRequestsQueue {
                         }
                     }
                 }
-                if (!(re._type & REQUEST_BIND)) {
+                if (!(re._type & REQUEST_BIND) && reusable == _reusable_offsets.end()) {
                     offset += ALIGN(sz + re._padding, re._alignment);
                 }
             }
@@ -144,7 +157,7 @@ class GNAMemory : public GNAMemRequestsQueue {
         setupOffsets([](GNAPluginNS::memory::MemRequest & request) {
             // TODO: consume bind requests separately from storage type
             return !(request._type & REQUEST_BIND) && (request._region != REGION_RW);
-        }, 0);
+        }, _reusable_section_size);
 
         setupOffsets([](GNAPluginNS::memory::MemRequest & request) {
             return (request._type & REQUEST_BIND) || request._region != REGION_RO;
@@ -165,6 +178,14 @@ class GNAMemory : public GNAMemRequestsQueue {
         return _total;
     }
 
+    /**
+     * @brief size of read/write memory shared by reusable allocations
+     */
+    size_t getReusableBytes() {
+        updateSectionsSizes();
+        return _reusable_section_size;
+    }
+
  protected:
     rRegion regionType() const override {
         return REGION_RW;
@@ -175,6 +196,9 @@ class GNAMemory : public GNAMemRequestsQueue {
     std::list<std::vector<char>> &localStorage() override {
         return _local_storage;
     }
+    int &execOrder() override {
+        return _exec_order;
+    }
 
     template<class T>
     void iterate_binded(GNAPluginNS::memory::MemRequest & reference, const T & visitor) {
@@ -191,18 +215,22 @@ class GNAMemory : public GNAMemRequestsQueue {
     }
 
 
-    std::shared_ptr<uint8_t> allocate(size_t bytes) {
+    std::shared_ptr<uint8_t> allocate(size_t bytes, bool zeroFill = true) {
         std::shared_ptr<uint8_t> sp(_allocator.allocate(bytes), [=](uint8_t *p) {
             _allocator.deallocate(p, bytes);
         });
-        std::fill(sp.get(), sp.get() + bytes, 0);
+        if (zeroFill) {
+            std::fill(sp.get(), sp.get() + bytes, 0);
+        }
         return sp;
     }
 
  protected:
     void updateSectionsSizes() {
+        planReusableSection();
+
         // count total size and size of read/write regions
-        _rw_section_size = 0;
+        _rw_section_size = _reusable_section_size;
         _ro_section_size = 0;
         for (auto &re : _future_heap) {
             auto current = ALIGN(re._num_elements * re._element_size + re._padding, re._alignment);
@@ -216,6 +244,7 @@ class GNAMemory : public GNAMemRequestsQueue {
                     re._alignment << std::endl;
 #endif
             if (re._type == REQUEST_BIND) continue;
+            if (_reusable_offsets.count(&re - &_future_heap.front())) continue;
 
             if (re._region == REGION_RW) {
                 _rw_section_size += current;
@@ -226,6 +255,111 @@ class GNAMemory : public GNAMemRequestsQueue {
         _rw_section_size = ALIGN(_rw_section_size, _page_alignment);
         _ro_section_size = ALIGN(_ro_section_size, _page_alignment);
     }
+
+    /**
+     * @brief places reusable allocations at beginning of read/write section, so that allocations used by the same layer
+     * do not intersect. Life time of allocation spans layers using it directly or via binded pointers
+     */
+    void planReusableSection() {
+        _reusable_offsets.clear();
+        _reusable_section_size = 0;
+
+        std::vector<size_t> reusable;
+        size_t alignment = 1;
+        for (size_t i = 0; i != _future_heap.size(); i++) {
+            auto &re = _future_heap[i];
+            if (re._reusable && re._type == REQUEST_ALLOCATE && re._region == REGION_RW) {
+                reusable.push_back(i);
+                alignment = std::max(alignment, re._alignment);
+            }
+        }
+        if (reusable.empty()) {
+            return;
+        }
+
+        // box ids are indexes of groups - allocations placed over each other
+        std::vector<MemorySolver::Box> lifeTimes(reusable.size());
+        for (size_t i = 0; i != reusable.size(); i++) {
+            auto &re = _future_heap[reusable[i]];
+            auto &life = lifeTimes[i];
+            life = {re._exec_order, re._exec_order,
+                    static_cast<int64_t>(ALIGN(re._num_elements * re._element_size + re._padding, re._alignment)),
+                    static_cast<int64_t>(i)};
+            // memory initialized at commit keeps its data between inferences, so it is never shared
+            bool wholeInference = re._exec_order < 0;
+            iterate_binded(re, [&](MemRequest &, MemRequest & binded) {
+                wholeInference |= binded._exec_order < 0 || binded._type != REQUEST_BIND;
+                life.start = std::min(life.start, binded._exec_order);
+                life.finish = std::max(life.finish, binded._exec_order);
+            });
+            if (wholeInference) {
+                life.start = 0;
+                life.finish = -1;
+            }
+        }
+
+        // allocation is placed over its inplace source, if the source is released by layer producing the allocation
+        std::vector<size_t> order(reusable.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            return lifeTimes[l].start < lifeTimes[r].start;
+        });
+        std::vector<MemorySolver::Box> groups = lifeTimes;
+        for (auto i : order) {
+            auto &life = lifeTimes[i];
+            auto source = findOrigin(_future_heap[reusable[i]]._ptr_in);
+            auto sourceIt = std::find(reusable.begin(), reusable.end(), source);
+            if (life.finish < 0 || sourceIt == reusable.end()) {
+                continue;
+            }
+            auto &group = groups[lifeTimes[sourceIt - reusable.begin()].id];
+            if (group.finish == life.start && group.size >= life.size) {
+                life.id = group.id;
+                group.finish = life.finish;
+            }
+        }
+
+        std::vector<MemorySolver::Box> boxes;
+        for (size_t i = 0; i != groups.size(); i++) {
+            if (lifeTimes[i].id != static_cast<int64_t>(i)) {
+                continue;
+            }
+            auto box = groups[i];
+            // activation is executed by GNA together with preceding layer, so its output is written one layer earlier
+            box.start = std::max(0, box.start - 1);
+            box.size = (box.size + alignment - 1) / alignment;
+            boxes.push_back(box);
+        }
+
+        MemorySolver solver(boxes);
+        _reusable_section_size = static_cast<size_t>(solver.solve()) * alignment;
+        for (size_t i = 0; i != reusable.size(); i++) {
+            _reusable_offsets[reusable[i]] = static_cast<size_t>(solver.getOffset(lifeTimes[i].id)) * alignment;
+        }
+    }
+
+    /**
+     * @brief finds index of not binded request, which memory starts at ptr, directly or via binded pointers
+     */
+    size_t findOrigin(const void *ptr) {
+        for (size_t depth = 0; ptr != nullptr && depth != _future_heap.size(); depth++) {
+            auto byPtr = [ptr](const MemRequest & re) {
+                return re._ptr_out == ptr && !(re._type & REQUEST_BIND);
+            };
+            auto origin = std::find_if(_future_heap.begin(), _future_heap.end(), byPtr);
+            if (origin != _future_heap.end()) {
+                return origin - _future_heap.begin();
+            }
+            auto binded = std::find_if(_future_heap.begin(), _future_heap.end(), [ptr](const MemRequest & re) {
+                return re._ptr_out == ptr && re._ptr_in != ptr;
+            });
+            if (binded == _future_heap.end() || binded->_offset != 0) {
+                break;
+            }
+            ptr = binded->_ptr_in;
+        }
+        return _future_heap.size();
+    }
 };
 }  // namespace memory
 }  // namespace GNAPluginNS
@@ -11,6 +11,7 @@
 #include <list>
 #include <unordered_set>
 #include <set>
+#include <map>
 #include <fstream>
 #include <limits>
 #include <iomanip>
@@ -707,6 +708,9 @@ void RemovePermutationsNHWCToNCHWPass::run() {
 
 void InsertIdentityLayerPass::run() {
     auto quantized = InferenceEngine::getInjectedData<QuantizedLayerParams>(pLayers->front());
+    // identities inserted only in front of some consumers of a data, keyed by that data,
+    // other consumers requiring same conversion are connected to them instead of getting own copy
+    std::map<Data*, CNNLayerPtr> partialIdentities;
     for (auto & l : *pLayers) {
         for (auto && prev : getCandidatesForIdentityInsertion(l)) {
             // Do an upstream search until Functional layer is found
@@ -723,16 +727,6 @@ void InsertIdentityLayerPass::run() {
                     break;
                 }
             }
-            int numOfIdentityLayers = this->getPassManager()->getIntVar(identityLayersCounterName)++;
-            // actual insertion
-            auto activationName = std::string("identity_") + std::to_string(numOfIdentityLayers);
-
-            gnalog() << "Inserted "<< activationName << " between: " << prev->name << " and " << true_layer->name << "\n" << std::flush;
-
-            CNNLayerPtr activationLayer =
-                std::make_shared<GenericLayer>(LayerParams({activationName, "identity", Precision::FP32}));
-
-            // TODO: why index is 0 ? - better use direct indexing in getCandidateFunction
             // detecting ins-data-idx
             size_t insDataIdx = std::numeric_limits<size_t>::max();
             for (size_t i = 0; i != true_layer->insData.size(); i++) {
@@ -747,6 +741,27 @@ void InsertIdentityLayerPass::run() {
 
             auto inputData = true_layer->insData[insDataIdx].lock();
 
+            auto sharedIdentity = partialIdentities.find(inputData.get());
+            if (sharedIdentity != partialIdentities.end()) {
+                auto identityData = sharedIdentity->second->outData.front();
+                gnalog() << "Reused " << sharedIdentity->second->name << " between: " << prev->name << " and " << true_layer->name << "\n" << std::flush;
+                for (auto x : CNNLayerFindInsDataIdxes(inputData, true_layer)) {
+                    true_layer->insData[x] = identityData;
+                }
+                getInputTo(identityData)[true_layer->name] = true_layer;
+                getInputTo(inputData).erase(true_layer->name);
+                continue;
+            }
+
+            int numOfIdentityLayers = this->getPassManager()->getIntVar(identityLayersCounterName)++;
+            // actual insertion
+            auto activationName = std::string("identity_") + std::to_string(numOfIdentityLayers);
+
+            gnalog() << "Inserted "<< activationName << " between: " << prev->name << " and " << true_layer->name << "\n" << std::flush;
+
+            CNNLayerPtr activationLayer =
+                std::make_shared<GenericLayer>(LayerParams({activationName, "identity", Precision::FP32}));
+
             auto dataPtr = std::make_shared<Data>("identity_data_" + std::to_string(numOfIdentityLayers), inputData->getTensorDesc());
             auto activationLayerWithQuant = quantized ?
                                             InferenceEngine::injectData<QuantizedLayerParams>(activationLayer) :
@@ -774,6 +789,9 @@ void InsertIdentityLayerPass::run() {
             }
 
             CNNNetworkInsertLayer(prev, notAll ? true_layer : CNNLayerPtr(nullptr), activationLayerWithQuant);
+            if (notAll) {
+                partialIdentities[inputData.get()] = activationLayerWithQuant;
+            }
         }
     }
 }
@@ -9,6 +9,7 @@
 
 #include "cnn.h"
 #include "backend/dnn_types.h"
+#include "gna_float_kernels.hpp"
 
 
 void CNNFilter32(intel_dnn_component_t *component) {
@@ -30,17 +31,14 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
-        }
-    }
+    // each output position is affine transform of input window starting at j * num_inputs_band_stride
+    GNAPluginNS::runtime::getFloatKernels().affine(component->op.conv1D.num_filters,
+                                                   num_filter_outputs,
+                                                   num_filter_coefficients,
+                                                   ptr_filters, num_filter_coefficients,
+                                                   ptr_inputs, num_inputs_band_stride,
+                                                   ptr_biases, nullptr,
+                                                   ptr_outputs, 1, component->op.conv1D.num_filters);
 }
 
 void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number_type) {
@@ -0,0 +1,128 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "gna_float_kernels.hpp"
+
+#include <cstdint>
+#include <cstddef>
+#include <ie_parallel.hpp>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+inline float dot(const float *a, const float *b, uint32_t size) {
+    uint32_t k = 0;
+    float sum = 0.0f;
+#if defined(HAVE_AVX512F)
+    __m512 acc = _mm512_setzero_ps();
+    for (; k + 16 <= size; k += 16) {
+        acc = _mm512_fmadd_ps(_mm512_loadu_ps(a + k), _mm512_loadu_ps(b + k), acc);
+    }
+    sum = _mm512_reduce_add_ps(acc);
+#elif defined(HAVE_AVX2)
+    __m256 acc = _mm256_setzero_ps();
+    for (; k + 8 <= size; k += 8) {
+        acc = _mm256_fmadd_ps(_mm256_loadu_ps(a + k), _mm256_loadu_ps(b + k), acc);
+    }
+    __m128 acc4 = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    acc4 = _mm_hadd_ps(acc4, acc4);
+    acc4 = _mm_hadd_ps(acc4, acc4);
+    sum = _mm_cvtss_f32(acc4);
+#endif
+    for (; k < size; k++) {
+        sum += a[k] * b[k];
+    }
+    return sum;
+}
+
+void affine(uint32_t M, uint32_t N, uint32_t K,
+            const float *A, uint32_t lda,
+            const float *Bt, uint32_t ldbt,
+            const float *bias, const uint32_t *rows,
+            float *C, uint32_t ldc_row, uint32_t ldc_col) {
+    // frames are outer dimension, so threads split them first and each thread reads own frames only
+    InferenceEngine::parallel_for2d(N, M, [&](size_t j, size_t i) {
+        const size_t row = rows != nullptr ? rows[i] : i;
+        C[i * ldc_row + j * ldc_col] = bias[row] + dot(A + row * lda, Bt + j * ldbt, K);
+    });
+}
+
+void diagonal(uint32_t N, const float *A, const float *X, float *Y) {
+    uint32_t i = 0;
+#if defined(HAVE_AVX512F)
+    for (; i + 16 <= N; i += 16) {
+        _mm512_storeu_ps(Y + i, _mm512_fmadd_ps(_mm512_loadu_ps(A + i), _mm512_loadu_ps(X + i), _mm512_loadu_ps(Y + i)));
+    }
+#elif defined(HAVE_AVX2)
+    for (; i + 8 <= N; i += 8) {
+        _mm256_storeu_ps(Y + i, _mm256_fmadd_ps(_mm256_loadu_ps(A + i), _mm256_loadu_ps(X + i), _mm256_loadu_ps(Y + i)));
+    }
+#endif
+    for (; i < N; i++) {
+        Y[i] += A[i] * X[i];
+    }
+}
+
+void relu(uint32_t N, const float *X, float *Y, float negative_slope) {
+    uint32_t i = 0;
+#if defined(HAVE_AVX512F)
+    const __m512 zero = _mm512_setzero_ps();
+    const __m512 slope = _mm512_set1_ps(negative_slope);
+    for (; i + 16 <= N; i += 16) {
+        const __m512 x = _mm512_loadu_ps(X + i);
+        _mm512_storeu_ps(Y + i, _mm512_mask_mul_ps(x, _mm512_cmp_ps_mask(x, zero, _CMP_LT_OQ), x, slope));
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 slope = _mm256_set1_ps(negative_slope);
+    for (; i + 8 <= N; i += 8) {
+        const __m256 x = _mm256_loadu_ps(X + i);
+        _mm256_storeu_ps(Y + i, _mm256_blendv_ps(x, _mm256_mul_ps(x, slope), _mm256_cmp_ps(x, zero, _CMP_LT_OQ)));
+    }
+#endif
+    for (; i < N; i++) {
+        Y[i] = X[i] < 0.0f ? X[i] * negative_slope : X[i];
+    }
+}
+
+void clamp(uint32_t N, const float *X, float *Y, float low, float high) {
+    uint32_t i = 0;
+    // min/max return second operand for NaN, so NaN inputs pass through as in scalar code
+#if defined(HAVE_AVX512F)
+    const __m512 vlow = _mm512_set1_ps(low);
+    const __m512 vhigh = _mm512_set1_ps(high);
+    for (; i + 16 <= N; i += 16) {
+        _mm512_storeu_ps(Y + i, _mm512_min_ps(vhigh, _mm512_max_ps(vlow, _mm512_loadu_ps(X + i))));
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 vlow = _mm256_set1_ps(low);
+    const __m256 vhigh = _mm256_set1_ps(high);
+    for (; i + 8 <= N; i += 8) {
+        _mm256_storeu_ps(Y + i, _mm256_min_ps(vhigh, _mm256_max_ps(vlow, _mm256_loadu_ps(X + i))));
+    }
+#endif
+    for (; i < N; i++) {
+        const float x = X[i];
+        Y[i] = x > high ? high : (x < low ? low : x);
+    }
+}
+
+}  // namespace
+
+void fill_float_kernels(FloatKernels *kernels) {
+    kernels->affine = affine;
+    kernels->diagonal = diagonal;
+    kernels->relu = relu;
+    kernels->clamp = clamp;
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
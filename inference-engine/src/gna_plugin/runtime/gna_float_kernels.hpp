@@ -0,0 +1,40 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief float math used by GNA_SW_FP32 runtime, compiled for every instruction set enabled in the build
+ * and selected once at runtime for the host cpu
+ */
+struct FloatKernels {
+    // C[i * ldc_row + j * ldc_col] = bias[r] + dot(A[r * lda], Bt[j * ldbt], K), where r = rows ? rows[i] : i
+    void (*affine)(uint32_t M, uint32_t N, uint32_t K,
+                   const float *A, uint32_t lda,
+                   const float *Bt, uint32_t ldbt,
+                   const float *bias, const uint32_t *rows,
+                   float *C, uint32_t ldc_row, uint32_t ldc_col);
+    // Y[i] += A[i] * X[i]
+    void (*diagonal)(uint32_t N, const float *A, const float *X, float *Y);
+    // Y[i] = X[i] < 0 ? X[i] * negative_slope : X[i]
+    void (*relu)(uint32_t N, const float *X, float *Y, float negative_slope);
+    // Y[i] = min(max(X[i], low), high)
+    void (*clamp)(uint32_t N, const float *X, float *Y, float low, float high);
+};
+
+const FloatKernels& getFloatKernels();
+
+namespace XARCH {
+
+void fill_float_kernels(FloatKernels *kernels);
+
+}  // namespace XARCH
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <vector>
+#include <ie_parallel.hpp>
+
 #include "gna_float_runtime.hpp"
+#include "gna_float_kernels.hpp"
 #include "pwl.h"
 #include "cnn.h"
 #include "floatmath.h"
@@ -10,6 +14,15 @@
 using namespace GNAPluginNS;
 using namespace GNAPluginNS::runtime;
 
+const FloatKernels& GNAPluginNS::runtime::getFloatKernels() {
+    static const FloatKernels kernels = [] {
+        FloatKernels cpuKernels;
+        XARCH::fill_float_kernels(&cpuKernels);
+        return cpuKernels;
+    }();
+    return kernels;
+}
+
 void FP::ApplyAffineTransform(intel_dnn_component_t *component, uint32_t *list, uint32_t listsize) {
     if (4 != component->num_bytes_per_input) {
         THROW_GNA_EXCEPTION << "Bad data width: " << component->num_bytes_per_input;
@@ -27,36 +40,18 @@ void FP::ApplyAffineTransform(intel_dnn_component_t *component, uint32_t *list,
     auto B = reinterpret_cast<float *>(component->ptr_inputs);
     auto C = reinterpret_cast<float *>(component->ptr_outputs);
     auto bias = reinterpret_cast<float *>(transform->ptr_biases);
-    if (list == nullptr) {
-        for (uint32_t i = 0; i < m; i++) {
-            for (uint32_t j = 0; j < n; j++) {
-                C[i * ldc + j] = bias[i];
-            }
+
+    // frames of B are interleaved, so they are made contiguous once to be read by vector loads
+    std::vector<float> Bt(static_cast<size_t>(n) * k);
+    for (uint32_t i = 0; i < k; i++) {
+        for (uint32_t j = 0; j < n; j++) {
+            Bt[j * k + i] = B[i * ldb + j];
         }
-        cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1.0, A, lda, B, ldb, 1.0, C, ldc);
+    }
+    if (list == nullptr) {
+        getFloatKernels().affine(m, n, k, A, lda, Bt.data(), k, bias, nullptr, C, ldc, 1);
     } else {
-        for (int l = 0; l < listsize; l++) {
-            int i = list[l];
-            for (uint32_t j = 0; j < n; j++) {
-                C[l * ldc + j] = bias[i];
-            }
-        }
-        cblas_sgemm_subset(CblasRowMajor,
-                           CblasNoTrans,
-                           CblasNoTrans,
-                           m,
-                           n,
-                           k,
-                           1.0,
-                           A,
-                           lda,
-                           B,
-                           ldb,
-                           1.0,
-                           C,
-                           ldc,
-                           list,
-                           listsize);
+        getFloatKernels().affine(listsize, n, k, A, lda, Bt.data(), k, bias, list, C, ldc, 1);
     }
 }
 
@@ -80,11 +75,9 @@ void FP::ApplyDiagonalTransform(intel_dnn_component_t *component) {
             C[i * ldc + j] = bias[i];
         }
     }
-    for (uint32_t j = 0; j < n; j++) {
-        float *Bcol = B + j * ldb;
-        float *Ccol = C + j * ldc;
-        cblas_ssbmv1(CblasRowMajor, CblasLower, m, 0, 1.0, A, 1, Bcol, 1, 1.0, Ccol, 1);
-    }
+    InferenceEngine::parallel_for(n, [&](uint32_t j) {
+        getFloatKernels().diagonal(m, A, B + j * ldb, C + j * ldc);
+    });
 }
 
 void FP::ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t row, void *ptr_feedbacks) {
@@ -9,6 +9,10 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
 #include "backend/gna_types.h"
 
 #ifdef _NO_MKL_
@@ -25,7 +29,9 @@
 #define TANH(num, in, out) vsTanh(num, in, out)
 #endif
 
+#include <ie_parallel.hpp>
 #include "pwl.h"
+#include "gna_float_kernels.hpp"
 #include "gna_plugin_log.hpp"
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
@@ -64,17 +70,23 @@ double pivot_search(std::vector<pwl_t>& result,
                     const double alpha_N,
                     const double threshold,
                     const bool negative) {
-    std::vector<std::vector<double>> t(N + 1);
-    std::vector<std::vector<double>> alpha(N + 1);
-    std::vector<std::vector<double>> epsilon(N + 1);
-    std::vector<std::vector<double>> d(N + 1);
+    // Only the current iteration and the previous one are kept: an iteration which increases the error
+    // is repeated from the previous one with a smaller step, so older iterations are never used again.
+    // Slots are selected by the parity of the iteration number.
+    std::vector<double> t[2], alpha[2], epsilon[2];
+    for (int k = 0; k < 2; k++) {
+        t[k].resize(N);
+        alpha[k].resize(N + 1);
+        epsilon[k].resize(N + 1);
+    }
+    // the function and its derivative at the tangent points are evaluated once per iteration
+    std::vector<double> f_t(N), deriv_t(N), d(N);
     bool same_epsilon = false;
     double Delta;
     double epsilon_final = 0.0;
     double max_epsilon = 0.0;
     double max_epsilon_prev;
     double min_epsilon;
-    double min_epsilon2;
     double sgn = (negative) ? -1.0 : 1.0;
     int j;
 
@@ -86,36 +98,39 @@ double pivot_search(std::vector<pwl_t>& result,
     Delta = 1.0;
 
     for (int i = 0; i < N; i++) {
-        t[i].push_back(alpha_0 + (static_cast<double>((i + 1)) / static_cast<double>((N + 1))) * (alpha_N - alpha_0));
+        t[0][i] = alpha_0 + (static_cast<double>((i + 1)) / static_cast<double>((N + 1))) * (alpha_N - alpha_0);
     }
 
     while (true) {
+        auto& t_j = t[j & 1];
+        auto& alpha_j = alpha[j & 1];
+        auto& epsilon_j = epsilon[j & 1];
+        for (int i = 0; i < N; i++) {
+            f_t[i] = f(t_j[i]);
+            deriv_t[i] = first_deriv_f(t_j[i]);
+        }
+
         // Figure 4:  Box #2
-        alpha[0].resize(j + 1);
-        alpha[0][j] = alpha_0;
+        alpha_j[0] = alpha_0;
         for (int i = 1; i < N; i++) {
-            alpha[i].resize(j + 1);
-            alpha[i][j] = (f(t[i - 1][j]) - f(t[i][j]) + first_deriv_f(t[i][j]) * t[i][j] - first_deriv_f(t[i - 1][j]) * t[i - 1][j])
-                / (first_deriv_f(t[i][j]) - first_deriv_f(t[i - 1][j]));
+            alpha_j[i] = (f_t[i - 1] - f_t[i] + deriv_t[i] * t_j[i] - deriv_t[i - 1] * t_j[i - 1])
+                / (deriv_t[i] - deriv_t[i - 1]);
         }
-        alpha[N].resize(j + 1);
-        alpha[N][j] = alpha_N;
+        alpha_j[N] = alpha_N;
 
         // Figure 4:  Box #3
         for (int i = 0; i < N; i++) {
-            epsilon[i].resize(j + 1);
-            epsilon[i][j] = sgn * (first_deriv_f(t[i][j]) * (alpha[i][j] - t[i][j]) + f(t[i][j]) - f(alpha[i][j]));
+            epsilon_j[i] = sgn * (deriv_t[i] * (alpha_j[i] - t_j[i]) + f_t[i] - f(alpha_j[i]));
         }
-        epsilon[N].resize(j + 1);
-        epsilon[N][j] = sgn * (first_deriv_f(t[N - 1][j]) * (alpha[N][j] - t[N - 1][j]) + f(t[N - 1][j]) - f(alpha[N][j]));
+        epsilon_j[N] = sgn * (deriv_t[N - 1] * (alpha_j[N] - t_j[N - 1]) + f_t[N - 1] - f(alpha_j[N]));
 
         // Figure 4:  Test for completion
         max_epsilon_prev = max_epsilon;
-        max_epsilon = fabs(epsilon[0][j]);
-        min_epsilon = fabs(epsilon[0][j]);
+        max_epsilon = fabs(epsilon_j[0]);
+        min_epsilon = fabs(epsilon_j[0]);
         for (int i = 1; i < N + 1; i++) {
-            if (fabs(epsilon[i][j]) > max_epsilon) max_epsilon = fabs(epsilon[i][j]);
-            if (fabs(epsilon[i][j]) < min_epsilon) min_epsilon = fabs(epsilon[i][j]);
+            if (fabs(epsilon_j[i]) > max_epsilon) max_epsilon = fabs(epsilon_j[i]);
+            if (fabs(epsilon_j[i]) < min_epsilon) min_epsilon = fabs(epsilon_j[i]);
         }
         if ((j == PWL_MAX_ITERATIONS) || (max_epsilon - min_epsilon < threshold * min_epsilon)) {
             pwl_t value;
@@ -123,18 +138,18 @@ double pivot_search(std::vector<pwl_t>& result,
             epsilon_final = (max_epsilon + min_epsilon) / 4.0;  // Andrzej's modification
             for (int i = 0; i < N; i++) {
                 double val, val_next;
-                value.t = t[i][j];
-                value.alpha = alpha[i][j];
-                val = sgn * first_deriv_f(value.t) * (value.alpha - value.t) + sgn * f(value.t) - epsilon_final;
-                val_next = sgn * first_deriv_f(value.t) * (alpha[i + 1][j] - value.t) + sgn * f(value.t) - epsilon_final;
+                value.t = t_j[i];
+                value.alpha = alpha_j[i];
+                val = sgn * deriv_t[i] * (value.alpha - value.t) + sgn * f_t[i] - epsilon_final;
+                val_next = sgn * deriv_t[i] * (alpha_j[i + 1] - value.t) + sgn * f_t[i] - epsilon_final;
                 value.beta = val;
-                value.m = (val_next - val) / (alpha[i + 1][j] - value.alpha);
+                value.m = (val_next - val) / (alpha_j[i + 1] - value.alpha);
                 value.b = (val - value.m * value.alpha);
                 result.push_back(value);
             }
             value.t = value.m = value.b = 0.0;
-            value.alpha = alpha[N][j];
-            value.beta = sgn * first_deriv_f(t[N - 1][j]) * (alpha[N][j] - t[N - 1][j]) + sgn * f(t[N - 1][j]) - epsilon_final;
+            value.alpha = alpha_j[N];
+            value.beta = sgn * deriv_t[N - 1] * (alpha_j[N] - t_j[N - 1]) + sgn * f_t[N - 1] - epsilon_final;
             result.push_back(value);
             if (j == PWL_MAX_ITERATIONS) {
                 THROW_GNA_EXCEPTION << "Failed to converge in pivot_search!";
@@ -158,18 +173,19 @@ double pivot_search(std::vector<pwl_t>& result,
         }
 
         // Figure 4:  Box #4
+        const auto& t_cur = t[j & 1];
+        const auto& alpha_cur = alpha[j & 1];
+        const auto& epsilon_cur = epsilon[j & 1];
         for (int i = 0; i < N; i++) {
-            d[i].resize(j + 1);
-            d[i][j] = Delta * (epsilon[i + 1][j] - epsilon[i][j]) /
-                ((epsilon[i + 1][j] / (alpha[i + 1][j] - t[i][j])) + (epsilon[i][j] / (t[i][j] - alpha[i][j])));
+            d[i] = Delta * (epsilon_cur[i + 1] - epsilon_cur[i]) /
+                ((epsilon_cur[i + 1] / (alpha_cur[i + 1] - t_cur[i])) + (epsilon_cur[i] / (t_cur[i] - alpha_cur[i])));
         }
 
         // Figure 4:  Box #5
+        auto& t_next = t[(j + 1) & 1];
         for (int i = 0; i < N; i++) {
-            t[i].resize(j + 2);
-            t[i][j + 1] = t[i][j] + d[i][j];
+            t_next[i] = t_cur[i] + d[i];
         }
-        t[N].resize(j + 2);
 
         j = j + 1;
     }
@@ -497,7 +513,72 @@ std::vector<pwl_t> pwl_search(const DnnActivation& activation_type,
 }
 
 
-void PwlDesignOpt16(const DnnActivation activation_type,
+namespace {
+
+// The activation type with the arguments which define its PWL
+using PwlActivationKey = std::tuple<int, float, float, float, float>;
+
+PwlActivationKey make_pwl_activation_key(const DnnActivation& activation) {
+    switch (activation.type) {
+        case kActLeakyRelu:
+            return PwlActivationKey{activation.type, activation.args.lrelu.negative_slope, 0.f, 0.f, 0.f};
+        case kActPow:
+            return PwlActivationKey{activation.type, 0.f, activation.args.pow.exponent,
+                                    activation.args.pow.scale, activation.args.pow.offset};
+        default:
+            return PwlActivationKey{activation.type, 0.f, 0.f, 0.f, 0.f};
+    }
+}
+
+/**
+ * Thread safe memo of PWL designs shared by all layers and networks of the process.
+ * A value is computed without the lock, so concurrent misses of one key may compute it twice.
+ */
+template <typename Key, typename Value>
+class PwlCache {
+public:
+    template <typename Create>
+    Value get(const Key& key, Create create) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto found = _cache.find(key);
+            if (found != _cache.end())
+                return found->second;
+        }
+        Value value = create();
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _cache.emplace(key, value).first->second;
+    }
+
+private:
+    std::map<Key, Value> _cache;
+    std::mutex _mutex;
+};
+
+// the fit does not depend on scale factors for most of activations, so it is memoized separately from segments
+std::vector<pwl_t> pwl_search_cached(const DnnActivation& activation_type,
+                                     const double l_bound,
+                                     const double u_bound,
+                                     const double threshold,
+                                     const double allowed_err_pct,
+                                     const int samples,
+                                     double& err_pct) {
+    using Key = std::tuple<PwlActivationKey, double, double, double, double, int>;
+    using Value = std::pair<std::vector<pwl_t>, double>;
+    static PwlCache<Key, Value> cache;
+    auto key = Key{make_pwl_activation_key(activation_type), l_bound, u_bound, threshold, allowed_err_pct, samples};
+    auto value = cache.get(key, [&] {
+        double err = 0.0;
+        auto pwl = pwl_search(activation_type, l_bound, u_bound, threshold, allowed_err_pct, samples, err);
+        return Value{pwl, err};
+    });
+    err_pct = value.second;
+    return value.first;
+}
+
+}  // namespace
+
+static void PwlDesignOpt16Impl(const DnnActivation activation_type,
                     std::vector<gna_pwl_segment_t> &ptr_segment,
                     const float scale_in,
                     const float scale_out) {
@@ -505,15 +586,15 @@ void PwlDesignOpt16(const DnnActivation activation_type,
     double err_pct = 0.0;
     switch (activation_type) {
         case kActSigmoid:
-            pwl = pwl_search(activation_type, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, -SIGMOID_DOMAIN, SIGMOID_DOMAIN, scale_in, scale_out, ptr_segment);
             break;
         case kActTanh:
-            pwl = pwl_search(activation_type, -TANH_DOMAIN, TANH_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, -TANH_DOMAIN, TANH_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, -TANH_DOMAIN, TANH_DOMAIN, scale_in, scale_out, ptr_segment);
             break;
         case kActSoftSign:
-            pwl = pwl_search(activation_type, -SOFTSIGN_DOMAIN, SOFTSIGN_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, -SOFTSIGN_DOMAIN, SOFTSIGN_DOMAIN, PWL_DESIGN_THRESHOLD, PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, -SOFTSIGN_DOMAIN, SOFTSIGN_DOMAIN, scale_in, scale_out, ptr_segment);
             break;
         case kActRelu:
@@ -531,28 +612,28 @@ void PwlDesignOpt16(const DnnActivation activation_type,
         case kActLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((INT32_MAX / scale_in) < LOG_DOMAIN) ? (INT32_MAX / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.066*PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.066*PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, ptr_segment);
             break;
         }
         case kActNegLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((INT32_MAX / scale_in) < LOG_DOMAIN) ? (INT32_MAX / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.066*PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.066*PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, ptr_segment);
             break;
         }
         case kActNegHalfLog: {
             double x_min = (1 + ~XBASEMASK) / scale_in;
             double x_max = ((INT32_MAX / scale_in) < LOG_DOMAIN) ? (INT32_MAX / scale_in) : LOG_DOMAIN;
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.066*PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.066*PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, ptr_segment);
             break;
         }
         case kActExp: {
             double x_min = -log(scale_out);
             double x_max = x_min + log(INT16_MAX);
-            pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.5*PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+            pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.5*PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, ptr_segment);
             break;
         }
@@ -577,7 +658,7 @@ void PwlDesignOpt16(const DnnActivation activation_type,
             x_max = std::min(x_max, POW_DOMAIN);
 
             if (activation_type.args.pow.exponent != 0.0f && activation_type.args.pow.exponent != 1.0f) {
-                pwl = pwl_search(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.015 * PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
+                pwl = pwl_search_cached(activation_type, x_min, x_max, PWL_DESIGN_THRESHOLD, 0.015 * PWL_MAX_ERR_PERCENT, PWL_DESIGN_SAMPLES, err_pct);
             }
 
             make_gna_pwl(activation_type, pwl, x_min, x_max, scale_in, scale_out, ptr_segment);
@@ -588,6 +669,24 @@ void PwlDesignOpt16(const DnnActivation activation_type,
     }
 }
 
+void PwlDesignOpt16(const DnnActivation activation_type,
+                    std::vector<gna_pwl_segment_t> &ptr_segment,
+                    const float scale_in,
+                    const float scale_out) {
+    // FakeQuantize ranges are referenced by pointers, so they can not be a part of the key
+    if (activation_type.type == kActFakeQuantize) {
+        PwlDesignOpt16Impl(activation_type, ptr_segment, scale_in, scale_out);
+        return;
+    }
+    using Key = std::tuple<PwlActivationKey, float, float>;
+    static PwlCache<Key, std::vector<gna_pwl_segment_t>> cache;
+    ptr_segment = cache.get(Key{make_pwl_activation_key(activation_type), scale_in, scale_out}, [&] {
+        std::vector<gna_pwl_segment_t> segments;
+        PwlDesignOpt16Impl(activation_type, segments, scale_in, scale_out);
+        return segments;
+    });
+}
+
 void PwlDesign16(const DnnActivation activation_type,
                  gna_pwl_segment_t *ptr_segment,
                  const uint32_t num_segments,
@@ -940,20 +1039,29 @@ void PwlApply32(intel_dnn_component_t *component,
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
     uint32_t num_columns = component->num_columns_in;
+    uint32_t num_rows = num_row_end - num_row_start + 1;
+    uint32_t num_row_columns = num_col_end - num_col_start + 1;
+    auto & kernels = GNAPluginNS::runtime::getFloatKernels();
+    // transcendental functions are kept exact for accuracy validation and computed by rows in parallel
+    auto forEachRow = [&](std::function<void(uint32_t)> rowFunc) {
+        InferenceEngine::parallel_for(num_rows, [&](uint32_t row) {
+            rowFunc(num_row_start + row);
+        });
+    };
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+            forEachRow([&](uint32_t i) {
                 for (uint32_t j = num_col_start; j <= num_col_end; j++) {
                     ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
                 }
-            }
+            });
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+            forEachRow([&](uint32_t i) {
                 for (uint32_t j = num_col_start; j <= num_col_end; j++) {
                     ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
                 }
-            }
+            });
             break;
         case kActSoftSign:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
@@ -964,12 +1072,10 @@ void PwlApply32(intel_dnn_component_t *component,
             break;
         case kActRelu:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
+                kernels.relu(num_row_columns,
+                             ptr_in + i * num_columns + num_col_start,
+                             ptr_out + i * num_columns + num_col_start,
+                             transform->func_id.args.lrelu.negative_slope);
             }
             break;
         case kActIdentity:
@@ -981,31 +1087,26 @@ void PwlApply32(intel_dnn_component_t *component,
             break;
         case kActKaldiLstmClipping:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > KALDI_LSTM_CLIP_UPPER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_UPPER;
-                    } else if (val < KALDI_LSTM_CLIP_LOWER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_LOWER;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
-                }
+                kernels.clamp(num_row_columns,
+                              ptr_in + i * num_columns + num_col_start,
+                              ptr_out + i * num_columns + num_col_start,
+                              KALDI_LSTM_CLIP_LOWER,
+                              KALDI_LSTM_CLIP_UPPER);
             }
             break;
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+            forEachRow([&](uint32_t i) {
                 for (uint32_t j = num_col_start; j <= num_col_end; j++) {
                     ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
                 }
-            }
+            });
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+            forEachRow([&](uint32_t i) {
                 for (uint32_t j = num_col_start; j <= num_col_end; j++) {
                     ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
                 }
-            }
+            });
             break;
         case kActAbs:
             for (uint32_t i = num_row_start; i <= num_row_end; i++) {
@@ -1039,11 +1140,11 @@ void PwlApply32(intel_dnn_component_t *component,
                 float exponent = transform->func_id.args.pow.exponent;
                 float scale = transform->func_id.args.pow.scale;
                 float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+                forEachRow([&](uint32_t i) {
                     for (uint32_t j = num_col_start; j <= num_col_end; j++) {
                         ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
                     }
-                }
+                });
             }
             break;
         case kActFakeQuantize: {
@@ -22,9 +22,11 @@
 #include <unordered_set>
 #include <array>
 #include <cstdint>
+#include <functional>
 
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
+#include "ie_load_time_breakdown.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "hetero_plugin.hpp"
@@ -287,13 +289,16 @@ void HeteroExecutableNetwork::InitCNNImpl(const InferenceEngine::ICNNNetwork& ne
         NetworkDesc desc;
         desc._device = affinity;
         desc._clonedNetwork = CNNNetwork{tempNetwork};
+        for (auto&& layer : tempLayers) {
+            desc._layers.push_back(layer->name);
+        }
 
         descs.emplace_back(std::move(desc));
     }
 
+    // subnetworks are independent, so they are loaded in parallel and devices compile them at the same time
+    std::vector<std::function<void()>> loadTasks;
     for (auto &&d : descs) {
-        IExecutableNetwork::Ptr ret;
-
         auto subnetworkInputs = d._clonedNetwork.getInputsInfo();
         bool isInputSubnetwork = (subnetworkInputs.end() != std::find_first_of(
             subnetworkInputs.begin(), subnetworkInputs.end(),
@@ -310,8 +315,11 @@ void HeteroExecutableNetwork::InitCNNImpl(const InferenceEngine::ICNNNetwork& ne
         auto metaDevices = _heteroPlugin->GetDevicePlugins(deviceName, cfg);
         assert(metaDevices.size() == 1);
         auto loadConfig = metaDevices[deviceName];
-        d._network = _heteroPlugin->GetCore()->LoadNetwork(d._clonedNetwork, deviceName, loadConfig);
+        loadTasks.emplace_back([this, &d, deviceName, loadConfig] {
+            d._network = _heteroPlugin->GetCore()->LoadNetwork(d._clonedNetwork, deviceName, loadConfig);
+        });
     }
+    RunLoadTasksInParallel(loadTasks);
 
     networks = std::move(descs);
 }
@@ -319,6 +327,163 @@ void HeteroExecutableNetwork::InitCNNImpl(const InferenceEngine::ICNNNetwork& ne
 template<typename T>
 using NodeMap = std::unordered_map<ngraph::Node*, T>;
 
+namespace {
+
+// Cost of a tensor transfer between devices relative to producing the same tensor on the primary device.
+// Transfers go through host memory, synchronize devices and break fusions of the neighbour subgraphs
+constexpr std::size_t transferCostFactor = 4;
+
+bool IsComputeNode(const ngraph::Node* node) {
+    return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node);
+}
+
+template<typename NodeType>
+std::size_t TensorBytes(const ngraph::Output<NodeType>& output) {
+    auto& shape = output.get_partial_shape();
+    std::size_t elements = shape.is_static() ? ngraph::shape_size(shape.to_shape()) : 1;
+    return std::max<std::size_t>(elements * output.get_element_type().size(), 1);
+}
+
+// Without measured latencies each next device in TARGET_FALLBACK is considered one time slower than the previous one
+std::size_t NodeCost(const ngraph::Node* node, std::size_t devicePriority) {
+    std::size_t bytes = 0;
+    for (auto&& output : node->outputs()) {
+        bytes += TensorBytes(output);
+    }
+    return bytes * (devicePriority + 1);
+}
+
+// Moves islands of nodes to a neighbour device which supports all of them if it decreases
+// the estimated cost of the network: nodes cost on their devices plus transfers between subgraphs
+void MergeSubgraphs(const ngraph::NodeVector& orderedOps,
+                    const std::vector<std::string>& fallbackDevices,
+                    const Engine::DeviceQueryResults& deviceQueryResults,
+                    std::map<std::string, std::string>& supportedLayersMap) {
+    std::unordered_map<std::string, std::size_t> devicePriorities;
+    for (auto&& device : fallbackDevices) {
+        devicePriorities.emplace(device, devicePriorities.size());
+    }
+    std::vector<ngraph::Node*> computeNodes;
+    NodeMap<std::string> affinities;
+    for (auto&& node : orderedOps) {
+        auto itAffinity = supportedLayersMap.find(node->get_friendly_name());
+        if (IsComputeNode(node.get()) && itAffinity != supportedLayersMap.end()) {
+            computeNodes.push_back(node.get());
+            affinities.emplace(node.get(), itAffinity->second);
+        }
+    }
+    auto IsSupported = [&] (const ngraph::Node* node, const std::string& device) {
+        auto itResult = deviceQueryResults.find(device);
+        return itResult != deviceQueryResults.end() &&
+               contains(itResult->second.supportedLayersMap, node->get_friendly_name());
+    };
+    // each node is visited with both its input and output edges
+    auto ForEachNeighbour = [&] (ngraph::Node* node, const std::function<void(ngraph::Node*, std::size_t)>& f) {
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            if (contains(affinities, source.get_node())) {
+                f(source.get_node(), TensorBytes(source));
+            }
+        }
+        for (auto&& output : node->outputs()) {
+            for (auto&& input : output.get_target_inputs()) {
+                if (contains(affinities, input.get_node())) {
+                    f(input.get_node(), TensorBytes(output));
+                }
+            }
+        }
+    };
+
+    bool merged = false;
+    // every move strictly decreases the cost, the limit only guards against degenerate cases
+    for (std::size_t step = 0; step < computeNodes.size(); ++step) {
+        // Islands are connected components of nodes with the same affinity
+        NodeMap<std::size_t> islandIds;
+        std::vector<std::vector<ngraph::Node*>> islands;
+        for (auto&& node : computeNodes) {
+            if (contains(islandIds, node)) continue;
+            islands.emplace_back();
+            islandIds.emplace(node, islands.size() - 1);
+            std::deque<ngraph::Node*> queue{node};
+            while (!queue.empty()) {
+                auto current = queue.front();
+                queue.pop_front();
+                islands.back().push_back(current);
+                ForEachNeighbour(current, [&] (ngraph::Node* neighbour, std::size_t) {
+                    if (affinities[neighbour] == affinities[node] && !contains(islandIds, neighbour)) {
+                        islandIds.emplace(neighbour, islands.size() - 1);
+                        queue.push_back(neighbour);
+                    }
+                });
+            }
+        }
+        if (islands.size() < 2) break;
+
+        std::int64_t bestDelta = 0;
+        std::size_t bestIsland = islands.size();
+        std::string bestDevice;
+        for (std::size_t islandId = 0; islandId < islands.size(); ++islandId) {
+            auto& island = islands[islandId];
+            auto& device = affinities[island.front()];
+            std::unordered_set<std::string> candidates;
+            for (auto&& node : island) {
+                ForEachNeighbour(node, [&] (ngraph::Node* neighbour, std::size_t) {
+                    if (affinities[neighbour] != device) candidates.insert(affinities[neighbour]);
+                });
+            }
+            for (auto&& candidate : candidates) {
+                if (!std::all_of(island.begin(), island.end(),
+                                 [&] (const ngraph::Node* node) { return IsSupported(node, candidate); })) {
+                    continue;
+                }
+                std::int64_t delta = 0;
+                for (auto&& node : island) {
+                    delta += static_cast<std::int64_t>(NodeCost(node, devicePriorities[candidate])) -
+                             static_cast<std::int64_t>(NodeCost(node, devicePriorities[device]));
+                    ForEachNeighbour(node, [&] (ngraph::Node* neighbour, std::size_t bytes) {
+                        if (islandIds[neighbour] != islandId) {
+                            auto transferCost = static_cast<std::int64_t>(bytes * transferCostFactor);
+                            delta += (affinities[neighbour] != candidate ? transferCost : 0) - transferCost;
+                        }
+                    });
+                }
+                if (delta < bestDelta) {
+                    bestDelta = delta;
+                    bestIsland = islandId;
+                    bestDevice = candidate;
+                }
+            }
+        }
+        if (bestIsland == islands.size()) break;
+
+        for (auto&& node : islands[bestIsland]) {
+            affinities[node] = bestDevice;
+            supportedLayersMap[node->get_friendly_name()] = bestDevice;
+        }
+        merged = true;
+    }
+
+    if (!merged) return;
+    // Results follow their producers, parameters and constants follow their consumers if all of them are on the same device
+    for (auto&& node : orderedOps) {
+        std::unordered_set<std::string> devices;
+        if (ngraph::op::is_output(node)) {
+            auto itAffinity = affinities.find(node->input_value(0).get_node());
+            if (itAffinity != affinities.end()) devices.insert(itAffinity->second);
+        } else if (!IsComputeNode(node.get())) {
+            for (auto&& input : node->output(0).get_target_inputs()) {
+                auto itAffinity = affinities.find(input.get_node());
+                if (itAffinity != affinities.end()) devices.insert(itAffinity->second);
+            }
+        }
+        if (devices.size() == 1) {
+            supportedLayersMap[node->get_friendly_name()] = *devices.begin();
+        }
+    }
+}
+
+}  // namespace
+
 void HeteroExecutableNetwork::InitNgraph(const InferenceEngine::ICNNNetwork& network_) {
     auto function = network_.getFunction();
     auto clonedFunction = ngraph::clone_function(*function);
@@ -346,7 +511,18 @@ void HeteroExecutableNetwork::InitNgraph(const InferenceEngine::ICNNNetwork& net
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it != _config.end()) {
-            queryNetworkResult = _heteroPlugin->QueryNetwork(network_, _config);
+            auto deviceQueryResults = _heteroPlugin->QueryNetworkOnDevices(network_, _config);
+            //  WARNING: Here is devices with user set priority
+            auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(it->second);
+            for (auto&& deviceName : fallbackDevices) {
+                for (auto&& layerQueryResult : deviceQueryResults[deviceName].supportedLayersMap) {
+                    queryNetworkResult.supportedLayersMap.emplace(layerQueryResult);
+                }
+            }
+            auto itMergeSubgraphs = _config.find(HETERO_CONFIG_KEY(MERGE_SUBGRAPHS));
+            if (fallbackDevices.size() > 1 && (itMergeSubgraphs == _config.end() || itMergeSubgraphs->second == YES)) {
+                MergeSubgraphs(orderedOps, fallbackDevices, deviceQueryResults, queryNetworkResult.supportedLayersMap);
+            }
         } else {
             THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
         }
@@ -645,6 +821,11 @@ void HeteroExecutableNetwork::InitNgraph(const InferenceEngine::ICNNNetwork& net
             std::make_shared<ngraph::Function>(subgraph._results, subgraph._parameters,
                                                      _name + '_' + std::to_string(id));
         networks[id]._clonedNetwork = CNNNetwork{subFunctions[id]};
+        for (auto&& node : subFunctions[id]->get_ordered_ops()) {
+            if (IsComputeNode(node.get())) {
+                networks[id]._layers.push_back(node->get_friendly_name());
+            }
+        }
         // update of pre-processing info
         auto clonedInputs = networks[id]._clonedNetwork.getInputsInfo();
         for (auto&& externalInput : externalInputsData) {
@@ -681,14 +862,18 @@ void HeteroExecutableNetwork::InitNgraph(const InferenceEngine::ICNNNetwork& net
                 }
             }}.run_on_function(ngraph::clone_function(*function));
     }
+    std::vector<std::function<void()>> loadTasks;
     for (auto&& network : networks) {
         auto cfg = _config;
         cfg[CONFIG_KEY_INTERNAL(SUBNETWORK_WITH_NETWORK_INPUTS)]
             = isInputSubnetwork[std::distance(networks.data(), &network)] ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
         auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, cfg);
-        network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
-                                                                 network._device, metaDevices[network._device]);
+        auto loadConfig = metaDevices[network._device];
+        loadTasks.emplace_back([this, &network, loadConfig] {
+            network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork, network._device, loadConfig);
+        });
     }
+    RunLoadTasksInParallel(loadTasks);
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::ICNNNetwork&    network,
@@ -822,6 +1007,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
             deviceName,
             loaded ? CNNNetwork{cloneNet(static_cast<InferenceEngine::ICNNNetwork&>(cnnnetwork))} : CNNNetwork{},
             executableNetwork,
+            {},
         });
     }
 
@@ -952,6 +1138,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(MERGE_SUBGRAPHS)) {
+        auto it = _config.find(name);
+        result = it == _config.end() || it->second == YES;
     } else {
         // find config key among plugin config keys
         for (auto&& desc : networks) {
@@ -1013,7 +1202,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
             METRIC_KEY(NETWORK_NAME),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(HETERO_SUBGRAPHS)
         };
 
         {
@@ -1036,6 +1226,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(MERGE_SUBGRAPHS),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -1058,11 +1249,23 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
     } else if (METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
     } else if (METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
+        // Subnetworks of different requests are executed concurrently, so each subnetwork
+        // needs its own optimal number of requests in flight to keep all devices busy
         unsigned int value = 0u;
         for (auto&& desc : networks) {
-            value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (METRIC_KEY(HETERO_SUBGRAPHS) == name) {
+        std::vector<std::string> subgraphs;
+        for (auto&& desc : networks) {
+            std::string subgraph = desc._device + ":";
+            for (auto&& layer : desc._layers) {
+                subgraph += (&layer == desc._layers.data() ? " " : ",") + layer;
+            }
+            subgraphs.push_back(std::move(subgraph));
+        }
+        IE_SET_METRIC_RETURN(HETERO_SUBGRAPHS, subgraphs);
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : networks) {
@@ -70,6 +70,7 @@ private:
         std::string                                 _device;
         InferenceEngine::CNNNetwork                 _clonedNetwork;
         InferenceEngine::ExecutableNetwork          _network;
+        std::vector<std::string>                    _layers;
     };
     std::vector<NetworkDesc> networks;
 
@@ -9,9 +9,12 @@
 #include <description_buffer.hpp>
 #include <ie_layouts.h>
 #include <ie_algorithm.hpp>
+#include <ie_remote_context.hpp>
+#include <gpu/gpu_params.hpp>
 #include <cassert>
 #include <map>
 #include <string>
+#include <vector>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
@@ -27,7 +30,42 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
         THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
     }
 
-    auto requestBlob([&](const std::string& blobName, InferenceEngine::InferRequest::Ptr r) {
+    // Devices with a remote context may allocate intermediate blobs in host memory they access directly,
+    // so adjacent subnetworks exchange tensors without copies to and from plugin allocated blobs
+    std::vector<RemoteContext::Ptr> contexts;
+    for (auto&& desc : _inferRequests) {
+        RemoteContext::Ptr context;
+        try {
+            context = desc._network.GetContext();
+        } catch (const InferenceEngine::details::InferenceEngineException&) {}
+        contexts.push_back(context);
+    }
+    auto sharedBlob([&](const std::string& outputName, const TensorDesc& tensorDesc, std::size_t producerId) {
+        std::vector<RemoteContext::Ptr> candidates{contexts[producerId]};
+        for (std::size_t consumerId = 0; consumerId < _inferRequests.size(); ++consumerId) {
+            for (auto&& inputInfo : _inferRequests[consumerId]._network.GetInputsInfo()) {
+                auto itName = subgraphInputToOutputBlobNames.find(inputInfo.first);
+                if (itName != subgraphInputToOutputBlobNames.end() && itName->second == outputName) {
+                    candidates.push_back(contexts[consumerId]);
+                }
+            }
+        }
+        for (auto&& context : candidates) {
+            if (context == nullptr) continue;
+            try {
+                auto blob = context->CreateBlob(tensorDesc, {{GPU_PARAM_KEY(SHARED_MEM_TYPE),
+                                                              GPU_PARAM_VALUE(USM_HOST_BUFFER)}});
+                blob->allocate();
+                if (blob->buffer().as<void*>() != nullptr) {
+                    return std::static_pointer_cast<Blob>(blob);
+                }
+            } catch (const InferenceEngine::details::InferenceEngineException&) {}
+        }
+        return Blob::Ptr{};
+    });
+
+    auto requestBlob([&](const std::string& blobName, std::size_t requestId) {
+        auto& r = _inferRequests[requestId]._request;
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
         if (itName != subgraphInputToOutputBlobNames.end()) {
@@ -37,7 +75,16 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
         bool emplaced = false;
         std::tie(itBlob, emplaced) = _blobs.emplace(intermediateBlobName, Blob::Ptr{});
         if (emplaced) {
-            itBlob->second = r->GetBlob(blobName);
+            auto outputsInfo = _inferRequests[requestId]._network.GetOutputsInfo();
+            auto itOutput = outputsInfo.find(blobName);
+            if (itOutput != outputsInfo.end() && !contains(networkOutputs, blobName)) {
+                itBlob->second = sharedBlob(blobName, itOutput->second->getTensorDesc(), requestId);
+            }
+            if (itBlob->second != nullptr) {
+                r->SetBlob(blobName, itBlob->second);
+            } else {
+                itBlob->second = r->GetBlob(blobName);
+            }
             if (contains(networkInputs, blobName)) {
                 _inputs[blobName] = itBlob->second;
             } else if (contains(networkOutputs, blobName)) {
@@ -49,18 +96,19 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
     });
 
     // go over all subnet and create requests
-    for (auto&& desc : _inferRequests) {
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        auto& desc = _inferRequests[requestId];
         desc._request = desc._network.CreateInferRequestPtr();
         // go over all inputs and get blobs from subnet infer requests
         for (auto&& outputInfo : desc._network.GetOutputsInfo()) {
-            requestBlob(outputInfo.first, desc._request);
+            requestBlob(outputInfo.first, requestId);
         }
     }
 
     // go over all outputs and get blobs from subnet infer requests
-    for (auto&& desc : _inferRequests) {
-        for (auto&& inputInfo : desc._network.GetInputsInfo()) {
-            requestBlob(inputInfo.first, desc._request);
+    for (std::size_t requestId = 0; requestId < _inferRequests.size(); ++requestId) {
+        for (auto&& inputInfo : _inferRequests[requestId]._network.GetInputsInfo()) {
+            requestBlob(inputInfo.first, requestId);
         }
     }
 }
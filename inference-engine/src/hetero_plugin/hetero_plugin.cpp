@@ -32,6 +32,7 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(MERGE_SUBGRAPHS)] = YES;
 }
 
 namespace {
@@ -194,9 +195,7 @@ void Engine::SetAffinity(InferenceEngine::ICNNNetwork &network, const Configs &c
     }
 }
 
-QueryNetworkResult Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config) const {
-    QueryNetworkResult qr;
-
+Engine::DeviceQueryResults Engine::QueryNetworkOnDevices(const ICNNNetwork &network, const Configs& config) const {
     if (GetCore() == nullptr) {
         THROW_IE_EXCEPTION << "Please, work with HETERO device via InferencEngine::Core object";
     }
@@ -210,7 +209,7 @@ QueryNetworkResult Engine::QueryNetwork(const ICNNNetwork &network, const Config
     std::string fallbackDevicesStr = it->second;
     DeviceMetaInformationMap metaDevices = GetDevicePlugins(fallbackDevicesStr, tconfig);
 
-    std::map<std::string, QueryNetworkResult> queryResults;
+    DeviceQueryResults queryResults;
     auto queryNetwork = [&] (const InferenceEngine::ICNNNetwork & networkObject) {
         // go over devices and call query network
         for (auto&& metaDevice : metaDevices) {
@@ -248,8 +247,17 @@ QueryNetworkResult Engine::QueryNetwork(const ICNNNetwork &network, const Config
         queryNetwork(network);
     }
 
+    return queryResults;
+}
+
+QueryNetworkResult Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config) const {
+    QueryNetworkResult qr;
+
+    auto queryResults = QueryNetworkOnDevices(network, config);
+
     //  WARNING: Here is devices with user set priority
-    auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
+    auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(
+        mergeConfigs(_config, config).at("TARGET_FALLBACK"));
 
     for (auto&& deviceName : fallbackDevices) {
         for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
@@ -272,6 +280,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(MERGE_SUBGRAPHS),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)});
@@ -288,6 +297,11 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(MERGE_SUBGRAPHS)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(MERGE_SUBGRAPHS));
+        IE_ASSERT(it != _config.end());
+        bool merge = it->second == YES;
+        return { merge };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
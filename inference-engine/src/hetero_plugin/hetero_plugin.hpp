@@ -21,6 +21,7 @@ class Engine : public InferenceEngine::InferencePluginInternal {
 public:
     using Configs = std::map<std::string, std::string>;
     using DeviceMetaInformationMap = std::unordered_map<std::string, Configs>;
+    using DeviceQueryResults = std::map<std::string, InferenceEngine::QueryNetworkResult>;
 
     Engine();
 
@@ -32,6 +33,12 @@ public:
     InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::ICNNNetwork &network,
                                                      const Configs& config) const override;
 
+    /**
+     * @brief Queries the network on each device from TARGET_FALLBACK
+     * @return Layers supported by each device, not resolved by device priority
+     */
+    DeviceQueryResults QueryNetworkOnDevices(const InferenceEngine::ICNNNetwork &network, const Configs& config) const;
+
     InferenceEngine::Parameter GetMetric(const std::string& name, const std::map<std::string,
                                          InferenceEngine::Parameter> & options) const override;
 
@@ -4,11 +4,16 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+#endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 
@@ -16,8 +21,109 @@
 
 namespace InferenceEngine {
 
+namespace {
+
+// strides of N, C, D, H, W dimensions, 4d blobs are copied as 5d ones with D == 1
+struct BlobStrides {
+    size_t N, C, D, H, W;
+};
+
+#ifdef HAVE_SSE
+inline bool blob_split_c3_sse42(const uint8_t* src, uint8_t* dst, size_t C_dst_stride, size_t W) {
+    blob_copy_4d_split_u8c3(src, dst, 0, 0, 0, 0, C_dst_stride, 1, 1, static_cast<int>(W));
+    return true;
+}
+
+inline bool blob_split_c3_sse42(const float* src, float* dst, size_t C_dst_stride, size_t W) {
+    blob_copy_4d_split_f32c3(src, dst, 0, 0, 0, 0, C_dst_stride, 1, 1, static_cast<int>(W));
+    return true;
+}
+
+template <typename data_t>
+inline bool blob_split_c3_sse42(const data_t*, data_t*, size_t, size_t) {
+    return false;
+}
+
+inline bool blob_merge_c3_sse42(const uint8_t* src, uint8_t* dst, size_t C_src_stride, size_t W) {
+    blob_copy_4d_merge_u8c3(src, dst, 0, 0, C_src_stride, 0, 0, 1, 1, static_cast<int>(W));
+    return true;
+}
+
+inline bool blob_merge_c3_sse42(const float* src, float* dst, size_t C_src_stride, size_t W) {
+    blob_copy_4d_merge_f32c3(src, dst, 0, 0, C_src_stride, 0, 0, 1, 1, static_cast<int>(W));
+    return true;
+}
+
+template <typename data_t>
+inline bool blob_merge_c3_sse42(const data_t*, data_t*, size_t, size_t) {
+    return false;
+}
+#endif  // HAVE_SSE
+
+/**
+ * Channels are split (NHWC -> NCHW) or merged (NCHW -> NHWC) row by row, every (n, d, h) row
+ * is a [W][C] <-> [C][W] transposition. Rows are distributed between threads of the calling thread arena,
+ * so a copy started from a stream task uses threads of that stream
+ */
+template <typename data_t>
+void blob_copy_t(const data_t* src_ptr, const BlobStrides& src_s, data_t* dst_ptr, const BlobStrides& dst_s,
+                 bool split_channels, bool merge_channels, size_t N, size_t C, size_t D, size_t H, size_t W) {
+#ifdef HAVE_SSE
+    const bool sse42 = with_cpu_x86_sse42();
+#endif
+#ifdef HAVE_AVX2
+    const bool avx2 = with_cpu_x86_avx2();
+#endif
+
+    if (split_channels) {
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            const data_t* src_row = src_ptr + n * src_s.N + d * src_s.D + h * src_s.H;
+            data_t* dst_row = dst_ptr + n * dst_s.N + d * dst_s.D + h * dst_s.H;
+#ifdef HAVE_SSE
+            if (sse42 && C == 3 && src_s.C == 1 && src_s.W == 3 && dst_s.W == 1 &&
+                blob_split_c3_sse42(src_row, dst_row, dst_s.C, W))
+                return;
+#endif
+#ifdef HAVE_AVX2
+            if (avx2 && C >= 8 && W >= 8 && src_s.C == 1 && dst_s.W == 1) {
+                blob_transpose_avx2(src_row, src_s.W, dst_row, dst_s.C, W, C);
+                return;
+            }
+#endif
+            for (size_t c = 0; c < C; c++)
+                for (size_t w = 0; w < W; w++)
+                    dst_row[c * dst_s.C + w * dst_s.W] = src_row[w * src_s.W + c * src_s.C];
+        });
+    } else if (merge_channels) {
+        parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+            const data_t* src_row = src_ptr + n * src_s.N + d * src_s.D + h * src_s.H;
+            data_t* dst_row = dst_ptr + n * dst_s.N + d * dst_s.D + h * dst_s.H;
+#ifdef HAVE_SSE
+            if (sse42 && C == 3 && dst_s.C == 1 && dst_s.W == 3 && src_s.W == 1 &&
+                blob_merge_c3_sse42(src_row, dst_row, src_s.C, W))
+                return;
+#endif
+#ifdef HAVE_AVX2
+            if (avx2 && C >= 8 && W >= 8 && src_s.W == 1 && dst_s.C == 1) {
+                blob_transpose_avx2(src_row, src_s.C, dst_row, dst_s.W, C, W);
+                return;
+            }
+#endif
+            for (size_t w = 0; w < W; w++)
+                for (size_t c = 0; c < C; c++)
+                    dst_row[w * dst_s.W + c * dst_s.C] = src_row[c * src_s.C + w * src_s.W];
+        });
+    } else {
+        const size_t plane = D * H * W;
+        parallel_for2d(N, C, [&](size_t n, size_t c) {
+            const size_t offset = (n * C + c) * plane;
+            std::copy(src_ptr + offset, src_ptr + offset + plane, dst_ptr + offset);
+        });
+    }
+}
+
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
+void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
     auto* src_ptr = src->buffer().as<data_t*>();
@@ -33,96 +139,24 @@ static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
     const Layout src_l = src->getTensorDesc().getLayout();
     const auto& src_blk_dsc = src->getTensorDesc().getBlockingDesc();
     const auto& src_strides = src_blk_dsc.getStrides();
-    const auto N_src_stride = src_strides[0];
-    const auto C_src_stride = src_l == NHWC ? src_strides[3] : src_strides[1];
-    const auto H_src_stride = src_l == NHWC ? src_strides[1] : src_strides[2];
-    const auto W_src_stride = src_l == NHWC ? src_strides[2] : src_strides[3];
+    const BlobStrides src_s = {src_strides[0], src_l == NHWC ? src_strides[3] : src_strides[1], 0,
+                               src_l == NHWC ? src_strides[1] : src_strides[2],
+                               src_l == NHWC ? src_strides[2] : src_strides[3]};
     src_ptr += src_blk_dsc.getOffsetPadding();
 
     const Layout dst_l = dst->getTensorDesc().getLayout();
     const auto& dst_blk_desc = dst->getTensorDesc().getBlockingDesc();
     const auto& dst_strides = dst_blk_desc.getStrides();
-    const auto N_dst_stride = dst_strides[0];
-    const auto C_dst_stride = dst_l == NHWC ? dst_strides[3] : dst_strides[1];
-    const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
-    const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
-
-    src_ptr += dst_blk_desc.getOffsetPadding();
+    const BlobStrides dst_s = {dst_strides[0], dst_l == NHWC ? dst_strides[3] : dst_strides[1], 0,
+                               dst_l == NHWC ? dst_strides[1] : dst_strides[2],
+                               dst_l == NHWC ? dst_strides[2] : dst_strides[3]};
+    dst_ptr += dst_blk_desc.getOffsetPadding();
 
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-    }
-
-    if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
-        }
-    }
-#endif  // HAVE_SSE
-
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (int h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (int w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
-    } else {
-        for (int i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
-    }
+    blob_copy_t(src_ptr, src_s, dst_ptr, dst_s, src_l == NHWC && dst_l == NCHW, src_l == NCHW && dst_l == NHWC,
+                N, C, 1, H, W);
 }
 
-static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
+inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
     switch (src->getTensorDesc().getPrecision()) {
     case Precision::FP32:
     case Precision::I32:
@@ -147,7 +181,7 @@ static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
 }
 
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
+void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
     const auto& src_blk_desc = src->getTensorDesc().getBlockingDesc();
@@ -166,101 +200,23 @@ static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
 
     const Layout src_l = src->getTensorDesc().getLayout();
     const auto& src_strides = src_blk_desc.getStrides();
-    const auto N_src_stride = src_strides[0];
-    const auto C_src_stride = src_l == NDHWC ? src_strides[4] : src_strides[1];
-    const auto D_src_stride = src_l == NDHWC ? src_strides[1] : src_strides[2];
-    const auto H_src_stride = src_l == NDHWC ? src_strides[2] : src_strides[3];
-    const auto W_src_stride = src_l == NDHWC ? src_strides[3] : src_strides[4];
+    const BlobStrides src_s = {src_strides[0], src_l == NDHWC ? src_strides[4] : src_strides[1],
+                               src_l == NDHWC ? src_strides[1] : src_strides[2],
+                               src_l == NDHWC ? src_strides[2] : src_strides[3],
+                               src_l == NDHWC ? src_strides[3] : src_strides[4]};
 
     const Layout dst_l = dst->getTensorDesc().getLayout();
     const auto& dst_strides = dst_blk_desc.getStrides();
-    const auto N_dst_stride = dst_strides[0];
-    const auto C_dst_stride = dst_l == NDHWC ? dst_strides[4] : dst_strides[1];
-    const auto D_dst_stride = dst_l == NDHWC ? dst_strides[1] : dst_strides[2];
-    const auto H_dst_stride = dst_l == NDHWC ? dst_strides[2] : dst_strides[3];
-    const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
+    const BlobStrides dst_s = {dst_strides[0], dst_l == NDHWC ? dst_strides[4] : dst_strides[1],
+                               dst_l == NDHWC ? dst_strides[1] : dst_strides[2],
+                               dst_l == NDHWC ? dst_strides[2] : dst_strides[3],
+                               dst_l == NDHWC ? dst_strides[3] : dst_strides[4]};
 
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                    C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                     C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-
-    if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                    H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                     H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-#endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (int n = 0; n < N; n++) {
-            for (int c = 0; c < C; c++) {
-                for (int d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (int h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (int w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        for (int i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
-    }
+    blob_copy_t(src_ptr, src_s, dst_ptr, dst_s, src_l == NDHWC && dst_l == NCDHW, src_l == NCDHW && dst_l == NDHWC,
+                N, C, D, H, W);
 }
 
-static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
+inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
     switch (src->getTensorDesc().getPrecision()) {
     case Precision::FP32:
     case Precision::I32:
@@ -284,6 +240,8 @@ static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
     }
 }
 
+}  // namespace
+
 void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
     if (src->buffer() == nullptr) THROW_IE_EXCEPTION << "Cannot copy blob data. Source is not allocated.";
 
@@ -54,6 +54,61 @@ static std::shared_ptr<ngraph::Function> copyFunction(const std::shared_ptr<cons
     return specialized_function;
 }
 
+// Folds only the constant subgraphs whose values may define shapes of other operations, e.g. ShapeOf->Gather->Concat->Reshape
+// chains, so subgraphs computing data (e.g. weights decompression) are not evaluated again at every reshape.
+// Returns false if some results are still dynamic after the folding
+static bool foldShapeSubgraphs(const std::shared_ptr<ngraph::Function>& func) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE, "foldShapeSubgraphs");
+
+    const auto ops = func->get_ordered_ops();
+    // integer inputs of operations with dynamic outputs may define the shapes, as well as all inputs of such values
+    std::unordered_set<const ngraph::Node*> shapeValues;
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it) {
+        const auto& node = *it;
+        const bool isShapeValue = shapeValues.count(node.get()) != 0;
+        bool isDynamic = false;
+        for (const auto& output : node->outputs())
+            isDynamic |= output.get_partial_shape().is_dynamic();
+        // only the shape of the ShapeOf input is used
+        if ((!isShapeValue && !isDynamic) ||
+            ngraph::is_type<ngraph::op::v0::ShapeOf>(node) || ngraph::is_type<ngraph::op::v3::ShapeOf>(node))
+            continue;
+        for (const auto& input : node->inputs()) {
+            if (isShapeValue || input.get_element_type().is_integral_number())
+                shapeValues.insert(input.get_source_output().get_node());
+        }
+    }
+
+    for (const auto& node : ops) {
+        node->revalidate_and_infer_types();
+        if (auto subGraph = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(node)) {
+            if (auto body = subGraph->get_function())
+                foldShapeSubgraphs(body);
+            continue;
+        }
+        if (shapeValues.count(node.get()) == 0)
+            continue;
+
+        ngraph::OutputVector replacements(node->get_output_size());
+        if (!node->constant_fold(replacements, node->input_values()))
+            continue;
+        for (size_t i = 0; i < replacements.size(); ++i) {
+            const auto& replacement = replacements[i];
+            if (replacement.get_node_shared_ptr() && node->output(i) != replacement) {
+                replacement.get_node_shared_ptr()->set_friendly_name(
+                    replacements.size() == 1 ? node->get_friendly_name() : node->get_friendly_name() + "." + std::to_string(i));
+                node->output(i).replace(replacement);
+            }
+        }
+    }
+
+    for (const auto& result : func->get_results()) {
+        if (result->get_input_partial_shape(0).is_dynamic())
+            return false;
+    }
+    return true;
+}
+
 CNNNetwork::CNNNetwork(const std::shared_ptr<ngraph::Function>& graph,
                        const std::vector<IExtensionPtr>& exts) {
     OV_ITT_SCOPED_TASK(itt::domains::IE, "CNNNetwork::CNNNetwork");
@@ -341,11 +396,17 @@ CNNNetworkNGraphImpl::reshape(const std::map<std::string, std::vector<size_t>>&
             ::ngraph::pass::Manager manager;
             // resolves dynamism by replacing dynamic operation with static version
             manager.register_pass<::ngraph::pass::ConvertNMS5ToLegacyMatcher>();
-            manager.register_pass<::ngraph::pass::ConstantFolding>();
+            manager.run_passes(specialized_ngraph_function);
+            // the shapes are known once the shape subgraphs are folded, other constants are left as is unless
+            // something is still dynamic
+            if (!foldShapeSubgraphs(specialized_ngraph_function)) {
+                ::ngraph::pass::ConstantFolding().run_on_function(specialized_ngraph_function);
+            }
             // OneHotToLegacy changes output precision
-            manager.register_pass<::ngraph::pass::ConvertOneHotToOneHotIEMatcher>()->detect_output_type(
+            ::ngraph::pass::Manager legacy_manager;
+            legacy_manager.register_pass<::ngraph::pass::ConvertOneHotToOneHotIEMatcher>()->detect_output_type(
                     specialized_ngraph_function);
-            manager.run_passes(specialized_ngraph_function);
+            legacy_manager.run_passes(specialized_ngraph_function);
         }
         specialized_ngraph_function->validate_nodes_and_infer_types();
 
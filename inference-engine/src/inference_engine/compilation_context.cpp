@@ -0,0 +1,210 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_context.hpp"
+
+#include <sys/stat.h>
+
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <ie_version.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/op/constant.hpp>
+
+#include "file_utils.h"
+#include "ie_itt.hpp"
+
+#ifdef _WIN32
+# include <direct.h>
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+# define mkdir(dir, mode) _wmkdir(dir)
+#else
+# define mkdir(dir, mode) _mkdir(dir)
+#endif  // ENABLE_UNICODE_PATH_SUPPORT
+#endif  // _WIN32
+
+namespace InferenceEngine {
+
+namespace {
+
+template <typename T>
+void hash_combine(uint64_t& seed, const T& value) {
+    seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+// FNV-1a over raw bytes: cheap enough to run over all the weights of large models
+void hash_bytes(uint64_t& seed, const void* data, size_t size) {
+    constexpr uint64_t prime = 0x100000001b3ULL;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        h = (h ^ bytes[i]) * prime;
+    }
+    hash_combine(seed, h);
+}
+
+class HashVisitor : public ngraph::AttributeVisitor {
+    uint64_t& m_seed;
+
+    template <typename T>
+    void hash_vector(const std::string& name, const std::vector<T>& values) {
+        hash_combine(m_seed, name);
+        for (auto&& value : values) {
+            hash_combine(m_seed, value);
+        }
+    }
+
+public:
+    explicit HashVisitor(uint64_t& seed) : m_seed(seed) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        hash_combine(m_seed, name);
+        hash_combine(m_seed, std::string(adapter.get_type_info().name));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        hash_combine(m_seed, name);
+        hash_bytes(m_seed, adapter.get_ptr(), adapter.size());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        hash_combine(m_seed, name);
+        hash_combine(m_seed, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        hash_combine(m_seed, name);
+        hash_combine(m_seed, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        hash_combine(m_seed, name);
+        hash_combine(m_seed, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        hash_combine(m_seed, name);
+        hash_combine(m_seed, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hash_vector(name, adapter.get());
+    }
+};
+
+void hashFunction(uint64_t& seed, const ngraph::Function& function) {
+    std::unordered_map<const ngraph::Node*, size_t> ids;
+    size_t id = 0;
+    for (auto&& node : function.get_ordered_ops()) {
+        ids[node.get()] = id++;
+
+        const auto& typeInfo = node->get_type_info();
+        hash_combine(seed, std::string(typeInfo.name));
+        hash_combine(seed, typeInfo.version);
+        hash_combine(seed, node->get_friendly_name());
+
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            hash_combine(seed, ids[source.get_node()]);
+            hash_combine(seed, source.get_index());
+        }
+        for (auto&& output : node->outputs()) {
+            hash_combine(seed, output.get_element_type().get_type_name());
+            std::stringstream shape;
+            shape << output.get_partial_shape();
+            hash_combine(seed, shape.str());
+        }
+
+        HashVisitor visitor(seed);
+        // visit_attributes expects a mutable node, but the visitor above only reads values
+        std::const_pointer_cast<ngraph::Node>(node)->visit_attributes(visitor);
+    }
+}
+
+}  // namespace
+
+std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
+                                                   const std::string& deviceName,
+                                                   const std::map<std::string, std::string>& compileOptions) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeHash");
+
+    auto function = network.getFunction();
+    if (function == nullptr) {
+        THROW_IE_EXCEPTION << "Only networks represented as ngraph::Function can be cached";
+    }
+
+    uint64_t seed = 0;
+    hash_combine(seed, std::string(GetInferenceEngineVersion()->buildNumber));
+    hash_combine(seed, deviceName);
+    for (auto&& option : compileOptions) {
+        hash_combine(seed, option.first);
+        hash_combine(seed, option.second);
+    }
+
+    hashFunction(seed, *function);
+
+    // inputs / outputs settings affect the compiled representation as well
+    for (auto&& input : network.getInputsInfo()) {
+        const auto& info = input.second;
+        hash_combine(seed, input.first);
+        hash_combine(seed, static_cast<int>(info->getPrecision()));
+        hash_combine(seed, static_cast<int>(info->getLayout()));
+        const auto& preProcess = info->getPreProcess();
+        hash_combine(seed, static_cast<int>(preProcess.getMeanVariant()));
+        hash_combine(seed, static_cast<int>(preProcess.getResizeAlgorithm()));
+        hash_combine(seed, static_cast<int>(preProcess.getColorFormat()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); ++c) {
+            const auto& channel = preProcess[c];
+            hash_combine(seed, channel->stdScale);
+            hash_combine(seed, channel->meanValue);
+            if (channel->meanData != nullptr) {
+                hash_bytes(seed, channel->meanData->cbuffer().as<const void*>(), channel->meanData->byteSize());
+            }
+        }
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        hash_combine(seed, output.first);
+        hash_combine(seed, static_cast<int>(output.second->getPrecision()));
+        hash_combine(seed, static_cast<int>(output.second->getLayout()));
+    }
+
+    std::stringstream hash;
+    hash << std::hex << std::setw(16) << std::setfill('0') << seed;
+    return hash.str();
+}
+
+std::string NetworkCompilationContext::blobPath(const std::string& cacheDir, const std::string& hash,
+                                               const std::string& fingerprint) {
+    if (fingerprint.empty()) {
+        return FileUtils::makePath(cacheDir, hash + ".blob");
+    }
+    uint64_t seed = 0;
+    hash_combine(seed, fingerprint);
+    std::stringstream variant;
+    variant << std::hex << std::setw(16) << std::setfill('0') << seed;
+    return FileUtils::makePath(cacheDir, hash + "." + variant.str() + ".blob");
+}
+
+void NetworkCompilationContext::createCacheDir(const std::string& cacheDir) {
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    std::wstring widepath = FileUtils::multiByteCharToWString(cacheDir.c_str());
+    const wchar_t* path = widepath.c_str();
+#else
+    const char* path = cacheDir.c_str();
+#endif
+
+    auto err = mkdir(path, 0755);
+    if (err != 0 && errno != EEXIST) {
+        THROW_IE_EXCEPTION << "Couldn't create cache directory " << cacheDir << " (err=" << err << "; errno=" << errno << ")";
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Helpers to compute a key of a compiled network for the Core level cache
+ * @file compilation_context.hpp
+ */
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+
+#include <map>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Computes stable hashes used to identify compiled networks in a cache directory
+ */
+struct NetworkCompilationContext final {
+    /**
+     * @brief Computes a hash of network topology, weights and input / output settings
+     *        combined with the device name and the compilation config
+     * @param network A network to compute hash for. Only networks with ngraph::Function are supported
+     * @param deviceName A device name (without device ID)
+     * @param compileOptions A config passed to LoadNetwork
+     * @return A hex string with 64-bit hash value
+     */
+    static std::string computeHash(const CNNNetwork& network,
+                                   const std::string& deviceName,
+                                   const std::map<std::string, std::string>& compileOptions);
+
+    /**
+     * @brief Creates a path to a cached blob for the given hash
+     * @param cacheDir A directory with cached blobs
+     * @param hash A hash returned by computeHash
+     * @param fingerprint A value of METRIC_KEY(IMPORT_EXPORT_FINGERPRINT) of the device or empty string.
+     *        Blobs of one network with different fingerprints have the same hash prefix and coexist in the directory
+     * @return A full path to a blob file
+     */
+    static std::string blobPath(const std::string& cacheDir, const std::string& hash,
+                                const std::string& fingerprint = {});
+
+    /**
+     * @brief Creates a cache directory if it does not exist yet
+     * @param cacheDir A directory to create
+     */
+    static void createCacheDir(const std::string& cacheDir);
+};
+
+}  // namespace InferenceEngine
@@ -0,0 +1,101 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "constants_sharing.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/graph_util.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/op/constant.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
+
+#include "ie_itt.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+using ConstantPtr = std::shared_ptr<ngraph::op::v0::Constant>;
+
+size_t byteSize(const ConstantPtr& constant) {
+    return ngraph::shape_size(constant->get_shape()) * constant->get_element_type().size();
+}
+
+uint64_t hashConstant(const ConstantPtr& constant) {
+    // FNV-1a over the content, type and shape are checked on lookup
+    constexpr uint64_t prime = 0x100000001b3ULL;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    auto bytes = static_cast<const uint8_t*>(constant->get_data_ptr());
+    for (size_t i = 0, size = byteSize(constant); i < size; ++i) {
+        h = (h ^ bytes[i]) * prime;
+    }
+    return h ^ std::hash<size_t>()(ngraph::shape_size(constant->get_shape()));
+}
+
+bool isSame(const ConstantPtr& lhs, const ConstantPtr& rhs) {
+    return lhs->get_element_type() == rhs->get_element_type() && lhs->get_shape() == rhs->get_shape() &&
+           std::memcmp(lhs->get_data_ptr(), rhs->get_data_ptr(), byteSize(lhs)) == 0;
+}
+
+void replaceConstant(const ConstantPtr& constant, const ConstantPtr& replacement) {
+    replacement->set_friendly_name(constant->get_friendly_name());
+    ngraph::copy_runtime_info(constant, replacement);
+    ngraph::replace_node(constant, replacement);
+}
+
+}  // namespace
+
+size_t SharedConstants::share(CNNNetwork& network) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE, "SharedConstants::share");
+    auto function = network.getFunction();
+    if (!function)
+        return 0;
+
+    std::vector<ConstantPtr> constants;
+    for (auto&& node : function->get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::v0::Constant>(node)) {
+            if (constant->get_data_ptr() != nullptr)
+                constants.push_back(constant);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto it = _constants.begin(); it != _constants.end();) {
+        it = it->second.expired() ? _constants.erase(it) : std::next(it);
+    }
+
+    size_t shared = 0;
+    for (auto&& constant : constants) {
+        auto hash = hashConstant(constant);
+        ConstantPtr known;
+        auto range = _constants.equal_range(hash);
+        for (auto it = range.first; it != range.second && !known; ++it) {
+            auto candidate = it->second.lock();
+            if (candidate && isSame(candidate, constant))
+                known = candidate;
+        }
+
+        if (known == constant) {
+            continue;
+        } else if (known) {
+            // the buffer keeps the known constant alive, so it outlives the network it was read with
+            auto data = static_cast<char*>(const_cast<void*>(known->get_data_ptr()));
+            auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<ConstantPtr>>(data, byteSize(known), known);
+            replaceConstant(constant, std::make_shared<ngraph::op::v0::Constant>(
+                constant->get_element_type(), constant->get_shape(), buffer));
+            shared++;
+        } else {
+            auto copy = std::make_shared<ngraph::op::v0::Constant>(
+                constant->get_element_type(), constant->get_shape(), constant->get_data_ptr());
+            replaceConstant(constant, copy);
+            _constants.emplace(hash, copy);
+        }
+    }
+    return shared;
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Deduplication of constants between networks read by one Core
+ * @file constants_sharing.hpp
+ */
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace ngraph {
+namespace op {
+namespace v0 {
+class Constant;
+}  // namespace v0
+}  // namespace op
+}  // namespace ngraph
+
+namespace InferenceEngine {
+
+/**
+ * @brief Keeps weak references to the constants of all networks read by a Core with CONFIG_KEY(SHARE_CONSTANTS),
+ *        so constants with the same type, shape and content reference one buffer
+ *
+ * Is a thread safe
+ */
+class SharedConstants final {
+public:
+    /**
+     * @brief Replaces constants of the network which are already known by constants referencing the known buffers.
+     *        Other constants are copied to own buffers and registered, so they do not keep alive the whole
+     *        weights blob of the network the first one was read from
+     * @param network A network to process. Networks without ngraph::Function are left as is
+     * @return A number of the constants which were replaced by the shared ones
+     */
+    size_t share(CNNNetwork& network);
+
+private:
+    std::unordered_multimap<uint64_t, std::weak_ptr<ngraph::op::v0::Constant>> _constants;
+    std::mutex _mutex;
+};
+
+}  // namespace InferenceEngine
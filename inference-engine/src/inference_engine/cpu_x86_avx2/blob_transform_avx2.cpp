@@ -0,0 +1,138 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// 8x8 tiles transposed in registers
+//
+//------------------------------------------------------------------------
+
+static inline void transpose_8x8(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride) {
+    __m128i a[8];
+    for (int k = 0; k < 8; k++)
+        a[k] = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + k * src_stride));
+
+    const __m128i b0 = _mm_unpacklo_epi8(a[0], a[1]);
+    const __m128i b1 = _mm_unpacklo_epi8(a[2], a[3]);
+    const __m128i b2 = _mm_unpacklo_epi8(a[4], a[5]);
+    const __m128i b3 = _mm_unpacklo_epi8(a[6], a[7]);
+
+    const __m128i c0 = _mm_unpacklo_epi16(b0, b1);
+    const __m128i c1 = _mm_unpackhi_epi16(b0, b1);
+    const __m128i c2 = _mm_unpacklo_epi16(b2, b3);
+    const __m128i c3 = _mm_unpackhi_epi16(b2, b3);
+
+    // every register keeps two columns
+    const __m128i d[4] = {_mm_unpacklo_epi32(c0, c2), _mm_unpackhi_epi32(c0, c2),
+                          _mm_unpacklo_epi32(c1, c3), _mm_unpackhi_epi32(c1, c3)};
+    for (int k = 0; k < 4; k++) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + (2 * k) * dst_stride), d[k]);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + (2 * k + 1) * dst_stride), _mm_unpackhi_epi64(d[k], d[k]));
+    }
+}
+
+static inline void transpose_8x8(const uint16_t* src, size_t src_stride, uint16_t* dst, size_t dst_stride) {
+    __m128i a[8];
+    for (int k = 0; k < 8; k++)
+        a[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + k * src_stride));
+
+    const __m128i b0 = _mm_unpacklo_epi16(a[0], a[1]);
+    const __m128i b1 = _mm_unpackhi_epi16(a[0], a[1]);
+    const __m128i b2 = _mm_unpacklo_epi16(a[2], a[3]);
+    const __m128i b3 = _mm_unpackhi_epi16(a[2], a[3]);
+    const __m128i b4 = _mm_unpacklo_epi16(a[4], a[5]);
+    const __m128i b5 = _mm_unpackhi_epi16(a[4], a[5]);
+    const __m128i b6 = _mm_unpacklo_epi16(a[6], a[7]);
+    const __m128i b7 = _mm_unpackhi_epi16(a[6], a[7]);
+
+    const __m128i c0 = _mm_unpacklo_epi32(b0, b2);
+    const __m128i c1 = _mm_unpackhi_epi32(b0, b2);
+    const __m128i c2 = _mm_unpacklo_epi32(b1, b3);
+    const __m128i c3 = _mm_unpackhi_epi32(b1, b3);
+    const __m128i c4 = _mm_unpacklo_epi32(b4, b6);
+    const __m128i c5 = _mm_unpackhi_epi32(b4, b6);
+    const __m128i c6 = _mm_unpacklo_epi32(b5, b7);
+    const __m128i c7 = _mm_unpackhi_epi32(b5, b7);
+
+    const __m128i d[8] = {_mm_unpacklo_epi64(c0, c4), _mm_unpackhi_epi64(c0, c4),
+                          _mm_unpacklo_epi64(c1, c5), _mm_unpackhi_epi64(c1, c5),
+                          _mm_unpacklo_epi64(c2, c6), _mm_unpackhi_epi64(c2, c6),
+                          _mm_unpacklo_epi64(c3, c7), _mm_unpackhi_epi64(c3, c7)};
+    for (int k = 0; k < 8; k++)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + k * dst_stride), d[k]);
+}
+
+static inline void transpose_8x8(const float* src, size_t src_stride, float* dst, size_t dst_stride) {
+    __m256 a[8];
+    for (int k = 0; k < 8; k++)
+        a[k] = _mm256_loadu_ps(src + k * src_stride);
+
+    const __m256 b0 = _mm256_unpacklo_ps(a[0], a[1]);
+    const __m256 b1 = _mm256_unpackhi_ps(a[0], a[1]);
+    const __m256 b2 = _mm256_unpacklo_ps(a[2], a[3]);
+    const __m256 b3 = _mm256_unpackhi_ps(a[2], a[3]);
+    const __m256 b4 = _mm256_unpacklo_ps(a[4], a[5]);
+    const __m256 b5 = _mm256_unpackhi_ps(a[4], a[5]);
+    const __m256 b6 = _mm256_unpacklo_ps(a[6], a[7]);
+    const __m256 b7 = _mm256_unpackhi_ps(a[6], a[7]);
+
+    const __m256 c0 = _mm256_shuffle_ps(b0, b2, 0x44);
+    const __m256 c1 = _mm256_shuffle_ps(b0, b2, 0xEE);
+    const __m256 c2 = _mm256_shuffle_ps(b1, b3, 0x44);
+    const __m256 c3 = _mm256_shuffle_ps(b1, b3, 0xEE);
+    const __m256 c4 = _mm256_shuffle_ps(b4, b6, 0x44);
+    const __m256 c5 = _mm256_shuffle_ps(b4, b6, 0xEE);
+    const __m256 c6 = _mm256_shuffle_ps(b5, b7, 0x44);
+    const __m256 c7 = _mm256_shuffle_ps(b5, b7, 0xEE);
+
+    const __m256 d[8] = {_mm256_permute2f128_ps(c0, c4, 0x20), _mm256_permute2f128_ps(c1, c5, 0x20),
+                         _mm256_permute2f128_ps(c2, c6, 0x20), _mm256_permute2f128_ps(c3, c7, 0x20),
+                         _mm256_permute2f128_ps(c0, c4, 0x31), _mm256_permute2f128_ps(c1, c5, 0x31),
+                         _mm256_permute2f128_ps(c2, c6, 0x31), _mm256_permute2f128_ps(c3, c7, 0x31)};
+    for (int k = 0; k < 8; k++)
+        _mm256_storeu_ps(dst + k * dst_stride, d[k]);
+}
+
+template <typename data_t>
+static void blob_transpose(const data_t* src, size_t src_stride, data_t* dst, size_t dst_stride, size_t rows,
+                           size_t cols) {
+    const size_t rows8 = rows & ~static_cast<size_t>(7);
+    const size_t cols8 = cols & ~static_cast<size_t>(7);
+
+    for (size_t i = 0; i < rows8; i += 8) {
+        for (size_t j = 0; j < cols8; j += 8)
+            transpose_8x8(src + i * src_stride + j, src_stride, dst + j * dst_stride + i, dst_stride);
+
+        for (size_t j = cols8; j < cols; j++)
+            for (size_t k = i; k < i + 8; k++)
+                dst[j * dst_stride + k] = src[k * src_stride + j];
+    }
+
+    for (size_t i = rows8; i < rows; i++)
+        for (size_t j = 0; j < cols; j++)
+            dst[j * dst_stride + i] = src[i * src_stride + j];
+}
+
+void blob_transpose_avx2(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t rows,
+                         size_t cols) {
+    blob_transpose(src, src_stride, dst, dst_stride, rows, cols);
+}
+
+void blob_transpose_avx2(const uint16_t* src, size_t src_stride, uint16_t* dst, size_t dst_stride, size_t rows,
+                         size_t cols) {
+    blob_transpose(src, src_stride, dst, dst_stride, rows, cols);
+}
+
+void blob_transpose_avx2(const float* src, size_t src_stride, float* dst, size_t dst_stride, size_t rows,
+                         size_t cols) {
+    blob_transpose(src, src_stride, dst, dst_stride, rows, cols);
+}
+
+}  // namespace InferenceEngine
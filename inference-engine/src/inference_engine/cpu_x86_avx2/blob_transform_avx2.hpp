@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Blob-transpose primitives manually vectored for AVX2 (w/o threads)
+//
+// dst[j * dst_stride + i] = src[i * src_stride + j] for i < rows, j < cols,
+// so a [W][C] pixel row becomes [C][W] planes and vice versa
+//
+//------------------------------------------------------------------------
+
+void blob_transpose_avx2(const uint8_t* src, size_t src_stride, uint8_t* dst, size_t dst_stride, size_t rows,
+                         size_t cols);
+
+void blob_transpose_avx2(const uint16_t* src, size_t src_stride, uint16_t* dst, size_t dst_stride, size_t rows,
+                         size_t cols);
+
+void blob_transpose_avx2(const float* src, size_t src_stride, float* dst, size_t dst_stride, size_t rows,
+                         size_t cols);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_sse42/precision_utils_sse42.hpp"
+#include "precision_utils.h"
+
+#include <nmmintrin.h>  // SSE 4.2
+
+namespace InferenceEngine {
+
+// The vector code repeats PrecisionUtils::f16tof32 and PrecisionUtils::f32tof16 lane by lane,
+// tails are converted by the scalar functions
+
+static inline __m128 mm_f16tof32(__m128i h) {
+    const __m128i s = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+    __m128i o = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13);
+    const __m128i e = _mm_and_si128(o, _mm_set1_epi32(0x7C00 << 13));
+    const __m128i expAdjust = _mm_set1_epi32((127 - 15) << 23);
+
+    // rebias exponent, INF and NAN get the maximal exponent, NAN becomes quiet
+    o = _mm_add_epi32(o, expAdjust);
+    const __m128i infNan = _mm_cmpeq_epi32(e, _mm_set1_epi32(0x7C00 << 13));
+    const __m128i nan = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(h, _mm_set1_epi32(0x03FF)), _mm_setzero_si128()),
+                                         infNan);
+    o = _mm_add_epi32(o, _mm_and_si128(infNan, expAdjust));
+    o = _mm_or_si128(o, _mm_and_si128(nan, _mm_set1_epi32(0x0200 << 13)));
+
+    // zeros and denormals are normalized exactly by the float subtraction of 2^-14
+    const __m128i zeroDenorm = _mm_cmpeq_epi32(e, _mm_setzero_si128());
+    const __m128i denormBits = _mm_add_epi32(o, _mm_set1_epi32(1 << 23));
+    const __m128 denorm = _mm_sub_ps(_mm_castsi128_ps(denormBits), _mm_castsi128_ps(_mm_set1_epi32(113 << 23)));
+    o = _mm_blendv_epi8(o, _mm_castps_si128(denorm), zeroDenorm);
+
+    return _mm_castsi128_ps(_mm_or_si128(o, s));
+}
+
+static inline __m128i mm_f32tof16(__m128 x) {
+    const __m128i expMask = _mm_set1_epi32(0x7F800000);
+    const __m128i u = _mm_castps_si128(x);
+    const __m128i s = _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(0x8000));
+    const __m128i a = _mm_and_si128(u, _mm_set1_epi32(0x7FFFFFFF));
+
+    // INF and NAN, NAN becomes quiet
+    const __m128i infNan = _mm_cmpeq_epi32(_mm_and_si128(a, expMask), expMask);
+    const __m128i nan = _mm_cmpgt_epi32(a, expMask);
+    __m128i special = _mm_and_si128(_mm_srli_epi32(a, 23 - 10), _mm_set1_epi32(0x7FFF));
+    special = _mm_or_si128(special, _mm_and_si128(nan, _mm_set1_epi32(0x0200)));
+
+    // round to nearest by adding of a half of f16 ULP
+    const __m128 halfULP = _mm_mul_ps(_mm_castsi128_ps(_mm_and_si128(a, expMask)),
+                                      _mm_castsi128_ps(_mm_set1_epi32((127 - 11) << 23)));
+    const __m128 v = _mm_add_ps(_mm_castsi128_ps(a), halfULP);
+
+    const __m128 min16 = _mm_castsi128_ps(_mm_set1_epi32((127 - 14) << 23));
+    const __m128 max16 = _mm_castsi128_ps(_mm_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+    __m128i r = _mm_srli_epi32(_mm_sub_epi32(_mm_castps_si128(v), _mm_set1_epi32((127 - 15) << 23)), 23 - 10);
+    r = _mm_blendv_epi8(r, _mm_set1_epi32(((15 + 15) << 10) | 0x3FF), _mm_castps_si128(_mm_cmpge_ps(v, max16)));
+    r = _mm_blendv_epi8(r, _mm_set1_epi32(1 << 10), _mm_castps_si128(_mm_cmplt_ps(v, min16)));
+    r = _mm_andnot_si128(_mm_castps_si128(_mm_cmplt_ps(v, _mm_mul_ps(min16, _mm_set1_ps(0.5f)))), r);
+
+    r = _mm_blendv_epi8(r, special, infNan);
+    return _mm_or_si128(r, s);
+}
+
+static inline __m128i mm_f32tobf16(__m128 x) {
+    const __m128i u = _mm_castps_si128(x);
+    const __m128i lsb = _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(1));
+    const __m128i rounded = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(u, _mm_set1_epi32(0x7FFF)), lsb), 16);
+    const __m128i nan = _mm_cmpgt_epi32(_mm_and_si128(u, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));
+    const __m128i quietNan = _mm_or_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(0x0040));
+    return _mm_blendv_epi8(rounded, quietNan, nan);
+}
+
+static inline __m128 mm_bf16tof32(__m128i h) {
+    return _mm_castsi128_ps(_mm_slli_epi32(h, 16));
+}
+
+void f16tof32Arrays_sse42(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128 lo = mm_f16tof32(_mm_cvtepu16_epi32(h));
+        const __m128 hi = mm_f16tof32(_mm_cvtepu16_epi32(_mm_srli_si128(h, 8)));
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(lo, vscale), vbias));
+        _mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_mul_ps(hi, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tof16Arrays_sse42(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m128 lo = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), vscale), vbias);
+        const __m128 hi = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), vscale), vbias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi32(mm_f32tof16(lo), mm_f32tof16(hi)));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+void bf16tof32Arrays_sse42(float* dst, const short* src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128 lo = mm_bf16tof32(_mm_cvtepu16_epi32(h));
+        const __m128 hi = mm_bf16tof32(_mm_cvtepu16_epi32(_mm_srli_si128(h, 8)));
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(lo, vscale), vbias));
+        _mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_mul_ps(hi, vscale), vbias));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::bf16tof32(src[i]) * scale + bias;
+    }
+}
+
+void f32tobf16Arrays_sse42(short* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        const __m128 lo = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i), vscale), vbias);
+        const __m128 hi = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), vscale), vbias);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi32(mm_f32tobf16(lo), mm_f32tobf16(hi)));
+    }
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tobf16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace InferenceEngine
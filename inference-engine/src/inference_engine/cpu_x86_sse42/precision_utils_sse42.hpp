@@ -0,0 +1,27 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// FP16 and BF16 conversions manually vectored for SSE 4.2 (w/o threads),
+// results are bit-exact with the scalar PrecisionUtils conversions
+//
+//------------------------------------------------------------------------
+
+void f16tof32Arrays_sse42(float* dst, const short* src, size_t nelem, float scale, float bias);
+
+void f32tof16Arrays_sse42(short* dst, const float* src, size_t nelem, float scale, float bias);
+
+void bf16tof32Arrays_sse42(float* dst, const short* src, size_t nelem, float scale, float bias);
+
+void f32tobf16Arrays_sse42(short* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,146 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_huge_page_allocator.hpp"
+
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#ifdef __linux__
+# include <sys/mman.h>
+#endif
+
+namespace InferenceEngine {
+namespace {
+
+constexpr size_t hugePageSize = 2ul << 20;
+constexpr size_t gigaPageSize = 1ul << 30;
+
+#ifdef __linux__
+# ifndef MAP_HUGE_SHIFT
+#  define MAP_HUGE_SHIFT 26
+# endif
+// log2 of a page size placed to the mmap flags
+constexpr int hugePageFlag = 21 << MAP_HUGE_SHIFT;
+constexpr int gigaPageFlag = 30 << MAP_HUGE_SHIFT;
+#endif
+
+size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+class HugePageAllocator : public IAllocator {
+public:
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        try {
+            void* handle = nullptr;
+            size_t mapped = 0;
+#ifdef __linux__
+            if (size >= hugePageSize) {
+                handle = mapHugePages(size, mapped);
+            }
+#endif
+            if (handle == nullptr) {
+                handle = new (std::nothrow) char[size];
+            }
+            if (handle != nullptr) {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _allocations[handle] = mapped;
+            }
+            return handle;
+        } catch (...) {
+            return nullptr;
+        }
+    }
+
+    bool free(void* handle) noexcept override {
+        if (handle == nullptr) {
+            return true;
+        }
+        size_t mapped = 0;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            auto found = _allocations.find(handle);
+            if (found == _allocations.end()) {
+                return false;
+            }
+            mapped = found->second;
+            _allocations.erase(found);
+        }
+        if (mapped == 0) {
+            delete[] static_cast<char*>(handle);
+        } else {
+#ifdef __linux__
+            munmap(handle, mapped);
+#endif
+        }
+        return true;
+    }
+
+private:
+#ifdef __linux__
+    static void* mapHugePages(size_t size, size_t& mapped) {
+        // explicitly reserved pages are used first, they are not available unless configured by an administrator
+        for (auto page : {std::make_pair(gigaPageSize, gigaPageFlag), std::make_pair(hugePageSize, hugePageFlag)}) {
+            if (size < page.first) {
+                continue;
+            }
+            const size_t length = roundUp(size, page.first);
+            void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | page.second, -1, 0);
+            if (ptr != MAP_FAILED) {
+                mapped = length;
+                return ptr;
+            }
+        }
+
+        // transparent huge pages need the region to be aligned to the huge page size
+        const size_t length = roundUp(size, hugePageSize);
+        void* reserved = mmap(nullptr, length + hugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved == MAP_FAILED) {
+            return nullptr;
+        }
+        auto begin = reinterpret_cast<uintptr_t>(reserved);
+        auto aligned = roundUp(begin, hugePageSize);
+        if (aligned != begin) {
+            munmap(reserved, aligned - begin);
+        }
+        const size_t tail = begin + hugePageSize - aligned;
+        if (tail != 0) {
+            munmap(reinterpret_cast<void*>(aligned + length), tail);
+        }
+# ifdef MADV_HUGEPAGE
+        madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+# endif
+        mapped = length;
+        return reinterpret_cast<void*>(aligned);
+    }
+#endif
+
+    std::mutex _mutex;
+    // the size of a mapped region or 0 for regular memory
+    std::map<void*, size_t> _allocations;
+};
+
+}  // namespace
+
+std::shared_ptr<IAllocator> CreateHugePageAllocator() {
+    return details::shared_from_irelease(new HugePageAllocator());
+}
+
+}  // namespace InferenceEngine
@@ -2,15 +2,21 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 #include <istream>
+#include <fstream>
+#include <cstdio>
 #include <mutex>
+#include <atomic>
+#include <future>
 
 #include <ie_core.hpp>
 #include <multi-device/multi_device_config.hpp>
+#include <auto-batch/auto_batch_config.hpp>
 #include <ngraph/opsets/opset.hpp>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/graph_util.hpp>
@@ -20,8 +26,12 @@
 #include "ie_plugin_cpp.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_itt.hpp"
+#include "ie_trace.hpp"
+#include "ie_load_time_breakdown.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "compilation_context.hpp"
+#include "constants_sharing.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -46,6 +56,14 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_ == "AUTO" || deviceName_.find("AUTO:") == 0) {
+        // the automatic selection is a mode of the MULTI device
+        deviceName_ = "MULTI";
+        config_[InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_AUTO_DEVICE_CANDIDATES] =
+            deviceName.size() > 4 ? deviceName.substr(5) : std::string();
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[InferenceEngine::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE] = deviceName.substr(6);
     } else {
         DeviceIDParser parser(deviceName_);
         deviceName_ = parser.getDeviceName();
@@ -86,6 +104,54 @@ Parameter copyParameterValue(const Parameter & value) {
     return std::move(value);
 }
 
+bool deviceSupportsConfigKey(const InferencePlugin& plugin, const std::string& key) {
+    bool supported = false;
+    try {
+        std::vector<std::string> supportedKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {});
+        supported = std::find(supportedKeys.begin(), supportedKeys.end(), key) != supportedKeys.end();
+    } catch (...) {}
+    return supported;
+}
+
+bool deviceSupportsImportExport(const InferencePlugin& plugin) {
+    bool supported = false;
+    try {
+        std::vector<std::string> supportedMetrics = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
+        if (std::find(supportedMetrics.begin(), supportedMetrics.end(),
+                      METRIC_KEY(IMPORT_EXPORT_SUPPORT)) != supportedMetrics.end()) {
+            supported = plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+        }
+    } catch (...) {}
+    return supported;
+}
+
+std::string deviceImportExportFingerprint(const InferencePlugin& plugin) {
+    std::string fingerprint;
+    try {
+        std::vector<std::string> supportedMetrics = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
+        if (std::find(supportedMetrics.begin(), supportedMetrics.end(),
+                      METRIC_KEY(IMPORT_EXPORT_FINGERPRINT)) != supportedMetrics.end()) {
+            fingerprint = plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_FINGERPRINT), {}).as<std::string>();
+        }
+    } catch (...) {}
+    return fingerprint;
+}
+
+/**
+ * @brief CACHE_DIR and SHARE_CONSTANTS are handled by the Core itself, so they are passed to a plugin only if the plugin supports them
+ */
+std::map<std::string, std::string> removeCoreConfig(const InferencePlugin& plugin,
+                                                    const std::map<std::string, std::string>& config) {
+    auto pluginConfig = config;
+    for (auto&& key : {std::string(KEY_CACHE_DIR), std::string(KEY_SHARE_CONSTANTS)}) {
+        auto it = pluginConfig.find(key);
+        if (it != pluginConfig.end() && !deviceSupportsConfigKey(plugin, key)) {
+            pluginConfig.erase(it);
+        }
+    }
+    return pluginConfig;
+}
+
 template <typename F>
 void allowNotImplemented(F && f) {
     try {
@@ -174,6 +240,11 @@ class Core::Impl : public ICore {
 
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
+    mutable std::map<std::string, std::shared_ptr<std::mutex>> pluginCreationMutexes;
+    mutable std::unordered_set<std::string> unavailablePlugins;  // plugins which failed to be created
+
+    bool traceStarted = false;
+    std::shared_ptr<SharedConstants> sharedConstants;  // set if CONFIG_KEY(SHARE_CONSTANTS) is enabled
 
 public:
     Impl();
@@ -241,6 +312,7 @@ public:
             {
                 PluginDescriptor desc = {pluginPath, config, listOfExtentions};
                 pluginRegistry[deviceName] = desc;
+                unavailablePlugins.erase(deviceName);
             }
         }
     }
@@ -259,19 +331,124 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPED_TASK(itt::domains::IE);
-        return details::ReadNetwork(modelPath, binPath, extensions);
+        return ShareConstants(details::ReadNetwork(modelPath, binPath, extensions));
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::ReadNetwork");
-        return details::ReadNetwork(model, weights, extensions);
+        return ShareConstants(details::ReadNetwork(model, weights, extensions));
+    }
+
+    /**
+     * @brief Makes constants of the network reference buffers of the same constants of networks read before
+     * @param network A network just read by the Core
+     * @return The same network
+     */
+    CNNNetwork ShareConstants(CNNNetwork network) const {
+        std::shared_ptr<SharedConstants> constants;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            constants = sharedConstants;
+        }
+        if (constants) {
+            constants->share(network);
+        }
+        return network;
+    }
+
+    /**
+     * @brief Enables or disables sharing of constants between networks read after the call
+     * @param share Whether to share constants. Disabling drops the registry, networks read before keep shared buffers
+     */
+    void SetShareConstants(bool share) {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        if (!share) {
+            sharedConstants.reset();
+        } else if (!sharedConstants) {
+            sharedConstants = std::make_shared<SharedConstants>();
+        }
     }
 
     ExecutableNetwork LoadNetwork(const CNNNetwork& network, const std::string& deviceName,
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
+        // the breakdown is shared with the executable network created by the plugin
+        LoadTimeBreakdownActivation loadTimeBreakdown;
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+        auto cacheDir = GetCacheDir(parsed._deviceName, parsed._config);
+        auto pluginConfig = removeCoreConfig(plugin, parsed._config);
+
+        if (cacheDir.empty() || network.getFunction() == nullptr || !deviceSupportsImportExport(plugin)) {
+            return plugin.LoadNetwork(network, pluginConfig);
+        }
+
+        // the cache directory itself should not affect the hash, so the same blobs can be shared by copying the folder
+        auto hashConfig = pluginConfig;
+        hashConfig.erase(KEY_CACHE_DIR);
+        // hosts with different fingerprints keep separate blobs of the network in a shared cache directory
+        const auto blobPath = NetworkCompilationContext::blobPath(cacheDir,
+            NetworkCompilationContext::computeHash(network, parsed._deviceName, hashConfig),
+            deviceImportExportFingerprint(plugin));
+
+        if (FileUtils::fileExist(blobPath)) {
+            OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::Impl::LoadNetwork::ImportFromCache");
+            try {
+                std::ifstream blobStream(blobPath, std::ios::binary);
+                return plugin.ImportNetwork(blobStream, pluginConfig);
+            } catch (...) {
+                // the blob is corrupted or was produced by an incompatible plugin, so it is recompiled below
+                std::remove(blobPath.c_str());
+            }
+        }
+
+        auto executableNetwork = plugin.LoadNetwork(network, pluginConfig);
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::Impl::LoadNetwork::ExportToCache");
+            LoadTimeScope loadTimeScope(LoadTimePhase::CacheExport);
+            // the blob is written to a temporary file first, so a parallel reader never sees a partial blob
+            const auto tmpBlobPath = blobPath + ".tmp";
+            try {
+                NetworkCompilationContext::createCacheDir(cacheDir);
+                {
+                    std::ofstream blobStream(tmpBlobPath, std::ios::binary);
+                    if (!blobStream.is_open()) {
+                        THROW_IE_EXCEPTION << "Cannot open " << tmpBlobPath << " for writing";
+                    }
+                    executableNetwork.Export(blobStream);
+                }
+                if (std::rename(tmpBlobPath.c_str(), blobPath.c_str()) != 0) {
+                    std::remove(tmpBlobPath.c_str());
+                }
+            } catch (...) {
+                // caching is an optimization, a failed export must not break LoadNetwork
+                std::remove(tmpBlobPath.c_str());
+            }
+        }
+        return executableNetwork;
+    }
+
+    /**
+     * @brief Returns a cache directory for a device
+     * @param deviceName A device name without device ID
+     * @param config A config passed to LoadNetwork which overrides one set via SetConfig
+     * @return A cache directory or empty string if caching is disabled
+     */
+    std::string GetCacheDir(const std::string& deviceName, const std::map<std::string, std::string>& config) const {
+        auto it = config.find(KEY_CACHE_DIR);
+        if (it != config.end()) {
+            return it->second;
+        }
+
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        auto desc = pluginRegistry.find(deviceName);
+        if (desc != pluginRegistry.end()) {
+            auto cacheDir = desc->second.defaultConfig.find(KEY_CACHE_DIR);
+            if (cacheDir != desc->second.defaultConfig.end()) {
+                return cacheDir->second;
+            }
+        }
+        return {};
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -289,7 +466,8 @@ public:
             networkModel.seekg(currentPos, networkModel.beg);
         }
 
-        return GetCPPPluginByName(parsed._deviceName).ImportNetwork(networkModel, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+        return plugin.ImportNetwork(networkModel, removeCoreConfig(plugin, parsed._config));
     }
 
     QueryNetworkResult QueryNetwork(const ICNNNetwork& network, const std::string& deviceName,
@@ -334,59 +512,162 @@ public:
     InferencePlugin GetCPPPluginByName(const std::string& deviceName) const {
         OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::Impl::GetCPPPluginByName");
 
-        std::lock_guard<std::mutex> lock(pluginsMutex);
+        std::shared_ptr<std::mutex> creationMutex;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
 
-        auto it = pluginRegistry.find(deviceName);
-        if (it == pluginRegistry.end()) {
-            THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            if (pluginRegistry.find(deviceName) == pluginRegistry.end()) {
+                THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            }
+
+            auto plugin = plugins.find(deviceName);
+            if (plugin != plugins.end()) {
+                return plugin->second;
+            }
+
+            auto& mutex = pluginCreationMutexes[deviceName];
+            if (mutex == nullptr) {
+                mutex = std::make_shared<std::mutex>();
+            }
+            creationMutex = mutex;
         }
 
-        // Plugin is in registry, but not created, let's create
+        // Plugin is in registry, but not created, let's create.
+        // Only creation of the same plugin is serialized, so other devices stay accessible while
+        // the shared library is loaded and initialized
+        std::lock_guard<std::mutex> creationLock(*creationMutex);
 
-        if (plugins.find(deviceName) == plugins.end()) {
-            PluginDescriptor desc = it->second;
+        PluginDescriptor desc;
+        std::vector<IExtensionPtr> coreExtensions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
 
-            try {
-                InferencePlugin plugin(desc.libraryLocation);
+            auto plugin = plugins.find(deviceName);
+            if (plugin != plugins.end()) {
+                return plugin->second;
+            }
 
-                {
-                    plugin.SetName(deviceName);
+            auto it = pluginRegistry.find(deviceName);
+            if (it == pluginRegistry.end()) {
+                THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            }
+            desc = it->second;
+            coreExtensions = extensions;
+        }
 
-                    // Set Inference Engine class reference to plugins
-                    ICore* mutableCore = const_cast<ICore*>(static_cast<const ICore*>(this));
-                    plugin.SetCore(mutableCore);
+        try {
+            InferencePlugin plugin(desc.libraryLocation);
+
+            {
+                plugin.SetName(deviceName);
+
+                // Set Inference Engine class reference to plugins
+                ICore* mutableCore = const_cast<ICore*>(static_cast<const ICore*>(this));
+                plugin.SetCore(mutableCore);
+            }
+
+            // Add registered extensions to new plugin
+            allowNotImplemented([&](){
+                for (const auto& ext : coreExtensions) {
+                    plugin.AddExtension(ext);
                 }
+            });
+
+            // configuring
+            {
+                allowNotImplemented([&]() {
+                    plugin.SetConfig(removeCoreConfig(plugin, desc.defaultConfig));
+                });
 
-                // Add registered extensions to new plugin
-                allowNotImplemented([&](){
-                    for (const auto& ext : extensions) {
-                        plugin.AddExtension(ext);
+                allowNotImplemented([&]() {
+                    for (auto&& extensionLocation : desc.listOfExtentions) {
+                        plugin.AddExtension(make_so_pointer<IExtension>(extensionLocation));
                     }
                 });
+            }
 
-                // configuring
-                {
-                    allowNotImplemented([&]() {
-                        plugin.SetConfig(desc.defaultConfig);
-                    });
-
-                    allowNotImplemented([&]() {
-                        for (auto&& extensionLocation : desc.listOfExtentions) {
-                            plugin.AddExtension(make_so_pointer<IExtension>(extensionLocation));
-                        }
-                    });
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+
+            // apply config and extensions which were set while the plugin was being created
+            auto it = pluginRegistry.find(deviceName);
+            if (it != pluginRegistry.end() && it->second.defaultConfig != desc.defaultConfig) {
+                allowNotImplemented([&]() {
+                    plugin.SetConfig(removeCoreConfig(plugin, it->second.defaultConfig));
+                });
+            }
+            for (auto ext = extensions.begin() + coreExtensions.size(); ext != extensions.end(); ++ext) {
+                try {
+                    plugin.AddExtension(*ext);
+                } catch (...) {}
+            }
+
+            unavailablePlugins.erase(deviceName);
+            plugins[deviceName] = plugin;
+            return plugin;
+        } catch (const details::InferenceEngineException& ex) {
+            {
+                std::lock_guard<std::mutex> lock(pluginsMutex);
+                unavailablePlugins.insert(deviceName);
+            }
+            THROW_IE_EXCEPTION << "Failed to create plugin " << FileUtils::fromFilePath(desc.libraryLocation) << " for device " << deviceName
+                               << "\n"
+                               << "Please, check your environment\n"
+                               << ex.what() << "\n";
+        }
+    }
+
+    /**
+     * @brief Provides a list of available devices. Plugins are created and queried in parallel, plugins which
+     *        failed to be created are skipped until they are registered or configured again
+     * @return A list of available devices
+     */
+    std::vector<std::string> GetAvailableDevices() const override {
+        OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::Impl::GetAvailableDevices");
+
+        std::vector<std::string> deviceNames;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            for (auto&& pluginDesc : pluginRegistry) {
+                if (unavailablePlugins.find(pluginDesc.first) == unavailablePlugins.end()) {
+                    deviceNames.push_back(pluginDesc.first);
+                }
+            }
+        }
+
+        const std::string propertyName = METRIC_KEY(AVAILABLE_DEVICES);
+        std::vector<std::vector<std::string>> devicesIDs(deviceNames.size());
+        std::vector<std::function<void()>> tasks;
+        for (size_t i = 0; i < deviceNames.size(); ++i) {
+            tasks.push_back([&, i] {
+                const auto& deviceName = deviceNames[i];
+                try {
+                    Parameter p = GetMetric(deviceName, propertyName);
+                    devicesIDs[i] = p.as<std::vector<std::string>>();
+                } catch (details::InferenceEngineException&) {
+                    // plugin is not created by e.g. invalid env
+                } catch (const std::exception& ex) {
+                    THROW_IE_EXCEPTION << "An exception is thrown while trying to create the " << deviceName
+                                       << " device and call GetMetric: " << ex.what();
+                } catch (...) {
+                    THROW_IE_EXCEPTION << "Unknown exception is thrown while trying to create the " << deviceName
+                                       << " device and call GetMetric";
                 }
+            });
+        }
+        RunLoadTasksInParallel(tasks);
 
-                plugins[deviceName] = plugin;
-            } catch (const details::InferenceEngineException& ex) {
-                THROW_IE_EXCEPTION << "Failed to create plugin " << FileUtils::fromFilePath(desc.libraryLocation) << " for device " << deviceName
-                                   << "\n"
-                                   << "Please, check your environment\n"
-                                   << ex.what() << "\n";
+        std::vector<std::string> devices;
+        for (size_t i = 0; i < deviceNames.size(); ++i) {
+            if (devicesIDs[i].size() > 1) {
+                for (auto&& deviceID : devicesIDs[i]) {
+                    devices.push_back(deviceNames[i] + '.' + deviceID);
+                }
+            } else if (!devicesIDs[i].empty()) {
+                devices.push_back(deviceNames[i]);
             }
         }
 
-        return plugins[deviceName];
+        return devices;
     }
 
     /**
@@ -430,6 +711,7 @@ public:
 
         PluginDescriptor desc = {pluginPath, {}, {}};
         pluginRegistry[deviceName] = desc;
+        unavailablePlugins.erase(deviceName);
     }
 
     /**
@@ -447,6 +729,21 @@ public:
         return listOfDevices;
     }
 
+    /**
+     * @brief Starts or stops recording of a timeline trace
+     * @param traceFile A file to write the trace to, empty value stops recording and writes the file
+     */
+    void SetTraceFile(const std::string& traceFile) {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        if (traceFile.empty()) {
+            traceStarted = false;
+            trace::stop();
+        } else {
+            traceStarted = true;
+            trace::start(traceFile);
+        }
+    }
+
     /**
      * @brief Sets config values for a plugin or set of plugins
      * @param deviceName A device name to set config to
@@ -462,6 +759,8 @@ public:
                 for (auto&& conf : config) {
                     desc.second.defaultConfig[conf.first] = conf.second;
                 }
+                // new config may fix creation of the plugin
+                unavailablePlugins.erase(desc.first);
                 configIsSet = true;
             }
         }
@@ -474,7 +773,7 @@ public:
         for (auto& plugin : plugins) {
             if (deviceName.empty() || deviceName == plugin.first) {
                 allowNotImplemented([&]() {
-                    plugin.second.SetConfig(config);
+                    plugin.second.SetConfig(removeCoreConfig(plugin.second, config));
                 });
             }
         }
@@ -519,7 +818,13 @@ Core::Impl::Impl() {
     opsetNames.insert("opset4");
 }
 
-Core::Impl::~Impl() {}
+Core::Impl::~Impl() {
+    if (traceStarted) {
+        try {
+            trace::stop();
+        } catch (...) {}
+    }
+}
 
 Core::Core(const std::string& xmlConfigFile) {
     _impl = std::make_shared<Impl>();
@@ -546,7 +851,7 @@ std::map<std::string, Version> Core::GetVersions(const std::string& deviceName)
                 deviceNames = DeviceIDParser::getHeteroDevices(deviceName.substr(pos + 1));
             }
             deviceNames.push_back("HETERO");
-        } else if (deviceName.find("MULTI") == 0) {
+        } else if (deviceName.find("MULTI") == 0 || deviceName.find("AUTO") == 0) {
             auto pos = deviceName.find_first_of(":");
             if (pos != std::string::npos) {
                 deviceNames = DeviceIDParser::getMultiDevices(deviceName.substr(pos + 1));
@@ -595,6 +900,79 @@ void Core::AddExtension(const IExtensionPtr& extension) {
     _impl->AddExtension(extension);
 }
 
+namespace {
+
+// shared by a loading thread and LoadNetworkTask, kept apart from the future to avoid a reference cycle
+struct LoadNetworkProgress {
+    std::atomic<bool> cancelled{false};
+    mutable std::mutex mutex;
+    std::string phase;
+    LoadNetworkTask::ProgressCallback callback;
+};
+
+}  // namespace
+
+struct LoadNetworkTask::State {
+    std::shared_future<ExecutableNetwork> future;
+    std::shared_ptr<LoadNetworkProgress> progress;
+};
+
+ExecutableNetwork LoadNetworkTask::Get() const {
+    if (_state == nullptr) THROW_IE_EXCEPTION << "LoadNetworkTask was not started";
+    return _state->future.get();
+}
+
+bool LoadNetworkTask::WaitFor(std::chrono::milliseconds timeout) const {
+    if (_state == nullptr) THROW_IE_EXCEPTION << "LoadNetworkTask was not started";
+    return _state->future.wait_for(timeout) == std::future_status::ready;
+}
+
+void LoadNetworkTask::Cancel() noexcept {
+    if (_state != nullptr) {
+        _state->progress->cancelled = true;
+    }
+}
+
+std::string LoadNetworkTask::GetPhase() const {
+    if (_state == nullptr) return {};
+    std::lock_guard<std::mutex> lock(_state->progress->mutex);
+    return _state->progress->phase;
+}
+
+LoadNetworkTask Core::LoadNetworkAsync(const CNNNetwork& network, const std::string& deviceName,
+                                       const std::map<std::string, std::string>& config,
+                                       LoadNetworkTask::ProgressCallback progress) {
+    auto loadProgress = std::make_shared<LoadNetworkProgress>();
+    loadProgress->callback = std::move(progress);
+    auto impl = _impl;
+
+    LoadNetworkTask task;
+    task._state = std::make_shared<LoadNetworkTask::State>();
+    task._state->progress = loadProgress;
+    task._state->future = std::async(std::launch::async, [impl, network, deviceName, config, loadProgress] {
+        OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::LoadNetworkAsync");
+        auto checkCancelled = [loadProgress, deviceName] {
+            if (loadProgress->cancelled) THROW_IE_EXCEPTION << "Loading of the network to " << deviceName << " was cancelled";
+        };
+        // plugins report phases via LoadTimeScope, so the breakdown is used to track and abort the loading
+        LoadTimeBreakdownActivation loadTimeBreakdown;
+        loadTimeBreakdown.Get()->SetPhaseCallback([loadProgress, checkCancelled] (const char* phase) {
+            checkCancelled();
+            {
+                std::lock_guard<std::mutex> lock(loadProgress->mutex);
+                loadProgress->phase = phase;
+            }
+            if (loadProgress->callback) loadProgress->callback(phase);
+        });
+        checkCancelled();
+        auto executableNetwork = impl->LoadNetwork(network, deviceName, config);
+        // the breakdown is kept by the executable network, so late cancellation must not affect it
+        loadTimeBreakdown.Get()->SetPhaseCallback({});
+        return executableNetwork;
+    }).share();
+    return task;
+}
+
 ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, RemoteContext::Ptr context,
                                     const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::LoadNetwork");
@@ -604,7 +982,8 @@ ExecutableNetwork Core::LoadNetwork(const CNNNetwork& network, RemoteContext::Pt
     }
 
     auto parsed = parseDeviceNameIntoConfig(context->getDeviceName(), config);
-    return _impl->GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config, context);
+    auto plugin = _impl->GetCPPPluginByName(parsed._deviceName);
+    return plugin.LoadNetwork(network, removeCoreConfig(plugin, parsed._config), context);
 }
 
 RemoteContext::Ptr Core::CreateContext(const std::string& deviceName, const ParamMap& params) {
@@ -614,6 +993,9 @@ RemoteContext::Ptr Core::CreateContext(const std::string& deviceName, const Para
     if (deviceName.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support remote context";
     }
+    if (deviceName.find("AUTO") == 0) {
+        THROW_IE_EXCEPTION << "AUTO device does not support remote context";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, params);
     return _impl->GetCPPPluginByName(parsed._deviceName).CreateContext(parsed._config);
@@ -626,6 +1008,9 @@ RemoteContext::Ptr Core::GetDefaultContext(const std::string& deviceName) {
     if (deviceName.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support remote context";
     }
+    if (deviceName.find("AUTO") == 0) {
+        THROW_IE_EXCEPTION << "AUTO device does not support remote context";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, ParamMap());
     return _impl->GetCPPPluginByName(parsed._deviceName).GetDefaultContext(parsed._config);
@@ -640,6 +1025,10 @@ void Core::AddExtension(IExtensionPtr extension, const std::string& deviceName_)
         THROW_IE_EXCEPTION
             << "MULTI device does not support extensions. Please, set extensions directly to fallback devices";
     }
+    if (deviceName_.find("AUTO") == 0) {
+        THROW_IE_EXCEPTION
+            << "AUTO device does not support extensions. Please, set extensions directly to candidate devices";
+    }
 
     _impl->AddExtension(extension);
 }
@@ -652,9 +1041,13 @@ ExecutableNetwork Core::ImportNetwork(const std::string& modelFileName, const st
     if (deviceName.find("MULTI") == 0) {
         THROW_IE_EXCEPTION << "MULTI device does not support ImportNetwork";
     }
+    if (deviceName.find("AUTO") == 0) {
+        THROW_IE_EXCEPTION << "AUTO device does not support ImportNetwork";
+    }
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-    return _impl->GetCPPPluginByName(parsed._deviceName).ImportNetwork(modelFileName, parsed._config);
+    auto plugin = _impl->GetCPPPluginByName(parsed._deviceName);
+    return plugin.ImportNetwork(modelFileName, removeCoreConfig(plugin, parsed._config));
 }
 
 ExecutableNetwork Core::ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -676,7 +1069,8 @@ ExecutableNetwork Core::ImportNetwork(std::istream& networkModel,
     std::string deviceName = device.getDeviceName();
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-    return _impl->GetCPPPluginByName(deviceName).ImportNetwork(networkModel, context, parsed._config);
+    auto plugin = _impl->GetCPPPluginByName(deviceName);
+    return plugin.ImportNetwork(networkModel, context, removeCoreConfig(plugin, parsed._config));
 }
 
 QueryNetworkResult Core::QueryNetwork(const CNNNetwork& network, const std::string& deviceName,
@@ -701,7 +1095,39 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
-    if (deviceName.empty()) {
+    // AUTO case
+    {
+        if (deviceName.find("AUTO") == 0) {
+            THROW_IE_EXCEPTION << "SetConfig is not supported for AUTO, it shares the config of the MULTI device. "
+                                  "Pass the AUTO options to LoadNetwork or configure the candidate devices.";
+        }
+    }
+
+    auto shareConstants = config.find(CONFIG_KEY(SHARE_CONSTANTS));
+    if (shareConstants != config.end()) {
+        if (!deviceName.empty()) {
+            THROW_IE_EXCEPTION << CONFIG_KEY(SHARE_CONSTANTS) << " can be set only without a device name";
+        }
+        if (shareConstants->second == CONFIG_VALUE(YES)) {
+            _impl->SetShareConstants(true);
+        } else if (shareConstants->second == CONFIG_VALUE(NO)) {
+            _impl->SetShareConstants(false);
+        } else {
+            THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(SHARE_CONSTANTS)
+                               << ". Expected only YES/NO";
+        }
+    }
+
+    auto traceFile = config.find(CONFIG_KEY(TRACE_FILE));
+    if (traceFile != config.end()) {
+        if (!deviceName.empty()) {
+            THROW_IE_EXCEPTION << CONFIG_KEY(TRACE_FILE) << " can be set only without a device name";
+        }
+        _impl->SetTraceFile(traceFile->second);
+        auto pluginsConfig = config;
+        pluginsConfig.erase(CONFIG_KEY(TRACE_FILE));
+        _impl->SetConfigForPlugins(pluginsConfig, std::string());
+    } else if (deviceName.empty()) {
         _impl->SetConfigForPlugins(config, std::string());
     } else {
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
@@ -740,36 +1166,7 @@ Parameter Core::GetMetric(const std::string& deviceName, const std::string& name
 }
 
 std::vector<std::string> Core::GetAvailableDevices() const {
-    std::vector<std::string> devices;
-
-    std::string propertyName = METRIC_KEY(AVAILABLE_DEVICES);
-
-    for (auto&& deviceName : _impl->GetListOfDevicesInRegistry()) {
-        std::vector<std::string> devicesIDs;
-
-        try {
-            Parameter p = GetMetric(deviceName, propertyName);
-            devicesIDs = p.as<std::vector<std::string>>();
-        } catch (details::InferenceEngineException&) {
-            // plugin is not created by e.g. invalid env
-        } catch (const std::exception& ex) {
-            THROW_IE_EXCEPTION << "An exception is thrown while trying to create the " << deviceName
-                               << " device and call GetMetric: " << ex.what();
-        } catch (...) {
-            THROW_IE_EXCEPTION << "Unknown exception is thrown while trying to create the " << deviceName
-                               << " device and call GetMetric";
-        }
-
-        if (devicesIDs.size() > 1) {
-            for (auto&& deviceID : devicesIDs) {
-                devices.push_back(deviceName + '.' + deviceID);
-            }
-        } else if (!devicesIDs.empty()) {
-            devices.push_back(deviceName);
-        }
-    }
-
-    return devices;
+    return _impl->GetAvailableDevices();
 }
 
 void Core::RegisterPlugin(const std::string& pluginName, const std::string& deviceName) {
@@ -0,0 +1,129 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_load_time_breakdown.hpp"
+
+#include <future>
+#include <utility>
+
+namespace InferenceEngine {
+namespace {
+
+thread_local LoadTimeBreakdown::Ptr activeBreakdown;
+thread_local LoadTimeScope* activeScope = nullptr;
+
+float toMs(std::chrono::nanoseconds time) {
+    return std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(time).count();
+}
+
+}  // namespace
+
+void LoadTimeBreakdown::Add(const std::string& phase, std::chrono::nanoseconds time) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _phases[phase] += time;
+}
+
+std::map<std::string, float> LoadTimeBreakdown::Get() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    std::map<std::string, float> result;
+    std::chrono::nanoseconds measured{0};
+    for (auto&& phase : _phases) {
+        result[phase.first] = toMs(phase.second);
+        if (phase.first != LoadTimePhase::Total) {
+            measured += phase.second;
+        }
+    }
+    auto total = _phases.find(LoadTimePhase::Total);
+    if (total != _phases.end()) {
+        result[LoadTimePhase::Other] = total->second > measured ? toMs(total->second - measured) : 0.f;
+    }
+    return result;
+}
+
+LoadTimeBreakdown::Ptr LoadTimeBreakdown::GetActive() noexcept {
+    return activeBreakdown;
+}
+
+void LoadTimeBreakdown::SetPhaseCallback(PhaseCallback callback) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _phaseCallback = std::move(callback);
+}
+
+LoadTimeBreakdownActivation::LoadTimeBreakdownActivation() : _previous(activeBreakdown), _breakdown(activeBreakdown) {
+    if (_breakdown == nullptr) {
+        _breakdown = std::make_shared<LoadTimeBreakdown>();
+        _measuresTotal = true;
+        _start = std::chrono::steady_clock::now();
+        activeBreakdown = _breakdown;
+    }
+}
+
+LoadTimeBreakdownActivation::LoadTimeBreakdownActivation(const LoadTimeBreakdown::Ptr& breakdown)
+    : _previous(activeBreakdown), _breakdown(breakdown) {
+    activeBreakdown = _breakdown;
+}
+
+LoadTimeBreakdownActivation::~LoadTimeBreakdownActivation() {
+    if (_measuresTotal) {
+        _breakdown->Add(LoadTimePhase::Total, std::chrono::steady_clock::now() - _start);
+    }
+    activeBreakdown = _previous;
+}
+
+LoadTimeScope::LoadTimeScope(const char* phase) : _phase(phase), _breakdown(activeBreakdown) {
+    if (_breakdown == nullptr) {
+        return;
+    }
+    LoadTimeBreakdown::PhaseCallback callback;
+    {
+        std::lock_guard<std::mutex> lock{_breakdown->_mutex};
+        callback = _breakdown->_phaseCallback;
+    }
+    // called before the scope is registered, so a throwing callback leaves no dangling scope
+    if (callback) {
+        callback(_phase);
+    }
+    _start = std::chrono::steady_clock::now();
+    _parent = activeScope;
+    if (_parent != nullptr) {
+        _parent->_breakdown->Add(_parent->_phase, _start - _parent->_start);
+    }
+    activeScope = this;
+}
+
+LoadTimeScope::~LoadTimeScope() {
+    if (_breakdown == nullptr) {
+        return;
+    }
+    auto finish = std::chrono::steady_clock::now();
+    _breakdown->Add(_phase, finish - _start);
+    activeScope = _parent;
+    if (_parent != nullptr) {
+        _parent->_start = finish;
+    }
+}
+
+void RunLoadTasksInParallel(const std::vector<std::function<void()>>& tasks) {
+    if (tasks.size() == 1) {
+        tasks.front()();
+        return;
+    }
+    auto breakdown = activeBreakdown;
+    std::vector<std::future<void>> futures;
+    for (auto&& task : tasks) {
+        futures.emplace_back(std::async(std::launch::async, [&task, breakdown] {
+            LoadTimeBreakdownActivation activation{breakdown};
+            task();
+        }));
+    }
+    // all tasks are waited before an exception is rethrown, so tasks never outlive their captures
+    for (auto&& future : futures) {
+        future.wait();
+    }
+    for (auto&& future : futures) {
+        future.get();
+    }
+}
+
+}  // namespace InferenceEngine
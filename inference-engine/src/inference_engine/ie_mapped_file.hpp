@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific memory mapped files
+ * @file ie_mapped_file.hpp
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief This class maps a whole file to the process address space.
+ * Pages are read from disk lazily on the first access and stay in the page cache shared with other
+ * processes which map the same file. The mapping is private: pages are copied only if they are written.
+ */
+class MappedFile {
+    class Impl;
+    std::shared_ptr<Impl> _impl;
+
+public:
+    /**
+     * @brief A shared pointer to MappedFile
+     */
+    using Ptr = std::shared_ptr<MappedFile>;
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+    /**
+     * @brief Maps a file with the wide char name specified
+     * @param path Full or relative path to the file
+     */
+    explicit MappedFile(const wchar_t* path);
+#endif
+
+    /**
+     * @brief Maps a file with the name specified
+     * @param path Full or relative path to the file
+     * @throws InferenceEngineException if the file cannot be opened or mapped
+     */
+    explicit MappedFile(const char* path);
+
+    /**
+     * @brief Returns a pointer to the beginning of the mapped region
+     */
+    char* data() const noexcept;
+
+    /**
+     * @brief Returns a size of the mapped file in bytes
+     */
+    size_t size() const noexcept;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
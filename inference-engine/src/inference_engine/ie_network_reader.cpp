@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mapped_file.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -94,6 +95,19 @@ public:
 
 namespace {
 
+/**
+ * @brief Weights blob which references memory of a mapped file and keeps the mapping alive
+ */
+class MappedWeightsBlob : public TBlob<uint8_t> {
+    details::MappedFile::Ptr _file;
+
+public:
+    explicit MappedWeightsBlob(const details::MappedFile::Ptr& file) :
+        TBlob<uint8_t>({Precision::U8, { file->size() }, C },
+                       reinterpret_cast<uint8_t*>(file->data()), file->size()),
+        _file(file) { }
+};
+
 // Extension to plugins creator
 std::multimap<std::string, Reader::Ptr> readers;
 
@@ -205,21 +219,15 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
-
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
-
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-                weights->allocate();
-
-                binStream.read(weights->buffer(), fileSize);
+                details::MappedFile::Ptr mappedFile;
+                try {
+                    mappedFile = std::make_shared<details::MappedFile>(weights_path.c_str());
+                } catch (const details::InferenceEngineException& ex) {
+                    THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened! " << ex.what();
+                }
 
-                binStream.close();
+                // weights are not copied: constants of the network reference the mapped memory
+                Blob::Ptr weights = std::make_shared<MappedWeightsBlob>(mappedFile);
 
                 // read model with weights
                 auto network = reader->read(modelStream, weights, exts);
@@ -2,11 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
+#include <algorithm>
 #include <iostream>
+#include <thread>
 #include <vector>
 
 #ifdef ENABLE_MKL_DNN
@@ -86,6 +89,14 @@ bool with_cpu_x86_avx512_core() {
 #endif
 }
 
+bool with_cpu_x86_avx512_core_vnni() {
+#ifdef ENABLE_MKL_DNN
+    return with_cpu_x86_avx512_core() && get_cpu_info().has(Xbyak::util::Cpu::tAVX512_VNNI);
+#else
+    return false;
+#endif
+}
+
 bool with_cpu_x86_bfloat16() {
 #ifdef ENABLE_MKL_DNN
     return get_cpu_info().has(Xbyak::util::Cpu::tAVX512_BF16);
@@ -94,6 +105,38 @@ bool with_cpu_x86_bfloat16() {
 #endif
 }
 
+#ifdef ENABLE_MKL_DNN
+// AMX bits are read from CPUID directly, as the bundled Xbyak doesn't know them
+static bool with_cpu_x86_amx(unsigned int edxBit) {
+    const unsigned int amxTileBit = 24;
+    // XTILECFG and XTILEDATA state components, the OS must enable them before tiles are used
+    const uint64_t amxXfeatures = (1ULL << 17) | (1ULL << 18);
+
+    unsigned int data[4] = {};
+    Xbyak::util::Cpu::getCpuidEx(7, 0, data);
+    const unsigned int edx = data[3];
+    if (!(edx & (1U << amxTileBit)) || !(edx & (1U << edxBit)))
+        return false;
+    return (Xbyak::util::Cpu::getXfeature() & amxXfeatures) == amxXfeatures;
+}
+#endif
+
+bool with_cpu_x86_avx512_core_amx_int8() {
+#ifdef ENABLE_MKL_DNN
+    return with_cpu_x86_avx512_core() && with_cpu_x86_amx(25);
+#else
+    return false;
+#endif
+}
+
+bool with_cpu_x86_avx512_core_amx_bf16() {
+#ifdef ENABLE_MKL_DNN
+    return with_cpu_x86_avx512_core() && with_cpu_x86_amx(22);
+#else
+    return false;
+#endif
+}
+
 bool checkOpenMpEnvVars(bool includeOMPNumThreads) {
     for (auto&& var : {
         "GOMP_CPU_AFFINITY",
@@ -136,9 +179,14 @@ bool checkOpenMpEnvVars(bool includeOMPNumThreads) {
 }
 
 #if defined(__APPLE__)
-// for Linux and Windows the getNumberOfCPUCores (that accounts only for physical cores) implementation is OS-specific
+// for Linux and Windows the getNumberOfCPUCores (that accounts only for physical cores) and core types detection
+// implementations are OS-specific
 // (see cpp files in corresponding folders), for __APPLE__ it is default :
 int getNumberOfCPUCores() { return parallel_get_max_threads();}
+int getNumberOfAvailableProcessors() { return std::max(1, static_cast<int>(std::thread::hardware_concurrency())); }
+std::vector<int> getNUMANodeProcessors(int) { return {}; }
+std::vector<int> getBigCoreProcessors() { return {}; }
+std::vector<int> getLittleCoreProcessors() { return {}; }
 #if !((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() { return {0}; }
 #endif
@@ -0,0 +1,175 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_trace.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+namespace trace {
+namespace {
+
+struct Event {
+    char name[64];
+    const char* category;
+    const void* id;
+    int64_t arg;
+    int64_t start;
+    int64_t finish;
+};
+
+/**
+ * @brief A ring buffer which is written by a single thread and read by trace::stop() when recording is disabled.
+ *        The oldest events are overwritten when the buffer is full.
+ */
+struct ThreadBuffer {
+    static constexpr size_t capacity = 1 << 16;
+
+    explicit ThreadBuffer(size_t index_) : index(index_), events(capacity) {}
+
+    const size_t index;
+    std::vector<Event> events;
+    std::atomic<uint64_t> head {0};
+};
+
+constexpr size_t ThreadBuffer::capacity;
+
+struct Recorder {
+    std::atomic<bool> enabled {false};
+    std::mutex mutex;
+    std::string file;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+    static Recorder& instance() {
+        static Recorder recorder;
+        return recorder;
+    }
+
+    ThreadBuffer& threadBuffer() {
+        // buffers are never released, so events of finished threads are still dumped
+        thread_local std::shared_ptr<ThreadBuffer> buffer;
+        if (!buffer) {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffer = std::make_shared<ThreadBuffer>(buffers.size());
+            buffers.push_back(buffer);
+        }
+        return *buffer;
+    }
+};
+
+void writeString(std::ostream& out, const char* str) {
+    out << '"';
+    for (; *str; ++str) {
+        if (*str == '"' || *str == '\\') {
+            out << '\\' << *str;
+        } else if (static_cast<unsigned char>(*str) >= 0x20) {
+            out << *str;
+        }
+    }
+    out << '"';
+}
+
+}  // namespace
+
+bool enabled() noexcept {
+    return Recorder::instance().enabled.load(std::memory_order_relaxed);
+}
+
+int64_t now() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void record(const char* name, const char* category, const void* id, int64_t arg,
+            int64_t start, int64_t finish) noexcept {
+    auto& recorder = Recorder::instance();
+    if (!recorder.enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    ThreadBuffer* buffer = nullptr;
+    try {
+        buffer = &recorder.threadBuffer();
+    } catch (...) {
+        return;
+    }
+    auto head = buffer->head.load(std::memory_order_relaxed);
+    auto& event = buffer->events[head % ThreadBuffer::capacity];
+    std::strncpy(event.name, name, sizeof(event.name) - 1);
+    event.name[sizeof(event.name) - 1] = '\0';
+    event.category = category;
+    event.id = id;
+    event.arg = arg;
+    event.start = start;
+    event.finish = finish;
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+void start(const std::string& file) {
+    auto& recorder = Recorder::instance();
+    std::lock_guard<std::mutex> lock(recorder.mutex);
+    recorder.enabled.store(false, std::memory_order_release);
+    recorder.file = file;
+    for (auto&& buffer : recorder.buffers) {
+        buffer->head.store(0, std::memory_order_relaxed);
+    }
+    recorder.enabled.store(true, std::memory_order_release);
+}
+
+void stop() {
+    auto& recorder = Recorder::instance();
+    std::lock_guard<std::mutex> lock(recorder.mutex);
+    if (!recorder.enabled.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    std::ofstream out(recorder.file);
+    if (!out.is_open()) {
+        THROW_IE_EXCEPTION << "Cannot open trace file " << recorder.file;
+    }
+
+    int64_t origin = std::numeric_limits<int64_t>::max();
+    for (auto&& buffer : recorder.buffers) {
+        auto head = buffer->head.load(std::memory_order_acquire);
+        for (uint64_t i = head - std::min<uint64_t>(head, ThreadBuffer::capacity); i < head; ++i) {
+            origin = std::min(origin, buffer->events[i % ThreadBuffer::capacity].start);
+        }
+    }
+
+    out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    bool first = true;
+    for (auto&& buffer : recorder.buffers) {
+        auto head = buffer->head.load(std::memory_order_acquire);
+        for (uint64_t i = head - std::min<uint64_t>(head, ThreadBuffer::capacity); i < head; ++i) {
+            const auto& event = buffer->events[i % ThreadBuffer::capacity];
+            out << (first ? "\n" : ",\n") << "{\"name\":";
+            writeString(out, event.name);
+            out << ",\"cat\":";
+            writeString(out, event.category);
+            out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->index
+                << ",\"ts\":" << (event.start - origin) / 1000.0
+                << ",\"dur\":" << (event.finish - event.start) / 1000.0
+                << ",\"args\":{\"id\":\"" << event.id << "\"";
+            if (event.arg >= 0) {
+                out << ",\"index\":" << event.arg;
+            }
+            out << "}}";
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+}
+
+}  // namespace trace
+}  // namespace InferenceEngine
@@ -0,0 +1,83 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "details/ie_exception.hpp"
+#include "file_utils.h"
+#include "ie_mapped_file.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+class MappedFile::Impl {
+private:
+    char* _data = nullptr;
+    size_t _size = 0;
+
+public:
+    explicit Impl(const char* path) {
+        int fd = open(path, O_RDONLY);
+        if (fd == -1)
+            THROW_IE_EXCEPTION << "Cannot open file " << path << " for mapping: " << std::strerror(errno);
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1) {
+            close(fd);
+            THROW_IE_EXCEPTION << "Cannot get size of file " << path << ": " << std::strerror(errno);
+        }
+        _size = static_cast<size_t>(sb.st_size);
+
+        if (_size != 0) {
+            // PROT_WRITE with MAP_PRIVATE keeps pages shared until somebody writes to them
+            void* data = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                close(fd);
+                THROW_IE_EXCEPTION << "Cannot map file " << path << ": " << std::strerror(errno);
+            }
+            _data = static_cast<char*>(data);
+        }
+        // the mapping stays valid after the descriptor is closed
+        close(fd);
+    }
+
+    ~Impl() {
+        if (_data != nullptr)
+            munmap(_data, _size);
+    }
+
+    char* data() const noexcept {
+        return _data;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+};
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+MappedFile::MappedFile(const wchar_t* path) : MappedFile(FileUtils::wStringtoMBCSstringChar(path).c_str()) {
+}
+#endif  // ENABLE_UNICODE_PATH_SUPPORT
+
+MappedFile::MappedFile(const char* path) {
+    _impl.reset(new Impl(path));
+}
+
+char* MappedFile::data() const noexcept {
+    return _impl->data();
+}
+
+size_t MappedFile::size() const noexcept {
+    return _impl->size();
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
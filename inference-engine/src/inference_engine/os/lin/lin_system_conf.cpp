@@ -2,24 +2,54 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <fstream>
 #include <map>
 #include <string>
+#include <tuple>
 #include <vector>
 #include <iostream>
+#include <sstream>
 #include <sched.h>
 #include "ie_system_conf.h"
 #include "ie_parallel.hpp"
 #include "details/ie_exception.hpp"
+#include "threading/ie_thread_affinity.hpp"
 #include <numeric>
 
 
 namespace InferenceEngine {
 
+// Reads the CFS quota of the process cgroup (v2 or v1 hierarchy) rounded up to whole CPUs, 0 if it is not limited
+static int readCpuQuota() {
+    long long quota = -1, period = 0;
+    std::ifstream cpuMax("/sys/fs/cgroup/cpu.max");
+    if (cpuMax.is_open()) {
+        // "<quota> <period>" or "max <period>"
+        std::string value;
+        if (!(cpuMax >> value >> period) || value == "max") return 0;
+        try {
+            quota = std::stoll(value);
+        } catch (const std::exception&) {
+            return 0;
+        }
+    } else {
+        for (auto&& dir : {"/sys/fs/cgroup/cpu/", "/sys/fs/cgroup/cpu,cpuacct/"}) {
+            std::ifstream quotaFile(std::string(dir) + "cpu.cfs_quota_us");
+            std::ifstream periodFile(std::string(dir) + "cpu.cfs_period_us");
+            if ((quotaFile >> quota) && (periodFile >> period)) break;
+            quota = -1;
+        }
+    }
+    if (quota <= 0 || period <= 0) return 0;
+    return static_cast<int>(std::max(1LL, (quota + period - 1) / period));
+}
+
 struct CPU {
     int _processors = 0;
     int _sockets    = 0;
     int _cores      = 0;
+    int _quota      = readCpuQuota();
 
     CPU() {
         std::ifstream cpuinfo("/proc/cpuinfo");
@@ -54,6 +84,65 @@ struct CPU {
     }
 };
 static CPU cpu;
+
+// Parses cpulist format of sysfs, e.g. "0-7,16,18-19"
+static std::vector<int> readCpuList(const std::string& path) {
+    std::ifstream file(path);
+    std::string list;
+    std::vector<int> processors;
+    if (!std::getline(file, list)) return processors;
+    std::stringstream ranges(list);
+    for (std::string range; std::getline(ranges, range, ',');) {
+        if (range.empty()) continue;
+        auto delimeter = range.find('-');
+        try {
+            const int first = std::stoi(range.substr(0, delimeter));
+            const int last = delimeter == std::string::npos ? first : std::stoi(range.substr(delimeter + 1));
+            for (int processor = first; processor <= last; processor++) {
+                processors.emplace_back(processor);
+            }
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+    return processors;
+}
+
+struct HybridCPU {
+    std::vector<int> _bigCoreProcessors;
+    std::vector<int> _littleCoreProcessors;
+
+    HybridCPU() {
+        // hybrid CPUs expose a separate PMU per core type
+        auto bigCores = readCpuList("/sys/devices/cpu_core/cpus");
+        auto littleCores = readCpuList("/sys/devices/cpu_atom/cpus");
+        if (bigCores.empty() || littleCores.empty()) return;
+        _bigCoreProcessors = firstCoreThreads(bigCores);
+        _littleCoreProcessors = firstCoreThreads(littleCores);
+    }
+
+    // leaves the first hyper-thread of each physical core
+    static std::vector<int> firstCoreThreads(const std::vector<int>& processors) {
+        std::vector<int> result;
+        for (auto&& processor : processors) {
+            auto siblings = readCpuList("/sys/devices/system/cpu/cpu" + std::to_string(processor) + "/topology/thread_siblings_list");
+            if (siblings.empty() || siblings.front() == processor) {
+                result.emplace_back(processor);
+            }
+        }
+        return result;
+    }
+};
+static HybridCPU hybridCpu;
+
+std::vector<int> getBigCoreProcessors() {
+    return hybridCpu._bigCoreProcessors;
+}
+
+std::vector<int> getLittleCoreProcessors() {
+    return hybridCpu._littleCoreProcessors;
+}
+
 #if !((IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO))
 std::vector<int> getAvailableNUMANodes() {
     std::vector<int> nodes((0 == cpu._sockets) ? 1 : cpu._sockets);
@@ -81,7 +170,21 @@ int getNumberOfCPUCores() {
             }
         }
     }
-    return CPU_COUNT(&currentCoreSet);
+    const int cores = CPU_COUNT(&currentCoreSet);
+    return cpu._quota ? std::min(cores, cpu._quota) : cores;
+}
+
+int getNumberOfAvailableProcessors() {
+    CpuSet mask;
+    int ncpus = 0;
+    std::tie(mask, ncpus) = GetProcessMask();
+    int processors = mask ? CPU_COUNT_S(CPU_ALLOC_SIZE(ncpus), mask.get()) : cpu._processors;
+    if (cpu._quota) processors = std::min(processors, cpu._quota);
+    return std::max(1, processors);
+}
+
+std::vector<int> getNUMANodeProcessors(int numaNode) {
+    return readCpuList("/sys/devices/system/node/node" + std::to_string(numaNode) + "/cpulist");
 }
 
 }  // namespace InferenceEngine
@@ -0,0 +1,101 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "details/ie_exception.hpp"
+#include "file_utils.h"
+#include "ie_mapped_file.hpp"
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+
+namespace InferenceEngine {
+namespace details {
+
+class MappedFile::Impl {
+private:
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = nullptr;
+    char* _data = nullptr;
+    size_t _size = 0;
+
+    void map(const char* path) {
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(_file, &fileSize)) {
+            CloseHandle(_file);
+            THROW_IE_EXCEPTION << "Cannot get size of file " << path << ", error: " << GetLastError();
+        }
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        if (_size == 0)
+            return;
+
+        // PAGE_WRITECOPY keeps pages shared until somebody writes to them
+        _mapping = CreateFileMappingA(_file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (_mapping == nullptr) {
+            CloseHandle(_file);
+            THROW_IE_EXCEPTION << "Cannot create mapping of file " << path << ", error: " << GetLastError();
+        }
+        _data = static_cast<char*>(MapViewOfFile(_mapping, FILE_MAP_COPY, 0, 0, 0));
+        if (_data == nullptr) {
+            CloseHandle(_mapping);
+            CloseHandle(_file);
+            THROW_IE_EXCEPTION << "Cannot map file " << path << ", error: " << GetLastError();
+        }
+    }
+
+public:
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+    explicit Impl(const wchar_t* path) {
+        _file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE)
+            THROW_IE_EXCEPTION << "Cannot open file " << FileUtils::wStringtoMBCSstringChar(path) << " for mapping";
+        map(FileUtils::wStringtoMBCSstringChar(path).c_str());
+    }
+#endif  // ENABLE_UNICODE_PATH_SUPPORT
+
+    explicit Impl(const char* path) {
+        _file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE)
+            THROW_IE_EXCEPTION << "Cannot open file " << path << " for mapping";
+        map(path);
+    }
+
+    ~Impl() {
+        if (_data != nullptr)
+            UnmapViewOfFile(_data);
+        if (_mapping != nullptr)
+            CloseHandle(_mapping);
+        CloseHandle(_file);
+    }
+
+    char* data() const noexcept {
+        return _data;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+};
+
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+MappedFile::MappedFile(const wchar_t* path) {
+    _impl.reset(new Impl(path));
+}
+#endif  // ENABLE_UNICODE_PATH_SUPPORT
+
+MappedFile::MappedFile(const char* path) {
+    _impl.reset(new Impl(path));
+}
+
+char* MappedFile::data() const noexcept {
+    return _impl->data();
+}
+
+size_t MappedFile::size() const noexcept {
+    return _impl->size();
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -3,7 +3,10 @@
 //
 
 #include <windows.h>
+#include <algorithm>
 #include <memory>
+#include <thread>
+#include <utility>
 #include <vector>
 #include "ie_system_conf.h"
 #include "ie_parallel.hpp"
@@ -31,6 +34,70 @@ int getNumberOfCPUCores() {
     return phys_cores;
 }
 
+// efficiency class and the first logical processor of each physical core, empty on CPUs with a single core type
+static std::vector<std::pair<BYTE, int>> getHybridCores() {
+    DWORD sz = 0;
+    if (GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &sz) ||
+        GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+        return {};
+
+    std::unique_ptr<uint8_t[]> ptr(new uint8_t[sz]);
+    if (!GetLogicalProcessorInformationEx(RelationProcessorCore,
+            reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(ptr.get()), &sz))
+        return {};
+
+    std::vector<std::pair<BYTE, int>> cores;
+    size_t offset = 0;
+    do {
+        auto info = reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(ptr.get() + offset);
+        const auto& groupMask = info->Processor.GroupMask[0];
+        for (int bit = 0; bit < static_cast<int>(sizeof(KAFFINITY) * 8); bit++) {
+            if (groupMask.Mask & (static_cast<KAFFINITY>(1) << bit)) {
+                cores.emplace_back(info->Processor.EfficiencyClass, groupMask.Group * 64 + bit);
+                break;
+            }
+        }
+        offset += info->Size;
+    } while (offset < sz);
+
+    auto classes = std::minmax_element(cores.begin(), cores.end());
+    if (cores.empty() || classes.first->first == classes.second->first)
+        return {};
+    return cores;
+}
+
+// the highest efficiency class corresponds to the most performant cores
+static std::vector<int> getCoreProcessors(bool big) {
+    auto cores = getHybridCores();
+    std::vector<int> processors;
+    if (cores.empty()) return processors;
+    auto classes = std::minmax_element(cores.begin(), cores.end());
+    const auto efficiencyClass = big ? classes.second->first : classes.first->first;
+    for (auto&& core : cores) {
+        if (core.first == efficiencyClass) processors.emplace_back(core.second);
+    }
+    return processors;
+}
+
+std::vector<int> getBigCoreProcessors() {
+    static const auto processors = getCoreProcessors(true);
+    return processors;
+}
+
+std::vector<int> getLittleCoreProcessors() {
+    static const auto processors = getCoreProcessors(false);
+    return processors;
+}
+
+int getNumberOfAvailableProcessors() {
+    const unsigned processors = std::thread::hardware_concurrency();
+    return processors ? static_cast<int>(processors) : 1;
+}
+
+std::vector<int> getNUMANodeProcessors(int) {
+    return {};
+}
+
 #if !(IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
 // OMP/SEQ threading on the Windows doesn't support NUMA
 std::vector<int> getAvailableNUMANodes() { return std::vector<int>(1, 0); }
@@ -5,23 +5,101 @@
 #include "precision_utils.h"
 #include <details/ie_exception.hpp>
 
+#include "ie_parallel.hpp"
+#include "ie_system_conf.h"
+#ifdef HAVE_SSE
+#include "cpu_x86_sse42/precision_utils_sse42.hpp"
+#endif  // HAVE_SSE
+
 #include <stdint.h>
+#include <algorithm>
 
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+namespace {
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+// arrays are converted by blocks of this size, big arrays are split between threads
+constexpr size_t conversionBlockSize = 16 * 1024;
+constexpr size_t minParallelBlocks = 4;
+
+template <typename Dst, typename Src, typename Convert>
+void convertArrays(Dst* dst, const Src* src, size_t nelem, const Convert& convert) {
+    const size_t blocks = (nelem + conversionBlockSize - 1) / conversionBlockSize;
+    if (blocks < minParallelBlocks) {
+        convert(dst, src, nelem);
+        return;
     }
+    parallel_for(blocks, [&](size_t block) {
+        const size_t offset = block * conversionBlockSize;
+        convert(dst + offset, src + offset, std::min(conversionBlockSize, nelem - offset));
+    });
+}
+
+}  // namespace
+
+void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convertArrays(dst, src, nelem, [&](float* d, const short* s, size_t n) {
+            f16tof32Arrays_sse42(d, s, n, scale, bias);
+        });
+        return;
+    }
+#endif  // HAVE_SSE
+    convertArrays(dst, src, nelem, [&](float* d, const short* s, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            d[i] = PrecisionUtils::f16tof32(s[i]) * scale + bias;
+        }
+    });
 }
 
 void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convertArrays(dst, src, nelem, [&](short* d, const float* s, size_t n) {
+            f32tof16Arrays_sse42(d, s, n, scale, bias);
+        });
+        return;
     }
+#endif  // HAVE_SSE
+    convertArrays(dst, src, nelem, [&](short* d, const float* s, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            d[i] = PrecisionUtils::f32tof16(s[i] * scale + bias);
+        }
+    });
+}
+
+void bf16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convertArrays(dst, src, nelem, [&](float* d, const short* s, size_t n) {
+            bf16tof32Arrays_sse42(d, s, n, scale, bias);
+        });
+        return;
+    }
+#endif  // HAVE_SSE
+    convertArrays(dst, src, nelem, [&](float* d, const short* s, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            d[i] = PrecisionUtils::bf16tof32(s[i]) * scale + bias;
+        }
+    });
+}
+
+void f32tobf16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        convertArrays(dst, src, nelem, [&](short* d, const float* s, size_t n) {
+            f32tobf16Arrays_sse42(d, s, n, scale, bias);
+        });
+        return;
+    }
+#endif  // HAVE_SSE
+    convertArrays(dst, src, nelem, [&](short* d, const float* s, size_t n) {
+        for (size_t i = 0; i < n; i++) {
+            d[i] = PrecisionUtils::f32tobf16(s[i] * scale + bias);
+        }
+    });
 }
 
 // Function to convert F32 into F16
@@ -127,9 +205,9 @@ ie_fp16 f32tof16(float x) {
     // check NAN and INF
     if ((v.u & EXP_MASK_F32) == EXP_MASK_F32) {
         if (v.u & 0x007FFFFF) {
-            return s | (v.u >> (23 - 10)) | 0x0200;  // return NAN f16
+            return s | ((v.u >> (23 - 10)) & 0x7FFF) | 0x0200;  // return NAN f16
         } else {
-            return s | (v.u >> (23 - 10));  // return INF f16
+            return s | ((v.u >> (23 - 10)) & 0x7FFF);  // return INF f16
         }
     }
 
@@ -164,5 +242,23 @@ ie_fp16 f32tof16(float x) {
     return v.u | s;
 }
 
+// This function converts f32 to bf16 with rounding to nearest even, NAN stays NAN
+ie_bf16 f32tobf16(float x) {
+    union {
+        float f;
+        uint32_t u;
+    } v;
+    v.f = x;
+
+    if ((v.u & 0x7FFFFFFF) > EXP_MASK_F32) {
+        return static_cast<ie_bf16>((v.u >> 16) | 0x0040);  // return quiet NAN bf16
+    }
+    return static_cast<ie_bf16>((v.u + 0x7FFF + ((v.u >> 16) & 1)) >> 16);
+}
+
+float bf16tof32(ie_bf16 x) {
+    return asfloat(static_cast<uint32_t>(static_cast<uint16_t>(x)) << 16);
+}
+
 }  // namespace PrecisionUtils
 }  // namespace InferenceEngine
@@ -9,8 +9,11 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
 #include <atomic>
 #include <climits>
+#include <chrono>
+#include <algorithm>
 #include <cassert>
 #include <utility>
 
@@ -59,7 +62,11 @@ struct CPUStreamsExecutor::Impl {
             _impl(impl) {
             {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
-                if (_impl->_streamIdQueue.empty()) {
+                if (_impl->_dedicatedLatencyStreams && (_worker == _impl)) {
+                    // worker streams keep their index, so latency streams get their own size and cores
+                    _streamId = _workerStreamId;
+                    _recycleStreamId = false;
+                } else if (_impl->_streamIdQueue.empty()) {
                     _streamId = _impl->_streamId++;
                 } else {
                     _streamId = _impl->_streamIdQueue.front();
@@ -71,60 +78,95 @@ struct CPUStreamsExecutor::Impl {
                     (_streamId % _impl->_config._streams)/
                     ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()))
                 : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            // on hybrid CPUs streams are pinned to cores of one type and sized per core type
+            const bool hybrid = (ThreadBindingType::HYBRID_AWARE == _impl->_config._threadBindingType) &&
+                                (0 != _impl->_config._streams) && (0 != _impl->_config._bigCoreStreams);
+            int threadsPerStream = _impl->_config._threadsPerStream;
+            int bindingStreamId = _streamId;
+            int threadBindingStep = _impl->_config._threadBindingStep;
+            int threadBindingOffset = _impl->_config._threadBindingOffset;
+            std::vector<int> coreProcessors;
+            if (hybrid) {
+                const int streamId = _streamId % _impl->_config._streams;
+                const bool bigCore = streamId < _impl->_config._bigCoreStreams;
+                threadsPerStream = bigCore ? _impl->_config._threadsPerStreamBig : _impl->_config._threadsPerStreamLittle;
+                bindingStreamId = bigCore ? streamId : streamId - _impl->_config._bigCoreStreams;
+                threadBindingStep = 1;
+                threadBindingOffset = 0;
+                coreProcessors = bigCore ? getBigCoreProcessors() : getLittleCoreProcessors();
+            } else if (_impl->_dedicatedLatencyStreams) {
+                // latency streams are placed first, other streams are bound to the cores after them
+                const int streamId = _streamId % _impl->_config._streams;
+                const int latencyStreams = _impl->_config._latencyStreams;
+                const int threadsPerLatencyStream = (0 != _impl->_config._threadsPerLatencyStream)
+                                                    ? _impl->_config._threadsPerLatencyStream : threadsPerStream;
+                if (streamId < latencyStreams) {
+                    threadBindingOffset += streamId * threadsPerLatencyStream;
+                    threadsPerStream = threadsPerLatencyStream;
+                } else {
+                    threadBindingOffset += latencyStreams * threadsPerLatencyStream + (streamId - latencyStreams) * threadsPerStream;
+                }
+                bindingStreamId = 0;
+            }
+            auto getBindingMask = [&] {
+                return hybrid ? GetProcessMask(coreProcessors) : GetProcessMask();
+            };
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
-            auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
+            auto concurrency = (0 == threadsPerStream) ? tbb::task_arena::automatic : threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
 #if TBB_INTERFACE_VERSION >= 11100  // TBB has numa aware task_arena api
                 _taskArena.reset(new tbb::task_arena{tbb::task_arena::constraints{_numaNodeId, concurrency}});
 #else
                 _taskArena.reset(new tbb::task_arena{concurrency});
 #endif
-            } else if ((0 != _impl->_config._threadsPerStream) || (ThreadBindingType::CORES == _impl->_config._threadBindingType)) {
+            } else if ((0 != threadsPerStream) || (ThreadBindingType::CORES == _impl->_config._threadBindingType) || hybrid) {
                 _taskArena.reset(new tbb::task_arena{concurrency});
-                if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
+                if ((ThreadBindingType::CORES == _impl->_config._threadBindingType) || hybrid) {
                     CpuSet processMask;
                     int    ncpus = 0;
-                    std::tie(processMask, ncpus) = GetProcessMask();
+                    std::tie(processMask, ncpus) = getBindingMask();
                     if (nullptr != processMask) {
                         _observer.reset(new Observer{*_taskArena,
                                                      std::move(processMask),
                                                      ncpus,
-                                                     _streamId,
-                                                     _impl->_config._threadsPerStream,
-                                                     _impl->_config._threadBindingStep,
-                                                     _impl->_config._threadBindingOffset});
+                                                     bindingStreamId,
+                                                     threadsPerStream,
+                                                     threadBindingStep,
+                                                     threadBindingOffset});
                         _observer->observe(true);
                     }
                 }
             }
 #elif IE_THREAD == IE_THREAD_OMP
-            omp_set_num_threads(_impl->_config._threadsPerStream);
+            omp_set_num_threads(threadsPerStream);
             if (!checkOpenMpEnvVars(false) && (ThreadBindingType::NONE != _impl->_config._threadBindingType)) {
                 CpuSet processMask;
                 int    ncpus = 0;
-                std::tie(processMask, ncpus) = GetProcessMask();
+                std::tie(processMask, ncpus) = getBindingMask();
                 if (nullptr != processMask) {
-                    parallel_nt(_impl->_config._threadsPerStream, [&] (int threadIndex, int threadsPerStream) {
-                        int thrIdx = _streamId * _impl->_config._threadsPerStream + threadIndex + _impl->_config._threadBindingOffset;
-                        PinThreadToVacantCore(thrIdx, _impl->_config._threadBindingStep, ncpus, processMask);
+                    parallel_nt(threadsPerStream, [&] (int threadIndex, int) {
+                        int thrIdx = bindingStreamId * threadsPerStream + threadIndex + threadBindingOffset;
+                        PinThreadToVacantCore(thrIdx, threadBindingStep, ncpus, processMask);
                     });
                 }
             }
 #elif IE_THREAD == IE_THREAD_SEQ
+            // a sequential stream has the only thread
+            (void)threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
                 PinCurrentThreadToSocket(_numaNodeId);
-            } else if (ThreadBindingType::CORES == _impl->_config._threadBindingType) {
+            } else if ((ThreadBindingType::CORES == _impl->_config._threadBindingType) || hybrid) {
                 CpuSet processMask;
                 int    ncpus = 0;
-                std::tie(processMask, ncpus) = GetProcessMask();
+                std::tie(processMask, ncpus) = getBindingMask();
                 if (nullptr != processMask) {
-                    PinThreadToVacantCore(_streamId + _impl->_config._threadBindingOffset, _impl->_config._threadBindingStep, ncpus, processMask);
+                    PinThreadToVacantCore(bindingStreamId + threadBindingOffset, threadBindingStep, ncpus, processMask);
                 }
             }
 #endif
         }
         ~Stream() {
-            {
+            if (_recycleStreamId) {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 _impl->_streamIdQueue.push(_streamId);
             }
@@ -138,6 +180,7 @@ struct CPUStreamsExecutor::Impl {
         Impl* _impl     = nullptr;
         int _streamId   = 0;
         int _numaNodeId = 0;
+        bool _recycleStreamId = true;
         bool _execute = false;
         std::queue<Task> _taskQueue;
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -148,9 +191,21 @@ struct CPUStreamsExecutor::Impl {
 
     explicit Impl(const Config& config) :
         _config{config},
+        _dedicatedLatencyStreams{(_config._latencyStreams > 0) && (_config._latencyStreams < _config._streams)},
+        _autoscaling{!_dedicatedLatencyStreams && (_config._minActiveStreams > 0) &&
+                     (_config._minActiveStreams < _config._streams)},
+        _streamQueues{_config._workStealing || _config._requestStreamAffinity},
+        _activeStreams{_config._streams},
+        _idleStreams(std::max(_config._streams, 0), true),
+        _queuedOnStream(std::max(_config._streams, 0), 0),
+        _windowStart{std::chrono::steady_clock::now()},
         _streams([this] {
             return std::make_shared<Impl::Stream>(this);
         }) {
+        if (_dedicatedLatencyStreams) {
+            // ids of worker streams are reserved, other threads get ids after them
+            _streamId = _config._streams;
+        }
         auto numaNodes = getAvailableNUMANodes();
         if (_config._streams != 0) {
             std::copy_n(std::begin(numaNodes),
@@ -159,33 +214,323 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        if (_streamQueues) {
+            for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+                _workerQueues.emplace_back(new WorkerQueue);
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                _worker = this;
+                _workerStreamId = streamId;
+                if (_dedicatedLatencyStreams && (streamId < _config._latencyStreams)) {
+                    RunLatencyStream();
+                    return;
+                }
+                if (_config._workStealing) {
+                    _workerQueueId.local() = streamId;
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
+                    bool latency = false;
+                    int workerQueueId = -1;
+                    bool notifyOthers = false;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
+                        // latency tasks are left to latency streams if there are any,
+                        // streams parked by autoscaling don't take tasks until they are activated again
+                        _idleStreams[streamId] = true;
+                        _queueCondVar.wait(lock, [&] {
+                            return (streamId < _activeStreams &&
+                                    ((!_dedicatedLatencyStreams && !_latencyTaskQueue.empty()) ||
+                                     !_prioritizedTaskQueue.empty() || !_taskQueue.empty() ||
+                                     SelectWorkerQueue(streamId) >= 0)) ||
+                                   (stopped = _isStopped);
+                        });
+                        _idleStreams[streamId] = false;
+                        if (!_dedicatedLatencyStreams && !_latencyTaskQueue.empty()) {
+                            task = std::move(_latencyTaskQueue.front());
+                            _latencyTaskQueue.pop();
+                            --_latencyTasksNumber;
+                            latency = true;
+                        } else if (!_prioritizedTaskQueue.empty() &&
+                                   ((_prioritizedTaskQueue.top()._priority.level >= 0) ||
+                                    (_taskQueue.empty() && SelectWorkerQueue(streamId) < 0))) {
+                            // top() is const, but the task is not used by comparison
+                            task = std::move(const_cast<PrioritizedTask&>(_prioritizedTaskQueue.top())._task);
+                            _prioritizedTaskQueue.pop();
+                        } else if ((workerQueueId = SelectWorkerQueue(streamId)) >= 0) {
+                            // the task is reserved by this thread, so it will be found in the worker queue
+                            --_pendingTasks;
+                            --_queuedOnStream[workerQueueId];
+                            // the stream becomes busy, so the rest of its tasks may be taken by other streams
+                            notifyOthers = !_config._workStealing && _queuedOnStream[streamId] > 0;
+                        } else if (!_taskQueue.empty()) {
                             task = std::move(_taskQueue.front());
                             _taskQueue.pop();
                         }
                     }
+                    if (notifyOthers) {
+                        _queueCondVar.notify_all();
+                    }
+                    if (workerQueueId >= 0) {
+                        task = PopWorkerQueue(workerQueueId, workerQueueId == streamId);
+                    }
                     if (task) {
+                        --_queuedTasksNumber;
+                        ++_busyStreamsNumber;
+                        // only batch tasks are preempted, latency streams don't need to preempt them
+                        _preemptible = (latency || _dedicatedLatencyStreams) ? nullptr : this;
                         Execute(task, *(_streams.local()));
+                        _preemptible = nullptr;
+                        --_busyStreamsNumber;
                     }
                 }
             });
         }
     }
 
-    void Enqueue(Task task) {
+    ~Impl() {
         {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopped = true;
+        }
+        _queueCondVar.notify_all();
+        _latencyQueueCondVar.notify_all();
+        for (auto& thread : _threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+
+    // executes latency tasks and tasks of positive priority level in a stream which does not take other tasks
+    void RunLatencyStream() {
+        for (;;) {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _latencyQueueCondVar.wait(lock, [&] {
+                    return !_latencyTaskQueue.empty() || !_latencyPrioritizedTaskQueue.empty() || _isStopped;
+                });
+                if (!_latencyTaskQueue.empty()) {
+                    task = std::move(_latencyTaskQueue.front());
+                    _latencyTaskQueue.pop();
+                    --_latencyTasksNumber;
+                } else if (!_latencyPrioritizedTaskQueue.empty()) {
+                    task = std::move(const_cast<PrioritizedTask&>(_latencyPrioritizedTaskQueue.top())._task);
+                    _latencyPrioritizedTaskQueue.pop();
+                } else {
+                    return;
+                }
+            }
+            --_queuedTasksNumber;
+            ++_busyStreamsNumber;
+            Execute(task, *(_streams.local()));
+            --_busyStreamsNumber;
+        }
+    }
+
+    std::condition_variable& LatencyQueueCondVar() {
+        return _dedicatedLatencyStreams ? _latencyQueueCondVar : _queueCondVar;
+    }
+
+    bool IsLatencyTask(const TaskPriority& priority) const {
+        return _dedicatedLatencyStreams && (priority.level > 0);
+    }
+
+    void Enqueue(Task task, Priority priority) {
+        ++_queuedTasksNumber;
+        if (LATENCY == priority) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _latencyTaskQueue.emplace(std::move(task));
+                ++_latencyTasksNumber;
+                ScaleActiveStreams();
+            }
+            NotifyStreams(LatencyQueueCondVar());
+            return;
+        }
+        if (_config._workStealing) {
+            // keep tasks of the current stream local, other tasks are distributed between streams round-robin
+            auto queueId = _workerQueueId.local();
+            if (queueId < 0) {
+                queueId = static_cast<int>(_nextWorkerQueue++ % _workerQueues.size());
+            }
+            {
+                auto& queue = *_workerQueues[queueId];
+                std::lock_guard<std::mutex> lock(queue._mutex);
+                queue._tasks.emplace_back(std::move(task));
+            }
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                ++_pendingTasks;
+                ++_queuedOnStream[queueId];
+                ScaleActiveStreams();
+            }
+        } else {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            ScaleActiveStreams();
+        }
+        NotifyStreams(_queueCondVar);
+    }
+
+    void Enqueue(Task task, const TaskPriority& priority) {
+        ++_queuedTasksNumber;
+        const bool latency = IsLatencyTask(priority);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            (latency ? _latencyPrioritizedTaskQueue : _prioritizedTaskQueue)
+                .push(PrioritizedTask{std::move(task), priority, _prioritizedTasksOrder++});
+            ScaleActiveStreams();
         }
-        _queueCondVar.notify_one();
+        NotifyStreams(latency ? _latencyQueueCondVar : _queueCondVar);
+    }
+
+    void Enqueue(std::vector<Task>& tasks, const std::vector<TaskPriority>& priorities, Priority priority) {
+        _queuedTasksNumber += static_cast<unsigned int>(tasks.size());
+        int workerQueueTasks = 0;
+        int queueId = -1;
+        if (_config._workStealing && BATCH == priority) {
+            queueId = _workerQueueId.local();
+            if (queueId < 0) {
+                queueId = static_cast<int>(_nextWorkerQueue++ % _workerQueues.size());
+            }
+            auto& queue = *_workerQueues[queueId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            for (std::size_t i = 0; i < tasks.size(); ++i) {
+                if (priorities[i].isDefault()) {
+                    queue._tasks.emplace_back(std::move(tasks[i]));
+                    ++workerQueueTasks;
+                }
+            }
+        }
+        bool latencyTasks = false;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (std::size_t i = 0; i < tasks.size(); ++i) {
+                if (LATENCY == priority) {
+                    _latencyTaskQueue.emplace(std::move(tasks[i]));
+                    ++_latencyTasksNumber;
+                    latencyTasks = true;
+                } else if (IsLatencyTask(priorities[i])) {
+                    _latencyPrioritizedTaskQueue.push(PrioritizedTask{std::move(tasks[i]), priorities[i], _prioritizedTasksOrder++});
+                    latencyTasks = true;
+                } else if (!priorities[i].isDefault()) {
+                    _prioritizedTaskQueue.push(PrioritizedTask{std::move(tasks[i]), priorities[i], _prioritizedTasksOrder++});
+                } else if (!_config._workStealing) {
+                    _taskQueue.emplace(std::move(tasks[i]));
+                }
+            }
+            if (workerQueueTasks > 0) {
+                _pendingTasks += workerQueueTasks;
+                _queuedOnStream[queueId] += workerQueueTasks;
+            }
+            ScaleActiveStreams();
+        }
+        _queueCondVar.notify_all();
+        if (latencyTasks && _dedicatedLatencyStreams) {
+            _latencyQueueCondVar.notify_all();
+        }
+    }
+
+    void EnqueueOnStream(Task task, const int streamId) {
+        ++_queuedTasksNumber;
+        {
+            auto& queue = *_workerQueues[streamId];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ++_pendingTasks;
+            ++_queuedOnStream[streamId];
+            ScaleActiveStreams();
+        }
+        // the stream which is waiting on the condition variable may be any, the home stream must see the task
+        _queueCondVar.notify_all();
+    }
+
+    // Called under the queue lock. Returns the stream whose worker queue the stream takes a task from, or -1.
+    // Own tasks are taken first. With work stealing tasks of any other stream are taken, with the request
+    // stream affinity only tasks of streams which are busy or parked, so tasks stay on their streams if they are idle
+    int SelectWorkerQueue(const int streamId) const {
+        if (0 == _pendingTasks) {
+            return -1;
+        }
+        if (_queuedOnStream[streamId] > 0) {
+            return streamId;
+        }
+        const int streams = static_cast<int>(_queuedOnStream.size());
+        for (int i = 1; i < streams; ++i) {
+            const int other = (streamId + i) % streams;
+            if (_queuedOnStream[other] > 0 &&
+                (_config._workStealing || !_idleStreams[other] || other >= _activeStreams)) {
+                return other;
+            }
+        }
+        return -1;
+    }
+
+    // with autoscaling streams share the condition variable with parked streams, so all of them are woken up
+    void NotifyStreams(std::condition_variable& condVar) {
+        if (_autoscaling) {
+            condVar.notify_all();
+        } else {
+            condVar.notify_one();
+        }
+    }
+
+    // Called under the queue lock when tasks are queued. Streams are activated at once if queued tasks outnumber
+    // idle active streams, and parked only if the load stays below the number of active streams for a whole
+    // _scaleDownDelay window, so short drops of the load don't make the executor oscillate
+    void ScaleActiveStreams() {
+        if (!_autoscaling) {
+            return;
+        }
+        const int queued = static_cast<int>(_taskQueue.size() + _prioritizedTaskQueue.size() + _latencyTaskQueue.size()) +
+                           _pendingTasks;
+        const int idle = static_cast<int>(std::count(_idleStreams.begin(), _idleStreams.begin() + _activeStreams, true));
+        // streams which are not waiting for tasks are counted as busy, so the load is never underestimated
+        const int load = _activeStreams - idle + queued;
+        const auto now = std::chrono::steady_clock::now();
+        _peakLoad = std::max(_peakLoad, load);
+        if (queued > idle && _activeStreams < _config._streams) {
+            _activeStreams = std::min(_config._streams, _activeStreams + queued - idle);
+        } else if (now - _windowStart >= std::chrono::milliseconds{_config._scaleDownDelay}) {
+            if (_peakLoad < _activeStreams) {
+                _activeStreams = std::max(_config._minActiveStreams, _peakLoad);
+            }
+        } else {
+            return;
+        }
+        _peakLoad = load;
+        _windowStart = now;
+    }
+
+    // the task is reserved by SelectWorkerQueue(), so the queue is not empty
+    Task PopWorkerQueue(const int queueId, const bool own) {
+        auto& queue = *_workerQueues[queueId];
+        std::lock_guard<std::mutex> lock(queue._mutex);
+        Task task;
+        // own tasks are taken in FIFO order, others' tasks are stolen from the back
+        if (own) {
+            task = std::move(queue._tasks.front());
+            queue._tasks.pop_front();
+        } else {
+            task = std::move(queue._tasks.back());
+            queue._tasks.pop_back();
+        }
+        return task;
+    }
+
+    // home streams are assigned round-robin among the streams which take batch tasks
+    int AssignHomeStream() {
+        const int firstStream = _dedicatedLatencyStreams ? _config._latencyStreams : 0;
+        const int streams = _config._streams - firstStream;
+        return firstStream + static_cast<int>(_nextHomeStream++ % static_cast<unsigned int>(streams));
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -201,6 +546,26 @@ struct CPUStreamsExecutor::Impl {
 #endif
     }
 
+    // runs latency tasks in the stream thread of the preempted batch task, which is already inside the stream arena
+    void Preempt() {
+        _preemptible = nullptr;
+        for (;;) {
+            Task task;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_latencyTaskQueue.empty()) {
+                    break;
+                }
+                task = std::move(_latencyTaskQueue.front());
+                _latencyTaskQueue.pop();
+                --_latencyTasksNumber;
+            }
+            --_queuedTasksNumber;
+            task();
+        }
+        _preemptible = this;
+    }
+
     void Defer(Task task) {
         auto& stream = *(_streams.local());
         stream._taskQueue.push(std::move(task));
@@ -217,18 +582,67 @@ struct CPUStreamsExecutor::Impl {
     }
 
     Config                                  _config;
+    const bool                              _dedicatedLatencyStreams;  //!< latency tasks are executed by own streams
+    const bool                              _autoscaling;  //!< the number of streams taking tasks follows the load
+    const bool                              _streamQueues;  //!< every stream has own worker queue
+    int                                     _activeStreams;  //!< streams with greater ids are parked
+    std::vector<bool>                       _idleStreams;  //!< streams which wait for tasks
+    std::vector<int>                        _queuedOnStream;  //!< not reserved tasks in the worker queue of each stream
+    int                                     _peakLoad = 0;  //!< max of busy streams and queued tasks in the window
+    std::chrono::steady_clock::time_point   _windowStart;  //!< start of the window in which the load is observed
     std::mutex                              _streamIdMutex;
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
     std::mutex                              _mutex;
     std::condition_variable                 _queueCondVar;
+    std::condition_variable                 _latencyQueueCondVar;
     std::queue<Task>                        _taskQueue;
+    std::queue<Task>                        _latencyTaskQueue;
+    struct PrioritizedTask {
+        Task                _task;
+        TaskPriority        _priority;
+        unsigned long long  _order;
+    };
+    struct PrioritizedTaskLess {
+        // the task which is taken later is less, tasks of the same priority are taken in FIFO order
+        bool operator()(const PrioritizedTask& lhs, const PrioritizedTask& rhs) const {
+            if (lhs._priority.level != rhs._priority.level) {
+                return lhs._priority.level < rhs._priority.level;
+            }
+            if (lhs._priority.deadline != rhs._priority.deadline) {
+                return lhs._priority.deadline > rhs._priority.deadline;
+            }
+            return lhs._order > rhs._order;
+        }
+    };
+    std::priority_queue<PrioritizedTask, std::vector<PrioritizedTask>, PrioritizedTaskLess> _prioritizedTaskQueue;
+    std::priority_queue<PrioritizedTask, std::vector<PrioritizedTask>, PrioritizedTaskLess> _latencyPrioritizedTaskQueue;
+    unsigned long long                      _prioritizedTasksOrder = 0;
+    std::atomic<unsigned int>               _latencyTasksNumber{0};
     bool                                    _isStopped = false;
+    struct WorkerQueue {
+        std::mutex          _mutex;
+        std::deque<Task>    _tasks;
+    };
+    std::vector<std::unique_ptr<WorkerQueue>>   _workerQueues;
+    ThreadLocal<int>                        _workerQueueId{-1};
+    std::atomic<unsigned int>               _nextWorkerQueue{0};
+    std::atomic<unsigned int>               _nextHomeStream{0};
+    int                                     _pendingTasks = 0;
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
+    std::atomic<unsigned int>               _queuedTasksNumber{0};
+    std::atomic<unsigned int>               _busyStreamsNumber{0};
+    static thread_local Impl*               _preemptible;  //!< the executor whose batch task the thread executes
+    static thread_local Impl*               _worker;  //!< the executor which owns the current worker thread
+    static thread_local int                 _workerStreamId;
 };
 
+thread_local CPUStreamsExecutor::Impl* CPUStreamsExecutor::Impl::_preemptible = nullptr;
+thread_local CPUStreamsExecutor::Impl* CPUStreamsExecutor::Impl::_worker = nullptr;
+thread_local int CPUStreamsExecutor::Impl::_workerStreamId = -1;
+
 
 int CPUStreamsExecutor::GetStreamId() {
     auto stream = _impl->_streams.local();
@@ -240,20 +654,34 @@ int CPUStreamsExecutor::GetNumaNodeId() {
     return stream->_numaNodeId;
 }
 
+unsigned int CPUStreamsExecutor::GetQueuedTasksNumber() const {
+    return _impl->_queuedTasksNumber.load();
+}
+
+unsigned int CPUStreamsExecutor::GetBusyStreamsNumber() const {
+    return _impl->_busyStreamsNumber.load();
+}
+
+unsigned int CPUStreamsExecutor::GetActiveStreamsNumber() const {
+    std::lock_guard<std::mutex> lock(_impl->_mutex);
+    return static_cast<unsigned int>(std::max(_impl->_activeStreams, 0));
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
-    _impl{new Impl{config}} {
+    _impl{std::make_shared<Impl>(config)} {
 }
 
-CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
-    }
-    _impl->_queueCondVar.notify_all();
-    for (auto& thread : _impl->_threads) {
-        if (thread.joinable()) {
-            thread.join();
-        }
+CPUStreamsExecutor::CPUStreamsExecutor(const CPUStreamsExecutor& executor, Priority priority) :
+    _impl{executor._impl},
+    _priority{priority} {
+}
+
+CPUStreamsExecutor::~CPUStreamsExecutor() {}
+
+void CPUStreamsExecutor::PreemptionPoint() {
+    auto impl = Impl::_preemptible;
+    if (nullptr != impl && impl->_latencyTasksNumber > 0) {
+        impl->Preempt();
     }
 }
 
@@ -265,7 +693,39 @@ void CPUStreamsExecutor::run(Task task) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), _priority);
+    }
+}
+
+void CPUStreamsExecutor::runBatch(std::vector<Task> tasks, const std::vector<TaskPriority>& priorities) {
+    if (0 == _impl->_config._streams) {
+        for (auto&& task : tasks) {
+            _impl->Defer(std::move(task));
+        }
+    } else {
+        _impl->Enqueue(tasks, priorities, _priority);
+    }
+}
+
+void CPUStreamsExecutor::runOnStream(Task task, int streamId) {
+    const int firstStream = _impl->_dedicatedLatencyStreams ? _impl->_config._latencyStreams : 0;
+    if ((0 == _impl->_config._streams) || (LATENCY == _priority) || !_impl->_streamQueues ||
+        (streamId < firstStream) || (streamId >= _impl->_config._streams)) {
+        run(std::move(task));
+    } else {
+        _impl->EnqueueOnStream(std::move(task), streamId);
+    }
+}
+
+int CPUStreamsExecutor::AssignHomeStream() {
+    return (0 == _impl->_config._streams) ? -1 : _impl->AssignHomeStream();
+}
+
+void CPUStreamsExecutor::runWithPriority(Task task, const TaskPriority& priority) {
+    if ((0 == _impl->_config._streams) || (LATENCY == _priority) || priority.isDefault()) {
+        run(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
@@ -22,6 +22,26 @@ ITaskExecutor::Ptr ExecutorManagerImpl::getExecutor(std::string id) {
     return foundEntry->second;
 }
 
+namespace {
+bool isSameConfig(const IStreamsExecutor::Config& executorConfig, const IStreamsExecutor::Config& config) {
+    return executorConfig._name == config._name &&
+           executorConfig._streams == config._streams &&
+           executorConfig._threadsPerStream == config._threadsPerStream &&
+           executorConfig._threadBindingType == config._threadBindingType &&
+           executorConfig._threadBindingStep == config._threadBindingStep &&
+           executorConfig._threadBindingOffset == config._threadBindingOffset &&
+           executorConfig._workStealing == config._workStealing &&
+           executorConfig._requestStreamAffinity == config._requestStreamAffinity &&
+           executorConfig._bigCoreStreams == config._bigCoreStreams &&
+           executorConfig._threadsPerStreamBig == config._threadsPerStreamBig &&
+           executorConfig._threadsPerStreamLittle == config._threadsPerStreamLittle &&
+           executorConfig._latencyStreams == config._latencyStreams &&
+           executorConfig._threadsPerLatencyStream == config._threadsPerLatencyStream &&
+           executorConfig._minActiveStreams == config._minActiveStreams &&
+           executorConfig._scaleDownDelay == config._scaleDownDelay;
+}
+}  // namespace
+
 IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) {
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
@@ -29,13 +49,7 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
         if (executor.use_count() != 1)
             continue;
 
-        const auto& executorConfig = it.first;
-        if (executorConfig._name == config._name &&
-            executorConfig._streams == config._streams &&
-            executorConfig._threadsPerStream == config._threadsPerStream &&
-            executorConfig._threadBindingType == config._threadBindingType &&
-            executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
+        if (isSameConfig(it.first, config))
             return executor;
     }
     auto newExec = std::make_shared<CPUStreamsExecutor>(config);
@@ -43,6 +57,18 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return newExec;
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                                       CPUStreamsExecutor::Priority priority) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    for (const auto& it : sharedCPUStreamsExecutors) {
+        if (isSameConfig(it.first, config))
+            return std::make_shared<CPUStreamsExecutor>(*it.second, priority);
+    }
+    auto newExec = std::make_shared<CPUStreamsExecutor>(config);
+    sharedCPUStreamsExecutors.emplace_back(std::make_pair(config, newExec));
+    return std::make_shared<CPUStreamsExecutor>(*newExec, priority);
+}
+
 // for tests purposes
 size_t ExecutorManagerImpl::getExecutorsNumber() {
     return executors.size();
@@ -53,12 +79,18 @@ size_t ExecutorManagerImpl::getIdleCPUStreamsExecutorsNumber() {
     return cpuStreamsExecutors.size();
 }
 
+// for tests purposes
+size_t ExecutorManagerImpl::getSharedCPUStreamsExecutorsNumber() {
+    return sharedCPUStreamsExecutors.size();
+}
+
 void ExecutorManagerImpl::clear(const std::string& id) {
     std::lock_guard<std::mutex> stream_guard(streamExecutorMutex);
     std::lock_guard<std::mutex> task_guard(taskExecutorMutex);
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedCPUStreamsExecutors.clear();
     } else {
         executors.erase(id);
         cpuStreamsExecutors.erase(
@@ -67,6 +99,12 @@ void ExecutorManagerImpl::clear(const std::string& id) {
                               return it.first._name == id;
                            }),
             cpuStreamsExecutors.end());
+        sharedCPUStreamsExecutors.erase(
+            std::remove_if(sharedCPUStreamsExecutors.begin(), sharedCPUStreamsExecutors.end(),
+                           [&](const std::pair<IStreamsExecutor::Config, CPUStreamsExecutor::Ptr>& it) {
+                              return it.first._name == id;
+                           }),
+            sharedCPUStreamsExecutors.end());
     }
 }
 
@@ -123,6 +161,10 @@ size_t ExecutorManager::getIdleCPUStreamsExecutorsNumber() {
     return _impl.getIdleCPUStreamsExecutorsNumber();
 }
 
+size_t ExecutorManager::getSharedCPUStreamsExecutorsNumber() {
+    return _impl.getSharedCPUStreamsExecutorsNumber();
+}
+
 void ExecutorManager::clear(const std::string& id) {
     _impl.clear(id);
 }
@@ -131,4 +173,9 @@ IStreamsExecutor::Ptr ExecutorManager::getIdleCPUStreamsExecutor(const IStreamsE
     return _impl.getIdleCPUStreamsExecutor(config);
 }
 
+IStreamsExecutor::Ptr ExecutorManager::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                                   CPUStreamsExecutor::Priority priority) {
+    return _impl.getSharedCPUStreamsExecutor(config, priority);
+}
+
 }  // namespace InferenceEngine
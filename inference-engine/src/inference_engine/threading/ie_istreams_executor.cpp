@@ -12,10 +12,31 @@
 #include <string>
 #include <algorithm>
 #include <vector>
-#include <thread>
 
 
 namespace InferenceEngine {
+namespace {
+// bare minimum of streams (that evenly divides available number of core)
+int getBareMinimumStreams(const int num_cores) {
+    if (0 == num_cores % 4)
+        return std::max(4, num_cores / 4);
+    else if (0 == num_cores % 5)
+        return std::max(5, num_cores / 5);
+    else if (0 == num_cores % 3)
+        return std::max(3, num_cores / 3);
+    else  // if user disables some cores say in BIOS, so we got weird #cores which is not easy to divide
+        return 1;
+}
+
+IStreamsExecutor::ThreadBindingType getCoresBindingType() {
+#if (defined(__APPLE__) || defined(_WIN32))
+    return IStreamsExecutor::ThreadBindingType::NUMA;
+#else
+    return IStreamsExecutor::ThreadBindingType::CORES;
+#endif
+}
+}  // namespace
+
 IStreamsExecutor::~IStreamsExecutor() {}
 
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
@@ -24,6 +45,11 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY(CPU_WORK_STEALING),
+        CONFIG_KEY(CPU_REQUEST_STREAM_AFFINITY),
+        CONFIG_KEY(CPU_LATENCY_STREAMS),
+        CONFIG_KEY(CPU_THREADS_PER_LATENCY_STREAM),
+        CONFIG_KEY(CPU_MIN_ACTIVE_STREAMS),
     };
 }
 
@@ -44,27 +70,32 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                 _threadBindingType = (value == CONFIG_VALUE(YES))
                         ? IStreamsExecutor::ThreadBindingType::CORES : IStreamsExecutor::ThreadBindingType::NUMA;
 #endif
+            } else if (value == CONFIG_VALUE(HYBRID_AWARE)) {
+                _threadBindingType = IStreamsExecutor::ThreadBindingType::HYBRID_AWARE;
             } else if (value == CONFIG_VALUE(NO)) {
                 _threadBindingType = IStreamsExecutor::ThreadBindingType::NONE;
             } else {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << CONFIG_KEY(CPU_BIND_THREAD)
-                                   << ". Expected only YES(binds to cores) / NO(no binding) / NUMA(binds to NUMA nodes)";
+                                   << ". Expected only YES(binds to cores) / NO(no binding) / NUMA(binds to NUMA nodes) / "
+                                   << "HYBRID_AWARE(binds streams to core types of hybrid CPUs)";
             }
         } else if (key == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
+            _bigCoreStreams = 0;
             if (value == CONFIG_VALUE(CPU_THROUGHPUT_NUMA)) {
                 _streams = static_cast<int>(getAvailableNUMANodes().size());
             } else if (value == CONFIG_VALUE(CPU_THROUGHPUT_AUTO)) {
                 const int sockets = static_cast<int>(getAvailableNUMANodes().size());
-                // bare minimum of streams (that evenly divides available number of core)
-                const int num_cores = sockets == 1 ? std::thread::hardware_concurrency() : getNumberOfCPUCores();
-                if (0 == num_cores % 4)
-                    _streams = std::max(4, num_cores / 4);
-                else if (0 == num_cores % 5)
-                    _streams = std::max(5, num_cores / 5);
-                else if (0 == num_cores % 3)
-                    _streams = std::max(3, num_cores / 3);
-                else  // if user disables some cores say in BIOS, so we got weird #cores which is not easy to divide
-                    _streams = 1;
+                const int bigCores = static_cast<int>(getBigCoreProcessors().size());
+                const int littleCores = static_cast<int>(getLittleCoreProcessors().size());
+                if (sockets == 1 && bigCores != 0 && littleCores != 0) {
+                    // little cores are about two times slower, so their streams get twice more threads
+                    _bigCoreStreams = getBareMinimumStreams(bigCores);
+                    const int threadsPerStreamBig = std::max(1, bigCores / _bigCoreStreams);
+                    _streams = _bigCoreStreams + std::max(1, littleCores / (2 * threadsPerStreamBig));
+                } else {
+                    const int num_cores = sockets == 1 ? getNumberOfAvailableProcessors() : getNumberOfCPUCores();
+                    _streams = getBareMinimumStreams(num_cores);
+                }
             } else {
                 int val_i;
                 try {
@@ -106,6 +137,31 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                                    << ". Expected only non negative numbers (#threads)";
             }
             _threadsPerStream = val_i;
+        } else if (key == CONFIG_KEY(CPU_LATENCY_STREAMS) || key == CONFIG_KEY(CPU_THREADS_PER_LATENCY_STREAM) ||
+                   key == CONFIG_KEY(CPU_MIN_ACTIVE_STREAMS)) {
+            int val_i;
+            try {
+                val_i = std::stoi(value);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key
+                                   << ". Expected only non negative numbers";
+            }
+            if (val_i < 0) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key
+                                   << ". Expected only non negative numbers";
+            }
+            (key == CONFIG_KEY(CPU_LATENCY_STREAMS) ? _latencyStreams
+                : key == CONFIG_KEY(CPU_THREADS_PER_LATENCY_STREAM) ? _threadsPerLatencyStream : _minActiveStreams) = val_i;
+        } else if (key == CONFIG_KEY(CPU_WORK_STEALING) || key == CONFIG_KEY(CPU_REQUEST_STREAM_AFFINITY)) {
+            bool& flag = (key == CONFIG_KEY(CPU_WORK_STEALING)) ? _workStealing : _requestStreamAffinity;
+            if (value == CONFIG_VALUE(YES)) {
+                flag = true;
+            } else if (value == CONFIG_VALUE(NO)) {
+                flag = false;
+            } else {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key
+                                   << ". Expected only YES/NO";
+            }
         } else {
             THROW_IE_EXCEPTION << "Wrong value for property key " << key;
         }
@@ -123,6 +179,9 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
             case IStreamsExecutor::ThreadBindingType::NUMA:
                 return {CONFIG_VALUE(NUMA)};
             break;
+            case IStreamsExecutor::ThreadBindingType::HYBRID_AWARE:
+                return {CONFIG_VALUE(HYBRID_AWARE)};
+            break;
         }
     } else if (key == CONFIG_KEY(CPU_THROUGHPUT_STREAMS)) {
         return {_streams};
@@ -130,6 +189,16 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {_threads};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {_threadsPerStream};
+    } else if (key == CONFIG_KEY(CPU_WORK_STEALING)) {
+        return {std::string(_workStealing ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO))};
+    } else if (key == CONFIG_KEY(CPU_REQUEST_STREAM_AFFINITY)) {
+        return {std::string(_requestStreamAffinity ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO))};
+    } else if (key == CONFIG_KEY(CPU_LATENCY_STREAMS)) {
+        return {_latencyStreams};
+    } else if (key == CONFIG_KEY(CPU_THREADS_PER_LATENCY_STREAM)) {
+        return {_threadsPerLatencyStream};
+    } else if (key == CONFIG_KEY(CPU_MIN_ACTIVE_STREAMS)) {
+        return {_minActiveStreams};
     } else {
         THROW_IE_EXCEPTION << "Wrong value for property key " << key;
     }
@@ -141,11 +210,44 @@ IStreamsExecutor::Config IStreamsExecutor::Config::MakeDefaultMultiThreaded(cons
     const auto& numaNodes = getAvailableNUMANodes();
     const auto numaNodesNum = numaNodes.size();
     auto streamExecutorConfig = initial;
-    const auto hwCores = streamExecutorConfig._streams > 1 && numaNodesNum == 1 ? parallel_get_max_threads() : getNumberOfCPUCores();
+    const auto hwCores = streamExecutorConfig._streams > 1 && numaNodesNum == 1
+                         ? std::min(parallel_get_max_threads(), getNumberOfAvailableProcessors())
+                         : getNumberOfCPUCores();
     const auto threads = streamExecutorConfig._threads ? streamExecutorConfig._threads : (envThreads ? envThreads : hwCores);
     streamExecutorConfig._threadsPerStream = streamExecutorConfig._streams
                                             ? std::max(1, threads/streamExecutorConfig._streams)
                                             : threads;
+    const int latencyStreams = streamExecutorConfig._latencyStreams;
+    if ((latencyStreams > 0) && (latencyStreams < streamExecutorConfig._streams) &&
+        (0 != streamExecutorConfig._threadsPerLatencyStream)) {
+        const int latencyThreads = latencyStreams * streamExecutorConfig._threadsPerLatencyStream;
+        streamExecutorConfig._threadsPerStream =
+            std::max(1, (threads - latencyThreads) / (streamExecutorConfig._streams - latencyStreams));
+    }
+    if (ThreadBindingType::HYBRID_AWARE == streamExecutorConfig._threadBindingType) {
+        const int bigCores = static_cast<int>(getBigCoreProcessors().size());
+        const int littleCores = static_cast<int>(getLittleCoreProcessors().size());
+        const int streams = streamExecutorConfig._streams;
+        // explicitly limited number of threads is distributed between all cores as usual
+        if (0 == bigCores || 0 == littleCores || 0 == streams || numaNodesNum != 1 ||
+            0 != streamExecutorConfig._threads || 0 != envThreads) {
+            streamExecutorConfig._threadBindingType = getCoresBindingType();
+            streamExecutorConfig._bigCoreStreams = 0;
+            return streamExecutorConfig;
+        }
+        auto& bigCoreStreams = streamExecutorConfig._bigCoreStreams;
+        if (bigCoreStreams <= 0 || bigCoreStreams > streams) {
+            // the latency stream is placed on big cores only, other streams are distributed in proportion
+            // to the cores performance, where a little core is about two times slower than a big one
+            const int performance = 2 * bigCores + littleCores;
+            bigCoreStreams = (1 == streams) ? 1
+                : std::max(1, std::min(streams, (2 * bigCores * streams + performance / 2) / performance));
+        }
+        const int littleCoreStreams = streams - bigCoreStreams;
+        streamExecutorConfig._threadsPerStreamBig = std::max(1, bigCores / bigCoreStreams);
+        streamExecutorConfig._threadsPerStreamLittle = littleCoreStreams ? std::max(1, littleCores / littleCoreStreams) : 0;
+        streamExecutorConfig._threadsPerStream = streamExecutorConfig._threadsPerStreamBig;
+    }
     return streamExecutorConfig;
 }
 
@@ -11,6 +11,16 @@
 
 namespace InferenceEngine {
 
+void ITaskExecutor::runWithPriority(Task task, const TaskPriority&) {
+    run(std::move(task));
+}
+
+void ITaskExecutor::runBatch(std::vector<Task> tasks, const std::vector<TaskPriority>& priorities) {
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        runWithPriority(std::move(tasks[i]), priorities[i]);
+    }
+}
+
 void ITaskExecutor::runAndWait(const std::vector<Task>& tasks) {
     std::vector<std::packaged_task<void()>> packagedTasks;
     std::vector<std::future<void>> futures;
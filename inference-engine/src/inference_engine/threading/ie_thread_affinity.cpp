@@ -8,6 +8,7 @@
 #include <cerrno>
 #include <utility>
 #include <tuple>
+#include <vector>
 
 
 #if !(defined(__APPLE__) || defined(_WIN32))
@@ -33,6 +34,27 @@ std::tuple<CpuSet, int> GetProcessMask() {
     return std::make_tuple(nullptr, 0);
 }
 
+std::tuple<CpuSet, int> GetProcessMask(const std::vector<int>& processors) {
+    CpuSet processMask;
+    int    ncpus = 0;
+    std::tie(processMask, ncpus) = GetProcessMask();
+    if (nullptr == processMask) {
+        return std::make_tuple(nullptr, 0);
+    }
+    const size_t size = CPU_ALLOC_SIZE(ncpus);
+    CpuSet targetMask{CPU_ALLOC(ncpus)};
+    CPU_ZERO_S(size, targetMask.get());
+    for (auto&& processor : processors) {
+        if (processor < ncpus && CPU_ISSET_S(processor, size, processMask.get())) {
+            CPU_SET_S(processor, size, targetMask.get());
+        }
+    }
+    if (0 == CPU_COUNT_S(size, targetMask.get())) {
+        return std::make_tuple(nullptr, 0);
+    }
+    return std::make_tuple(std::move(targetMask), ncpus);
+}
+
 /* Release the cores affinity mask for the current process */
 void ReleaseProcessMask(cpu_set_t* mask) {
     if (nullptr != mask) CPU_FREE(mask);
@@ -72,6 +94,16 @@ bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSe
 }
 
 bool PinCurrentThreadToSocket(int socket) {
+    const auto nodeProcessors = InferenceEngine::getNUMANodeProcessors(socket);
+    if (!nodeProcessors.empty()) {
+        int ncpus = 0;
+        CpuSet mask;
+        std::tie(mask, ncpus) = GetProcessMask(nodeProcessors);
+        // the node is out of the process mask (e.g. of the container cpuset), so the thread is not pinned
+        return nullptr != mask && PinCurrentThreadByMask(ncpus, mask);
+    }
+
+    // no NUMA topology in sysfs, the sockets are assumed to have contiguous ranges of cores
     const int sockets = InferenceEngine::getAvailableNUMANodes().size();
     const int cores = InferenceEngine::getNumberOfCPUCores();
     const int cores_per_socket = cores/sockets;
@@ -98,6 +130,9 @@ bool PinCurrentThreadToSocket(int socket) {
 std::tuple<CpuSet, int> GetProcessMask() {
     return std::make_tuple(nullptr, 0);
 }
+std::tuple<CpuSet, int> GetProcessMask(const std::vector<int>&) {
+    return std::make_tuple(nullptr, 0);
+}
 void ReleaseProcessMask(cpu_set_t*) {}
 
 bool PinThreadToVacantCore(int thrIdx, int hyperthreads, int ncores, const CpuSet& procMask) {
@@ -91,4 +91,15 @@ saveGraphToDot(InferenceEngine::ICNNNetwork& network, std::ostream& out, printer
 INFERENCE_ENGINE_API_CPP(std::unordered_set<DataPtr>)
 getRootDataObjects(ICNNNetwork& network);
 
+/**
+ * @brief Serializes a network into IR v7 like XML topology and binary weights
+ * @note Can be used by plugins to export networks which were already converted to CNNNetworkImpl
+ *
+ * @param network - network to serialize
+ * @param xml - output stream for topology
+ * @param weights - output stream for weights
+ */
+INFERENCE_ENGINE_API_CPP(void)
+serializeNetwork(const InferenceEngine::ICNNNetwork& network, std::ostream& xml, std::ostream& weights);
+
 }  // namespace InferenceEngine
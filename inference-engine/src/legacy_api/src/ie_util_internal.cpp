@@ -24,6 +24,7 @@
 #include <legacy/details/ie_cnn_network_iterator.hpp>
 #include <legacy/ie_layers.h>
 #include "ie_legacy_itt.hpp"
+#include "network_serializer_v7.hpp"
 
 using std::string;
 
@@ -588,4 +589,8 @@ std::unordered_set<DataPtr> getRootDataObjects(ICNNNetwork& network) {
     return ret;
 }
 
+void serializeNetwork(const ICNNNetwork& network, std::ostream& xml, std::ostream& weights) {
+    Serialization::Serialize(xml, weights, network);
+}
+
 }  // namespace InferenceEngine
@@ -7,6 +7,7 @@
 #include <ie_icnn_network.hpp>
 #include <legacy/ie_layers.h>
 
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -22,5 +23,14 @@ namespace Serialization {
 void Serialize(const std::string& xmlPath, const std::string& binPath,
                const InferenceEngine::ICNNNetwork& network);
 
+/**
+ * @brief Serialize network into IE IR XML and binary weights streams
+ * @param xmlStream A stream to write XML topology to
+ * @param binStream A stream to write weights to
+ * @param network   network to be serialized
+ */
+void Serialize(std::ostream& xmlStream, std::ostream& binStream,
+               const InferenceEngine::ICNNNetwork& network);
+
 }  // namespace Serialization
 }  // namespace InferenceEngine
\ No newline at end of file
@@ -0,0 +1,39 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include "transformations_visibility.hpp"
+
+namespace ngraph {
+namespace pass {
+namespace low_precision {
+
+class TRANSFORMATIONS_API WeightsOnlyQuantization;
+
+}  // namespace low_precision
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @brief Quantizes constant weights of MatMul layers to INT8 without calibration data, activations stay
+ * in the original precision. Weights are quantized symmetrically per output channel:
+ * scale = max(abs(weights)) / 127, int8 = round(weights / scale), so the largest weight of every channel is
+ * represented exactly and no value is clipped.
+ *
+ *  before: Constant (f32/f16) -> MatMul
+ *  after:  Constant (i8) -> DequantizationConvert -> DequantizationMultiply (scale per channel) -> MatMul
+ *
+ * Dequantization layers are marked with DEQUANTIZATION runtime info, so plugins can fuse them into weight
+ * decompression, and the Convert is excluded from constant folding to keep the compressed weights.
+ * The transformation is independent of FakeQuantize layers and is not a part of LowPrecisionTransformer.
+ */
+class ngraph::pass::low_precision::WeightsOnlyQuantization : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    WeightsOnlyQuantization();
+};
@@ -17,6 +17,7 @@
 
 #include "low_precision/common/ie_lpt_exception.hpp"
 #include "low_precision/network_helper.hpp"
+#include "transformations/rt_info/low_precision_override_attribute.hpp"
 
 namespace ngraph {
 namespace pass {
@@ -75,6 +76,19 @@ bool FakeQuantizeTransformation::transform(TransformationContext& context, ngrap
         return false;
     }
 
+    // quantization is useless if all consumers are kept in original precision by user request
+    const std::vector<std::shared_ptr<Node>> children = getChildrenRecursivelyExceptPrecisionPreserved(layer);
+    const bool allChildrenInOriginalPrecision = !children.empty() && std::all_of(
+        children.begin(),
+        children.end(),
+        [](const std::shared_ptr<Node>& child) {
+            std::vector<element::Type> overriddenPrecisions;
+            return getLowPrecisionOverride(*child, overriddenPrecisions) && overriddenPrecisions.empty();
+        });
+    if (allChildrenInOriginalPrecision) {
+        return false;
+    }
+
     if (!QuantizationDetails::isSupportedLevel(layer->get_levels())) {
         return false;
     }
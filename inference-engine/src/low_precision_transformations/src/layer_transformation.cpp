@@ -4,6 +4,7 @@
 
 #include <low_precision/layer_transformation.hpp>
 #include <low_precision/network_helper.hpp>
+#include <transformations/rt_info/low_precision_override_attribute.hpp>
 
 
 #include <algorithm>
@@ -476,6 +477,12 @@ void LayerTransformation::updateOutput(
 
 void LayerTransformation::addPattern(ngraph::pass::GraphRewrite& pass, TransformationContext& context, std::shared_ptr<Node> patternRoot) const {
     ngraph::graph_rewrite_callback internal_callback = [this, &context](ngraph::pattern::Matcher &m) {
+        // the layer is kept in original precision by user request
+        std::vector<element::Type> overriddenPrecisions;
+        if (getLowPrecisionOverride(*m.get_match_root(), overriddenPrecisions) && overriddenPrecisions.empty()) {
+            return false;
+        }
+
         const bool result = transform(context, m);
 #ifdef LPT_DISPLAY_PRECISION
         if (result) {
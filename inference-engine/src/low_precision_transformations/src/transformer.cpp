@@ -19,6 +19,7 @@
 
 #include "ngraph_ops/type_relaxed.hpp"
 #include "ngraph/pass/constant_folding.hpp"
+#include "transformations/rt_info/low_precision_override_attribute.hpp"
 
 // branch specific transformations
 #include "low_precision/concat.hpp"
@@ -440,6 +441,12 @@ std::vector<element::Type> LowPrecisionTransformer::getPrecisionsOnActivations(c
     for (const auto& transform : transformation) {
         precisions = precisionIntersection(precisions, transform->getPrecisionsOnActivations());
     }
+
+    // per-layer override can only narrow precisions, empty precisions keep the layer in original precision
+    std::vector<element::Type> overriddenPrecisions;
+    if (getLowPrecisionOverride(op, overriddenPrecisions)) {
+        precisions = precisionIntersection(precisions, overriddenPrecisions);
+    }
     return precisions;
 }
 
@@ -450,6 +457,11 @@ bool LowPrecisionTransformer::isQuantized(const std::shared_ptr<Node>& layer) co
         return false;
     }
 
+    std::vector<element::Type> overriddenPrecisions;
+    if (getLowPrecisionOverride(*layer, overriddenPrecisions) && overriddenPrecisions.empty()) {
+        return false;
+    }
+
     for (const auto& transform : transformation) {
         if (!transform->isQuantized(layer)) {
             return false;
@@ -0,0 +1,95 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision/weights_only_quantization.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/rt_info.hpp>
+
+#include "low_precision/common/dequantization_op.hpp"
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::low_precision::WeightsOnlyQuantization, "WeightsOnlyQuantization", 0);
+
+ngraph::pass::low_precision::WeightsOnlyQuantization::WeightsOnlyQuantization() {
+    auto weights = ngraph::pattern::wrap_type<opset1::Constant>(pattern::has_static_shape());
+    auto matMul = ngraph::pattern::wrap_type<opset1::MatMul>({ pattern::any_input(), weights });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& patternMap = m.get_pattern_value_map();
+        const auto matMulNode = std::dynamic_pointer_cast<opset1::MatMul>(patternMap.at(matMul).get_node_shared_ptr());
+        const auto constant = std::dynamic_pointer_cast<opset1::Constant>(patternMap.at(weights).get_node_shared_ptr());
+        if (!matMulNode || !constant || !constant->get_element_type().is_real()) {
+            return false;
+        }
+
+        const Shape shape = constant->get_shape();
+        if (shape.size() < 2ul) {
+            return false;
+        }
+
+        // weights are reduced by the K axis, all other axes are output channels
+        const size_t reduceAxis = matMulNode->get_transpose_b() ? shape.size() - 1ul : shape.size() - 2ul;
+        const size_t outer = shape_size(Shape(shape.begin(), shape.begin() + reduceAxis));
+        const size_t reduceSize = shape[reduceAxis];
+        const size_t inner = shape_size(Shape(shape.begin() + reduceAxis + 1, shape.end()));
+        if (reduceSize == 0ul) {
+            return false;
+        }
+
+        const std::vector<float> values = constant->cast_vector<float>();
+        std::vector<float> scales(outer * inner, 0.f);
+        for (size_t o = 0; o < outer; ++o) {
+            for (size_t k = 0; k < reduceSize; ++k) {
+                for (size_t i = 0; i < inner; ++i) {
+                    float& scale = scales[o * inner + i];
+                    scale = std::max(scale, std::fabs(values[(o * reduceSize + k) * inner + i]));
+                }
+            }
+        }
+        for (auto& scale : scales) {
+            scale = scale == 0.f ? 1.f : scale / 127.f;
+        }
+
+        std::vector<int8_t> quantizedValues(values.size());
+        for (size_t o = 0; o < outer; ++o) {
+            for (size_t k = 0; k < reduceSize; ++k) {
+                for (size_t i = 0; i < inner; ++i) {
+                    const size_t idx = (o * reduceSize + k) * inner + i;
+                    const float quantized = std::nearbyint(values[idx] / scales[o * inner + i]);
+                    quantizedValues[idx] = static_cast<int8_t>(std::max(-127.f, std::min(127.f, quantized)));
+                }
+            }
+        }
+
+        Shape scaleShape = shape;
+        scaleShape[reduceAxis] = 1ul;
+
+        const auto newConstant = std::make_shared<opset1::Constant>(element::i8, shape, quantizedValues);
+        const auto convert = std::make_shared<DequantizationConvert>(newConstant, constant->get_element_type());
+        const auto multiply = std::make_shared<DequantizationMultiply>(
+            convert,
+            std::make_shared<opset1::Constant>(constant->get_element_type(), scaleShape, scales));
+
+        // constant folding would restore the original weights
+        convert->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = std::make_shared<ngraph::VariantWrapper<std::string>>("");
+
+        newConstant->set_friendly_name(constant->get_friendly_name());
+        convert->set_friendly_name(constant->get_friendly_name() + "/DequantizationConvert");
+        multiply->set_friendly_name(constant->get_friendly_name() + "/DequantizationMultiply");
+        ngraph::copy_runtime_info(constant, newConstant);
+
+        matMulNode->input(1).replace_source_output(multiply->output(0));
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matMul, "WeightsOnlyQuantization");
+    this->register_matcher(m, callback);
+}
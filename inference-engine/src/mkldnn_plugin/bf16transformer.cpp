@@ -11,6 +11,7 @@
 #include <chrono>
 #include <legacy/details/ie_cnn_network_tools.h>
 #include <legacy/ie_util_internal.hpp>
+#include <legacy/cnn_network_impl.hpp>
 #include "ngraph/type/bfloat16.hpp"
 
 using namespace MKLDNNPlugin;
@@ -69,10 +70,70 @@ void BF16Transformer::convertToBFloat16(InferenceEngine::CNNNetwork &network) {
             }
         }
     }
+    // keep tensors going to init layers in BF16 and convert them to FP32 only for non supported consumers
+    insertConvertToFloat(network);
     // convert all edges back to FP32 on demand
     optimizeToFloat(network);
 }
 
+void BF16Transformer::insertConvertToFloat(InferenceEngine::CNNNetwork &network) {
+    auto networkImpl = dynamic_cast<CNNNetworkImpl*>(&static_cast<ICNNNetwork&>(network));
+    if (networkImpl == nullptr)
+        return;
+
+    auto isSupported = [&](const CNNLayerPtr& layer) {
+        return _initbf16.find(layer->type) != _initbf16.end()
+               || _complementbf16.find(layer->type) != _complementbf16.end()
+               || _multiinput.find(layer->type) != _multiinput.end();
+    };
+
+    std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(network);
+    OutputsDataMap outputs = network.getOutputsInfo();
+    for (auto iter : sortedLayers) {
+        for (size_t o = 0; o < iter->outData.size(); o++) {
+            DataPtr data = iter->outData[o];
+            if (data->getPrecision() != Precision::BF16 || outputs.find(data->getName()) != outputs.end())
+                continue;
+
+            bool goesToInit = false;
+            std::vector<CNNLayerPtr> fp32Consumers;
+            for (auto consumer : getInputTo(data)) {
+                if (_initbf16.find(consumer.second->type) != _initbf16.end())
+                    goesToInit = true;
+                else if (!isSupported(consumer.second))
+                    fp32Consumers.push_back(consumer.second);
+            }
+            if (!goesToInit || fp32Consumers.empty())
+                continue;
+
+            LayerParams attrs = {data->getName() + "_convert_fp32", "Convert", Precision::FP32};
+            auto convertLayer = std::make_shared<CNNLayer>(attrs);
+            convertLayer->params["precision"] = "FP32";
+
+            DataPtr fp32Data(new Data(convertLayer->name,
+                                      TensorDesc(Precision::FP32, data->getDims(), data->getLayout())));
+            getCreatorLayer(fp32Data) = convertLayer;
+            convertLayer->outData.push_back(fp32Data);
+            convertLayer->insData.push_back(data);
+            getInputTo(data)[convertLayer->name] = convertLayer;
+
+            for (auto consumer : fp32Consumers) {
+                for (auto& consumerInput : consumer->insData) {
+                    if (consumerInput.lock() == data)
+                        consumerInput = fp32Data;
+                }
+                getInputTo(data).erase(consumer->name);
+                getInputTo(fp32Data)[consumer->name] = consumer;
+            }
+
+            networkImpl->addData(fp32Data->getName().c_str(), fp32Data);
+            IE_SUPPRESS_DEPRECATED_START
+            networkImpl->addLayer(convertLayer);
+            IE_SUPPRESS_DEPRECATED_END
+        }
+    }
+}
+
 void BF16Transformer::optimizeToFloat(InferenceEngine::CNNNetwork &network) {
     std::set<DataPtr> toAnalyzeTensors;
     std::set<DataPtr> immutable;
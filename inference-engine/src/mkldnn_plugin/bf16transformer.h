@@ -16,7 +16,8 @@ class BF16Transformer {
         { "convolution", "fullyconnected", "innerproduct", "gemm" };
     const InferenceEngine::details::caseless_set<std::string> _complementbf16 =
         { "relu", "tanh", "elu", "square", "abs", "sqrt", "linear", "bounded_relu", "soft_relu", "logistic",
-          "exp", "gelu", "clamp", "swish", "prelu", "pooling", "norm", "gather", "memory" };
+          "exp", "gelu", "clamp", "swish", "prelu", "pooling", "norm", "gather", "memory", "sigmoid", "relu6",
+          "hswish", "mish", "hsigmoid", "round", "interpolate", "mvn", "convert" };
     const InferenceEngine::details::caseless_set<std::string> _multiinput =
         { "concat", "eltwise" };
     //  prevent fallback to fp32 without considering both input and output nodes
@@ -33,6 +34,13 @@ class BF16Transformer {
     */
     bool tryToMarkFP32(InferenceEngine::DataPtr data, const std::set<InferenceEngine::DataPtr> &immutable);
 
+    /**
+    * Keeps BF16 tensors which go to at least one init layer (conv or fc) in BF16 and moves their consumers
+    * not supporting BF16 behind a single Convert layer producing FP32, so fallback to FP32 is not propagated
+    * to the producers of such tensors
+    */
+    void insertConvertToFloat(InferenceEngine::CNNNetwork &network);
+
 public:
     /**
      * Restores Float point data types on edges which goes to non supported layers
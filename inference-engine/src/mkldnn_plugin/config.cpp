@@ -7,6 +7,8 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
+#include <vector>
 
 #include "ie_plugin_config.hpp"
 #include "ie_common.h"
@@ -21,6 +23,47 @@ namespace MKLDNNPlugin {
 
 using namespace InferenceEngine;
 
+namespace {
+
+// profiles are separated by ';', every profile is a list of `name[d0,d1,...]` separated by spaces
+std::vector<std::map<std::string, std::vector<size_t>>> ParseShapesProfiles(const std::string& value) {
+    auto error = [&] {
+        THROW_IE_EXCEPTION << "Wrong value " << value << " for property key "
+                           << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_PROFILES
+                           << ". Expected profiles separated by ';' like name[d0,d1,...] name2[d0,d1,...]";
+    };
+    std::vector<std::map<std::string, std::vector<size_t>>> profiles;
+    std::stringstream profilesStream(value);
+    std::string profileStr;
+    while (std::getline(profilesStream, profileStr, ';')) {
+        std::map<std::string, std::vector<size_t>> profile;
+        size_t pos = 0;
+        while ((pos = profileStr.find_first_not_of(' ', pos)) != std::string::npos) {
+            auto open = profileStr.find('[', pos);
+            auto close = profileStr.find(']', pos);
+            if (open == std::string::npos || close == std::string::npos || open == pos || close < open)
+                error();
+            std::vector<size_t> dims;
+            std::stringstream dimsStream(profileStr.substr(open + 1, close - open - 1));
+            std::string dim;
+            while (std::getline(dimsStream, dim, ',')) {
+                if (dim.empty() || dim.find_first_not_of("0123456789") != std::string::npos)
+                    error();
+                dims.push_back(std::stoul(dim));
+            }
+            if (!profile.emplace(profileStr.substr(pos, open - pos), dims).second)
+                error();
+            pos = close + 1;
+        }
+        if (profile.empty())
+            error();
+        profiles.push_back(std::move(profile));
+    }
+    return profiles;
+}
+
+}  // namespace
+
 Config::Config() {
 #if (defined(__APPLE__) || defined(_WIN32))
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO) && (TBB_INTERFACE_VERSION >= 11100)
@@ -77,6 +120,107 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HW_PERF_COUNT) {
+            if (val == PluginConfigParams::YES)
+                collectHwPerfCounters = true;
+            else if (val == PluginConfigParams::NO)
+                collectHwPerfCounters = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HW_PERF_COUNT
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD
+                                   << ". Expected only positive integer numbers";
+            }
+            if (val_i <= 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD
+                                   << ". Expected only positive integer numbers";
+            perfCountPeriod = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES) {
+            if (val == PluginConfigParams::YES)
+                enableDynamicShapes = true;
+            else if (val == PluginConfigParams::NO)
+                enableDynamicShapes = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_CAPACITY
+                                   << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_CAPACITY
+                                   << ". Expected only non-negative integer numbers";
+            dynamicShapesCacheCapacity = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_PROFILES) {
+            dynamicShapesProfiles = ParseShapesProfiles(val);
+            dynamicShapesProfilesStr = val;
+        } else if (key == PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD) {
+            float val_f = -1.f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                   << ". Expected only floating point numbers in the [0, 1] range";
+            }
+            if (val_f < 0.f || val_f > 1.f)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD
+                                   << ". Expected only floating point numbers in the [0, 1] range";
+            sparseWeightsThreshold = val_f;
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION) {
+            if (val != PluginConfigParams::NO && val != "FP16" && val != "BF16" && val != "I8")
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION
+                                   << ". Expected only NO/FP16/BF16/I8";
+            weightsCompression = val;
+        } else if (key == PluginConfigParams::KEY_CPU_DEPTH_FIRST_EXECUTION) {
+            if (val == PluginConfigParams::YES)
+                depthFirstExecution = true;
+            else if (val == PluginConfigParams::NO)
+                depthFirstExecution = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DEPTH_FIRST_EXECUTION
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_LAYOUT_PLANNING) {
+            if (val == PluginConfigParams::YES)
+                layoutPlanning = true;
+            else if (val == PluginConfigParams::NO)
+                layoutPlanning = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_LAYOUT_PLANNING
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES)
+                parallelBranches = true;
+            else if (val == PluginConfigParams::NO)
+                parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_STREAMS) {
+            if (val == PluginConfigParams::YES)
+                sharedStreams = true;
+            else if (val == PluginConfigParams::NO)
+                sharedStreams = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_SHARED_STREAMS
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_STREAMS_PRIORITY) {
+            if (val == PluginConfigParams::CPU_PRIORITY_LATENCY)
+                streamsPriority = CPUStreamsExecutor::LATENCY;
+            else if (val == PluginConfigParams::CPU_PRIORITY_BATCH)
+                streamsPriority = CPUStreamsExecutor::BATCH;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_STREAMS_PRIORITY
+                << ". Expected only " << PluginConfigParams::CPU_PRIORITY_LATENCY << "/"
+                << PluginConfigParams::CPU_PRIORITY_BATCH;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -91,6 +235,45 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
             dumpQuantizedGraphToIr = val;
+        } else if (key == PluginConfigParams::KEY_CPU_SHARED_WEIGHTS_DIR) {
+#ifdef _WIN32
+            if (!val.empty())
+                THROW_IE_EXCEPTION << "Property key " << PluginConfigParams::KEY_CPU_SHARED_WEIGHTS_DIR
+                                   << " is not supported on Windows";
+#endif
+            sharedWeightsDir = val;
+        } else if (key == PluginConfigParams::KEY_SHARE_CONSTANTS) {
+            if (val == PluginConfigParams::YES)
+                shareConstants = true;
+            else if (val == PluginConfigParams::NO)
+                shareConstants = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_SHARE_CONSTANTS
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::YES)
+                useHugePages = true;
+            else if (val == PluginConfigParams::NO)
+                useHugePages = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HUGE_PAGES
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_ZERO_COPY_STATES) {
+            if (val == PluginConfigParams::YES)
+                zeroCopyStates = true;
+            else if (val == PluginConfigParams::NO)
+                zeroCopyStates = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_ZERO_COPY_STATES
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_WARM_UP) {
+            if (val == PluginConfigParams::YES)
+                warmUp = true;
+            else if (val == PluginConfigParams::NO)
+                warmUp = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WARM_UP
+                << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_ENFORCE_BF16) {
             if (val == PluginConfigParams::YES) {
                 if (with_cpu_x86_bfloat16())
@@ -125,11 +308,16 @@ void Config::updateProperties() {
             case IStreamsExecutor::ThreadBindingType::NUMA:
                 _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::NUMA });
             break;
+            case IStreamsExecutor::ThreadBindingType::HYBRID_AWARE:
+                _config.insert({ PluginConfigParams::KEY_CPU_BIND_THREAD, PluginConfigParams::HYBRID_AWARE });
+            break;
         }
         if (collectPerfCounters == true)
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_HW_PERF_COUNT,
+                         collectHwPerfCounters ? PluginConfigParams::YES : PluginConfigParams::NO });
         if (exclusiveAsyncRequests == true)
             _config.insert({ PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::YES });
         else
@@ -140,9 +328,42 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES,
+                         enableDynamicShapes ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_PERF_COUNT_PERIOD, std::to_string(perfCountPeriod) });
+        _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_CAPACITY, std::to_string(dynamicShapesCacheCapacity) });
+        _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_PROFILES, dynamicShapesProfilesStr });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
+        _config.insert({ PluginConfigParams::KEY_CPU_WORK_STEALING,
+                         streamExecutorConfig._workStealing ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_REQUEST_STREAM_AFFINITY,
+                         streamExecutorConfig._requestStreamAffinity ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_LATENCY_STREAMS, std::to_string(streamExecutorConfig._latencyStreams) });
+        _config.insert({ PluginConfigParams::KEY_CPU_THREADS_PER_LATENCY_STREAM,
+                         std::to_string(streamExecutorConfig._threadsPerLatencyStream) });
+        _config.insert({ PluginConfigParams::KEY_CPU_MIN_ACTIVE_STREAMS, std::to_string(streamExecutorConfig._minActiveStreams) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_WEIGHTS_DIR, sharedWeightsDir });
+        _config.insert({ PluginConfigParams::KEY_SHARE_CONSTANTS, shareConstants ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_HUGE_PAGES, useHugePages ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_SPARSE_WEIGHTS_THRESHOLD, std::to_string(sparseWeightsThreshold) });
+        _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_COMPRESSION, weightsCompression });
+        _config.insert({ PluginConfigParams::KEY_CPU_DEPTH_FIRST_EXECUTION,
+                         depthFirstExecution ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_LAYOUT_PLANNING,
+                         layoutPlanning ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                         parallelBranches ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_SHARED_STREAMS,
+                         sharedStreams ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_STREAMS_PRIORITY,
+                         streamsPriority == CPUStreamsExecutor::LATENCY ? PluginConfigParams::CPU_PRIORITY_LATENCY
+                                                                        : PluginConfigParams::CPU_PRIORITY_BATCH });
+        _config.insert({ PluginConfigParams::KEY_CPU_ZERO_COPY_STATES,
+                         zeroCopyStates ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ PluginConfigParams::KEY_CPU_WARM_UP,
+                         warmUp ? PluginConfigParams::YES : PluginConfigParams::NO });
         if (!with_cpu_x86_bfloat16())
             enforceBF16 = false;
         if (enforceBF16)
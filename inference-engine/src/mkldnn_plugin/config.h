@@ -6,7 +6,10 @@
 
 #include <string>
 #include <map>
+#include <vector>
+#include <ie_plugin_config.hpp>
 #include <threading/ie_istreams_executor.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 
 namespace MKLDNNPlugin {
 
@@ -19,11 +22,29 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    bool collectHwPerfCounters = false;
+    int perfCountPeriod = 1;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool enableDynamicShapes = false;
+    int dynamicShapesCacheCapacity = 16;
+    std::string dynamicShapesProfilesStr = "";
+    std::vector<std::map<std::string, std::vector<size_t>>> dynamicShapesProfiles;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
+    std::string sharedWeightsDir = "";
+    bool shareConstants = false;
+    bool useHugePages = false;
+    bool zeroCopyStates = false;
+    bool warmUp = false;
+    float sparseWeightsThreshold = 0.f;
+    std::string weightsCompression = InferenceEngine::PluginConfigParams::NO;
+    bool depthFirstExecution = false;
+    bool layoutPlanning = true;
+    bool parallelBranches = false;
+    bool sharedStreams = false;
+    InferenceEngine::CPUStreamsExecutor::Priority streamsPriority = InferenceEngine::CPUStreamsExecutor::BATCH;
     int batchLimit = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
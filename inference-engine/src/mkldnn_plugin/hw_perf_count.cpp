@@ -0,0 +1,138 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hw_perf_count.h"
+
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+
+#ifdef __linux__
+# include <dirent.h>
+# include <unistd.h>
+# include <sys/syscall.h>
+# include <linux/perf_event.h>
+#endif
+
+namespace MKLDNNPlugin {
+
+#ifdef __linux__
+namespace {
+
+constexpr uint64_t eventConfigs[] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+};
+constexpr size_t eventsNum = sizeof(eventConfigs) / sizeof(eventConfigs[0]);
+
+int openEvent(uint64_t config, int tid, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, groupFd, 0));
+}
+
+std::vector<int> listThreads() {
+    std::vector<int> tids;
+    DIR* dir = opendir("/proc/self/task");
+    if (!dir)
+        return tids;
+    while (auto entry = readdir(dir)) {
+        if (entry->d_name[0] != '.')
+            tids.push_back(std::atoi(entry->d_name));
+    }
+    closedir(dir);
+    return tids;
+}
+
+}  // namespace
+
+HwPerfCounters::HwPerfCounters() {
+    // probe events on the current thread to find out whether the kernel allows to open them
+    _available = true;
+    refreshThreads();
+    _available = !_threads.empty();
+}
+
+HwPerfCounters::~HwPerfCounters() {
+    for (auto& thread : _threads) {
+        for (auto fd : thread.fds)
+            close(fd);
+    }
+}
+
+void HwPerfCounters::refreshThreads() {
+    if (!_available)
+        return;
+    auto tids = listThreads();
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto tid : tids) {
+        auto opened = std::find_if(_threads.begin(), _threads.end(),
+                                   [tid](const ThreadEvents& thread) { return thread.tid == tid; });
+        if (opened != _threads.end())
+            continue;
+
+        ThreadEvents thread {tid, -1, {}};
+        for (auto config : eventConfigs) {
+            int fd = openEvent(config, tid, thread.leaderFd);
+            if (fd < 0)
+                break;
+            if (thread.leaderFd < 0)
+                thread.leaderFd = fd;
+            thread.fds.push_back(fd);
+        }
+        if (thread.fds.size() == eventsNum) {
+            _threads.push_back(thread);
+        } else {
+            // the thread has exited or events are not supported, the group is dropped as a whole
+            for (auto fd : thread.fds)
+                close(fd);
+        }
+    }
+}
+
+HwPerfValues HwPerfCounters::sample() {
+    HwPerfValues values;
+    if (!_available)
+        return values;
+    // layout of the PERF_FORMAT_GROUP record: number of events followed by their values
+    uint64_t buffer[1 + eventsNum];
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& thread : _threads) {
+        if (read(thread.leaderFd, buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)) ||
+            buffer[0] != eventsNum)
+            continue;
+        values.cycles += buffer[1];
+        values.instructions += buffer[2];
+        values.llcMisses += buffer[3];
+    }
+    return values;
+}
+
+#else
+
+HwPerfCounters::HwPerfCounters() = default;
+
+HwPerfCounters::~HwPerfCounters() = default;
+
+void HwPerfCounters::refreshThreads() {}
+
+HwPerfValues HwPerfCounters::sample() {
+    return {};
+}
+
+#endif  // __linux__
+
+HwPerfCounters& HwPerfCounters::instance() {
+    static HwPerfCounters counters;
+    return counters;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,64 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Values of hardware events: CPU cycles, retired instructions and last level cache misses.
+ */
+struct HwPerfValues {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llcMisses = 0;
+
+    HwPerfValues& operator+=(const HwPerfValues& rhs) {
+        cycles += rhs.cycles;
+        instructions += rhs.instructions;
+        llcMisses += rhs.llcMisses;
+        return *this;
+    }
+};
+
+/**
+ * Process wide hardware event counters. A group of events is opened with perf_event_open for each thread of the
+ * process, so a sample is a sum over all threads and includes work of concurrently running streams.
+ * Counters are available on Linux only, on other systems or when the kernel does not allow to open hardware events
+ * (see /proc/sys/kernel/perf_event_paranoid) all samples are zeros.
+ */
+class HwPerfCounters {
+public:
+    static HwPerfCounters& instance();
+
+    /**
+     * Opens event groups for threads which were started after the previous call.
+     */
+    void refreshThreads();
+
+    HwPerfValues sample();
+
+    bool available() const { return _available; }
+
+    ~HwPerfCounters();
+
+private:
+    HwPerfCounters();
+
+    struct ThreadEvents {
+        int tid;
+        int leaderFd;
+        std::vector<int> fds;
+    };
+
+    std::mutex _mutex;
+    std::vector<ThreadEvents> _threads;
+    bool _available = false;
+};
+
+}  // namespace MKLDNNPlugin
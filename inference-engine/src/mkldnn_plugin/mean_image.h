@@ -72,6 +72,55 @@ public:
         }
     }
 
+    /**
+     * @brief Converts input to FP32 and subtracts mean in a single pass over the data.
+     * Output is expected to have the same layout as input
+     */
+    template<typename T>
+    void Subtract(const MKLDNNDims &inputDims, const T *input, float *output, InferenceEngine::Layout layout) {
+        IE_ASSERT(input != nullptr && output != nullptr);
+
+        if (inputDims.ndims() != 4) {
+            THROW_IE_EXCEPTION << "Expecting input as 4 dimension blob with format NxCxHxW.";
+        }
+
+        if (layout != InferenceEngine::NCHW && layout != InferenceEngine::NHWC) {
+            THROW_IE_EXCEPTION << "Expecting input layout NCHW or NHWC.";
+        }
+
+        int MB = inputDims[0];
+        int srcSize = inputDims.size() / MB;
+
+        if (meanBuffer && meanBuffer->size()) {
+            const float * meanBufferValues = meanBuffer->readOnly();
+
+            InferenceEngine::parallel_for2d(MB, srcSize, [&](int mb, int i) {
+                output[srcSize * mb + i] = static_cast<float>(input[srcSize * mb + i]) - meanBufferValues[i];
+            });
+        } else if (!meanValues.empty()) {
+            int C = inputDims[1];
+            srcSize /= inputDims[1];
+
+            if (layout == InferenceEngine::NCHW) {
+                InferenceEngine::parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
+                    const int idx = mb * C * srcSize + c * srcSize + i;
+                    output[idx] = static_cast<float>(input[idx]) - meanValues[c];
+                });
+            } else if (layout == InferenceEngine::NHWC) {
+                InferenceEngine::parallel_for2d(MB, srcSize, [&](int mb, int i) {
+                    for (int c = 0; c < C; c++) {
+                        const int idx = mb * srcSize * C + i * C + c;
+                        output[idx] = static_cast<float>(input[idx]) - meanValues[c];
+                    }
+                });
+            }
+        } else {
+            InferenceEngine::parallel_for(inputDims.size(), [&](size_t i) {
+                output[i] = static_cast<float>(input[i]);
+            });
+        }
+    }
+
 private:
     std::vector<float> meanValues;
 
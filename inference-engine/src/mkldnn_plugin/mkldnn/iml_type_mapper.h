@@ -31,6 +31,8 @@ enum impl_desc_type {
     reorder = 1<<19,
     // winograd
     winograd = 1<<20,
+    // advanced matrix extensions
+    amx = 1<<21,
     // real types
     ref_any             = ref  | any,
 
@@ -44,18 +46,21 @@ enum impl_desc_type {
     jit_gemm            = jit | gemm,
 
     jit_avx512_winograd = jit  | avx512 | winograd,
+    jit_avx512_amx      = jit  | avx512 | amx,
     jit_avx512          = jit  | avx512,
     jit_avx2            = jit  | avx2,
     jit_avx             = jit  | avx,
     jit_sse42           = jit  | sse42,
     jit_uni             = jit  | uni,
 
+    jit_avx512_amx_1x1  = jit  | avx512 | amx | _1x1,
     jit_avx512_1x1      = jit  | avx512 | _1x1,
     jit_avx2_1x1        = jit  | avx2   | _1x1,
     jit_avx_1x1         = jit  | avx    | _1x1,
     jit_sse42_1x1       = jit  | sse42  | _1x1,
     jit_uni_1x1         = jit  | uni    | _1x1,
 
+    jit_avx512_amx_dw   = jit  | avx512 | amx | _dw,
     jit_avx512_dw       = jit  | avx512 | _dw,
     jit_avx2_dw         = jit  | avx2   | _dw,
     jit_avx_dw          = jit  | avx    | _dw,
@@ -11,50 +11,91 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialization.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include "bf16transformer.h"
+#include "quantized_tensors.h"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
 #include <threading/ie_executor_manager.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
+#include <ie_load_time_breakdown.hpp>
 #include <threading/ie_thread_affinity.hpp>
 #include <algorithm>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <sstream>
 #include <legacy/details/ie_cnn_network_tools.h>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+std::string GetShapesKey(const ICNNNetwork::InputShapes& inputShapes) {
+    std::stringstream key;
+    for (auto&& shape : inputShapes) {
+        key << shape.first << ":";
+        for (auto&& dim : shape.second) {
+            key << dim << ",";
+        }
+        key << ";";
+    }
+    return key.str();
+}
+
+// passes default priority tasks of an infer request to its home stream
+class HomeStreamExecutor : public ITaskExecutor {
+public:
+    explicit HomeStreamExecutor(const CPUStreamsExecutor::Ptr& executor) :
+        _executor{executor},
+        _streamId{executor->AssignHomeStream()} {
+    }
+
+    void run(Task task) override {
+        _executor->runOnStream(std::move(task), _streamId);
+    }
+
+    void runWithPriority(Task task, const TaskPriority& priority) override {
+        if (priority.isDefault()) {
+            run(std::move(task));
+        } else {
+            _executor->runWithPriority(std::move(task), priority);
+        }
+    }
+
+private:
+    CPUStreamsExecutor::Ptr _executor;
+    int _streamId;
+};
+
+}  // namespace
+
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
     return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
 }
 
-MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
-                                     const Config &cfg,
-                                     const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
-    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
-    extensionManager(extMgr),
-    _cfg{cfg},
-    _name{network.getName()} {
-    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
+InferenceEngine::details::CNNNetworkImplPtr MKLDNNExecNetwork::PrepareNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network) {
+    Config cfg;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        cfg = _cfg;
+    }
 
-    // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNet(network);
+    LoadTimeScope loadTimeScope(LoadTimePhase::Transformations);
 
-    if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+    if (cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         // Check if network is INT8 or Binary.
         // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
         // BF16 + INT8 or BF16 + BIN.
         bool isFloatModel = true;
-        CNNNetworkIterator i(&network);
+        CNNNetworkIterator i(network.get());
         while (i != CNNNetworkIterator()) {
             if (CaselessEq<std::string>()((*i)->type, "FakeQuantize")) {
                 isFloatModel = false;
@@ -65,7 +106,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
         if (with_cpu_x86_bfloat16() && isFloatModel) {
             BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            CNNNetwork cnnetwork(network);
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
             // Overwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
@@ -73,12 +114,14 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                 bf16Transformer.convertToBFloat16(cnnetwork);
         } else {
             BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            CNNNetwork cnnetwork(network);
             bf16Transformer.convertToFloat(cnnetwork);
         }
+
+        if (!isFloatModel)
+            KeepQuantizedTensorsInU8(*network);
     }
 
-    OV_ITT_TASK_NEXT(taskChain, "createConstInputs");
     auto createConstInputTo = [&](CNNLayerPtr layer, Blob::Ptr blob, std::string name) {
         LayerParams attrs = {layer.get()->name + "_const_" + name, "Const", blob->getTensorDesc().getPrecision()};
         auto constLayer = std::make_shared<InferenceEngine::CNNLayer>(attrs);
@@ -96,9 +139,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         getCreatorLayer(newEdgeAfterLayer) = constLayer;
         getInputTo(newEdgeAfterLayer).clear();
 
-        _clonedNetwork->addData(constLayer->name.c_str(), newEdgeAfterLayer);
+        network->addData(constLayer->name.c_str(), newEdgeAfterLayer);
         IE_SUPPRESS_DEPRECATED_START
-        _clonedNetwork->addLayer(constLayer);
+        network->addLayer(constLayer);
         IE_SUPPRESS_DEPRECATED_END
 
         constLayer->outData.push_back(newEdgeAfterLayer);
@@ -106,7 +149,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         layer->insData.push_back(newEdgeAfterLayer);
     };
 
-    auto all_layers = details::CNNNetSortTopologically(*_clonedNetwork);
+    auto all_layers = details::CNNNetSortTopologically(*network);
     for (auto &layer : all_layers) {
         if (layer->type == "ScaleShift" && layer->insData.size() == 1) {
             Blob::Ptr scalesBlob = layer->blobs["weights"];
@@ -134,6 +177,30 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
     }
 
+    return network;
+}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network,
+                                     const Config &cfg,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const NetworkReshaper &reshaper) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
+    extensionManager(extMgr),
+    _cfg{cfg},
+    _name{network->getName()},
+    _numaNodesWeights(numaNodesWeights),
+    _reshaper{reshaper} {
+    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
+
+    // the passed network is kept intact for Export, the copy is prepared for graph creation
+    _exportedNetwork = network;
+    {
+        LoadTimeScope cloningScope(LoadTimePhase::Cloning);
+        _clonedNetwork = cloneNet(static_cast<const ICNNNetwork&>(*network));
+    }
+    _clonedNetwork = PrepareNetwork(_clonedNetwork);
+
     OV_ITT_TASK_SKIP(taskChain);
 
     if (_cfg.batchLimit > 1) {
@@ -149,7 +216,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     } else {
         auto streamsExecutorConfig = InferenceEngine::IStreamsExecutor::Config::MakeDefaultMultiThreaded(_cfg.streamExecutorConfig);
         streamsExecutorConfig._name = "CPUStreamsExecutor";
-        _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        _taskExecutor = _cfg.sharedStreams
+            ? ExecutorManager::getInstance()->getSharedCPUStreamsExecutor(streamsExecutorConfig, _cfg.streamsPriority)
+            : ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
     }
     if (0 != cfg.streamExecutorConfig._streams) {
         _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
@@ -158,27 +227,60 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         _callbackExecutor = _taskExecutor;
     }
 
-    _graphs = decltype(_graphs){[&] {
-        // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
-        //       is fixed and does not change content of network passed (CVS-26420)
-        auto localNetwork = cloneNet(static_cast<ICNNNetwork&>(*_clonedNetwork));
-
-        auto graph = std::make_shared<MKLDNNGraph>();
-        {
-            std::unique_lock<std::mutex> lock{_cfgMutex};
-            graph->setConfig(_cfg);
-        }
-        int numaNode = 0;
-        auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
-        if (nullptr != streamExecutor) {
-            numaNode = streamExecutor->GetNumaNodeId();
+    // graphs of the streams compute the same constant tensors, so they are computed once per NUMA node
+    if (_cfg.streamExecutorConfig._streams != 1) {
+        for (auto numaNode : getAvailableNUMANodes()) {
+            _constants[numaNode] = std::make_shared<MKLDNNConstantsSharing>();
         }
+    }
 
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
+    _graphs = decltype(_graphs){[this] {
+        auto graph = CreateGraph(*_clonedNetwork, true);
+        // only graphs of the loaded shapes are warmed up, graphs of other shapes are created by the first requests
+        if (graph->getProperty().warmUp) {
+            graph->WarmUp();
+        }
         return graph;
     }};
 
-    _taskExecutor->runAndWait({std::thread::hardware_concurrency(), [this] {_graphs.local();}});
+    if (_reshaper) {
+        InputsDataMap inputs;
+        _clonedNetwork->getInputsInfo(inputs);
+        for (auto&& profile : _cfg.dynamicShapesProfiles) {
+            ICNNNetwork::InputShapes inputShapes;
+            for (auto&& input : inputs) {
+                inputShapes[input.first] = input.second->getTensorDesc().getDims();
+            }
+            bool isLoadedShape = true;
+            for (auto&& shape : profile) {
+                auto found = inputShapes.find(shape.first);
+                if (found == inputShapes.end()) {
+                    THROW_IE_EXCEPTION << "Input " << shape.first << " of " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_PROFILES
+                                       << " is not found in the network";
+                }
+                isLoadedShape = isLoadedShape && found->second == shape.second;
+                found->second = shape.second;
+            }
+            if (!isLoadedShape) {
+                _profileGraphs.emplace(GetShapesKey(inputShapes), CreateShapedGraphs(inputShapes));
+            }
+        }
+    }
+
+    // graphs are created by the streams, so their phases are measured by the breakdown of the calling thread
+    auto loadTimeBreakdown = LoadTimeBreakdown::GetActive();
+    Task createGraphs = [this, loadTimeBreakdown] {
+        LoadTimeBreakdownActivation activation{loadTimeBreakdown};
+        _graphs.local();
+        for (auto&& profile : _profileGraphs) {
+            profile.second->graphs.local();
+        }
+    };
+    // the first graph publishes its constant tensors, graphs of other streams are created in parallel and reuse them
+    if (!_constants.empty()) {
+        _taskExecutor->runAndWait({createGraphs});
+    }
+    _taskExecutor->runAndWait(std::vector<Task>(std::thread::hardware_concurrency(), createGraphs));
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -186,8 +288,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     if (_graphs.size() == 1) {
         for (auto &node : _graphs.begin()->get()->GetNodes()) {
             if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
+                auto memoryNode = std::dynamic_pointer_cast<MKLDNNMemoryInputNode>(node);
                 auto state_name = memoryNode->getId();
 
                 // Remove suffix with pair ID. Internal information.
@@ -195,12 +296,96 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, memoryNode, _cfg.zeroCopyStates));
             }
         }
     }
 }
 
+MKLDNNGraph::Ptr MKLDNNExecNetwork::CreateGraph(const InferenceEngine::details::CNNNetworkImpl &network, bool shareConstants) {
+    // TODO: Remove `cloneNet` to `localNetwork` when `MKLDNNGraph::CreateGraph`
+    //       is fixed and does not change content of network passed (CVS-26420)
+    auto localNetwork = cloneNet(static_cast<const ICNNNetwork&>(network));
+
+    auto graph = std::make_shared<MKLDNNGraph>();
+    {
+        std::unique_lock<std::mutex> lock{_cfgMutex};
+        graph->setConfig(_cfg);
+    }
+    if (_reshaper) {
+        auto& workspace = _workspaces.local();
+        if (!workspace) {
+            workspace = std::make_shared<MKLDNNWorkspace>();
+        }
+        graph->setWorkspace(workspace);
+    }
+    int numaNode = 0;
+    auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    if (nullptr != streamExecutor) {
+        numaNode = streamExecutor->GetNumaNodeId();
+    }
+    if (shareConstants) {
+        auto constants = _constants.find(numaNode);
+        if (constants != _constants.end()) {
+            graph->setConstantsSharing(constants->second);
+        }
+    }
+
+    graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, _numaNodesWeights[numaNode]);
+    return graph;
+}
+
+MKLDNNExecNetwork::ShapedGraphs::Ptr MKLDNNExecNetwork::GetShapedGraphs(const ICNNNetwork::InputShapes& inputShapes) {
+    if (!_reshaper) {
+        THROW_IE_EXCEPTION << "Input shapes differ from the loaded network ones, but "
+                           << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES << " is not enabled";
+    }
+    const auto key = GetShapesKey(inputShapes);
+
+    // profiles are not changed after the construction, so they are found without locking
+    auto profile = _profileGraphs.find(key);
+    if (profile != _profileGraphs.end()) {
+        _shapedGraphsHits++;
+        return profile->second;
+    }
+
+    size_t capacity = 0;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        capacity = static_cast<size_t>(_cfg.dynamicShapesCacheCapacity);
+    }
+
+    // reshaping is serialized, while graphs themselves are compiled lazily by the streams which use them
+    std::lock_guard<std::mutex> lock{_shapedGraphsMutex};
+    auto found = std::find_if(_shapedGraphs.begin(), _shapedGraphs.end(),
+                              [&](const std::pair<std::string, ShapedGraphs::Ptr>& item) { return item.first == key; });
+    if (found != _shapedGraphs.end()) {
+        _shapedGraphs.splice(_shapedGraphs.begin(), _shapedGraphs, found);
+        _shapedGraphsHits++;
+        return found->second;
+    }
+    _shapedGraphsMisses++;
+
+    auto shapedGraphs = CreateShapedGraphs(inputShapes);
+    _shapedGraphs.emplace_front(key, shapedGraphs);
+    // graphs of evicted shapes are released when the last infer request which uses them switches to other shapes
+    while (_shapedGraphs.size() > capacity) {
+        _shapedGraphs.pop_back();
+    }
+    return shapedGraphs;
+}
+
+MKLDNNExecNetwork::ShapedGraphs::Ptr MKLDNNExecNetwork::CreateShapedGraphs(const ICNNNetwork::InputShapes& inputShapes) {
+    auto transformedNetwork = _reshaper(inputShapes);
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(transformedNetwork);
+    IE_ASSERT(implNetwork != nullptr);
+    // the reshaped network is private, so it is prepared without a copy
+    std::shared_ptr<const details::CNNNetworkImpl> preparedNetwork = PrepareNetwork(implNetwork);
+    return std::make_shared<ShapedGraphs>([this, preparedNetwork] {
+        return CreateGraph(*preparedNetwork);
+    });
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -212,7 +397,22 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
 }
 
 InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+    auto streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor);
+    if (!_cfg.streamExecutorConfig._requestStreamAffinity || !streamsExecutor)
+        return CreateAsyncInferRequestFromSync<MKLDNNAsyncInferRequest>();
+
+    // the request is executed by its home stream, so it works with the same graph and cores from call to call
+    IInferRequest::Ptr asyncRequest;
+    auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+
+    auto asyncThreadSafeImpl = std::make_shared<MKLDNNAsyncInferRequest>(
+        syncRequestImpl, std::make_shared<HomeStreamExecutor>(streamsExecutor), _callbackExecutor);
+    asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncThreadSafeImpl),
+                       [](IInferRequest *p) { p->Release(); });
+    asyncThreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+    asyncThreadSafeImpl->SetRequestsStatistics(_requestsStatistics);
+    return asyncRequest;
 }
 
 InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
@@ -222,6 +422,18 @@ InferenceEngine::CNNNetwork MKLDNNExecNetwork::GetExecGraphInfo() {
     return _graphs.begin()->get()->dump();
 }
 
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+    CNNNetworkSerializer serializer(networkModel);
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        serializer << _cfg._config;
+    }
+    serializer << static_cast<const ICNNNetwork&>(*_exportedNetwork);
+    serializer << _networkInputs;
+    serializer << _networkOutputs;
+}
+
 Parameter MKLDNNExecNetwork::GetConfig(const std::string &name) const {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -246,6 +458,14 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(LOAD_TIME_BREAKDOWN));
+        for (auto&& runtimeMetric : GetRuntimeMetricNames()) {
+            metrics.push_back(runtimeMetric);
+        }
+        if (_reshaper) {
+            metrics.push_back(METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_HITS));
+            metrics.push_back(METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_MISSES));
+        }
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -260,8 +480,18 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(LOAD_TIME_BREAKDOWN)) {
+        IE_SET_METRIC_RETURN(LOAD_TIME_BREAKDOWN, GetLoadTimeBreakdown());
+    } else if (_reshaper && name == METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(CPU_DYNAMIC_SHAPES_CACHE_HITS, _shapedGraphsHits.load());
+    } else if (_reshaper && name == METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(CPU_DYNAMIC_SHAPES_CACHE_MISSES, _shapedGraphsMisses.load());
     } else {
-        THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
+        Parameter runtimeMetric;
+        if (!GetRuntimeMetric(name, runtimeMetric)) {
+            THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
+        }
+        return runtimeMetric;
     }
 }
 
@@ -10,12 +10,16 @@
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
 
+#include <functional>
+#include <list>
 #include <vector>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <string>
 #include <legacy/cnn_network_impl.hpp>
 #include <unordered_map>
+#include <utility>
 
 namespace MKLDNNPlugin {
 
@@ -23,14 +27,32 @@ class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefa
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
 
+    /**
+     * @brief Produces the transformed network for the given input shapes, set when dynamic shapes are enabled
+     */
+    using NetworkReshaper = std::function<std::shared_ptr<InferenceEngine::ICNNNetwork>(const InferenceEngine::ICNNNetwork::InputShapes&)>;
+
+    /**
+     * @brief Graphs compiled for one set of input shapes, one graph per stream as for the loaded shapes
+     */
+    struct ShapedGraphs {
+        using Ptr = std::shared_ptr<ShapedGraphs>;
+        explicit ShapedGraphs(const InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>::Create& create) : graphs{create} {}
+        InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr> graphs;
+    };
+
     InferenceEngine::InferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
               InferenceEngine::OutputsDataMap networkOutputs) override;
 
     InferenceEngine::IInferRequest::Ptr CreateInferRequest() override;
 
-    MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+    /**
+     * @param network Legacy network which is kept by the executable network, it must not be modified after the call
+     */
+    MKLDNNExecNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network, const Config &cfg,
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const NetworkReshaper &reshaper = {});
 
     ~MKLDNNExecNetwork() override = default;
 
@@ -42,20 +64,50 @@ public:
 
     InferenceEngine::CNNNetwork GetExecGraphInfo() override;
 
+    void ExportImpl(std::ostream& networkModel) override;
+
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
+    /**
+     * @brief Returns graphs compiled for the input shapes, the network is reshaped and compiled on the first call
+     * @param inputShapes Input shapes that differ from the loaded ones
+     */
+    ShapedGraphs::Ptr GetShapedGraphs(const InferenceEngine::ICNNNetwork::InputShapes& inputShapes);
+
 protected:
     friend class MKLDNNInferRequest;
+    // modifies the passed network, so it is applied to a private copy
+    InferenceEngine::details::CNNNetworkImplPtr PrepareNetwork(const InferenceEngine::details::CNNNetworkImplPtr &network);
+    // graphs of the loaded shapes share constant tensors with each other, if shareConstants is set
+    MKLDNNGraph::Ptr CreateGraph(const InferenceEngine::details::CNNNetworkImpl &network, bool shareConstants = false);
+    // reshapes and prepares the network, graphs are compiled by the streams which use them
+    ShapedGraphs::Ptr CreateShapedGraphs(const InferenceEngine::ICNNNetwork::InputShapes& inputShapes);
+
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     InferenceEngine::details::CNNNetworkImplPtr _clonedNetwork;
+    // network as it was passed to the plugin, _clonedNetwork is modified during graph creation
+    InferenceEngine::details::CNNNetworkImplPtr _exportedNetwork;
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    NumaNodesWeights&                           _numaNodesWeights;
+    NetworkReshaper                             _reshaper;
+    std::mutex                                  _shapedGraphsMutex;
+    // most recently used shapes first
+    std::list<std::pair<std::string, ShapedGraphs::Ptr>> _shapedGraphs;
+    // graphs of KEY_CPU_DYNAMIC_SHAPES_PROFILES compiled by the constructor, not changed afterwards
+    std::unordered_map<std::string, ShapedGraphs::Ptr> _profileGraphs;
+    std::atomic<unsigned int>                   _shapedGraphsHits = {0};
+    std::atomic<unsigned int>                   _shapedGraphsMisses = {0};
+    // a stream executes one graph at a time, so graphs of all shapes used by the stream share intermediate memory
+    InferenceEngine::ThreadLocal<MKLDNNWorkspace::Ptr> _workspaces;
+    // constant tensors of the loaded shapes graphs per NUMA node, empty if there is only one stream
+    std::map<int, MKLDNNConstantsSharing::Ptr>  _constants;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
@@ -3,8 +3,10 @@
 //
 
 #include <algorithm>
+#include <cstring>
 #include <string>
 #include <map>
+#include <set>
 #include <vector>
 #include <unordered_set>
 #include <limits>
@@ -18,10 +20,14 @@
 #include "mkldnn_graph_optimizer.h"
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
-#include "mkldnn_memory_solver.hpp"
+#include <memory_solver.hpp>
 #include "mkldnn_itt.h"
 #include <nodes/mkldnn_input_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
+#include <nodes/mkldnn_fullyconnected_node.h>
 #include <nodes/mkldnn_reorder_node.h>
+#include <nodes/common/cpu_yuv_convert.h>
+#include <ie_compound_blob.h>
 
 #include <legacy/graph_tools.hpp>
 #include <ie_algorithm.hpp>
@@ -33,6 +39,11 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_trace.hpp>
+#include <ie_load_time_breakdown.hpp>
+#include <ie_huge_page_allocator.hpp>
+#include <ie_system_conf.h>
+#include <threading/ie_cpu_streams_executor.hpp>
 
 #include "utils/blob_dump.h"
 
@@ -90,11 +101,16 @@ template<typename NET>
 void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr& extMgr,
         MKLDNNWeightsSharing::Ptr &w_cache) {
     OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "CreateGraph");
+    LoadTimeScope loadTimeScope(LoadTimePhase::GraphInit);
 
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable caching if graph was created only once and weights are not shared with other processes
+    // or with other networks of the Core (SHARE_CONSTANTS)
+    weightsCache = (config.streamExecutorConfig._streams != 1 || !config.sharedWeightsDir.empty() || config.shareConstants)
+                   ? w_cache : nullptr;
+    hwPerfCounters = config.collectHwPerfCounters ? &HwPerfCounters::instance() : nullptr;
+    memoryAllocator = config.useHugePages ? CreateHugePageAllocator() : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -340,6 +356,9 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    if (config.layoutPlanning)
+        PlanLayouts();
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -347,9 +366,41 @@ void MKLDNNGraph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
-    Allocate();
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // hardware events are counted per thread and can't be attributed to concurrent nodes
+    if (config.parallelBranches && !config.collectHwPerfCounters)
+        InitParallelLevels();
+#endif
+
+    auto weightsCompression = MKLDNNFullyConnectedNode::WeightsCompression::None;
+    if (config.weightsCompression == "FP16")
+        weightsCompression = MKLDNNFullyConnectedNode::WeightsCompression::FP16;
+    else if (config.weightsCompression == "BF16")
+        weightsCompression = MKLDNNFullyConnectedNode::WeightsCompression::BF16;
+    else if (config.weightsCompression == "I8")
+        weightsCompression = MKLDNNFullyConnectedNode::WeightsCompression::I8;
+    for (auto &graphNode : graphNodes) {
+        graphNode->weightsAllocator = memoryAllocator;
+        if (auto fullyConnected = dynamic_cast<MKLDNNFullyConnectedNode*>(graphNode.get())) {
+            fullyConnected->setSparseWeightsThreshold(config.sparseWeightsThreshold);
+            fullyConnected->setWeightsCompression(weightsCompression);
+        }
+    }
+
+    {
+        LoadTimeScope loadTimeScope(LoadTimePhase::MemoryAllocation);
+        Allocate();
+    }
+
+    {
+        LoadTimeScope loadTimeScope(LoadTimePhase::KernelCompilation);
+        CreatePrimitives();
+    }
+
+    if (config.depthFirstExecution && parallelLevels.empty())
+        InitDepthFirstSections();
 
-    CreatePrimitives();
+    InitExecutionPlan();
 
     SetOriginalLayerNames();
 
@@ -380,6 +431,8 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
+    // constant subgraphs reorder weights to the layouts of the selected implementations
+    LoadTimeScope loadTimeScope(LoadTimePhase::WeightsRepacking);
     ExecuteConstantNodesOnly();
 }
 
@@ -442,6 +495,158 @@ void MKLDNNGraph::InitDescriptors() {
     }
 }
 
+namespace {
+
+// Nodes which select their descriptors by their own rules, e.g. to be done in place, keep the selected ones
+bool isLayoutPlanned(const MKLDNNNodePtr& node) {
+    switch (node->getType()) {
+        case Input:
+        case Output:
+        case Split:
+        case Concatenation:
+        case Eltwise:
+        case MemoryInput:
+        case MemoryOutput:
+        case TensorIterator:
+            return false;
+        default:
+            return node->getSupportedPrimitiveDescriptors().size() > 1 && node->getSelectedPrimitiveDescriptor();
+    }
+}
+
+// A reorder reads and writes the tensor once, so its cost is estimated by the number of the tensor elements
+double reorderCost(const MKLDNNEdgePtr& edge, int parentDesc, int childDesc) {
+    // constant tensors are reordered once at load time
+    if (edge->getParent()->isConstant())
+        return 0.;
+
+    const auto& parentConfig = edge->getParent()->getSupportedPrimitiveDescriptors()[parentDesc].getConfig();
+    const auto& childConfig = edge->getChild()->getSupportedPrimitiveDescriptors()[childDesc].getConfig();
+    int outPort = edge->getInputNum();
+    int inPort = edge->getOutputNum();
+    if (outPort < 0 || outPort >= static_cast<int>(parentConfig.outConfs.size()))
+        outPort = 0;
+    if (parentConfig.outConfs.empty() || inPort < 0 || inPort >= static_cast<int>(childConfig.inConfs.size()))
+        return 0.;
+    if (MKLDNNExtensionUtils::initTensorsAreEqual(parentConfig.outConfs[outPort].desc, childConfig.inConfs[inPort].desc))
+        return 0.;
+    return static_cast<double>(edge->getDims().size());
+}
+
+}  // namespace
+
+void MKLDNNGraph::PlanLayouts() {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::PlanLayouts");
+
+    // Nodes select their descriptors one by one looking at the parents only, so a reorder is inserted each time
+    // neighbours prefer different layouts. Here the layouts are assigned for the whole graph to minimize the cost
+    // of the reorders. A node keeps the implementation type it has selected, only the descriptors of the same type
+    // are candidates, and a layout other than the selected one costs half of a reorder of the node output,
+    // so layouts change only if reorders are removed.
+    struct NodePlan {
+        std::vector<int> candidates;
+        std::vector<double> cost;
+        int selected = -1;
+    };
+    std::unordered_map<MKLDNNNode*, NodePlan> plans;
+    auto nodeCost = [](const MKLDNNNodePtr& node, int desc) {
+        if (desc == node->selectedPrimitiveDescriptorIndex || node->getChildEdges().empty())
+            return 0.;
+        return 0.5 * static_cast<double>(node->getChildEdgeAt(0)->getDims().size());
+    };
+
+    for (auto& node : graphNodes) {
+        auto& plan = plans[node.get()];
+        plan.selected = node->selectedPrimitiveDescriptorIndex;
+        if (plan.selected < 0)
+            return;
+        if (isLayoutPlanned(node)) {
+            const auto& descs = node->getSupportedPrimitiveDescriptors();
+            const auto type = descs[plan.selected].getImplementationType();
+            for (size_t i = 0; i < descs.size(); i++) {
+                if (descs[i].getImplementationType() == type)
+                    plan.candidates.push_back(static_cast<int>(i));
+            }
+        } else {
+            plan.candidates.push_back(plan.selected);
+        }
+    }
+
+    // Forward pass of the dynamic programming: the cost of a candidate is the cheapest cost of the subgraph
+    // above the node. Parents with several consumers share their cost between them, which is exact for chains
+    // and trees and an estimation for other graphs.
+    for (auto& node : graphNodes) {
+        auto& plan = plans[node.get()];
+        plan.cost.assign(plan.candidates.size(), 0.);
+        for (size_t i = 0; i < plan.candidates.size(); i++) {
+            plan.cost[i] = nodeCost(node, plan.candidates[i]);
+            for (size_t e = 0; e < node->getParentEdges().size(); e++) {
+                auto edge = node->getParentEdgeAt(e);
+                const auto& parentPlan = plans[edge->getParent().get()];
+                const double share = 1. / std::max<size_t>(edge->getParent()->getChildEdges().size(), 1);
+                double best = std::numeric_limits<double>::max();
+                for (size_t j = 0; j < parentPlan.candidates.size(); j++) {
+                    best = std::min(best, share * parentPlan.cost[j] +
+                                          reorderCost(edge, parentPlan.candidates[j], plan.candidates[i]));
+                }
+                plan.cost[i] += best;
+            }
+        }
+    }
+
+    // Backward pass: a node takes the candidate which is the cheapest with the layouts chosen for its consumers
+    for (auto it = graphNodes.rbegin(); it != graphNodes.rend(); ++it) {
+        const auto& node = *it;
+        auto& plan = plans[node.get()];
+        double best = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < plan.candidates.size(); i++) {
+            double cost = plan.cost[i];
+            for (size_t e = 0; e < node->getChildEdges().size(); e++) {
+                auto edge = node->getChildEdgeAt(e);
+                cost += reorderCost(edge, plan.candidates[i], plans[edge->getChild().get()].selected);
+            }
+            if (cost < best || (cost == best && plan.candidates[i] == node->selectedPrimitiveDescriptorIndex)) {
+                best = cost;
+                plan.selected = plan.candidates[i];
+            }
+        }
+    }
+
+    // The shared parents make the assignment approximate, so it is refined node by node with the exact local cost
+    const int maxRefinements = 3;
+    for (int refinement = 0; refinement < maxRefinements; refinement++) {
+        bool changed = false;
+        for (auto& node : graphNodes) {
+            auto& plan = plans[node.get()];
+            int selected = plan.selected;
+            double best = std::numeric_limits<double>::max();
+            for (auto candidate : plan.candidates) {
+                double cost = nodeCost(node, candidate);
+                for (size_t e = 0; e < node->getParentEdges().size(); e++) {
+                    auto edge = node->getParentEdgeAt(e);
+                    cost += reorderCost(edge, plans[edge->getParent().get()].selected, candidate);
+                }
+                for (size_t e = 0; e < node->getChildEdges().size(); e++) {
+                    auto edge = node->getChildEdgeAt(e);
+                    cost += reorderCost(edge, candidate, plans[edge->getChild().get()].selected);
+                }
+                // the current choice is kept on ties, so the refinement converges
+                if (cost < best || (cost == best && candidate == plan.selected)) {
+                    best = cost;
+                    selected = candidate;
+                }
+            }
+            changed |= selected != plan.selected;
+            plan.selected = selected;
+        }
+        if (!changed)
+            break;
+    }
+
+    for (auto& node : graphNodes)
+        node->selectPrimitiveDescriptorByIndex(plans[node.get()].selected);
+}
+
 void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::InitOptimalPrimitiveDescriptors");
     for (auto &node : graphNodes) {
@@ -453,11 +658,32 @@ void MKLDNNGraph::InitOptimalPrimitiveDescriptors() {
 void MKLDNNGraph::ExecuteConstantNodesOnly() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (auto &graphNode : graphNodes) {
-        if (!graphNode->isConstant())
-            continue;
+    for (auto &graphNode : constNodesToExecute) {
         graphNode->execute(stream);
+        // constant nodes are not a part of the execution plan, so their blobs are dumped here
+        ENABLE_DUMP(do_after(DUMP_DIR, graphNode));
     }
+
+    // computed tensors become available to graphs created later
+    if (constantsSharing) {
+        for (auto &constMemory : constMemories) {
+            if (!constMemory.first.empty())
+                constantsSharing->Publish(constMemory.first, constMemory.second);
+        }
+    }
+}
+
+MKLDNNMemoryPtr MKLDNNConstantsSharing::Find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = memories.find(key);
+    return found == memories.end() ? nullptr : found->second.lock();
+}
+
+void MKLDNNConstantsSharing::Publish(const std::string& key, const MKLDNNMemoryPtr& memory) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto& published = memories[key];
+    if (published.expired())
+        published = memory;
 }
 
 void MKLDNNGraph::InitEdges() {
@@ -567,9 +793,13 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
     //======= End of WA ============
 
-    const int64_t alignment = 32;  // 32 bytes
+    const int64_t alignment = 64;  // cache line size in bytes
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
+    // clusters which keep their values between inferences can't be placed to the shared workspace
+    std::vector<bool> persistent(edge_clasters.size(), false);
+    // constant clusters which are allocated separately to be shared with other graphs
+    std::vector<bool> shareable(edge_clasters.size(), false);
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
@@ -608,6 +838,9 @@ void MKLDNNGraph::AllocateWithReuse() {
             isOutput |= edge->getChild()->getType() == Output;
             isInput  |= edge->getParent()->getType() == Input;
         }
+        persistent[i] = isConst;
+        // network inputs and outputs are exposed to users, so they are never shared
+        shareable[i] = constantsSharing && isConst && !isInput && !isOutput;
 
         if (reuse_io_tensors) {
             if (isInput | isConst) box.start = 0;
@@ -622,21 +855,118 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    // Graphs are created by threads of their streams, so on NUMA hosts the workspace is touched here
+    // by the stream threads to place its pages on the stream NUMA node. Otherwise pages land on the node
+    // of the thread which writes them first, e.g. a thread of another stream during the first inference.
+    auto firstTouch = [](int8_t* workspace_ptr, size_t total_size) {
+        if (getAvailableNUMANodes().size() > 1) {
+            constexpr size_t pageSize = 4096;
+            const size_t pagesNum = div_up(total_size, pageSize);
+            parallel_for(pagesNum, [&](size_t page) {
+                const size_t begin = page * pageSize;
+                std::memset(workspace_ptr + begin, 0, std::min(pageSize, total_size - begin));
+            });
+        }
+    };
+
+    // Without a shared workspace all clusters are placed to the memory of the graph
+    std::vector<MemorySolver::Box> ownBoxes, sharedBoxes;
+    for (int i = 0; i < boxes.size(); i++) {
+        if (shareable[i])
+            continue;
+        (sharedWorkspace && !persistent[i] ? sharedBoxes : ownBoxes).push_back(boxes[i]);
+    }
+
+    MemorySolver ownSolver(ownBoxes);
+    size_t total_size = ownBoxes.empty() ? 0 : static_cast<size_t>(ownSolver.solve(MemorySolver::Strategy::BestOf)) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
+    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)), memoryAllocator);
     auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    firstTouch(workspace_ptr, total_size);
+
+    MemorySolver sharedSolver(sharedBoxes);
+    int8_t* shared_workspace_ptr = nullptr;
+    if (!sharedBoxes.empty()) {
+        size_t shared_size = static_cast<size_t>(sharedSolver.solve(MemorySolver::Strategy::BestOf)) * alignment;
+        bool created = false;
+        memSharedWorkspace = sharedWorkspace->Get(eng, shared_size, memoryAllocator, created);
+        shared_workspace_ptr = static_cast<int8_t*>(memSharedWorkspace->GetData());
+        if (created) {
+            firstTouch(shared_workspace_ptr, shared_size);
+        }
+    }
+
+    // Constant clusters computed by other graphs already are taken from them
+    std::vector<std::string> constKeys(edge_clasters.size());
+    std::vector<MKLDNNMemoryPtr> constMemory(edge_clasters.size());
+    std::unordered_set<MKLDNNEdge*> takenEdges;
+    for (int i = 0; i < edge_clasters.size(); i++) {
+        if (!shareable[i])
+            continue;
+        for (auto &edge : edge_clasters[i]) {
+            if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
+                constKeys[i] = edge->getParent()->getName() + ":" + std::to_string(edge->getInputNum()) + "->" +
+                               edge->getChild()->getName() + ":" + std::to_string(edge->getOutputNum()) + "/" +
+                               std::to_string(boxes[i].size * alignment);
+            }
+        }
+        constMemory[i] = constantsSharing->Find(constKeys[i]);
+        if (constMemory[i]) {
+            for (auto &edge : edge_clasters[i])
+                takenEdges.insert(edge.get());
+        }
+    }
+
+    // A constant node is skipped only if all tensors it computes are taken or used by skipped constant nodes
+    std::unordered_set<MKLDNNNode*> executedConstNodes;
+    constNodesToExecute.clear();
+    for (auto node = graphNodes.rbegin(); node != graphNodes.rend(); ++node) {
+        if (!(*node)->isConstant())
+            continue;
+        bool isExecuted = (*node)->getChildEdges().empty();
+        for (size_t j = 0; j < (*node)->getChildEdges().size() && !isExecuted; j++) {
+            auto edge = (*node)->getChildEdgeAt(j);
+            auto child = edge->getChild();
+            isExecuted = child->isConstant() ? executedConstNodes.count(child.get()) != 0
+                                             : takenEdges.count(edge.get()) == 0;
+        }
+        if (isExecuted) {
+            executedConstNodes.insert(node->get());
+            constNodesToExecute.push_back(*node);
+        }
+    }
+    std::reverse(constNodesToExecute.begin(), constNodesToExecute.end());
+
+    constMemories.clear();
+    for (int i = 0; i < edge_clasters.size(); i++) {
+        if (!shareable[i])
+            continue;
+        // taken memory is read concurrently by the other graphs, so it is never written again
+        bool isWritten = false;
+        for (auto &edge : edge_clasters[i])
+            isWritten |= executedConstNodes.count(edge->getParent().get()) != 0;
+        if (!constMemory[i] || isWritten) {
+            constMemory[i] = std::make_shared<MKLDNNMemory>(eng);
+            constMemory[i]->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {static_cast<size_t>(boxes[i].size * alignment)},
+                                                               Layout::C)), memoryAllocator);
+            constMemories.emplace_back(constKeys[i], constMemory[i]);
+        } else {
+            constMemories.emplace_back(std::string(), constMemory[i]);
+        }
+    }
 
     for (int i = 0; i < edge_clasters.size(); i++) {
+        const bool isShared = sharedWorkspace && !persistent[i];
+        int8_t* base_ptr = shareable[i] ? static_cast<int8_t*>(constMemory[i]->GetData())
+                                        : isShared ? shared_workspace_ptr : workspace_ptr;
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
             if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
-                int64_t offset = memSolver.getOffset(i);
+                int64_t offset = shareable[i] ? 0 : isShared ? sharedSolver.getOffset(i) : ownSolver.getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
-                edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                edge->allocate(base_ptr + offset * alignment);  // alignment in byte
 
                 // TODO: WA for some test (like strided_slice_test) which use tensors with
                 //       shapes {0}. And it is implisitly converted into {1} tensor.
@@ -651,6 +981,18 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+MKLDNNMemoryPtr MKLDNNWorkspace::Get(const mkldnn::engine& eng, size_t size, const std::shared_ptr<IAllocator>& allocator,
+                                     bool& created) {
+    created = false;
+    if (!memory || memorySize < size) {
+        memory = std::make_shared<MKLDNNMemory>(eng);
+        memory->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {size}, Layout::C)), allocator);
+        memorySize = size;
+        created = true;
+    }
+    return memory;
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -667,6 +1009,10 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    for (auto& node : outputNodes) {
+        defaultOutputPtrs[node->getName().substr(4)] = node->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle();
+    }
 }
 
 void MKLDNNGraph::CreatePrimitives() {
@@ -677,6 +1023,220 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
+void MKLDNNGraph::InitParallelLevels() {
+    parallelLevels.clear();
+
+    std::unordered_map<MKLDNNNode*, int> levels;
+    int maxLevel = 0;
+    for (auto& node : graphNodes) {
+        int level = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            level = std::max(level, levels[node->getParentEdgeAt(i)->getParent().get()] + 1);
+        levels[node.get()] = level;
+        maxLevel = std::max(maxLevel, level);
+    }
+    // a memory output overwrites the state which is read by other nodes, so it is executed after all of them
+    for (auto& node : graphNodes) {
+        if (node->getType() == MemoryOutput)
+            levels[node.get()] = maxLevel + 1;
+    }
+
+    std::vector<std::vector<MKLDNNNodePtr>> nodesByLevel(maxLevel + 2);
+    for (auto& node : graphNodes) {
+        if (!node->isConstant())
+            nodesByLevel[levels[node.get()]].push_back(node);
+    }
+    bool hasBranches = false;
+    for (const auto& level : nodesByLevel)
+        hasBranches |= level.size() > 1;
+    if (!hasBranches)
+        return;
+
+    // the order of levels is topological, the execution index of a node is its level, so the memory of tensors
+    // which are used by concurrent nodes is not reused
+    std::stable_sort(graphNodes.begin(), graphNodes.end(), [&](const MKLDNNNodePtr& lhs, const MKLDNNNodePtr& rhs) {
+        return levels[lhs.get()] < levels[rhs.get()];
+    });
+    for (auto& node : graphNodes)
+        node->execIndex = levels[node.get()];
+
+    for (auto& level : nodesByLevel) {
+        if (!level.empty())
+            parallelLevels.push_back(std::move(level));
+    }
+}
+
+void MKLDNNGraph::InitDepthFirstSections() {
+    depthFirstSections.clear();
+
+    // the nodes compute every batch item independently and can be executed for a part of the batch
+    auto isTileable = [](const MKLDNNNodePtr& node) {
+        auto type = node->getType();
+        if ((type != Convolution && type != Pooling && type != Eltwise && type != Reorder) || node->isConstant())
+            return false;
+        auto selectedPD = node->getSelectedPrimitiveDescriptor();
+        return selectedPD != nullptr && selectedPD->getConfig().dynBatchSupport;
+    };
+    auto getDesc = [](const MKLDNNEdgePtr& edge) -> InferenceEngine::TensorDesc {
+        return MKLDNNMemoryDesc(edge->getMemory().GetDescriptor());
+    };
+    // the batch is the outermost dimension of the edge memory, so a tile is a contiguous part of it
+    auto isBatchOutermost = [&](const MKLDNNEdgePtr& edge, size_t batch) {
+        auto desc = getDesc(edge);
+        const auto& order = desc.getBlockingDesc().getOrder();
+        return desc.getDims().size() > 2 && desc.getDims()[0] == batch && !order.empty() && order[0] == 0;
+    };
+    auto getBatch = [](const MKLDNNEdgePtr& edge) -> size_t {
+        return edge->getDims().ndims() > 0 ? static_cast<size_t>(edge->getDims()[0]) : 1;
+    };
+    auto canJoin = [&](const MKLDNNNodePtr& node, size_t batch) {
+        if (batch < 2 || !isTileable(node))
+            return false;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            if (!isBatchOutermost(node->getChildEdgeAt(i), batch))
+                return false;
+        }
+        // inputs without the batch dimension are broadcasted to all batch items
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            if (getBatch(edge) != 1 && !isBatchOutermost(edge, batch))
+                return false;
+        }
+        return true;
+    };
+
+    const size_t cacheSize = static_cast<size_t>(mkldnn_get_cache_size(2, false));
+    for (size_t begin = 0; begin < graphNodes.size();) {
+        const size_t batch = graphNodes[begin]->getChildEdges().empty() ? 0 : getBatch(graphNodes[begin]->getChildEdgeAt(0));
+        size_t end = begin;
+        while (end < graphNodes.size() && canJoin(graphNodes[end], batch))
+            end++;
+        if (end - begin < 2) {
+            begin = std::max(end, begin + 1);
+            continue;
+        }
+
+        DepthFirstSection section;
+        section.begin = begin;
+        section.end = end;
+        section.batch = batch;
+
+        std::unordered_set<MKLDNNNode*> sectionNodes;
+        for (size_t i = begin; i < end; i++)
+            sectionNodes.insert(graphNodes[i].get());
+
+        // memory of an output is used only inside the section if all its consumers are in the section
+        // and neither the producer nor the consumers share it with other tensors
+        auto isLocal = [&](const MKLDNNEdgePtr& edge) {
+            auto parent = edge->getParent();
+            auto port = edge->getInputNum();
+            if (!sectionNodes.count(parent.get()) ||
+                    parent->getSelectedPrimitiveDescriptor()->getConfig().outConfs[port].inPlace >= 0)
+                return false;
+            for (const auto& consumer : parent->getChildEdgesAtPort(port)) {
+                auto child = consumer->getChild();
+                if (!sectionNodes.count(child.get()))
+                    return false;
+                auto childConfig = child->getSelectedPrimitiveDescriptor()->getConfig();
+                if (childConfig.inConfs[consumer->getOutputNum()].inPlace >= 0)
+                    return false;
+                for (const auto& outConf : childConfig.outConfs) {
+                    if (outConf.inPlace == consumer->getOutputNum())
+                        return false;
+                }
+            }
+            return true;
+        };
+
+        size_t itemSize = 0;
+        std::unordered_set<MKLDNNEdge*> visited;
+        std::set<std::pair<MKLDNNNode*, int>> tensors;
+        for (size_t i = begin; i < end; i++) {
+            std::vector<MKLDNNEdgePtr> nodeEdges;
+            for (size_t j = 0; j < graphNodes[i]->getParentEdges().size(); j++)
+                nodeEdges.push_back(graphNodes[i]->getParentEdgeAt(j));
+            for (size_t j = 0; j < graphNodes[i]->getChildEdges().size(); j++)
+                nodeEdges.push_back(graphNodes[i]->getChildEdgeAt(j));
+
+            for (const auto& edge : nodeEdges) {
+                if (!visited.insert(edge.get()).second || getBatch(edge) != batch)
+                    continue;
+                auto desc = getDesc(edge);
+                const size_t step = desc.getBlockingDesc().getStrides()[0] * desc.getPrecision().size();
+                section.edges.push_back(edge);
+                section.batchSteps.push_back(isLocal(edge) ? 0 : step);
+                // edges of one output share its memory
+                if (tensors.insert({edge->getParent().get(), edge->getInputNum()}).second)
+                    itemSize += step;
+            }
+        }
+
+        section.tileBatch = std::max<size_t>(1, cacheSize / std::max<size_t>(1, itemSize));
+        if (section.tileBatch < batch)
+            depthFirstSections.push_back(section);
+        begin = end;
+    }
+}
+
+void MKLDNNGraph::InitExecutionPlan() {
+    executionPlan.clear();
+    dynamicBatchLim = 0;
+
+    auto section = depthFirstSections.begin();
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        if (section != depthFirstSections.end() && section->begin == i) {
+            executionPlan.push_back({nullptr, &*section, static_cast<int>(i)});
+            i = section->end - 1;
+            ++section;
+            continue;
+        }
+        if (graphNodes[i]->isExecutable())
+            executionPlan.push_back({graphNodes[i].get(), nullptr, static_cast<int>(i)});
+    }
+}
+
+void MKLDNNGraph::SetDynamicBatchLim(int batch) {
+    // nodes such as reorders recreate their primitives for a new limit, so it is not set again for the same batch
+    if (batch <= 0 || batch == dynamicBatchLim)
+        return;
+
+    for (auto& node : graphNodes) {
+        if (!node->isConstant())
+            node->setDynamicBatchLim(batch);
+    }
+    dynamicBatchLim = batch;
+}
+
+void MKLDNNGraph::ExecuteDepthFirstSection(const DepthFirstSection& section, mkldnn::stream& stream, int batch) {
+    const size_t items = batch > 0 ? std::min<size_t>(batch, section.batch) : section.batch;
+
+    std::vector<uint8_t*> basePtrs(section.edges.size());
+    for (size_t i = 0; i < section.edges.size(); i++)
+        basePtrs[i] = static_cast<uint8_t*>(section.edges[i]->getMemory().GetData());
+
+    for (size_t first = 0; first < items; first += section.tileBatch) {
+        const size_t tile = std::min(section.tileBatch, items - first);
+        for (size_t i = 0; i < section.edges.size(); i++) {
+            section.edges[i]->getMemoryPtr()->GetPrimitivePtr()->set_data_handle(basePtrs[i] + first * section.batchSteps[i]);
+        }
+        for (size_t i = section.begin; i < section.end; i++) {
+            PERF(graphNodes[i], hwPerfCounters, measurePerf);
+            InferenceEngine::trace::Scope traceNode{graphNodes[i]->getName().c_str(), "node", this, static_cast<int>(i)};
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
+
+            graphNodes[i]->setDynamicBatchLim(static_cast<int>(tile));
+            graphNodes[i]->execute(stream);
+        }
+    }
+
+    for (size_t i = 0; i < section.edges.size(); i++) {
+        section.edges[i]->getMemoryPtr()->GetPrimitivePtr()->set_data_handle(basePtrs[i]);
+    }
+    for (size_t i = section.begin; i < section.end; i++) {
+        graphNodes[i]->setDynamicBatchLim(batch > 0 ? batch : 0);
+    }
+}
+
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
@@ -685,22 +1245,55 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
 
         const void *ext_data_ptr = in->cbuffer();
-        void *inter_data_ptr = input->second->getChildEdgeAt(0)->getMemory().GetData();
+        const auto &inter_memory = input->second->getChildEdgeAt(0)->getMemory();
+        void *inter_data_ptr = inter_memory.GetData();
+
+        auto l = in->getTensorDesc().getLayout();
+        if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
+            l = NCHW;
+
+        auto meanImage = _meanImages.find(name);
+        if (meanImage != _meanImages.end() && ext_data_ptr != inter_data_ptr &&
+                inter_memory.GetDataType() == mkldnn::memory::f32 &&
+                inter_memory.GetFormat() == MKLDNNMemory::Convert(l) &&
+                in->size() == outDims.size() &&
+                in->getTensorDesc().getBlockingDesc().getOffsetPadding() == 0) {
+            // the input node memory has the same layout, so precision conversion and mean
+            // subtraction are done in a single pass instead of a reorder followed by in-place subtraction
+            auto *dst = reinterpret_cast<float *>(inter_data_ptr);
+            switch (in->getTensorDesc().getPrecision()) {
+                case Precision::FP32:
+                    meanImage->second.Subtract(outDims, reinterpret_cast<const float *>(ext_data_ptr), dst, l);
+                    return;
+                case Precision::U8:
+                case Precision::BOOL:
+                    meanImage->second.Subtract(outDims, reinterpret_cast<const uint8_t *>(ext_data_ptr), dst, l);
+                    return;
+                case Precision::I8:
+                    meanImage->second.Subtract(outDims, reinterpret_cast<const int8_t *>(ext_data_ptr), dst, l);
+                    return;
+                case Precision::U16:
+                    meanImage->second.Subtract(outDims, reinterpret_cast<const uint16_t *>(ext_data_ptr), dst, l);
+                    return;
+                case Precision::I16:
+                    meanImage->second.Subtract(outDims, reinterpret_cast<const int16_t *>(ext_data_ptr), dst, l);
+                    return;
+                default:
+                    break;
+            }
+        }
 
         if (ext_data_ptr != inter_data_ptr) {
-            auto l = in->getTensorDesc().getLayout();
-            if (l == CHW && input->second->getChildEdgeAt(0)->getDims().ndims() == 4)
-                l = NCHW;
-
-            input->second->getChildEdgeAt(0)->getMemory().SetData(
+            inter_memory.SetData(
                     MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
                     MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
-            if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
-                _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
+        if (meanImage != _meanImages.end()) {
+            // input node memory is FP32 if there is a mean image, so the reordered data is subtracted in place
+            if (inter_memory.GetDataType() == mkldnn::memory::f32) {
+                meanImage->second.Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
                 THROW_IE_EXCEPTION << "Mean image of type " << in->getTensorDesc().getPrecision().name() << " is unsupported";
             }
@@ -710,6 +1303,128 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
+namespace {
+
+struct YUVPlane {
+    const uint8_t *data;
+    size_t rowStride;
+    size_t pixelStride;
+};
+
+bool isYUVPlane(const Blob::Ptr &plane, size_t channels) {
+    if (!plane)
+        return false;
+    const auto &desc = plane->getTensorDesc();
+    return desc.getPrecision() == Precision::U8 && desc.getLayout() == NHWC && desc.getDims()[1] == channels;
+}
+
+YUVPlane getYUVPlane(const Blob::Ptr &plane) {
+    // planes of compound blobs are U8 NHWC, so the strides are in the N, H, W, C order
+    const auto &blockingDesc = plane->getTensorDesc().getBlockingDesc();
+    return {plane->cbuffer().as<const uint8_t *>() + blockingDesc.getOffsetPadding(),
+            blockingDesc.getStrides()[1], blockingDesc.getStrides()[2]};
+}
+
+}  // namespace
+
+bool MKLDNNGraph::CanPushYUVInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+    auto input = inputNodes.find(name);
+    if (input == inputNodes.end() || _meanImages.find(name) != _meanImages.end())
+        return false;
+
+    Blob::Ptr y;
+    if (auto nv12 = as<NV12Blob>(in)) {
+        if (!isYUVPlane(nv12->uv(), 2))
+            return false;
+        y = nv12->y();
+    } else if (auto i420 = as<I420Blob>(in)) {
+        if (!isYUVPlane(i420->u(), 1) || !isYUVPlane(i420->v(), 1) ||
+                i420->u()->getTensorDesc().getBlockingDesc().getStrides() != i420->v()->getTensorDesc().getBlockingDesc().getStrides())
+            return false;
+        y = i420->y();
+    } else {
+        return false;
+    }
+    if (!isYUVPlane(y, 1))
+        return false;
+
+    const auto &yDims = y->getTensorDesc().getDims();
+    if (yDims[0] != 1 || yDims[2] % 2 != 0 || yDims[3] % 2 != 0)
+        return false;
+
+    const auto &inter_memory = input->second->getChildEdgeAt(0)->getMemory();
+    const auto dims = input->second->getChildEdgeAt(0)->getDims().ToSizeVector();
+    const auto format = inter_memory.GetFormat();
+    return dims == SizeVector{1, 3, yDims[2], yDims[3]} &&
+           (inter_memory.GetDataType() == memory::u8 || inter_memory.GetDataType() == memory::f32) &&
+           (format == memory::nchw || format == memory::nhwc || format == memory::nChw8c || format == memory::nChw16c);
+}
+
+void MKLDNNGraph::PushYUVInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+    if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
+
+    auto input = inputNodes.find(name);
+    if (input == inputNodes.end())
+        THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' doesn't correspond to input in network";
+
+    YUVPlane y, u, v;
+    if (auto nv12 = as<NV12Blob>(in)) {
+        y = getYUVPlane(nv12->y());
+        u = getYUVPlane(nv12->uv());
+        v = u;
+        v.data += 1;
+    } else if (auto i420 = as<I420Blob>(in)) {
+        y = getYUVPlane(i420->y());
+        u = getYUVPlane(i420->u());
+        v = getYUVPlane(i420->v());
+    } else {
+        THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' is neither NV12 nor I420 blob";
+    }
+
+    const auto &inter_memory = input->second->getChildEdgeAt(0)->getMemory();
+    const TensorDesc desc = MKLDNNMemoryDesc(inter_memory.GetDescriptor());
+    const auto &dims = desc.getDims();
+
+    // in all supported layouts a channel of the image is a 2D grid with constant row and pixel strides
+    const size_t channelOffsets[3] = {desc.offset({0, 0, 0, 0}), desc.offset({0, 1, 0, 0}), desc.offset({0, 2, 0, 0})};
+    const size_t rowStride = desc.offset({0, 0, 1, 0}) - channelOffsets[0];
+    const size_t pixelStride = desc.offset({0, 0, 0, 1}) - channelOffsets[0];
+
+    cpu_yuv420_to_bgr(y.data, y.rowStride, u.data, v.data, u.rowStride, u.pixelStride, dims[2], dims[3],
+                      inter_memory.GetData(), MKLDNNExtensionUtils::DataTypeToIEPrecision(inter_memory.GetDataType()),
+                      channelOffsets, rowStride, pixelStride);
+}
+
+bool MKLDNNGraph::CanPushBatchedInputData(const std::string& name, const InferenceEngine::BatchedBlob::Ptr &in) {
+    auto input = inputNodes.find(name);
+    if (input == inputNodes.end() || _meanImages.find(name) != _meanImages.end())
+        return false;
+
+    const auto &itemDesc = in->getBlob(0)->getTensorDesc();
+    const auto &inter_memory = input->second->getChildEdgeAt(0)->getMemory();
+    const auto dims = input->second->getChildEdgeAt(0)->getDims().ToSizeVector();
+    return dims == in->getTensorDesc().getDims() &&
+           inter_memory.GetDataType() == MKLDNNExtensionUtils::IEPrecisionToDataType(itemDesc.getPrecision()) &&
+           inter_memory.GetFormat() == MKLDNNMemory::Convert(in->getTensorDesc().getLayout()) &&
+           inter_memory.GetDescriptor().data.layout_desc.blocking.offset_padding == 0;
+}
+
+void MKLDNNGraph::PushBatchedInputData(const std::string& name, const InferenceEngine::BatchedBlob::Ptr &in) {
+    if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
+
+    auto input = inputNodes.find(name);
+    if (input == inputNodes.end())
+        THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' doesn't correspond to input in network";
+
+    auto *dst = reinterpret_cast<uint8_t *>(input->second->getChildEdgeAt(0)->getMemory().GetData());
+    parallel_for(in->size(), [&](size_t i) {
+        auto item = in->getBlob(i);
+        const auto *src = item->cbuffer().as<const uint8_t *>() + item->getTensorDesc().getBlockingDesc().getOffsetPadding() *
+                          item->element_size();
+        cpu_memcpy(dst + i * item->byteSize(), src, item->byteSize());
+    });
+}
+
 void MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
@@ -765,26 +1480,85 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
+    // counters are measured only every perfCountPeriod-th inference, so they can stay enabled in production
+    measurePerf = (config.collectPerfCounters || hwPerfCounters) && (perfCountInferences++ % config.perfCountPeriod == 0);
+
+    // worker threads may be started lazily by the first inference, so their events are opened here
+    if (hwPerfCounters && measurePerf)
+        hwPerfCounters->refreshThreads();
+
+    SetDynamicBatchLim(batch);
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!parallelLevels.empty()) {
+        for (const auto& level : parallelLevels) {
+            tbb::parallel_for(size_t(0), level.size(), [&](size_t i) {
+                // a thread waiting for the parallel loops of its node must not start another node, which would
+                // use the same thread local scratchpad of primitives
+                tbb::this_task_arena::isolate([&] {
+                    const auto& node = level[i];
+                    PERF(node, hwPerfCounters, measurePerf);
+                    InferenceEngine::trace::Scope traceNode{node->getName().c_str(), "node", this, node->getExecIndex()};
+
+                    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+                    mkldnn::stream nodeStream = mkldnn::stream(stream::kind::eager);
+                    node->execute(nodeStream);
+                });
+            });
+            InferenceEngine::CPUStreamsExecutor::PreemptionPoint();
+        }
+
+        if (infer_count != -1) infer_count++;
+        return;
+    }
+#endif
+
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    for (const auto& step : executionPlan) {
+        // latency requests of other networks sharing the stream are executed between nodes
+        InferenceEngine::CPUStreamsExecutor::PreemptionPoint();
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+        if (step.section) {
+            ExecuteDepthFirstSection(*step.section, stream, batch);
+            continue;
+        }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+        MKLDNNNode* node = step.node;
+        PERF(node, hwPerfCounters, measurePerf);
+        InferenceEngine::trace::Scope traceNode{node->getName().c_str(), "node", this, step.index};
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[step.index]));
+
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+            node->execute(stream);
         }
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[step.index]));
     }
 
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::WarmUp() {
+    for (auto& node : graphNodes) {
+        if (node->getType() == MemoryInput)
+            return;
+    }
+
+    for (auto& input : inputNodes) {
+        for (size_t i = 0; i < input.second->getChildEdges().size(); i++)
+            input.second->getChildEdgeAt(i)->getMemory().FillZero();
+    }
+    Infer();
+
+    for (auto& node : graphNodes)
+        node->PerfCounter() = PerfCount();
+    perfCountInferences = 0;
+    if (infer_count != -1)
+        infer_count = 0;
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -828,6 +1602,15 @@ void MKLDNNGraph::SortTopologically() {
         VisitNode(node, sorted);
     }
 
+#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
+    // sliding window states have no inputs, they are moved to the front to advance the window
+    // before the frame of the current inference is produced
+    std::stable_partition(sorted.begin(), sorted.end(), [](const MKLDNNNodePtr& node) {
+        auto memoryInput = std::dynamic_pointer_cast<MKLDNNMemoryInputNode>(node);
+        return memoryInput && memoryInput->isSlidingWindow();
+    });
+#endif
+
     for (int i = 0; i < sorted.size(); i++) sorted[i]->execIndex = i;
 
     graphNodes.erase(graphNodes.begin(), graphNodes.end());
@@ -926,6 +1709,13 @@ void MKLDNNGraph::getInputBlobs(InferenceEngine::BlobMap &resp) {
 #endif
 }
 
+void* MKLDNNGraph::GetDefaultOutputPtr(const std::string& name) const {
+    auto found = defaultOutputPtrs.find(name);
+    if (found == defaultOutputPtrs.end())
+        THROW_IE_EXCEPTION << "Cannot find output with name: " << name;
+    return found->second;
+}
+
 void MKLDNNGraph::getOutputBlobs(InferenceEngine::BlobMap &resp) {
     for (auto &it : outputNodes) {
         std::string name = it->getName().substr(4);
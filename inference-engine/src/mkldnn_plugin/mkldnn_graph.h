@@ -12,13 +12,65 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "threading/ie_thread_local.hpp"
+#include <ie_compound_blob.h>
 #include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Memory for intermediate tensors shared by graphs which are never executed concurrently, e.g. graphs of one stream.
+ * The memory grows to the largest requested size, graphs allocated before the growth keep the previous block alive.
+ */
+class MKLDNNWorkspace {
+public:
+    typedef std::shared_ptr<MKLDNNWorkspace> Ptr;
+
+    /**
+     * @brief Returns a memory block of at least the requested size
+     * @param eng An engine to create the block
+     * @param size A size in bytes
+     * @param allocator An allocator of a new block, the default allocation is used if it is null
+     * @param created Set to true if a new block was created
+     */
+    MKLDNNMemoryPtr Get(const mkldnn::engine& eng, size_t size, const std::shared_ptr<InferenceEngine::IAllocator>& allocator,
+                        bool& created);
+
+private:
+    MKLDNNMemoryPtr memory;
+    size_t memorySize = 0;
+};
+
+/**
+ * @brief Outputs of constant subgraphs shared by graphs of one network, e.g. graphs of different streams.
+ * A graph publishes its constant tensors after it has computed them, graphs created later take them
+ * instead of own memory and don't execute constant nodes which only compute shared tensors.
+ *
+ * Is a thread safe
+ */
+class MKLDNNConstantsSharing {
+public:
+    typedef std::shared_ptr<MKLDNNConstantsSharing> Ptr;
+
+    /**
+     * @brief Returns a published tensor memory or null if there is none
+     */
+    MKLDNNMemoryPtr Find(const std::string& key);
+
+    /**
+     * @brief Publishes a computed tensor memory, which is kept while at least one graph uses it
+     */
+    void Publish(const std::string& key, const MKLDNNMemoryPtr& memory);
+
+private:
+    std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> memories;
+    std::mutex guard;
+};
+
 class MKLDNNGraph {
 public:
     typedef std::shared_ptr<MKLDNNGraph> Ptr;
@@ -43,6 +95,30 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty();
 
+    /**
+     * @brief Sets a workspace for intermediate tensors shared with other graphs, must be called before CreateGraph.
+     * Tensors which keep their values between inferences, e.g. outputs of constant subgraphs, are still allocated
+     * by the graph itself.
+     */
+    void setWorkspace(const MKLDNNWorkspace::Ptr& workspace) {
+        sharedWorkspace = workspace;
+    }
+
+    /**
+     * @brief Sets a store of constant tensors shared with other graphs of the same network and shapes,
+     * must be called before CreateGraph
+     */
+    void setConstantsSharing(const MKLDNNConstantsSharing::Ptr& constants) {
+        constantsSharing = constants;
+    }
+
+    /**
+     * @brief Returns an allocator of large buffers, null for the default allocation
+     */
+    const std::shared_ptr<InferenceEngine::IAllocator>& getMemoryAllocator() const {
+        return memoryAllocator;
+    }
+
     void getInputBlobs(InferenceEngine::BlobMap &in_map);
     void getOutputBlobs(InferenceEngine::BlobMap &out_map);
 
@@ -56,10 +132,38 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+
+    /**
+     * @brief Checks that an NV12 or I420 compound blob can be converted to BGR by PushYUVInputData: the input node
+     * memory has one 3-channel image of the blob size in U8 or FP32 and no mean image is set for the input.
+     */
+    bool CanPushYUVInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @brief Converts an NV12 or I420 compound blob to BGR directly into the input node memory in its own layout,
+     * so neither an intermediate BGR blob nor a reorder into the graph layout is needed.
+     */
+    void PushYUVInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    /**
+     * @brief Checks that items of a batched blob can be copied by PushBatchedInputData: the input node memory has
+     * the precision and plain layout of the items and no mean image is set for the input.
+     */
+    bool CanPushBatchedInputData(const std::string& name, const InferenceEngine::BatchedBlob::Ptr &in);
+    /**
+     * @brief Copies items of a batched blob directly into consecutive batch items of the input node memory,
+     * so the items don't have to be gathered into one blob first.
+     */
+    void PushBatchedInputData(const std::string& name, const InferenceEngine::BatchedBlob::Ptr &in);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(int batch = -1);
 
+    /**
+     * @brief Infers the graph once with zero inputs, so threads of the calling stream are started, the graph memory
+     * is paged in and lazily initialized primitives are ready before the first request. Performance counters are reset
+     * after the run. Graphs with memory states are not inferred to keep the states initial.
+     */
+    void WarmUp();
+
     std::vector<MKLDNNNodePtr>& GetNodes() {
         return graphNodes;
     }
@@ -80,6 +184,12 @@ public:
         return inputNodes;
     }
 
+    /**
+     * @brief Returns the output data handle allocated by the graph itself.
+     * Infer requests switch the output memory back to it when they cannot write to their output blob directly
+     */
+    void* GetDefaultOutputPtr(const std::string& name) const;
+
 
     mkldnn::engine getEngine() const {
         return eng;
@@ -135,10 +245,23 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        defaultOutputPtrs.clear();
+        depthFirstSections.clear();
+        parallelLevels.clear();
+        executionPlan.clear();
+        dynamicBatchLim = 0;
+        constMemories.clear();
+        constNodesToExecute.clear();
     }
     Status status;
     Config config;
 
+    // Not null when hardware events are sampled around execution of each node
+    HwPerfCounters* hwPerfCounters = nullptr;
+    // Whether the nodes of the current inference update their counters
+    bool measurePerf = false;
+    uint64_t perfCountInferences = 0;
+
     // For dumping purposes. -1 - no counting, all other positive
     // values mean increment it within each Infer() call
     int infer_count = -1;
@@ -146,6 +269,15 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    MKLDNNWorkspace::Ptr sharedWorkspace;
+    MKLDNNMemoryPtr memSharedWorkspace;
+    MKLDNNConstantsSharing::Ptr constantsSharing;
+    // memory of constant tensors allocated separately from the workspace to be shared with other graphs,
+    // the key is empty for tensors taken from other graphs, which are not published again
+    std::vector<std::pair<std::string, MKLDNNMemoryPtr>> constMemories;
+    // constant nodes which compute at least one tensor not taken from other graphs
+    std::vector<MKLDNNNodePtr> constNodesToExecute;
+    std::shared_ptr<InferenceEngine::IAllocator> memoryAllocator;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -153,8 +285,42 @@ protected:
     std::vector<MKLDNNEdgePtr> graphEdges;
 
     std::map<std::string, MeanImage> _meanImages;
+    std::map<std::string, void*> defaultOutputPtrs;
     std::string _name;
 
+    /**
+     * @brief Consecutive nodes which are executed by tiles of a few batch items instead of the whole batch
+     */
+    struct DepthFirstSection {
+        size_t begin;
+        size_t end;
+        size_t batch;
+        size_t tileBatch;
+        std::vector<MKLDNNEdgePtr> edges;
+        // distance between batch items of the edge memory, 0 if the memory is used only inside the section,
+        // such memory keeps only the current tile, so the tile is not evicted from the cache by the next one
+        std::vector<size_t> batchSteps;
+    };
+    std::vector<DepthFirstSection> depthFirstSections;
+
+    // nodes grouped by the longest path from the graph inputs, nodes of a group don't depend on each other
+    // and are executed concurrently; empty if the nodes are executed one by one
+    std::vector<std::vector<MKLDNNNodePtr>> parallelLevels;
+
+    /**
+     * @brief A step of sequential execution: either an executable node or a whole depth first section
+     */
+    struct ExecutionStep {
+        MKLDNNNode* node;
+        const DepthFirstSection* section;
+        // position in graphNodes, reported by traces and used by blob dumps
+        int index;
+    };
+    // built once by InitGraph, so Infer skips constant and no-op nodes without checking them
+    std::vector<ExecutionStep> executionPlan;
+    // batch limit set to the nodes by the last Infer, they are updated only when it changes
+    int dynamicBatchLim = 0;
+
     mkldnn::engine eng;
 
     void Replicate(const InferenceEngine::ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr);
@@ -162,11 +328,17 @@ protected:
     void InitGraph();
     void InitNodes();
     void InitDescriptors();
+    void PlanLayouts();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void InitDepthFirstSections();
+    void InitParallelLevels();
+    void InitExecutionPlan();
+    void SetDynamicBatchLim(int batch);
+    void ExecuteDepthFirstSection(const DepthFirstSection& section, mkldnn::stream& stream, int batch);
     void ExecuteConstantNodesOnly();
     void SetOriginalLayerNames();
 
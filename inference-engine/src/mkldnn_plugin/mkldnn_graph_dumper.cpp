@@ -15,6 +15,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <cstdint>
 
 using namespace InferenceEngine;
 
@@ -279,6 +280,19 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
         serialization_info[ExecGraphInfoSerialization::PERF_COUNTER] = "not_executed";  // it means it was not calculated yet
     }
 
+    auto hwPerf = node->PerfCounter().hwAvg();
+    if (hwPerf.cycles != 0) {
+        serialization_info[ExecGraphInfoSerialization::PERF_CYCLES] = std::to_string(hwPerf.cycles);
+        serialization_info[ExecGraphInfoSerialization::PERF_INSTRUCTIONS] = std::to_string(hwPerf.instructions);
+        serialization_info[ExecGraphInfoSerialization::PERF_LLC_MISSES] = std::to_string(hwPerf.llcMisses);
+    }
+
+    // Estimations for roofline analysis, achieved FLOP/s and bytes/s are derived with the execution time
+    serialization_info[ExecGraphInfoSerialization::ESTIMATED_FLOPS] =
+        std::to_string(static_cast<uint64_t>(node->getEstimatedFlops()));
+    serialization_info[ExecGraphInfoSerialization::ESTIMATED_BYTES] =
+        std::to_string(static_cast<uint64_t>(node->getEstimatedBytes()));
+
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
     return serialization_info;
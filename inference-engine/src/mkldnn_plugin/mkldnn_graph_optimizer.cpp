@@ -18,6 +18,9 @@
 #include "nodes/mkldnn_resample_node.h"
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_memory_node.hpp"
+#include "nodes/mkldnn_attention_node.h"
+#include "nodes/mkldnn_gemm_node.h"
 
 #include <blob_factory.hpp>
 #include <legacy/ie_layers_internal.hpp>
@@ -38,6 +41,11 @@
 #include <memory>
 #include <set>
 #include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+#include <locale>
 
 #include "mkldnn_itt.h"
 
@@ -56,6 +64,12 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     MergeConversions(graph);
     graph.RemoveDroppedNodes();
 
+    FuseMatMulSoftmaxMatMul(graph);
+    graph.RemoveDroppedNodes();
+
+    FuseGemmAndPermute(graph);
+    graph.RemoveDroppedNodes();
+
     FuseBroadcastAndEltwise(graph);
     graph.RemoveDroppedNodes();
 
@@ -155,6 +169,11 @@ void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &grap
     MergePermuteAndReorder(graph);
     graph.RemoveDroppedNodes();
 
+#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
+    FuseSlidingWindowState(graph);
+    graph.RemoveDroppedNodes();
+#endif
+
     graph.RemoveDroppedEdges();
 }
 
@@ -1694,11 +1713,6 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
                 return false;
             }
 
-            // Avoid cycle dependencies
-            for (auto &parentParentEdge : parentNode->getParentEdges()) {
-                if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
-                    return false;
-            }
         }
 
         if (!childNode->getFusedWith().empty())
@@ -1784,6 +1798,24 @@ void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
                     }
 
                     auto parentEltwise = parentNode;
+                    auto eltwiseNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(parentEltwise);
+
+                    // the same tensor is already an input of the fused node (e.g. x in x * f(x)), so its port is reused
+                    // and the fused subgraph reads it once
+                    int sharedPort = -1;
+                    for (size_t k = 0; k < parentEltwise->getParentEdges().size(); k++) {
+                        auto existingEdge = parentEltwise->getParentEdgeAt(k);
+                        if (existingEdge->getParent() == parent && existingEdge->getInputNum() == inNum) {
+                            sharedPort = existingEdge->getOutputNum();
+                            break;
+                        }
+                    }
+                    if (sharedPort >= 0) {
+                        eltwiseNode->addPostOpInputPort(static_cast<size_t>(sharedPort));
+                        continue;
+                    }
+
+                    eltwiseNode->addPostOpInputPort(parentEltwise->getParentEdges().size());
                     MKLDNNEdgePtr newEdge(new MKLDNNEdge(parent, parentEltwise, inNum, parentEltwise->getParentEdges().size()));
                     auto &graphEdges = graph.GetEdges();
                     graphEdges.push_back(newEdge);
@@ -1999,6 +2031,84 @@ void MKLDNNGraphOptimizer::removeEdge(MKLDNNGraph &graph, MKLDNNEdgePtr& edge) {
     }
 }
 
+#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
+void MKLDNNGraphOptimizer::FuseSlidingWindowState(MKLDNNGraph &graph) {
+    // The pattern is MemoryInput -> in-place Concat(state, frame) -> window consumers
+    //                                         \-> Crop(window without the first frame) -> MemoryOutput
+    // Memory of the concatenation becomes a moving view of a ring buffer kept by MemoryInput,
+    // so Crop and MemoryOutput are removed and only the frame is written by an inference.
+    auto isPlain = [](const TensorDesc& desc) {
+        const auto& order = desc.getBlockingDesc().getOrder();
+        for (size_t i = 0; i < order.size(); i++) {
+            if (order[i] != i)
+                return false;
+        }
+        return desc.getBlockingDesc().getBlockDims() == desc.getDims() && desc.getBlockingDesc().getOffsetPadding() == 0;
+    };
+
+    // memory of the node is rebound to a new position of the window before every inference
+    auto isRebindable = [&](const MKLDNNNodePtr& node) {
+        if (IsOneOf(node->getType(), {Input, MemoryInput, Output, Split}) || node->isInplace())
+            return false;
+        auto concat = std::dynamic_pointer_cast<MKLDNNConcatNode>(node);
+        return !concat || !concat->isOptimized();
+    };
+
+    for (auto &node : graph.GetNodes()) {
+        auto memoryInput = std::dynamic_pointer_cast<MKLDNNMemoryInputNode>(node);
+        if (!memoryInput || memoryInput->isSlidingWindow() || node->getChildEdges().size() != 1)
+            continue;
+
+        auto window = std::dynamic_pointer_cast<MKLDNNConcatNode>(node->getChildEdgeAt(0)->getChild());
+        if (!window || !window->isOptimized() || window->getParentEdges().size() != 2 ||
+                window->getParentEdgeAt(0)->getParent() != node || window->getChildEdges().empty())
+            continue;
+
+        auto frame = window->getParentEdgeAt(1)->getParent();
+        if (!isRebindable(frame) || frame->getChildEdges().size() != 1)
+            continue;
+
+        auto stateDims = node->getChildEdgeAt(0)->getDims();
+        auto windowDims = window->getChildEdgeAt(0)->getDims();
+        if (stateDims.ndims() < 2 || stateDims[0] != 1 ||
+                !isPlain(window->getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].desc))
+            continue;
+        auto frameRows = windowDims[1] - stateDims[1];
+
+        MKLDNNNodePtr crop;
+        MKLDNNNodePtr memoryOutput;
+        bool canBeFused = true;
+        for (size_t i = 0; canBeFused && i < window->getChildEdges().size(); i++) {
+            auto child = window->getChildEdgeAt(i)->getChild();
+            if (!crop && child->getType() == Crop && child->getChildEdges().size() == 1 &&
+                    child->getChildEdgeAt(0)->getDims() == stateDims) {
+                auto output = std::dynamic_pointer_cast<MKLDNNMemoryOutputNode>(child->getChildEdgeAt(0)->getChild());
+                auto cropLayer = std::dynamic_pointer_cast<CropLayer>(child->getCnnLayer());
+                if (output && cropLayer && output->getId() == memoryInput->getId()) {
+                    bool isStateCrop = true;
+                    for (size_t j = 0; j < cropLayer->axis.size(); j++) {
+                        if (cropLayer->offset[j] != (cropLayer->axis[j] == 1 ? frameRows : 0))
+                            isStateCrop = false;
+                    }
+                    if (isStateCrop) {
+                        crop = child;
+                        memoryOutput = output;
+                        continue;
+                    }
+                }
+            }
+            canBeFused = isRebindable(child);
+        }
+        if (!canBeFused || !crop)
+            continue;
+
+        crop->remove();
+        memoryOutput->remove();
+        memoryInput->setSlidingWindow(window, static_cast<size_t>(frameRows));
+    }
+}
+#endif
+
 void MKLDNNGraphOptimizer::FuseBroadcastAndEltwise(MKLDNNGraph &graph) {
     std::vector<MKLDNNNodePtr>& graphNodes = graph.GetNodes();
 
@@ -2362,3 +2472,240 @@ void MKLDNNGraphOptimizer::MergePermuteAndReorder(MKLDNNGraph &graph) {
         }
     }
 }
+
+void MKLDNNGraphOptimizer::FuseMatMulSoftmaxMatMul(MKLDNNGraph &graph) {
+    auto isFloatPrecision = [](Precision prc) {
+        return prc == Precision::FP32 || prc == Precision::BF16;
+    };
+
+    auto isSuitableGemm = [&](const MKLDNNNodePtr& node) {
+        if (node->getType() != Gemm || node->getParentEdges().size() != 2 || !node->getFusedWith().empty())
+            return false;
+        auto* gemmLayer = dynamic_cast<GemmLayer*>(node->getCnnLayer().get());
+        if (gemmLayer == nullptr || gemmLayer->transpose_a || gemmLayer->insData.size() != 2)
+            return false;
+        return isFloatPrecision(gemmLayer->insData[0].lock()->getPrecision()) &&
+               isFloatPrecision(gemmLayer->insData[1].lock()->getPrecision());
+    };
+
+    auto getSingleChild = [](const MKLDNNNodePtr& node) -> MKLDNNNodePtr {
+        if (node->getChildEdges().size() != 1)
+            return nullptr;
+        return node->getChildEdgeAt(0)->getChild();
+    };
+
+    auto getParentEdgeAtPort = [](const MKLDNNNodePtr& node, int port) -> MKLDNNEdgePtr {
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            if (edge->getOutputNum() == port)
+                return edge;
+        }
+        return nullptr;
+    };
+
+    auto floatToString = [](float value) {
+        std::ostringstream stream;
+        stream.imbue(std::locale::classic());
+        stream << std::setprecision(std::numeric_limits<float>::max_digits10) << value;
+        return stream.str();
+    };
+
+    struct AttentionChain {
+        std::vector<MKLDNNNodePtr> nodes;  // Q*K^T gemm, scale and mask eltwises, softmax, *V gemm
+        std::vector<MKLDNNEdgePtr> inputs;  // Q, K, V and optional mask
+        float scale;
+        float postMaskScale;
+        bool transposeK;
+        bool transposeV;
+    };
+    std::vector<AttentionChain> chains;
+
+    for (auto &node : graph.GetNodes()) {
+        if (!isSuitableGemm(node))
+            continue;
+
+        auto* qkLayer = dynamic_cast<GemmLayer*>(node->getCnnLayer().get());
+        AttentionChain chain;
+        chain.nodes.push_back(node);
+        chain.inputs.push_back(getParentEdgeAtPort(node, 0));
+        chain.inputs.push_back(getParentEdgeAtPort(node, 1));
+        chain.scale = qkLayer->alpha;
+        chain.postMaskScale = 1.0f;
+        chain.transposeK = qkLayer->transpose_b;
+        MKLDNNEdgePtr maskEdge;
+
+        auto scoresDims = node->getChildEdgeAt(0)->getDims().ToSizeVector();
+        auto child = getSingleChild(node);
+        while (child && child->getType() == Eltwise && child->getFusedWith().empty()) {
+            auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(child.get());
+            if (eltwiseNode->getOpType() == PowerStatic) {
+                auto* powerLayer = dynamic_cast<PowerLayer*>(child->getCnnLayer().get());
+                if (powerLayer == nullptr || powerLayer->power != 1.0f || powerLayer->offset != 0.0f)
+                    break;
+                (maskEdge ? chain.postMaskScale : chain.scale) *= powerLayer->scale;
+            } else if (eltwiseNode->isSum() && !maskEdge && child->getParentEdges().size() == 2) {
+                auto edge0 = getParentEdgeAtPort(child, 0);
+                auto edge1 = getParentEdgeAtPort(child, 1);
+                if (!edge0 || !edge1)
+                    break;
+                maskEdge = edge0->getParent() == chain.nodes.back() ? edge1 : edge0;
+                if (maskEdge->getParent() == chain.nodes.back() ||
+                    child->getChildEdgeAt(0)->getDims().ToSizeVector() != scoresDims)
+                    break;
+                auto maskDims = maskEdge->getDims().ToSizeVector();
+                bool broadcastable = maskDims.size() <= scoresDims.size();
+                for (size_t i = 0; broadcastable && i < maskDims.size(); i++) {
+                    auto scoresDim = scoresDims[scoresDims.size() - maskDims.size() + i];
+                    broadcastable = maskDims[i] == scoresDim || maskDims[i] == 1;
+                }
+                if (!broadcastable)
+                    break;
+            } else {
+                break;
+            }
+            chain.nodes.push_back(child);
+            child = getSingleChild(child);
+        }
+
+        if (!child || child->getType() != SoftMax || !child->getFusedWith().empty())
+            continue;
+        auto* softmaxLayer = dynamic_cast<SoftMaxLayer*>(child->getCnnLayer().get());
+        if (softmaxLayer == nullptr || softmaxLayer->axis != static_cast<int>(scoresDims.size()) - 1)
+            continue;
+        chain.nodes.push_back(child);
+
+        auto pvGemm = getSingleChild(child);
+        if (!pvGemm || !isSuitableGemm(pvGemm) || getParentEdgeAtPort(pvGemm, 0)->getParent() != child)
+            continue;
+        auto* pvLayer = dynamic_cast<GemmLayer*>(pvGemm->getCnnLayer().get());
+        if (pvLayer->alpha != 1.0f)
+            continue;
+        chain.nodes.push_back(pvGemm);
+        chain.inputs.push_back(getParentEdgeAtPort(pvGemm, 1));
+        chain.transposeV = pvLayer->transpose_b;
+        if (maskEdge)
+            chain.inputs.push_back(maskEdge);
+
+        // the fused node doesn't broadcast Q, K and V over batch dimensions
+        auto qDims = chain.inputs[0]->getDims().ToSizeVector();
+        auto kDims = chain.inputs[1]->getDims().ToSizeVector();
+        auto vDims = chain.inputs[2]->getDims().ToSizeVector();
+        if (qDims.size() != kDims.size() || qDims.size() != vDims.size() ||
+            !std::equal(qDims.begin(), qDims.end() - 2, kDims.begin()) ||
+            !std::equal(qDims.begin(), qDims.end() - 2, vDims.begin()))
+            continue;
+
+        chains.push_back(chain);
+    }
+
+    for (auto &chain : chains) {
+        auto qkGemm = chain.nodes.front();
+        auto pvGemm = chain.nodes.back();
+        auto pvLayer = pvGemm->getCnnLayer();
+
+        CNNLayerPtr layer(new CNNLayer({pvGemm->getName(), "Attention", pvLayer->precision}));
+        layer->params["scale"] = floatToString(chain.scale);
+        layer->params["post_mask_scale"] = floatToString(chain.postMaskScale);
+        layer->params["transpose_k"] = chain.transposeK ? "true" : "false";
+        layer->params["transpose_v"] = chain.transposeV ? "true" : "false";
+        for (auto &input : chain.inputs) {
+            auto inputLayer = input->getChild()->getCnnLayer();
+            layer->insData.push_back(inputLayer->insData[input->getOutputNum()]);
+        }
+        layer->outData = pvLayer->outData;
+
+        MKLDNNNodePtr attention(new MKLDNNAttentionNode(layer, graph.getEngine(), graph.weightsCache));
+        for (auto &node : chain.nodes)
+            attention->mergeWith(node);
+
+        for (size_t port = 0; port < chain.inputs.size(); port++) {
+            auto &input = chain.inputs[port];
+            MKLDNNEdgePtr edge(new MKLDNNEdge(input->getParent(), attention, input->getInputNum(), port));
+            graph.GetEdges().push_back(edge);
+            attention->addEdge(edge);
+        }
+
+        std::vector<MKLDNNEdgeWeakPtr> edgesToReconnect = pvGemm->getChildEdges();
+        for (auto &edge_w : edgesToReconnect) {
+            auto edge = edge_w.lock();
+            MKLDNNEdgePtr newEdge(new MKLDNNEdge(attention, edge->getChild(), edge->getInputNum(), edge->getOutputNum()));
+            graph.GetEdges().push_back(newEdge);
+            attention->addEdge(newEdge);
+        }
+
+        for (auto &node : chain.nodes)
+            node->remove();
+        graph.GetNodes().push_back(attention);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseGemmAndPermute(MKLDNNGraph &graph) {
+    auto getPermuteOrder = [](const MKLDNNNodePtr& node) {
+        SizeVector order;
+        for (auto axis : node->getCnnLayer()->GetParamAsInts("order", {}))
+            order.push_back(static_cast<size_t>(axis));
+        if (order.empty()) {
+            size_t rank = node->getParentEdgeAt(0)->getDims().ndims();
+            for (size_t i = 1; i <= rank; ++i)
+                order.push_back(rank - i);
+        }
+        return order;
+    };
+
+    auto isSuitablePermute = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Permute && node->getParentEdges().size() == 1 &&
+               node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    // Gemm walks the batch along the outermost dim and needs one of the matrix dims to be contiguous
+    auto isSuitableInputOrder = [](const SizeVector& order, size_t rank) {
+        if (order.size() != rank || (rank > 2 && order[0] != 0))
+            return false;
+        return order[rank - 1] == rank - 1 || order[rank - 2] == rank - 1;
+    };
+
+    auto isSuitableOutputOrder = [](const SizeVector& order, size_t rank) {
+        if (order.size() != rank || (rank > 2 && order[0] != 0))
+            return false;
+        return order[rank - 1] == rank - 1;
+    };
+
+    auto& graphNodes = graph.GetNodes();
+    std::vector<MKLDNNNodePtr> gemmNodes;
+    std::copy_if(graphNodes.begin(), graphNodes.end(), std::back_inserter(gemmNodes), [](const MKLDNNNodePtr& node) {
+        return node->getType() == Gemm && node->getParentEdges().size() == 2 && node->getFusedWith().empty();
+    });
+
+    for (auto &node : gemmNodes) {
+        auto* gemmNode = dynamic_cast<MKLDNNGemmNode*>(node.get());
+        if (gemmNode == nullptr)
+            continue;
+        const size_t rank = node->getChildEdgeAt(0)->getDims().ndims();
+
+        std::vector<MKLDNNNodePtr> inputPermutes;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            auto parent = edge->getParent();
+            if (!isSuitablePermute(parent))
+                continue;
+            auto order = getPermuteOrder(parent);
+            if (!isSuitableInputOrder(order, rank))
+                continue;
+            gemmNode->setInputOrder(edge->getOutputNum(), order);
+            inputPermutes.push_back(parent);
+        }
+        for (auto &permute : inputPermutes)
+            graph.DropNode(permute);
+
+        if (node->getChildEdges().size() != 1)
+            continue;
+        auto child = node->getChildEdgeAt(0)->getChild();
+        if (!isSuitablePermute(child))
+            continue;
+        auto order = getPermuteOrder(child);
+        if (!isSuitableOutputOrder(order, rank))
+            continue;
+        gemmNode->setOutputOrder(order);
+        graph.DropNode(child);
+    }
+}
@@ -53,6 +53,11 @@ private:
     void FuseScaleShiftAndQuantize(MKLDNNGraph &graph);
     void FuseClampAndQuantize(MKLDNNGraph &graph);
     void MergePermuteAndReorder(MKLDNNGraph &graph);
+    void FuseMatMulSoftmaxMatMul(MKLDNNGraph &graph);
+    void FuseGemmAndPermute(MKLDNNGraph &graph);
+#if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
+    void FuseSlidingWindowState(MKLDNNGraph &graph);
+#endif
 
     bool IsOneOf(Type type, std::vector<Type> types);
     bool IsOneOf(EltwiseOpType alg, std::vector<EltwiseOpType> algs);
@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <algorithm>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
@@ -14,6 +15,7 @@
 #include "mkldnn_exec_network.h"
 #include "mkldnn_itt.h"
 #include "nodes/common/cpu_convert.h"
+#include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_memory_state.h"
 #include "nodes/mkldnn_memory_node.hpp"
 
@@ -45,8 +47,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     if (execNetwork->QueryState().size() == 0) {
         for (auto &node : graph->GetNodes()) {
             if (node->getType() == MemoryInput) {
-                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
+                auto memoryNode = std::dynamic_pointer_cast<MKLDNNMemoryInputNode>(node);
                 auto state_name = memoryNode->getId();
 
                 // Remove suffix with pair ID. Internal information.
@@ -54,7 +55,7 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNVariableState(state_name, memoryNode, graph->getProperty().zeroCopyStates));
            }
         }
     } else {
@@ -94,27 +95,95 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
+// A blob and the edge memory are interchangeable only if they have the same precision and memory layout
+static bool isBlobCompatible(const InferenceEngine::Blob::Ptr &blob, const MKLDNNPlugin::MKLDNNEdgePtr &edge) {
+    InferenceEngine::TensorDesc edgeDesc = MKLDNNPlugin::MKLDNNMemoryDesc(edge->getMemory().GetDescriptor());
+    const auto& blobDesc = blob->getTensorDesc();
+    return edgeDesc.getPrecision() == blobDesc.getPrecision() &&
+           edgeDesc.getBlockingDesc() == blobDesc.getBlockingDesc();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::execPreprocessing() {
+    yuvInputs.clear();
+    directInputs.clear();
+    for (auto& input : _inputs) {
+        auto preProcData = _preProcData.find(input.first);
+        if (preProcData == _preProcData.end())
+            continue;
+
+        const auto& info = _networkInputs[input.first]->getPreProcess();
+        const auto colorFormat = info.getColorFormat();
+        if (!execNetwork->_reshaper && info.getResizeAlgorithm() == InferenceEngine::NO_RESIZE &&
+                info.getMeanVariant() == InferenceEngine::NONE &&
+                (colorFormat == InferenceEngine::ColorFormat::NV12 || colorFormat == InferenceEngine::ColorFormat::I420) &&
+                graph->CanPushYUVInputData(input.first, preProcData->second->getRoiBlob())) {
+            yuvInputs.insert(input.first);
+            continue;
+        }
+
+        // if the input memory is neither the blob nor rebound to it, the blob would be copied there as is,
+        // so the pre-processing writes the input memory directly and the frame is not materialized twice
+        auto inputNode = graph->inputNodes.find(input.first);
+        if (!execNetwork->_reshaper && inputNode != graph->inputNodes.end() &&
+                graph->_meanImages.find(input.first) == graph->_meanImages.end()) {
+            auto edge = inputNode->second->getChildEdgeAt(0);
+            void* inputMemory = edge->getMemory().GetData();
+            auto* node = dynamic_cast<MKLDNNInputNode *>(inputNode->second.get());
+            const bool rebound = externalPtr.find(input.first) != externalPtr.end() && node && node->isOutputMemoryRebindable();
+            if (!rebound && inputMemory != input.second->buffer().as<void*>() && isBlobCompatible(input.second, edge)) {
+                auto memoryBlob = make_blob_with_precision(input.second->getTensorDesc(), inputMemory);
+                preProcData->second->execute(memoryBlob, info, false, m_curBatch);
+                directInputs.insert(input.first);
+                continue;
+            }
+        }
+        preProcData->second->execute(input.second, info, false, m_curBatch);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::gatherBatchedBlob(const InferenceEngine::BatchedBlob::Ptr& batched,
+                                                         InferenceEngine::Blob::Ptr& inputBlob) {
+    // items have the layout of the input blob, so they are consecutive parts of it
+    auto *dst = inputBlob->buffer().as<uint8_t *>() + inputBlob->getTensorDesc().getBlockingDesc().getOffsetPadding() *
+                inputBlob->element_size();
+    InferenceEngine::parallel_for(batched->size(), [&](size_t i) {
+        auto item = batched->getBlob(i);
+        const auto *src = item->cbuffer().as<const uint8_t *>() + item->getTensorDesc().getBlockingDesc().getOffsetPadding() *
+                          item->element_size();
+        cpu_memcpy(dst + i * item->byteSize(), src, item->byteSize());
+    });
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
     for (auto input : _inputs) {
         if (!_networkInputs[input.first]) {
             THROW_IE_EXCEPTION << "Input blobs map contains not registered during IInferencePlugin::LoadNetwork blob with name " << input.first;
         }
+        if (yuvInputs.find(input.first) != yuvInputs.end()) {
+            graph->PushYUVInputData(input.first, _preProcData[input.first]->getRoiBlob());
+            continue;
+        }
+        if (directInputs.find(input.first) != directInputs.end())
+            continue;
+        auto batched = batchedInputs.find(input.first);
+        if (batched != batchedInputs.end()) {
+            if (graph->CanPushBatchedInputData(input.first, batched->second)) {
+                graph->PushBatchedInputData(input.first, batched->second);
+                continue;
+            }
+            gatherBatchedBlob(batched->second, input.second);
+        }
         auto inPrec = input.second->getTensorDesc().getPrecision();
 
         switch (inPrec) {
             // these precisions are supported by mkldnn, so we push the blob directly
+            // if a mean image exists, the graph converts the blob to FP32 while subtracting it
             case InferenceEngine::Precision::I8:
             case InferenceEngine::Precision::I32:
-            case InferenceEngine::Precision::FP32: {
-                break;
-            }
-            // these precisions are supported by mkldnn, so we push the blob directly
-            // BUT if a mean image exists, we convert the blob and send FP32
+            case InferenceEngine::Precision::FP32:
             case InferenceEngine::Precision::U8:
             case InferenceEngine::Precision::BOOL:
             case InferenceEngine::Precision::I16: {
-                if (graph->hasMeanImageFor(input.first))
-                    inPrec = InferenceEngine::Precision::FP32;
                 break;
             }
             // these precisions are unsupported by mkldnn, so we convert the blob and send I32
@@ -137,7 +206,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     graph = execNetwork->_graphs.local().get();
 
-    execDataPreprocessing(_inputs);
+    execPreprocessing();
+
+    if (execNetwork->_reshaper) {
+        selectGraph();
+    }
 
     changeDefaultPtr();
 
@@ -146,6 +219,75 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     graph->Infer(m_curBatch);
 
     graph->PullOutputData(_outputs);
+
+    for (auto& output : graph->outputNodes) {
+        auto name = output->getName().substr(4);
+        outputsCopied[name] = _outputs[name]->buffer().as<void*>() != output->getParentEdgeAt(0)->getMemory().GetData();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::selectGraph() {
+    InferenceEngine::ICNNNetwork::InputShapes inputShapes;
+    bool isLoadedShape = true;
+    for (auto&& input : _inputs) {
+        const auto& dims = input.second->getTensorDesc().getDims();
+        isLoadedShape = isLoadedShape && dims == _networkInputs[input.first]->getTensorDesc().getDims();
+        inputShapes[input.first] = dims;
+    }
+    if (isLoadedShape) {
+        shapedGraphs.reset();
+    } else {
+        auto found = execNetwork->GetShapedGraphs(inputShapes);
+        graph = found->graphs.local().get();
+        shapedGraphs = found;
+    }
+
+    // outputs of the previous shapes are replaced, so they are taken with GetBlob after the inference
+    InferenceEngine::BlobMap graphOutputs;
+    graph->getOutputBlobs(graphOutputs);
+    for (auto&& graphOutput : graphOutputs) {
+        auto& output = _outputs[graphOutput.first];
+        const auto& dims = graphOutput.second->getTensorDesc().getDims();
+        if (output && output->getTensorDesc().getDims() == dims)
+            continue;
+
+        auto precision = output ? output->getTensorDesc().getPrecision() : graphOutput.second->getTensorDesc().getPrecision();
+        auto layout = output && output->getTensorDesc().getDims().size() == dims.size()
+                      ? output->getTensorDesc().getLayout() : InferenceEngine::TensorDesc::getLayoutByDims(dims);
+        output = createBlob(InferenceEngine::TensorDesc(precision, dims, layout));
+        auto ptr = externalPtr.find(graphOutput.first);
+        if (ptr != externalPtr.end()) {
+            ptr->second = output->buffer();
+        }
+    }
+}
+
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::createBlob(const InferenceEngine::TensorDesc& desc) const {
+    const auto& allocator = graph->getMemoryAllocator();
+    auto blob = allocator ? make_blob_with_precision(desc, allocator) : make_blob_with_precision(desc);
+    blob->allocate();
+    return blob;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobIfStatic(const InferenceEngine::Blob::Ptr& blob, const std::string& name,
+                                                         bool isInput) const {
+    // with dynamic shapes blobs follow the inferred shapes instead of the loaded ones
+    if (execNetwork->_reshaper) {
+        if (!blob || blob->buffer() == nullptr) {
+            THROW_IE_EXCEPTION << (isInput ? "Input" : "Output") << " data was not allocated.";
+        }
+        return;
+    }
+    checkBlob(blob, name, isInput);
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    for (auto const& input : _inputs) {
+        checkBlobIfStatic(input.second, input.first, true);
+    }
+    for (auto const& output : _outputs) {
+        checkBlobIfStatic(output.second, output.first, false);
+    }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
@@ -153,6 +295,16 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
     graph->GetPerfData(perfMap);
+
+    // output nodes report whether the output was copied to the user blob by the last inference
+    for (auto& output : outputsCopied) {
+        auto perf = perfMap.find("out_" + output.first);
+        if (perf == perfMap.end())
+            continue;
+        std::string execType = output.second ? "copy" : "zero_copy";
+        std::fill(std::begin(perf->second.exec_type), std::end(perf->second.exec_type), '\0');
+        execType.copy(perf->second.exec_type, sizeof(perf->second.exec_type) - 1, 0);
+    }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine::Blob::Ptr &data) {
@@ -161,10 +313,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (!graph || !graph->IsReady())
         THROW_IE_EXCEPTION << "Graph is not ready!";
 
-    InferenceEngine::BlobMap blobs;
-    graph->getInputBlobs(blobs);
-
-    if (blobs.find(name) != blobs.end()) {
+    // bound blobs are returned without collecting the blobs of the graph, so repeated calls don't allocate
+    if (_networkInputs.find(name) != _networkInputs.end()) {
         // ROI blob is returned only if it was set previously.
         auto it = _preProcData.find(name);
         if (it != _preProcData.end()) {
@@ -172,12 +322,31 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             return;
         }
 
-        if (_inputs.find(name) != _inputs.end()) {
-            data = _inputs[name];
-            checkBlob(data, name, true);
+        auto batched = batchedInputs.find(name);
+        if (batched != batchedInputs.end()) {
+            data = batched->second;
             return;
         }
 
+        auto input = _inputs.find(name);
+        if (input != _inputs.end()) {
+            data = input->second;
+            checkBlobIfStatic(data, name, true);
+            return;
+        }
+    } else {
+        auto output = _outputs.find(name);
+        if (output != _outputs.end()) {
+            data = output->second;
+            checkBlobIfStatic(data, name, false);
+            return;
+        }
+    }
+
+    InferenceEngine::BlobMap blobs;
+    graph->getInputBlobs(blobs);
+
+    if (blobs.find(name) != blobs.end()) {
         InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
         InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
         if (_networkInputs.find(name) != _networkInputs.end()) {
@@ -188,8 +357,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
             desc = InferenceEngine::TensorDesc(p, dims, l);
         }
 
-        _inputs[name] = make_blob_with_precision(desc);
-        _inputs[name]->allocate();
+        _inputs[name] = createBlob(desc);
         if (desc.getPrecision() == originPrecision &&
                 graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
             externalPtr[name] = _inputs[name]->buffer();
@@ -201,12 +369,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     blobs.clear();
     graph->getOutputBlobs(blobs);
     if (blobs.find(name) != blobs.end()) {
-        if (_outputs.find(name) != _outputs.end()) {
-            data = _outputs[name];
-            checkBlob(data, name, false);
-            return;
-        }
-
         InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
 
         // WA: need to avoid exception thrown when we compare blocking desc in SetBlob
@@ -216,9 +378,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
         auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
         desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-        _outputs[name] = make_blob_with_precision(desc);
-        _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        _outputs[name] = createBlob(desc);
+        if (!graph->getProperty().batchLimit) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -228,6 +389,42 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     THROW_IE_EXCEPTION << "Cannot find blob with name: " << name;
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::rebindBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) {
+    auto input = _inputs.find(name);
+    if (input != _inputs.end()) {
+        // inputs with pre-processing, batched blobs or dynamic shapes are bound differently
+        if (_preProcData.find(name) != _preProcData.end() || batchedInputs.find(name) != batchedInputs.end() ||
+                execNetwork->_reshaper || input->second->getTensorDesc() != data->getTensorDesc())
+            return false;
+        if (input->second == data)
+            return true;
+
+        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
+            externalPtr[name] = data->buffer();
+        } else if (externalPtr.find(name) != externalPtr.end()) {
+            externalPtr.erase(name);
+        }
+        input->second = data;
+        return true;
+    }
+
+    auto output = _outputs.find(name);
+    if (output != _outputs.end() && _networkInputs.find(name) == _networkInputs.end()) {
+        if (output->second->getTensorDesc() != data->getTensorDesc())
+            return false;
+        if (output->second == data)
+            return true;
+
+        if (!graph->getProperty().batchLimit) {
+            externalPtr[name] = data->buffer();
+        }
+        output->second = data;
+        return true;
+    }
+    return false;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const InferenceEngine::Blob::Ptr &data) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "SetBlob");
     if (name == nullptr) {
@@ -243,6 +440,10 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
         THROW_IE_EXCEPTION << "Input data is empty. Input name: \'" << name << "\'";
     }
 
+    // fast bind: a blob with the same descriptor as the bound one passes the same checks, so only pointers are flipped
+    if (!compoundBlobPassed && rebindBlob(name, data))
+        return;
+
     InferenceEngine::InputInfo::Ptr foundInput;
     InferenceEngine::DataPtr foundOutput;
     size_t dataSize = data->size();
@@ -253,11 +454,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
         }
 
         const bool preProcRequired = preProcessingRequired(foundInput, data);
-        if (compoundBlobPassed && !preProcRequired) {
+        auto batchedBlob = InferenceEngine::as<InferenceEngine::BatchedBlob>(data);
+        if (compoundBlobPassed && !preProcRequired && !batchedBlob) {
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
-                               << "cannot set compound blob: supported only for input pre-processing";
+                               << "cannot set compound blob: supported only for input pre-processing and batches of blobs";
         }
 
+        batchedInputs.erase(name);
         if (preProcRequired) {
             if (_preProcData.find(name) == _preProcData.end()) {
                 _preProcData.emplace(name, InferenceEngine::CreatePreprocDataHelper());
@@ -266,6 +469,27 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             // Stores the given blob as ROI blob. It will be used to fill in network input during
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
+        } else if (batchedBlob) {
+            // batch items are copied into the input memory by PushInputData, _inputs keeps an own blob which
+            // is used to gather them if the input memory can't take them directly, so a previously set user
+            // blob is never overwritten
+            checkBatchedBlob(batchedBlob, foundInput);
+            batchedInputs[name] = batchedBlob;
+            _inputs[name] = createBlob(foundInput->getTensorDesc());
+            if (externalPtr.find(name) != externalPtr.end())
+                externalPtr[name] = _inputs[name]->buffer();
+        } else if (execNetwork->_reshaper &&
+                   foundInput->getTensorDesc().getDims().size() == data->getTensorDesc().getDims().size()) {
+            // dynamic shapes: the graph for the blob dimensions is selected in Infer
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundInput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Layout mismatch.";
+            }
+            if (externalPtr.find(name) != externalPtr.end()) {
+                externalPtr.erase(name);
+            }
+            _inputs[name] = data;
         } else {
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
@@ -315,8 +539,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        // the blob is used as the output memory if the graph produces the output in the same precision and layout
+        if (!graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -329,6 +553,55 @@ static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
 
+// Collects edges which share memory with the output, so the producer can write to the output blob directly.
+// The output memory may also be read by other consumers of the producer.
+static bool getOutputSharedEdges(const MKLDNNPlugin::MKLDNNNodePtr &output, std::vector<MKLDNNPlugin::MKLDNNEdgePtr> &sharedEdges) {
+    auto outputEdge = output->getParentEdgeAt(0);
+    void * defaultPtr = outputEdge->getMemory().GetPrimitive().get_data_handle();
+    auto producer = outputEdge->getParent();
+    if (producer->isConstant() || producer->isInplace())
+        return false;
+
+    for (auto& edge : producer->getChildEdgesAtPort(static_cast<size_t>(outputEdge->getInputNum()))) {
+        if (edge->getMemory().GetPrimitive().get_data_handle() != defaultPtr)
+            return false;
+        if (edge != outputEdge) {
+            auto& child = edge->getChild();
+            if (child->isConstant() || child->isInplace())
+                return false;
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+            auto* concat = dynamic_cast<MKLDNNPlugin::MKLDNNConcatNode *>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+#endif
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+            if (dynamic_cast<MKLDNNPlugin::MKLDNNSplitNode *>(child.get()))
+                return false;
+#endif
+        }
+        sharedEdges.push_back(edge);
+    }
+    if (producer->getChildEdges().size() != sharedEdges.size())
+        return false;
+
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = producer;
+    MKLDNNPlugin::MKLDNNNodePtr previousParent;
+    do {
+        previousParent = parent;
+        for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+            if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
+                parent = parent->getParentEdgeAt(i)->getParent();
+                break;
+            }
+        }
+        if (parent != previousParent &&
+            (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()))
+            return false;
+    } while (previousParent != parent);
+    return true;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
     for (auto& it : externalPtr) {
         auto input = graph->inputNodes.find(it.first);
@@ -336,72 +609,35 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
             if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
                 continue;
             // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
-#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
-#endif
-                // Cannot be in-place before split because split is using different ptrs without offsets
-#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
-#endif
-
-                if (child->isInplace())
-                    canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
-            }
+            auto* inputNode = dynamic_cast<MKLDNNInputNode *>(input->second.get());
+            bool canBeInPlace = inputNode && inputNode->isOutputMemoryRebindable();
             for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
                 changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
             }
             continue;
         }
 
-        MKLDNNNodePtr output;
-        for (auto& out : graph->outputNodes) {
-            if (out->getName() == "out_" + it.first) {
-                output = out;
-                break;
-            }
-        }
-        if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
+        if (_outputs.find(it.first) != _outputs.end())
             continue;
-        }
         THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
     }
+
+    for (auto& output : graph->outputNodes) {
+        auto name = output->getName().substr(4);
+        std::vector<MKLDNNEdgePtr> sharedEdges;
+        if (!getOutputSharedEdges(output, sharedEdges))
+            continue;
+
+        // outputs of other requests may be wired to the graph memory, so it is restored when a copy is required
+        void* ptr = graph->GetDefaultOutputPtr(name);
+        auto external = externalPtr.find(name);
+        if (external != externalPtr.end() && isBlobCompatible(_outputs[name], output->getParentEdgeAt(0)))
+            ptr = external->second;
+        for (auto& edge : sharedEdges) {
+            if (edge->getMemory().GetPrimitive().get_data_handle() != ptr)
+                changeEdgePtr(edge, ptr);
+        }
+    }
 }
 
 
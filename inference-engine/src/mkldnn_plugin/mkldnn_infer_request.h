@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <set>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -45,15 +46,58 @@ public:
 
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
+    void checkBlobs() override;
+
 private:
+    /**
+     * @brief Runs input pre-processing except NV12/I420 to BGR conversions which the graph does in PushInputData
+     * directly into its input memory
+     */
+    void execPreprocessing();
+
     void PushInputData();
 
+    /**
+     * @brief Binds a blob in place of the bound input or output blob with the same tensor descriptor, which was
+     * validated when it was set, so setting blobs from a pool of equal blobs costs only a few lookups
+     * @return false if the blob has to be validated and bound by SetBlob
+     */
+    bool rebindBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data);
+
+    /**
+     * @brief Copies items of a batched blob into consecutive batch items of the regular input blob
+     */
+    void gatherBatchedBlob(const InferenceEngine::BatchedBlob::Ptr& batched, InferenceEngine::Blob::Ptr& inputBlob);
+
+    void selectGraph();
+
+    void checkBlobIfStatic(const InferenceEngine::Blob::Ptr& blob, const std::string& name, bool isInput) const;
+
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
+    /**
+     * @brief Sets user blobs as input and output memory of the graph where nodes can read or write them directly
+     */
     void changeDefaultPtr();
+
+    /**
+     * @brief Allocates a blob with the memory allocator of the graph
+     */
+    InferenceEngine::Blob::Ptr createBlob(const InferenceEngine::TensorDesc& desc) const;
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    // keeps graphs compiled for the last inferred input shapes alive while the request uses them
+    std::shared_ptr<void>               shapedGraphs;
     std::map<std::string, void*>        externalPtr;
+    // whether the last inference copied an output to the user blob instead of writing it directly
+    std::map<std::string, bool>         outputsCopied;
+    // inputs whose NV12/I420 blobs are converted by the graph at the current inference
+    std::set<std::string>               yuvInputs;
+    // inputs pre-processed directly into the input memory at the current inference
+    std::set<std::string>               directInputs;
+    // batched blobs set for inputs, their items are copied directly into the input memory at every inference
+    std::map<std::string, InferenceEngine::BatchedBlob::Ptr> batchedInputs;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
 };
@@ -89,6 +89,20 @@ void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const void *data, bo
     }
 }
 
+void MKLDNNMemory::Create(const mkldnn::memory::desc& desc, const std::shared_ptr<IAllocator>& allocator) {
+    if (!allocator) {
+        Create(desc);
+        return;
+    }
+    const size_t size = memory::primitive_desc(desc, eng).get_size();
+    void* data = allocator->alloc(size);
+    if (data == nullptr)
+        THROW_IE_EXCEPTION << "Cannot allocate " << size << " bytes";
+    std::shared_ptr<void> owned(data, [allocator](void* ptr) { allocator->free(ptr); });
+    Create(desc, data);
+    ownedData = owned;
+}
+
 void MKLDNNMemory::SetData(memory::data_type dataType, memory::format format, const void* data, size_t size, bool ftz) const {
     uint8_t itemSize = MKLDNNExtensionUtils::sizeOfDataType(mkldnn::memory::data_type(dataType));
 
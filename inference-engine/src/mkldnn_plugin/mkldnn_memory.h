@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "ie_layouts.h"
+#include "ie_allocator.hpp"
 #include "mkldnn_dims.h"
 #include <mkldnn.hpp>
 #include <string>
@@ -104,6 +105,11 @@ public:
 
     void Create(const mkldnn::memory::desc& desc, const void* data = nullptr, bool pads_zeroing = true);
 
+    /**
+     * @brief Creates memory which owns data allocated by the allocator, the default allocation is used if it is null
+     */
+    void Create(const mkldnn::memory::desc& desc, const std::shared_ptr<InferenceEngine::IAllocator>& allocator);
+
     void SetData(mkldnn::memory::data_type dataType, mkldnn::memory::format format, const void* data, size_t size, bool ftz = true) const;
     void SetData(const MKLDNNMemory& memory, bool ftz = true) const;
 
@@ -122,6 +128,7 @@ public:
 
 private:
     std::shared_ptr<mkldnn::memory> prim;
+    std::shared_ptr<void> ownedData;
     mkldnn::engine eng;
 };
 
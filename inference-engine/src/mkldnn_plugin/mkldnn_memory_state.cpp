@@ -15,10 +15,17 @@ std::string  MKLDNNVariableState::GetName() const {
 }
 
 void  MKLDNNVariableState::Reset() {
+    node->finishWindowStep();
+    node->unbindState();
     storage->FillZero();
 }
 
 void  MKLDNNVariableState::SetState(Blob::Ptr newState) {
+    node->finishWindowStep();
+    if (zeroCopy && node->bindState(newState))
+        return;
+
+    node->unbindState();
     auto prec = newState->getTensorDesc().getPrecision();
     auto data_type = MKLDNNExtensionUtils::IEPrecisionToDataType(prec);
     auto data_layout = MKLDNNMemory::Convert(newState->getTensorDesc().getLayout());
@@ -29,6 +36,12 @@ void  MKLDNNVariableState::SetState(Blob::Ptr newState) {
 }
 
 InferenceEngine::Blob::CPtr MKLDNNVariableState::GetState() const {
+    node->finishWindowStep();
+    if (zeroCopy) {
+        // the blob is valid until the next inference, which may write the new state to the same memory
+        return make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()), storage->GetData());
+    }
+
     auto result_blob = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
     result_blob->allocate();
     std::memcpy(result_blob->buffer(), storage->GetData(), storage->GetSize());
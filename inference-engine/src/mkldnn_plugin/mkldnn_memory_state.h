@@ -5,16 +5,21 @@
 #pragma once
 
 #include "cpp_interfaces/impl/ie_variable_state_internal.hpp"
-#include "mkldnn_memory.h"
+#include "nodes/mkldnn_memory_node.hpp"
 
+#include <memory>
 #include <string>
 
 namespace MKLDNNPlugin {
 
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
-            name(name), storage(storage) {}
+    /**
+     * @param zeroCopy if true, blobs passed to SetState() are used as the state storage when possible
+     * and GetState() returns a blob sharing memory with the state
+     */
+    MKLDNNVariableState(std::string name, std::shared_ptr<MKLDNNMemoryInputNode> node, bool zeroCopy = false) :
+            name(name), node(node), storage(node->getStore()), zeroCopy(zeroCopy) {}
 
     std::string GetName() const override;
     void Reset() override;
@@ -23,7 +28,9 @@ public:
 
 private:
     std::string name;
+    std::shared_ptr<MKLDNNMemoryInputNode> node;
     MKLDNNMemoryPtr storage;
+    bool zeroCopy;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+}  // namespace MKLDNNPlugin
@@ -11,6 +11,9 @@
 #include <string>
 #include <limits>
 #include <cstdint>
+#include <functional>
+#include <numeric>
+#include <set>
 #include <unordered_map>
 
 #include <nodes/mkldnn_batchnorm_node.h>
@@ -45,6 +48,9 @@
 #include <nodes/mkldnn_tensoriterator_node.h>
 #include <nodes/mkldnn_scatter_update_node.h>
 #include <nodes/mkldnn_interpolate_node.h>
+#include <nodes/mkldnn_attention_node.h>
+#include <nodes/mkldnn_roi_align_node.h>
+#include <legacy/ie_layers.h>
 #include <mkldnn_types.h>
 #include "mkldnn_extension_utils.h"
 
@@ -141,6 +147,8 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceProd", ReduceProd},
         { "ReduceSum", ReduceSum},
         { "ReduceSumSquare", ReduceSumSquare},
+        { "Attention", Attention},
+        { "ROIAlign", ROIAlign},
 };
 
 Type TypeFromName(const std::string type) {
@@ -395,6 +403,7 @@ std::string MKLDNNNode::getPrimitiveDescriptorType() {
     SEARCH_TYPE(ref);
 
     SEARCH_TYPE(avx512);
+    SEARCH_TYPE(amx);
     SEARCH_TYPE(avx2);
     SEARCH_TYPE(avx);
     SEARCH_TYPE(sse42);
@@ -752,7 +761,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             memory.Create(MKLDNNMemoryDesc(newDesc.getDims(), newDesc.getDataType(), newFormat), internalBlob->buffer());
 
             MKLDNNMemoryPtr _ptr = MKLDNNMemoryPtr(new MKLDNNMemory(engine));
-            _ptr->Create(intDescs[i]);
+            _ptr->Create(intDescs[i], weightsAllocator);
             _ptr->SetData(memory);
 
             return _ptr;
@@ -763,9 +772,15 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
             const uint64_t data_hash = weightCache->GetHashFunc().hash(
                     internalBlob->buffer(), internalBlob->byteSize());
 
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
+            // the key depends only on the content and the layout, so the same repacked weights
+            // may be shared between layers, networks and processes
+            const mkldnn::memory::desc desc = intDescs[i];
+            const uint64_t desc_hash = weightCache->GetHashFunc().hash(
+                    reinterpret_cast<const unsigned char*>(&desc.data), sizeof(desc.data));
+
+            const std::string string_hash = std::to_string(internalBlob->byteSize())
+                                            + "_" + std::to_string(data_hash)
+                                            + "_" + std::to_string(desc_hash);
 
             ptr = weightCache->findOrCreate(string_hash, create);
         } else {
@@ -859,6 +874,9 @@ const std::vector<impl_desc_type>& MKLDNNNode::getPrimitivesPriority() {
             impl_desc_type::jit_uni_dw,
             impl_desc_type::jit_uni_1x1,
             impl_desc_type::jit_uni,
+            impl_desc_type::jit_avx512_amx_dw,
+            impl_desc_type::jit_avx512_amx_1x1,
+            impl_desc_type::jit_avx512_amx,
             impl_desc_type::jit_avx512_dw,
             impl_desc_type::jit_avx512_1x1,
             impl_desc_type::jit_avx512,
@@ -1098,6 +1116,108 @@ bool MKLDNNNode::isFusedWith(Type fusedNodeType) const {
     return false;
 }
 
+namespace {
+
+double elementsCount(const InferenceEngine::SizeVector& dims) {
+    return std::accumulate(dims.begin(), dims.end(), 1., std::multiplies<double>());
+}
+
+double kernelSize(const InferenceEngine::PropertyVector<unsigned int>& kernel) {
+    double size = 1.;
+    for (size_t i = 0; i < kernel.size(); i++)
+        size *= kernel[i];
+    return size;
+}
+
+}  // namespace
+
+double MKLDNNNode::getEstimatedFlops() const {
+    if (parentEdges.empty() || childEdges.empty())
+        return 0.;
+
+    const InferenceEngine::SizeVector inDims = getParentEdgeAt(0)->getDesc().getDims();
+    const InferenceEngine::SizeVector outDims = getChildEdgeAt(0)->getDesc().getDims();
+    const double outElems = elementsCount(outDims);
+
+    // multiply-add is counted as two operations
+    double flops = outElems;
+    switch (type) {
+    case Convolution:
+    case DeformableConvolution:
+        if (auto conv = dynamic_cast<InferenceEngine::ConvolutionLayer*>(cnnLayer.get()))
+            flops = 2. * outElems * inDims[1] / conv->_group * kernelSize(conv->_kernel);
+        break;
+    case BinaryConvolution:
+        if (auto conv = dynamic_cast<InferenceEngine::BinaryConvolutionLayer*>(cnnLayer.get()))
+            flops = 2. * outElems * inDims[1] / conv->_group * kernelSize(conv->_kernel);
+        break;
+    case Deconvolution:
+        if (auto deconv = dynamic_cast<InferenceEngine::DeconvolutionLayer*>(cnnLayer.get()))
+            flops = 2. * elementsCount(inDims) * outDims[1] / deconv->_group * kernelSize(deconv->_kernel);
+        break;
+    case FullyConnected:
+        flops = 2. * outElems * elementsCount(inDims) / inDims[0];
+        break;
+    case Gemm:
+        if (auto gemm = dynamic_cast<InferenceEngine::GemmLayer*>(cnnLayer.get()))
+            flops = 2. * outElems * (gemm->transpose_a ? inDims[inDims.size() - 2] : inDims.back());
+        break;
+    case Pooling:
+        if (auto pool = dynamic_cast<InferenceEngine::PoolingLayer*>(cnnLayer.get()))
+            flops = outElems * kernelSize(pool->_kernel);
+        break;
+    case Eltwise:
+        flops = outElems * std::max<size_t>(parentEdges.size() - 1, 1);
+        break;
+    case Input:
+    case Output:
+    case Reorder:
+    case Reshape:
+    case Flatten:
+    case Split:
+    case Concatenation:
+    case Crop:
+    case Tile:
+    case Pad:
+    case Permute:
+    case Copy:
+    case MemoryInput:
+    case MemoryOutput:
+        // pure data movement
+        flops = 0.;
+        break;
+    default:
+        break;
+    }
+
+    // fused operations are applied to every output element
+    return flops + outElems * fusedWith.size();
+}
+
+double MKLDNNNode::getEstimatedBytes() const {
+    double bytes = 0.;
+    for (size_t i = 0; i < parentEdges.size(); i++) {
+        const auto desc = getParentEdgeAt(i)->getDesc();
+        bytes += elementsCount(desc.getDims()) * desc.getPrecision().size();
+    }
+
+    // several edges of the same output port share memory
+    std::set<int> outPorts;
+    for (size_t i = 0; i < childEdges.size(); i++) {
+        const auto edge = getChildEdgeAt(i);
+        if (!outPorts.insert(edge->getInputNum()).second)
+            continue;
+        const auto desc = edge->getDesc();
+        bytes += elementsCount(desc.getDims()) * desc.getPrecision().size();
+    }
+
+    for (const auto& blob : internalBlobs) {
+        if (blob)
+            bytes += blob->byteSize();
+    }
+    return bytes;
+}
+
 Layout MKLDNNNode::getWeightsLayoutByDims(SizeVector dims, bool isGrouped) {
     switch (dims.size()) {
         case 0:
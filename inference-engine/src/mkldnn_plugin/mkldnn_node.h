@@ -83,7 +83,9 @@ enum Type {
     ReduceOr,
     ReduceProd,
     ReduceSum,
-    ReduceSumSquare
+    ReduceSumSquare,
+    Attention,
+    ROIAlign
 };
 
 Type TypeFromName(const std::string type);
@@ -198,6 +200,10 @@ static std::string NameFromType(Type type) {
             return "ReduceSum";
         case ReduceSumSquare:
             return "ReduceSumSquare";
+        case Attention:
+            return "Attention";
+        case ROIAlign:
+            return "ROIAlign";
         default:
             return "Unknown";
     }
@@ -331,6 +337,14 @@ public:
 
     bool isConstant();
 
+    /**
+     * @brief Checks whether MKLDNNGraph::Infer has to call execute for the node,
+     * i.e. it is not constant and its execute is not a no-op for the selected primitive descriptor
+     */
+    virtual bool isExecutable() {
+        return !isConstant();
+    }
+
     bool isInplace() const;
 
     bool isFusedWith(Type type) const;
@@ -402,6 +416,17 @@ public:
 
     PerfCount &PerfCounter() { return perfCounter; }
 
+    /**
+     * @brief Rough estimation of arithmetic operations done by one execution of the node, fused nodes included.
+     * It is reported in the executable graph to find nodes which are far from the device peak.
+     */
+    virtual double getEstimatedFlops() const;
+
+    /**
+     * @brief Bytes of inputs, outputs and weights of the node, a lower bound of memory traffic of one execution
+     */
+    double getEstimatedBytes() const;
+
     virtual void setDynamicBatchLim(int lim);
 
     void resolveNotAllocatedEdges();
@@ -573,6 +598,8 @@ protected:
 
     InferenceEngine::Blob::Ptr ext_scales;
     MKLDNNWeightsSharing::Ptr weightCache;
+    // allocator of repacked weights, null for the default allocation
+    std::shared_ptr<InferenceEngine::IAllocator> weightsAllocator;
 
     friend class MKLDNNEdge;
     friend class MKLDNNGraph;
@@ -7,6 +7,8 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialization.h"
+#include "ngraph_transformations/embedding_table_dequantization.hpp"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
@@ -14,12 +16,14 @@
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
+#include <set>
 #include <ie_system_conf.h>
 #include <generic_ie.hpp>
 #include <nodes/list.hpp>
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_transformer.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_load_time_breakdown.hpp>
 
 #include <legacy/convert_function_to_cnn_network.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/convert_opset1_to_legacy.hpp>
@@ -59,6 +63,7 @@
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <ngraph/graph_util.hpp>
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/pass/manager.hpp>
 
@@ -92,13 +97,25 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
-static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf) {
-    auto nGraphFunc = clonedNetwork->getFunction();
+static std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> GetConvertPrecisionList() {
+    return {
+            {ngraph::element::i64,     ngraph::element::i32},
+            {ngraph::element::u64,     ngraph::element::i32},
+            {ngraph::element::u16,     ngraph::element::i32},
+            {ngraph::element::u32,     ngraph::element::i32},
+            {ngraph::element::f16,     ngraph::element::f32},
+            {ngraph::element::boolean, ngraph::element::u8},
+    };
+}
+
+static void TransformFunction(const std::shared_ptr<ngraph::Function>& nGraphFunc, const Config& conf) {
     // Disable shape inference (WA for generic operations)
     ngraph::op::GenericIE::DisableReshape noReshape(nGraphFunc);
 
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::InitNodeInfo>();
+    // quantized embedding tables must be matched before they are folded to FP32 by ConstantFolding
+    manager.register_pass<FuseEmbeddingTableDequantization>();
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
     manager.register_pass<ngraph::pass::ConvertPriorBox>();
     manager.register_pass<ngraph::pass::ConvertNMS5ToLegacyMatcher>();
@@ -115,16 +132,7 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
     manager.register_pass<ngraph::pass::GRUCellDecomposition>();
     manager.register_pass<ngraph::pass::RNNCellDecomposition>();
 
-    std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> convert_precision_list{
-            {ngraph::element::i64,     ngraph::element::i32},
-            {ngraph::element::u64,     ngraph::element::i32},
-            {ngraph::element::u16,     ngraph::element::i32},
-            {ngraph::element::u32,     ngraph::element::i32},
-            {ngraph::element::f16,     ngraph::element::f32},
-            {ngraph::element::boolean, ngraph::element::u8},
-    };
-
-    for (auto &precision : convert_precision_list) {
+    for (auto &precision : GetConvertPrecisionList()) {
         manager.register_pass<ngraph::pass::ConvertPrecision>(precision.first, precision.second);
     }
 
@@ -207,6 +215,7 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
 
     using namespace ngraph::pass::low_precision;
     if (conf.lpTransformsMode == Config::LPTransformsMode::On) {
+        LoadTimeScope loadTimeScope(LoadTimePhase::LowPrecisionTransformations);
         auto params = LayerTransformation::Params(
             true,  // updatePrecisions
             LayerTransformation::QuantizedTensorAlignment::UpdateLevel,  // quantizedTensorAlignmentOnActivations
@@ -248,19 +257,181 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork, const Config& conf)
         // UnrollTI transformation is disabled by default, is turned on by LowLatency transformation
         return node->get_rt_info().count("UNROLL_TI") == 0;
     });
+    LoadTimeScope loadTimeScope(LoadTimePhase::LegacyConversion);
     legacyManager.run_passes(nGraphFunc);
+}
 
+// The transformed function is converted with input and output settings of the network it was transformed for
+static ICNNNetwork::Ptr ConvertToLegacyNetwork(const std::shared_ptr<ngraph::Function>& nGraphFunc, const ICNNNetwork& network) {
+    LoadTimeScope loadTimeScope(LoadTimePhase::LegacyConversion);
     OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "Transformation", "convertFunctionToICNNNetwork");
 
-    clonedNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, *clonedNetwork);
+    ICNNNetwork::Ptr legacyNetwork = InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, network);
 
     OV_ITT_TASK_NEXT(taskChain, "ConvertIOPrecision");
 
     // WA: after conversion to CNNNetwork user precision can redefine input/output precisions
     // so we need to apply additional precision conversion but only for inputs and outputs
-    for (auto & precision : convert_precision_list) {
-        NetPass::ConvertIOPrecision(*clonedNetwork, convertPrecision(precision.first), convertPrecision(precision.second));
+    for (auto & precision : GetConvertPrecisionList()) {
+        NetPass::ConvertIOPrecision(*legacyNetwork, convertPrecision(precision.first), convertPrecision(precision.second));
     }
+    return legacyNetwork;
+}
+
+static void FinalizeLegacyNetwork(const std::shared_ptr<ICNNNetwork>& clonedNetwork, bool is_transformed) {
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
+    if (implNetwork) {
+        FoldEmbeddingTableDequantization(*implNetwork);
+
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
+        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
+        ConstTransformer transformator(implNetwork.get());
+        transformator.fullTrim();
+        if (!is_transformed) {
+            NetPass::ConvertPrecision(*implNetwork, Precision::I64, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U64, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U32, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::FP16, Precision::FP32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::BOOL, Precision::U8);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U16, Precision::I32);
+        }
+    }
+}
+
+/**
+ * @brief Transforms a network for the plugin
+ * @param clonedNetwork A private copy of a network
+ * @param conf A plugin configuration
+ * @param transformedFunction If not `nullptr`, receives a copy of the function after the nGraph transformations
+ * @return A legacy network
+ */
+static std::shared_ptr<ICNNNetwork> TransformNetwork(std::shared_ptr<ICNNNetwork> clonedNetwork, const Config& conf,
+                                                     std::shared_ptr<ngraph::Function>* transformedFunction = nullptr) {
+    LoadTimeScope loadTimeScope(LoadTimePhase::Transformations);
+    bool is_transformed = false;
+    if (auto nGraphFunc = clonedNetwork->getFunction()) {
+        TransformFunction(nGraphFunc, conf);
+        if (transformedFunction != nullptr) {
+            *transformedFunction = ngraph::clone_function(*nGraphFunc);
+        }
+        clonedNetwork = ConvertToLegacyNetwork(nGraphFunc, *clonedNetwork);
+        is_transformed = true;
+    }
+    FinalizeLegacyNetwork(clonedNetwork, is_transformed);
+    return clonedNetwork;
+}
+
+/**
+ * @brief Checks that the CPU transformations of a function do not depend on its input shapes, so the transformed
+ *        function is reshaped instead of the original one. Operations which compute values from shapes, resolve pads
+ *        from shapes or are converted to layers with fixed output shapes are not allowed.
+ */
+static bool IsTransformationShapeAgnostic(const ngraph::Function& function) {
+    static const std::set<ngraph::NodeTypeInfo> shapeAgnosticOps = {
+        ngraph::opset4::Parameter::type_info, ngraph::opset4::Result::type_info, ngraph::opset4::Constant::type_info,
+        ngraph::opset4::Convert::type_info, ngraph::opset4::Convolution::type_info,
+        ngraph::opset4::GroupConvolution::type_info, ngraph::opset4::MaxPool::type_info,
+        ngraph::opset4::AvgPool::type_info, ngraph::opset4::Add::type_info, ngraph::opset4::Subtract::type_info,
+        ngraph::opset4::Multiply::type_info, ngraph::opset4::Divide::type_info, ngraph::opset4::Maximum::type_info,
+        ngraph::opset4::Minimum::type_info, ngraph::opset4::SquaredDifference::type_info,
+        ngraph::opset4::Power::type_info, ngraph::opset4::Relu::type_info, ngraph::opset4::Sigmoid::type_info,
+        ngraph::opset4::Tanh::type_info, ngraph::opset4::Clamp::type_info, ngraph::opset4::Elu::type_info,
+        ngraph::opset4::PRelu::type_info, ngraph::opset4::Exp::type_info, ngraph::opset4::Abs::type_info,
+        ngraph::opset4::Sqrt::type_info, ngraph::opset4::Negative::type_info, ngraph::opset4::Floor::type_info,
+        ngraph::opset4::Erf::type_info, ngraph::opset4::Gelu::type_info, ngraph::opset4::Swish::type_info,
+        ngraph::opset4::HSwish::type_info, ngraph::opset4::Mish::type_info, ngraph::opset4::SoftPlus::type_info,
+        ngraph::opset4::HardSigmoid::type_info, ngraph::opset4::Selu::type_info,
+        ngraph::opset4::FakeQuantize::type_info, ngraph::opset4::BatchNormInference::type_info,
+        ngraph::opset4::Concat::type_info, ngraph::opset4::Softmax::type_info, ngraph::opset4::MVN::type_info,
+        ngraph::opset4::NormalizeL2::type_info, ngraph::opset4::LRN::type_info,
+        ngraph::opset4::DepthToSpace::type_info, ngraph::opset4::SpaceToDepth::type_info,
+    };
+    auto isExplicitPad = [](ngraph::op::PadType padType) {
+        return padType == ngraph::op::PadType::EXPLICIT || padType == ngraph::op::PadType::VALID;
+    };
+    for (auto&& node : function.get_ops()) {
+        if (shapeAgnosticOps.count(node->get_type_info()) == 0) {
+            return false;
+        }
+        bool explicitPads = true;
+        if (auto conv = std::dynamic_pointer_cast<ngraph::opset4::Convolution>(node)) {
+            explicitPads = isExplicitPad(conv->get_auto_pad());
+        } else if (auto groupConv = std::dynamic_pointer_cast<ngraph::opset4::GroupConvolution>(node)) {
+            explicitPads = isExplicitPad(groupConv->get_auto_pad());
+        } else if (auto maxPool = std::dynamic_pointer_cast<ngraph::opset4::MaxPool>(node)) {
+            explicitPads = isExplicitPad(maxPool->get_auto_pad());
+        } else if (auto avgPool = std::dynamic_pointer_cast<ngraph::opset4::AvgPool>(node)) {
+            explicitPads = isExplicitPad(avgPool->get_auto_pad());
+        }
+        if (!explicitPads) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Reshapes a function transformed for the loaded shapes instead of transforming the reshaped network again
+ * @param transformedFunction A function transformed for the loaded shapes
+ * @param reshapedNetwork The original network reshaped for new shapes, used as a reference of shapes
+ * @param conf A plugin configuration
+ * @return A legacy network or `nullptr` if shapes of the transformed function differ from the reference ones
+ */
+static std::shared_ptr<ICNNNetwork> ReshapeTransformedFunction(const ngraph::Function& transformedFunction,
+                                                               const ICNNNetwork& reshapedNetwork, const Config& conf) {
+    LoadTimeScope loadTimeScope(LoadTimePhase::Transformations);
+    auto reference = reshapedNetwork.getFunction();
+    auto nGraphFunc = ngraph::clone_function(transformedFunction);
+
+    std::map<std::string, std::shared_ptr<ngraph::Node>> referenceOps;
+    for (auto&& node : reference->get_ops()) {
+        referenceOps.emplace(node->get_friendly_name(), node);
+    }
+    for (auto&& parameter : nGraphFunc->get_parameters()) {
+        auto found = referenceOps.find(parameter->get_friendly_name());
+        if (found == referenceOps.end()) {
+            return nullptr;
+        }
+        parameter->set_partial_shape(found->second->get_output_partial_shape(0));
+    }
+    try {
+        nGraphFunc->validate_nodes_and_infer_types();
+    } catch (const ngraph::ngraph_error&) {
+        return nullptr;
+    }
+
+    // fused operations keep a friendly name of the last original one, so every output is checked
+    for (auto&& node : nGraphFunc->get_ops()) {
+        auto found = referenceOps.find(node->get_friendly_name());
+        if (found == referenceOps.end() || found->second->get_output_size() != node->get_output_size()) {
+            continue;
+        }
+        for (size_t i = 0; i < node->get_output_size(); i++) {
+            if (!node->get_output_partial_shape(i).same_scheme(found->second->get_output_partial_shape(i))) {
+                return nullptr;
+            }
+        }
+    }
+    const auto& results = nGraphFunc->get_results();
+    const auto& referenceResults = reference->get_results();
+    if (results.size() != referenceResults.size()) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < results.size(); i++) {
+        if (!results[i]->get_output_partial_shape(0).same_scheme(referenceResults[i]->get_output_partial_shape(0))) {
+            return nullptr;
+        }
+    }
+
+    auto legacyNetwork = ConvertToLegacyNetwork(nGraphFunc, reshapedNetwork);
+    FinalizeLegacyNetwork(legacyNetwork, true);
+    return legacyNetwork;
+}
+
+// The executable network keeps the legacy network, a private one is passed as is instead of being copied
+static details::CNNNetworkImplPtr GetNetworkImpl(const std::shared_ptr<ICNNNetwork>& network) {
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(network);
+    return implNetwork ? implNetwork : cloneNet(*network);
 }
 
 InferenceEngine::ExecutableNetworkInternal::Ptr
@@ -296,30 +467,97 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
-
-    bool is_transformed = false;
-    if (clonedNetwork->getFunction()) {
-        Transformation(clonedNetwork, conf);
-        is_transformed = true;
+    if (!conf.dynamicShapesProfiles.empty() && !conf.enableDynamicShapes) {
+        THROW_IE_EXCEPTION << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_PROFILES << " requires "
+                           << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES << " to be enabled";
     }
-    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
-    if (implNetwork) {
-        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
-        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
-        ConstTransformer transformator(implNetwork.get());
-        transformator.fullTrim();
-        if (!is_transformed) {
-            NetPass::ConvertPrecision(*implNetwork, Precision::I64, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U64, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U32, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::FP16, Precision::FP32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::BOOL, Precision::U8);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U16, Precision::I32);
+
+    MKLDNNExecNetwork::NetworkReshaper reshaper;
+    // filled by the transformations of the loaded network and shared with the reshaper
+    std::shared_ptr<std::shared_ptr<ngraph::Function>> transformedFunction;
+    if (conf.enableDynamicShapes) {
+        if (conf.enableDynamicBatch) {
+            THROW_IE_EXCEPTION << "Dynamic shapes cannot be used together with dynamic batch";
+        }
+        if (network.getFunction() == nullptr) {
+            THROW_IE_EXCEPTION << "Dynamic shapes are supported only for networks represented as ngraph::Function";
         }
+        // the original network is kept to be reshaped before the transformations, which fold shape dependent subgraphs
+        std::shared_ptr<const ICNNNetwork> originalNetwork = cloneNetwork(network);
+        // if the transformations do not depend on shapes, the transformed function is reshaped instead
+        if (IsTransformationShapeAgnostic(*network.getFunction())) {
+            transformedFunction = std::make_shared<std::shared_ptr<ngraph::Function>>();
+        }
+        reshaper = [originalNetwork, transformedFunction, conf] (const ICNNNetwork::InputShapes& inputShapes) {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "Engine::ReshapeNetwork");
+            auto reshapedNetwork = cloneNetwork(*originalNetwork);
+            ResponseDesc resp;
+            if (OK != reshapedNetwork->reshape(inputShapes, &resp)) {
+                THROW_IE_EXCEPTION << "Cannot reshape the network for new input shapes: " << resp.msg;
+            }
+            if (transformedFunction && *transformedFunction) {
+                if (auto network = ReshapeTransformedFunction(**transformedFunction, *reshapedNetwork, conf)) {
+                    return network;
+                }
+            }
+            return TransformNetwork(reshapedNetwork, conf);
+        };
+    }
+
+    std::shared_ptr<ICNNNetwork> clonedNetwork;
+    {
+        LoadTimeScope loadTimeScope(LoadTimePhase::Cloning);
+        clonedNetwork = cloneNetwork(network);
+    }
+    clonedNetwork = TransformNetwork(clonedNetwork, conf, transformedFunction.get());
+
+    return std::make_shared<MKLDNNExecNetwork>(GetNetworkImpl(clonedNetwork), conf, extensionManager, GetWeightsSharing(conf.sharedWeightsDir),
+                                               reshaper);
+}
+
+NumaNodesWeights& Engine::GetWeightsSharing(const std::string& sharedWeightsDir) {
+    std::lock_guard<std::mutex> lock{weightsSharingMutex};
+    auto found = weightsSharing.find(sharedWeightsDir);
+    if (found == weightsSharing.end()) {
+        found = weightsSharing.emplace(sharedWeightsDir, NumaNodesWeights{sharedWeightsDir}).first;
+    }
+    return found->second;
+}
+
+ExecutableNetwork Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferenceEngine::Core object";
+    }
+
+    CNNNetworkDeserializer deserializer(networkModel, GetCore());
+
+    // the exported config defines how the stored network was transformed, the passed one can only add runtime options
+    std::map<std::string, std::string> exportedConfig;
+    deserializer >> exportedConfig;
+    Config conf = engConfig;
+    conf.readProperties(exportedConfig);
+    conf.readProperties(config);
+
+    CNNNetwork network;
+    deserializer >> network;
+
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    copyInputOutputInfo(network.getInputsInfo(), network.getOutputsInfo(), networkInputs, networkOutputs);
+    deserializer >> networkInputs;
+    deserializer >> networkOutputs;
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(GetNetworkImpl(network), conf, extensionManager,
+                                                           GetWeightsSharing(conf.sharedWeightsDir));
+    execNetwork->setNetworkInputs(networkInputs);
+    execNetwork->setNetworkOutputs(networkOutputs);
+    execNetwork->SetPointerToPlugin(shared_from_this());
+    return make_executable_network(execNetwork);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -362,6 +600,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_FINGERPRINT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -396,6 +636,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         capabilities.push_back(METRIC_VALUE(FP16));
         capabilities.push_back(METRIC_VALUE(INT8));
         capabilities.push_back(METRIC_VALUE(BIN));
+        capabilities.push_back(METRIC_VALUE(BATCHED_BLOB));
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -408,6 +649,10 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_FINGERPRINT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_FINGERPRINT, getIsaFingerprint());
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -436,7 +681,8 @@ QueryNetworkResult Engine::QueryNetwork(const ICNNNetwork& network, const std::m
         }
 
         auto clonedNetwork = cloneNetwork(network);
-        Transformation(clonedNetwork, conf);
+        TransformFunction(clonedNetwork->getFunction(), conf);
+        clonedNetwork = ConvertToLegacyNetwork(clonedNetwork->getFunction(), *clonedNetwork);
         std::unordered_set<std::string> supported;
         std::unordered_set<std::string> unsupported;
         for (details::CNNNetworkIterator itLayer{clonedNetwork.get()}; itLayer != details::CNNNetworkIterator(); itLayer++) {
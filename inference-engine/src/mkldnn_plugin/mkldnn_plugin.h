@@ -11,6 +11,7 @@
 #include <map>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <functional>
 #include <vector>
 
@@ -25,6 +26,9 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    InferenceEngine::ExecutableNetwork ImportNetworkImpl(std::istream& networkModel,
+                                                         const std::map<std::string, std::string>& config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
@@ -38,7 +42,11 @@ public:
 
 private:
     Config engConfig;
-    NumaNodesWeights weightsSharing;
+    NumaNodesWeights& GetWeightsSharing(const std::string& sharedWeightsDir);
+
+    std::mutex weightsSharingMutex;
+    // weights caches are separated by the directory used to share them between processes
+    std::map<std::string, NumaNodesWeights> weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
 };
 
@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines conditional compilation domains of the CPU plugin
+ * @file mkldnn_selective_build.h
+ */
+
+#pragma once
+
+#include <openvino/cc/selective_build.h>
+#include <cpu_isa_traits.hpp>
+
+// Domains are declared in the global namespace, so the macros below work both for MKLDNNPlugin nodes
+// and for the extension nodes from InferenceEngine::Extensions::Cpu
+OV_CC_DOMAINS(MKLDNNPlugin);
+
+/**
+ * @brief Checks that a JIT code path for the given ISA may be used. Selective build keeps only ISAs
+ * which were selected during the statistics collection run, checks for other ones are false at compile time
+ * and kernels behind them are dropped from the binary.
+ * @note All checks of a node should go through this macro, otherwise the layout chosen for one ISA
+ * may not match the kernel of another one
+ */
+#define MKLDNN_ISA(isa) OV_ISA(MKLDNNPlugin, isa, mkldnn::impl::cpu::mayiuse(mkldnn::impl::cpu::isa))
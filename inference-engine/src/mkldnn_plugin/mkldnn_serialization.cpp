@@ -0,0 +1,196 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_serialization.h"
+
+#include <ie_system_conf.h>
+#include <legacy/ie_util_internal.hpp>
+#include <mkldnn.hpp>
+
+#include <array>
+#include <sstream>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+constexpr std::array<char, 4> exportMagic = {{'C', 'P', 'U', 'B'}};
+constexpr uint32_t exportFormatVersion = 1;
+
+void writeSize(std::ostream& stream, uint64_t size) {
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+}
+
+uint64_t readSize(std::istream& stream) {
+    uint64_t size = 0;
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!stream.good()) {
+        THROW_IE_EXCEPTION << "Cannot read exported CPU network: unexpected end of stream";
+    }
+    return size;
+}
+
+void writeString(std::ostream& stream, const std::string& str) {
+    writeSize(stream, str.size());
+    stream.write(str.data(), str.size());
+}
+
+std::string readString(std::istream& stream) {
+    std::string str(readSize(stream), '\0');
+    stream.read(&str[0], str.size());
+    if (!stream.good()) {
+        THROW_IE_EXCEPTION << "Cannot read exported CPU network: unexpected end of stream";
+    }
+    return str;
+}
+
+}  // namespace
+
+std::string getIsaFingerprint() {
+    // kernels are generated by the library for the ISA of the host, so its version is a part of the fingerprint too
+    const auto version = mkldnn_version();
+    std::stringstream isa;
+    isa << "sse42:" << with_cpu_x86_sse42()
+        << ";avx:" << with_cpu_x86_avx()
+        << ";avx2:" << with_cpu_x86_avx2()
+        << ";avx512f:" << with_cpu_x86_avx512f()
+        << ";avx512_core:" << with_cpu_x86_avx512_core()
+        << ";vnni:" << with_cpu_x86_avx512_core_vnni()
+        << ";bf16:" << with_cpu_x86_bfloat16()
+        << ";amx_int8:" << with_cpu_x86_avx512_core_amx_int8()
+        << ";amx_bf16:" << with_cpu_x86_avx512_core_amx_bf16()
+        << ";mkldnn:" << version->major << "." << version->minor << "." << version->patch << "." << version->hash;
+    return isa.str();
+}
+
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream& ostream) : _ostream(ostream) {
+    _ostream.write(exportMagic.data(), exportMagic.size());
+    _ostream.write(reinterpret_cast<const char*>(&exportFormatVersion), sizeof(exportFormatVersion));
+    writeString(_ostream, getIsaFingerprint());
+}
+
+void CNNNetworkSerializer::operator << (const std::map<std::string, std::string>& config) {
+    writeSize(_ostream, config.size());
+    for (auto&& item : config) {
+        writeString(_ostream, item.first);
+        writeString(_ostream, item.second);
+    }
+}
+
+void CNNNetworkSerializer::operator << (const InputsDataMap& inputs) {
+    writeSize(_ostream, inputs.size());
+    for (auto&& input : inputs) {
+        const auto& preProcess = input.second->getPreProcess();
+        writeString(_ostream, input.first);
+        writeString(_ostream, input.second->getPrecision().name());
+        writeSize(_ostream, input.second->getLayout());
+        writeSize(_ostream, preProcess.getResizeAlgorithm());
+        writeSize(_ostream, preProcess.getColorFormat());
+    }
+}
+
+void CNNNetworkSerializer::operator << (const OutputsDataMap& outputs) {
+    writeSize(_ostream, outputs.size());
+    for (auto&& output : outputs) {
+        writeString(_ostream, output.first);
+        writeString(_ostream, output.second->getPrecision().name());
+        writeSize(_ostream, output.second->getLayout());
+    }
+}
+
+void CNNNetworkSerializer::operator << (const ICNNNetwork& network) {
+    std::stringstream xml, weights;
+    serializeNetwork(network, xml, weights);
+    writeString(_ostream, xml.str());
+    writeString(_ostream, weights.str());
+    if (!_ostream.good()) {
+        THROW_IE_EXCEPTION << "Cannot export CPU network: error during writing to stream";
+    }
+}
+
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream& istream, ICore* core)
+    : _istream(istream), _core(core) {
+    std::array<char, 4> magic = {};
+    uint32_t version = 0;
+    _istream.read(magic.data(), magic.size());
+    _istream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!_istream.good() || magic != exportMagic) {
+        THROW_IE_EXCEPTION << "Cannot import network: the stream does not contain an exported CPU network";
+    }
+    if (version != exportFormatVersion) {
+        THROW_IE_EXCEPTION << "Cannot import network: unsupported CPU blob version " << version;
+    }
+    auto isa = readString(_istream);
+    if (isa != getIsaFingerprint()) {
+        THROW_IE_EXCEPTION << "Cannot import network: the network was exported on a CPU with different ISA or "
+                           << "kernel library version (" << isa << " vs " << getIsaFingerprint()
+                           << "), it must be compiled on this host from the original model";
+    }
+}
+
+void CNNNetworkDeserializer::operator >> (std::map<std::string, std::string>& config) {
+    auto size = readSize(_istream);
+    for (uint64_t i = 0; i < size; ++i) {
+        auto key = readString(_istream);
+        config[key] = readString(_istream);
+    }
+}
+
+void CNNNetworkDeserializer::operator >> (InputsDataMap& inputs) {
+    auto size = readSize(_istream);
+    for (uint64_t i = 0; i < size; ++i) {
+        auto name = readString(_istream);
+        auto precision = Precision::FromStr(readString(_istream));
+        auto layout = static_cast<Layout>(readSize(_istream));
+        auto resize = static_cast<ResizeAlgorithm>(readSize(_istream));
+        auto colorFormat = static_cast<ColorFormat>(readSize(_istream));
+
+        auto input = inputs.find(name);
+        if (input == inputs.end()) {
+            THROW_IE_EXCEPTION << "Cannot import network: exported input " << name << " is not found";
+        }
+        input->second->setPrecision(precision);
+        input->second->setLayout(layout);
+        input->second->getPreProcess().setResizeAlgorithm(resize);
+        input->second->getPreProcess().setColorFormat(colorFormat);
+    }
+}
+
+void CNNNetworkDeserializer::operator >> (OutputsDataMap& outputs) {
+    auto size = readSize(_istream);
+    for (uint64_t i = 0; i < size; ++i) {
+        auto name = readString(_istream);
+        auto precision = Precision::FromStr(readString(_istream));
+        auto layout = static_cast<Layout>(readSize(_istream));
+
+        auto output = outputs.find(name);
+        if (output == outputs.end()) {
+            THROW_IE_EXCEPTION << "Cannot import network: exported output " << name << " is not found";
+        }
+        output->second->setPrecision(precision);
+        output->second->setLayout(layout);
+    }
+}
+
+void CNNNetworkDeserializer::operator >> (CNNNetwork& network) {
+    auto xml = readString(_istream);
+
+    // weights are read directly to a blob to avoid an intermediate copy
+    Blob::Ptr weights;
+    auto weightsSize = readSize(_istream);
+    if (weightsSize != 0) {
+        weights = make_shared_blob<uint8_t>({Precision::U8, {static_cast<size_t>(weightsSize)}, Layout::C});
+        weights->allocate();
+        _istream.read(weights->buffer().as<char*>(), weightsSize);
+        if (!_istream.good()) {
+            THROW_IE_EXCEPTION << "Cannot read exported CPU network: unexpected end of stream";
+        }
+    }
+    network = _core->ReadNetwork(xml, weights);
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,61 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_icore.hpp>
+
+#include <istream>
+#include <ostream>
+#include <map>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Layout of an exported CPU executable network:
+ *   [magic][format version][ISA fingerprint][config][IR xml][weights][user inputs info][user outputs info]
+ * The stored network is the one passed to MKLDNNGraph::CreateGraph, so nGraph transformations,
+ * low precision transformations and legacy conversion are skipped on import.
+ */
+class CNNNetworkSerializer {
+public:
+    explicit CNNNetworkSerializer(std::ostream& ostream);
+
+    void operator << (const std::map<std::string, std::string>& config);
+    void operator << (const InferenceEngine::InputsDataMap& inputs);
+    void operator << (const InferenceEngine::OutputsDataMap& outputs);
+    void operator << (const InferenceEngine::ICNNNetwork& network);
+
+private:
+    std::ostream& _ostream;
+};
+
+class CNNNetworkDeserializer {
+public:
+    CNNNetworkDeserializer(std::istream& istream, InferenceEngine::ICore* core);
+
+    void operator >> (std::map<std::string, std::string>& config);
+    /**
+     * @brief Applies exported user precisions, layouts and preprocessing to inputs info of the imported network.
+     * Must be called after the network is read
+     */
+    void operator >> (InferenceEngine::InputsDataMap& inputs);
+    void operator >> (InferenceEngine::OutputsDataMap& outputs);
+    void operator >> (InferenceEngine::CNNNetwork& network);
+
+private:
+    std::istream& _istream;
+    InferenceEngine::ICore* _core;
+};
+
+/**
+ * @brief Returns a string with CPU ISA extensions and the MKLDNN version which affect kernels selected by the plugin.
+ * Blobs exported on a machine with different fingerprint are rejected on import.
+ * It is also reported as METRIC_KEY(IMPORT_EXPORT_FINGERPRINT), so the Core cache keeps a blob per fingerprint
+ */
+std::string getIsaFingerprint();
+
+}  // namespace MKLDNNPlugin
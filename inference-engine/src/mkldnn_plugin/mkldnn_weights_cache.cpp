@@ -6,14 +6,128 @@
 
 #include <ie_system_conf.h>
 #include <memory>
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <sys/statvfs.h>
+# include <unistd.h>
+#endif
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
-NumaNodesWeights::NumaNodesWeights() {
+#ifndef _WIN32
+namespace {
+
+/**
+ * Read-only mapping of a file with published weights. Mapped pages are shared between all processes
+ */
+class SharedWeightsFile {
+public:
+    SharedWeightsFile(void* data, size_t size) : _data(data), _size(size) {}
+    ~SharedWeightsFile() {
+        munmap(_data, _size);
+    }
+
+    void* data() const { return _data; }
+
+    static std::shared_ptr<SharedWeightsFile> open(const std::string& path, size_t size) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return nullptr;
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1 || static_cast<size_t>(sb.st_size) < size) {
+            close(fd);
+            return nullptr;
+        }
+        void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+            return nullptr;
+        return std::make_shared<SharedWeightsFile>(data, size);
+    }
+
+    // The file is filled under a temporary name and renamed after, so readers never see partial content
+    static bool publish(const std::string& path, const void* src, size_t size) {
+        const auto tmpPath = path + "." + std::to_string(getpid()) + ".tmp";
+        int fd = ::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd == -1)
+            return false;
+
+        // hugetlbfs accepts only sizes aligned to the huge page size
+        size_t fileSize = size;
+        struct statvfs fs = {};
+        if (fstatvfs(fd, &fs) == 0 && fs.f_bsize > 0)
+            fileSize = (size + fs.f_bsize - 1) / fs.f_bsize * fs.f_bsize;
+
+        bool published = false;
+        if (ftruncate(fd, static_cast<off_t>(fileSize)) == 0) {
+            // mmap is the only way to fill a file on hugetlbfs
+            void* dst = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (dst != MAP_FAILED) {
+                std::memcpy(dst, src, size);
+                munmap(dst, fileSize);
+                published = rename(tmpPath.c_str(), path.c_str()) == 0;
+            }
+        }
+        close(fd);
+        if (!published)
+            unlink(tmpPath.c_str());
+        return published;
+    }
+
+private:
+    void* _data;
+    size_t _size;
+};
+
+}  // namespace
+#endif  // _WIN32
+
+MKLDNNWeightsSharing::MKLDNNWeightsSharing(const std::string& sharedDir, int numaNodeId)
+    : sharedDir(sharedDir), numaNodeId(numaNodeId) {
+#ifdef _WIN32
+    if (!sharedDir.empty())
+        THROW_IE_EXCEPTION << "Sharing of weights between processes is not supported on this platform";
+#endif
+}
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreateShared(const std::string& name_hash,
+                                                         const std::function<MKLDNNMemoryPtr(void)>& create) {
+    // repacking is still done locally: it gives the memory descriptor and validates the published content
+    MKLDNNMemoryPtr local = create();
+#ifndef _WIN32
+    const size_t size = local->GetPrimitiveDescriptor().get_size();
+    const void* localData = local->GetData();
+    if (size == 0 || localData == nullptr)
+        return local;
+
+    // pages of a file are placed to the NUMA node of the first writer, so files are kept per node
+    const auto path = sharedDir + "/" + name_hash + "_numa" + std::to_string(numaNodeId) + ".bin";
+    auto file = SharedWeightsFile::open(path, size);
+    if (file == nullptr && SharedWeightsFile::publish(path, localData, size))
+        file = SharedWeightsFile::open(path, size);
+    if (file == nullptr || std::memcmp(file->data(), localData, size) != 0)
+        return local;
+
+    // the memory object keeps the mapping alive
+    std::shared_ptr<MKLDNNMemory> shared(new MKLDNNMemory(local->GetPrimitiveDescriptor().get_engine()),
+                                         [file](MKLDNNMemory* ptr) { delete ptr; });
+    shared->Create(local->GetDescriptor(), file->data(), false);
+    return shared;
+#else
+    return local;
+#endif  // _WIN32
+}
+
+NumaNodesWeights::NumaNodesWeights(const std::string& sharedDir) {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
+        _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>(sharedDir, numa_id);
 }
 
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
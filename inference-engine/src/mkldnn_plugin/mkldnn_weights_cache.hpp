@@ -49,11 +49,18 @@ protected:
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
  *
+ * If a shared directory is specified, created objects are also published there as files,
+ * so other processes loading the same weights map the same physical memory instead of own copies
+ *
  * Is a thread safe
  */
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
+
+    MKLDNNWeightsSharing() = default;
+    MKLDNNWeightsSharing(const std::string& sharedDir, int numaNodeId);
+
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
                              std::function<MKLDNNMemoryPtr(void)> create) {
         std::unique_lock<std::mutex> lock(guard);
@@ -61,7 +68,7 @@ public:
 
         MKLDNNMemoryPtr ptr;
         if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
-            ptr = create();
+            ptr = sharedDir.empty() ? create() : findOrCreateShared(name_hash, create);
             sharedWeights[name_hash] = ptr;
         }
         return ptr;
@@ -69,8 +76,13 @@ public:
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    MKLDNNMemoryPtr findOrCreateShared(const std::string& name_hash,
+                                       const std::function<MKLDNNMemoryPtr(void)>& create);
+
     std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
     std::mutex guard;
+    std::string sharedDir;
+    int numaNodeId = 0;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -81,7 +93,7 @@ protected:
  */
 class NumaNodesWeights {
 public:
-    NumaNodesWeights();
+    explicit NumaNodesWeights(const std::string& sharedDir = {});
 
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
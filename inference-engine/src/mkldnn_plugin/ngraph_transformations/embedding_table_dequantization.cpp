@@ -0,0 +1,169 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_table_dequantization.hpp"
+
+#include <string>
+#include <vector>
+
+#include <details/ie_exception.hpp>
+#include <legacy/ie_layers.h>
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+constexpr ngraph::NodeTypeInfo EmbeddingTableDequantize::type_info;
+
+EmbeddingTableDequantize::EmbeddingTableDequantize(const ngraph::Output<ngraph::Node>& table,
+                                                   const ngraph::Output<ngraph::Node>& scales,
+                                                   const ngraph::Output<ngraph::Node>& zero_points)
+        : Op({table, scales, zero_points}) {
+    constructor_validate_and_infer_types();
+}
+
+void EmbeddingTableDequantize::validate_and_infer_types() {
+    NODE_VALIDATION_CHECK(this, get_input_element_type(0) == ngraph::element::u8,
+                          "Embedding table must be U8, got ", get_input_element_type(0));
+    set_output_type(0, ngraph::element::f32, get_input_partial_shape(0));
+}
+
+bool EmbeddingTableDequantize::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    return true;
+}
+
+std::shared_ptr<ngraph::Node> EmbeddingTableDequantize::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<EmbeddingTableDequantize>(new_args.at(0), new_args.at(1), new_args.at(2));
+}
+
+namespace {
+
+bool isEmbeddingTable(const ngraph::Input<ngraph::Node>& input) {
+    const auto node = input.get_node();
+    return input.get_index() == 0 &&
+           (ngraph::is_type<ngraph::opset3::EmbeddingBagOffsetsSum>(node) ||
+            ngraph::is_type<ngraph::opset3::EmbeddingBagPackedSum>(node) ||
+            ngraph::is_type<ngraph::opset3::EmbeddingSegmentsSum>(node));
+}
+
+// Returns a constant with one value per table row, or nullptr if the values are not per row
+std::shared_ptr<ngraph::opset1::Constant> getRowValues(const ngraph::Output<ngraph::Node>& output, const ngraph::Shape& tableShape) {
+    auto node = output.get_node_shared_ptr();
+    if (auto convert = ngraph::as_type_ptr<ngraph::opset1::Convert>(node))
+        node = convert->get_input_node_shared_ptr(0);
+    auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(node);
+    if (!constant)
+        return nullptr;
+
+    const auto& shape = constant->get_shape();
+    const size_t rows = tableShape[0];
+    std::vector<float> values = constant->cast_vector<float>();
+    if (values.size() == 1) {
+        values.resize(rows, values[0]);
+    } else if (shape.size() != tableShape.size() || shape[0] != rows || values.size() != rows) {
+        return nullptr;
+    }
+    return ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{rows}, values);
+}
+
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(FuseEmbeddingTableDequantization, "FuseEmbeddingTableDequantization", 0);
+
+FuseEmbeddingTableDequantization::FuseEmbeddingTableDequantization() {
+    auto multiply = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>();
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        auto multiply = m.get_match_root();
+        const auto consumers = multiply->output(0).get_target_inputs();
+        if (consumers.empty())
+            return false;
+        for (const auto& consumer : consumers) {
+            if (!isEmbeddingTable(consumer))
+                return false;
+        }
+
+        ngraph::NodeVector dequantization = {multiply};
+        const size_t dataPort = ngraph::is_type<ngraph::opset1::Constant>(multiply->get_input_node_ptr(0)) ? 1 : 0;
+        auto data = multiply->get_input_node_shared_ptr(dataPort);
+        auto subtract = ngraph::as_type_ptr<ngraph::opset1::Subtract>(data);
+        if (subtract) {
+            dequantization.push_back(subtract);
+            data = subtract->get_input_node_shared_ptr(0);
+        }
+        auto convert = ngraph::as_type_ptr<ngraph::opset1::Convert>(data);
+        if (!convert || convert->get_output_element_type(0) != ngraph::element::f32)
+            return false;
+        dequantization.push_back(convert);
+        auto table = ngraph::as_type_ptr<ngraph::opset1::Constant>(convert->get_input_node_shared_ptr(0));
+        if (!table || table->get_element_type() != ngraph::element::u8 || table->get_shape().size() < 2)
+            return false;
+
+        const auto& tableShape = table->get_shape();
+        auto scales = getRowValues(multiply->input_value(1 - dataPort), tableShape);
+        auto zeroPoints = subtract ? getRowValues(subtract->input_value(1), tableShape) :
+                          ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{tableShape[0]}, {0.0f});
+        if (!scales || !zeroPoints)
+            return false;
+
+        auto dequantize = std::make_shared<EmbeddingTableDequantize>(table, scales, zeroPoints);
+        dequantize->set_friendly_name(multiply->get_friendly_name());
+        ngraph::copy_runtime_info(dequantization, dequantize);
+        ngraph::replace_node(multiply, dequantize);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(multiply, "FuseEmbeddingTableDequantization");
+    this->register_matcher(m, callback);
+}
+
+void FoldEmbeddingTableDequantization(details::CNNNetworkImpl& network) {
+    std::vector<CNNLayerPtr> dequantizeLayers;
+    for (const auto& layer : network.allLayers()) {
+        if (layer.second->type == EmbeddingTableDequantize::type_info.name)
+            dequantizeLayers.push_back(layer.second);
+    }
+
+    for (const auto& dequantize : dequantizeLayers) {
+        if (dequantize->insData.size() != 3 || dequantize->outData.size() != 1)
+            THROW_IE_EXCEPTION << "Layer " << dequantize->name << " has incorrect number of input or output edges";
+
+        auto getConstBlob = [&](size_t port) -> Blob::Ptr {
+            auto constLayer = getCreatorLayer(dequantize->insData[port].lock()).lock();
+            if (!constLayer || constLayer->type != "Const" || constLayer->blobs.find("custom") == constLayer->blobs.end())
+                THROW_IE_EXCEPTION << "Layer " << dequantize->name << " has non constant input " << port;
+            return constLayer->blobs["custom"];
+        };
+        auto scales = getConstBlob(1);
+        auto zeroPoints = getConstBlob(2);
+
+        auto table = dequantize->insData[0].lock();
+        auto dequantized = dequantize->outData[0];
+        getInputTo(table).erase(dequantize->name);
+        for (const auto& consumer : getInputTo(dequantized)) {
+            auto embedding = consumer.second;
+            embedding->insData[0] = table;
+            embedding->blobs["table_scales"] = scales;
+            embedding->blobs["table_zero_points"] = zeroPoints;
+            getInputTo(table)[embedding->name] = embedding;
+        }
+
+        // scales and zero points are created by FuseEmbeddingTableDequantization for this layer only
+        for (size_t port = 1; port < dequantize->insData.size(); port++) {
+            auto data = dequantize->insData[port].lock();
+            network.removeLayer(getCreatorLayer(data).lock()->name);
+            network.removeData(data->getName());
+        }
+        network.removeLayer(dequantize->name);
+        network.removeData(dequantized->getName());
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <legacy/cnn_network_impl.hpp>
+
+#include <ngraph/op/op.hpp>
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Per row dequantization of an embedding table: (table - zero_points) * scales.
+ * The operation has no constant folding, so a U8 table is kept quantized until
+ * the dequantization is folded into the embedding layer by FoldEmbeddingTableDequantization
+ */
+class EmbeddingTableDequantize : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"EmbeddingTableDequantize", 0};
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    EmbeddingTableDequantize(const ngraph::Output<ngraph::Node>& table,
+                             const ngraph::Output<ngraph::Node>& scales,
+                             const ngraph::Output<ngraph::Node>& zero_points);
+
+    void validate_and_infer_types() override;
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+};
+
+/**
+ * @brief Replaces Multiply(Subtract(Convert(U8 Constant), zero_points), scales) with per row
+ * zero points and scales by EmbeddingTableDequantize when the result is used only as
+ * an embedding table of EmbeddingBagOffsetsSum, EmbeddingBagPackedSum or EmbeddingSegmentsSum.
+ * Must be executed before the first ConstantFolding pass
+ */
+class FuseEmbeddingTableDequantization : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    FuseEmbeddingTableDequantization();
+};
+
+/**
+ * @brief Connects the quantized tables directly to the embedding layers and moves scales and zero points
+ * to the "table_scales" and "table_zero_points" blobs of the layers, which dequantize rows on the fly
+ */
+void FoldEmbeddingTableDequantization(InferenceEngine::details::CNNNetworkImpl& network);
+
+}  // namespace MKLDNNPlugin
@@ -93,27 +93,41 @@ public:
             }
         }
 
-        size_t work_amount_dst = dstStrides[0] * dst_dims[0];
+        // Trailing dimensions which are not broadcasted form a contiguous block in both tensors,
+        // so the output is filled with block copies instead of element by element
+        size_t inner_dims = dst_dims.size();
+        size_t block_size = 1;
+        while (inner_dims > 0 && src_aligned[inner_dims - 1] == dst_dims[inner_dims - 1] &&
+               srcStrides_aligned[inner_dims - 1] == block_size) {
+            inner_dims--;
+            block_size *= dst_dims[inner_dims];
+        }
+        if (block_size == 0)
+            return OK;
+
+        size_t work_amount_dst = (dstStrides[0] * dst_dims[0]) / block_size;
         const uint8_t *src_data = inputs[BROADCAST_INPUT]->cbuffer().as<const uint8_t *>() +
-                                inputs[BROADCAST_INPUT]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+                                inputs[BROADCAST_INPUT]->getTensorDesc().getBlockingDesc().getOffsetPadding() * data_size;
         uint8_t* dst_data = outputs[0]->cbuffer().as<uint8_t *>() +
-                          outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+                          outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding() * data_size;
+        const size_t block_bytes = block_size * data_size;
 
         parallel_nt(0, [&](const int ithr, const int nthr) {
-            size_t i, src_idx, start = 0, end = 0;
-            SizeVector counters(dst_dims.size(), 0);
+            size_t start = 0, end = 0;
+            SizeVector counters(inner_dims, 0);
             splitter(work_amount_dst, nthr, ithr, start, end);
-            for (int j = dst_dims.size() - 1, i = start; j >= 0; j--) {
+            for (int j = static_cast<int>(inner_dims) - 1, i = start; j >= 0; j--) {
                 counters[j] = i % dst_dims[j];
                 i /= dst_dims[j];
             }
-            for (size_t iwork = start * data_size; iwork < end * data_size; iwork += data_size) {
-                for (i = 0, src_idx = 0; i < dst_dims.size(); ++i)
-                    src_idx += counters[i] ? ((counters[i] % src_aligned[i]) * srcStrides_aligned[i]) : 0;
+            for (size_t iwork = start; iwork < end; iwork++) {
+                size_t src_idx = 0;
+                for (size_t i = 0; i < inner_dims; ++i)
+                    src_idx += (counters[i] % src_aligned[i]) * srcStrides_aligned[i];
 
-                cpu_memcpy(&dst_data[iwork], &src_data[src_idx * data_size], data_size);
+                cpu_memcpy(&dst_data[iwork * block_bytes], &src_data[src_idx * data_size], block_bytes);
 
-                for (int j = dst_dims.size() - 1; j >= 0; j--) {
+                for (int j = static_cast<int>(inner_dims) - 1; j >= 0; j--) {
                     counters[j] = (counters[j] + 1) % dst_dims[j];
                     if (counters[j] != 0) break;
                 }
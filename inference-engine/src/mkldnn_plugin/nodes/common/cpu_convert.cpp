@@ -6,6 +6,7 @@
 #include "cpu_memcpy.h"
 #include <type_traits>
 #include <ie_parallel.hpp>
+#include "ngraph/type/bfloat16.hpp"
 
 using namespace InferenceEngine;
 
@@ -53,6 +54,9 @@ void convertFrom(void *srcPtr, void *dstPtr, Precision dstPrc, const size_t size
         case Precision::BOOL:
             convert<srcType, PrecisionTrait<Precision::BOOL>::value_type>(srcPtr, dstPtr, size);
             break;
+        case Precision::BF16:
+            convert<srcType, ngraph::bfloat16>(srcPtr, dstPtr, size);
+            break;
         default:
             THROW_IE_EXCEPTION << "cpu_convert can't convert to: " << dstPrc << " precision";
     }
@@ -95,6 +99,9 @@ void cpu_convert(void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc,
         case Precision::BOOL:
             convertFrom<PrecisionTrait<Precision::BOOL>::value_type>(srcPtr, dstPtr, dstPrc, size);
             break;
+        case Precision::BF16:
+            convertFrom<ngraph::bfloat16>(srcPtr, dstPtr, dstPrc, size);
+            break;
         default:
             THROW_IE_EXCEPTION << "cpu_convert can't convert from: " << srcPrc << " precision";
     }
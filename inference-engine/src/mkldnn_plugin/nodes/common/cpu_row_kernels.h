@@ -0,0 +1,94 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define CPU_ROW_KERNELS_NEON
+#endif
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Vectorized loops over contiguous FP32 rows for the nodes which have no JIT kernels on the target ISA.
+ * On ARM they are built with NEON intrinsics, as the JIT generator targets x86 only,
+ * other targets get plain loops which the compiler can vectorize.
+ */
+namespace row_kernels {
+
+#ifdef CPU_ROW_KERNELS_NEON
+inline float horizontal_sum(float32x4_t value) {
+#if defined(__aarch64__)
+    return vaddvq_f32(value);
+#else
+    float32x2_t sum = vadd_f32(vget_low_f32(value), vget_high_f32(value));
+    sum = vpadd_f32(sum, sum);
+    return vget_lane_f32(sum, 0);
+#endif
+}
+#endif
+
+/**
+ * @brief Returns the sum of the row elements
+ */
+inline float sum(const float* src, size_t size) {
+    size_t i = 0;
+    float result = 0.f;
+#ifdef CPU_ROW_KERNELS_NEON
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+    for (; i + 8 <= size; i += 8) {
+        acc0 = vaddq_f32(acc0, vld1q_f32(src + i));
+        acc1 = vaddq_f32(acc1, vld1q_f32(src + i + 4));
+    }
+    result = horizontal_sum(vaddq_f32(acc0, acc1));
+#endif
+    for (; i < size; i++)
+        result += src[i];
+    return result;
+}
+
+/**
+ * @brief Returns the sum of squared differences between the row elements and the mean
+ */
+inline float sum_squared_diff(const float* src, size_t size, float mean) {
+    size_t i = 0;
+    float result = 0.f;
+#ifdef CPU_ROW_KERNELS_NEON
+    const float32x4_t vmean = vdupq_n_f32(mean);
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+    for (; i + 8 <= size; i += 8) {
+        float32x4_t diff0 = vsubq_f32(vld1q_f32(src + i), vmean);
+        float32x4_t diff1 = vsubq_f32(vld1q_f32(src + i + 4), vmean);
+        acc0 = vmlaq_f32(acc0, diff0, diff0);
+        acc1 = vmlaq_f32(acc1, diff1, diff1);
+    }
+    result = horizontal_sum(vaddq_f32(acc0, acc1));
+#endif
+    for (; i < size; i++)
+        result += (src[i] - mean) * (src[i] - mean);
+    return result;
+}
+
+/**
+ * @brief Writes (src - shift) * scale for every element of the row, src and dst may be the same row
+ */
+inline void shift_scale(const float* src, float* dst, size_t size, float shift, float scale) {
+    size_t i = 0;
+#ifdef CPU_ROW_KERNELS_NEON
+    const float32x4_t vshift = vdupq_n_f32(shift);
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    for (; i + 4 <= size; i += 4)
+        vst1q_f32(dst + i, vmulq_f32(vsubq_f32(vld1q_f32(src + i), vshift), vscale));
+#endif
+    for (; i < size; i++)
+        dst[i] = (src[i] - shift) * scale;
+}
+
+}  // namespace row_kernels
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,104 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_strided_copy.h"
+#include <cstdint>
+#include "cpu_memcpy.h"
+#include <ie_parallel.hpp>
+
+void cpu_strided_copy(const void *srcPtr, void *dstPtr, const std::vector<size_t> &dims,
+                      const std::vector<ptrdiff_t> &srcStrides, const std::vector<ptrdiff_t> &dstStrides, size_t elemSize) {
+    // Collapse every pair of adjacent dimensions which is contiguous in both views,
+    // unit dimensions are dropped as they don't move any pointer
+    std::vector<size_t> cDims;
+    std::vector<ptrdiff_t> cSrcStrides, cDstStrides;
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i] == 0)
+            return;
+        if (dims[i] == 1)
+            continue;
+        const auto dim = static_cast<ptrdiff_t>(dims[i]);
+        if (!cDims.empty() && cSrcStrides.back() == srcStrides[i] * dim && cDstStrides.back() == dstStrides[i] * dim) {
+            cDims.back() *= dims[i];
+            cSrcStrides.back() = srcStrides[i];
+            cDstStrides.back() = dstStrides[i];
+        } else {
+            cDims.push_back(dims[i]);
+            cSrcStrides.push_back(srcStrides[i]);
+            cDstStrides.push_back(dstStrides[i]);
+        }
+    }
+
+    const auto *src = reinterpret_cast<const uint8_t *>(srcPtr);
+    auto *dst = reinterpret_cast<uint8_t *>(dstPtr);
+    if (cDims.empty()) {
+        cpu_memcpy(dst, src, elemSize);
+        return;
+    }
+
+    // The innermost dimension is processed as a whole by a single thread
+    const size_t outerRank = cDims.size() - 1;
+    const size_t innerSize = cDims[outerRank];
+    const ptrdiff_t innerSrcStride = cSrcStrides[outerRank] * static_cast<ptrdiff_t>(elemSize);
+    const ptrdiff_t innerDstStride = cDstStrides[outerRank] * static_cast<ptrdiff_t>(elemSize);
+    const bool innerIsContiguous = cSrcStrides[outerRank] == 1 && cDstStrides[outerRank] == 1;
+
+    if (outerRank == 0 && innerIsContiguous) {
+        // A single contiguous run, e.g. a slice which takes whole inner dimensions
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(innerSize, nthr, ithr, start, end);
+            if (start < end)
+                cpu_memcpy(dst + start * elemSize, src + start * elemSize, (end - start) * elemSize);
+        });
+        return;
+    }
+
+    size_t workAmount = 1;
+    for (size_t i = 0; i < outerRank; i++)
+        workAmount *= cDims[i];
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<size_t> counters(outerRank, 0);
+        ptrdiff_t srcOff = 0, dstOff = 0;
+        size_t i = start;
+        for (int j = static_cast<int>(outerRank) - 1; j >= 0; j--) {
+            counters[j] = i % cDims[j];
+            i /= cDims[j];
+            srcOff += static_cast<ptrdiff_t>(counters[j]) * cSrcStrides[j];
+            dstOff += static_cast<ptrdiff_t>(counters[j]) * cDstStrides[j];
+        }
+
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            const uint8_t *srcRow = src + srcOff * static_cast<ptrdiff_t>(elemSize);
+            uint8_t *dstRow = dst + dstOff * static_cast<ptrdiff_t>(elemSize);
+            if (innerIsContiguous) {
+                cpu_memcpy(dstRow, srcRow, innerSize * elemSize);
+            } else if (elemSize == sizeof(uint32_t)) {
+                for (size_t k = 0; k < innerSize; k++)
+                    *reinterpret_cast<uint32_t *>(dstRow + k * innerDstStride) =
+                            *reinterpret_cast<const uint32_t *>(srcRow + k * innerSrcStride);
+            } else {
+                for (size_t k = 0; k < innerSize; k++)
+                    cpu_memcpy(dstRow + k * innerDstStride, srcRow + k * innerSrcStride, elemSize);
+            }
+
+            for (int j = static_cast<int>(outerRank) - 1; j >= 0; j--) {
+                counters[j]++;
+                srcOff += cSrcStrides[j];
+                dstOff += cDstStrides[j];
+                if (counters[j] < cDims[j])
+                    break;
+                srcOff -= static_cast<ptrdiff_t>(cDims[j]) * cSrcStrides[j];
+                dstOff -= static_cast<ptrdiff_t>(cDims[j]) * cDstStrides[j];
+                counters[j] = 0;
+            }
+        }
+    });
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Copies a strided view of one buffer into a strided view of another one:
+ * dst[sum(i_k * dstStrides[k])] = src[sum(i_k * srcStrides[k])] for every index (i_0, ..., i_n) within dims.
+ * Dimensions which are contiguous in both views are collapsed, innermost contiguous runs are copied with memcpy
+ * and the outer dimensions are split between threads. The views must not overlap.
+ * @param srcPtr
+ * pointer to the first element of the source view
+ * @param dstPtr
+ * pointer to the first element of the destination view
+ * @param dims
+ * dimensions of the views
+ * @param srcStrides
+ * strides of the source view in elements, may be negative
+ * @param dstStrides
+ * strides of the destination view in elements, may be negative
+ * @param elemSize
+ * size of an element in bytes
+ * @return none.
+ */
+
+void cpu_strided_copy(const void *srcPtr, void *dstPtr, const std::vector<size_t> &dims,
+                      const std::vector<ptrdiff_t> &srcStrides, const std::vector<ptrdiff_t> &dstStrides, size_t elemSize);
@@ -0,0 +1,74 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_yuv_convert.h"
+#include <algorithm>
+#include <ie_parallel.hpp>
+#include <details/ie_exception.hpp>
+
+namespace {
+
+// fixed point ITU-R BT.601 coefficients, the same as in the preprocessing library kernels
+const int ITUR_BT_601_CY = 1220542;
+const int ITUR_BT_601_CUB = 2116026;
+const int ITUR_BT_601_CUG = -409993;
+const int ITUR_BT_601_CVG = -852492;
+const int ITUR_BT_601_CVR = 1673527;
+const int ITUR_BT_601_SHIFT = 20;
+
+inline uint8_t saturate(int value) {
+    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+}
+
+template <typename dst_t>
+void yuv420_to_bgr(const uint8_t *yPtr, size_t yRowStride,
+                   const uint8_t *uPtr, const uint8_t *vPtr, size_t uvRowStride, size_t uvPixelStride,
+                   size_t height, size_t width, dst_t *dst,
+                   const size_t channelOffsets[3], size_t rowStride, size_t pixelStride) {
+    // every task converts two luma rows which share one chroma row
+    InferenceEngine::parallel_for(height / 2, [&](size_t i) {
+        const uint8_t *uRow = uPtr + i * uvRowStride;
+        const uint8_t *vRow = vPtr + i * uvRowStride;
+        for (size_t r = 0; r < 2; r++) {
+            const size_t h = 2 * i + r;
+            const uint8_t *yRow = yPtr + h * yRowStride;
+            dst_t *b = dst + channelOffsets[0] + h * rowStride;
+            dst_t *g = dst + channelOffsets[1] + h * rowStride;
+            dst_t *rd = dst + channelOffsets[2] + h * rowStride;
+            for (size_t w = 0; w < width; w++) {
+                const int uu = static_cast<int>(uRow[(w / 2) * uvPixelStride]) - 128;
+                const int vv = static_cast<int>(vRow[(w / 2) * uvPixelStride]) - 128;
+                const int ruv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVR * vv;
+                const int guv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CVG * vv + ITUR_BT_601_CUG * uu;
+                const int buv = (1 << (ITUR_BT_601_SHIFT - 1)) + ITUR_BT_601_CUB * uu;
+                const int y = std::max(0, static_cast<int>(yRow[w]) - 16) * ITUR_BT_601_CY;
+
+                b[w * pixelStride] = static_cast<dst_t>(saturate((y + buv) >> ITUR_BT_601_SHIFT));
+                g[w * pixelStride] = static_cast<dst_t>(saturate((y + guv) >> ITUR_BT_601_SHIFT));
+                rd[w * pixelStride] = static_cast<dst_t>(saturate((y + ruv) >> ITUR_BT_601_SHIFT));
+            }
+        }
+    });
+}
+
+}  // namespace
+
+void cpu_yuv420_to_bgr(const uint8_t *yPtr, size_t yRowStride,
+                       const uint8_t *uPtr, const uint8_t *vPtr, size_t uvRowStride, size_t uvPixelStride,
+                       size_t height, size_t width,
+                       void *dstPtr, InferenceEngine::Precision dstPrc,
+                       const size_t channelOffsets[3], size_t rowStride, size_t pixelStride) {
+    switch (dstPrc) {
+        case InferenceEngine::Precision::U8:
+            yuv420_to_bgr(yPtr, yRowStride, uPtr, vPtr, uvRowStride, uvPixelStride, height, width,
+                          reinterpret_cast<uint8_t *>(dstPtr), channelOffsets, rowStride, pixelStride);
+            break;
+        case InferenceEngine::Precision::FP32:
+            yuv420_to_bgr(yPtr, yRowStride, uPtr, vPtr, uvRowStride, uvPixelStride, height, width,
+                          reinterpret_cast<float *>(dstPtr), channelOffsets, rowStride, pixelStride);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "cpu_yuv420_to_bgr doesn't support output precision " << dstPrc;
+    }
+}
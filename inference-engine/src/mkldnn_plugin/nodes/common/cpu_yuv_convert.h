@@ -0,0 +1,49 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ie_precision.hpp>
+
+/**
+ * @brief Converts a YUV 4:2:0 image (NV12 or I420) into BGR using the same fixed point ITU-R BT.601
+ * coefficients as the preprocessing library, so the results are bit exact with it.
+ * The output is written through the given element offsets, so any layout in which the offset of a pixel
+ * of a channel is affine in its row and column (planar, interleaved or channel blocked) is filled in place.
+ * @param yPtr
+ * pointer to the first element of the luma plane
+ * @param yRowStride
+ * distance between luma rows in bytes
+ * @param uPtr
+ * pointer to the first U element
+ * @param vPtr
+ * pointer to the first V element
+ * @param uvRowStride
+ * distance between chroma rows in bytes
+ * @param uvPixelStride
+ * distance between neighbouring chroma elements in bytes, 2 for NV12 and 1 for I420
+ * @param height
+ * image height, must be even
+ * @param width
+ * image width, must be even
+ * @param dstPtr
+ * pointer to the output buffer
+ * @param dstPrc
+ * precision of the output buffer, U8 or FP32
+ * @param channelOffsets
+ * offsets in elements of the first pixel of the B, G and R channels
+ * @param rowStride
+ * distance between output rows in elements
+ * @param pixelStride
+ * distance between neighbouring output pixels in elements
+ * @return none.
+ */
+
+void cpu_yuv420_to_bgr(const uint8_t *yPtr, size_t yRowStride,
+                       const uint8_t *uPtr, const uint8_t *vPtr, size_t uvRowStride, size_t uvPixelStride,
+                       size_t height, size_t width,
+                       void *dstPtr, InferenceEngine::Precision dstPrc,
+                       const size_t channelOffsets[3], size_t rowStride, size_t pixelStride);
@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Builds a cache key from the kernel type, the ISA and the fields of a kernel configuration.
+ * Every field is written with a separator, so different configurations never produce the same key.
+ */
+class JitKernelKey {
+public:
+    explicit JitKernelKey(const std::string& kernelName) {
+        key << kernelName;
+    }
+
+    template <typename T>
+    JitKernelKey& operator<<(const T& value) {
+        key << '_' << value;
+        return *this;
+    }
+
+    template <typename T>
+    JitKernelKey& operator<<(const std::vector<T>& values) {
+        key << "_[";
+        for (const auto& value : values)
+            key << value << ',';
+        key << ']';
+        return *this;
+    }
+
+    std::string str() const {
+        return key.str();
+    }
+
+private:
+    std::ostringstream key;
+};
+
+/**
+ * @brief Process wide store of generated JIT kernels of one type
+ * Returns a kernel generated earlier for the same key or generates a new one,
+ * so nodes with the same configuration in different graphs, streams and networks share one copy of the code.
+ * A kernel lives while at least one node holds it.
+ * Kernels must not keep per node state besides their configuration, which is a part of the key.
+ *
+ * Is a thread safe
+ */
+template <typename Kernel>
+class JitKernelCache {
+public:
+    static std::shared_ptr<Kernel> findOrCreate(const std::string& key, const std::function<Kernel*(void)>& create) {
+        static JitKernelCache cache;
+        return cache.findOrCreateImpl(key, create);
+    }
+
+private:
+    std::shared_ptr<Kernel> findOrCreateImpl(const std::string& key, const std::function<Kernel*(void)>& create) {
+        std::lock_guard<std::mutex> lock(guard);
+        auto found = kernels.find(key);
+
+        std::shared_ptr<Kernel> kernel;
+        if (found == kernels.end() || !(kernel = found->second.lock())) {
+            kernel.reset(create());
+            kernels[key] = kernel;
+        }
+        return kernel;
+    }
+
+    std::unordered_map<std::string, std::weak_ptr<Kernel>> kernels;
+    std::mutex guard;
+};
+
+}  // namespace MKLDNNPlugin
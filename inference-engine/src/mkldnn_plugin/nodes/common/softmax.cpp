@@ -5,6 +5,7 @@
 #include <vector>
 #include <algorithm>
 #include <ie_parallel.hpp>
+#include "mkldnn_selective_build.h"
 #include "jit_generator.hpp"
 #include "jit_uni_eltwise.hpp"
 #include "softmax.h"
@@ -162,13 +163,13 @@ private:
 
 SoftmaxGeneric::SoftmaxGeneric() {
     block_size = 1;
-    if (mayiuse(avx512_common)) {
+    if (MKLDNN_ISA(avx512_common)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<avx512_common>());
         block_size = 16;
-    } else if (mayiuse(avx2)) {
+    } else if (MKLDNN_ISA(avx2)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<avx2>());
         block_size = 8;
-    } else if (mayiuse(sse42)) {
+    } else if (MKLDNN_ISA(sse42)) {
         softmax_kernel.reset(new jit_uni_softmax_kernel_f32<sse42>());
         block_size = 4;
     }
@@ -0,0 +1,192 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "base.hpp"
+#include "ie_parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+/**
+ * CTC prefix beam search. Inputs and the output are the same as for CTCGreedyDecoder: [T, N, C] probabilities,
+ * optional [T, N] sequence indicators and [N, T, ...] labels of the most probable sequence padded with -1.
+ */
+class CTCBeamSearchDecoderImpl: public ExtLayerBase {
+public:
+    explicit CTCBeamSearchDecoderImpl(const CNNLayer* layer) {
+        try {
+            if ((layer->insData.size() != 1 && layer->insData.size() != 2) || layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
+
+            const SizeVector& dims = layer->insData[0].lock()->getTensorDesc().getDims();
+            if (dims.size() != 3)
+                THROW_IE_EXCEPTION << "CTCBeamSearchDecoder layer with name '" << layer->name
+                                   << "' supports only 3D probabilities!";
+
+            beamWidth = layer->GetParamAsInt("beam_width", 10);
+            if (beamWidth < 1)
+                THROW_IE_EXCEPTION << "CTCBeamSearchDecoder layer with name '" << layer->name
+                                   << "' has incorrect beam width: " << beamWidth;
+            // the last class is the blank by default as in CTCGreedyDecoder
+            const int classesNum = static_cast<int>(dims[2]);
+            blankIndex = layer->GetParamAsInt("blank_index", -1);
+            if (blankIndex < 0)
+                blankIndex += classesNum;
+            if (blankIndex < 0 || blankIndex >= classesNum)
+                THROW_IE_EXCEPTION << "CTCBeamSearchDecoder layer with name '" << layer->name
+                                   << "' has incorrect blank index: " << layer->GetParamAsInt("blank_index", -1);
+
+            std::vector<DataConfigurator> inps;
+            inps.resize(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
+            addConfig(layer, inps, {DataConfigurator(ConfLayout::PLN)});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        const float* probabilities = inputs[0]->cbuffer().as<const float*>();
+        const float* sequence_indicators = inputs.size() > 1 ? inputs[1]->cbuffer().as<const float*>() : nullptr;
+        float* output_sequences = outputs[0]->buffer();
+
+        const size_t T = inputs[0]->getTensorDesc().getDims()[0];
+        const size_t N = inputs[0]->getTensorDesc().getDims()[1];
+        const int C = static_cast<int>(inputs[0]->getTensorDesc().getDims()[2]);
+
+        parallel_for(N, [&](size_t n) {
+            size_t seqLength = 1;
+            if (sequence_indicators == nullptr) {
+                seqLength = T;
+            } else {
+                while (seqLength < T && sequence_indicators[seqLength * N + n] != 0)
+                    seqLength++;
+            }
+
+            const std::vector<int> best = decode(probabilities + n * C, T == 0 ? 0 : seqLength, N * C, C, blankIndex);
+
+            float* output = output_sequences + n * T;
+            std::fill(output, output + T, -1.f);
+            for (size_t i = 0; i < best.size(); i++)
+                output[i] = static_cast<float>(best[i]);
+        });
+        return OK;
+    }
+
+private:
+    // log probabilities of a prefix which ends with a blank and with a label
+    struct PrefixProbs {
+        float blank = minusInf();
+        float label = minusInf();
+
+        float total() const {
+            return logAdd(blank, label);
+        }
+    };
+
+    static float minusInf() {
+        return -std::numeric_limits<float>::infinity();
+    }
+
+    static float logAdd(float a, float b) {
+        if (a < b)
+            std::swap(a, b);
+        if (b == minusInf())
+            return a;
+        return a + std::log1p(std::exp(b - a));
+    }
+
+    static float logProb(float p) {
+        return p > 0.f ? std::log(p) : minusInf();
+    }
+
+    std::vector<int> decode(const float* probs, size_t seqLength, size_t stepStride, int C, int blank) const {
+        // only the most probable labels of a step are tried to extend prefixes, less probable ones
+        // cannot produce a prefix which is better than beamWidth extensions of the same prefix
+        const int candidatesNum = std::min(beamWidth, C);
+        std::vector<int> classes(C);
+        std::vector<int> candidates;
+        candidates.reserve(candidatesNum);
+
+        std::map<std::vector<int>, PrefixProbs> beams;
+        beams[std::vector<int>()].blank = 0.f;
+        std::map<std::vector<int>, PrefixProbs> nextBeams;
+
+        for (size_t t = 0; t < seqLength; t++, probs += stepStride) {
+            std::iota(classes.begin(), classes.end(), 0);
+            std::partial_sort(classes.begin(), classes.begin() + candidatesNum, classes.end(), [&](int a, int b) {
+                return probs[a] > probs[b] || (probs[a] == probs[b] && a < b);
+            });
+            candidates.clear();
+            for (int i = 0; i < candidatesNum; i++) {
+                if (classes[i] != blank)
+                    candidates.push_back(classes[i]);
+            }
+
+            const float blankProb = logProb(probs[blank]);
+            nextBeams.clear();
+            for (const auto& beam : beams) {
+                const std::vector<int>& prefix = beam.first;
+                const PrefixProbs& prefixProbs = beam.second;
+                const float total = prefixProbs.total();
+                const int last = prefix.empty() ? -1 : prefix.back();
+
+                PrefixProbs& same = nextBeams[prefix];
+                same.blank = logAdd(same.blank, total + blankProb);
+                if (last >= 0)
+                    same.label = logAdd(same.label, prefixProbs.label + logProb(probs[last]));
+
+                for (int c : candidates) {
+                    std::vector<int> extended(prefix);
+                    extended.push_back(c);
+                    // a repeated label extends the prefix only if a blank separates them
+                    const float prob = (c == last ? prefixProbs.blank : total) + logProb(probs[c]);
+                    PrefixProbs& next = nextBeams[extended];
+                    next.label = logAdd(next.label, prob);
+                }
+            }
+
+            std::vector<std::pair<float, const std::vector<int>*>> ranked;
+            ranked.reserve(nextBeams.size());
+            for (const auto& beam : nextBeams)
+                ranked.emplace_back(beam.second.total(), &beam.first);
+            const size_t kept = std::min(ranked.size(), static_cast<size_t>(beamWidth));
+            std::partial_sort(ranked.begin(), ranked.begin() + kept, ranked.end(),
+                              [](const std::pair<float, const std::vector<int>*>& a,
+                                 const std::pair<float, const std::vector<int>*>& b) {
+                return a.first > b.first;
+            });
+
+            beams.clear();
+            for (size_t i = 0; i < kept; i++)
+                beams[*ranked[i].second] = nextBeams[*ranked[i].second];
+        }
+
+        auto best = beams.begin();
+        for (auto beam = beams.begin(); beam != beams.end(); beam++) {
+            if (beam->second.total() > best->second.total())
+                best = beam;
+        }
+        return best->first;
+    }
+
+    int beamWidth = 10;
+    int blankIndex = -1;
+};
+
+REG_FACTORY_FOR(CTCBeamSearchDecoderImpl, CTCBeamSearchDecoder);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
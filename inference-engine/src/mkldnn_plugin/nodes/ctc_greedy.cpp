@@ -3,8 +3,10 @@
 //
 
 #include "base.hpp"
+#include "ctc_greedy_imp.hpp"
+#include "ie_parallel.hpp"
 
-#include <cmath>
+#include <algorithm>
 #include <vector>
 #include <string>
 
@@ -37,50 +39,41 @@ public:
             return GENERAL_ERROR;
         }
         const float* probabilities = inputs[0]->buffer();
-        const float* sequence_indicators = inputs[1]->buffer();
+        const float* sequence_indicators = inputs.size() > 1 ? inputs[1]->cbuffer().as<const float*>() : nullptr;
         float* output_sequences = outputs[0]->buffer();
 
         size_t T_ = inputs[0]->getTensorDesc().getDims()[0];
         size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
         size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
 
-        // Fill output_sequences with -1
-        for (size_t ii = 0; ii < T_*N_; ii++) {
-            output_sequences[ii] = -1;
+        // the first step is always decoded, a sequence ends before the first zero indicator
+        std::vector<int> seq_lengths(N_, static_cast<int>(T_));
+        if (sequence_indicators != nullptr) {
+            for (size_t n = 0; n < N_; ++n) {
+                size_t t = 1;
+                while (t < T_ && sequence_indicators[t * N_ + n] != 0)
+                    t++;
+                seq_lengths[n] = static_cast<int>(t);
+            }
         }
 
-        for (size_t n = 0; n < N_; ++n) {
-            int prev_class_idx = -1;
-            size_t output_index = n*T_;
-
-            for (int t = 0; /* check at end */; ++t) {
-                // get maximum probability and its index
-                int max_class_idx = 0;
+        std::vector<int> classes(T_ * N_);
+        XARCH::ctc_greedy_argmax(probabilities, classes.data(), seq_lengths.data(), T_, N_, C_);
 
-                const float* probs = probabilities + t*C_*N_ + n*C_;
-                float max_prob = probs[0];
-                ++probs;
-
-                for (size_t c = 1; c < C_; ++c, ++probs) {
-                    if (*probs > max_prob) {
-                        max_class_idx = static_cast<int>(c);
-                        max_prob = *probs;
-                    }
-                }
+        parallel_for(N_, [&](size_t n) {
+            float* output = output_sequences + n * T_;
+            std::fill(output, output + T_, -1.f);
 
+            int prev_class_idx = -1;
+            for (int t = 0; t < seq_lengths[n]; ++t) {
+                const int max_class_idx = classes[t * N_ + n];
                 if (max_class_idx < static_cast<int>(C_) - 1 &&
                         max_class_idx != prev_class_idx) {
-                    output_sequences[output_index] = static_cast<float>(max_class_idx);
-                    output_index++;
+                    *output++ = static_cast<float>(max_class_idx);
                 }
-
                 prev_class_idx = max_class_idx;
-
-                if (t + 1 == static_cast<int>(T_) || sequence_indicators[(t + 1)*N_ + n] == 0) {
-                    break;
-                }
             }
-        }
+        });
         return OK;
     }
 };
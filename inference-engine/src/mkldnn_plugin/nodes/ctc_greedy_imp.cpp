@@ -0,0 +1,91 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ctc_greedy_imp.hpp"
+
+#include <ie_parallel.hpp>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+static inline int argmax(const float* probs, int size) {
+    float max_prob = probs[0];
+    int max_idx = 0;
+    int c = 1;
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_AVX512F)
+    const int block_size = 16;
+    typedef __m512 vec_type_f;
+    typedef __mmask16 vmask_type;
+#elif defined(HAVE_AVX2)
+    const int block_size = 8;
+    typedef __m256 vec_type_f;
+    typedef __m256 vmask_type;
+#elif defined(HAVE_SSE42)
+    const int block_size = 4;
+    typedef __m128 vec_type_f;
+    typedef __m128 vmask_type;
+#endif
+    static const float lane_idx[16] = {0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f,
+                                       8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f};
+
+    if (size >= 2 * block_size) {
+        // every lane keeps the first maximum of its classes, indices are exact in fp32 up to 2^24 classes
+        vec_type_f vmax_prob = _mm_uni_loadu_ps(probs);
+        vec_type_f vmax_idx = _mm_uni_loadu_ps(lane_idx);
+        vec_type_f vcur_idx = vmax_idx;
+        const vec_type_f vstep = _mm_uni_set1_ps(static_cast<float>(block_size));
+        for (c = block_size; c <= size - block_size; c += block_size) {
+            vcur_idx = _mm_uni_add_ps(vcur_idx, vstep);
+            vec_type_f vsrc = _mm_uni_loadu_ps(probs + c);
+            vmask_type vmask = _mm_uni_cmpgt_ps(vsrc, vmax_prob);
+            vmax_prob = _mm_uni_blendv_ps(vmax_prob, vsrc, vmask);
+            vmax_idx = _mm_uni_blendv_ps(vmax_idx, vcur_idx, vmask);
+        }
+
+        float lane_prob[block_size];
+        float lane_max_idx[block_size];
+        _mm_uni_storeu_ps(lane_prob, vmax_prob);
+        _mm_uni_storeu_ps(lane_max_idx, vmax_idx);
+        max_prob = lane_prob[0];
+        max_idx = static_cast<int>(lane_max_idx[0]);
+        for (int i = 1; i < block_size; i++) {
+            const int idx = static_cast<int>(lane_max_idx[i]);
+            if (lane_prob[i] > max_prob || (lane_prob[i] == max_prob && idx < max_idx)) {
+                max_prob = lane_prob[i];
+                max_idx = idx;
+            }
+        }
+    }
+#endif
+
+    for (; c < size; c++) {
+        if (probs[c] > max_prob) {
+            max_prob = probs[c];
+            max_idx = c;
+        }
+    }
+    return max_idx;
+}
+
+void ctc_greedy_argmax(const float* probabilities, int* classes, const int* seq_lengths,
+        size_t T, size_t N, size_t C) {
+    parallel_for2d(T, N, [&](size_t t, size_t n) {
+        if (static_cast<int>(t) < seq_lengths[n]) {
+            classes[t * N + n] = argmax(probabilities + (t * N + n) * C, static_cast<int>(C));
+        }
+    });
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
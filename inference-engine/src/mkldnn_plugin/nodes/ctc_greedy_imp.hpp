@@ -0,0 +1,22 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/**
+ * @brief Finds the most probable class of every time step of [T, N, C] probabilities.
+ * Steps beyond the sequence length of a batch item are skipped, their classes are not written.
+ */
+void ctc_greedy_argmax(const float* probabilities, int* classes, const int* seq_lengths,
+        size_t T, size_t N, size_t C);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -5,6 +5,7 @@
 #include "list.hpp"
 #include "base.hpp"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include "ie_parallel.hpp"
@@ -22,6 +23,9 @@ class CumSumImpl: public ExtLayerBase {
     size_t axis = 0;
     std::vector<size_t> shape5d;
 
+    static constexpr size_t lanesBlock = 64;
+    static constexpr size_t minParallelScanLength = 4096;
+
 public:
     explicit CumSumImpl(const CNNLayer* layer) {
         try {
@@ -139,55 +143,83 @@ private:
 
     template <bool reverse, bool exclusive, typename dataType>
     void cumSum(const dataType *input, dataType *output, const size_t &offset) {
-        std::vector<size_t> iterationRange(numOfDims - 1);
-        size_t j = 0;
-        for (size_t i = 0; i < shape5d.size(); i++) {
-            if (i == axis)
-                continue;
-            iterationRange[j++] = shape5d[i];
+        const size_t axisDim = shape5d[axis];
+        size_t outerDim = 1;
+        for (size_t i = 0; i < axis; i++)
+            outerDim *= shape5d[i];
+        const size_t innerDim = offset;
+
+        if (innerDim == 1 && axisDim >= minParallelScanLength &&
+                outerDim < static_cast<size_t>(parallel_get_max_threads())) {
+            for (size_t o = 0; o < outerDim; o++)
+                parallelScan<reverse, exclusive>(input + o * axisDim, output + o * axisDim, axisDim);
+            return;
         }
-        parallel_for4d(iterationRange[0], iterationRange[1], iterationRange[2], iterationRange[3], [&](size_t ir0, size_t ir1, size_t ir2, size_t ir3) {
-            std::vector<size_t> forStartOffset;
-            forStartOffset.push_back(ir0); forStartOffset.push_back(ir1); forStartOffset.push_back(ir2); forStartOffset.push_back(ir3);
-            forStartOffset.insert(forStartOffset.begin() + axis, 0);
-            size_t startOffset = getStartOffset(forStartOffset);
 
-            const dataType *inputStart = input + startOffset;
-            dataType *outputStart = output + startOffset;
+        // Every task scans a block of neighbouring lanes, so each step along the axis
+        // reads and writes a contiguous row of the block
+        const size_t blocksNum = (innerDim + lanesBlock - 1) / lanesBlock;
+        parallel_for2d(outerDim, blocksNum, [&](size_t o, size_t ib) {
+            const size_t start = ib * lanesBlock;
+            const size_t lanes = innerDim - start < lanesBlock ? innerDim - start : lanesBlock;
+            const dataType *inputStart = input + o * axisDim * innerDim + start;
+            dataType *outputStart = output + o * axisDim * innerDim + start;
 
-            if (reverse) {
-                if (exclusive) {
-                    outputStart[offset*(shape5d[axis] - 1)] = 0;
-                    for (int64_t i = shape5d[axis] - 2; i >= 0; i--) {
-                        outputStart[i*offset] = inputStart[(i+1)*offset] + outputStart[(i+1)*offset];
-                    }
-                } else {
-                    outputStart[offset*(shape5d[axis] - 1)] = inputStart[offset*(shape5d[axis] - 1)];
-                    for (int64_t i = shape5d[axis] - 2; i >= 0; i--) {
-                        outputStart[i*offset] = inputStart[i*offset] + outputStart[(i+1)*offset];
+            dataType acc[lanesBlock];
+            std::fill(acc, acc + lanes, static_cast<dataType>(0));
+            for (size_t p = 0; p < axisDim; p++) {
+                const size_t rowOffset = (reverse ? axisDim - 1 - p : p) * innerDim;
+                for (size_t l = 0; l < lanes; l++) {
+                    const dataType value = inputStart[rowOffset + l];
+                    if (exclusive) {
+                        outputStart[rowOffset + l] = acc[l];
+                        acc[l] += value;
+                    } else {
+                        acc[l] += value;
+                        outputStart[rowOffset + l] = acc[l];
                     }
                 }
-            } else {
+            }
+        });
+    }
+
+    // Scan of a single long contiguous axis: every thread sums its chunk, the chunk totals are scanned
+    // serially and then every thread scans its chunk again starting from the total of the previous chunks
+    template <bool reverse, bool exclusive, typename dataType>
+    void parallelScan(const dataType *input, dataType *output, const size_t len) {
+        const int nthr = parallel_get_max_threads();
+        std::vector<dataType> chunkStart(nthr + 1, static_cast<dataType>(0));
+
+        parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(len, nthr, ithr, start, end);
+            dataType sum = 0;
+            for (size_t p = start; p < end; p++)
+                sum += input[reverse ? len - 1 - p : p];
+            chunkStart[ithr + 1] = sum;
+        });
+
+        for (int i = 1; i <= nthr; i++)
+            chunkStart[i] += chunkStart[i - 1];
+
+        parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(len, nthr, ithr, start, end);
+            dataType acc = chunkStart[ithr];
+            for (size_t p = start; p < end; p++) {
+                const size_t i = reverse ? len - 1 - p : p;
+                const dataType value = input[i];
                 if (exclusive) {
-                    outputStart[0] = 0;
-                    for (size_t i = 1; i < shape5d[axis]; i++) {
-                        outputStart[i*offset] = inputStart[(i-1)*offset] + outputStart[(i-1)*offset];
-                    }
+                    output[i] = acc;
+                    acc += value;
                 } else {
-                    outputStart[0] = inputStart[0];
-                    for (size_t i = 1; i < shape5d[axis]; i++) {
-                        outputStart[i*offset] = inputStart[i*offset] + outputStart[(i-1)*offset];
-                    }
+                    acc += value;
+                    output[i] = acc;
                 }
             }
         });
     }
 
-    size_t getStartOffset(std::vector<size_t> &forStartOffset) {
-        return forStartOffset[N]*shape5d[C]*shape5d[D]*shape5d[H]*shape5d[W] + forStartOffset[C]*shape5d[D]*shape5d[H]*shape5d[W] +
-               forStartOffset[D]*shape5d[H]*shape5d[W] + forStartOffset[H]*shape5d[W] + forStartOffset[W];
-    }
-
     size_t getAxis(const Blob::CPtr& _axis, const Blob::CPtr& _data) {
         const auto& axisPrecision = _axis->getTensorDesc().getPrecision();
         const int64_t dataShapeSize = static_cast<int64_t>(_data->getTensorDesc().getDims().size());
@@ -11,6 +11,9 @@
 #include <utility>
 #include <algorithm>
 #include "ie_parallel.hpp"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -112,6 +115,8 @@ public:
             _num_priors_actual = InferenceEngine::make_shared_blob<int>({Precision::I32, num_priors_actual_size, C});
             _num_priors_actual->allocate();
 
+            _decode_mask.resize(static_cast<size_t>(_num) * _num_priors);
+
             std::vector<DataConfigurator> in_data_conf(layer->insData.size(), DataConfigurator(ConfLayout::PLN));
             addConfig(layer, in_data_conf, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
@@ -139,6 +144,27 @@ public:
         int *indices_data          = _indices->buffer().as<int *>();
         int *num_priors_actual     = _num_priors_actual->buffer().as<int *>();
 
+        // Confidences are reordered first, so the boxes are decoded only for priors which have
+        // at least one confidence passing the threshold (Caffe style NMS uses only such priors)
+        const bool decode_candidates_only = !_decrease_label_id && _share_location;
+        parallel_for2d(N, _num_priors, [&](int n, int p) {
+            const float *pconf = conf_data + n*_num_priors*_num_classes + p*_num_classes;
+            float *preordered = reordered_conf_data + n*_num_priors*_num_classes + p;
+            bool is_candidate = false;
+            if (with_add_box_pred && arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
+                for (int c = 0; c < _num_classes; ++c) {
+                    preordered[c*_num_priors] = c == _background_label_id ? 1.0f : 0.0f;
+                    is_candidate |= c != _background_label_id && preordered[c*_num_priors] > _confidence_threshold;
+                }
+            } else {
+                for (int c = 0; c < _num_classes; ++c) {
+                    preordered[c*_num_priors] = pconf[c];
+                    is_candidate |= c != _background_label_id && pconf[c] > _confidence_threshold;
+                }
+            }
+            _decode_mask[n*_num_priors + p] = !decode_candidates_only || is_candidate;
+        });
+
         for (int n = 0; n < N; ++n) {
             const float *ppriors = prior_data;
             const float *prior_variances = prior_data + _num_priors*_prior_size;
@@ -152,12 +178,14 @@ public:
                 float *pboxes = decoded_bboxes_data + n*4*_num_priors;
                 float *psizes = bbox_sizes_data + n*_num_priors;
 
+                const char *pmask = &_decode_mask[n*_num_priors];
+
                 if (with_add_box_pred) {
                     const float *p_arm_loc = arm_loc_data + n*4*_num_priors;
-                    decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
-                    decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, 0, 4, false);
+                    decodeBBoxes(ppriors, p_arm_loc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size, true, pmask);
+                    decodeBBoxes(pboxes, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, 0, 4, false, pmask);
                 } else {
-                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size);
+                    decodeBBoxes(ppriors, ploc, prior_variances, pboxes, psizes, num_priors_actual, n, _offset, _prior_size, true, pmask);
                 }
             } else {
                 for (int c = 0; c < _num_loc_classes; ++c) {
@@ -178,30 +206,6 @@ public:
             }
         }
 
-        if (with_add_box_pred) {
-            for (int n = 0; n < N; ++n) {
-                for (int p = 0; p < _num_priors; ++p) {
-                    if (arm_conf_data[n*_num_priors*2 + p * 2 + 1] < _objectness_score) {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = c == _background_label_id ? 1.0f : 0.0f;
-                        }
-                    } else {
-                        for (int c = 0; c < _num_classes; ++c) {
-                            reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                        }
-                    }
-                }
-            }
-        } else {
-            for (int n = 0; n < N; ++n) {
-                for (int c = 0; c < _num_classes; ++c) {
-                    for (int p = 0; p < _num_priors; ++p) {
-                        reordered_conf_data[n*_num_priors*_num_classes + c*_num_priors + p] = conf_data[n*_num_priors*_num_classes + p*_num_classes + c];
-                    }
-                }
-            }
-        }
-
         memset(detections_data, 0, N*_num_classes*sizeof(int));
 
         for (int n = 0; n < N; ++n) {
@@ -382,11 +386,45 @@ private:
 
     void decodeBBoxes(const float *prior_data, const float *loc_data, const float *variance_data,
                       float *decoded_bboxes, float *decoded_bbox_sizes, int* num_priors_actual, int n, const int& offs, const int& pr_size,
-                      bool decodeType = true); // after ARM = false
+                      bool decodeType = true, // after ARM = false
+                      const char *decode_mask = nullptr);  // decodes only priors with non-zero mask values
 
     void nms_cf(const float *conf_data, const float *bboxes, const float *sizes,
                 int *buffer, int *indices, int &detections, int num_priors_actual);
 
+#if defined(HAVE_AVX512F)
+    const int block_size = 16;
+    typedef __m512 vec_type_f;
+    typedef __mmask16 vmask_type;
+#elif defined(HAVE_AVX2)
+    const int block_size = 8;
+    typedef __m256 vec_type_f;
+    typedef __m256 vmask_type;
+#elif defined(HAVE_SSE)
+    const int block_size = 4;
+    typedef __m128 vec_type_f;
+    typedef __m128 vmask_type;
+#endif
+
+    // Kept boxes of a class stored as structure of arrays to check overlaps of a box with several kept boxes at once
+    struct keptBoxes {
+        std::vector<float> xmin, ymin, xmax, ymax, size;
+        int count = 0;
+
+        explicit keptBoxes(size_t capacity) : xmin(capacity), ymin(capacity), xmax(capacity), ymax(capacity), size(capacity) {}
+
+        void push(const float *bboxes, const float *sizes, int idx) {
+            xmin[count] = bboxes[idx*4 + 0];
+            ymin[count] = bboxes[idx*4 + 1];
+            xmax[count] = bboxes[idx*4 + 2];
+            ymax[count] = bboxes[idx*4 + 3];
+            size[count] = sizes[idx];
+            count++;
+        }
+    };
+
+    bool isOverlapped(const float *bboxes, const float *sizes, int idx, const keptBoxes &kept);
+
     void nms_mx(const float *conf_data, const float *bboxes, const float *sizes,
                 int *buffer, int *indices, int *detections, int num_priors_actual);
 
@@ -397,6 +435,7 @@ private:
     InferenceEngine::Blob::Ptr _reordered_conf;
     InferenceEngine::Blob::Ptr _bbox_sizes;
     InferenceEngine::Blob::Ptr _num_priors_actual;
+    std::vector<char> _decode_mask;
 };
 
 struct ConfidenceComparator {
@@ -457,7 +496,8 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
                                        int n,
                                        const int& offs,
                                        const int& pr_size,
-                                       bool decodeType) {
+                                       bool decodeType,
+                                       const char *decode_mask) {
     num_priors_actual[n] = _num_priors;
     if (!_normalized && decodeType) {
         int num = 0;
@@ -470,6 +510,9 @@ void DetectionOutputImpl::decodeBBoxes(const float *prior_data,
         }
     }
     parallel_for(num_priors_actual[n], [&](int p) {
+        if (decode_mask && !decode_mask[p])
+            return;
+
         float new_xmin = 0.0f;
         float new_ymin = 0.0f;
         float new_xmax = 0.0f;
@@ -571,25 +614,61 @@ void DetectionOutputImpl::nms_cf(const float* conf_data,
                            buffer, buffer + num_output_scores,
                            ConfidenceComparator(conf_data));
 
+    keptBoxes kept(num_output_scores);
     for (int i = 0; i < num_output_scores; ++i) {
         const int idx = buffer[i];
 
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int kept_idx = indices[k];
-            float overlap = JaccardOverlap(bboxes, sizes, idx, kept_idx);
-            if (overlap > _nms_threshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
+        if (!isOverlapped(bboxes, sizes, idx, kept)) {
+            kept.push(bboxes, sizes, idx);
             indices[detections] = idx;
             detections++;
         }
     }
 }
 
+// Vector version of JaccardOverlap checks: non-overlapping boxes get zero intersection area
+bool DetectionOutputImpl::isOverlapped(const float *bboxes, const float *sizes, int idx, const keptBoxes &kept) {
+    const float xmin = bboxes[idx*4 + 0];
+    const float ymin = bboxes[idx*4 + 1];
+    const float xmax = bboxes[idx*4 + 2];
+    const float ymax = bboxes[idx*4 + 3];
+    const float size = sizes[idx];
+
+    int k = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type_f vxmin = _mm_uni_set1_ps(xmin), vymin = _mm_uni_set1_ps(ymin);
+    const vec_type_f vxmax = _mm_uni_set1_ps(xmax), vymax = _mm_uni_set1_ps(ymax);
+    const vec_type_f vsize = _mm_uni_set1_ps(size), vthreshold = _mm_uni_set1_ps(_nms_threshold);
+    const vec_type_f vzero = _mm_uni_setzero_ps();
+    for (; k + block_size <= kept.count; k += block_size) {
+        vec_type_f vwidth = _mm_uni_sub_ps(_mm_uni_min_ps(vxmax, _mm_uni_loadu_ps(&kept.xmax[k])),
+                                           _mm_uni_max_ps(vxmin, _mm_uni_loadu_ps(&kept.xmin[k])));
+        vec_type_f vheight = _mm_uni_sub_ps(_mm_uni_min_ps(vymax, _mm_uni_loadu_ps(&kept.ymax[k])),
+                                            _mm_uni_max_ps(vymin, _mm_uni_loadu_ps(&kept.ymin[k])));
+        vec_type_f vintersect = _mm_uni_mul_ps(_mm_uni_max_ps(vwidth, vzero), _mm_uni_max_ps(vheight, vzero));
+        vec_type_f vunion = _mm_uni_sub_ps(_mm_uni_add_ps(vsize, _mm_uni_loadu_ps(&kept.size[k])), vintersect);
+        vmask_type vmask = _mm_uni_cmpgt_ps(_mm_uni_div_ps(vintersect, vunion), vthreshold);
+#if defined(HAVE_AVX512F)
+        if (vmask)
+            return true;
+#else
+        if (_mm_uni_movemask_ps(vmask))
+            return true;
+#endif
+    }
+#endif
+    for (; k < kept.count; ++k) {
+        const float intersect_width  = (std::min)(xmax, kept.xmax[k]) - (std::max)(xmin, kept.xmin[k]);
+        const float intersect_height = (std::min)(ymax, kept.ymax[k]) - (std::max)(ymin, kept.ymin[k]);
+        if (intersect_width <= 0 || intersect_height <= 0)
+            continue;
+        const float intersect_size = intersect_width * intersect_height;
+        if (intersect_size / (size + kept.size[k] - intersect_size) > _nms_threshold)
+            return true;
+    }
+    return false;
+}
+
 void DetectionOutputImpl::nms_mx(const float* conf_data,
                           const float* bboxes,
                           const float* sizes,
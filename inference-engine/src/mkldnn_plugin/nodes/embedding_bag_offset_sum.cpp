@@ -5,6 +5,8 @@
 #include "embedding_bag_sum.hpp"
 #include "ie_parallel.hpp"
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 
@@ -38,16 +40,18 @@ public:
                 ResponseDesc* resp) noexcept override {
         switch (inputs[0]->getTensorDesc().getPrecision()) {
             case Precision::FP32: {
-                return processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
+                return processData<PrecisionTrait<Precision::FP32>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
             }
             case Precision::I8: {
-                return processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs, resp);
+                return processData<PrecisionTrait<Precision::I8>::value_type, PrecisionTrait<Precision::I8>::value_type>(inputs, outputs, resp);
             }
             case Precision::U8: {
-                return processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs, resp);
+                if (_tableScales.empty())
+                    return processData<PrecisionTrait<Precision::U8>::value_type, PrecisionTrait<Precision::U8>::value_type>(inputs, outputs, resp);
+                return processData<PrecisionTrait<Precision::U8>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs, resp);
             }
             case Precision::I32: {
-                return processData<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
+                return processData<PrecisionTrait<Precision::I32>::value_type, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
             }
             default: {
                 if (resp) {
@@ -61,20 +65,20 @@ public:
     }
 
 protected:
-    template<typename T>
+    template<typename T, typename D>
     StatusCode processData(
                 std::vector<Blob::Ptr>& inputs,
                 std::vector<Blob::Ptr>& outputs,
                 ResponseDesc* resp) noexcept {
         switch (inputs[1]->getTensorDesc().getPrecision()) {
             case Precision::I32: {
-                return processData<T, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
+                return processData<T, D, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs, resp);
             }
             case Precision::I64: {
-                return processData<T, PrecisionTrait<Precision::I64>::value_type>(inputs, outputs, resp);
+                return processData<T, D, PrecisionTrait<Precision::I64>::value_type>(inputs, outputs, resp);
             }
             case Precision::U64: {
-                return processData<T, PrecisionTrait<Precision::U64>::value_type>(inputs, outputs, resp);
+                return processData<T, D, PrecisionTrait<Precision::U64>::value_type>(inputs, outputs, resp);
             }
             default: {
                 if (resp) {
@@ -87,7 +91,7 @@ protected:
         }
     }
 
-    template<typename T, typename I>
+    template<typename T, typename D, typename I>
     StatusCode processData(
                 std::vector<Blob::Ptr>& inputs,
                 std::vector<Blob::Ptr>& outputs,
@@ -97,7 +101,7 @@ protected:
 
         const T* srcData = inputs[0]->cbuffer().as<const T*>() +
             inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        T* dstData = outputs[0]->buffer().as<T*>() +
+        D* dstData = outputs[0]->buffer().as<D*>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
 
         const I* indicesData = inputs[INDICES_IDX]->cbuffer().as<const I*>();
@@ -112,9 +116,9 @@ protected:
                 return GENERAL_ERROR;
             }
         }
-        const T* weightsData = nullptr;
+        const D* weightsData = nullptr;
         if (_withWeights)
-            weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
+            weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const D*>();
 
         const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
 
@@ -157,9 +161,11 @@ protected:
                 weightsIdx = offsetsData[embIndex];
         };
 
+        const size_t depthBlocksNum = getDepthBlocksNum(OUTPUT_BAGS_NUM);
+
         auto threadBody = [&](const int ithr, const int nthr) {
             size_t start(0lu), end(0lu);
-            splitter(OUTPUT_BAGS_NUM, nthr, ithr, start, end);
+            splitter(OUTPUT_BAGS_NUM * depthBlocksNum, nthr, ithr, start, end);
             if (start >= end)
                 return;
 
@@ -168,52 +174,26 @@ protected:
             size_t weightsIdx = 0lu;
             bool withWeights = _withWeights;
 
-            for (size_t obi = start; obi < end; obi++) {
-                size_t dstIndex = obi * _embDepth;
+            for (size_t iwork = start; iwork < end; iwork++) {
+                const size_t obi = iwork / depthBlocksNum;
+                size_t depthStart(0lu), depthEnd(0lu);
+                splitter(_embDepth, depthBlocksNum, iwork % depthBlocksNum, depthStart, depthEnd);
+
+                D* dst = dstData + obi * _embDepth + depthStart;
                 get_idx(obi, indices, indicesSize, weightsIdx, withWeights);
                 if (indices != nullptr) {
                     withWeights = withWeights & _withWeights;
 
-                    size_t inIdx = 0lu;
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                        return;
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] = srcData[srcIndex + i];
-                        }
-                    }
-
-                    for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
+                    for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
                         if (indices[inIdx] >= inDataDims[0]) {
                             errorMsg = msgPrefix + "has invalid embedding bag index: " + std::to_string(indices[inIdx]);
                             return;
                         }
-                        size_t srcIndex = indices[inIdx] * _embDepth;
-
-                        if (withWeights) {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                            }
-                            weightsIdx++;
-                        } else {
-                            for (size_t i = 0lu; i < _embDepth; i++) {
-                                dstData[dstIndex + i] += srcData[srcIndex + i];
-                            }
-                        }
                     }
+                    sumBag(srcData, indices, indicesSize, withWeights ? weightsData + weightsIdx : nullptr,
+                           dst, depthStart, depthEnd);
                 } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = 0;
-                    }
+                    std::fill(dst, dst + (depthEnd - depthStart), static_cast<D>(0));
                 }
             }
         };
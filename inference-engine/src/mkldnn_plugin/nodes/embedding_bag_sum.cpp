@@ -7,6 +7,7 @@
 #include "jit_generator.hpp"
 #include "list.hpp"
 
+#include <algorithm>
 #include <set>
 #include <string>
 #include <vector>
@@ -41,6 +42,25 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
         auto dataPrecision = inData->getTensorDesc().getPrecision();
         if (dataPrecision == Precision::BF16)
             dataPrecision = Precision::FP32;
+        auto outPrecision = dataPrecision;
+
+        // The table is quantized per row, dequantization is folded into the layer by the plugin
+        auto scales = layer->blobs.find("table_scales");
+        auto zeroPoints = layer->blobs.find("table_zero_points");
+        if (scales != layer->blobs.end() && zeroPoints != layer->blobs.end()) {
+            const size_t rows = inData->getTensorDesc().getDims()[0];
+            if (dataPrecision != Precision::U8)
+                THROW_IE_EXCEPTION << logPrefix << "supports dequantization of U8 embedding tables only";
+            if (scales->second->size() != rows || zeroPoints->second->size() != rows ||
+                    scales->second->getTensorDesc().getPrecision() != Precision::FP32 ||
+                    zeroPoints->second->getTensorDesc().getPrecision() != Precision::FP32)
+                THROW_IE_EXCEPTION << logPrefix << "has incorrect embedding table scales or zero points";
+            const float* scalesData = scales->second->cbuffer().as<const float*>();
+            const float* zeroPointsData = zeroPoints->second->cbuffer().as<const float*>();
+            _tableScales.assign(scalesData, scalesData + rows);
+            _tableZeroPoints.assign(zeroPointsData, zeroPointsData + rows);
+            outPrecision = Precision::FP32;
+        }
         if (!supportedPrecisions.empty()) {
             if (supportedPrecisions.find(dataPrecision) == supportedPrecisions.end())
                 THROW_IE_EXCEPTION << logPrefix << "has unsupported precision: " << dataPrecision.name();
@@ -77,7 +97,7 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
 
         DataConfig outConfig;
         auto& outDims = layer->outData[0]->getTensorDesc().getDims();
-        outConfig.desc = TensorDesc(dataPrecision,
+        outConfig.desc = TensorDesc(outPrecision,
             outDims,
             TensorDesc::getLayoutByDims(outDims));
         config.outConfs.push_back(outConfig);
@@ -95,25 +115,35 @@ MKLDNNEmbeddingBagSum::MKLDNNEmbeddingBagSum(
     }
 }
 
+size_t MKLDNNEmbeddingBagSum::getDepthBlocksNum(size_t bagsNum) const {
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    if (bagsNum == 0lu || bagsNum >= nthr || _embDepth < 2lu * _minDepthBlock)
+        return 1lu;
+    return std::min((nthr + bagsNum - 1lu) / bagsNum, _embDepth / _minDepthBlock);
+}
+
 StatusCode MKLDNNEmbeddingBagSum::execute(
             std::vector<Blob::Ptr>& inputs,
             std::vector<Blob::Ptr>& outputs,
             ResponseDesc *resp) noexcept {
     switch (inputs[0]->getTensorDesc().getPrecision()) {
         case Precision::FP32: {
-            processData<PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
+            processData<PrecisionTrait<Precision::FP32>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
             break;
         }
         case Precision::I8: {
-            processData<PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
+            processData<PrecisionTrait<Precision::I8>::value_type, PrecisionTrait<Precision::I8>::value_type>(inputs, outputs);
             break;
         }
         case Precision::U8: {
-            processData<PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
+            if (_tableScales.empty())
+                processData<PrecisionTrait<Precision::U8>::value_type, PrecisionTrait<Precision::U8>::value_type>(inputs, outputs);
+            else
+                processData<PrecisionTrait<Precision::U8>::value_type, PrecisionTrait<Precision::FP32>::value_type>(inputs, outputs);
             break;
         }
         case Precision::I32: {
-            processData<PrecisionTrait<Precision::I32>::value_type>(inputs, outputs);
+            processData<PrecisionTrait<Precision::I32>::value_type, PrecisionTrait<Precision::I32>::value_type>(inputs, outputs);
             break;
         }
         default: {
@@ -129,26 +159,27 @@ StatusCode MKLDNNEmbeddingBagSum::execute(
     return OK;
 }
 
-template<typename T>
+template<typename T, typename D>
 void MKLDNNEmbeddingBagSum::processData(
             std::vector<Blob::Ptr>& inputs,
             std::vector<Blob::Ptr>& outputs) noexcept {
     const T* srcData = inputs[0]->cbuffer().as<const T*>() +
         inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    T* dstData = outputs[0]->buffer().as<T*>() +
+    D* dstData = outputs[0]->buffer().as<D*>() +
         outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-    const T* weightsData = nullptr;
+    const D* weightsData = nullptr;
     if (_withWeights)
-        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const T*>();
+        weightsData = inputs[PER_SAMPLE_WEIGHTS_IDX]->cbuffer().as<const D*>();
     initFromInputs(inputs);
 
     const auto& inDataDims = inputs[0]->getTensorDesc().getDims();
 
     const size_t outputBagsNum = outputs[0]->getTensorDesc().getDims()[0];
+    const size_t depthBlocksNum = getDepthBlocksNum(outputBagsNum);
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitter(outputBagsNum * depthBlocksNum, nthr, ithr, start, end);
         if (start >= end)
             return;
 
@@ -157,51 +188,26 @@ void MKLDNNEmbeddingBagSum::processData(
         size_t weightsIdx = 0lu;
         bool withWeights = _withWeights;
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
+        for (size_t iwork = start; iwork < end; iwork++) {
+            const size_t obi = iwork / depthBlocksNum;
+            size_t depthStart(0lu), depthEnd(0lu);
+            splitter(_embDepth, depthBlocksNum, iwork % depthBlocksNum, depthStart, depthEnd);
+
+            D* dst = dstData + obi * _embDepth + depthStart;
             getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
 
             if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
 
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0])
-                    THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
-                        << "' has invalid embedding bag index: " << indices[inIdx];
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
                     if (indices[inIdx] >= inDataDims[0])
                         THROW_IE_EXCEPTION << "EmbeddingBagSum layer '" << _layerName
                             << "' has invalid embedding bag index: " << indices[inIdx];
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
                 }
+                sumBag(srcData, indices, indicesSize, withWeights ? weightsData + weightsIdx : nullptr,
+                       dst, depthStart, depthEnd);
             } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
+                std::fill(dst, dst + (depthEnd - depthStart), static_cast<D>(0));
             }
         }
     };
@@ -5,7 +5,11 @@
 #pragma once
 
 #include "base.hpp"
+#include "ie_parallel.hpp"
 
+#include <xmmintrin.h>
+
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <vector>
@@ -38,9 +42,19 @@ protected:
         size_t& weightsIdx,
         bool& withWeights) = 0;
 
-    template<typename T>
+    template<typename T, typename D>
     void processData(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs) noexcept;
 
+    // Number of parts each bag is split to along the embedding depth,
+    // so that a few long bags are still processed by all threads
+    size_t getDepthBlocksNum(size_t bagsNum) const;
+
+    // Sums [begin, end) elements of the embedding table rows of one bag to dst, rows of a quantized table
+    // are dequantized on the fly. All indices must be valid, weights may be nullptr
+    template<typename T, typename D, typename I>
+    void sumBag(const T* srcData, const I* indices, size_t indicesSize, const D* weights,
+                D* dst, size_t begin, size_t end) const;
+
     std::set<Precision> _supportedPrecisions;
 
     const size_t INDICES_IDX;
@@ -49,6 +63,9 @@ protected:
 
     bool _withWeights = false;
     size_t _embDepth = 0;
+    // Per row dequantization parameters of a U8 embedding table, empty for not quantized tables
+    std::vector<float> _tableScales;
+    std::vector<float> _tableZeroPoints;
     std::string _layerName;
 
     using INT32 = PrecisionTrait<Precision::I32>::value_type;
@@ -56,8 +73,53 @@ protected:
     using UINT64 = PrecisionTrait<Precision::U64>::value_type;
 
     static const std::set<size_t> _supportedIndicesTypeSize;
+    static constexpr size_t _minDepthBlock = 64lu;
 };
 
+template<typename T, typename D, typename I>
+void MKLDNNEmbeddingBagSum::sumBag(const T* srcData, const I* indices, size_t indicesSize, const D* weights,
+                                   D* dst, size_t begin, size_t end) const {
+    const size_t len = end - begin;
+    for (size_t k = 0lu; k < indicesSize; k++) {
+        // The rows are spread over the whole table, so the next one is requested while the current one is summed
+        if (k + 1lu < indicesSize) {
+            const char* next = reinterpret_cast<const char*>(srcData + indices[k + 1lu] * _embDepth + begin);
+            for (size_t offset = 0lu; offset < len * sizeof(T); offset += 64lu)
+                _mm_prefetch(next + offset, _MM_HINT_T0);
+        }
+
+        const T* src = srcData + indices[k] * _embDepth + begin;
+        if (!_tableScales.empty()) {
+            // (q - zero_point) * scale * weight is computed as q * scale' + shift'
+            const D scale = static_cast<D>(_tableScales[indices[k]]) * (weights != nullptr ? weights[k] : static_cast<D>(1));
+            const D shift = -static_cast<D>(_tableZeroPoints[indices[k]]) * scale;
+            if (k == 0lu) {
+                for (size_t i = 0lu; i < len; i++)
+                    dst[i] = static_cast<D>(src[i]) * scale + shift;
+            } else {
+                for (size_t i = 0lu; i < len; i++)
+                    dst[i] += static_cast<D>(src[i]) * scale + shift;
+            }
+        } else if (weights != nullptr) {
+            const D weight = weights[k];
+            if (k == 0lu) {
+                for (size_t i = 0lu; i < len; i++)
+                    dst[i] = src[i] * weight;
+            } else {
+                for (size_t i = 0lu; i < len; i++)
+                    dst[i] += src[i] * weight;
+            }
+        } else {
+            if (k == 0lu) {
+                std::copy_n(src, len, dst);
+            } else {
+                for (size_t i = 0lu; i < len; i++)
+                    dst[i] += src[i];
+            }
+        }
+    }
+}
+
 }  // namespace Cpu
 }  // namespace Extensions
 }  // namespace InferenceEngine
@@ -75,6 +75,16 @@ public:
             }
         }
 
+        // Segment ids are sorted, so each segment is a contiguous range of indices
+        _segmentOffsets.assign(_numSegments + 1lu, 0lu);
+        for (size_t si = 0lu; si < _segmentIds.size(); si++) {
+            if (_segmentIds[si] < _numSegments)
+                _segmentOffsets[_segmentIds[si] + 1lu]++;
+        }
+        for (size_t s = 0lu; s < _numSegments; s++) {
+            _segmentOffsets[s + 1lu] += _segmentOffsets[s];
+        }
+
         // Initialize default index
         _defaultIndices.clear();
         if (inputs.size() > DEFAULT_INDEX_IDX) {
@@ -93,17 +103,12 @@ public:
             THROW_IE_EXCEPTION << "Invalid embedding bag index.";
 
         indices = nullptr;
-        size = 0lu;
+        size = _segmentOffsets[embIndex + 1lu] - _segmentOffsets[embIndex];
         withWeight = true;
 
-        for (size_t si = 0; si < _indices.size(); si++) {
-            if (_segmentIds[si] == embIndex) {
-                size++;
-                if (indices == nullptr) {
-                    indices = _indices.data() + si;
-                    weightsIdx = si;
-                }
-            }
+        if (size != 0lu) {
+            indices = _indices.data() + _segmentOffsets[embIndex];
+            weightsIdx = _segmentOffsets[embIndex];
         }
 
         // Empty bag
@@ -124,6 +129,7 @@ protected:
 
     std::vector<size_t> _indices;
     std::vector<size_t> _segmentIds;
+    std::vector<size_t> _segmentOffsets;
     std::vector<size_t> _defaultIndices;
 };
 
@@ -118,22 +118,19 @@ private:
         uint8_t *dst_data = output->cbuffer().as<uint8_t*>() + output->getTensorDesc().getBlockingDesc().getOffsetPadding();
         size_t len = dataLength * dictionary->getTensorDesc().getPrecision().size();
 
-        parallel_for(src_indexSize, [&](size_t i) {
+        // Both dimensions are parallelized, so a few indices over many dictionaries still load all threads
+        parallel_for2d(numDictionaries, src_indexSize, [&](size_t j, size_t i) {
             unsigned int idx = Conversion()(src_index[i]);
 
             //  Index clipping
             if (idx < indexRange) {
                 //  Copying data to destination from Dictionary
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    cpu_memcpy_s(&dst_data[len * (i + j * src_indexSize)],
-                                output->byteSize() - (len * (i + j * src_indexSize)),
-                                &src_dataDict[len * (idx + j * indexRange)],
-                                len);
-                }
+                cpu_memcpy_s(&dst_data[len * (i + j * src_indexSize)],
+                            output->byteSize() - (len * (i + j * src_indexSize)),
+                            &src_dataDict[len * (idx + j * indexRange)],
+                            len);
             } else {
-                for (size_t j = 0; j < numDictionaries; j++) {
-                    memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
-                }
+                memset(&dst_data[len * (i + j * src_indexSize)], 0, len);
             }
         });
     }
@@ -8,6 +8,7 @@
 #include <limits>
 #include <memory>
 #include "ie_parallel.hpp"
+#include "mkldnn_selective_build.h"
 #include "jit_generator.hpp"
 
 using namespace mkldnn::impl::cpu;
@@ -194,11 +195,11 @@ public:
                 config.dynBatchSupport = false;
                 confs.push_back(config);
             } else {
-                if (mayiuse(avx512_common)) {
+                if (MKLDNN_ISA(avx512_common)) {
                     blk_layout = ConfLayout::BLK16;
                     interp_kernel.reset(new jit_uni_interp_kernel_f32<avx512_common>());
                     addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
-                } else if (mayiuse(avx2)) {
+                } else if (MKLDNN_ISA(avx2)) {
                     blk_layout = ConfLayout::BLK8;
                     interp_kernel.reset(new jit_uni_interp_kernel_f32<avx2>());
                     addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
@@ -317,7 +318,7 @@ private:
 
         int block_size = 1;
         if (interp_kernel) {
-            if (mayiuse(avx512_common)) {
+            if (MKLDNN_ISA(avx512_common)) {
                 block_size = 16;
             } else {
                 block_size = 8;
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 #include "ie_parallel.hpp"
 
 namespace InferenceEngine {
@@ -78,23 +79,43 @@ public:
                     dst_dataPtr[j] = src_dataPtr[j] - max - reduce_prod;
             });
         } else {
-            parallel_for2d(axis_step, reduced_axis_stride, [&](size_t k, size_t i) {
-                const float *src_dataPtr = &src_data[k * reduced_axis_stride * reduced_axis_size + i];
-                float *dst_dataPtr = &dst_data[k * reduced_axis_stride * reduced_axis_size + i];
+            // Lanes of the inner dimensions are independent, so they are processed in blocks: every pass
+            // over the reduced axis reads contiguous rows of a block, which keeps the loops vectorizable
+            const size_t blocks_num = (reduced_axis_stride + lanes_block - 1) / lanes_block;
+            parallel_for2d(axis_step, blocks_num, [&](size_t k, size_t ib) {
+                const size_t start = ib * lanes_block;
+                const size_t lanes = reduced_axis_stride - start < lanes_block ? reduced_axis_stride - start : lanes_block;
+                const float *src_dataPtr = &src_data[k * reduced_axis_stride * reduced_axis_size + start];
+                float *dst_dataPtr = &dst_data[k * reduced_axis_stride * reduced_axis_size + start];
+
+                float max[lanes_block];
+                float reduce_prod[lanes_block];
+                for (size_t i = 0; i < lanes; ++i) {
+                    max[i] = src_dataPtr[i];
+                    reduce_prod[i] = 0.0f;
+                }
+
+                for (size_t j = 1; j < reduced_axis_size; ++j) {
+                    const float *src_row = src_dataPtr + j * reduced_axis_stride;
+                    for (size_t i = 0; i < lanes; ++i)
+                        max[i] = (std::max)(max[i], src_row[i]);
+                }
 
-                float reduce_prod = 0.0f;
-                float max = std::numeric_limits<float>::min();
                 for (size_t j = 0; j < reduced_axis_size; ++j) {
-                    if (src_dataPtr[j * reduced_axis_stride] > max)
-                        max = src_dataPtr[j * reduced_axis_stride];
+                    const float *src_row = src_dataPtr + j * reduced_axis_stride;
+                    for (size_t i = 0; i < lanes; ++i)
+                        reduce_prod[i] += expf(src_row[i] - max[i]);
                 }
 
-                for (size_t j = 0; j < reduced_axis_size; ++j)
-                    reduce_prod += expf(src_dataPtr[j * reduced_axis_stride] - max);
+                for (size_t i = 0; i < lanes; ++i)
+                    reduce_prod[i] = max[i] + logf(reduce_prod[i]);
 
-                reduce_prod = logf(reduce_prod);
-                for (size_t j = 0; j < reduced_axis_size; ++j)
-                    dst_dataPtr[j * reduced_axis_stride] = src_dataPtr[j * reduced_axis_stride] - max - reduce_prod;
+                for (size_t j = 0; j < reduced_axis_size; ++j) {
+                    const float *src_row = src_dataPtr + j * reduced_axis_stride;
+                    float *dst_row = dst_dataPtr + j * reduced_axis_stride;
+                    for (size_t i = 0; i < lanes; ++i)
+                        dst_row[i] = src_row[i] - reduce_prod[i];
+                }
             });
         }
 
@@ -102,6 +123,8 @@ public:
     }
 
 private:
+    static constexpr size_t lanes_block = 64;
+
     size_t reduced_axis_size;
     size_t reduced_axis_stride = 1;
     size_t axis_step = 1;
@@ -0,0 +1,276 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_attention_node.h"
+#include <legacy/ie_layers.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
+#include "ngraph/type/bfloat16.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+// size of the scores rows processed by one thread at once, small enough to stay in L2 cache
+constexpr size_t scoresBlockSize = 64 * 1024;
+
+inline void attention_gemm(char transa, char transb, int M, int N, int K, float alpha, const float *A, int lda,
+                           const float *B, int ldb, float *C, int ldc) {
+    mkldnn_sgemm(transa, transb, M, N, K, alpha, A, lda, B, ldb, 0.f, C, ldc);
+}
+
+inline void attention_gemm(char transa, char transb, int M, int N, int K, float alpha, const uint16_t *A, int lda,
+                           const uint16_t *B, int ldb, float *C, int ldc) {
+    mkldnn_gemm_bf16bf16f32(transa, transb, M, N, K, alpha, A, lda, B, ldb, 0.f, C, ldc);
+}
+
+template <typename T>
+const T* attention_probs(const float *scores, uint16_t *buffer, size_t size);
+
+template <>
+const float* attention_probs<float>(const float *scores, uint16_t *buffer, size_t size) {
+    return scores;
+}
+
+template <>
+const uint16_t* attention_probs<uint16_t>(const float *scores, uint16_t *buffer, size_t size) {
+    for (size_t i = 0; i < size; i++)
+        buffer[i] = ngraph::bfloat16(scores[i]).to_bits();
+    return buffer;
+}
+
+}  // namespace
+
+MKLDNNAttentionNode::MKLDNNAttentionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
+        MKLDNNNode(layer, eng, cache) {}
+
+void MKLDNNAttentionNode::getSupportedDescriptors() {
+    auto layer = getCnnLayer();
+    if (layer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get attention layer.";
+
+    if (getParentEdges().size() != 3 && getParentEdges().size() != 4)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    scale = layer->GetParamAsFloat("scale", 1.0f);
+    postMaskScale = layer->GetParamAsFloat("post_mask_scale", 1.0f);
+    transposeK = layer->GetParamAsBool("transpose_k", true);
+    transposeV = layer->GetParamAsBool("transpose_v", false);
+    withMask = getParentEdges().size() == 4;
+    if (!withMask) {
+        scale *= postMaskScale;
+        postMaskScale = 1.0f;
+    }
+
+    auto qDims = getParentEdgeAt(0)->getDims();
+    auto kDims = getParentEdgeAt(1)->getDims();
+    auto vDims = getParentEdgeAt(2)->getDims();
+    auto outDims = getChildEdgeAt(0)->getDims();
+
+    const size_t nDims = qDims.ndims();
+    if (nDims < 2 || nDims > 4)
+        THROW_IE_EXCEPTION << "Unsupported input dims count for layer " << getName();
+    if (kDims.ndims() != nDims || vDims.ndims() != nDims || outDims.ndims() != nDims)
+        THROW_IE_EXCEPTION << "Invalid dims count for layer " << getName();
+
+    batch = 1;
+    batchDims.clear();
+    for (size_t i = 0; i < nDims - 2; i++) {
+        if (kDims[i] != qDims[i] || vDims[i] != qDims[i] || outDims[i] != qDims[i])
+            THROW_IE_EXCEPTION << "Input batch dimensions are incorrect for layer " << getName();
+        batchDims.push_back(qDims[i]);
+        batch *= qDims[i];
+    }
+
+    L = qDims[nDims - 2];
+    D = qDims[nDims - 1];
+    S = transposeK ? kDims[nDims - 2] : kDims[nDims - 1];
+    Dv = transposeV ? vDims[nDims - 2] : vDims[nDims - 1];
+    const size_t kD = transposeK ? kDims[nDims - 1] : kDims[nDims - 2];
+    const size_t vS = transposeV ? vDims[nDims - 1] : vDims[nDims - 2];
+    if (kD != D || vS != S || outDims[nDims - 2] != L || outDims[nDims - 1] != Dv)
+        THROW_IE_EXCEPTION << "Spatial input and output dimensions are incorrect for layer " << getName();
+
+    if (withMask) {
+        auto maskDims = getParentEdgeAt(3)->getDims().ToSizeVector();
+        if (maskDims.size() > nDims)
+            THROW_IE_EXCEPTION << "Unsupported mask dims count for layer " << getName();
+        maskDims.insert(maskDims.begin(), nDims - maskDims.size(), 1);
+
+        std::vector<size_t> scoresDims = batchDims;
+        scoresDims.push_back(L);
+        scoresDims.push_back(S);
+
+        std::vector<size_t> maskStrides(nDims, 0);
+        size_t stride = 1;
+        for (size_t i = nDims; i > 0; i--) {
+            if (maskDims[i - 1] != scoresDims[i - 1] && maskDims[i - 1] != 1)
+                THROW_IE_EXCEPTION << "Mask is not broadcastable to the scores for layer " << getName();
+            maskStrides[i - 1] = maskDims[i - 1] == 1 ? 0 : stride;
+            stride *= maskDims[i - 1];
+        }
+        maskBatchStrides.assign(maskStrides.begin(), maskStrides.end() - 2);
+        maskRowStride = maskStrides[nDims - 2];
+        maskColStride = maskStrides[nDims - 1];
+    }
+
+    rowsBlock = std::max<size_t>(1, std::min(L, scoresBlockSize / (S * sizeof(float))));
+}
+
+void MKLDNNAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    Precision precision = Precision::FP32;
+    for (size_t i = 0; i < 3; i++) {
+        if (getCnnLayer()->insData[i].lock()->getPrecision() == Precision::BF16)
+            precision = Precision::BF16;
+    }
+
+    auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
+    auto floatDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::FP32);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+
+    auto createDataConfig = [](const MKLDNNDims& dims, memory::data_type dataType) -> InferenceEngine::DataConfig {
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dims, dataType, MKLDNNMemory::GetPlainFormat(dims));
+        return dataConfig;
+    };
+
+    for (size_t i = 0; i < 3; i++)
+        config.inConfs.push_back(createDataConfig(getParentEdgeAt(i)->getDims(), inputDataType));
+    if (withMask)
+        config.inConfs.push_back(createDataConfig(getParentEdgeAt(3)->getDims(), floatDataType));
+
+    config.outConfs.push_back(createDataConfig(getChildEdgeAt(0)->getDims(), floatDataType));
+
+    supportedPrimitiveDescriptors.push_back(PrimitiveDescInfo(config, impl_desc_type::gemm_any, MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())));
+}
+
+void MKLDNNAttentionNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory isn't allocated.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory isn't allocated.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor isn't set.";
+
+    const size_t threads = static_cast<size_t>(parallel_get_max_threads());
+    scoresBuffer.resize(threads * rowsBlock * S);
+    if (getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc.getPrecision() == Precision::BF16)
+        probsBuffer.resize(threads * rowsBlock * S);
+}
+
+template<typename T>
+void MKLDNNAttentionNode::process_data() {
+    auto getData = [](const MKLDNNMemory& memory) {
+        return reinterpret_cast<const T*>(memory.GetData()) + memory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    };
+    const T *q_ptr = getData(getParentEdgeAt(0)->getMemory());
+    const T *k_ptr = getData(getParentEdgeAt(1)->getMemory());
+    const T *v_ptr = getData(getParentEdgeAt(2)->getMemory());
+
+    const float *mask_ptr = nullptr;
+    if (withMask) {
+        auto& maskMemory = getParentEdgeAt(3)->getMemory();
+        mask_ptr = reinterpret_cast<const float*>(maskMemory.GetData()) +
+                   maskMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    }
+
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+                     dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const char transk = transposeK ? 'T' : 'N';
+    const char transv = transposeV ? 'T' : 'N';
+    const int ldk = static_cast<int>(transposeK ? D : S);
+    const int ldv = static_cast<int>(transposeV ? S : Dv);
+    const size_t blocks = (L + rowsBlock - 1) / rowsBlock;
+
+    parallel_for2d(batch, blocks, [&](size_t b, size_t rb) {
+        const size_t ithr = static_cast<size_t>(parallel_get_thread_num());
+        float *scores = &scoresBuffer[ithr * rowsBlock * S];
+        const size_t r0 = rb * rowsBlock;
+        const size_t rows = (std::min)(rowsBlock, L - r0);
+
+        attention_gemm('N', transk, rows, S, D, scale, q_ptr + (b * L + r0) * D, D,
+                       k_ptr + b * S * D, ldk, scores, S);
+
+        const float *mask_block = nullptr;
+        if (withMask) {
+            size_t offset = 0;
+            size_t rest = b;
+            for (size_t i = batchDims.size(); i > 0; i--) {
+                offset += (rest % batchDims[i - 1]) * maskBatchStrides[i - 1];
+                rest /= batchDims[i - 1];
+            }
+            mask_block = mask_ptr + offset + r0 * maskRowStride;
+        }
+
+        for (size_t r = 0; r < rows; r++) {
+            float *row = scores + r * S;
+            if (mask_block) {
+                const float *mask_row = mask_block + r * maskRowStride;
+                for (size_t s = 0; s < S; s++)
+                    row[s] = (row[s] + mask_row[s * maskColStride]) * postMaskScale;
+            }
+
+            float max = row[0];
+            for (size_t s = 1; s < S; s++)
+                max = (std::max)(max, row[s]);
+
+            float expSum = 0.f;
+            for (size_t s = 0; s < S; s++) {
+                row[s] = std::exp(row[s] - max);
+                expSum += row[s];
+            }
+
+            const float invSum = 1.f / expSum;
+            for (size_t s = 0; s < S; s++)
+                row[s] *= invSum;
+        }
+
+        uint16_t *probs_buffer = probsBuffer.empty() ? nullptr : &probsBuffer[ithr * rowsBlock * S];
+        const T *probs = attention_probs<T>(scores, probs_buffer, rows * S);
+
+        attention_gemm('N', transv, rows, Dv, S, 1.f, probs, S,
+                       v_ptr + b * S * Dv, ldv, dst_ptr + (b * L + r0) * Dv, Dv);
+    });
+}
+
+void MKLDNNAttentionNode::execute(mkldnn::stream strm) {
+    switch (getParentEdgeAt(0)->getDesc().getPrecision()) {
+        case Precision::FP32:
+            process_data<float>();
+            break;
+        case Precision::BF16:
+            process_data<uint16_t>();
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Attention node: inputs have unsupported precision";
+    }
+}
+
+bool MKLDNNAttentionNode::created() const {
+    return getType() == Attention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNAttentionNode, Attention);
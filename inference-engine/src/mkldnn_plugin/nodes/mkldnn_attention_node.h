@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Computes softmax((Q * K^T * scale + mask) * post_mask_scale) * V for every batch and head. The node is
+ * created by MKLDNNGraphOptimizer from Gemm -> [Power] -> [Eltwise sum] -> SoftMax -> Gemm chains. Rows
+ * of the scores are processed in blocks which stay in cache, the whole score matrix is never stored.
+ *
+ * Inputs: 0 - Q, 1 - K, 2 - V, 3 - optional additive mask broadcastable to the scores shape.
+ */
+class MKLDNNAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNAttentionNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNAttentionNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+private:
+    float scale = 1.0f;
+    float postMaskScale = 1.0f;
+    bool transposeK = false;
+    bool transposeV = false;
+    bool withMask = false;
+
+    size_t batch = 0;
+    size_t L = 0;
+    size_t S = 0;
+    size_t D = 0;
+    size_t Dv = 0;
+    size_t rowsBlock = 0;
+
+    // mask strides for the batch dimensions, rows and columns of the scores, 0 for broadcasted dimensions
+    std::vector<size_t> batchDims;
+    std::vector<size_t> maskBatchStrides;
+    size_t maskRowStride = 0;
+    size_t maskColStride = 0;
+
+    std::vector<float> scoresBuffer;
+    std::vector<uint16_t> probsBuffer;
+
+    template<typename T> void process_data();
+};
+
+}  // namespace MKLDNNPlugin
+
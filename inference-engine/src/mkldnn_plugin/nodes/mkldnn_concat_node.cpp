@@ -166,6 +166,14 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
     }
 
     if (outputPrecision == Precision::I8 || outputPrecision == Precision::U8) {
+        // In channels-last layouts a channel slice of the output is contiguous (up to the batch stride, like in
+        // the planar case) only if there is a single spatial point. Otherwise producers would have to write
+        // with the pixel stride of the concat output, which MKLDNN primitives don't support
+        size_t spatialSize = 1;
+        for (size_t i = 2; i < numOfDim; i++)
+            spatialSize *= dstDims[i];
+        const bool canBeInPlaceChannelsLast = spatialSize == 1;
+
         if (numOfDim == 4) {
             // Here we assume NHWC layout (channels are the last)
 
@@ -191,7 +199,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 SizeVector blkDims = parentEdge->getDims().ToSizeVector();
                 blkDims = { blkDims[0], blkDims[2], blkDims[3], blkDims[1] };
 
-                config.inConfs[i].inPlace = -1;     // Change to 0 here if inplace concat is supported for NHWC in mkldnn
+                config.inConfs[i].inPlace = -1;
 
                 config.inConfs[i].desc = TensorDesc(inputPrecision, parentEdge->getDims().ToSizeVector(),
                                                     {blkDims, order, offset, offsets, strides});
@@ -199,6 +207,12 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::nhwc);
 
+            if (canBeInPlaceChannelsLast) {
+                for (auto& inConf : config.inConfs)
+                    inConf.inPlace = 0;
+                supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, mkldnn::memory::nhwc);
+            }
+
             return;
         } else if (numOfDim == 5) {
             // Here we assume NDHWC layout (channels are the last)
@@ -225,7 +239,7 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
                 SizeVector blkDims = parentEdge->getDims().ToSizeVector();
                 blkDims = { blkDims[0], blkDims[2], blkDims[3], blkDims[4], blkDims[1] };
 
-                config.inConfs[i].inPlace = -1;     // Change to 0 here if inplace concat is supported for NDHWC in mkldnn
+                config.inConfs[i].inPlace = -1;
 
                 config.inConfs[i].desc = TensorDesc(inputPrecision, parentEdge->getDims().ToSizeVector(),
                                                     {blkDims, order, offset, offsets, strides});
@@ -233,6 +247,12 @@ void MKLDNNConcatNode::initSupportedPrimitiveDescriptors() {
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref, mkldnn::memory::ndhwc);
 
+            if (canBeInPlaceChannelsLast) {
+                for (auto& inConf : config.inConfs)
+                    inConf.inPlace = 0;
+                supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown, mkldnn::memory::ndhwc);
+            }
+
             return;
         }
     }
@@ -592,12 +612,12 @@ void MKLDNNConcatNode::initOptimalPrimitiveDescriptor() {
                                                              });
         size_t axisSize = 1;
 
-        if (config.inConfs[0].desc.getLayout() == Layout::NHWC) {
+        const auto layout = config.inConfs[0].desc.getLayout();
+        if (layout == Layout::NHWC || layout == Layout::NDHWC) {
             // This is more general and works for any "direct" Layout (such as nchw or nhwc), but it doesn't work for nchw8c
             size_t realAxis = inverseOrder(config.inConfs[0].desc.getBlockingDesc().getOrder(), axis);
             for (size_t j = realAxis; j < config.inConfs[i].desc.getBlockingDesc().getBlockDims().size(); j++) {
-                size_t jj = config.inConfs[0].desc.getBlockingDesc().getOrder()[j];
-                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[jj];
+                axisSize *= config.inConfs[i].desc.getBlockingDesc().getBlockDims()[j];
             }
         } else {
             // This works for nchw and nchw8c/nchw16c
@@ -26,6 +26,10 @@ public:
 
     bool isOptimized() const;
 
+    bool isExecutable() override {
+        return !isOptimized() && MKLDNNNode::isExecutable();
+    }
+
 private:
     size_t axis = 0;
 
@@ -12,6 +12,7 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
+#include "mkldnn_selective_build.h"
 #include "mkldnn_quantize_node.h"
 #include <map>
 #include "jit_uni_eltwise.hpp"
@@ -391,7 +392,7 @@ private:
     }
 
     inline void apply_post_ops(bool is_scalar, int offset = 0) {
-        int input_idx = eltwise_emitter->get_inputs_num();
+        int input_idx = 0;
         int eltwise_post_op_idx = 0;
         int quantization_post_op_idx = 0;
         for (int i = 0; i < eltwiseNode.getFusedWith().size(); i++) {
@@ -400,7 +401,7 @@ private:
                 std::vector<size_t> aux_idxs;
                 in_idxs.push_back(vmm_dst.getIdx());
                 for (int j = 1; j < post_op_emitters[eltwise_post_op_idx]->get_inputs_num(); j++)
-                    in_idxs.push_back(get_vmm_reg(input_idx++).getIdx());
+                    in_idxs.push_back(get_vmm_reg(eltwiseNode.getPostOpInputPort(input_idx++)).getIdx());
                 for (int j = 0; j < post_op_emitters[eltwise_post_op_idx]->aux_vecs_count(); j++)
                     aux_idxs.push_back(get_aux_vmm(j).getIdx());
 
@@ -855,6 +856,11 @@ void MKLDNNEltwiseNode::init() {
     }
 }
 
+size_t MKLDNNEltwiseNode::getPostOpInputPort(size_t idx) const {
+    // inputs of fused operations follow inputs of the node unless other ports were recorded
+    return idx < postOpInputPorts.size() ? postOpInputPorts[idx] : getOpInputsNum() + idx;
+}
+
 size_t MKLDNNEltwiseNode::getOpInputsNum() const {
     switch (getOpType()) {
         case Relu: case Gelu: case Elu: case Tanh: case Logistic: case Square: case Abs: case Sqrt: case PowerStatic:
@@ -908,15 +914,18 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    canUseOptimizedImpl = mayiuse(cpu::sse42);
+    canUseOptimizedImpl = MKLDNN_ISA(sse42);
 
-    size_t expectedInputsNum = getOpInputsNum();
+    size_t postOpInputsNum = 0;
     for (auto& postOp : fusedWith) {
         auto* eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode*>(postOp.get());
         if (eltwiseNode != nullptr) {
-            expectedInputsNum += eltwiseNode->getOpInputsNum() - 1;
+            postOpInputsNum += eltwiseNode->getOpInputsNum() - 1;
         }
     }
+    size_t expectedInputsNum = getOpInputsNum();
+    for (size_t i = 0; i < postOpInputsNum; i++)
+        expectedInputsNum = std::max(expectedInputsNum, getPostOpInputPort(i) + 1);
     if (getParentEdges().size() > MAX_ELTWISE_INPUTS)
         THROW_IE_EXCEPTION << "Eltwise node with name `" << getName() << "` doesn't support more than " << MAX_ELTWISE_INPUTS
                            << " inputs (actual = " << getParentEdges().size() << ")";
@@ -930,10 +939,13 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         inputPrecisions.push_back(getCnnLayer()->insData[i].lock()->getPrecision());
     }
 
+    size_t postOpInputIdx = 0;
     for (auto& fusedNode : fusedWith) {
         if (fusedNode->getType() == Eltwise) {
             for (int i = 1; i < fusedNode->getCnnLayer()->insData.size(); i++) {
-                inputPrecisions.push_back(fusedNode->getCnnLayer()->insData[i].lock()->getPrecision());
+                // inputs shared with the node or previous operations are not added
+                if (getPostOpInputPort(postOpInputIdx++) == inputPrecisions.size())
+                    inputPrecisions.push_back(fusedNode->getCnnLayer()->insData[i].lock()->getPrecision());
             }
         }
     }
@@ -1006,7 +1018,7 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
 
                 return MKLDNNMemoryDesc(TensorDesc(prc, edge->getDims().ToSizeVector(), {blocks, order, offset}));
             } else if (lt == Blocked && edge->getDims()[1] != 1) {
-                size_t blockSize = mayiuse(cpu::avx512_common) ? 16 : 8;
+                size_t blockSize = MKLDNN_ISA(avx512_common) ? 16 : 8;
 
                 std::vector<size_t> blocks = edge->getDims().ToSizeVector();
                 std::vector<size_t> order(blocks.size());
@@ -1052,11 +1064,11 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         config.outConfs.push_back(dataConfig);
 
         impl_desc_type impl_type;
-        if (mayiuse(cpu::avx512_common)) {
+        if (MKLDNN_ISA(avx512_common)) {
             impl_type = impl_desc_type::jit_avx512;
-        } else if (mayiuse(cpu::avx2)) {
+        } else if (MKLDNN_ISA(avx2)) {
             impl_type = impl_desc_type::jit_avx2;
-        } else if (mayiuse(cpu::sse42)) {
+        } else if (MKLDNN_ISA(sse42)) {
             impl_type = impl_desc_type::jit_sse42;
         } else {
             impl_type = impl_desc_type::ref;
@@ -1297,11 +1309,11 @@ void MKLDNNEltwiseNode::createPrimitive() {
 
     jep.oc_size = oc_size;
 
-    if (mayiuse(cpu::avx512_common)) {
+    if (MKLDNN_ISA(avx512_common)) {
         eltwise_kernel.reset(new jit_uni_eltwise_generic<cpu::avx512_common>(jep, *this));
-    } else if (mayiuse(cpu::avx2)) {
+    } else if (MKLDNN_ISA(avx2)) {
         eltwise_kernel.reset(new jit_uni_eltwise_generic<cpu::avx2>(jep, *this));
-    } else if (mayiuse(cpu::sse42)) {
+    } else if (MKLDNN_ISA(sse42)) {
         eltwise_kernel.reset(new jit_uni_eltwise_generic<cpu::sse42>(jep, *this));
     }
 }
@@ -1635,7 +1647,7 @@ bool MKLDNNEltwiseNode::canFuse(const MKLDNNNodePtr& node) const {
         return false;
     };
 
-    if (!mayiuse(cpu::sse42))
+    if (!MKLDNN_ISA(sse42))
         return false;
 
     // FQ inputs with quantization parameters will be hided inside post_op object, so will not increase inputs number
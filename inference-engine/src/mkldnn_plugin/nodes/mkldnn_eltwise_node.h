@@ -130,6 +130,13 @@ public:
 
     void appendPostOps(mkldnn::post_ops& ops) override;
 
+    /**
+     * @brief Records the input port of the next input consumed by fused eltwise operations.
+     * An input which is already connected to the node is referred by its port, so it is read once.
+     */
+    void addPostOpInputPort(size_t port) { postOpInputPorts.push_back(port); }
+    size_t getPostOpInputPort(size_t idx) const;
+
 private:
     void init() override;
 
@@ -161,6 +168,8 @@ private:
     std::vector<float> scales = {};
     std::vector<float> shifts = {};
 
+    std::vector<size_t> postOpInputPorts = {};
+
     inline void executeOptimized6D(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr);
     inline void executeOptimizedGeneric(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr);
     inline void executeReference(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr);
@@ -7,10 +7,15 @@
 #include "mkldnn_quantize_node.h"
 #include "desc_iterator.hpp"
 #include <legacy/ie_layers.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
+#include "ie_parallel.hpp"
+#include "precision_utils.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -165,7 +170,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
 }
 
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || isSparse() || isCompressed())
+        return;
+
+    if (compressSparseWeights() || compressWeights())
         return;
 
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
@@ -187,6 +195,272 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
     }
 }
 
+void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (isSparse()) {
+        executeSparse();
+        return;
+    }
+    if (isCompressed()) {
+        executeCompressed();
+        return;
+    }
+    MKLDNNNode::execute(strm);
+}
+
+constexpr int MKLDNNFullyConnectedNode::sparseBlockSize;
+
+bool MKLDNNFullyConnectedNode::canUseCustomKernel() {
+    if (baseInputsNumber != 1 || !fusedWith.empty() || wScale || internalBlobs.empty() ||
+            internalBlobs[0]->getTensorDesc().getPrecision() != Precision::FP32)
+        return false;
+
+    // the kernel works with plain FP32 tensors whose inner dims are flattened into input channels
+    auto isPlain = [](const TensorDesc& desc) {
+        const auto& order = desc.getBlockingDesc().getOrder();
+        for (size_t i = 0; i < order.size(); i++) {
+            if (order[i] != i)
+                return false;
+        }
+        return desc.getBlockingDesc().getBlockDims() == desc.getDims() && desc.getBlockingDesc().getOffsetPadding() == 0;
+    };
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set for node " << getName() << ".";
+    const auto& inDesc = selected_pd->getConfig().inConfs[0].desc;
+    const auto& outDesc = selected_pd->getConfig().outConfs[0].desc;
+    return inDesc.getPrecision() == Precision::FP32 && outDesc.getPrecision() == Precision::FP32 &&
+           isPlain(inDesc) && isPlain(outDesc);
+}
+
+bool MKLDNNFullyConnectedNode::compressSparseWeights() {
+    if (sparseWeightsThreshold <= 0.f || !canUseCustomKernel())
+        return false;
+
+    const auto& weights = internalBlobs[0];
+    const int OC = static_cast<int>(weightsDims[0]);
+    const int IC = static_cast<int>(weights->size() / OC);
+    const int OCB = (OC + sparseBlockSize - 1) / sparseBlockSize;
+    const float* w = weights->cbuffer().as<const float*>();
+
+    auto isZeroBlock = [&](int ocb, int ic) {
+        for (int oc = ocb * sparseBlockSize; oc < std::min(OC, (ocb + 1) * sparseBlockSize); oc++) {
+            if (w[static_cast<size_t>(oc) * IC + ic] != 0.f)
+                return false;
+        }
+        return true;
+    };
+
+    size_t nonZeroBlocks = 0;
+    for (int ocb = 0; ocb < OCB; ocb++) {
+        for (int ic = 0; ic < IC; ic++) {
+            if (!isZeroBlock(ocb, ic))
+                nonZeroBlocks++;
+        }
+    }
+    const size_t blocks = static_cast<size_t>(OCB) * IC;
+    if (blocks == 0 || static_cast<float>(blocks - nonZeroBlocks) < sparseWeightsThreshold * blocks)
+        return false;
+
+    sparseBlockOffsets.reserve(OCB + 1);
+    sparseColumns.reserve(nonZeroBlocks);
+    sparseValues.reserve(nonZeroBlocks * sparseBlockSize);
+    sparseBlockOffsets.push_back(0);
+    for (int ocb = 0; ocb < OCB; ocb++) {
+        for (int ic = 0; ic < IC; ic++) {
+            if (isZeroBlock(ocb, ic))
+                continue;
+            sparseColumns.push_back(ic);
+            // tail blocks are padded by zeros, so the kernel always processes whole blocks
+            for (int oc = ocb * sparseBlockSize; oc < (ocb + 1) * sparseBlockSize; oc++)
+                sparseValues.push_back(oc < OC ? w[static_cast<size_t>(oc) * IC + ic] : 0.f);
+        }
+        sparseBlockOffsets.push_back(static_cast<int>(sparseColumns.size()));
+    }
+
+    sparseBiases.assign(static_cast<size_t>(OCB) * sparseBlockSize, 0.f);
+    if (withBiases) {
+        const float* b = internalBlobs[1]->cbuffer().as<const float*>();
+        std::copy(b, b + OC, sparseBiases.begin());
+    }
+    return true;
+}
+
+void MKLDNNFullyConnectedNode::executeSparse() {
+    const auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float* src = reinterpret_cast<const float*>(srcMemory.GetData());
+    float* dst = reinterpret_cast<float*>(dstMemory.GetData());
+
+    const auto dstDims = getChildEdgeAt(0)->getDims();
+    const int OC = static_cast<int>(dstDims[dstDims.ndims() - 1]);
+    const int OCB = static_cast<int>(sparseBlockOffsets.size()) - 1;
+    // 3D inputs are processed as a batch of rows, other inputs are flattened into one row per batch
+    const int rows = dstDims.ndims() == 3 ? batchToProcess() * static_cast<int>(dstDims[1]) : batchToProcess();
+    const size_t IC = getParentEdgeAt(0)->getDims().size() / getParentEdgeAt(0)->getDims()[0] /
+                      (dstDims.ndims() == 3 ? dstDims[1] : 1);
+
+    parallel_for2d(rows, OCB, [&](int row, int ocb) {
+        float acc[sparseBlockSize];
+        const float* bias = &sparseBiases[static_cast<size_t>(ocb) * sparseBlockSize];
+        for (int j = 0; j < sparseBlockSize; j++)
+            acc[j] = bias[j];
+
+        const float* x = src + static_cast<size_t>(row) * IC;
+        for (int k = sparseBlockOffsets[ocb]; k < sparseBlockOffsets[ocb + 1]; k++) {
+            const float xv = x[sparseColumns[k]];
+            const float* wv = &sparseValues[static_cast<size_t>(k) * sparseBlockSize];
+            for (int j = 0; j < sparseBlockSize; j++)
+                acc[j] += xv * wv[j];
+        }
+
+        float* y = dst + static_cast<size_t>(row) * OC + ocb * sparseBlockSize;
+        const int tail = std::min(sparseBlockSize, OC - ocb * sparseBlockSize);
+        for (int j = 0; j < tail; j++)
+            y[j] = acc[j];
+    });
+}
+
+namespace {
+inline float bitsToFloat(uint32_t u) {
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+// FP16 numbers produced by compressWeights() are finite, so the conversion is a shift of exponent and mantissa
+// and a multiplication fixing the exponent bias, which compilers vectorize
+inline float fp16ToFp32(uint16_t h) {
+    const float magic = bitsToFloat((254u - 15u) << 23);
+    const float magnitude = bitsToFloat(static_cast<uint32_t>(h & 0x7fffu) << 13) * magic;
+    uint32_t u;
+    std::memcpy(&u, &magnitude, sizeof(u));
+    return bitsToFloat(u | (static_cast<uint32_t>(h & 0x8000u) << 16));
+}
+
+inline float bf16ToFp32(uint16_t h) {
+    return bitsToFloat(static_cast<uint32_t>(h) << 16);
+}
+
+inline uint16_t fp32ToBf16(float f) {
+    uint32_t u;
+    std::memcpy(&u, &f, sizeof(u));
+    // round to nearest even
+    u += 0x7fffu + ((u >> 16) & 1u);
+    return static_cast<uint16_t>(u >> 16);
+}
+}  // namespace
+
+bool MKLDNNFullyConnectedNode::compressWeights() {
+    if (weightsCompression == WeightsCompression::None || !canUseCustomKernel())
+        return false;
+
+    const auto& weights = internalBlobs[0];
+    const size_t OC = weightsDims[0];
+    const size_t IC = weights->size() / OC;
+    const float* w = weights->cbuffer().as<const float*>();
+
+    switch (weightsCompression) {
+    case WeightsCompression::FP16: {
+        compressedWeights.resize(OC * IC * sizeof(uint16_t));
+        auto dst = reinterpret_cast<uint16_t*>(compressedWeights.data());
+        for (size_t i = 0; i < OC * IC; i++) {
+            // saturate to the largest finite FP16 number, the kernel does not expect infinities
+            dst[i] = static_cast<uint16_t>(PrecisionUtils::f32tof16(std::max(-65504.f, std::min(65504.f, w[i]))));
+        }
+        break;
+    }
+    case WeightsCompression::BF16: {
+        compressedWeights.resize(OC * IC * sizeof(uint16_t));
+        auto dst = reinterpret_cast<uint16_t*>(compressedWeights.data());
+        for (size_t i = 0; i < OC * IC; i++)
+            dst[i] = fp32ToBf16(w[i]);
+        break;
+    }
+    case WeightsCompression::I8: {
+        compressedWeights.resize(OC * IC);
+        compressedScales.resize(OC);
+        auto dst = reinterpret_cast<int8_t*>(compressedWeights.data());
+        for (size_t oc = 0; oc < OC; oc++) {
+            float absMax = 0.f;
+            for (size_t ic = 0; ic < IC; ic++)
+                absMax = std::max(absMax, std::abs(w[oc * IC + ic]));
+            const float scale = absMax > 0.f ? absMax / 127.f : 1.f;
+            compressedScales[oc] = scale;
+            for (size_t ic = 0; ic < IC; ic++)
+                dst[oc * IC + ic] = static_cast<int8_t>(std::round(w[oc * IC + ic] / scale));
+        }
+        break;
+    }
+    default:
+        return false;
+    }
+
+    compressedBiases.assign(OC, 0.f);
+    if (withBiases) {
+        const float* b = internalBlobs[1]->cbuffer().as<const float*>();
+        std::copy(b, b + OC, compressedBiases.begin());
+    }
+    return true;
+}
+
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    const auto& srcMemory = getParentEdgeAt(0)->getMemory();
+    const auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    const float* src = reinterpret_cast<const float*>(srcMemory.GetData());
+    float* dst = reinterpret_cast<float*>(dstMemory.GetData());
+
+    const auto dstDims = getChildEdgeAt(0)->getDims();
+    const size_t OC = compressedBiases.size();
+    const size_t IC = compressedWeights.size() / OC / (weightsCompression == WeightsCompression::I8 ? 1 : 2);
+    const int rows = dstDims.ndims() == 3 ? batchToProcess() * static_cast<int>(dstDims[1]) : batchToProcess();
+
+    // weights are decompressed by chunks fitting L1 cache and reused by all rows,
+    // so the memory traffic is determined by the compressed weights
+    constexpr size_t chunk = 512;
+    constexpr size_t lanes = 16;
+    parallel_for(OC, [&](size_t oc) {
+        float decompressed[chunk];
+        for (int row = 0; row < rows; row++)
+            dst[row * OC + oc] = compressedBiases[oc];
+
+        for (size_t ic0 = 0; ic0 < IC; ic0 += chunk) {
+            const size_t len = std::min(chunk, IC - ic0);
+            const size_t offset = oc * IC + ic0;
+            if (weightsCompression == WeightsCompression::FP16) {
+                auto w = reinterpret_cast<const uint16_t*>(compressedWeights.data()) + offset;
+                for (size_t i = 0; i < len; i++)
+                    decompressed[i] = fp16ToFp32(w[i]);
+            } else if (weightsCompression == WeightsCompression::BF16) {
+                auto w = reinterpret_cast<const uint16_t*>(compressedWeights.data()) + offset;
+                for (size_t i = 0; i < len; i++)
+                    decompressed[i] = bf16ToFp32(w[i]);
+            } else {
+                auto w = reinterpret_cast<const int8_t*>(compressedWeights.data()) + offset;
+                const float scale = compressedScales[oc];
+                for (size_t i = 0; i < len; i++)
+                    decompressed[i] = static_cast<float>(w[i]) * scale;
+            }
+
+            for (int row = 0; row < rows; row++) {
+                const float* x = src + row * IC + ic0;
+                // independent partial sums let compilers vectorize the reduction
+                float acc[lanes] = {};
+                size_t i = 0;
+                for (; i + lanes <= len; i += lanes) {
+                    for (size_t j = 0; j < lanes; j++)
+                        acc[j] += x[i + j] * decompressed[i + j];
+                }
+                float sum = 0.f;
+                for (; i < len; i++)
+                    sum += x[i] * decompressed[i];
+                for (size_t j = 0; j < lanes; j++)
+                    sum += acc[j];
+                dst[row * OC + oc] += sum;
+            }
+        }
+    });
+}
+
 void MKLDNNFullyConnectedNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false) {
     int blob_idx = 0;
     mkldnn::post_ops ops;
@@ -312,6 +586,9 @@ const std::vector<impl_desc_type>& MKLDNNFullyConnectedNode::getPrimitivesPriori
             impl_desc_type::jit_uni_dw,
             impl_desc_type::jit_uni_1x1,
             impl_desc_type::jit_uni,
+            impl_desc_type::jit_avx512_amx_dw,
+            impl_desc_type::jit_avx512_amx_1x1,
+            impl_desc_type::jit_avx512_amx,
             impl_desc_type::jit_avx512_dw,
             impl_desc_type::jit_avx512_1x1,
             impl_desc_type::jit_avx512,
@@ -19,6 +19,7 @@ public:
 
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
     bool canBeInPlace() const override {
         return false;
@@ -37,6 +38,33 @@ public:
     const mkldnn::memory& getWeights() const;
     const mkldnn::memory& getBias() const;
 
+    /**
+     * @brief Sets the minimal fraction of zero weight blocks to execute the layer by the block sparse kernel,
+     * 0 disables the kernel
+     */
+    void setSparseWeightsThreshold(float threshold) {
+        sparseWeightsThreshold = threshold;
+    }
+    bool isSparse() const {
+        return !sparseBlockOffsets.empty();
+    }
+
+    enum class WeightsCompression {
+        None,
+        FP16,
+        BF16,
+        I8
+    };
+    /**
+     * @brief Sets the precision to keep weights in, they are decompressed by the kernel while activations stay in FP32
+     */
+    void setWeightsCompression(WeightsCompression compression) {
+        weightsCompression = compression;
+    }
+    bool isCompressed() const {
+        return !compressedWeights.empty();
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -52,6 +80,32 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    bool canUseCustomKernel();
+    bool compressSparseWeights();
+    void executeSparse();
+    bool compressWeights();
+    void executeCompressed();
+
+    float sparseWeightsThreshold = 0.f;
+    /**
+     * @brief Weights in the block compressed sparse row format with blocks of sparseBlockSize output channels
+     * by one input channel: non-zero blocks of the i-th row of blocks are
+     * [sparseBlockOffsets[i], sparseBlockOffsets[i + 1]), their input channels are kept in sparseColumns
+     */
+    std::vector<int> sparseBlockOffsets;
+    std::vector<int> sparseColumns;
+    std::vector<float> sparseValues;
+    std::vector<float> sparseBiases;
+    static constexpr int sparseBlockSize = 16;
+
+    WeightsCompression weightsCompression = WeightsCompression::None;
+    /**
+     * @brief Weights of the [OC, IC] shape in the compressed precision, I8 weights are scaled per output channel
+     */
+    std::vector<uint8_t> compressedWeights;
+    std::vector<float> compressedScales;
+    std::vector<float> compressedBiases;
 };
 
 }  // namespace MKLDNNPlugin
@@ -21,6 +21,48 @@ using namespace InferenceEngine;
 MKLDNNGemmNode::MKLDNNGemmNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
         MKLDNNNode(layer, eng, cache) {}
 
+namespace {
+
+SizeVector getPlainStrides(const SizeVector& dims) {
+    SizeVector strides(dims.size(), 1);
+    for (int i = static_cast<int>(dims.size()) - 2; i >= 0; i--)
+        strides[i] = strides[i + 1] * dims[i + 1];
+    return strides;
+}
+
+SizeVector getIdentityOrder(size_t rank) {
+    SizeVector order(rank);
+    for (size_t i = 0; i < rank; i++)
+        order[i] = i;
+    return order;
+}
+
+}  // namespace
+
+void MKLDNNGemmNode::setInputOrder(size_t port, const SizeVector& order) {
+    if (port >= inputOrders.size() || port >= inDims.size() || order.size() != inDims[port].ndims())
+        THROW_IE_EXCEPTION << "Cannot set input order for port " << port << " of layer " << getName();
+
+    auto logicalDims = inDims[port].ToSizeVector();
+    SizeVector dims(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        dims[order[i]] = logicalDims[i];
+    inDims[port] = MKLDNNDims(dims);
+    inputOrders[port] = order;
+}
+
+void MKLDNNGemmNode::setOutputOrder(const SizeVector& order) {
+    if (outDims.empty() || order.size() != outDims[0].ndims())
+        THROW_IE_EXCEPTION << "Cannot set output order for layer " << getName();
+
+    auto logicalDims = outDims[0].ToSizeVector();
+    SizeVector dims(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        dims[i] = logicalDims[order[i]];
+    outDims[0] = MKLDNNDims(dims);
+    outputOrder = order;
+}
+
 void MKLDNNGemmNode::getSupportedDescriptors() {
     auto* gemmLayer = dynamic_cast<GemmLayer*>(getCnnLayer().get());
 
@@ -32,26 +74,50 @@ void MKLDNNGemmNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
 
-    auto inDims0 = getParentEdgeAt(0)->getDims();
-    auto inDims1 = getParentEdgeAt(1)->getDims();
-    auto outDims = getChildEdgeAt(0)->getDims();
+    auto physDims0 = getParentEdgeAt(0)->getDims().ToSizeVector();
+    auto physDims1 = getParentEdgeAt(1)->getDims().ToSizeVector();
+    auto physOutDims = getChildEdgeAt(0)->getDims().ToSizeVector();
 
     alpha = gemmLayer->alpha;
     beta = gemmLayer->beta;
     transposeA = gemmLayer->transpose_a;
     transposeB = gemmLayer->transpose_b;
 
-    if ((inDims0.ndims() < 2 || inDims0.ndims() > 4) ||
-        (inDims1.ndims() < 2 || inDims1.ndims() > 4))
+    if ((physDims0.size() < 2 || physDims0.size() > 4) ||
+        (physDims1.size() < 2 || physDims1.size() > 4))
         THROW_IE_EXCEPTION << "Unsupported input dims count for layer " << getName();
 
-    if (outDims.ndims() < 2 || outDims.ndims() > 4)
+    if (physOutDims.size() < 2 || physOutDims.size() > 4)
         THROW_IE_EXCEPTION << "Unsupported output dims count for layer " << getName();
 
-    if (inDims0.ndims() != inDims1.ndims() || inDims0.ndims() != outDims.ndims())
+    if (physDims0.size() != physDims1.size() || physDims0.size() != physOutDims.size())
         THROW_IE_EXCEPTION << "Invalid dims count for layer " << getName();
 
-    int nDims = inDims0.ndims();
+    nDims = physDims0.size();
+    auto order0 = inputOrders[0].empty() ? getIdentityOrder(nDims) : inputOrders[0];
+    auto order1 = inputOrders[1].empty() ? getIdentityOrder(nDims) : inputOrders[1];
+    auto orderOut = outputOrder.empty() ? getIdentityOrder(nDims) : outputOrder;
+    const size_t rank = physDims0.size();
+    if (order0.size() != rank || order1.size() != rank || orderOut.size() != rank)
+        THROW_IE_EXCEPTION << "Invalid input or output order for layer " << getName();
+    // the batch is processed along the outermost dim, so it must not be moved
+    if (nDims > 2 && (order0[0] != 0 || order1[0] != 0 || orderOut[0] != 0))
+        THROW_IE_EXCEPTION << "Unsupported input or output order for layer " << getName();
+
+    // logical dims and strides of the operands, they differ from the memory layout for folded permutations
+    SizeVector inDims0(nDims), inDims1(nDims), outDims(nDims);
+    SizeVector strides0(nDims), strides1(nDims), outStrides(nDims);
+    auto physStrides0 = getPlainStrides(physDims0);
+    auto physStrides1 = getPlainStrides(physDims1);
+    auto physOutStrides = getPlainStrides(physOutDims);
+    for (int i = 0; i < nDims; i++) {
+        inDims0[i] = physDims0[order0[i]];
+        strides0[i] = physStrides0[order0[i]];
+        inDims1[i] = physDims1[order1[i]];
+        strides1[i] = physStrides1[order1[i]];
+        outDims[orderOut[i]] = physOutDims[i];
+        outStrides[orderOut[i]] = physOutStrides[i];
+    }
     xAxis = nDims - 1;
     yAxis = nDims - 2;
     auto xAxis0 = transposeA ? yAxis : xAxis;
@@ -64,15 +130,37 @@ void MKLDNNGemmNode::getSupportedDescriptors() {
     if (inDims0[xAxis0] != inDims1[yAxis1] || inDims0[yAxis0] != outDims[yAxis] || inDims1[xAxis1] != outDims[xAxis])
         THROW_IE_EXCEPTION << "Spatial input and output dimensions are incorrect for layer " << getName();
 
+    // a permuted operand is passed to gemm as a strided matrix, transposed if its rows are contiguous
+    auto getLeadingDim = [&](const SizeVector& order, const SizeVector& strides, bool transpose, char& trans) {
+        bool rowsContiguous = order[yAxis] == rank - 1 && order[xAxis] != rank - 1;
+        if (!rowsContiguous && order[xAxis] != rank - 1)
+            THROW_IE_EXCEPTION << "Unsupported input order for layer " << getName();
+        trans = (transpose != rowsContiguous) ? 'T' : 'N';
+        return static_cast<int>(rowsContiguous ? strides[xAxis] : strides[yAxis]);
+    };
+    lda = getLeadingDim(order0, strides0, transposeA, transa);
+    ldb = getLeadingDim(order1, strides1, transposeB, transb);
+    if (orderOut[rank - 1] != static_cast<size_t>(xAxis))
+        THROW_IE_EXCEPTION << "Unsupported output order for layer " << getName();
+    ldc = outStrides[yAxis];
+
+    M = outDims[yAxis];
+    N = outDims[xAxis];
+    K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
+    batch2 = nDims > 3 ? outDims[nDims - 3] : 1;
+
     isThreeInputs = getParentEdges().size() == 3;
 
     if (isThreeInputs) {
+        if (!outputOrder.empty())
+            THROW_IE_EXCEPTION << "Output order is not supported with three inputs for layer " << getName();
+
         auto inDims2 = getParentEdgeAt(2)->getDims();
 
         if (inDims2.ndims() < 2 || inDims2.ndims() > 4)
             THROW_IE_EXCEPTION << "Unsupported output dims count for layer " << getName();
 
-        if (inDims2.ndims() != outDims.ndims())
+        if (inDims2.ndims() != outDims.size())
             THROW_IE_EXCEPTION << "Invalid dims count for layer " << getName();
 
         if (inDims2[yAxis] != outDims[yAxis] || inDims2[xAxis] != outDims[xAxis])
@@ -97,15 +185,9 @@ void MKLDNNGemmNode::getSupportedDescriptors() {
             THROW_IE_EXCEPTION << "Input batch dimensions are incorrect for layer " << getName();
         }
 
-        int aOffset = 1;
-        for (int i = dim_idx + 1; i < nDims; i++)
-            aOffset *= inDims0[i];
-        aOffsets.push_back(inDims0[dim_idx] == outDims[dim_idx] ? aOffset : 0);
-
-        int bOffset = 1;
-        for (int i = dim_idx + 1; i < nDims; i++)
-            bOffset *= inDims1[i];
-        bOffsets.push_back(inDims1[dim_idx] == outDims[dim_idx] ? bOffset : 0);
+        aOffsets.push_back(inDims0[dim_idx] == outDims[dim_idx] ? strides0[dim_idx] : 0);
+        bOffsets.push_back(inDims1[dim_idx] == outDims[dim_idx] ? strides1[dim_idx] : 0);
+        dOffsets.push_back(outStrides[dim_idx]);
     }
 
     for (unsigned long dim_idx = aOffsets.size(); dim_idx < 2; dim_idx++)
@@ -114,6 +196,8 @@ void MKLDNNGemmNode::getSupportedDescriptors() {
         bOffsets.push_back(0);
     for (unsigned long dim_idx = cOffsets.size(); dim_idx < 2; dim_idx++)
         cOffsets.push_back(0);
+    for (unsigned long dim_idx = dOffsets.size(); dim_idx < 2; dim_idx++)
+        dOffsets.push_back(0);
 }
 
 void MKLDNNGemmNode::initSupportedPrimitiveDescriptors() {
@@ -225,10 +309,6 @@ inline void process_gemm(char transa, char transb, int M, int N, int K, float al
 
 template<typename T0, typename T1>
 void MKLDNNGemmNode::process_data() {
-    auto inDims0 = getParentEdgeAt(0)->getDims();
-    auto inDims1 = getParentEdgeAt(1)->getDims();
-    auto outDims = getChildEdgeAt(0)->getDims();
-
     auto& srcMemory0 = getParentEdgeAt(0)->getMemory();
     auto& srcMemory1 = getParentEdgeAt(1)->getMemory();
 
@@ -239,18 +319,8 @@ void MKLDNNGemmNode::process_data() {
     float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
                      getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-    int MB1 = outDims.ndims() == 4 ? batchToProcess() : 1;
-    int MB2 = outDims.ndims() == 3 ? batchToProcess() : outDims.ndims() > 3 ? outDims[outDims.ndims() - 3] : 1;
-    int M = outDims[yAxis];
-    int N = outDims[xAxis];
-    int K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
-
-    const char transa = transposeA ? 'T' : 'N';
-    const char transb = transposeB ? 'T' : 'N';
-
-    int lda = transposeA ? M : K;
-    int ldb = transposeB ? K : N;
-    int ldc = N;
+    int MB1 = nDims == 4 ? batchToProcess() : 1;
+    int MB2 = nDims == 3 ? batchToProcess() : nDims > 3 ? batch2 : 1;
 
     const float *src2_ptr;
     if (isThreeInputs) {
@@ -281,12 +351,12 @@ void MKLDNNGemmNode::process_data() {
 
             a_ptr += aOffsets[0];
             b_ptr += bOffsets[0];
-            d_ptr += M * N;
+            d_ptr += dOffsets[0];
         }
 
         src0_ptr += aOffsets[1];
         src1_ptr += bOffsets[1];
-        dst_ptr += MB2 * M * N;
+        dst_ptr += dOffsets[1];
 
         if (isThreeInputs) {
             src2_ptr += cOffsets[1];
@@ -24,20 +24,48 @@ public:
     bool created() const override;
     int getMaxBatch() override;
 
+    /**
+     * Makes the node read input @p port through a permutation: logical dim i of the input is dim order[i] of the
+     * tensor connected to the port. The innermost dim of that tensor has to be one of the two matrix dims.
+     */
+    void setInputOrder(size_t port, const InferenceEngine::SizeVector& order);
+    /**
+     * Makes the node write the result permuted: dim i of the output is dim order[i] of the product.
+     * The innermost dim of the product has to stay innermost.
+     */
+    void setOutputOrder(const InferenceEngine::SizeVector& order);
+
 private:
     float alpha = 1.0f;
     float beta = 1.0f;
     bool transposeA = false;
     bool transposeB = false;
 
+    int nDims = 0;
     int xAxis = 0;
     int yAxis = 0;
 
+    int M = 0;
+    int N = 0;
+    int K = 0;
+    int batch2 = 1;
+
     bool isThreeInputs = false;
 
     std::vector<int> aOffsets;
     std::vector<int> bOffsets;
     std::vector<int> cOffsets;
+    std::vector<int> dOffsets;
+
+    // permutations folded from Permute layers, empty for plain inputs and output
+    std::vector<InferenceEngine::SizeVector> inputOrders = {{}, {}};
+    InferenceEngine::SizeVector outputOrder;
+
+    char transa = 'N';
+    char transb = 'N';
+    int lda = 0;
+    int ldb = 0;
+    int ldc = 0;
 
     template<typename T0, typename T1> void process_data();
 };
@@ -9,6 +9,8 @@
 #include <algorithm>
 #include "caseless.hpp"
 #include "common/cpu_memcpy.h"
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -95,6 +97,33 @@ void MKLDNNInputNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set for node " << getName() << ".";
 }
 
+bool MKLDNNInputNode::isOutputMemoryRebindable() {
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto& child = getChildEdgeAt(i)->getChild();
+        if (child->isConstant())
+            return false;
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+#endif
+        // Cannot be in-place before split because split is using different ptrs without offsets
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+        if (dynamic_cast<MKLDNNSplitNode *>(child.get()))
+            return false;
+#endif
+
+        if (child->isInplace())
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
+                return false;
+        }
+    }
+    return true;
+}
+
 bool MKLDNNInputNode::created() const {
     return getType() == Input || getType() == Output;
 }
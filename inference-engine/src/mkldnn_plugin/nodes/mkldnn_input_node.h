@@ -21,10 +21,19 @@ public:
     bool created() const override;
 
     void execute(mkldnn::stream strm) override;
+    bool isExecutable() override {
+        return constBlob && MKLDNNNode::isExecutable();
+    }
     void withMeanImage() {
         isMeanImage = true;
     }
 
+    /**
+     * @brief Checks whether the output memory can be replaced by changing its data handle,
+     * i.e. consumers neither work in-place nor keep pointers derived from it
+     */
+    bool isOutputMemoryRebindable();
+
 private:
     InferenceEngine::Precision precision;
 
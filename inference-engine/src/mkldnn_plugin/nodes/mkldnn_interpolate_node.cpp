@@ -14,6 +14,7 @@
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
+#include "mkldnn_selective_build.h"
 #include <algorithm>
 
 #include "jit_generator.hpp"
@@ -1641,12 +1642,12 @@ void MKLDNNInterpolateNode::initSupportedPrimitiveDescriptors() {
 
     if (mode != InterpolateMode::linear) {
         // blk and by_channel JIT kernel on sse42 or above machine
-        if (mayiuse(cpu::sse42)) {
+        if (MKLDNN_ISA(sse42)) {
             if (getParentEdgeAt(DATA_ID)->getDims().ndims() == 4) {
-                if (mayiuse(cpu::avx512_common)) {
+                if (MKLDNN_ISA(avx512_common)) {
                     pushDesc(memory::nhwc, jit_avx512);
                     pushDesc(memory::nChw16c, jit_avx512);
-                } else if (mayiuse(cpu::avx2)) {
+                } else if (MKLDNN_ISA(avx2)) {
                     pushDesc(memory::nhwc, jit_avx2);
                     pushDesc(memory::nChw8c, jit_avx2);
                 } else {
@@ -1654,10 +1655,10 @@ void MKLDNNInterpolateNode::initSupportedPrimitiveDescriptors() {
                     pushDesc(memory::nChw8c, jit_sse42);
                 }
             } else if (getParentEdgeAt(DATA_ID)->getDims().ndims() == 5 && mode == InterpolateMode::nearest) {
-                if (mayiuse(cpu::avx512_common)) {
+                if (MKLDNN_ISA(avx512_common)) {
                     pushDesc(memory::ndhwc, jit_avx512);
                     pushDesc(memory::nCdhw16c, jit_avx512);
-                } else if (mayiuse(cpu::avx2)) {
+                } else if (MKLDNN_ISA(avx2)) {
                     pushDesc(memory::ndhwc, jit_avx2);
                     pushDesc(memory::nCdhw8c, jit_avx2);
                 } else {
@@ -1668,10 +1669,10 @@ void MKLDNNInterpolateNode::initSupportedPrimitiveDescriptors() {
         }
 
         // planar for 1.ref on machine without sse42(if no sse42, canFuse() is false). 2.JIT kernel for f32 && avx2(gather).(with fuse)
-        if (!mayiuse(cpu::sse42))
+        if (!MKLDNN_ISA(sse42))
             pushDesc(MKLDNNMemory::GetPlainFormat(getParentEdgeAt(DATA_ID)->getDims()), ref);
 
-        if (mayiuse(cpu::avx2) && inputPrec == Precision::FP32) {
+        if (MKLDNN_ISA(avx2) && inputPrec == Precision::FP32) {
             pushDesc(MKLDNNMemory::GetPlainFormat(getParentEdgeAt(DATA_ID)->getDims()), jit_avx2);
         }
     } else {
@@ -1725,16 +1726,16 @@ void MKLDNNInterpolateNode::createPrimitive() {
 
     if (mode == InterpolateMode::nearest || mode == InterpolateMode::linear_onnx || mode == InterpolateMode::cubic) {
         if (jcp.layout != InterpolateLayoutType::planar) {
-            if (mayiuse(cpu::avx512_common)) {
+            if (MKLDNN_ISA(avx512_common)) {
                 interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
-            } else if (mayiuse(cpu::avx2)) {
+            } else if (MKLDNN_ISA(avx2)) {
                 interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::avx2>(jcp, *attr.get()));
-            } else if (mayiuse(cpu::sse42)) {
+            } else if (MKLDNN_ISA(sse42)) {
                 interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::sse42>(jcp, *attr.get()));
             }
         } else {
             // gather ISA(for planar JIT kernel) for avx2 and fp32
-            if (mayiuse(cpu::avx2) && inputPrec == Precision::FP32) {
+            if (MKLDNN_ISA(avx2) && inputPrec == Precision::FP32) {
                 interpolateKernel.reset(new jit_uni_interpolate_kernel_f32<cpu::avx2>(jcp, *attr.get()));
             }
         }
@@ -2184,7 +2185,7 @@ void MKLDNNInterpolateNode::execute(mkldnn::stream strm) {
             });
             src_data = src_data_pad;
         } else if (layout == InterpolateLayoutType::block) {
-            size_t blkSize = mayiuse(cpu::avx512_common) ? 16 : 8;
+            size_t blkSize = MKLDNN_ISA(avx512_common) ? 16 : 8;
             size_t CB = div_up(srcDimPad5d[1], blkSize);
             size_t eltsTotal = srcDimPad5d[0] * CB * srcDimPad5d[2] * srcDimPad5d[3] * srcDimPad5d[4] * blkSize;
             srcPadded.resize(eltsTotal * srcDataSize, 0x0);
@@ -2303,7 +2304,7 @@ void MKLDNNInterpolateNode::NNCGathered(const uint8_t *in_ptr_, uint8_t *out_ptr
                 (*interpolateKernel)(&arg);
             });
         } else {  // for blk
-            int blk_size = mayiuse(cpu::avx512_common) ? 16 : 8;
+            int blk_size = MKLDNN_ISA(avx512_common) ? 16 : 8;
             int CB = div_up(C, blk_size);
             const uint8_t *in_ptr = in_ptr_ + (IW * IH * ID * CB * blk_size * b) * srcDataSize;
             uint8_t *out_ptr = out_ptr_ + (OW * OH * OD * CB * blk_size * b) * dstDataSize;
@@ -2412,7 +2413,7 @@ void MKLDNNInterpolateNode::linearOnnxCGathered(const uint8_t *in_ptr_, uint8_t
     Layout layout = getParentEdgeAt(0)->getDesc().getLayout();
     bool isByChannel = (layout == NHWC) ? true : false;
 
-    int blkSize = mayiuse(cpu::avx512_common) ? 16 : 8;
+    int blkSize = MKLDNN_ISA(avx512_common) ? 16 : 8;
     int CB = div_up(C, blkSize);
     int CSize = isByChannel ? C : blkSize * CB;
     int CGatherLen = isByChannel ? C : blkSize;
@@ -2517,73 +2518,58 @@ void MKLDNNInterpolateNode::linearInterpolation(const uint8_t *in_ptr_, uint8_t
     int *idxOH = static_cast<int*>(&idxTable[sizeOD]);
     int *idxOW = static_cast<int*>(&idxTable[sizeOD + sizeOH]);
 
-    parallel_for2d(B, C, [&](size_t b, size_t c) {
+    // The kernel is separable: for every output row the depth and height taps are accumulated into a row of
+    // input width first, then the width taps are applied to that row. The sum of weights is separable as well.
+    std::vector<float> wsumOD(OD, 0.f), wsumOH(OH, 0.f), wsumOW(OW, 0.f);
+    for (size_t oz = 0; oz < OD; oz++)
+        for (int iz = 0; iz < diaOD; iz++)
+            wsumOD[oz] += weightOD[oz * diaOD + iz];
+    for (size_t oy = 0; oy < OH; oy++)
+        for (int iy = 0; iy < diaOH; iy++)
+            wsumOH[oy] += weightOH[oy * diaOH + iy];
+    for (size_t ox = 0; ox < OW; ox++)
+        for (int ix = 0; ix < diaOW; ix++)
+            wsumOW[ox] += weightOW[ox * diaOW + ix];
+
+    parallel_for3d(B, C, OD, [&](size_t b, size_t c, size_t oz) {
         const uint8_t *in_ptr_nc = in_ptr_ + (IW * IH * ID * C * b + IW * IH * ID * c) * srcDataSize;
-        uint8_t *out_ptr_nc = out_ptr_ + (OW * OH * OD * C * b + OW * OH * OD * c) * dstDataSize;
-        for (size_t oz = 0; oz < OD; oz++) {
-            uint8_t *out_ptr_ncd = out_ptr_nc + (OW * OH * oz) * dstDataSize;
-            for (size_t oy = 0; oy < OH; oy++) {
-                uint8_t *out_ptr_ncdh = out_ptr_ncd + (OW * oy) * dstDataSize;
-                for (size_t ox = 0; ox < OW; ox++) {
-                    float sum = 0.f;
-                    float wsum = 0.f;
-
-                    // this comment explains the original algo.
-                    // for (int z = iz_r - rz; z <= iz_r + rz; z++) {
-                    //    for (int y = iy_r - ry; y <= iy_r + ry; y++) {
-                    //        for (int x = ix_r - rx; x <= ix_r + rx; x++) {
-                    //            bool is_continue =  z < 0                     ||
-                    //                                y < 0                     ||
-                    //                                x < 0                     ||
-                    //                                z >= static_cast<int>(ID) ||
-                    //                                y >= static_cast<int>(IH) ||
-                    //                                x >= static_cast<int>(IW);
-                    //            if (is_continue)
-                    //                continue;
-
-                    //            float dx = ix - x;
-                    //            float dy = iy - y;
-                    //            float dz = iz - z;
-
-                    //            float w = ax * triangleCoeff(ax * dx) *
-                    //                      ay * triangleCoeff(ay * dy) *
-                    //                      az * triangleCoeff(az * dz);
-
-                    //            sum += w * getValue(in_ptr_nc, (z * IH * IW + y * IW + x) * srcDataSize, inputPrec);
-                    //            wsum += w;
-                    //        }
-                    //    }
-                    //}
-
-                    for (int iz = 0; iz < diaOD; iz++) {
-                        if (weightOD[oz * diaOD + iz] == 0.f)
-                            continue;
-                        for (int iy = 0; iy < diaOH; iy++) {
-                            if (weightOH[oy * diaOH + iy] == 0.f) {
-                                continue;
-                            }
-                            for (int ix = 0; ix < diaOW; ix++) {
-                                if (weightOW[ox * diaOW + ix] == 0.f) {
-                                    continue;
-                                }
-                                float w = weightOD[oz * diaOD + iz] * weightOH[oy * diaOH + iy] * weightOW[ox * diaOW + ix];
-                                float value = getValue(in_ptr_nc,
-                                    (idxOD[oz * diaOD + iz] * IH * IW + idxOH[oy * diaOH + iy] * IW + idxOW[ox * diaOW + ix]) * srcDataSize, inputPrec);
-
-                                sum += w * value;
-                                wsum += w;
-                            }
-                        }
-                    }
-
-                    if (!wsum) {
-                        setValue(out_ptr_ncdh, ox * dstDataSize, 0.f, outputPrec);
+        uint8_t *out_ptr_ncd = out_ptr_ + (OW * OH * OD * C * b + OW * OH * OD * c + OW * OH * oz) * dstDataSize;
+        std::vector<float> row(IW);
+        for (size_t oy = 0; oy < OH; oy++) {
+            uint8_t *out_ptr_ncdh = out_ptr_ncd + (OW * oy) * dstDataSize;
+            std::fill(row.begin(), row.end(), 0.f);
+            for (int iz = 0; iz < diaOD; iz++) {
+                float wz = weightOD[oz * diaOD + iz];
+                if (wz == 0.f)
+                    continue;
+                for (int iy = 0; iy < diaOH; iy++) {
+                    float wy = weightOH[oy * diaOH + iy];
+                    if (wy == 0.f)
+                        continue;
+                    float w = wz * wy;
+                    size_t offset = idxOD[oz * diaOD + iz] * IH * IW + idxOH[oy * diaOH + iy] * IW;
+                    if (inputPrec == Precision::FP32) {
+                        const float *in_row = reinterpret_cast<const float *>(in_ptr_nc) + offset;
+                        for (size_t x = 0; x < IW; x++)
+                            row[x] += w * in_row[x];
                     } else {
-                        float dst_value = sum / wsum;
-                        setValue(out_ptr_ncdh, ox * dstDataSize, dst_value, outputPrec);
+                        for (size_t x = 0; x < IW; x++)
+                            row[x] += w * getValue(in_ptr_nc, (offset + x) * srcDataSize, inputPrec);
                     }
                 }
             }
+
+            for (size_t ox = 0; ox < OW; ox++) {
+                float sum = 0.f;
+                for (int ix = 0; ix < diaOW; ix++) {
+                    float wx = weightOW[ox * diaOW + ix];
+                    if (wx != 0.f)
+                        sum += wx * row[idxOW[ox * diaOW + ix]];
+                }
+
+                float wsum = wsumOD[oz] * wsumOH[oy] * wsumOW[ox];
+                setValue(out_ptr_ncdh, ox * dstDataSize, wsum == 0.f ? 0.f : sum / wsum, outputPrec);
+            }
         }
     });
 }
@@ -2598,7 +2584,7 @@ void MKLDNNInterpolateNode::cubicCGathered(const uint8_t *in_ptr_, uint8_t *out_
     Layout layout = getParentEdgeAt(0)->getDesc().getLayout();
     bool isByChannel = (layout == NHWC) ? true : false;
 
-    int blkSize = mayiuse(cpu::avx512_common) ? 16 : 8;
+    int blkSize = MKLDNN_ISA(avx512_common) ? 16 : 8;
     int CB = div_up(C, blkSize);
     int CSize = isByChannel ? C : blkSize * CB;
     int CGatherLen = isByChannel ? C : blkSize;
@@ -2844,7 +2830,7 @@ bool MKLDNNInterpolateNode::canFuse(const MKLDNNNodePtr& node) const {
         return false;
     };
 
-    if (!mayiuse(cpu::sse42))
+    if (!MKLDNN_ISA(sse42))
         return false;
     if (mode == InterpolateMode::linear || mode == InterpolateMode::cubic)
         return false;
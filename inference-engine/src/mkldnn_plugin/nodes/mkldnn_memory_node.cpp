@@ -61,11 +61,54 @@ MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr&
 void MKLDNNMemoryInputNode::createPrimitive() {
     MKLDNNInputNode::createPrimitive();
 
-    auto mem_desc = getChildEdgeAt(0)->getMemoryPtr()->GetDescriptor();
-    dataStore->Create(mem_desc);
+    if (isSlidingWindow()) {
+        auto window = windowNode.lock();
+        IE_ASSERT(window != nullptr);
+        for (size_t i = 0; i < window->getParentEdges().size(); i++)
+            windowMemory.push_back(window->getParentEdgeAt(i)->getMemoryPtr());
+        for (size_t i = 0; i < window->getChildEdges().size(); i++)
+            windowMemory.push_back(window->getChildEdgeAt(i)->getMemoryPtr());
+
+        auto state_dims = getChildEdgeAt(0)->getDims();
+        auto data_type = getChildEdgeAt(0)->getMemory().GetDataType();
+        windowStateRows = static_cast<size_t>(state_dims[1]);
+        ringRowSize = state_dims.size(2) * MKLDNNExtensionUtils::sizeOfDataType(data_type);
+        // the state is moved to the beginning once per (state + frame) / frame inferences,
+        // so an inference copies less than a frame on average
+        ringRows = 2 * (windowStateRows + windowFrameRows);
+
+        auto ring_dims = state_dims.ToSizeVector();
+        ring_dims[1] = ringRows;
+        ringBuffer.reset(new MKLDNNMemory(getEngine()));
+        ringBuffer->Create(MKLDNNDims(ring_dims), data_type, MKLDNNMemory::GetPlainFormat(MKLDNNDims(ring_dims)));
+        // default memory state is zero filled
+        ringBuffer->FillZero();
+
+        windowPosition = 0;
+        windowStepPending = false;
+        dataStore->Create(MKLDNNMemoryDesc(state_dims, data_type, MKLDNNMemory::GetPlainFormat(state_dims)),
+                          ringBuffer->GetData());
+        bindWindow();
+        return;
+    }
+
+    // consumers may read the state directly if their input memory can be substituted,
+    // memory of graph outputs is substituted by the infer request itself
+    inPlaceRead = isOutputMemoryRebindable();
+    for (size_t i = 0; inPlaceRead && i < getChildEdges().size(); i++) {
+        if (getChildEdgeAt(i)->getChild()->getType() == Output)
+            inPlaceRead = false;
+    }
 
-    // default memory state is zero filled
-    dataStore->FillZero();
+    auto mem_desc = getChildEdgeAt(0)->getMemoryPtr()->GetDescriptor();
+    for (int i = 0; i < (inPlaceRead ? 2 : 1); i++) {
+        storeBuffers[i].reset(new MKLDNNMemory(getEngine()));
+        storeBuffers[i]->Create(mem_desc);
+        // default memory state is zero filled
+        storeBuffers[i]->FillZero();
+    }
+    frontBuffer = 0;
+    dataStore->Create(mem_desc, storeBuffers[frontBuffer]->GetData());
 }
 
 /**
@@ -100,14 +143,99 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+void* MKLDNNMemoryInputNode::getBufferData(int idx) const {
+    return idx == boundBuffer ? boundState->buffer().as<void*>() : storeBuffers[idx]->GetData();
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
+    if (!inPlaceRead) {
+        // TODO: Should be next one call:
+        //           dataStore.SetData(new_state, false);
+        //       But because of performance reason we use simple manual copy
+        simple_copy(*dataStore, new_state);
+        return;
+    }
+
+    // consumers of the current state may be executed after this node, so the new state goes to the back buffer
+    int backBuffer = frontBuffer ^ 1;
+    dataStore->GetPrimitivePtr()->set_data_handle(getBufferData(backBuffer));
     simple_copy(*dataStore, new_state);
+    frontBuffer = backBuffer;
+}
+
+bool MKLDNNMemoryInputNode::bindState(const Blob::Ptr& state) {
+    if (!inPlaceRead || !state)
+        return false;
+
+    const auto& desc = state->getTensorDesc();
+    auto data_type = MKLDNNExtensionUtils::IEPrecisionToDataType(desc.getPrecision());
+    if (data_type != dataStore->GetDataType() || state->byteSize() != dataStore->GetSize() ||
+            desc.getBlockingDesc().getOffsetPadding() != 0 ||
+            MKLDNNMemory::Convert(desc.getLayout()) != dataStore->GetFormat() ||
+            dataStore->GetFormat() != MKLDNNMemory::GetPlainFormat(dataStore->GetDims()))
+        return false;
+
+    boundState = state;
+    boundBuffer = frontBuffer;
+    dataStore->GetPrimitivePtr()->set_data_handle(getBufferData(frontBuffer));
+    return true;
+}
+
+void MKLDNNMemoryInputNode::unbindState() {
+    if (!boundState)
+        return;
+
+    boundState.reset();
+    boundBuffer = -1;
+    dataStore->GetPrimitivePtr()->set_data_handle(getBufferData(frontBuffer));
+}
+
+void MKLDNNMemoryInputNode::setSlidingWindow(const MKLDNNNodePtr& window, size_t frameRows) {
+    windowNode = window;
+    windowFrameRows = frameRows;
+}
+
+void MKLDNNMemoryInputNode::bindWindow() {
+    auto window = static_cast<uint8_t*>(ringBuffer->GetData()) + windowPosition * ringRowSize;
+    dataStore->GetPrimitivePtr()->set_data_handle(window);
+    // views of the window keep their offsets in descriptors, so all of them get the same handle
+    for (auto& memory : windowMemory)
+        memory->GetPrimitivePtr()->set_data_handle(window);
+}
+
+void MKLDNNMemoryInputNode::finishWindowStep() {
+    if (!windowStepPending)
+        return;
+
+    windowStepPending = false;
+    windowPosition += windowFrameRows;
+    if (windowPosition + windowStateRows + windowFrameRows > ringRows) {
+        auto ring = static_cast<uint8_t*>(ringBuffer->GetData());
+        cpu_memcpy(ring, ring + windowPosition * ringRowSize, windowStateRows * ringRowSize);
+        windowPosition = 0;
+    }
+    bindWindow();
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
+    if (isSlidingWindow()) {
+        // the node is executed first, so the frame of this inference is appended right after the state
+        finishWindowStep();
+        windowStepPending = true;
+        return;
+    }
+
+    if (inPlaceRead) {
+        // consumers read the state itself, only the data handle is passed
+        void* state = dataStore->GetData();
+        for (size_t i = 0; i < getChildEdges().size(); i++) {
+            auto& dst_prim = getChildEdgeAt(i)->getMemory().GetPrimitivePtr();
+            if (dst_prim->get_data_handle() != state)
+                dst_prim->set_data_handle(state);
+        }
+        return;
+    }
+
     auto dst_mem = getChildEdgeAt(0)->getMemory();
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
@@ -11,6 +11,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -98,14 +99,75 @@ public:
         return getType() == MemoryInput;
     }
     void execute(mkldnn::stream strm) override;
+    // the state is copied in by execute, unlike a regular input which is filled by the infer request
+    bool isExecutable() override {
+        return MKLDNNNode::isExecutable();
+    }
 
     void createPrimitive() override;
 
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+
+    /**
+     * @brief Uses memory of the blob as the state storage, so the state is neither copied in nor out.
+     * The blob keeps the current state and becomes one of two buffers which are swapped after every inference.
+     * @return false if the state is not stored in place or the blob is not compatible with it
+     */
+    bool bindState(const InferenceEngine::Blob::Ptr& state);
+    /**
+     * @brief Returns the state storage to internal buffers, the state value is not preserved
+     */
+    void unbindState();
+
+    /**
+     * @brief Keeps the state in a ring buffer which is also the memory of the in-place concatenation
+     * of the state and a new frame along the outermost axis. The window is read in place and the new state
+     * is the window without its first frame, so an inference appends a frame instead of copying the window.
+     * @param window the in-place concatenation node
+     * @param frameRows size of the frame along the concatenation axis
+     */
+    void setSlidingWindow(const MKLDNNNodePtr& window, size_t frameRows);
+    bool isSlidingWindow() const {
+        return windowFrameRows != 0;
+    }
+    /**
+     * @brief Moves the window to the state produced by the last inference, it is done lazily
+     * by the next inference or before the state is accessed
+     */
+    void finishWindowStep();
+
  private:
+    void* getBufferData(int idx) const;
+    void bindWindow();
+
+    /**
+     * @brief The current state, its data handle points to the front buffer
+     */
     MKLDNNMemoryPtr dataStore;
+    /**
+     * @brief Internal buffers, the second one is used only if the state is read in place.
+     * In that case consumers read the front buffer while the new state is written to the back one.
+     */
+    MKLDNNMemoryPtr storeBuffers[2];
+    int frontBuffer = 0;
+    bool inPlaceRead = false;
+    InferenceEngine::Blob::Ptr boundState;
+    int boundBuffer = -1;
+
+    MKLDNNNodeWeakPtr windowNode;
+    /**
+     * @brief Memory of the window edges, it is rebound to the window position in the ring buffer
+     */
+    std::vector<MKLDNNMemoryPtr> windowMemory;
+    MKLDNNMemoryPtr ringBuffer;
+    size_t windowFrameRows = 0;
+    size_t windowStateRows = 0;
+    size_t ringRows = 0;
+    size_t ringRowSize = 0;
+    size_t windowPosition = 0;
+    bool windowStepPending = false;
     static Registrar<MKLDNNMemoryInputNode> reg;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
@@ -14,12 +14,15 @@
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
+#include "mkldnn_selective_build.h"
 #include <algorithm>
 
 #include "jit_generator.hpp"
 #include "jit_uni_eltwise.hpp"
 #include "jit_uni_depthwise.hpp"
 #include "jit_uni_quantization.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "common/cpu_row_kernels.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -88,13 +91,13 @@ struct jit_uni_mvn_mean_variance_kernel_f32 : public jit_uni_mvn_mean_variance_k
                 load_vector(vmm_val, ptr[reg_src], jcp_.src_dt);
 
                 if (jcp_.normalize_variance) {
-                    if (jcp_.src_dt != memory::f32)
+                    if (jcp_.src_dt != memory::f32 && jcp_.src_dt != memory::bf16)
                         uni_vcvtdq2ps(vmm_val, vmm_val);
 
                     uni_vsubps(vmm_val, vmm_val, vmm_mean);
                     uni_vfmadd231ps(vmm_variance, vmm_val, vmm_val);
                 } else {
-                    if (jcp_.src_dt != memory::f32)
+                    if (jcp_.src_dt != memory::f32 && jcp_.src_dt != memory::bf16)
                         uni_vpaddd(vmm_sum, vmm_sum, vmm_val);
                     else
                         uni_vaddps(vmm_sum, vmm_sum, vmm_val);
@@ -138,7 +141,7 @@ struct jit_uni_mvn_mean_variance_kernel_f32 : public jit_uni_mvn_mean_variance_k
 
                     uni_vmovups(ptr[reg_variance], vmm_variance);
                 } else {
-                    if (jcp_.src_dt != memory::f32)
+                    if (jcp_.src_dt != memory::f32 && jcp_.src_dt != memory::bf16)
                         uni_vcvtdq2ps(vmm_sum, vmm_sum);
 
                     if (!jcp_.planar_layout && !jcp_.across_channels) {
@@ -199,6 +202,10 @@ private:
             case memory::u8:
                 uni_vpmovzxbd(vmm_src, op);
                 break;
+            case memory::bf16:
+                uni_vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
             default:
                 assert(!"unknown dst_dt");
         }
@@ -348,11 +355,15 @@ private:
             case memory::u8:
                 uni_vpmovzxbd(vmm_src, op);
                 break;
+            case memory::bf16:
+                uni_vpmovzxwd(vmm_src, op);
+                uni_vpslld(vmm_src, vmm_src, 16);
+                break;
             default:
                 assert(!"unknown dst_dt");
         }
 
-        if (src_dt != memory::f32)
+        if (src_dt != memory::f32 && src_dt != memory::bf16)
             uni_vcvtdq2ps(vmm_src, vmm_src);
     }
 
@@ -391,6 +402,13 @@ private:
                 else
                     movd(op, xmm_dst);
             }
+        } else if (dst_dt == memory::bf16) {
+            if (mayiuse(avx512_core_bf16)) {
+                vcvtneps2bf16(ymm_dst, vmm_dst);
+                uni_vmovups(op, ymm_dst);
+            } else {
+                assert(!"data type of bf16 is only supported for ISA:avx512_core_bf16");
+            }
         }
     }
 
@@ -413,7 +431,7 @@ private:
                 depthwise_inj_idx++;
             } else if (post_op.is_quantization()) {
                 bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
-                bool do_rounding = do_dequantization || dst_dt == memory::f32 || i != p.len_ - 1;
+                bool do_rounding = do_dequantization || dst_dt == memory::f32 || dst_dt == memory::bf16 || i != p.len_ - 1;
                 int s_idx = vmm_val.getIdx();
 
                 quantization_injectors[quantization_inj_idx]->init_crop_ptrs(reg_oc_off);
@@ -479,6 +497,21 @@ void MKLDNNMVNNode::initSupportedPrimitiveDescriptors() {
         outputPrecision = Precision::FP32;
     }
 
+    // bf16 is read and written by the nhwc and blocked kernels only and is not mixed with int8
+    if (!mayiuse(avx512_core_bf16)) {
+        if (inputPrecision == Precision::BF16)
+            inputPrecision = Precision::FP32;
+        if (outputPrecision == Precision::BF16)
+            outputPrecision = Precision::FP32;
+    }
+    if (inputPrecision == Precision::BF16 && outputPrecision != Precision::BF16 && outputPrecision != Precision::FP32)
+        inputPrecision = Precision::FP32;
+    if (outputPrecision == Precision::BF16 && inputPrecision != Precision::BF16 && inputPrecision != Precision::FP32)
+        outputPrecision = Precision::FP32;
+    auto isFloatPrecision = [](Precision prc) {
+        return prc == Precision::FP32 || prc == Precision::BF16;
+    };
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
 
@@ -512,26 +545,27 @@ void MKLDNNMVNNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
-    if (inputPrecision == Precision::FP32 && outputPrecision == Precision::FP32) {
+    if (isFloatPrecision(inputPrecision) && isFloatPrecision(outputPrecision)) {
         if (getParentEdgeAt(0)->getDims().ndims() == 4) {
-            if (mayiuse(cpu::avx512_common)) {
+            if (MKLDNN_ISA(avx512_common)) {
                 pushDesc(memory::nChw16c);
-            } else if (mayiuse(cpu::avx2) || mayiuse(cpu::sse42)) {
+            } else if (MKLDNN_ISA(avx2) || MKLDNN_ISA(sse42)) {
                 pushDesc(memory::nChw8c);
             }
         } else if (getParentEdgeAt(0)->getDims().ndims() == 5) {
-            if (mayiuse(cpu::avx512_common)) {
+            if (MKLDNN_ISA(avx512_common)) {
                 pushDesc(memory::nCdhw16c);
-            } else if (mayiuse(cpu::avx2) || mayiuse(cpu::sse42)) {
+            } else if (MKLDNN_ISA(avx2) || MKLDNN_ISA(sse42)) {
                 pushDesc(memory::nCdhw8c);
             }
         }
 
-        if (fusedWith.empty()) {
-            if (canBeInplace)
-                config.inConfs[0].inPlace = 0;
-            pushDesc(MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims()));
-        }
+    }
+
+    if (inputPrecision == Precision::FP32 && outputPrecision == Precision::FP32 && fusedWith.empty()) {
+        if (canBeInplace)
+            config.inConfs[0].inPlace = 0;
+        pushDesc(MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims()));
     }
 }
 
@@ -555,7 +589,7 @@ void MKLDNNMVNNode::createPrimitive() {
     jcp.normalize_variance = normalize_variance;
     jcp.across_channels = across_channels;
 
-    if (mayiuse(cpu::avx512_common)) {
+    if (MKLDNN_ISA(avx512_common)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
 
         jcp.normalize_variance = false;
@@ -564,7 +598,7 @@ void MKLDNNMVNNode::createPrimitive() {
             jcp.normalize_variance = true;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
         }
-    } else if (mayiuse(cpu::avx2)) {
+    } else if (MKLDNN_ISA(avx2)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx2>(jcp, *attr.get()));
 
         jcp.normalize_variance = false;
@@ -573,7 +607,7 @@ void MKLDNNMVNNode::createPrimitive() {
             jcp.normalize_variance = true;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
         }
-    } else if (mayiuse(cpu::sse42)) {
+    } else if (MKLDNN_ISA(sse42)) {
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::sse42>(jcp, *attr.get()));
 
         jcp.normalize_variance = false;
@@ -655,6 +689,18 @@ void MKLDNNMVNNode::execute(mkldnn::stream strm) {
             } else if (input_prec == Precision::FP32) {
                 auto src_data = reinterpret_cast<float *>(srcMemPtr->GetData());
                 mvn_blk<float, float>(src_data, dst_data, getParentEdgeAt(0)->getDesc().getDims());
+            } else if (input_prec == Precision::BF16) {
+                auto src_data = reinterpret_cast<const ngraph::bfloat16 *>(srcMemPtr->GetData());
+                mvn_blk<ngraph::bfloat16, float>(src_data, dst_data, getParentEdgeAt(0)->getDesc().getDims());
+            }
+        } else if (output_prec == Precision::BF16) {
+            auto dst_data = reinterpret_cast<ngraph::bfloat16 *>(dstMemPtr->GetData());
+            if (input_prec == Precision::FP32) {
+                auto src_data = reinterpret_cast<const float *>(srcMemPtr->GetData());
+                mvn_blk<float, ngraph::bfloat16>(src_data, dst_data, getParentEdgeAt(0)->getDesc().getDims());
+            } else if (input_prec == Precision::BF16) {
+                auto src_data = reinterpret_cast<const ngraph::bfloat16 *>(srcMemPtr->GetData());
+                mvn_blk<ngraph::bfloat16, ngraph::bfloat16>(src_data, dst_data, getParentEdgeAt(0)->getDesc().getDims());
             }
         }
     }
@@ -675,11 +721,11 @@ std::tuple<size_t, size_t, size_t, size_t, size_t> MKLDNNMVNNode::get5dShapes(co
 
 void MKLDNNMVNNode::mvn_pln(const float* src_data, float* dst_data, const SizeVector& dims) {
     size_t blk_size = 1;  // blk size in vmm
-    if (mayiuse(cpu::avx512_common)) {
+    if (MKLDNN_ISA(avx512_common)) {
         blk_size = 16;
-    } else if (mayiuse(cpu::avx2)) {
+    } else if (MKLDNN_ISA(avx2)) {
         blk_size = 8;
-    } else if (mayiuse(cpu::sse42)) {
+    } else if (MKLDNN_ISA(sse42)) {
         blk_size = 4;
     }
 
@@ -715,12 +761,7 @@ void MKLDNNMVNNode::mvn_pln(const float* src_data, float* dst_data, const SizeVe
                 });
             } else {
                 mean_temp = parallel_sum(C, mean_temp, [&](size_t c)->float {
-                    float mean_internal = 0.0f;
-                    size_t cc = cb + c * C2;
-                    for (size_t tail = 0lu; tail < C2; tail++) {
-                        mean_internal += src_data[cc + tail];
-                    }
-                    return mean_internal;
+                    return row_kernels::sum(src_data + cb + c * C2, C2);
                 });
             }
             float mean = mean_temp * C3inv;
@@ -748,12 +789,7 @@ void MKLDNNMVNNode::mvn_pln(const float* src_data, float* dst_data, const SizeVe
                     });
                 } else {
                     variance_temp = parallel_sum(C, variance_temp, [&](size_t c)->float {
-                        float variance_internal = 0.0f;
-                        size_t cc = cb + c * C2;
-                        for (size_t tail = 0lu; tail < C2; tail++) {
-                            variance_internal += (src_data[cc + tail] - mean) * (src_data[cc + tail] - mean);
-                        }
-                        return variance_internal;
+                        return row_kernels::sum_squared_diff(src_data + cb + c * C2, C2, mean);
                     });
                 }
                 float variance = 1.f / sqrtf(variance_temp * C3inv + eps);
@@ -778,9 +814,7 @@ void MKLDNNMVNNode::mvn_pln(const float* src_data, float* dst_data, const SizeVe
                 } else {
                     parallel_for(C, [&](int c) {
                         size_t cc = cb + c * C2;
-                        for (size_t tail = 0lu; tail < C2; tail++) {
-                            dst_data[cc + tail] = (src_data[cc + tail] - mean) * variance;
-                        }
+                        row_kernels::shift_scale(src_data + cc, dst_data + cc, C2, mean, variance);
                     });
                 }
             } else {
@@ -804,9 +838,7 @@ void MKLDNNMVNNode::mvn_pln(const float* src_data, float* dst_data, const SizeVe
                 } else {
                     parallel_for(C, [&](int c) {
                         size_t cc = cb + c * C2;
-                        for (size_t tail = 0lu; tail < C2; tail++) {
-                            dst_data[cc + tail] = src_data[cc + tail] - mean;
-                        }
+                        row_kernels::shift_scale(src_data + cc, dst_data + cc, C2, mean, 1.f);
                     });
                 }
             }
@@ -863,30 +895,19 @@ void MKLDNNMVNNode::mvn_pln(const float* src_data, float* dst_data, const SizeVe
             } else {
                 parallel_for(C, [&](size_t c) {
                     // mean for this channel
-                    float mean = 0.f;
                     size_t cc = cb + c * C2;
-                    for (size_t tail = 0lu; tail < C2; tail++) {
-                        mean += src_data[cc + tail];
-                    }
-                    mean *= C2inv;
+                    float mean = row_kernels::sum(src_data + cc, C2) * C2inv;
 
                     // variance for this channel
                     if (normalize_variance) {
-                        float variance = 0.f;
-                        for (size_t tail = 0lu; tail < C2; tail++) {
-                            variance += (src_data[cc + tail] - mean) * (src_data[cc + tail] - mean);
-                        }
+                        float variance = row_kernels::sum_squared_diff(src_data + cc, C2, mean);
                         variance = 1.f / sqrtf(variance * C2inv + eps);
 
                         // mvn for this channel
-                        for (size_t tail = 0lu; tail < C2; tail++) {
-                            dst_data[cc + tail] = (src_data[cc + tail] - mean) * variance;
-                        }
+                        row_kernels::shift_scale(src_data + cc, dst_data + cc, C2, mean, variance);
                     } else {
                         // mvn for this channel
-                        for (size_t tail = 0lu; tail < C2; tail++) {
-                            dst_data[cc + tail] = src_data[cc + tail] - mean;
-                        }
+                        row_kernels::shift_scale(src_data + cc, dst_data + cc, C2, mean, 1.f);
                     }
                 });
             }
@@ -898,10 +919,10 @@ template <typename in_data_t, typename out_data_t>
 void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, const SizeVector& dims) {
     size_t blk_size = 1;  // channel blk for memory layout
     size_t ele_in_vmm = 4;
-    if (mayiuse(cpu::avx512_common)) {
+    if (MKLDNN_ISA(avx512_common)) {
         blk_size = 16;
         ele_in_vmm = 16;
-    } else if (mayiuse(cpu::avx2)) {
+    } else if (MKLDNN_ISA(avx2)) {
         blk_size = 8;
         ele_in_vmm = 8;
     } else {
@@ -965,7 +986,7 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                     for (size_t w = 0lu; w < W; w++) {
                         size_t cw = ccbd + w * blk_size;
                         for (size_t c = 0lu; c < min_cb; c++) {
-                            mean_internal += src_data[cw + c];
+                            mean_internal += static_cast<float>(src_data[cw + c]);
                         }
                     }
                 }
@@ -1000,7 +1021,7 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                         for (size_t w = 0lu; w < W; w++) {
                             size_t cw = ccbd + w * blk_size;
                             for (size_t c = 0lu; c < min_cb; c++) {
-                                variance_internal += (src_data[cw + c] - mean) * (src_data[cw + c] - mean);
+                                variance_internal += (static_cast<float>(src_data[cw + c]) - mean) * (static_cast<float>(src_data[cw + c]) - mean);
                             }
                         }
                     }
@@ -1027,7 +1048,7 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                             size_t cw = ccbd + w * blk_size;
                             for (size_t c = 0lu; c < min_cb; c++) {
                                 size_t src_offset = cw + c;
-                                dst_data[src_offset] = (src_data[src_offset] - mean) * variance;
+                                dst_data[src_offset] = (static_cast<float>(src_data[src_offset]) - mean) * variance;
                             }
                         }
                     }
@@ -1051,7 +1072,7 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                             size_t cw = ccbd + w * blk_size;
                             for (size_t c = 0lu; c < min_cb; c++) {
                                 size_t src_offset = cw + c;
-                                dst_data[src_offset] = src_data[src_offset] - mean;
+                                dst_data[src_offset] = static_cast<float>(src_data[src_offset]) - mean;
                             }
                         }
                     }
@@ -1106,7 +1127,7 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                         for (size_t h = 0; h < H; h++) {
                             size_t ch = cd + h * C0;
                             for (size_t w = 0; w < W; w++) {
-                                mean_buffer_ptr[c] += src_data[ch + w * src_stride];
+                                mean_buffer_ptr[c] += static_cast<float>(src_data[ch + w * src_stride]);
                             }
                         }
                     }
@@ -1163,8 +1184,8 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                                 size_t ch = cd + h * C0;
                                 for (size_t w = 0lu; w < W; w++) {
                                     variance_buffer_ptr[c] +=
-                                            (src_data[ch + w * src_stride] - mean_buffer_ptr[c]) *
-                                            (src_data[ch + w * src_stride] - mean_buffer_ptr[c]);
+                                            (static_cast<float>(src_data[ch + w * src_stride]) - mean_buffer_ptr[c]) *
+                                            (static_cast<float>(src_data[ch + w * src_stride]) - mean_buffer_ptr[c]);
                                 }
                             }
                         }
@@ -1211,7 +1232,7 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                             for (size_t h = 0lu; h < H; h++) {
                                 size_t ch = cd + h * C0;
                                 for (size_t w = 0lu; w < W; w++) {
-                                    float dst_value = (src_data[ch + w * src_stride] - mean_buffer_ptr[c]) * variance_buffer_ptr[c];
+                                    float dst_value = (static_cast<float>(src_data[ch + w * src_stride]) - mean_buffer_ptr[c]) * variance_buffer_ptr[c];
                                     if (!fusedWith.empty()) {
                                         const auto &p = (*attr.get()).post_ops_;
                                         for (int i = 0; i < p.len_; i++) {
@@ -1227,7 +1248,7 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                                             } else if (post_op.is_quantization()) {
                                                 bool do_dequantization = post_op.quantization.alg ==
                                                                          alg_kind::quantization_quantize_dequantize;
-                                                bool do_rounding = do_dequantization || output_prec == Precision::FP32 ||
+                                                bool do_rounding = do_dequantization || output_prec == Precision::FP32 || output_prec == Precision::BF16 ||
                                                                    i != p.len_ - 1;
 
                                                 auto quant = post_op.quantization;
@@ -1251,7 +1272,7 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                                             }
                                         }
                                     }
-                                    if (output_prec == Precision::FP32) {
+                                    if (output_prec == Precision::FP32 || output_prec == Precision::BF16) {
                                         dst_data[ch + w * src_stride] = dst_value;
                                     } else if (output_prec == Precision::U8) {
                                         dst_data[ch + w * src_stride] = (dst_value >= 0) ? lroundf(dst_value) : 0;
@@ -1299,8 +1320,8 @@ void MKLDNNMVNNode::mvn_blk(const in_data_t* src_data, out_data_t* dst_data, con
                             for (size_t h = 0lu; h < H; h++) {
                                 size_t ch = cd + h * C0;
                                 for (size_t w = 0lu; w < W; w++) {
-                                    float dst_value = src_data[ch + w * src_stride] - mean_buffer_ptr[c];
-                                    if (output_prec == Precision::FP32) {
+                                    float dst_value = static_cast<float>(src_data[ch + w * src_stride]) - mean_buffer_ptr[c];
+                                    if (output_prec == Precision::FP32 || output_prec == Precision::BF16) {
                                         dst_data[ch + w * src_stride] = dst_value;
                                     } else if (output_prec == Precision::U8) {
                                         dst_data[ch + w * src_stride] = (dst_value >= 0) ? lroundf(dst_value) : 0;
@@ -7,6 +7,7 @@
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
+#include "mkldnn_selective_build.h"
 #include "jit_uni_eltwise.hpp"
 #include "jit_uni_depthwise.hpp"
 #include "jit_uni_quantization.hpp"
@@ -805,9 +806,9 @@ void MKLDNNNormalizeNode::initSupportedPrimitiveDescriptors() {
 
     // only plain layout support when w/o sse42
     if (getParentEdgeAt(0)->getDims().ndims() == 4) {
-        if (mayiuse(cpu::sse42)) {
+        if (MKLDNN_ISA(sse42)) {
             pushDesc(memory::nhwc);
-            if (mayiuse(cpu::avx512_common)) {
+            if (MKLDNN_ISA(avx512_common)) {
                 pushDesc(memory::nChw16c);
             } else {
                 pushDesc(memory::nChw8c);
@@ -871,13 +872,13 @@ void MKLDNNNormalizeNode::createPrimitive() {
     jcp.h = (dims_size > 2) ? dims[2] : 1lu;
     jcp.w = (dims_size > 3) ? dims[3] : 1lu;
 
-    if (mayiuse(cpu::avx512_common)) {
+    if (MKLDNN_ISA(avx512_common)) {
         normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::avx512_common>(jcp));
         normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
-    } else if (mayiuse(cpu::avx2)) {
+    } else if (MKLDNN_ISA(avx2)) {
         normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::avx2>(jcp));
         normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::avx2>(jcp, *attr.get()));
-    } else if (mayiuse(cpu::sse42)) {
+    } else if (MKLDNN_ISA(sse42)) {
         normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::sse42>(jcp));
         normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::sse42>(jcp, *attr.get()));
     }
@@ -949,11 +950,11 @@ void MKLDNNNormalizeNode::execute(mkldnn::stream strm) {
 template <typename in_data_t, typename out_data_t>
 void MKLDNNNormalizeNode::normalize_nchw(const in_data_t* src_data, out_data_t* dst_data, const InferenceEngine::SizeVector& dims) {
     size_t blk_size = 1;  // elt in vmm
-    if (mayiuse(cpu::avx512_common)) {
+    if (MKLDNN_ISA(avx512_common)) {
         blk_size = 16;
-    } else if (mayiuse(cpu::avx2)) {
+    } else if (MKLDNN_ISA(avx2)) {
         blk_size = 8;
-    } else if (mayiuse(cpu::sse42)) {
+    } else if (MKLDNN_ISA(sse42)) {
         blk_size = 4;
     }
 
@@ -1145,11 +1146,11 @@ void MKLDNNNormalizeNode::normalize_nchw_ref(const in_data_t* src_data, out_data
 template <typename in_data_t, typename out_data_t>
 void MKLDNNNormalizeNode::normalize_nhwc(const in_data_t* src_data, out_data_t* dst_data, const InferenceEngine::SizeVector& dims) {
     size_t blk_size = 1;  // elt in vmm
-    if (mayiuse(cpu::avx512_common)) {
+    if (MKLDNN_ISA(avx512_common)) {
         blk_size = 16;
-    } else if (mayiuse(cpu::avx2)) {
+    } else if (MKLDNN_ISA(avx2)) {
         blk_size = 8;
-    } else if (mayiuse(cpu::sse42)) {
+    } else if (MKLDNN_ISA(sse42)) {
         blk_size = 4;
     }
 
@@ -1266,11 +1267,11 @@ void MKLDNNNormalizeNode::normalize_nhwc(const in_data_t* src_data, out_data_t*
 template <typename in_data_t, typename out_data_t>
 void MKLDNNNormalizeNode::normalize_blk(const in_data_t* src_data, out_data_t* dst_data, const InferenceEngine::SizeVector& dims) {
     size_t blk_size = 1;  // channel blk for memory layout
-    if (mayiuse(cpu::avx512_common)) {
+    if (MKLDNN_ISA(avx512_common)) {
         blk_size = 16;
-    } else if (mayiuse(cpu::avx2)) {
+    } else if (MKLDNN_ISA(avx2)) {
         blk_size = 8;
-    } else if (mayiuse(cpu::sse42)) {
+    } else if (MKLDNN_ISA(sse42)) {
         blk_size = 8;
     }
 
@@ -1400,7 +1401,7 @@ template <typename in_data_t, typename out_data_t>
 void MKLDNNNormalizeNode::normalize_function(const in_data_t* src_data, out_data_t* dst_data, const InferenceEngine::SizeVector& dims) {
     auto selectedPD = getSelectedPrimitiveDescriptor();
     Layout selected_layout = selectedPD->getConfig().inConfs[0].desc.getLayout();
-    if (mayiuse(cpu::sse42) && normalize_modulo_kernel && normalize_kernel) {
+    if (MKLDNN_ISA(sse42) && normalize_modulo_kernel && normalize_kernel) {
         if (selected_layout == MKLDNNMemory::GetPlainLayout(getChildEdgeAt(0)->getDims())) {
             normalize_nchw(src_data, dst_data, dims);
         } else if (selected_layout == Layout::NHWC) {
@@ -3,11 +3,13 @@
 //
 
 #include "mkldnn_permute_node.h"
+#include "common/jit_kernel_cache.h"
 #include <legacy/ie_layers.h>
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
+#include "mkldnn_selective_build.h"
 #include "jit_generator.hpp"
 #include <algorithm>
 
@@ -351,12 +353,21 @@ void MKLDNNPermuteNode::createPrimitive() {
     jpp.ndims = sorted_order.size();
     jpp.data_size = MKLDNNExtensionUtils::sizeOfDataType(data_type);
 
-    if (mayiuse(cpu::avx512_common)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::avx512_common>(jpp));
-    } else if (mayiuse(cpu::avx2)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::avx2>(jpp));
-    } else if (mayiuse(cpu::sse42)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::sse42>(jpp));
+    // identical kernels are generated once per process and shared by all permute nodes
+    auto key = [&](const char *isaName) {
+        return (JitKernelKey("permute") << isaName << jpp.ndims << jpp.dst_block_dims << jpp.src_strides
+                                        << jpp.dst_strides << jpp.n << jpp.data_size << jpp.supported_dynamic_batch).str();
+    };
+
+    if (MKLDNN_ISA(avx512_common)) {
+        permute_kernel = JitKernelCache<jit_uni_permute_kernel>::findOrCreate(key("avx512_common"), [&] {
+            return new jit_uni_permute_kernel_f32<cpu::avx512_common>(jpp); });
+    } else if (MKLDNN_ISA(avx2)) {
+        permute_kernel = JitKernelCache<jit_uni_permute_kernel>::findOrCreate(key("avx2"), [&] {
+            return new jit_uni_permute_kernel_f32<cpu::avx2>(jpp); });
+    } else if (MKLDNN_ISA(sse42)) {
+        permute_kernel = JitKernelCache<jit_uni_permute_kernel>::findOrCreate(key("sse42"), [&] {
+            return new jit_uni_permute_kernel_f32<cpu::sse42>(jpp); });
     }
 }
 
@@ -5,6 +5,7 @@
 #include "mkldnn_reduce_node.h"
 #include "desc_iterator.hpp"
 #include "mkldnn_quantize_node.h"
+#include "common/jit_kernel_cache.h"
 #include <legacy/ie_layers.h>
 #include <mkldnn.hpp>
 #include <string>
@@ -13,6 +14,7 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
+#include "mkldnn_selective_build.h"
 #include <algorithm>
 
 #include "jit_generator.hpp"
@@ -1324,7 +1326,7 @@ void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, outFormat});
     };
 
-    jit_mode = (mayiuse(cpu::sse42)) && getParentEdgeAt(REDUCE_DATA)->getDims().ndims() <= 5 &&
+    jit_mode = (MKLDNN_ISA(sse42)) && getParentEdgeAt(REDUCE_DATA)->getDims().ndims() <= 5 &&
             (inputPrecision == Precision::FP32 || inputPrecision == Precision::I32 || inputPrecision == Precision::U8 || inputPrecision == Precision::I8) &&
             (outputPrecision == Precision::FP32 || outputPrecision == Precision::I32 || outputPrecision == Precision::U8 || outputPrecision == Precision::I8);
     if (jit_mode) {
@@ -1332,15 +1334,15 @@ void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
              MKLDNNMemory::GetPlainFormat(memory::dims(getChildEdgeAt(0)->getDims().ndims())), inputDataType, outputDataType);
         if (keep_dims) {
             if (getParentEdgeAt(REDUCE_DATA)->getDims().ndims() == 4 && getParentEdgeAt(REDUCE_DATA)->getDims().ToSizeVector()[1] > 1) {
-                if (mayiuse(cpu::avx512_common)) {
+                if (MKLDNN_ISA(avx512_common)) {
                     pushDesc(memory::nChw16c, memory::nChw16c, inputDataType, outputDataType);
-                } else if (mayiuse(cpu::avx2) || mayiuse(cpu::sse42)) {
+                } else if (MKLDNN_ISA(avx2) || MKLDNN_ISA(sse42)) {
                     pushDesc(memory::nChw8c, memory::nChw8c, inputDataType, outputDataType);
                 }
             } else if (getParentEdgeAt(REDUCE_DATA)->getDims().ndims() == 5 && getParentEdgeAt(REDUCE_DATA)->getDims().ToSizeVector()[1] > 1) {
-                if (mayiuse(cpu::avx512_common)) {
+                if (MKLDNN_ISA(avx512_common)) {
                     pushDesc(memory::nCdhw16c, memory::nCdhw16c, inputDataType, outputDataType);
-                } else if (mayiuse(cpu::avx2) || mayiuse(cpu::sse42)) {
+                } else if (MKLDNN_ISA(avx2) || MKLDNN_ISA(sse42)) {
                     pushDesc(memory::nCdhw8c, memory::nCdhw8c, inputDataType, outputDataType);
                 }
             }
@@ -1374,17 +1376,29 @@ void MKLDNNReduceNode::createPrimitive() {
     jcp.planar_layout = planar_layout;
     jcp.reduce_mode = reduceMode;
 
-    if (mayiuse(cpu::avx512_common)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::avx512_common>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::avx512_common>(jcp));
+    // identical kernels are generated once per process and shared by all reduce nodes
+    auto key = [&](const char *kernelName, const char *isaName) {
+        return (JitKernelKey(kernelName) << isaName << jcp.planar_layout << static_cast<int>(jcp.reduce_mode)
+                                         << static_cast<int>(jcp.src_dt) << static_cast<int>(jcp.dst_dt)).str();
+    };
+
+    if (MKLDNN_ISA(avx512_common)) {
+        reduce_kernel = JitKernelCache<jit_uni_reduce_kernel>::findOrCreate(key("reduce", "avx512_common"), [&] {
+            return new jit_uni_reduce_kernel_f32<cpu::avx512_common>(jcp); });
+        reduce_post_kernel = JitKernelCache<jit_uni_reduce_post_kernel>::findOrCreate(key("reduce_post", "avx512_common"), [&] {
+            return new jit_uni_reduce_post_kernel_f32<cpu::avx512_common>(jcp); });
         blk_size = 16;
-    } else if (mayiuse(cpu::avx2)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::avx2>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::avx2>(jcp));
+    } else if (MKLDNN_ISA(avx2)) {
+        reduce_kernel = JitKernelCache<jit_uni_reduce_kernel>::findOrCreate(key("reduce", "avx2"), [&] {
+            return new jit_uni_reduce_kernel_f32<cpu::avx2>(jcp); });
+        reduce_post_kernel = JitKernelCache<jit_uni_reduce_post_kernel>::findOrCreate(key("reduce_post", "avx2"), [&] {
+            return new jit_uni_reduce_post_kernel_f32<cpu::avx2>(jcp); });
         blk_size = 8;
-    } else if (mayiuse(cpu::sse42)) {
-        reduce_kernel.reset(new jit_uni_reduce_kernel_f32<cpu::sse42>(jcp));
-        reduce_post_kernel.reset(new jit_uni_reduce_post_kernel_f32<cpu::sse42>(jcp));
+    } else if (MKLDNN_ISA(sse42)) {
+        reduce_kernel = JitKernelCache<jit_uni_reduce_kernel>::findOrCreate(key("reduce", "sse42"), [&] {
+            return new jit_uni_reduce_kernel_f32<cpu::sse42>(jcp); });
+        reduce_post_kernel = JitKernelCache<jit_uni_reduce_post_kernel>::findOrCreate(key("reduce_post", "sse42"), [&] {
+            return new jit_uni_reduce_post_kernel_f32<cpu::sse42>(jcp); });
         blk_size = 8;
     }
 
@@ -35,6 +35,10 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    bool isExecutable() override {
+        return !isOptimized && MKLDNNNode::isExecutable();
+    }
+
     bool canBeInPlace() const override {
         return false;
     }
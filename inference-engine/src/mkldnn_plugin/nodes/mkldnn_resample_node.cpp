@@ -14,6 +14,7 @@
 #include <mkldnn_extension_utils.h>
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
+#include "mkldnn_selective_build.h"
 #include <algorithm>
 
 #include "jit_generator.hpp"
@@ -360,15 +361,15 @@ void MKLDNNResampleNode::initSupportedPrimitiveDescriptors() {
 
         if (inputPrecision == Precision::FP32 && outputPrecision == Precision::FP32) {
             if (getParentEdgeAt(0)->getDims().ndims() == 4) {
-                if (mayiuse(cpu::avx512_common)) {
+                if (MKLDNN_ISA(avx512_common)) {
                     pushDesc(memory::nChw16c);
-                } else if (mayiuse(cpu::avx2) || mayiuse(cpu::sse42)) {
+                } else if (MKLDNN_ISA(avx2) || MKLDNN_ISA(sse42)) {
                     pushDesc(memory::nChw8c);
                 }
             } else if (getParentEdgeAt(0)->getDims().ndims() == 5) {
-                if (mayiuse(cpu::avx512_common)) {
+                if (MKLDNN_ISA(avx512_common)) {
                     pushDesc(memory::nCdhw16c);
-                } else if (mayiuse(cpu::avx2) || mayiuse(cpu::sse42)) {
+                } else if (MKLDNN_ISA(avx2) || MKLDNN_ISA(sse42)) {
                     pushDesc(memory::nCdhw8c);
                 }
             }
@@ -408,7 +409,7 @@ void MKLDNNResampleNode::createPrimitive() {
     jcp.nhwc_format = (selected_layout == NHWC) || (selected_layout == NDHWC);
 
     if (type == "caffe.ResampleParameter.NEAREST") {
-        if (mayiuse(cpu::avx512_common)) {
+        if (MKLDNN_ISA(avx512_common)) {
             if (jcp.planar_layout) {
                 resample_nearest_kernel.reset(new jit_uni_resample_nearest_kernel_f32<cpu::avx2>(jcp, *attr.get()));
                 blk_size = 8;
@@ -416,10 +417,10 @@ void MKLDNNResampleNode::createPrimitive() {
                 resample_nearest_kernel.reset(new jit_uni_resample_nearest_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
                 blk_size = 16;
             }
-        } else if (mayiuse(cpu::avx2)) {
+        } else if (MKLDNN_ISA(avx2)) {
             resample_nearest_kernel.reset(new jit_uni_resample_nearest_kernel_f32<cpu::avx2>(jcp, *attr.get()));
             blk_size = 8;
-        } else if (mayiuse(cpu::sse42) && !jcp.planar_layout) {
+        } else if (MKLDNN_ISA(sse42) && !jcp.planar_layout) {
             resample_nearest_kernel.reset(new jit_uni_resample_nearest_kernel_f32<cpu::sse42>(jcp, *attr.get()));
             blk_size = 8;
         }
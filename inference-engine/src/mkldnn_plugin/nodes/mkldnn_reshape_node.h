@@ -21,6 +21,10 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     bool created() const override;
+    // the output shares memory with the input, so there is nothing to execute
+    bool isExecutable() override {
+        return false;
+    }
 };
 
 }  // namespace MKLDNNPlugin
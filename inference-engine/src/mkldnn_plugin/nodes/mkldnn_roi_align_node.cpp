@@ -0,0 +1,272 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_roi_align_node.h"
+#include <legacy/ie_layers.h>
+#include <mkldnn.hpp>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
+#include "mkldnn_selective_build.h"
+#include "jit_generator.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+
+MKLDNNROIAlignNode::MKLDNNROIAlignNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+        MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {}
+
+void MKLDNNROIAlignNode::getSupportedDescriptors() {
+    if (!descs.empty())
+        return;
+
+    GenericLayer* genericLayer = getCnnLayer().get();
+    if (genericLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot convert ROIAlign layer.";
+
+    if (getParentEdges().size() != 3)
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    if (getParentEdgeAt(0)->getDims().ndims() != 4)
+        THROW_IE_EXCEPTION << "ROIAlign layer " << getName() << " supports only 4D feature maps";
+    if (getParentEdgeAt(1)->getDims().ndims() != 2 || getParentEdgeAt(1)->getDims()[1] != 4)
+        THROW_IE_EXCEPTION << "ROIAlign layer " << getName() << " expects ROIs with shape [num_rois, 4]";
+    if (getParentEdgeAt(2)->getDims().ndims() != 1 || getParentEdgeAt(2)->getDims()[0] != getParentEdgeAt(1)->getDims()[0])
+        THROW_IE_EXCEPTION << "ROIAlign layer " << getName() << " expects a batch index for every ROI";
+
+    pooledH = genericLayer->GetParamAsInt("pooled_h");
+    pooledW = genericLayer->GetParamAsInt("pooled_w");
+    samplingRatio = genericLayer->GetParamAsInt("sampling_ratio");
+    spatialScale = genericLayer->GetParamAsFloat("spatial_scale");
+    std::string m = genericLayer->GetParamAsString("mode");
+    if (m == "avg") {
+        mode = Avg;
+    } else if (m == "max") {
+        mode = Max;
+    } else {
+        THROW_IE_EXCEPTION << "ROIAlign layer " << getName() << " has unsupported mode " << m;
+    }
+    if (pooledH <= 0 || pooledW <= 0 || samplingRatio < 0)
+        THROW_IE_EXCEPTION << "ROIAlign layer " << getName() << " has incorrect pooled size or sampling ratio";
+}
+
+void MKLDNNROIAlignNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    auto dataType = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::FP32);
+    auto indexType = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::I32);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    config.inConfs.resize(3);
+    config.outConfs.resize(1);
+    for (auto& inConf : config.inConfs) {
+        inConf.inPlace = -1;
+        inConf.constant = false;
+    }
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+
+    auto pushDesc = [&](memory::format format) {
+        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), dataType, format);
+        config.inConfs[1].desc = MKLDNNMemoryDesc(getParentEdgeAt(1)->getDims(), dataType, memory::nc);
+        config.inConfs[2].desc = MKLDNNMemoryDesc(getParentEdgeAt(2)->getDims(), indexType, memory::x);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), dataType, format);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown, format});
+    };
+
+    // channels of a pixel are contiguous in the blocked layouts and nhwc, so they are sampled by vectors
+    if (MKLDNN_ISA(avx512_common)) {
+        pushDesc(memory::nChw16c);
+    } else if (MKLDNN_ISA(sse42)) {
+        pushDesc(memory::nChw8c);
+    }
+    pushDesc(memory::nhwc);
+    pushDesc(memory::nchw);
+}
+
+void MKLDNNROIAlignNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    auto srcDims = getParentEdgeAt(0)->getDims();
+    const size_t channels = srcDims[1];
+    srcHeight = srcDims[2];
+    srcWidth = srcDims[3];
+
+    switch (srcMemPtr->GetFormat()) {
+        case memory::nChw16c:
+            blockSize = 16;
+            break;
+        case memory::nChw8c:
+            blockSize = 8;
+            break;
+        case memory::nhwc:
+            blockSize = channels;
+            break;
+        default:
+            blockSize = 1;
+            break;
+    }
+    pixelStride = blockSize;
+    blocksNum = div_up(channels, blockSize);
+    srcBlockStride = srcHeight * srcWidth * pixelStride;
+    dstBlockStride = pooledH * pooledW * pixelStride;
+}
+
+void MKLDNNROIAlignNode::initSamples(const float* roi, ROISamples& samples) const {
+    const float x1 = roi[0] * spatialScale;
+    const float y1 = roi[1] * spatialScale;
+    const float x2 = roi[2] * spatialScale;
+    const float y2 = roi[3] * spatialScale;
+
+    const float binW = std::max(x2 - x1, 1.f) / pooledW;
+    const float binH = std::max(y2 - y1, 1.f) / pooledH;
+    const int samplesX = samplingRatio > 0 ? samplingRatio : static_cast<int>(std::ceil(binW));
+    const int samplesY = samplingRatio > 0 ? samplingRatio : static_cast<int>(std::ceil(binH));
+    const float sampleW = binW / samplesX;
+    const float sampleH = binH / samplesY;
+
+    samples.samplesPerBin = samplesX * samplesY;
+    const size_t pointsNum = static_cast<size_t>(pooledH) * pooledW * samples.samplesPerBin * 4;
+    samples.offsets.resize(pointsNum);
+    samples.weights.resize(pointsNum);
+
+    const float norm = mode == Avg ? 1.f / samples.samplesPerBin : 1.f;
+    const int height = static_cast<int>(srcHeight);
+    const int width = static_cast<int>(srcWidth);
+    int* offsets = samples.offsets.data();
+    float* weights = samples.weights.data();
+    for (int binY = 0; binY < pooledH; binY++) {
+        for (int binX = 0; binX < pooledW; binX++) {
+            for (int sampleY = 0; sampleY < samplesY; sampleY++) {
+                for (int sampleX = 0; sampleX < samplesX; sampleX++, offsets += 4, weights += 4) {
+                    float y = y1 + binY * binH + sampleH * (sampleY + 0.5f);
+                    float x = x1 + binX * binW + sampleW * (sampleX + 0.5f);
+                    if (y < -1.f || y > height || x < -1.f || x > width) {
+                        std::fill(offsets, offsets + 4, 0);
+                        std::fill(weights, weights + 4, 0.f);
+                        continue;
+                    }
+
+                    y = std::max(y, 0.f);
+                    x = std::max(x, 0.f);
+                    int yLow = static_cast<int>(y);
+                    int xLow = static_cast<int>(x);
+                    int yHigh = yLow + 1;
+                    int xHigh = xLow + 1;
+                    if (yLow >= height - 1) {
+                        yLow = yHigh = height - 1;
+                        y = static_cast<float>(yLow);
+                    }
+                    if (xLow >= width - 1) {
+                        xLow = xHigh = width - 1;
+                        x = static_cast<float>(xLow);
+                    }
+
+                    const float ly = y - yLow;
+                    const float lx = x - xLow;
+                    const float hy = 1.f - ly;
+                    const float hx = 1.f - lx;
+
+                    offsets[0] = static_cast<int>((yLow * width + xLow) * pixelStride);
+                    offsets[1] = static_cast<int>((yLow * width + xHigh) * pixelStride);
+                    offsets[2] = static_cast<int>((yHigh * width + xLow) * pixelStride);
+                    offsets[3] = static_cast<int>((yHigh * width + xHigh) * pixelStride);
+                    weights[0] = hy * hx * norm;
+                    weights[1] = hy * lx * norm;
+                    weights[2] = ly * hx * norm;
+                    weights[3] = ly * lx * norm;
+                }
+            }
+        }
+    }
+}
+
+void MKLDNNROIAlignNode::execute(mkldnn::stream strm) {
+    auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    auto &roisMemPtr = getParentEdgeAt(1)->getMemoryPtr();
+    auto &indicesMemPtr = getParentEdgeAt(2)->getMemoryPtr();
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+
+    const float* srcData = reinterpret_cast<const float*>(srcMemPtr->GetData()) +
+            srcMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const float* roisData = reinterpret_cast<const float*>(roisMemPtr->GetData()) +
+            roisMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+    const int* batchIndices = reinterpret_cast<const int*>(indicesMemPtr->GetData()) +
+            indicesMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+    float* dstData = reinterpret_cast<float*>(dstMemPtr->GetData()) +
+            dstMemPtr->GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t batch = getParentEdgeAt(0)->getDims()[0];
+    const size_t roisNum = getParentEdgeAt(1)->getDims()[0];
+    for (size_t roi = 0; roi < roisNum; roi++) {
+        if (batchIndices[roi] < 0 || static_cast<size_t>(batchIndices[roi]) >= batch)
+            THROW_IE_EXCEPTION << "ROIAlign layer " << getName() << " has incorrect batch index " << batchIndices[roi];
+    }
+
+    roiSamples.resize(roisNum);
+    parallel_for(roisNum, [&](size_t roi) {
+        initSamples(roisData + roi * 4, roiSamples[roi]);
+    });
+
+    const size_t binsNum = static_cast<size_t>(pooledH) * pooledW;
+    const size_t srcBatchStride = blocksNum * srcBlockStride;
+    const size_t dstRoiStride = blocksNum * dstBlockStride;
+    parallel_for2d(roisNum, blocksNum, [&](size_t roi, size_t block) {
+        const auto& samples = roiSamples[roi];
+        const float* src = srcData + batchIndices[roi] * srcBatchStride + block * srcBlockStride;
+        float* dst = dstData + roi * dstRoiStride + block * dstBlockStride;
+        const int pointsNum = samples.samplesPerBin * 4;
+        const int* offsets = samples.offsets.data();
+        const float* weights = samples.weights.data();
+
+        for (size_t bin = 0; bin < binsNum; bin++, offsets += pointsNum, weights += pointsNum) {
+            float* out = dst + bin * pixelStride;
+            if (mode == Avg) {
+                std::fill(out, out + blockSize, 0.f);
+                for (int point = 0; point < pointsNum; point++) {
+                    const float* in = src + offsets[point];
+                    const float weight = weights[point];
+                    for (size_t c = 0; c < blockSize; c++)
+                        out[c] += weight * in[c];
+                }
+            } else {
+                for (int sample = 0; sample < samples.samplesPerBin; sample++) {
+                    const int* o = offsets + sample * 4;
+                    const float* w = weights + sample * 4;
+                    for (size_t c = 0; c < blockSize; c++) {
+                        const float value = std::max(std::max(w[0] * src[o[0] + c], w[1] * src[o[1] + c]),
+                                                     std::max(w[2] * src[o[2] + c], w[3] * src[o[3] + c]));
+                        out[c] = sample == 0 ? value : std::max(out[c], value);
+                    }
+                }
+            }
+        }
+    });
+}
+
+bool MKLDNNROIAlignNode::created() const {
+    return getType() == ROIAlign;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNROIAlignNode, ROIAlign);
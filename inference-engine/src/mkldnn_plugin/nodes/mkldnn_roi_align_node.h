@@ -0,0 +1,65 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNROIAlignNode : public MKLDNNNode {
+public:
+    MKLDNNROIAlignNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNROIAlignNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+private:
+    enum ROIAlignMode {
+        Avg,
+        Max
+    };
+
+    /**
+     * @brief Bilinear sampling points of all bins of a ROI, they are the same for all channels.
+     * Every sample has 4 neighbour pixels, offsets already include the pixel stride of the layout
+     * and weights of the average mode include the division by the number of samples in a bin.
+     */
+    struct ROISamples {
+        std::vector<int> offsets;
+        std::vector<float> weights;
+        int samplesPerBin = 0;
+    };
+
+    void initSamples(const float* roi, ROISamples& samples) const;
+
+    int pooledH = 7;
+    int pooledW = 7;
+    int samplingRatio = 2;
+    float spatialScale = 1.f;
+    ROIAlignMode mode = Avg;
+
+    // layouts are described as channel blocks of pixels, the planar layout has blocks of one channel
+    // and nhwc has one block of all channels
+    size_t blockSize = 1;
+    size_t pixelStride = 1;
+    size_t srcBlockStride = 0;
+    size_t dstBlockStride = 0;
+    size_t blocksNum = 0;
+    size_t srcHeight = 0;
+    size_t srcWidth = 0;
+
+    std::vector<ROISamples> roiSamples;
+};
+
+}  // namespace MKLDNNPlugin
+
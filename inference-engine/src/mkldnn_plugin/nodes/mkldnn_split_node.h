@@ -23,6 +23,11 @@ public:
     bool created() const override;
 
     bool isOptimized();
+
+    bool isExecutable() override {
+        return !isOptimized() && MKLDNNNode::isExecutable();
+    }
+
     void initOptimalPrimitiveDescriptor() override;
 
     void setDynamicBatchLim(int lim) override;
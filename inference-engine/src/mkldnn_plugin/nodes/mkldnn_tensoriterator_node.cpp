@@ -6,11 +6,15 @@
 #include "desc_iterator.hpp"
 #include <legacy/ie_layers.h>
 #include <legacy/ie_layers_internal.hpp>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <nodes/mkldnn_concat_node.h>
+#include <nodes/mkldnn_split_node.h>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -112,6 +116,99 @@ private:
     int iter_count;
 };
 
+/**
+ * Points body tensors to the current iteration chunk of a sliced input or a concatenated output
+ * instead of copying the chunk. Applicable only if the chunk is a contiguous part of the full tensor.
+ */
+class PortChunkViewHelper : public PortMapHelper {
+public:
+    PortChunkViewHelper(const MKLDNNMemoryPtr &full_blob, const std::vector<MKLDNNEdgePtr> &part_edges,
+                        const InferenceEngine::TensorIterator::PortMap &slice_rule) : edges(part_edges) {
+        auto abs_stride = std::abs(slice_rule.stride);
+        auto sign_of_stride = slice_rule.stride < 0 ? -1 : 1;
+
+        iter_count = full_blob->GetDims()[slice_rule.axis] / abs_stride;
+
+        mem_holder.push_back(full_blob->GetPrimitive());
+
+        chunk_stride_in_byte = edges[0]->getMemory().GetSize();
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= sign_of_stride;
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(mem_holder[0].get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &edge : edges)
+            edge->getMemory().GetPrimitivePtr()->set_data_handle(chunk_ptr);
+    }
+
+    static bool isApplicable(const MKLDNNMemoryPtr &full_blob, const MKLDNNMemoryPtr &part_blob,
+                             const InferenceEngine::TensorIterator::PortMap &slice_rule) {
+        auto full_dims = full_blob->GetDims();
+        if (full_blob->GetDataType() != part_blob->GetDataType() ||
+            full_blob->GetFormat() != MKLDNNMemory::GetPlainFormat(full_dims) ||
+            part_blob->GetFormat() != MKLDNNMemory::GetPlainFormat(part_blob->GetDims()))
+            return false;
+
+        for (int i = 0; i < slice_rule.axis; i++)
+            if (full_dims[i] != 1) return false;
+        return true;
+    }
+
+private:
+    std::vector<MKLDNNEdgePtr> edges;
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+    int iter_count;
+};
+
+/**
+ * Zeroes chunks of a concatenated output which were not produced because the loop was exited before
+ * the last iteration, so the output does not keep data of a previous inference.
+ * Chunks of skipped iterations are contiguous along the axis, so one memset per outer index is enough.
+ */
+class PortTailHelper : public PortMapHelper {
+public:
+    PortTailHelper(const MKLDNNMemoryPtr &full_blob, const InferenceEngine::TensorIterator::PortMap &slice_rule) {
+        auto axis = slice_rule.axis;
+        auto abs_stride = std::abs(slice_rule.stride);
+        auto full_dims = full_blob->GetDims();
+
+        size_t inner_size = MKLDNNExtensionUtils::sizeOfDataType(full_blob->GetDataType());
+        for (int i = axis + 1; i < static_cast<int>(full_dims.size()); i++)
+            inner_size *= full_dims[i];
+        for (int i = 0; i < axis; i++)
+            outer_count *= full_dims[i];
+
+        mem_holder.push_back(full_blob->GetPrimitive());
+        iter_count = full_dims[axis] / abs_stride;
+        chunk_size_in_byte = inner_size * abs_stride;
+        row_size_in_byte = inner_size * full_dims[axis];
+        reversed = slice_rule.stride < 0;
+    }
+
+    void execute(mkldnn::stream strm, int n_iter) override {
+        if (n_iter >= iter_count)
+            return;
+
+        auto first_chunk = reversed ? 0 : n_iter;
+        auto tail_size_in_byte = chunk_size_in_byte * (iter_count - n_iter);
+        auto data_ptr = static_cast<uint8_t *>(mem_holder[0].get_data_handle()) + chunk_size_in_byte * first_chunk;
+        for (size_t i = 0; i < outer_count; i++)
+            memset(data_ptr + row_size_in_byte * i, 0, tail_size_in_byte);
+    }
+
+private:
+    size_t chunk_size_in_byte = 0;
+    size_t row_size_in_byte = 0;
+    size_t outer_count = 1;
+    bool reversed = false;
+    int iter_count;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -125,6 +222,46 @@ public:
     }
 };
 
+/**
+ * Passes the back edge value to the next iteration by swapping the body output and input buffers
+ * instead of copying the value. Own buffers are used because the body memory of both tensors
+ * may be reused by other tensors during the iteration.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MKLDNNMemoryPtr &from, const std::vector<MKLDNNEdgePtr> &from_edges,
+                       const std::vector<MKLDNNEdgePtr> &to_edges, const mkldnn::engine& eng)
+            : from_edges(from_edges), to_edges(to_edges) {
+        for (auto &buffer : buffers) {
+            buffer.reset(new MKLDNNMemory(eng));
+            buffer->Create(from->GetDescriptor());
+        }
+        from_ptr = buffers[0]->GetData();
+        to_ptr = buffers[1]->GetData();
+        setDataHandles();
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        if (iter != 0) {
+            std::swap(from_ptr, to_ptr);
+            setDataHandles();
+        }
+    }
+
+private:
+    void setDataHandles() {
+        for (auto &edge : from_edges)
+            edge->getMemory().GetPrimitivePtr()->set_data_handle(from_ptr);
+        for (auto &edge : to_edges)
+            edge->getMemory().GetPrimitivePtr()->set_data_handle(to_ptr);
+    }
+
+    std::vector<MKLDNNEdgePtr> from_edges, to_edges;
+    MKLDNNMemoryPtr buffers[2];
+    void *from_ptr = nullptr;
+    void *to_ptr = nullptr;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -182,6 +319,81 @@ private:
     int value;
 };
 
+// Collects edges which read the body input, so their memory can be replaced without copying.
+// Uses the same restrictions as zero-copy network inputs.
+static bool getInputSharedEdges(const MKLDNNNodePtr &input, std::vector<MKLDNNEdgePtr> &edges) {
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto edge = input->getChildEdgeAt(i);
+        auto& child = edge->getChild();
+        if (child->isConstant() || child->isInplace())
+            return false;
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        if (concat && concat->isOptimized())
+            return false;
+#endif
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+        if (dynamic_cast<MKLDNNSplitNode *>(child.get()))
+            return false;
+#endif
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                    edge->getMemory().GetPrimitive().get_data_handle())
+                return false;
+        }
+        edges.push_back(edge);
+    }
+    return !edges.empty();
+}
+
+// Collects edges which share memory with the body output, so the producer can write to other memory directly.
+// Uses the same restrictions as zero-copy network outputs.
+static bool getOutputSharedEdges(const MKLDNNNodePtr &output, std::vector<MKLDNNEdgePtr> &edges) {
+    auto outputEdge = output->getParentEdgeAt(0);
+    void *defaultPtr = outputEdge->getMemory().GetPrimitive().get_data_handle();
+    auto producer = outputEdge->getParent();
+    if (producer->getType() == Input || producer->isConstant() || producer->isInplace())
+        return false;
+
+    for (auto& edge : producer->getChildEdgesAtPort(static_cast<size_t>(outputEdge->getInputNum()))) {
+        if (edge->getMemory().GetPrimitive().get_data_handle() != defaultPtr)
+            return false;
+        if (edge != outputEdge) {
+            auto& child = edge->getChild();
+            if (child->isConstant() || child->isInplace())
+                return false;
+#if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
+            auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+#endif
+#if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
+            if (dynamic_cast<MKLDNNSplitNode *>(child.get()))
+                return false;
+#endif
+        }
+        edges.push_back(edge);
+    }
+    if (producer->getChildEdges().size() != edges.size())
+        return false;
+
+    for (size_t i = 0; i < producer->getParentEdges().size(); i++) {
+        if (producer->getParentEdgeAt(i)->getMemory().GetPrimitive().get_data_handle() == defaultPtr)
+            return false;
+    }
+    return true;
+}
+
+// Each body edge may be redirected by one helper only
+static bool claimEdges(std::vector<MKLDNNEdgePtr> &claimed, const std::vector<MKLDNNEdgePtr> &edges) {
+    for (const auto &edge : edges) {
+        if (std::find(claimed.begin(), claimed.end(), edge) != claimed.end())
+            return false;
+    }
+    claimed.insert(claimed.end(), edges.begin(), edges.end());
+    return true;
+}
+
 }  // namespace MKLDNNPlugin
 
 MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(InferenceEngine::CNNLayerPtr layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
@@ -202,6 +414,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
 
         auto &in_node = in_map.at(in_data->getName());
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
+        input_nodes.push_back(in_node);
         input_mem.push_back(in_mem);
     }
 
@@ -209,6 +422,7 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
     const auto &out_vec = sub_graph.GetOutputNodes();
     for (size_t i = 0; i < out_vec.size(); i++) {
         auto out_mem = out_vec[i]->getParentEdgeAt(0)->getMemoryPtr();
+        output_nodes.push_back(out_vec[i]);
         output_mem.push_back(out_mem);
     }
 }
@@ -229,12 +443,19 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 
     const auto &eng = getEngine();
 
+    // body edges which memory is redirected to the iteration chunks or to the swapped buffers
+    std::vector<MKLDNNEdgePtr> claimed_edges;
+
     for (auto map_rule : ti->input_port_map) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
 
+        std::vector<MKLDNNEdgePtr> to_edges;
         if (map_rule.axis == -1)
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        else if (PortChunkViewHelper::isApplicable(from_mem, to_mem, map_rule) &&
+                 getInputSharedEdges(input_nodes[map_rule.to], to_edges) && claimEdges(claimed_edges, to_edges))
+            before_mappers.emplace_back(new PortChunkViewHelper(from_mem, to_edges, map_rule));
         else
             before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
     }
@@ -243,8 +464,15 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
+        std::vector<MKLDNNEdgePtr> from_edges;
+        if (map_rule.axis != -1)
+            tail_mappers.emplace_back(new PortTailHelper(to_mem, map_rule));
+
         if (map_rule.axis == -1)
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        else if (PortChunkViewHelper::isApplicable(to_mem, from_mem, map_rule) &&
+                 getOutputSharedEdges(output_nodes[map_rule.to], from_edges) && claimEdges(claimed_edges, from_edges))
+            before_mappers.emplace_back(new PortChunkViewHelper(to_mem, from_edges, map_rule));
         else
             after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
     }
@@ -253,7 +481,14 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
-        before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
+        std::vector<MKLDNNEdgePtr> from_edges, to_edges;
+        if (MKLDNNMemoryDesc(from_mem->GetDescriptor()) == MKLDNNMemoryDesc(to_mem->GetDescriptor()) &&
+            getOutputSharedEdges(output_nodes[map_rule.from], from_edges) &&
+            getInputSharedEdges(input_nodes[map_rule.to], to_edges) &&
+            claimEdges(claimed_edges, from_edges) && claimEdges(claimed_edges, to_edges))
+            before_mappers.emplace_back(new BackEdgeSwapHelper(from_mem, from_edges, to_edges, eng));
+        else
+            before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
     }
 
     // special purpose ports
@@ -276,6 +511,12 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         continue_cond_check.reset(new asBoolCheck(mem));
     }
 
+    // sliced inputs and concatenated outputs limit the number of iterations of a loop with a dynamic trip count
+    auto is_iterable = [](const InferenceEngine::TensorIterator::PortMap &rule) { return rule.axis != -1; };
+    if (std::any_of(ti->input_port_map.begin(), ti->input_port_map.end(), is_iterable) ||
+        std::any_of(ti->output_port_map.begin(), ti->output_port_map.end(), is_iterable))
+        max_iter_count = n_iter;
+
     auto trip_count_port_idx = ti->GetParamAsInt(key_trip_count_port, -1);
     if (trip_count_port_idx == -1) {
         trip_count_check.reset(new staticValueCheck(n_iter)); // use statically calculated num of iteration
@@ -298,12 +539,15 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
 
     bool continue_cond = initial_cond_check->getStatus();
     int max_num_iter = trip_count_check->getStatus();
+    if (max_iter_count != -1 && (max_num_iter < 0 || max_num_iter > max_iter_count))
+        max_num_iter = max_iter_count;
 
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
 
     // use  "i != max_num_iter" only to allow "-1" works like infinite loop
-    for (int i = 0; i != max_num_iter && continue_cond; i++) {
+    int i = 0;
+    for (; i != max_num_iter && continue_cond; i++) {
         // copy data to subgraph iteration
         for (auto &mapper : before_mappers)
             mapper->execute(strm, i);
@@ -320,6 +564,10 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
 
     for (auto &mapper : last_mappers)
         mapper->execute(strm);
+
+    // the loop may be exited by the condition before all chunks of concatenated outputs are written
+    for (auto &mapper : tail_mappers)
+        mapper->execute(strm, i);
 }
 
 bool MKLDNNTensorIteratorNode::created() const {
@@ -57,16 +57,20 @@ public:
 
 private:
     int n_iter = 0;
+    /// < Number of iterations which sliced inputs and concatenated outputs have, -1 if there are no such ports
+    int max_iter_count = -1;
 
     MKLDNNExtensionManager::Ptr ext_mng;
     MKLDNNGraph sub_graph;
+    std::vector<MKLDNNNodePtr> input_nodes, output_nodes;
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
         last_mappers,    /// < Applied once after loop
         before_mappers,  /// < Applied before each iteration
-        after_mappers;   /// < Applied after each iteration
+        after_mappers,   /// < Applied after each iteration
+        tail_mappers;    /// < Applied once after loop with the number of executed iterations
 
     std::shared_ptr<PortChecker>
         trip_count_check,      /// < Perform check of trip count value. value >= -1
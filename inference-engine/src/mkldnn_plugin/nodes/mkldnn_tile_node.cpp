@@ -7,6 +7,7 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
 
 using namespace mkldnn;
@@ -111,13 +112,12 @@ void MKLDNNTileNode::execute(mkldnn::stream strm) {
         m_outer_dim /= 16;
     }
 
-    for (int i = 0; i < m_outer_dim; ++i) {
-        for (int t = 0; t < tiles; ++t) {
-            cpu_memcpy(dst_ptr, src_ptr, m_inner_dim* sizeof(float));
-            dst_ptr += m_inner_dim;
-        }
-        src_ptr += m_inner_dim;
-    }
+    // Every (outer, tile) pair is an independent copy of a contiguous inner block
+    const size_t inner_dim = static_cast<size_t>(m_inner_dim);
+    parallel_for2d(m_outer_dim, tiles, [&](int i, int t) {
+        cpu_memcpy(dst_ptr + (static_cast<size_t>(i) * tiles + t) * inner_dim, src_ptr + i * inner_dim,
+                   inner_dim * sizeof(float));
+    });
 }
 
 bool MKLDNNTileNode::created() const {
@@ -13,6 +13,9 @@
 #include <queue>
 #include "ie_parallel.hpp"
 #include "common/cpu_memcpy.h"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -179,6 +182,102 @@ public:
         return intersection_area / (areaI + areaJ - intersection_area);
     }
 
+#if defined(HAVE_AVX512F)
+    const int block_size = 16;
+    typedef __m512 vec_type_f;
+    typedef __mmask16 vmask_type;
+#elif defined(HAVE_AVX2)
+    const int block_size = 8;
+    typedef __m256 vec_type_f;
+    typedef __m256 vmask_type;
+#elif defined(HAVE_SSE)
+    const int block_size = 4;
+    typedef __m128 vec_type_f;
+    typedef __m128 vmask_type;
+#endif
+
+    // Boxes in the corner format with ordered coordinates stored as structure of arrays, so IoU of a box with
+    // several boxes is computed at once. Boxes with non-positive area are collapsed to a point with zero area,
+    // so their intersection with any box is empty
+    struct boxesSoA {
+        std::vector<float> ymin, xmin, ymax, xmax, area;
+
+        explicit boxesSoA(size_t size = 0) : ymin(size), xmin(size), ymax(size), xmax(size), area(size) {}
+
+        void set(size_t i, float y1, float x1, float y2, float x2) {
+            const float boxArea = (y2 - y1) * (x2 - x1);
+            if (boxArea > 0.f) {
+                ymin[i] = y1; xmin[i] = x1; ymax[i] = y2; xmax[i] = x2; area[i] = boxArea;
+            } else {
+                ymin[i] = xmin[i] = ymax[i] = xmax[i] = area[i] = 0.f;
+            }
+        }
+
+        void copy(size_t to, const boxesSoA& from, size_t i) {
+            ymin[to] = from.ymin[i]; xmin[to] = from.xmin[i]; ymax[to] = from.ymax[i]; xmax[to] = from.xmax[i];
+            area[to] = from.area[i];
+        }
+    };
+
+    void convertBoxes(const float *boxes, const SizeVector &boxesStrides, std::vector<boxesSoA> &converted) {
+        parallel_for2d(num_batches, num_boxes, [&](int batch_idx, int box_idx) {
+            const float *box = boxes + batch_idx * boxesStrides[0] + box_idx * 4;
+            if (boxEncodingType == boxEncoding::CENTER) {
+                //  box format: x_center, y_center, width, height
+                converted[batch_idx].set(box_idx, box[1] - box[3] / 2.f, box[0] - box[2] / 2.f,
+                                                  box[1] + box[3] / 2.f, box[0] + box[2] / 2.f);
+            } else {
+                //  box format: y1, x1, y2, x2
+                converted[batch_idx].set(box_idx, (std::min)(box[0], box[2]), (std::min)(box[1], box[3]),
+                                                  (std::max)(box[0], box[2]), (std::max)(box[1], box[3]));
+            }
+        });
+    }
+
+    // Checks whether the box has IoU not less than the threshold with any of the selected boxes.
+    // The result does not depend on the order of the selected boxes, so they are checked by blocks
+    bool isSuppressed(const boxesSoA &boxes, int box_idx, const boxesSoA &selected, int selected_num) {
+        const float ymin = boxes.ymin[box_idx], xmin = boxes.xmin[box_idx];
+        const float ymax = boxes.ymax[box_idx], xmax = boxes.xmax[box_idx];
+        const float area = boxes.area[box_idx];
+        // IoU of an empty box is zero
+        if (area <= 0.f)
+            return selected_num > 0 && 0.f >= iou_threshold;
+
+        int idx = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        const vec_type_f vymin = _mm_uni_set1_ps(ymin), vxmin = _mm_uni_set1_ps(xmin);
+        const vec_type_f vymax = _mm_uni_set1_ps(ymax), vxmax = _mm_uni_set1_ps(xmax);
+        const vec_type_f varea = _mm_uni_set1_ps(area), vthreshold = _mm_uni_set1_ps(iou_threshold);
+        const vec_type_f vzero = _mm_uni_setzero_ps();
+        for (; idx + block_size <= selected_num; idx += block_size) {
+            vec_type_f vheight = _mm_uni_sub_ps(_mm_uni_min_ps(vymax, _mm_uni_loadu_ps(&selected.ymax[idx])),
+                                                _mm_uni_max_ps(vymin, _mm_uni_loadu_ps(&selected.ymin[idx])));
+            vec_type_f vwidth = _mm_uni_sub_ps(_mm_uni_min_ps(vxmax, _mm_uni_loadu_ps(&selected.xmax[idx])),
+                                               _mm_uni_max_ps(vxmin, _mm_uni_loadu_ps(&selected.xmin[idx])));
+            vec_type_f vintersection = _mm_uni_mul_ps(_mm_uni_max_ps(vheight, vzero), _mm_uni_max_ps(vwidth, vzero));
+            vec_type_f vunion = _mm_uni_sub_ps(_mm_uni_add_ps(varea, _mm_uni_loadu_ps(&selected.area[idx])), vintersection);
+            // mask of boxes with IoU less than the threshold
+            vmask_type vmask = _mm_uni_cmpgt_ps(vthreshold, _mm_uni_div_ps(vintersection, vunion));
+#if defined(HAVE_AVX512F)
+            if (vmask != static_cast<vmask_type>((1 << block_size) - 1))
+                return true;
+#else
+            if (_mm_uni_movemask_ps(vmask) != (1 << block_size) - 1)
+                return true;
+#endif
+        }
+#endif
+        for (; idx < selected_num; idx++) {
+            const float intersection_area =
+                (std::max)((std::min)(ymax, selected.ymax[idx]) - (std::max)(ymin, selected.ymin[idx]), 0.f) *
+                (std::max)((std::min)(xmax, selected.xmax[idx]) - (std::max)(xmin, selected.xmin[idx]), 0.f);
+            if (intersection_area / (area + selected.area[idx] - intersection_area) >= iou_threshold)
+                return true;
+        }
+        return false;
+    }
+
     struct filteredBoxes {
         float score;
         int batch_index;
@@ -259,8 +358,12 @@ public:
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides, const SizeVector &scoresStrides,
                              std::vector<filteredBoxes> &filtBoxes) {
         int max_out_box = static_cast<int>(max_output_boxes_per_class);
+        // boxes are converted once per batch instead of once per IoU computation for every class
+        std::vector<boxesSoA> convertedBoxes(num_batches, boxesSoA(num_boxes));
+        convertBoxes(boxes, boxesStrides, convertedBoxes);
+
         parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const boxesSoA &batchBoxes = convertedBoxes[batch_idx];
             const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
             std::vector<std::pair<float, int>> sorted_boxes;
@@ -276,19 +379,10 @@ public:
                                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                                 });
                 int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-                filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
+                boxesSoA selectedBoxes((std::min)(sorted_boxes.size(), max_output_boxes_per_class));
+                for (size_t box_idx = 0; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
+                    if (!isSuppressed(batchBoxes, sorted_boxes[box_idx].second, selectedBoxes, io_selection_size)) {
+                        selectedBoxes.copy(io_selection_size, batchBoxes, sorted_boxes[box_idx].second);
                         filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
                         io_selection_size++;
                     }
@@ -354,18 +448,19 @@ public:
             nmsWithSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
         }
 
-        size_t startOffset = numFiltBox[0][0];
-        for (size_t b = 0; b < numFiltBox.size(); b++) {
-            size_t batchOffset = b*num_classes*max_output_boxes_per_class;
-            for (size_t c = (b == 0 ? 1 : 0); c < numFiltBox[b].size(); c++) {
-                size_t offset = batchOffset + c*max_output_boxes_per_class;
-                for (size_t i = 0; i < numFiltBox[b][c]; i++) {
-                    filtBoxes[startOffset + i] = filtBoxes[offset + i];
-                }
-                startOffset += numFiltBox[b][c];
+        // boxes selected for all classes are gathered in parallel to the offsets defined by the prefix sum of their numbers
+        std::vector<size_t> startOffsets(num_batches * num_classes + 1, 0);
+        for (size_t b = 0; b < num_batches; b++) {
+            for (size_t c = 0; c < num_classes; c++) {
+                startOffsets[b * num_classes + c + 1] = startOffsets[b * num_classes + c] + numFiltBox[b][c];
             }
         }
-        filtBoxes.resize(startOffset);
+        std::vector<filteredBoxes> gatheredBoxes(startOffsets.back());
+        parallel_for2d(num_batches, num_classes, [&](size_t b, size_t c) {
+            size_t offset = b*num_classes*max_output_boxes_per_class + c*max_output_boxes_per_class;
+            std::copy_n(filtBoxes.begin() + offset, numFiltBox[b][c], gatheredBoxes.begin() + startOffsets[b * num_classes + c]);
+        });
+        filtBoxes = std::move(gatheredBoxes);
 
         // need more particular comparator to get deterministic behaviour
         // escape situation when filtred boxes with same score have different position from launch to launch
@@ -115,7 +115,6 @@ public:
             }
 
             anchors = generate_anchors(conf);
-            roi_indices.resize(conf.post_nms_topn_);
 
             store_prob = layer->outData.size() == 2;
             if (store_prob) {
@@ -175,7 +174,7 @@ public:
             }
 
             XARCH::proposal_exec(p_bottom_item, p_d_anchor_item, dims0,
-                    {img_H, img_W, scale_H, scale_W}, anchors.data(), roi_indices.data(), p_roi_item, p_prob_item, conf);
+                    {img_H, img_W, scale_H, scale_W}, anchors.data(), p_roi_item, p_prob_item, conf);
 
             return OK;
         } catch (const InferenceEngine::details::InferenceEngineException& e) {
@@ -190,7 +189,6 @@ public:
 private:
     proposal_conf conf;
     std::vector<float> anchors;
-    std::vector<int> roi_indices;
     bool store_prob;  // store blob with proposal probabilities
 };
 
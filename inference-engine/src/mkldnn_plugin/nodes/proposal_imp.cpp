@@ -10,269 +10,290 @@
 #include <vector>
 #include <utility>
 #include <algorithm>
-#if defined(HAVE_AVX2)
+#include <numeric>
+#include "ie_parallel.hpp"
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
+#include "nodes/common/uni_simd.h"
 #endif
-#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
 namespace Cpu {
 namespace XARCH {
 
-static
-void enumerate_proposals_cpu(const float* bottom4d, const float* d_anchor4d, const float* anchors,
-                             float* proposals, const int num_anchors, const int bottom_H,
-                             const int bottom_W, const float img_H, const float img_W,
-                             const float min_box_H, const float min_box_W, const int feat_stride,
-                             const float box_coordinate_scale, const float box_size_scale,
-                             float coordinates_offset, bool initial_clip, bool swap_xy, bool clip_before_nms) {
-    const int bottom_area = bottom_H * bottom_W;
+#if defined(HAVE_AVX512F)
+static const int block_size = 16;
+typedef __m512 vec_type_f;
+typedef __mmask16 vmask_type;
 
-    const float* p_anchors_wm = anchors + 0 * num_anchors;
-    const float* p_anchors_hm = anchors + 1 * num_anchors;
-    const float* p_anchors_wp = anchors + 2 * num_anchors;
-    const float* p_anchors_hp = anchors + 3 * num_anchors;
-
-    parallel_for2d(bottom_H, bottom_W, [&](size_t h, size_t w) {
-        const float x = static_cast<float>((swap_xy ? h : w) * feat_stride);
-        const float y = static_cast<float>((swap_xy ? w : h) * feat_stride);
-
-        const float* p_box   = d_anchor4d + h * bottom_W + w;
-        const float* p_score = bottom4d   + h * bottom_W + w;
-
-        float* p_proposal = proposals + (h * bottom_W + w) * num_anchors * 5;
-
-        for (int anchor = 0; anchor < num_anchors; ++anchor) {
-            const float dx = p_box[(anchor * 4 + 0) * bottom_area] / box_coordinate_scale;
-            const float dy = p_box[(anchor * 4 + 1) * bottom_area] / box_coordinate_scale;
-
-            const float d_log_w = p_box[(anchor * 4 + 2) * bottom_area] / box_size_scale;
-            const float d_log_h = p_box[(anchor * 4 + 3) * bottom_area] / box_size_scale;
-
-            const float score = p_score[anchor * bottom_area];
-
-            float x0 = x + p_anchors_wm[anchor];
-            float y0 = y + p_anchors_hm[anchor];
-            float x1 = x + p_anchors_wp[anchor];
-            float y1 = y + p_anchors_hp[anchor];
-
-            if (initial_clip) {
-                // adjust new corner locations to be within the image region
-                x0 = std::max<float>(0.0f, std::min<float>(x0, img_W));
-                y0 = std::max<float>(0.0f, std::min<float>(y0, img_H));
-                x1 = std::max<float>(0.0f, std::min<float>(x1, img_W));
-                y1 = std::max<float>(0.0f, std::min<float>(y1, img_H));
-            }
-
-            // width & height of box
-            const float ww = x1 - x0 + coordinates_offset;
-            const float hh = y1 - y0 + coordinates_offset;
-            // center location of box
-            const float ctr_x = x0 + 0.5f * ww;
-            const float ctr_y = y0 + 0.5f * hh;
-
-            // new center location according to gradient (dx, dy)
-            const float pred_ctr_x = dx * ww + ctr_x;
-            const float pred_ctr_y = dy * hh + ctr_y;
-            // new width & height according to gradient d(log w), d(log h)
-            const float pred_w = std::exp(d_log_w) * ww;
-            const float pred_h = std::exp(d_log_h) * hh;
-
-            // update upper-left corner location
-            x0 = pred_ctr_x - 0.5f * pred_w;
-            y0 = pred_ctr_y - 0.5f * pred_h;
-            // update lower-right corner location
-            x1 = pred_ctr_x + 0.5f * pred_w;
-            y1 = pred_ctr_y + 0.5f * pred_h;
-
-            // adjust new corner locations to be within the image region,
-            if (clip_before_nms) {
-                x0 = std::max<float>(0.0f, std::min<float>(x0, img_W - coordinates_offset));
-                y0 = std::max<float>(0.0f, std::min<float>(y0, img_H - coordinates_offset));
-                x1 = std::max<float>(0.0f, std::min<float>(x1, img_W - coordinates_offset));
-                y1 = std::max<float>(0.0f, std::min<float>(y1, img_H - coordinates_offset));
-            }
-
-            // recompute new width & height
-            const float box_w = x1 - x0 + coordinates_offset;
-            const float box_h = y1 - y0 + coordinates_offset;
-
-            p_proposal[5*anchor + 0] = x0;
-            p_proposal[5*anchor + 1] = y0;
-            p_proposal[5*anchor + 2] = x1;
-            p_proposal[5*anchor + 3] = y1;
-            p_proposal[5*anchor + 4] = (min_box_W <= box_w) * (min_box_H <= box_h) * score;
-        }
-    });
+static inline int mask_bits(vmask_type vmask) {
+    return vmask;
 }
+#elif defined(HAVE_AVX2)
+static const int block_size = 8;
+typedef __m256 vec_type_f;
+typedef __m256 vmask_type;
 
-static void unpack_boxes(const float* p_proposals, float* unpacked_boxes, int pre_nms_topn, bool store_prob) {
-    if (store_prob) {
-        parallel_for(pre_nms_topn, [&](size_t i) {
-            unpacked_boxes[0 * pre_nms_topn + i] = p_proposals[5 * i + 0];
-            unpacked_boxes[1 * pre_nms_topn + i] = p_proposals[5 * i + 1];
-            unpacked_boxes[2 * pre_nms_topn + i] = p_proposals[5 * i + 2];
-            unpacked_boxes[3 * pre_nms_topn + i] = p_proposals[5 * i + 3];
-            unpacked_boxes[4 * pre_nms_topn + i] = p_proposals[5 * i + 4];
-        });
-    } else {
-        parallel_for(pre_nms_topn, [&](size_t i) {
-            unpacked_boxes[0 * pre_nms_topn + i] = p_proposals[5 * i + 0];
-            unpacked_boxes[1 * pre_nms_topn + i] = p_proposals[5 * i + 1];
-            unpacked_boxes[2 * pre_nms_topn + i] = p_proposals[5 * i + 2];
-            unpacked_boxes[3 * pre_nms_topn + i] = p_proposals[5 * i + 3];
-        });
-    }
+static inline int mask_bits(vmask_type vmask) {
+    return _mm_uni_movemask_ps(vmask);
 }
+#elif defined(HAVE_SSE42)
+static const int block_size = 4;
+typedef __m128 vec_type_f;
+typedef __m128 vmask_type;
 
-static void nms_cpu(const int num_boxes, int is_dead[],
-             const float* boxes, int index_out[], int* const num_out,
-             const int base_index, const float nms_thresh, const int max_num_out,
-             float coordinates_offset) {
-    const int num_proposals = num_boxes;
-    int count = 0;
-
-    const float* x0 = boxes + 0 * num_proposals;
-    const float* y0 = boxes + 1 * num_proposals;
-    const float* x1 = boxes + 2 * num_proposals;
-    const float* y1 = boxes + 3 * num_proposals;
-
-    std::memset(is_dead, 0, num_boxes * sizeof(int));
-
-#if defined(HAVE_AVX2)
-    __m256  vc_fone = _mm256_set1_ps(coordinates_offset);
-    __m256i vc_ione = _mm256_set1_epi32(1);
-    __m256  vc_zero = _mm256_set1_ps(0.0f);
-
-    __m256 vc_nms_thresh = _mm256_set1_ps(nms_thresh);
+static inline int mask_bits(vmask_type vmask) {
+    return _mm_uni_movemask_ps(vmask);
+}
 #endif
 
-    for (int box = 0; box < num_boxes; ++box) {
-        if (is_dead[box])
-            continue;
-
-        index_out[count++] = base_index + box;
-        if (count == max_num_out)
-            break;
+// Boxes stored as structure of arrays, so the same operation is applied to several boxes at once
+struct proposal_boxes {
+    std::vector<float> x0, y0, x1, y1, score;
 
-        int tail = box + 1;
+    explicit proposal_boxes(size_t size = 0) : x0(size), y0(size), x1(size), y1(size), score(size) {}
+};
 
-#if defined(HAVE_AVX2)
-        __m256 vx0i = _mm256_set1_ps(x0[box]);
-        __m256 vy0i = _mm256_set1_ps(y0[box]);
-        __m256 vx1i = _mm256_set1_ps(x1[box]);
-        __m256 vy1i = _mm256_set1_ps(y1[box]);
+struct proposal_params {
+    float img_H, img_W;
+    float min_box_H, min_box_W;
+    float coordinates_offset;
+    bool initial_clip;
+    bool clip_before_nms;
+};
 
-        __m256 vA_width  = _mm256_sub_ps(vx1i, vx0i);
-        __m256 vA_height = _mm256_sub_ps(vy1i, vy0i);
-        __m256 vA_area   = _mm256_mul_ps(_mm256_add_ps(vA_width, vc_fone), _mm256_add_ps(vA_height, vc_fone));
+static inline float clip(float value, float upper) {
+    return std::max<float>(0.0f, std::min<float>(value, upper));
+}
 
-        for (; tail <= num_boxes - 8; tail += 8) {
-            __m256i *pdst = reinterpret_cast<__m256i*>(is_dead + tail);
-            __m256i  vdst = _mm256_loadu_si256(pdst);
+// Decodes one row of boxes of the anchor. Proposals are stored in the order of the inputs (anchor, h, w), so the
+// row is contiguous in both the inputs and the outputs. Offsets of the anchor box from the feature map location
+// are x_shift + [anchor_wm, anchor_wp] and y_shift + [anchor_hm, anchor_hp], shifts which are constant along
+// the row are passed as a single value
+static void decode_row(const float* p_dx, const float* p_dy, const float* p_dlogw, const float* p_dlogh,
+                       const float* p_score, const float* x_shifts, const float* y_shifts, bool x_varies,
+                       const float anchor[4], int W, float box_coordinate_scale, float box_size_scale,
+                       const proposal_params& p, float* x0, float* y0, float* x1, float* y1, float* scores) {
+    // the exponents are computed in a scalar loop and kept in the destination rows
+    for (int w = 0; w < W; ++w) {
+        x1[w] = std::exp(p_dlogw[w] / box_size_scale);
+        y1[w] = std::exp(p_dlogh[w] / box_size_scale);
+    }
 
-            __m256 vx0j = _mm256_loadu_ps(x0 + tail);
-            __m256 vy0j = _mm256_loadu_ps(y0 + tail);
-            __m256 vx1j = _mm256_loadu_ps(x1 + tail);
-            __m256 vy1j = _mm256_loadu_ps(y1 + tail);
+    int w = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type_f vzero = _mm_uni_setzero_ps();
+    const vec_type_f vhalf = _mm_uni_set1_ps(0.5f);
+    const vec_type_f voffset = _mm_uni_set1_ps(p.coordinates_offset);
+    const vec_type_f vimg_W = _mm_uni_set1_ps(p.img_W), vimg_H = _mm_uni_set1_ps(p.img_H);
+    const vec_type_f vclip_W = _mm_uni_set1_ps(p.img_W - p.coordinates_offset);
+    const vec_type_f vclip_H = _mm_uni_set1_ps(p.img_H - p.coordinates_offset);
+    const vec_type_f vmin_box_W = _mm_uni_set1_ps(p.min_box_W), vmin_box_H = _mm_uni_set1_ps(p.min_box_H);
+    const vec_type_f vcoordinate_scale = _mm_uni_set1_ps(box_coordinate_scale);
+    const vec_type_f vanchor_wm = _mm_uni_set1_ps(anchor[0]), vanchor_hm = _mm_uni_set1_ps(anchor[1]);
+    const vec_type_f vanchor_wp = _mm_uni_set1_ps(anchor[2]), vanchor_hp = _mm_uni_set1_ps(anchor[3]);
+
+    for (; w + block_size <= W; w += block_size) {
+        const vec_type_f vx = x_varies ? _mm_uni_loadu_ps(x_shifts + w) : _mm_uni_set1_ps(x_shifts[0]);
+        const vec_type_f vy = x_varies ? _mm_uni_set1_ps(y_shifts[0]) : _mm_uni_loadu_ps(y_shifts + w);
+
+        vec_type_f vx0 = _mm_uni_add_ps(vx, vanchor_wm);
+        vec_type_f vy0 = _mm_uni_add_ps(vy, vanchor_hm);
+        vec_type_f vx1 = _mm_uni_add_ps(vx, vanchor_wp);
+        vec_type_f vy1 = _mm_uni_add_ps(vy, vanchor_hp);
+        if (p.initial_clip) {
+            vx0 = _mm_uni_max_ps(vzero, _mm_uni_min_ps(vx0, vimg_W));
+            vy0 = _mm_uni_max_ps(vzero, _mm_uni_min_ps(vy0, vimg_H));
+            vx1 = _mm_uni_max_ps(vzero, _mm_uni_min_ps(vx1, vimg_W));
+            vy1 = _mm_uni_max_ps(vzero, _mm_uni_min_ps(vy1, vimg_H));
+        }
 
-            __m256 vx0 = _mm256_max_ps(vx0i, vx0j);
-            __m256 vy0 = _mm256_max_ps(vy0i, vy0j);
-            __m256 vx1 = _mm256_min_ps(vx1i, vx1j);
-            __m256 vy1 = _mm256_min_ps(vy1i, vy1j);
+        const vec_type_f vww = _mm_uni_add_ps(_mm_uni_sub_ps(vx1, vx0), voffset);
+        const vec_type_f vhh = _mm_uni_add_ps(_mm_uni_sub_ps(vy1, vy0), voffset);
+        const vec_type_f vctr_x = _mm_uni_add_ps(vx0, _mm_uni_mul_ps(vhalf, vww));
+        const vec_type_f vctr_y = _mm_uni_add_ps(vy0, _mm_uni_mul_ps(vhalf, vhh));
+
+        const vec_type_f vdx = _mm_uni_div_ps(_mm_uni_loadu_ps(p_dx + w), vcoordinate_scale);
+        const vec_type_f vdy = _mm_uni_div_ps(_mm_uni_loadu_ps(p_dy + w), vcoordinate_scale);
+        const vec_type_f vpred_ctr_x = _mm_uni_add_ps(_mm_uni_mul_ps(vdx, vww), vctr_x);
+        const vec_type_f vpred_ctr_y = _mm_uni_add_ps(_mm_uni_mul_ps(vdy, vhh), vctr_y);
+        const vec_type_f vhalf_w = _mm_uni_mul_ps(vhalf, _mm_uni_mul_ps(_mm_uni_loadu_ps(x1 + w), vww));
+        const vec_type_f vhalf_h = _mm_uni_mul_ps(vhalf, _mm_uni_mul_ps(_mm_uni_loadu_ps(y1 + w), vhh));
+
+        vx0 = _mm_uni_sub_ps(vpred_ctr_x, vhalf_w);
+        vy0 = _mm_uni_sub_ps(vpred_ctr_y, vhalf_h);
+        vx1 = _mm_uni_add_ps(vpred_ctr_x, vhalf_w);
+        vy1 = _mm_uni_add_ps(vpred_ctr_y, vhalf_h);
+        if (p.clip_before_nms) {
+            vx0 = _mm_uni_max_ps(vzero, _mm_uni_min_ps(vx0, vclip_W));
+            vy0 = _mm_uni_max_ps(vzero, _mm_uni_min_ps(vy0, vclip_H));
+            vx1 = _mm_uni_max_ps(vzero, _mm_uni_min_ps(vx1, vclip_W));
+            vy1 = _mm_uni_max_ps(vzero, _mm_uni_min_ps(vy1, vclip_H));
+        }
 
-            __m256 vwidth  = _mm256_add_ps(_mm256_sub_ps(vx1, vx0), vc_fone);
-            __m256 vheight = _mm256_add_ps(_mm256_sub_ps(vy1, vy0), vc_fone);
-            __m256 varea = _mm256_mul_ps(_mm256_max_ps(vc_zero, vwidth), _mm256_max_ps(vc_zero, vheight));
+        // too small boxes get zero score
+        const vec_type_f vbox_w = _mm_uni_add_ps(_mm_uni_sub_ps(vx1, vx0), voffset);
+        const vec_type_f vbox_h = _mm_uni_add_ps(_mm_uni_sub_ps(vy1, vy0), voffset);
+        vec_type_f vscore = _mm_uni_loadu_ps(p_score + w);
+        vscore = _mm_uni_blendv_ps(vscore, vzero, _mm_uni_cmpgt_ps(vmin_box_W, vbox_w));
+        vscore = _mm_uni_blendv_ps(vscore, vzero, _mm_uni_cmpgt_ps(vmin_box_H, vbox_h));
+
+        _mm_uni_storeu_ps(x0 + w, vx0);
+        _mm_uni_storeu_ps(y0 + w, vy0);
+        _mm_uni_storeu_ps(x1 + w, vx1);
+        _mm_uni_storeu_ps(y1 + w, vy1);
+        _mm_uni_storeu_ps(scores + w, vscore);
+    }
+#endif
 
-            __m256 vB_width  = _mm256_sub_ps(vx1j, vx0j);
-            __m256 vB_height = _mm256_sub_ps(vy1j, vy0j);
-            __m256 vB_area   = _mm256_mul_ps(_mm256_add_ps(vB_width, vc_fone), _mm256_add_ps(vB_height, vc_fone));
+    for (; w < W; ++w) {
+        const float x = x_varies ? x_shifts[w] : x_shifts[0];
+        const float y = x_varies ? y_shifts[0] : y_shifts[w];
+
+        float box_x0 = x + anchor[0];
+        float box_y0 = y + anchor[1];
+        float box_x1 = x + anchor[2];
+        float box_y1 = y + anchor[3];
+        if (p.initial_clip) {
+            // adjust new corner locations to be within the image region
+            box_x0 = clip(box_x0, p.img_W);
+            box_y0 = clip(box_y0, p.img_H);
+            box_x1 = clip(box_x1, p.img_W);
+            box_y1 = clip(box_y1, p.img_H);
+        }
 
-            __m256 vdivisor = _mm256_sub_ps(_mm256_add_ps(vA_area, vB_area), varea);
-            __m256 vintersection_area = _mm256_div_ps(varea, vdivisor);
+        // width & height of box
+        const float ww = box_x1 - box_x0 + p.coordinates_offset;
+        const float hh = box_y1 - box_y0 + p.coordinates_offset;
+        // center location of box
+        const float ctr_x = box_x0 + 0.5f * ww;
+        const float ctr_y = box_y0 + 0.5f * hh;
+
+        // new center location according to gradient (dx, dy)
+        const float pred_ctr_x = p_dx[w] / box_coordinate_scale * ww + ctr_x;
+        const float pred_ctr_y = p_dy[w] / box_coordinate_scale * hh + ctr_y;
+        // new half width & height according to gradient d(log w), d(log h)
+        const float half_w = 0.5f * (x1[w] * ww);
+        const float half_h = 0.5f * (y1[w] * hh);
+
+        box_x0 = pred_ctr_x - half_w;
+        box_y0 = pred_ctr_y - half_h;
+        box_x1 = pred_ctr_x + half_w;
+        box_y1 = pred_ctr_y + half_h;
+        if (p.clip_before_nms) {
+            // adjust new corner locations to be within the image region
+            box_x0 = clip(box_x0, p.img_W - p.coordinates_offset);
+            box_y0 = clip(box_y0, p.img_H - p.coordinates_offset);
+            box_x1 = clip(box_x1, p.img_W - p.coordinates_offset);
+            box_y1 = clip(box_y1, p.img_H - p.coordinates_offset);
+        }
 
-            __m256 vcmp_0 = _mm256_cmp_ps(vx0i, vx1j, _CMP_LE_OS);
-            __m256 vcmp_1 = _mm256_cmp_ps(vy0i, vy1j, _CMP_LE_OS);
-            __m256 vcmp_2 = _mm256_cmp_ps(vx0j, vx1i, _CMP_LE_OS);
-            __m256 vcmp_3 = _mm256_cmp_ps(vy0j, vy1i, _CMP_LE_OS);
-            __m256 vcmp_4 = _mm256_cmp_ps(vc_nms_thresh, vintersection_area, _CMP_LT_OS);
+        // recompute new width & height
+        const float box_w = box_x1 - box_x0 + p.coordinates_offset;
+        const float box_h = box_y1 - box_y0 + p.coordinates_offset;
 
-            vcmp_0 = _mm256_and_ps(vcmp_0, vcmp_1);
-            vcmp_2 = _mm256_and_ps(vcmp_2, vcmp_3);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_0);
-            vcmp_4 = _mm256_and_ps(vcmp_4, vcmp_2);
+        x0[w] = box_x0;
+        y0[w] = box_y0;
+        x1[w] = box_x1;
+        y1[w] = box_y1;
+        scores[w] = (p.min_box_W > box_w || p.min_box_H > box_h) ? 0.f : p_score[w];
+    }
+}
 
-            _mm256_storeu_si256(pdst, _mm256_blendv_epi8(vdst, vc_ione, _mm256_castps_si256(vcmp_4)));
-        }
+// Checks whether the box has IoU greater than the threshold with any of the selected boxes.
+// Areas of the selected boxes are kept in the score array of the selection
+static bool is_suppressed(float x0, float y0, float x1, float y1, const proposal_boxes& selected, int num_selected,
+                          float nms_thresh, float coordinates_offset) {
+    const float area = (x1 - x0 + coordinates_offset) * (y1 - y0 + coordinates_offset);
+
+    int idx = 0;
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const vec_type_f vx0i = _mm_uni_set1_ps(x0), vy0i = _mm_uni_set1_ps(y0);
+    const vec_type_f vx1i = _mm_uni_set1_ps(x1), vy1i = _mm_uni_set1_ps(y1);
+    const vec_type_f varea = _mm_uni_set1_ps(area), vnms_thresh = _mm_uni_set1_ps(nms_thresh);
+    const vec_type_f voffset = _mm_uni_set1_ps(coordinates_offset);
+    const vec_type_f vzero = _mm_uni_setzero_ps();
+    for (; idx + block_size <= num_selected; idx += block_size) {
+        const vec_type_f vx0j = _mm_uni_loadu_ps(&selected.x0[idx]), vy0j = _mm_uni_loadu_ps(&selected.y0[idx]);
+        const vec_type_f vx1j = _mm_uni_loadu_ps(&selected.x1[idx]), vy1j = _mm_uni_loadu_ps(&selected.y1[idx]);
+
+        const vec_type_f vwidth = _mm_uni_add_ps(_mm_uni_sub_ps(_mm_uni_min_ps(vx1i, vx1j), _mm_uni_max_ps(vx0i, vx0j)),
+                                                 voffset);
+        const vec_type_f vheight = _mm_uni_add_ps(_mm_uni_sub_ps(_mm_uni_min_ps(vy1i, vy1j), _mm_uni_max_ps(vy0i, vy0j)),
+                                                  voffset);
+        const vec_type_f vintersection = _mm_uni_mul_ps(_mm_uni_max_ps(vzero, vwidth), _mm_uni_max_ps(vzero, vheight));
+        const vec_type_f vunion = _mm_uni_sub_ps(_mm_uni_add_ps(varea, _mm_uni_loadu_ps(&selected.score[idx])),
+                                                 vintersection);
+
+        // boxes which do not overlap have zero IoU even when the coordinates offset makes the intersection positive
+        const int disjoint = mask_bits(_mm_uni_cmpgt_ps(vx0i, vx1j)) | mask_bits(_mm_uni_cmpgt_ps(vy0i, vy1j)) |
+                             mask_bits(_mm_uni_cmpgt_ps(vx0j, vx1i)) | mask_bits(_mm_uni_cmpgt_ps(vy0j, vy1i));
+        const int overlapped = mask_bits(_mm_uni_cmpgt_ps(_mm_uni_div_ps(vintersection, vunion), vnms_thresh));
+        if (overlapped & ~disjoint)
+            return true;
+    }
 #endif
 
-        for (; tail < num_boxes; ++tail) {
-            float res = 0.0f;
-
-            const float x0i = x0[box];
-            const float y0i = y0[box];
-            const float x1i = x1[box];
-            const float y1i = y1[box];
-
-            const float x0j = x0[tail];
-            const float y0j = y0[tail];
-            const float x1j = x1[tail];
-            const float y1j = y1[tail];
-
-            if (x0i <= x1j && y0i <= y1j && x0j <= x1i && y0j <= y1i) {
-                // overlapped region (= box)
-                const float x0 = std::max<float>(x0i, x0j);
-                const float y0 = std::max<float>(y0i, y0j);
-                const float x1 = std::min<float>(x1i, x1j);
-                const float y1 = std::min<float>(y1i, y1j);
-
-                // intersection area
-                const float width  = std::max<float>(0.0f,  x1 - x0 + coordinates_offset);
-                const float height = std::max<float>(0.0f,  y1 - y0 + coordinates_offset);
-                const float area   = width * height;
-
-                // area of A, B
-                const float A_area = (x1i - x0i + coordinates_offset) * (y1i - y0i + coordinates_offset);
-                const float B_area = (x1j - x0j + coordinates_offset) * (y1j - y0j + coordinates_offset);
-
-                // IoU
-                res = area / (A_area + B_area - area);
-            }
-
-            if (nms_thresh < res)
-                is_dead[tail] = 1;
+    for (; idx < num_selected; ++idx) {
+        const float x0j = selected.x0[idx];
+        const float y0j = selected.y0[idx];
+        const float x1j = selected.x1[idx];
+        const float y1j = selected.y1[idx];
+
+        if (x0 <= x1j && y0 <= y1j && x0j <= x1 && y0j <= y1) {
+            // intersection area
+            const float width  = std::max<float>(0.0f, std::min<float>(x1, x1j) - std::max<float>(x0, x0j) + coordinates_offset);
+            const float height = std::max<float>(0.0f, std::min<float>(y1, y1j) - std::max<float>(y0, y0j) + coordinates_offset);
+            const float intersection = width * height;
+
+            if (nms_thresh < intersection / (area + selected.score[idx] - intersection))
+                return true;
         }
     }
-
-    *num_out = count;
+    return false;
 }
 
-static void retrieve_rois_cpu(const int num_rois, const int item_index,
-                              const int num_proposals,
-                              const float* proposals, const int roi_indices[],
-                              float* rois, int post_nms_topn_,
-                              bool normalize, float img_h, float img_w, bool clip_after_nms, float* probs) {
-    const float *src_x0 = proposals + 0 * num_proposals;
-    const float *src_y0 = proposals + 1 * num_proposals;
-    const float *src_x1 = proposals + 2 * num_proposals;
-    const float *src_y1 = proposals + 3 * num_proposals;
-    const float *src_probs = proposals + 4 * num_proposals;
+// Greedy NMS over the boxes sorted by score: a box is kept if it does not overlap any of the already kept boxes,
+// so the IoU is computed only with kept boxes and the search stops when max_num_out boxes are kept
+static int nms_cpu(const proposal_boxes& boxes, int* order, int num_boxes, proposal_boxes& selected,
+                   float nms_thresh, int max_num_out, float coordinates_offset) {
+    int count = 0;
+    for (int i = 0; i < num_boxes && count < max_num_out; ++i) {
+        const int box = order[i];
+        const float x0 = boxes.x0[box];
+        const float y0 = boxes.y0[box];
+        const float x1 = boxes.x1[box];
+        const float y1 = boxes.y1[box];
+
+        if (is_suppressed(x0, y0, x1, y1, selected, count, nms_thresh, coordinates_offset))
+            continue;
 
-    parallel_for(num_rois, [&](size_t roi) {
-        int index = roi_indices[roi];
+        selected.x0[count] = x0;
+        selected.y0[count] = y0;
+        selected.x1[count] = x1;
+        selected.y1[count] = y1;
+        selected.score[count] = (x1 - x0 + coordinates_offset) * (y1 - y0 + coordinates_offset);
+        order[count] = box;
+        count++;
+    }
+    return count;
+}
 
-        float x0 = src_x0[index];
-        float y0 = src_y0[index];
-        float x1 = src_x1[index];
-        float y1 = src_y1[index];
+static void retrieve_rois_cpu(const int num_rois, const int item_index, const proposal_boxes& selected,
+                              const float* scores, const int* order, float* rois, int post_nms_topn_,
+                              bool normalize, float img_h, float img_w, bool clip_after_nms, float* probs) {
+    for (int roi = 0; roi < num_rois; ++roi) {
+        float x0 = selected.x0[roi];
+        float y0 = selected.y0[roi];
+        float x1 = selected.x1[roi];
+        float y1 = selected.y1[roi];
 
         if (clip_after_nms) {
-            x0 = std::max<float>(0.0f, std::min<float>(x0, img_w));
-            y0 = std::max<float>(0.0f, std::min<float>(y0, img_h));
-            x1 = std::max<float>(0.0f, std::min<float>(x1, img_w));
-            y1 = std::max<float>(0.0f, std::min<float>(y1, img_h));
+            x0 = clip(x0, img_w);
+            y0 = clip(y0, img_h);
+            x1 = clip(x1, img_w);
+            y1 = clip(y1, img_h);
         }
 
         if (normalize) {
@@ -289,8 +310,8 @@ static void retrieve_rois_cpu(const int num_rois, const int item_index,
         rois[roi * 5 + 4] = y1;
 
         if (probs)
-            probs[roi] = src_probs[index];
-    });
+            probs[roi] = scores[order[roi]];
+    }
 
     if (num_rois < post_nms_topn_) {
         for (int i = 5 * num_rois; i < 5 * post_nms_topn_; i++) {
@@ -304,8 +325,7 @@ static void retrieve_rois_cpu(const int num_rois, const int item_index,
 
 void proposal_exec(const float* input0, const float* input1,
              std::vector<size_t> dims0, std::array<float, 4> img_info,
-             const float* anchors, int* roi_indices,
-             float* output0, float* output1, proposal_conf &conf) {
+             const float* anchors, float* output0, float* output1, proposal_conf &conf) {
     // Prepare memory
     const float *p_bottom_item = input0;
     const float *p_d_anchor_item = input1;
@@ -314,71 +334,81 @@ void proposal_exec(const float* input0, const float* input1,
     float *p_prob_item = output1;
     auto store_prob = p_prob_item != nullptr;
 
-    // bottom shape: (2 x num_anchors) x H x W
+    // bottom shape: N x (2 x num_anchors) x H x W
+    const int batch = static_cast<int>(dims0[0]);
     const int bottom_H = dims0[2];
     const int bottom_W = dims0[3];
+    const int bottom_area = bottom_H * bottom_W;
+    const int num_anchors = static_cast<int>(conf.anchors_shape_0);
 
+    proposal_params params;
     // input image height & width
-    const float img_H = img_info[conf.swap_xy ? 1 : 0];
-    const float img_W = img_info[conf.swap_xy ? 0 : 1];
-
-    // scale factor for height & width
-    const float scale_H = img_info[2];
-    const float scale_W = img_info[3];
-
-    // minimum box width & height
-    const float min_box_H = conf.min_size_ * scale_H;
-    const float min_box_W = conf.min_size_ * scale_W;
+    params.img_H = img_info[conf.swap_xy ? 1 : 0];
+    params.img_W = img_info[conf.swap_xy ? 0 : 1];
+    // minimum box width & height, scale factor for height & width is applied
+    params.min_box_H = conf.min_size_ * img_info[2];
+    params.min_box_W = conf.min_size_ * img_info[3];
+    params.coordinates_offset = conf.coordinates_offset;
+    params.initial_clip = conf.initial_clip;
+    params.clip_before_nms = conf.clip_before_nms;
 
     // number of all proposals = num_anchors * H * W
-    const int num_proposals = conf.anchors_shape_0 * bottom_H * bottom_W;
+    const int num_proposals = num_anchors * bottom_area;
 
     // number of top-n proposals before NMS
     const int pre_nms_topn = std::min<int>(num_proposals, conf.pre_nms_topn_);
 
-    // number of final RoIs
-    int num_rois = 0;
+    // shifts of anchors along the rows and the columns of the feature map
+    std::vector<float> w_shifts(bottom_W), h_shifts(bottom_H);
+    for (int w = 0; w < bottom_W; ++w)
+        w_shifts[w] = static_cast<float>(w * conf.feat_stride_);
+    for (int h = 0; h < bottom_H; ++h)
+        h_shifts[h] = static_cast<float>(h * conf.feat_stride_);
 
-    // enumerate all proposals
-    //   num_proposals = num_anchors * H * W
-    //   (x1, y1, x2, y2, score) for each proposal
+    // enumerate all proposals of all items, (x1, y1, x2, y2, score) for each proposal
     // NOTE: for bottom, only foreground scores are passed
-    struct ProposalBox {
-        float x0;
-        float y0;
-        float x1;
-        float y1;
-        float score;
-    };
-    std::vector<ProposalBox> proposals_(num_proposals);
-    const int unpacked_boxes_buffer_size = store_prob ? 5 * pre_nms_topn : 4 * pre_nms_topn;
-    std::vector<float> unpacked_boxes(unpacked_boxes_buffer_size);
-    std::vector<int> is_dead(pre_nms_topn);
-
-    // Execute
-    int nn = dims0[0];
-    for (int n = 0; n < nn; ++n) {
-        enumerate_proposals_cpu(p_bottom_item + num_proposals + n * num_proposals * 2,
-                                p_d_anchor_item + n * num_proposals * 4,
-                                anchors, reinterpret_cast<float *>(&proposals_[0]),
-                                conf.anchors_shape_0, bottom_H, bottom_W, img_H, img_W,
-                                min_box_H, min_box_W, conf.feat_stride_,
-                                conf.box_coordinate_scale_, conf.box_size_scale_,
-                                conf.coordinates_offset, conf.initial_clip, conf.swap_xy, conf.clip_before_nms);
-        std::partial_sort(proposals_.begin(), proposals_.begin() + pre_nms_topn, proposals_.end(),
-                          [](const ProposalBox &struct1, const ProposalBox &struct2) {
-                              return (struct1.score > struct2.score);
-                          });
-
-        unpack_boxes(reinterpret_cast<float *>(&proposals_[0]), &unpacked_boxes[0], pre_nms_topn, store_prob);
-        nms_cpu(pre_nms_topn, &is_dead[0], &unpacked_boxes[0], roi_indices, &num_rois, 0, conf.nms_thresh_,
-                conf.post_nms_topn_, conf.coordinates_offset);
+    std::vector<proposal_boxes> proposals(batch, proposal_boxes(num_proposals));
+    parallel_for3d(batch, num_anchors, bottom_H, [&](int n, int anchor, int h) {
+        const float* p_box = p_d_anchor_item + n * num_proposals * 4 + anchor * 4 * bottom_area + h * bottom_W;
+        const float* p_score = p_bottom_item + num_proposals + n * num_proposals * 2 + anchor * bottom_area + h * bottom_W;
+        const float anchor_box[4] = {anchors[0 * num_anchors + anchor], anchors[1 * num_anchors + anchor],
+                                     anchors[2 * num_anchors + anchor], anchors[3 * num_anchors + anchor]};
+        // with swapped coordinates x is taken from the row index and y from the column index
+        const float* x_shifts = conf.swap_xy ? &h_shifts[h] : &w_shifts[0];
+        const float* y_shifts = conf.swap_xy ? &w_shifts[0] : &h_shifts[h];
+
+        proposal_boxes& boxes = proposals[n];
+        const int offset = anchor * bottom_area + h * bottom_W;
+        decode_row(p_box, p_box + bottom_area, p_box + 2 * bottom_area, p_box + 3 * bottom_area, p_score,
+                   x_shifts, y_shifts, !conf.swap_xy, anchor_box, bottom_W,
+                   conf.box_coordinate_scale_, conf.box_size_scale_, params,
+                   &boxes.x0[offset], &boxes.y0[offset], &boxes.x1[offset], &boxes.y1[offset], &boxes.score[offset]);
+    });
+
+    // items are independent, so sorting and NMS of different items run in parallel
+    parallel_for(batch, [&](int n) {
+        const proposal_boxes& boxes = proposals[n];
+        const float* scores = boxes.score.data();
+
+        // only the top pre_nms_topn proposals are ordered, ties are resolved by the order of the proposals
+        // in the original (h, w, anchor) layout
+        auto proposal_rank = [&](int idx) {
+            return (idx % bottom_area) * num_anchors + idx / bottom_area;
+        };
+        std::vector<int> order(num_proposals);
+        std::iota(order.begin(), order.end(), 0);
+        std::partial_sort(order.begin(), order.begin() + pre_nms_topn, order.end(), [&](int a, int b) {
+            return scores[a] > scores[b] || (scores[a] == scores[b] && proposal_rank(a) < proposal_rank(b));
+        });
+
+        proposal_boxes selected(conf.post_nms_topn_);
+        const int num_rois = nms_cpu(boxes, order.data(), pre_nms_topn, selected, conf.nms_thresh_,
+                                     conf.post_nms_topn_, conf.coordinates_offset);
 
         float* p_probs = store_prob ? p_prob_item + n * conf.post_nms_topn_ : nullptr;
-        retrieve_rois_cpu(num_rois, n, pre_nms_topn, &unpacked_boxes[0], roi_indices,
-                          p_roi_item + n * conf.post_nms_topn_ * 5,
-                          conf.post_nms_topn_, conf.normalize_, img_H, img_W, conf.clip_after_nms, p_probs);
-    }
+        retrieve_rois_cpu(num_rois, n, selected, scores, order.data(), p_roi_item + n * conf.post_nms_topn_ * 5,
+                          conf.post_nms_topn_, conf.normalize_, params.img_H, params.img_W, conf.clip_after_nms, p_probs);
+    });
 }
 
 
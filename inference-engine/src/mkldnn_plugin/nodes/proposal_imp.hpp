@@ -39,8 +39,7 @@ namespace XARCH {
 
 void proposal_exec(const float* input0, const float* input1,
         std::vector<size_t> dims0, std::array<float, 4> img_info,
-        const float* anchors, int* roi_indices,
-        float* output0, float* output1, proposal_conf &conf);
+        const float* anchors, float* output0, float* output1, proposal_conf &conf);
 
 }  // namespace XARCH
 }  // namespace Cpu
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <memory>
 #include <ie_parallel.hpp>
+#include "mkldnn_selective_build.h"
 #include "jit_generator.hpp"
 #include "jit_uni_eltwise.hpp"
 
@@ -180,13 +181,13 @@ public:
             mask = layer->GetParamAsInts("mask", {});
 
             block_size = 1;
-            if (mayiuse(avx512_common)) {
+            if (MKLDNN_ISA(avx512_common)) {
                 logistic_kernel.reset(new jit_uni_logistic_kernel_f32<avx512_common>());
                 block_size = 16;
-            } else if (mayiuse(avx2)) {
+            } else if (MKLDNN_ISA(avx2)) {
                 logistic_kernel.reset(new jit_uni_logistic_kernel_f32<avx2>());
                 block_size = 8;
-            } else if (mayiuse(sse42)) {
+            } else if (MKLDNN_ISA(sse42)) {
                 logistic_kernel.reset(new jit_uni_logistic_kernel_f32<sse42>());
                 block_size = 4;
             }
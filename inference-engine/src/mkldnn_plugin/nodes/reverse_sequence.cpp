@@ -9,7 +9,7 @@
 #include <vector>
 #include <cassert>
 #include <algorithm>
-#include "ie_parallel.hpp"
+#include "common/cpu_strided_copy.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -56,8 +56,10 @@ public:
             if (seq_lengths_dims[0] != dst_dims[batch_axis])
                 THROW_IE_EXCEPTION << layer->name << " Incorrect 'seq_lengths_dims' parameters dimension!";
 
+            if (seq_axis == batch_axis)
+                THROW_IE_EXCEPTION << layer->name << " 'seq_axis' and 'batch_axis' should be different!";
+
             srcStrides = layer->insData[REVERSESEQUENCE_DATA].lock()->getTensorDesc().getBlockingDesc().getStrides();
-            work_amount_dst = srcStrides[0] * src_dims[0];
 
             addConfig(layer,
                     { DataConfigurator(ConfLayout::PLN, Precision::FP32), DataConfigurator(ConfLayout::PLN) },
@@ -68,7 +70,6 @@ public:
     }
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        size_t i;
         const float *src_data = inputs[REVERSESEQUENCE_DATA]->cbuffer().as<const float *>() +
                                 inputs[REVERSESEQUENCE_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         float* dst_data = outputs[0]->cbuffer().as<float *>() +
@@ -76,101 +77,68 @@ public:
 
         switch (inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getPrecision()) {
             case Precision::FP32: {
-                float *seq_lengths_data = inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<float *>() +
-                                          inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-                for (i = 0; i < src_dims[batch_axis]; i++) {
-                    if (static_cast<int32_t>(seq_lengths_data[i]) > static_cast<int>(src_dims[seq_axis])) {
-                        if (resp) {
-                            std::string errorMsg = "Incorrect input 'seq_lengths' values!";
-                            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-                        }
-                        return PARAMETER_MISMATCH;
-                    }
-                }
-
-                parallel_nt(0, [&](const int ithr, const int nthr) {
-                    size_t i, start = 0, end = 0, src_idx = 0;
-                    SizeVector counters(src_dims.size(), 0);
-                    splitter(work_amount_dst, nthr, ithr, start, end);
-                    for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
-                        counters[j] = i % src_dims[j];
-                        i /= src_dims[j];
-                    }
-
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
-                            size_t idx = counters[i];
-                            if (static_cast<int>(i) == seq_axis &&
-                                    static_cast<int>(idx) < static_cast<int32_t>(seq_lengths_data[counters[batch_axis]])) {
-                                idx = static_cast<int32_t>(seq_lengths_data[counters[batch_axis]]) - idx - 1;
-                            }
-                            src_idx += idx * srcStrides[i];
-                        }
-                        dst_data[iwork] = src_data[src_idx];
-                        for (int j = src_dims.size() - 1; j >= 0; j--) {
-                            counters[j] = (counters[j] + 1) % src_dims[j];
-                            if (counters[j] != 0) break;
-                        }
-                    }
-                });
+                const float *seq_lengths_data = inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<const float *>() +
+                                                inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+                return reverse_sequence(src_data, dst_data, seq_lengths_data, resp);
             }
-            break;
             case Precision::I32: {
-                int32_t *seq_lengths_data = inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<int32_t *>() +
-                                            inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-                for (i = 0; i < src_dims[batch_axis]; i++) {
-                    if (seq_lengths_data[i] > static_cast<int>(src_dims[seq_axis])) {
-                        if (resp) {
-                            std::string errorMsg = "Incorrect input 'seq_lengths' values!";
-                            errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
-                        }
-                        return PARAMETER_MISMATCH;
-                    }
-                }
-
-                parallel_nt(0, [&](const int ithr, const int nthr) {
-                    size_t i, start = 0, end = 0, src_idx = 0;
-                    SizeVector counters(src_dims.size(), 0);
-                    splitter(work_amount_dst, nthr, ithr, start, end);
-                    for (int j = src_dims.size() - 1, i = start; j >= 0; j--) {
-                        counters[j] = i % src_dims[j];
-                        i /= src_dims[j];
-                    }
-
-                    for (size_t iwork = start; iwork < end; ++iwork) {
-                        for (i = 0, src_idx = 0; i < src_dims.size(); ++i) {
-                            size_t idx = counters[i];
-                            if (static_cast<int>(i) == seq_axis &&
-                                    static_cast<int>(idx) < seq_lengths_data[counters[batch_axis]]) {
-                                idx = seq_lengths_data[counters[batch_axis]] - idx - 1;
-                            }
-                            src_idx += idx * srcStrides[i];
-                        }
-                        dst_data[iwork] = src_data[src_idx];
-                        for (int j = src_dims.size() - 1; j >= 0; j--) {
-                            counters[j] = (counters[j] + 1) % src_dims[j];
-                            if (counters[j] != 0) break;
-                        }
-                    }
-                });
+                const int32_t *seq_lengths_data = inputs[REVERSESEQUENCE_LENGTHS]->cbuffer().as<const int32_t *>() +
+                                                  inputs[REVERSESEQUENCE_LENGTHS]->getTensorDesc().getBlockingDesc().getOffsetPadding();
+                return reverse_sequence(src_data, dst_data, seq_lengths_data, resp);
             }
-            break;
             default:
                 return GENERAL_ERROR;
         }
-
-        return OK;
     }
 
 private:
     const size_t REVERSESEQUENCE_DATA = 0;
     const size_t REVERSESEQUENCE_LENGTHS = 1;
 
+    template <typename T>
+    StatusCode reverse_sequence(const float *src_data, float *dst_data, const T *seq_lengths_data, ResponseDesc *resp) {
+        for (size_t i = 0; i < src_dims[batch_axis]; i++) {
+            if (static_cast<int32_t>(seq_lengths_data[i]) > static_cast<int>(src_dims[seq_axis])) {
+                if (resp) {
+                    std::string errorMsg = "Incorrect input 'seq_lengths' values!";
+                    errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+                }
+                return PARAMETER_MISMATCH;
+            }
+        }
+
+        // Every batch element is its first seq_length steps read backwards followed by the rest
+        // of the steps read as is, both parts are strided views of the source
+        std::vector<ptrdiff_t> strides(srcStrides.begin(), srcStrides.end());
+        std::vector<ptrdiff_t> reversed_strides = strides;
+        reversed_strides[seq_axis] = -strides[seq_axis];
+
+        SizeVector dims = src_dims;
+        dims[batch_axis] = 1;
+        const size_t seq_stride = srcStrides[seq_axis];
+        for (size_t b = 0; b < src_dims[batch_axis]; b++) {
+            const size_t seq_length = static_cast<size_t>((std::max)(static_cast<int32_t>(seq_lengths_data[b]), 0));
+            const float *src = src_data + b * srcStrides[batch_axis];
+            float *dst = dst_data + b * srcStrides[batch_axis];
+
+            if (seq_length > 0) {
+                dims[seq_axis] = seq_length;
+                cpu_strided_copy(src + (seq_length - 1) * seq_stride, dst, dims, reversed_strides, strides, sizeof(float));
+            }
+            if (seq_length < src_dims[seq_axis]) {
+                dims[seq_axis] = src_dims[seq_axis] - seq_length;
+                cpu_strided_copy(src + seq_length * seq_stride, dst + seq_length * seq_stride, dims, strides, strides,
+                                 sizeof(float));
+            }
+        }
+
+        return OK;
+    }
+
     int seq_axis;
     int batch_axis;
     SizeVector src_dims;
     SizeVector srcStrides;
-    size_t work_amount_dst;
 };
 
 REG_FACTORY_FOR(ReverseSequenceImpl, ReverseSequence);
@@ -139,49 +139,49 @@ public:
             prev_segment_id = cur_segment_id;
         }
 
-        // zero output buffer
-        std::memset(output_ptr, 0, output_dims[0] * num_elements_in_slice * sizeof(float));
-
-        // compute the result for each segment in parallel
-        parallel_for(num_segments, [&](size_t segment_id) {
-            float *segment_ptr = output_ptr + segment_id * num_elements_in_slice;
+        // Segments may have very different lengths and there may be fewer segments than threads,
+        // so the work is split into (segment, block of slice elements) pairs
+        const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+        size_t depth_blocks_num = 1;
+        if (num_segments < nthr && num_elements_in_slice >= 2 * min_depth_block)
+            depth_blocks_num = std::min((nthr + num_segments - 1) / num_segments, num_elements_in_slice / min_depth_block);
+        const size_t depth_block = (num_elements_in_slice + depth_blocks_num - 1) / depth_blocks_num;
+
+        parallel_for2d(num_segments, depth_blocks_num, [&](size_t segment_id, size_t block_id) {
+            const size_t depth_start = block_id * depth_block;
+            const size_t depth_end = std::min(depth_start + depth_block, num_elements_in_slice);
+            if (depth_start >= depth_end)
+                return;
+            float *segment_ptr = output_ptr + segment_id * num_elements_in_slice + depth_start;
+            const size_t depth = depth_end - depth_start;
             size_t start = segment_starts[segment_id];
             size_t end = (segment_id == (num_segments - 1)) ? num_indices : segment_starts[segment_id + 1];
 
             // scatter data and reduce for one segment
+            std::fill(segment_ptr, segment_ptr + depth, 0.f);
             for (size_t idx = start; idx < end; idx++) {
                 size_t indice = input_indices_ptr[idx];
-                std::transform(segment_ptr, segment_ptr + num_elements_in_slice,
-                    input_data_ptr + indice * num_elements_in_slice,
-                    segment_ptr, std::plus<float>());
+                const float *slice_ptr = input_data_ptr + indice * num_elements_in_slice + depth_start;
+                for (size_t i = 0; i < depth; i++)
+                    segment_ptr[i] += slice_ptr[i];
             }
-        });
 
-        if (reduction_op == ReducedOp::mean) {
-            parallel_for(num_segments, [&](size_t segment_id) {
-                float *segment_ptr = output_ptr + segment_id * num_elements_in_slice;
-                size_t start = segment_starts[segment_id];
-                size_t end = (segment_id == (num_segments - 1)) ? num_indices : segment_starts[segment_id + 1];
-                float num_adds = static_cast<float>(end - start);
-                if (num_adds > 0) {
-                    std::transform(segment_ptr, segment_ptr + num_elements_in_slice, segment_ptr,
-                        [num_adds](float elem) { return elem / num_adds; });
-                }
-            });
-        }
+            float divisor = 0.f;
+            if (reduction_op == ReducedOp::mean)
+                divisor = static_cast<float>(end - start);
+            else if (reduction_op == ReducedOp::sqrtn)
+                divisor = sqrtf(static_cast<float>(end - start));
+            if (divisor > 0.f) {
+                for (size_t i = 0; i < depth; i++)
+                    segment_ptr[i] /= divisor;
+            }
+        });
 
-        if (reduction_op == ReducedOp::sqrtn) {
-            parallel_for(num_segments, [&](size_t segment_id) {
-                float *segment_ptr = output_ptr + segment_id * num_elements_in_slice;
-                size_t start = segment_starts[segment_id];
-                size_t end = (segment_id == (num_segments - 1)) ? num_indices : segment_starts[segment_id + 1];
-                float sqrtn = sqrtf(static_cast<float>(end - start));
-                if (sqrtn > 0) {
-                    std::transform(segment_ptr, segment_ptr + num_elements_in_slice, segment_ptr,
-                        [sqrtn](float elem) { return elem / sqrtn; });
-                }
-            });
-        }
+        // segments which are not referenced by segment IDs stay zero
+        const size_t filled = num_segments * num_elements_in_slice;
+        const size_t total = output_dims[0] * num_elements_in_slice;
+        if (total > filled)
+            std::memset(output_ptr + filled, 0, (total - filled) * sizeof(float));
 
         return OK;
     }
@@ -192,6 +192,9 @@ private:
     const size_t INPUT_SEGMENT_IDS_PORT = 2;
     const size_t OUTPUT_PORT = 0;
 
+    // minimal number of slice elements processed by one task
+    const size_t min_depth_block = 64;
+
     SizeVector input_data_dims;
     SizeVector input_indices_dims;
     SizeVector input_segment_ids_dims;
@@ -9,8 +9,9 @@
 #include <vector>
 #include <cassert>
 #include <algorithm>
+#include <cstring>
 #include "ie_parallel.hpp"
-#include "common/cpu_memcpy.h"
+#include "common/cpu_strided_copy.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -168,9 +169,6 @@ public:
         InferenceEngine::SizeVector dst_dims = outputs[0]->getTensorDesc().getDims();
         InferenceEngine::SizeVector dstStrides = outputs[0]->getTensorDesc().getBlockingDesc().getStrides();
 
-        auto dst_size = outputs[0]->byteSize();
-        memset(dst_data, 0, dst_size);
-
         size_t i, j, k, bj, ej, sj;
         InferenceEngine::SizeVector our_dims;
         InferenceEngine::SizeVector out_dims;
@@ -231,13 +229,12 @@ public:
                 return PARAMETER_MISMATCH;
         }
 
-        if (static_cast<int>(src_dims.size()) == max_dims && shrink_axis == 0 &&
-                stride_dms[stride_dms.size()-1] == 1 && stride_dms.size() > 1)
-            strided_slice_vp(src_data, dst_data);
-        else if (static_cast<int>(src_dims.size()) == max_dims && shrink_axis == 0)
+        if (static_cast<int>(src_dims.size()) == max_dims && shrink_axis == 0) {
             strided_slice_p(src_data, dst_data);
-        else
+        } else {
+            memset(dst_data, 0, outputs[0]->byteSize());
             strided_slice(src_data, dst_data, our_dims);
+        }
 
         return OK;
     }
@@ -249,7 +246,6 @@ private:
     const size_t STRIDEDSLICE_STRIDE = 3;
 
     void strided_slice(const float *src_data, float* dst_data, std::vector<size_t> &dims);
-    void strided_slice_vp(const float *src_data, float* dst_data);
     void strided_slice_p(const float *src_data, float* dst_data);
 
     SizeVector begin_dims;
@@ -306,74 +302,18 @@ void StridedSliceImpl::strided_slice(const float *src_data, float* dst_data, std
     });
 }
 
-void StridedSliceImpl::strided_slice_vp(const float *src_data, float* dst_data) {
-    //  Vectorized copy
-    size_t dims_size_1 = dst_dims.size() - 1;
-    size_t dataLength = dst_dims[dims_size_1];
-    size_t work_amount_dst = dstStrides[0] * dst_dims[0] / dst_dims[dims_size_1];
-
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        SizeVector counters(dims_size_1, 0);
-        splitter(work_amount_dst, nthr, ithr, start, end);
-        size_t src_idx = begin_dms[dims_size_1];
-        for (int j = dims_size_1 - 1, i = start; j >= 0; j--) {
-            counters[j] = i % dst_dims[j];
-            src_idx += (begin_dms[j] + counters[j] * stride_dms[j]) * srcStrides[j];
-            i /= dst_dims[j];
-        }
-
-        for (size_t iwork = start, dst_idx = start * dataLength, i = 1; iwork < end; ++iwork, dst_idx += dataLength) {
-            cpu_memcpy(&dst_data[dst_idx], &src_data[src_idx], sizeof(float) * dataLength);
-            for (int j = dims_size_1 - 1; j >= 0; j--) {
-                counters[j]++;
-                if (counters[j] < dst_dims[j]) {
-                    src_idx += stride_dms[j] * srcStrides[j];
-                    break;
-                } else {
-                    counters[j] = i = 0;
-                }
-            }
-            if (!i) {
-                for (src_idx = begin_dms[dims_size_1]; i < dims_size_1; ++i)
-                    src_idx += (begin_dms[i] + counters[i] * stride_dms[i]) * srcStrides[i];
-            }
-        }
-    });
-}
-
 void StridedSliceImpl::strided_slice_p(const float *src_data, float* dst_data) {
+    // Without new and shrinked axes the slice is a strided view of the source
     size_t dims_size = dst_dims.size();
-    size_t work_amount_dst = dstStrides[0] * dst_dims[0];
-
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        size_t start = 0, end = 0;
-        SizeVector counters(dims_size, 0);
-        splitter(work_amount_dst, nthr, ithr, start, end);
-        int src_idx = 0;
-        for (int j = dims_size - 1, i = start; j >= 0; j--) {
-            counters[j] = i % dst_dims[j];
-            src_idx += (begin_dms[j] + counters[j] * stride_dms[j]) * srcStrides[j];
-            i /= dst_dims[j];
-        }
+    std::vector<ptrdiff_t> src_view_strides(dims_size), dst_view_strides(dims_size);
+    ptrdiff_t src_idx = 0;
+    for (size_t i = 0; i < dims_size; i++) {
+        src_idx += begin_dms[i] * static_cast<ptrdiff_t>(srcStrides[i]);
+        src_view_strides[i] = stride_dms[i] * static_cast<ptrdiff_t>(srcStrides[i]);
+        dst_view_strides[i] = static_cast<ptrdiff_t>(dstStrides[i]);
+    }
 
-        for (size_t iwork = start, dst_idx = start, i = 1; iwork < end; ++iwork, dst_idx++) {
-            dst_data[dst_idx] = src_data[src_idx];
-            for (int j = dims_size - 1; j >= 0; j--) {
-                counters[j]++;
-                if (counters[j] < dst_dims[j]) {
-                    src_idx += stride_dms[j] * srcStrides[j];
-                    break;
-                } else {
-                    counters[j] = i = 0;
-                }
-            }
-            if (!i) {
-                for (src_idx = 0; i < dims_size; ++i)
-                    src_idx += (begin_dms[i] + counters[i] * stride_dms[i]) * srcStrides[i];
-            }
-        }
-    });
+    cpu_strided_copy(src_data + src_idx, dst_data, dst_dims, src_view_strides, dst_view_strides, sizeof(float));
 }
 
 REG_FACTORY_FOR(StridedSliceImpl, StridedSlice);
@@ -11,6 +11,8 @@
 #include <vector>
 #include <cassert>
 #include <functional>
+#include <algorithm>
+#include <utility>
 #include "ie_parallel.hpp"
 #if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
@@ -457,6 +459,112 @@ public:
         });
     }
 
+    // Inserts the element to the sorted array of the best values, equal values keep the order of indexes
+    template <template <typename> class Compare>
+    inline void insert_sorted(float* values, int* indexes, int& filled, float value, int index) {
+        int i = filled < src_k ? filled++ : src_k;
+        values[i] = value;
+        indexes[i] = index;
+        for (; i > 0 && Compare<float>()(values[i], values[i - 1]); i--) {
+            std::swap(values[i], values[i - 1]);
+            std::swap(indexes[i], indexes[i - 1]);
+        }
+    }
+
+    // Selects the best src_k elements of [begin, end) range sorted by values. Blocks of elements which are not better
+    // than the current k-th value are skipped with one vector comparison, so most of the long axis is only loaded
+    template <class Compare1, template <typename> class Compare2>
+    int topk_range(const float* src_data, int begin, int end, float* values, int* indexes) {
+        int filled = 0;
+        int i = begin;
+        for (; i < end && filled < src_k; i++)
+            insert_sorted<Compare2>(values, indexes, filled, src_data[i], i);
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        vec_type_f vthreshold = _mm_uni_set1_ps(values[src_k - 1]);
+        for (; i + block_size <= end; i += block_size) {
+            vmask_type vmask = Compare1::cmp_ps(_mm_uni_loadu_ps(src_data + i), vthreshold);
+#if defined(HAVE_AVX512F)
+            if (!vmask)
+                continue;
+#else
+            if (!_mm_uni_movemask_ps(vmask))
+                continue;
+#endif
+            for (int j = i; j < i + block_size; j++) {
+                if (Compare2<float>()(src_data[j], values[src_k - 1]))
+                    insert_sorted<Compare2>(values, indexes, filled, src_data[j], j);
+            }
+            vthreshold = _mm_uni_set1_ps(values[src_k - 1]);
+        }
+#endif
+        for (; i < end; i++) {
+            if (Compare2<float>()(src_data[i], values[src_k - 1]))
+                insert_sorted<Compare2>(values, indexes, filled, src_data[i], i);
+        }
+        return filled;
+    }
+
+    // TopK over a long last axis: the axis is split into chunks selected in parallel (it also keeps all threads busy
+    // when there are less rows than threads), then the best candidates of the chunks are merged in the order of
+    // indexes what gives the same result as the sequential pass
+    template <class Compare1, template <typename> class Compare2>
+    void topk_long_axis(const float* src_data, float* dst_data, int* dst_idx) {
+        const int nthr = parallel_get_max_threads();
+        const int max_chunks = std::max(1, dim / std::max(long_axis_chunk, 4 * src_k));
+        const int chunks = std::min(max_chunks, std::max(1, (nthr + before_num - 1) / before_num));
+        const int chunk_len = (dim + chunks - 1) / chunks;
+
+        std::vector<float> chunk_values(before_num * chunks * (src_k + 1));
+        std::vector<int> chunk_indexes(before_num * chunks * (src_k + 1));
+        std::vector<int> chunk_filled(before_num * chunks);
+        parallel_for2d(before_num, chunks, [&](int i0, int c) {
+            const int chunk = i0 * chunks + c;
+            chunk_filled[chunk] = topk_range<Compare1, Compare2>(src_data + i0 * dim, c * chunk_len, std::min(dim, (c + 1) * chunk_len),
+                                                                 &chunk_values[chunk * (src_k + 1)], &chunk_indexes[chunk * (src_k + 1)]);
+        });
+
+        parallel_for(before_num, [&](int i0) {
+            std::vector<float> max_values(src_k + 1);
+            std::vector<int> max_indexes(src_k + 1);
+            std::vector<std::pair<int, float>> candidates;
+            candidates.reserve(chunks * src_k);
+            for (int c = 0; c < chunks; c++) {
+                const int chunk = i0 * chunks + c;
+                for (int i = 0; i < chunk_filled[chunk]; i++)
+                    candidates.emplace_back(chunk_indexes[chunk * (src_k + 1) + i], chunk_values[chunk * (src_k + 1) + i]);
+            }
+            std::sort(candidates.begin(), candidates.end(),
+                      [](const std::pair<int, float>& a, const std::pair<int, float>& b) { return a.first < b.first; });
+            int filled = 0;
+            for (auto&& candidate : candidates)
+                insert_sorted<Compare2>(max_values.data(), max_indexes.data(), filled, candidate.second, candidate.first);
+
+            if (!sort_value) {
+                std::vector<int> order(src_k);
+                for (int i = 0; i < src_k; i++)
+                    order[i] = i;
+                std::sort(order.begin(), order.end(), [&](int a, int b) { return max_indexes[a] < max_indexes[b]; });
+                if (dst_data) {
+                    for (int i = 0; i < src_k; i++)
+                        dst_data[i0 * src_k + i] = max_values[order[i]];
+                }
+                if (dst_idx) {
+                    for (int i = 0; i < src_k; i++)
+                        dst_idx[i0 * src_k + i] = max_indexes[order[i]];
+                }
+            } else {
+                if (dst_data) {
+                    for (int i = 0; i < src_k; i++)
+                        dst_data[i0 * src_k + i] = max_values[i];
+                }
+                if (dst_idx) {
+                    for (int i = 0; i < src_k; i++)
+                        dst_idx[i0 * src_k + i] = max_indexes[i];
+                }
+            }
+        });
+    }
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         const float *src = inputs[TOPK_DATA]->cbuffer().as<float *>() +
             inputs[TOPK_DATA]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -511,7 +619,12 @@ public:
 
         SizeVector in_dims = inputs[TOPK_DATA]->getTensorDesc().getDims();
 
-        if (src_k == 1) {
+        if (is_last_dim && dim >= long_axis_chunk) {
+            if (mode_max)
+                topk_long_axis<cmpgt_ps, std::greater>(src, dst_data, dst_idx);
+            else
+                topk_long_axis<cmplt_ps, std::less>(src, dst_data, dst_idx);
+        } else if (src_k == 1) {
             if (is_last_dim) {
                 if (mode_max)
                     top1<std::greater>(src, dst_data, dst_idx, in_dims);
@@ -558,6 +671,8 @@ private:
     bool mode_max = true;
 
     int dim, before_num;
+    // the minimal length of the last axis chunk processed by a thread
+    const int long_axis_chunk = 4096;
 
 #if defined(HAVE_AVX512F)
     const int count_vec = 32;
@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count.h"
+
+#include <thread>
+
+namespace MKLDNNPlugin {
+
+double perfTicksPerMicrosecond() {
+#ifdef MKLDNN_PERF_COUNT_TSC
+    // the counter runs at a constant rate on the CPUs with invariant TSC, so it is measured once against the clock
+    static const double ticksPerMicrosecond = [] {
+        auto clockStart = std::chrono::steady_clock::now();
+        auto ticksStart = perfTicks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        auto ticks = perfTicks() - ticksStart;
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - clockStart;
+        return ticks / elapsed.count();
+    }();
+    return ticksPerMicrosecond;
+#else
+    return static_cast<double>(std::chrono::steady_clock::period::den) /
+           std::chrono::steady_clock::period::num / 1000000.;
+#endif
+}
+
+}  // namespace MKLDNNPlugin
@@ -5,45 +5,106 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+# include <intrin.h>
+# define MKLDNN_PERF_COUNT_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+# define MKLDNN_PERF_COUNT_TSC
+#endif
+
+#include "hw_perf_count.h"
 
 namespace MKLDNNPlugin {
 
+/**
+ * @brief Reads the time stamp counter on x86, which is much cheaper than the system clocks,
+ * other architectures read the steady clock
+ */
+inline uint64_t perfTicks() {
+#ifdef MKLDNN_PERF_COUNT_TSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ * @brief Returns the number of perfTicks() in a microsecond, the time stamp counter is calibrated on the first call
+ */
+double perfTicksPerMicrosecond();
+
 class PerfCount {
-    uint64_t duration;
+    uint64_t duration;  // in perfTicks()
     uint32_t num;
 
-    std::chrono::high_resolution_clock::time_point __start = {};
-    std::chrono::high_resolution_clock::time_point __finish = {};
+    uint64_t __start = 0;
+
+    HwPerfValues hwTotal;
+    HwPerfValues __hwStart;
+    uint32_t hwNum = 0;
 
 public:
     PerfCount(): duration(0), num(0) {}
 
-    uint64_t avg() { return (num == 0) ? 0 : duration / num; }
+    // ticks are converted to microseconds only when the counters are read
+    uint64_t avg() { return (num == 0) ? 0 : static_cast<uint64_t>(duration / num / perfTicksPerMicrosecond()); }
+
+    HwPerfValues hwAvg() {
+        HwPerfValues res;
+        if (hwNum != 0) {
+            res.cycles = hwTotal.cycles / hwNum;
+            res.instructions = hwTotal.instructions / hwNum;
+            res.llcMisses = hwTotal.llcMisses / hwNum;
+        }
+        return res;
+    }
 
 private:
     void start_itr() {
-        __start = std::chrono::high_resolution_clock::now();
+        __start = perfTicks();
     }
 
     void finish_itr() {
-        __finish = std::chrono::high_resolution_clock::now();
-
-        duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
+        duration += perfTicks() - __start;
         num++;
     }
 
+    void start_hw_itr(HwPerfCounters &hw) {
+        __hwStart = hw.sample();
+    }
+
+    void finish_hw_itr(HwPerfCounters &hw) {
+        auto hwFinish = hw.sample();
+        hwTotal.cycles += hwFinish.cycles - __hwStart.cycles;
+        hwTotal.instructions += hwFinish.instructions - __hwStart.instructions;
+        hwTotal.llcMisses += hwFinish.llcMisses - __hwStart.llcMisses;
+        hwNum++;
+    }
+
     friend class PerfHelper;
 };
 
 class PerfHelper {
-    PerfCount &counter;
+    PerfCount *counter;
+    HwPerfCounters *hwCounters;
 
 public:
-    explicit PerfHelper(PerfCount &count): counter(count) { counter.start_itr(); }
+    PerfHelper(PerfCount &count, HwPerfCounters *hw, bool enabled): counter(enabled ? &count : nullptr), hwCounters(hw) {
+        if (!counter) return;
+        if (hwCounters) counter->start_hw_itr(*hwCounters);
+        counter->start_itr();
+    }
 
-    ~PerfHelper() { counter.finish_itr(); }
+    ~PerfHelper() {
+        if (!counter) return;
+        counter->finish_itr();
+        if (hwCounters) counter->finish_hw_itr(*hwCounters);
+    }
 };
 
 }  // namespace MKLDNNPlugin
 
-#define PERF(_counter) PerfHelper __helper##__counter (_counter->PerfCounter());
+#define PERF(_counter, _hw, _enabled) PerfHelper __helper##__counter (_counter->PerfCounter(), _hw, _enabled);
@@ -0,0 +1,208 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "quantized_tensors.h"
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <legacy/ie_layers.h>
+#include <legacy/details/ie_cnn_network_tools.h>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+struct QuantizationGrid {
+    size_t levels;
+    float low;
+    float high;
+};
+
+struct QuantizedChain {
+    std::vector<CNNLayerPtr> producers;
+    std::vector<CNNLayerPtr> layers;
+    std::map<std::string, CNNLayerPtr> consumers;
+};
+
+// Returns the Const layer of the port if nothing else reads it, so its values can be replaced
+CNNLayerPtr getExclusiveConst(const CNNLayerPtr& layer, size_t port) {
+    auto data = layer->insData[port].lock();
+    if (!data || getInputTo(data).size() != 1)
+        return nullptr;
+    for (size_t i = 0; i < layer->insData.size(); i++) {
+        if (i != port && layer->insData[i].lock() == data)
+            return nullptr;
+    }
+
+    auto constLayer = getCreatorLayer(data).lock();
+    if (!constLayer || constLayer->type != "Const")
+        return nullptr;
+    auto blob = constLayer->blobs.find("custom");
+    if (blob == constLayer->blobs.end() || dynamic_cast<TBlob<float>*>(blob->second.get()) == nullptr)
+        return nullptr;
+    return constLayer;
+}
+
+std::vector<float> getConstValues(const CNNLayerPtr& constLayer) {
+    const auto& blob = constLayer->blobs["custom"];
+    const float* values = blob->cbuffer().as<const float*>();
+    return std::vector<float>(values, values + blob->size());
+}
+
+void setConstValues(const CNNLayerPtr& constLayer, const std::vector<float>& values) {
+    // the blob may be shared with the original network, so it is replaced instead of being changed
+    auto blob = make_shared_blob<float>(constLayer->blobs["custom"]->getTensorDesc());
+    blob->allocate();
+    std::copy(values.begin(), values.end(), blob->buffer().as<float*>());
+    constLayer->blobs["custom"] = blob;
+}
+
+bool isQuantize(const CNNLayerPtr& layer) {
+    auto quantize = dynamic_cast<QuantizeLayer*>(layer.get());
+    // two levels are reserved for binarization, which has its own kernels
+    return quantize != nullptr && quantize->levels > 2 &&
+           quantize->insData.size() == 5 && quantize->outData.size() == 1;
+}
+
+bool isChainLayer(const CNNLayerPtr& layer) {
+    if (layer->outData.size() != 1)
+        return false;
+    if (layer->type == "Concat")
+        return true;
+    if (auto pooling = dynamic_cast<PoolingLayer*>(layer.get()))
+        return pooling->_type == PoolingLayer::MAX;
+    return false;
+}
+
+// Checks that the layer produces FP32 values of a per tensor grid with U8 indices and its range can be replaced
+bool getOutputGrid(const CNNLayerPtr& layer, QuantizationGrid& grid) {
+    if (!isQuantize(layer) || layer->outData[0]->getPrecision() != Precision::FP32)
+        return false;
+    auto levels = static_cast<size_t>(dynamic_cast<QuantizeLayer*>(layer.get())->levels);
+    if (levels > 256)
+        return false;
+
+    auto lowConst = getExclusiveConst(layer, 3);
+    auto highConst = getExclusiveConst(layer, 4);
+    if (!lowConst || !highConst)
+        return false;
+    auto low = getConstValues(lowConst);
+    auto high = getConstValues(highConst);
+    if (low.empty() || high.empty())
+        return false;
+    auto isPerTensor = [](const std::vector<float>& values) {
+        return std::all_of(values.begin(), values.end(), [&](float value) { return value == values[0]; });
+    };
+    if (!isPerTensor(low) || !isPerTensor(high) || !(high[0] > low[0]))
+        return false;
+
+    grid = {levels, low[0], high[0]};
+    return true;
+}
+
+bool isFoldableConsumer(const CNNLayerPtr& layer, const DataPtr& data) {
+    return isQuantize(layer) && layer->insData[0].lock() == data &&
+           getExclusiveConst(layer, 1) != nullptr && getExclusiveConst(layer, 2) != nullptr;
+}
+
+bool collectChain(const CNNLayerPtr& producer, const QuantizationGrid& grid, const OutputsDataMap& outputs,
+                  std::unordered_set<CNNLayer*>& visited, QuantizedChain& chain) {
+    bool isValid = true;
+    std::deque<CNNLayerPtr> toVisit = {producer};
+    visited.insert(producer.get());
+    auto enqueue = [&](const CNNLayerPtr& layer) {
+        if (visited.insert(layer.get()).second)
+            toVisit.push_back(layer);
+    };
+
+    // the whole chain is visited even if it is not valid, so its other producers are not checked again
+    while (!toVisit.empty()) {
+        auto layer = toVisit.front();
+        toVisit.pop_front();
+
+        QuantizationGrid layerGrid;
+        if (getOutputGrid(layer, layerGrid)) {
+            isValid &= layerGrid.levels == grid.levels && layerGrid.low == grid.low && layerGrid.high == grid.high;
+            chain.producers.push_back(layer);
+        } else if (isChainLayer(layer)) {
+            for (const auto& input : layer->insData) {
+                auto creator = getCreatorLayer(input.lock()).lock();
+                if (creator)
+                    enqueue(creator);
+                else
+                    isValid = false;
+            }
+            chain.layers.push_back(layer);
+        } else {
+            isValid = false;
+            continue;
+        }
+
+        const auto& output = layer->outData[0];
+        isValid &= outputs.find(output->getName()) == outputs.end() && !getInputTo(output).empty();
+        for (const auto& consumer : getInputTo(output)) {
+            if (isChainLayer(consumer.second))
+                enqueue(consumer.second);
+            else if (isFoldableConsumer(consumer.second, output))
+                chain.consumers[consumer.first] = consumer.second;
+            else
+                isValid = false;
+        }
+    }
+    return isValid;
+}
+
+void convertChainToU8(const QuantizedChain& chain, const QuantizationGrid& grid) {
+    const float step = (grid.high - grid.low) / (grid.levels - 1);
+
+    for (const auto& producer : chain.producers) {
+        auto lowConst = getExclusiveConst(producer, 3);
+        auto highConst = getExclusiveConst(producer, 4);
+        const auto maxIndex = static_cast<float>(grid.levels - 1);
+        setConstValues(lowConst, std::vector<float>(lowConst->blobs["custom"]->size(), 0.f));
+        setConstValues(highConst, std::vector<float>(highConst->blobs["custom"]->size(), maxIndex));
+        producer->outData[0]->setPrecision(Precision::U8);
+    }
+
+    for (const auto& layer : chain.layers)
+        layer->outData[0]->setPrecision(Precision::U8);
+
+    // the consumers get low + q * step as before, so their input ranges are moved to the grid indices
+    for (const auto& consumer : chain.consumers) {
+        for (size_t port = 1; port <= 2; port++) {
+            auto rangeConst = getExclusiveConst(consumer.second, port);
+            auto values = getConstValues(rangeConst);
+            for (auto& value : values)
+                value = (value - grid.low) / step;
+            setConstValues(rangeConst, values);
+        }
+    }
+}
+
+}  // namespace
+
+void KeepQuantizedTensorsInU8(details::CNNNetworkImpl& network) {
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+
+    std::unordered_set<CNNLayer*> visited;
+    for (const auto& layer : details::CNNNetSortTopologically(network)) {
+        QuantizationGrid grid;
+        if (visited.count(layer.get()) || !getOutputGrid(layer, grid))
+            continue;
+
+        QuantizedChain chain;
+        if (collectChain(layer, grid, outputs, visited, chain) && !chain.layers.empty())
+            convertChainToU8(chain, grid);
+    }
+}
+
+}  // namespace MKLDNNPlugin
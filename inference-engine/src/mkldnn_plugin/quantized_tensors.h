@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <legacy/cnn_network_impl.hpp>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Keeps tensors between FakeQuantize layers in U8 when they pass only through layers which commute
+ * with a per tensor dequantization: Concat and max Pooling.
+ *
+ * Such FakeQuantize layers produce FP32 values of a uniform grid low + q * (high - low) / (levels - 1),
+ * which are only reordered or compared until the next FakeQuantize layers. The producers are changed to
+ * output the grid index q in U8, the layers in between work with U8 data, and the dequantization is folded
+ * into the input ranges of the consuming FakeQuantize layers, so no FP32 round trip is left in the chain.
+ *
+ * A chain is changed only if all its producers have the same grid, all the tensors are consumed
+ * only by the chain layers and FakeQuantize layers, and none of the tensors is a network output.
+ * Constants of the changed ranges are replaced by new blobs, so the blobs shared with other networks are intact
+ */
+void KeepQuantizedTensorsInU8(InferenceEngine::details::CNNNetworkImpl& network);
+
+}  // namespace MKLDNNPlugin
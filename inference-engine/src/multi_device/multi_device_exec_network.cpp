@@ -3,10 +3,12 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <atomic>
 #include <mutex>
 #include <queue>
 #include <string>
+#include <thread>
 #include <vector>
 #include <memory>
 #include <utility>
@@ -28,6 +30,24 @@ namespace MultiDevicePlugin {
 
 thread_local MultiDeviceExecutableNetwork::WorkerInferRequest* MultiDeviceExecutableNetwork::_thisWorkerInferRequest = nullptr;
 
+SchedulingPolicy ParseSchedulingPolicy(const std::string& value) {
+    if (value == MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY) {
+        return SchedulingPolicy::DevicePriority;
+    } else if (value == MultiDeviceConfigParams::MULTI_ROUND_ROBIN) {
+        return SchedulingPolicy::RoundRobin;
+    } else if (value == MultiDeviceConfigParams::MULTI_SHORTEST_EXPECTED_COMPLETION) {
+        return SchedulingPolicy::ShortestExpectedCompletion;
+    } else if (value == MultiDeviceConfigParams::MULTI_WEIGHTED_THROUGHPUT) {
+        return SchedulingPolicy::WeightedThroughput;
+    } else {
+        THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY
+                           << ". Expected only " << MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY << "/"
+                           << MultiDeviceConfigParams::MULTI_ROUND_ROBIN << "/"
+                           << MultiDeviceConfigParams::MULTI_SHORTEST_EXPECTED_COMPLETION << "/"
+                           << MultiDeviceConfigParams::MULTI_WEIGHTED_THROUGHPUT;
+    }
+}
+
 struct IdleGuard {
     explicit IdleGuard(MultiDeviceExecutableNetwork::WorkerInferRequest* workerInferRequestPtr,
                        MultiDeviceExecutableNetwork::NotBusyWorkerRequests& notBusyWorkerRequests) :
@@ -53,66 +73,215 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
                                                            const bool                                                           needPerfCounters) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
-    _devicePriorities{networkDevices},
+    _devicePriorities{std::make_shared<const std::vector<DeviceInformation>>(networkDevices)},
     _networksPerDevice{networksPerDevice},
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itPolicy != _config.end()) {
+        _schedulingPolicy = ParseSchedulingPolicy(itPolicy->second.as<std::string>());
+    }
+    for (auto&& networkValue : _networksPerDevice) {
+        _deviceStatistics[networkValue.first];
+    }
     for (auto&& networkValue : _networksPerDevice) {
-        auto& device  = networkValue.first;
-        auto& network = networkValue.second;
-
-        auto itNumRequests = std::find_if(_devicePriorities.cbegin(), _devicePriorities.cend(),
-                [&device](const DeviceInformation& d){ return d.deviceName == device;});
-        unsigned int optimalNum = 0;
-        try {
-            optimalNum = network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
-        } catch (const details::InferenceEngineException &iie) {
-            THROW_IE_EXCEPTION
-                    << "Every device used with the Multi-Device should "
-                    << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
-                    << "Failed to query the metric for the " << device << " with error:" << iie.what();
+        CreateWorkerRequests(networkValue.first, networkValue.second, networkDevices);
+    }
+}
+
+void MultiDeviceExecutableNetwork::CreateWorkerRequests(const DeviceName&                       device,
+                                                        InferenceEngine::ExecutableNetwork&     network,
+                                                        const std::vector<DeviceInformation>&   networkDevices) {
+    auto itNumRequests = std::find_if(networkDevices.cbegin(), networkDevices.cend(),
+            [&device](const DeviceInformation& d){ return d.deviceName == device;});
+    unsigned int optimalNum = 0;
+    try {
+        optimalNum = network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    } catch (const details::InferenceEngineException &iie) {
+        THROW_IE_EXCEPTION
+                << "Every device used with the Multi-Device should "
+                << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                << "Failed to query the metric for the " << device << " with error:" << iie.what();
+    }
+    const auto numRequests = (networkDevices.end() == itNumRequests ||
+        itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
+    auto& workerRequests = _workerRequests[device];
+    auto& idleWorkerRequests = _idleWorkerRequests[device];
+    workerRequests.resize(numRequests);
+    auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
+    for (auto&& workerRequest : workerRequests) {
+        workerRequest._inferRequest = network.CreateInferRequest();
+        auto* workerRequestPtr = &workerRequest;
+        idleWorkerRequests.push(workerRequestPtr);
+        workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
+                workerRequestPtr->_status = status;
+                UpdateDeviceStatistics(device, *workerRequestPtr);
+                {
+                    auto capturedTask = std::move(workerRequestPtr->_task);
+                    capturedTask();
+                }
+                if (!_terminate) {
+                    idleGuard.Release()->push(workerRequestPtr);
+                    ScheduleToWorkerInferRequest();
+                }
+            });
+    }
+}
+
+void MultiDeviceExecutableNetwork::LoadDevicesInBackground(const std::vector<DeviceInformation>&  devices,
+                                                           const std::vector<DeviceInformation>&  priorities,
+                                                           const bool                             releaseStandInDevices,
+                                                           BackgroundLoad                         loadNetwork) {
+    std::vector<DeviceName> standInDevices;
+    for (auto&& networkValue : _networksPerDevice) {
+        standInDevices.push_back(networkValue.first);
+    }
+    // the maps are read by the dispatching without locking, so the device entries are created before serving starts
+    for (auto&& device : devices) {
+        _deviceStatistics[device.deviceName];
+        _workerRequests[device.deviceName];
+        _idleWorkerRequests[device.deviceName];
+    }
+    auto numLoading = std::make_shared<std::atomic<std::size_t>>(devices.size());
+    for (auto&& device : devices) {
+        _pendingDeviceLoads.emplace_back(std::async(std::launch::async,
+            [this, device, priorities, releaseStandInDevices, loadNetwork, standInDevices, numLoading] {
+            bool loaded = false;
+            try {
+                auto network = loadNetwork(device);
+                if (!_terminate) {
+                    CreateWorkerRequests(device.deviceName, network, {device});
+                    std::lock_guard<std::mutex> lock{_mutex};
+                    _networksPerDevice.insert({device.deviceName, network});
+                    loaded = true;
+                }
+            } catch (...) {
+                // the network is not supported by the device, so the devices loaded before keep serving
+            }
+            if (loaded) {
+                UpdateDevicePriorities(priorities, {});
+                // the requests queued while all the worker requests were busy are dispatched to the new device right away
+                ScheduleToWorkerInferRequest();
+            }
+            if (0 == --(*numLoading) && releaseStandInDevices && !_terminate) {
+                ReleaseStandInDevices(priorities, standInDevices);
+            }
+        }));
+    }
+}
+
+bool MultiDeviceExecutableNetwork::UpdateDevicePriorities(const std::vector<DeviceInformation>&  priorities,
+                                                          const std::vector<DeviceName>&         excludedDevices) {
+    std::lock_guard<std::mutex> lock{_mutex};
+    std::vector<DeviceInformation> devicePriorities;
+    std::string devicePrioritiesConfig;
+    for (auto&& device : priorities) {
+        if (_networksPerDevice.find(device.deviceName) != _networksPerDevice.end() &&
+            std::find(excludedDevices.begin(), excludedDevices.end(), device.deviceName) == excludedDevices.end()) {
+            devicePriorities.push_back(device);
+            devicePrioritiesConfig += (devicePrioritiesConfig.empty() ? "" : ",") + device.deviceName;
+        }
+    }
+    if (devicePriorities.empty()) {
+        return false;
+    }
+    _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = devicePrioritiesConfig;
+    std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>(devicePriorities));
+    return true;
+}
+
+void MultiDeviceExecutableNetwork::ReleaseStandInDevices(const std::vector<DeviceInformation>&  priorities,
+                                                         const std::vector<DeviceName>&         standInDevices) {
+    // the stand-in devices serve until the end if none of the devices loaded in background is ready
+    if (!UpdateDevicePriorities(priorities, standInDevices)) {
+        return;
+    }
+    for (auto&& device : standInDevices) {
+        auto& workerRequests = _workerRequests.at(device);
+        auto& idleWorkerRequests = _idleWorkerRequests.at(device);
+        // a request is held once it is idle, so the dispatching which still sees the old priorities does not take it,
+        // the requests in flight are held when they complete
+        std::vector<WorkerInferRequest*> heldWorkerRequests;
+        while (heldWorkerRequests.size() < workerRequests.size()) {
+            if (_terminate) {
+                return;
+            }
+            WorkerInferRequest* workerRequestPtr = nullptr;
+            if (idleWorkerRequests.try_pop(workerRequestPtr)) {
+                heldWorkerRequests.push_back(workerRequestPtr);
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
         }
-        const auto numRequests = (_devicePriorities.end() == itNumRequests ||
-            itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
-        auto& workerRequests = _workerRequests[device];
-        auto& idleWorkerRequests = _idleWorkerRequests[device];
-        workerRequests.resize(numRequests);
-        auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
-        for (auto&& workerRequest : workerRequests) {
-            workerRequest._inferRequest = network.CreateInferRequest();
-            auto* workerRequestPtr = &workerRequest;
-            idleWorkerRequests.push(workerRequestPtr);
-            workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
-                    IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
-                    workerRequestPtr->_status = status;
-                    {
-                        auto capturedTask = std::move(workerRequestPtr->_task);
-                        capturedTask();
-                    }
-                    if (!_terminate) {
-                        idleGuard.Release()->push(workerRequestPtr);
-                        ScheduleToWorkerInferRequest();
-                    }
-                });
+        for (auto&& workerRequestPtr : heldWorkerRequests) {
+            workerRequestPtr->_inferRequest = {};
         }
+        std::lock_guard<std::mutex> lock{_mutex};
+        _networksPerDevice.erase(device);
+    }
+}
+
+void MultiDeviceExecutableNetwork::UpdateDeviceStatistics(const DeviceName& device, const WorkerInferRequest& workerRequest) {
+    // weight of the last request in the running average, so that the latency follows changes of a device load
+    constexpr double latencySmoothingFactor = 0.2;
+    std::chrono::duration<double, std::milli> latency = std::chrono::steady_clock::now() - workerRequest._startTime;
+    auto& statistics = _deviceStatistics.at(device);
+    statistics._inFlight--;
+    auto averageLatency = statistics._averageLatency.load();
+    while (!statistics._averageLatency.compare_exchange_weak(averageLatency, (averageLatency == 0.) ? latency.count()
+        : (1. - latencySmoothingFactor) * averageLatency + latencySmoothingFactor * latency.count())) {}
+}
+
+void MultiDeviceExecutableNetwork::OrderDevices(std::vector<const DeviceInformation*>& devices, SchedulingPolicy policy) {
+    if (devices.empty() || SchedulingPolicy::DevicePriority == policy) {
+        return;
+    }
+    if (SchedulingPolicy::RoundRobin == policy) {
+        std::rotate(devices.begin(), devices.begin() + (_roundRobinCounter++ % devices.size()), devices.end());
+        return;
+    }
+    // Devices without completed requests have zero latency, so each of them is tried first
+    std::vector<std::pair<double, const DeviceInformation*>> costs;
+    for (auto&& device : devices) {
+        auto& statistics = _deviceStatistics.at(device->deviceName);
+        auto numRequests = std::max<std::size_t>(_workerRequests.at(device->deviceName).size(), 1);
+        // the expected completion time of a new request, or a number of dispatched requests divided by throughput
+        auto requests = (SchedulingPolicy::ShortestExpectedCompletion == policy)
+                      ? statistics._inFlight + 1 : statistics._dispatched + 1;
+        costs.emplace_back(statistics._averageLatency * requests / numRequests, device);
+    }
+    std::stable_sort(costs.begin(), costs.end(), [] (const std::pair<double, const DeviceInformation*>& lhs,
+                                                     const std::pair<double, const DeviceInformation*>& rhs) {
+        return lhs.first < rhs.first;
+    });
+    for (std::size_t i = 0; i < costs.size(); ++i) {
+        devices[i] = costs[i].second;
     }
 }
 
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
+    auto devicePriorities = std::atomic_load(&_devicePriorities);
+    std::vector<const DeviceInformation*> devices;
+    devices.reserve(devicePriorities->size());
+    for (auto&& device : *devicePriorities) {
+        devices.push_back(&device);
+    }
+    OrderDevices(devices, _schedulingPolicy);
     for (auto&& device : devices) {
-        auto& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
+        auto& idleWorkerRequests = _idleWorkerRequests[device->deviceName];
         WorkerInferRequest* workerRequestPtr = nullptr;
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             Task inferPipelineTask;
             if (_inferPipelineTasks.try_pop(inferPipelineTask)) {
                 _thisWorkerInferRequest = workerRequestPtr;
+                auto& statistics = _deviceStatistics.at(device->deviceName);
+                ++statistics._dispatched;
+                ++statistics._inFlight;
+                workerRequestPtr->_startTime = std::chrono::steady_clock::now();
                 inferPipelineTask();
                 idleGuard.Release();
                 break;
@@ -129,11 +298,11 @@ void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
 }
 
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
-    {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _devicePriorities.clear();
-    }
     _terminate = true;
+    for (auto&& pendingDeviceLoad : _pendingDeviceLoads) {
+        pendingDeviceLoad.wait();
+    }
+    std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>());
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` Context are those that are used by Worker infer requests.
      *       But AsyncInferRequest destructor should waits for all asynchronous tasks that are used by the request
      */
@@ -160,10 +329,20 @@ IInferRequest::Ptr MultiDeviceExecutableNetwork::CreateInferRequest() {
 
 void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
     auto priorities = config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
-    if (priorities == config.end() || config.size() > 1) {
+    auto policy = config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (config.empty() ||
+        config.size() > static_cast<std::size_t>((priorities != config.end()) + (policy != config.end()))) {
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str <<
-            "The only config supported for the Network's SetConfig is MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES";
-    } else {
+            "The only configs supported for the Network's SetConfig are MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES"
+            " and MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY";
+    }
+    if (policy != config.end()) {
+        auto schedulingPolicy = ParseSchedulingPolicy(policy->second.as<std::string>());
+        std::lock_guard<std::mutex> lock{_mutex};
+        _schedulingPolicy = schedulingPolicy;
+        _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = policy->second;
+    }
+    if (priorities != config.end()) {
         auto multiPlugin = std::dynamic_pointer_cast<MultiDeviceInferencePlugin>(this->_plugin);
         assert(multiPlugin != nullptr);
         auto metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
@@ -185,7 +364,7 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
                             " device was not in the original device list!";
                 }
             }
-            _devicePriorities = metaDevices;
+            std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>(metaDevices));
 
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
@@ -194,6 +373,7 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
 }
 
 InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetConfig(const std::string &name) const {
+    std::lock_guard<std::mutex> lock{_mutex};
     auto it = _config.find(name);
     if (it != _config.end()) {
         return it->second;
@@ -204,6 +384,7 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetConfig(const std::st
 
 InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::string &name) const {
     if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        std::lock_guard<std::mutex> lock{_mutex};
         unsigned int res = 0u;
         for (auto n : _networksPerDevice) {
             try {
@@ -217,19 +398,35 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
         }
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res);
     } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        std::lock_guard<std::mutex> lock{_mutex};
         auto it = _networksPerDevice.begin();
         IE_ASSERT(it != _networksPerDevice.end());
         IE_SET_METRIC_RETURN(NETWORK_NAME, it->second.GetMetric(
             METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(MULTI_DEVICE_DISPATCHED_REQUESTS)) {
+        std::map<std::string, unsigned int> dispatched;
+        for (auto&& statistics : _deviceStatistics) {
+            dispatched[statistics.first] = statistics.second._dispatched;
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_DISPATCHED_REQUESTS, dispatched);
+    } else if (name == METRIC_KEY(MULTI_DEVICE_AVERAGE_LATENCIES)) {
+        std::map<std::string, float> latencies;
+        for (auto&& statistics : _deviceStatistics) {
+            latencies[statistics.first] = static_cast<float>(statistics.second._averageLatency);
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_AVERAGE_LATENCIES, latencies);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DEVICE_DISPATCHED_REQUESTS),
+            METRIC_KEY(MULTI_DEVICE_AVERAGE_LATENCIES)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
@@ -6,6 +6,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -34,37 +39,130 @@ struct DeviceInformation {
 template<typename T>
 using DeviceMap = std::unordered_map<DeviceName, T>;
 
+enum class SchedulingPolicy {
+    DevicePriority,
+    RoundRobin,
+    ShortestExpectedCompletion,
+    WeightedThroughput
+};
+
+/**
+ * @brief Converts a value of MULTI_CONFIG_KEY(SCHEDULING_POLICY), throws for unknown values
+ */
+SchedulingPolicy ParseSchedulingPolicy(const std::string& value);
+
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
 #else
+/**
+ * @brief Multi-producer multi-consumer queue. Values are stored in a lock-free ring buffer (D. Vyukov's bounded queue),
+ * values which do not fit the ring go to a mutex guarded overflow queue, so the queue is unbounded
+ */
 template <typename T>
 class ThreadSafeQueue {
 public:
+    explicit ThreadSafeQueue(std::size_t capacity = 256) {
+        std::size_t size = 1;
+        while (size < capacity) size <<= 1;
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
     void push(T value) {
+        // once ring is full later values go to the overflow queue until it is drained to keep FIFO order
+        if (0 == _overflowSize.load(std::memory_order_acquire) && try_push_ring(value)) {
+            return;
+        }
         std::lock_guard<std::mutex> lock(_mutex);
-        _queue.push(std::move(value));
+        _overflow.push(std::move(value));
+        _overflowSize.fetch_add(1, std::memory_order_release);
     }
 
     bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (!_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
+        if (try_pop_ring(value)) {
             return true;
-        } else {
+        }
+        if (0 == _overflowSize.load(std::memory_order_acquire)) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_overflow.empty()) {
             return false;
         }
+        value = std::move(_overflow.front());
+        _overflow.pop();
+        _overflowSize.fetch_sub(1, std::memory_order_release);
+        return true;
     }
 
     bool empty() {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _queue.empty();
+        return _enqueuePosition.load(std::memory_order_acquire) == _dequeuePosition.load(std::memory_order_acquire) &&
+               0 == _overflowSize.load(std::memory_order_acquire);
     }
 
 protected:
-    std::queue<T>   _queue;
-    std::mutex      _mutex;
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        T                           _value;
+    };
+
+    bool try_push_ring(T& value) {
+        auto position = _enqueuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[position & _mask];
+            auto sequence = cell._sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (0 == diff) {
+                if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell._value = std::move(value);
+                    cell._sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = _enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop_ring(T& value) {
+        auto position = _dequeuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[position & _mask];
+            auto sequence = cell._sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+            if (0 == diff) {
+                if (_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell._value);
+                    // releases resources captured by the value before the cell is reused
+                    cell._value = T{};
+                    cell._sequence.store(position + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                position = _dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    static constexpr std::size_t cacheLineSize = 64;
+    std::unique_ptr<Cell[]>     _cells;
+    std::size_t                 _mask = 0;
+    char                        _padding0[cacheLineSize];
+    std::atomic<std::size_t>    _enqueuePosition = {0};
+    char                        _padding1[cacheLineSize];
+    std::atomic<std::size_t>    _dequeuePosition = {0};
+    char                        _padding2[cacheLineSize];
+    std::atomic<std::size_t>    _overflowSize = {0};
+    std::queue<T>               _overflow;
+    std::mutex                  _mutex;
 };
 #endif
 
@@ -76,6 +174,12 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
+    };
+    struct DeviceStatistics {
+        std::atomic<unsigned int>   _dispatched = {0};
+        std::atomic<unsigned int>   _inFlight = {0};
+        std::atomic<double>         _averageLatency = {0.};  // milliseconds
     };
     using NotBusyWorkerRequests = ThreadSafeQueue<WorkerInferRequest*>;
 
@@ -93,18 +197,43 @@ public:
                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
     ~MultiDeviceExecutableNetwork() override;
 
+    using BackgroundLoad = std::function<InferenceEngine::ExecutableNetwork(const DeviceInformation&)>;
+    /**
+     * @brief Loads the networks for the devices in background threads. The devices loaded before serve the requests
+     * until the devices are ready, then the requests are dispatched to the loaded ones of the priorities.
+     * If the stand-in devices are released they stop serving and their requests and networks are freed once
+     * the background loads are over
+     */
+    void LoadDevicesInBackground(const std::vector<DeviceInformation>&  devices,
+                                 const std::vector<DeviceInformation>&  priorities,
+                                 const bool                             releaseStandInDevices,
+                                 BackgroundLoad                         loadNetwork);
+    bool UpdateDevicePriorities(const std::vector<DeviceInformation>&   priorities,
+                                const std::vector<DeviceName>&          excludedDevices);
+    void ReleaseStandInDevices(const std::vector<DeviceInformation>&    priorities,
+                               const std::vector<DeviceName>&           standInDevices);
+    void CreateWorkerRequests(const DeviceName&                       device,
+                              InferenceEngine::ExecutableNetwork&     network,
+                              const std::vector<DeviceInformation>&   networkDevices);
     void ScheduleToWorkerInferRequest();
+    void OrderDevices(std::vector<const DeviceInformation*>& devices, SchedulingPolicy policy);
+    void UpdateDeviceStatistics(const DeviceName& device, const WorkerInferRequest& workerRequest);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     std::atomic_bool                                            _terminate = {false};
-    std::mutex                                                  _mutex;
-    std::vector<DeviceInformation>                              _devicePriorities;
+    mutable std::mutex                                          _mutex;
+    // replaced as a whole on SetConfig, so dispatching reads it without locking _mutex
+    std::shared_ptr<const std::vector<DeviceInformation>>       _devicePriorities;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
     ThreadSafeQueue<InferenceEngine::Task>                      _inferPipelineTasks;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
+    std::atomic<SchedulingPolicy>                               _schedulingPolicy = {SchedulingPolicy::DevicePriority};
+    std::atomic<std::size_t>                                    _roundRobinCounter = {0};
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    std::vector<std::future<void>>                              _pendingDeviceLoads;
 };
 
 }  // namespace MultiDevicePlugin
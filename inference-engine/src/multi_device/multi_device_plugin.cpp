@@ -3,15 +3,21 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory>
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <functional>
 
 
+#include <ngraph/graph_util.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
 #include <ie_metric_helpers.hpp>
+#include <ie_load_time_breakdown.hpp>
 #include <multi-device/multi_device_config.hpp>
 #include "multi_device_plugin.hpp"
 
@@ -26,6 +32,56 @@ namespace {
         }
         return config;
     }
+
+    std::vector<std::string> SplitDevices(const std::string& devices) {
+        std::vector<std::string> result;
+        std::string::size_type i = 0;
+        std::string::size_type idelimeter;
+        while ((idelimeter = devices.find(',', i)) != std::string::npos) {
+            result.push_back(devices.substr(i, idelimeter - i));
+            i = idelimeter + 1;
+        }
+        result.push_back(devices.substr(i));
+        return result;
+    }
+
+    // quantized networks are INT8 ones, other networks have the precision of their weights
+    std::string GetNetworkPrecision(const ngraph::Function& function) {
+        bool hasFP16Weights = false;
+        for (auto&& node : function.get_ops()) {
+            if (ngraph::is_type<ngraph::opset1::FakeQuantize>(node)) {
+                return METRIC_VALUE(INT8);
+            }
+            hasFP16Weights |= ngraph::is_type<ngraph::opset1::Constant>(node) &&
+                              node->get_output_element_type(0) == ngraph::element::f16;
+        }
+        return hasFP16Weights ? METRIC_VALUE(FP16) : METRIC_VALUE(FP32);
+    }
+
+    // the network is compiled after LoadNetwork returns, so the background loads get a copy of it
+    CNNNetwork CopyNetwork(const ICNNNetwork& network) {
+        CNNNetwork copy{ngraph::clone_function(*network.getFunction())};
+        InputsDataMap inputs;
+        network.getInputsInfo(inputs);
+        for (auto&& input : copy.getInputsInfo()) {
+            auto original = inputs.find(input.first);
+            if (original != inputs.end()) {
+                input.second->setPrecision(original->second->getPrecision());
+                input.second->setLayout(original->second->getLayout());
+                input.second->getPreProcess() = original->second->getPreProcess();
+            }
+        }
+        OutputsDataMap outputs;
+        network.getOutputsInfo(outputs);
+        for (auto&& output : copy.getOutputsInfo()) {
+            auto original = outputs.find(output.first);
+            if (original != outputs.end()) {
+                output.second->setPrecision(original->second->getPrecision());
+                output.second->setLayout(original->second->getLayout());
+            }
+        }
+        return copy;
+    }
 }  // namespace
 
 std::map<std::string, std::string> MultiDeviceInferencePlugin::GetSupportedConfig(
@@ -108,6 +164,9 @@ Parameter MultiDeviceInferencePlugin::GetConfig(const std::string& name,
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string{MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -140,6 +199,11 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+            MultiDeviceConfigParams::KEY_MULTI_BACKGROUND_LOAD_DEVICES,
+            MultiDeviceConfigParams::KEY_MULTI_RELEASE_STAND_IN_DEVICES,
+            MultiDeviceConfigParams::KEY_MULTI_AUTO_DEVICE_CANDIDATES,
+            MultiDeviceConfigParams::KEY_MULTI_PERFORMANCE_HINT,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -147,6 +211,14 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     }
 }
 
+MultiDeviceExecutableNetwork::BackgroundLoad MultiDeviceInferencePlugin::LoadInBackground(const ICNNNetwork& network) const {
+    auto core = GetCore();
+    auto networkCopy = CopyNetwork(network);
+    return [core, networkCopy] (const DeviceInformation& device) {
+        return core->LoadNetwork(networkCopy, device.deviceName, device.config);
+    };
+}
+
 ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(const ICNNNetwork &network,
                                                                               const std::map<std::string, std::string>& config) {
     if (GetCore() == nullptr) {
@@ -158,6 +230,11 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     }
 
     auto fullConfig = mergeConfigs(_config, config);
+    auto candidates = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_AUTO_DEVICE_CANDIDATES);
+    if (candidates != fullConfig.end()) {
+        return LoadAutoNetworkImpl(network, candidates->second, fullConfig);
+    }
+
     auto priorities = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
     if (priorities == fullConfig.end()) {
         THROW_IE_EXCEPTION << "KEY_MULTI_DEVICE_PRIORITIES key is not set for MULTI device";
@@ -165,18 +242,71 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
 
     auto metaDevices = ParseMetaDevices(priorities->second, fullConfig);
 
+    // the devices which compile the network in background do not serve the requests until they are ready
+    std::vector<DeviceInformation> startMetaDevices;
+    std::vector<DeviceInformation> backgroundMetaDevices;
+    auto backgroundDevices = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_BACKGROUND_LOAD_DEVICES);
+    std::vector<std::string> backgroundDeviceNames;
+    if (backgroundDevices != fullConfig.end() && !backgroundDevices->second.empty()) {
+        backgroundDeviceNames = SplitDevices(backgroundDevices->second);
+    }
+    for (auto&& metaDevice : metaDevices) {
+        bool inBackground = std::find(backgroundDeviceNames.begin(), backgroundDeviceNames.end(),
+                                      metaDevice.deviceName) != backgroundDeviceNames.end();
+        (inBackground ? backgroundMetaDevices : startMetaDevices).push_back(metaDevice);
+    }
+    if (startMetaDevices.empty()) {
+        THROW_IE_EXCEPTION << "All the devices of KEY_MULTI_DEVICE_PRIORITIES are listed in "
+                           << "KEY_MULTI_BACKGROUND_LOAD_DEVICES, so there is no device to serve the requests";
+    }
+    auto releaseStandIn = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_RELEASE_STAND_IN_DEVICES);
+    bool releaseStandInDevices = false;
+    if (releaseStandIn != fullConfig.end()) {
+        if (releaseStandIn->second != PluginConfigParams::YES && releaseStandIn->second != PluginConfigParams::NO) {
+            THROW_IE_EXCEPTION << "Wrong value " << releaseStandIn->second << " for property key "
+                               << MultiDeviceConfigParams::KEY_MULTI_RELEASE_STAND_IN_DEVICES << ". Expected only "
+                               << PluginConfigParams::YES << "/" << PluginConfigParams::NO;
+        }
+        releaseStandInDevices = releaseStandIn->second == PluginConfigParams::YES;
+    }
+
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != fullConfig.end()) {
+        ParseSchedulingPolicy(policy->second);
+        multiNetworkConfig.insert(*policy);
+    }
+    if (!backgroundMetaDevices.empty()) {
+        multiNetworkConfig.insert(*backgroundDevices);
+        multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_RELEASE_STAND_IN_DEVICES] =
+            std::string{releaseStandInDevices ? PluginConfigParams::YES : PluginConfigParams::NO};
+        std::string startPriorities;
+        for (auto&& metaDevice : startMetaDevices) {
+            startPriorities += (startPriorities.empty() ? "" : ",") + metaDevice.deviceName;
+        }
+        multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = startPriorities;
+    }
+
+    // devices compile the network at the same time, so the load time is the one of the slowest device
+    std::vector<ExecutableNetwork> executableNetworks(startMetaDevices.size());
+    std::vector<std::function<void()>> loadTasks;
+    for (std::size_t i = 0; i < startMetaDevices.size(); ++i) {
+        loadTasks.emplace_back([&, i] {
+            executableNetworks[i] = GetCore()->LoadNetwork(
+                CNNNetwork{ICNNNetwork::Ptr{const_cast<ICNNNetwork*>(&network),
+                                            [](ICNNNetwork*){}}}, startMetaDevices[i].deviceName, startMetaDevices[i].config);
+        });
+    }
+    RunLoadTasksInParallel(loadTasks);
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
-    for (auto& p : metaDevices) {
-        auto & deviceName = p.deviceName;
-        auto & deviceConfig = p.config;
-        executableNetworkPerDevice.insert({ deviceName, GetCore()->LoadNetwork(
-            CNNNetwork{ICNNNetwork::Ptr{const_cast<ICNNNetwork*>(&network),
-                                        [](ICNNNetwork*){}}}, deviceName, deviceConfig) });
-        multiNetworkConfig.insert(deviceConfig.begin(), deviceConfig.end());
+    for (std::size_t i = 0; i < startMetaDevices.size(); ++i) {
+        executableNetworkPerDevice.insert({ startMetaDevices[i].deviceName, executableNetworks[i] });
+    }
+    for (auto&& metaDevice : metaDevices) {
+        multiNetworkConfig.insert(metaDevice.config.begin(), metaDevice.config.end());
     }
     if (executableNetworkPerDevice.empty())
         THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to load Executable network to any device "
@@ -185,10 +315,140 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     auto perfConfig = fullConfig.find(PluginConfigParams::KEY_PERF_COUNT);
     bool enablePerfCounters = (fullConfig.end() != perfConfig) && (perfConfig->second == PluginConfigParams::YES);
 
-    return std::make_shared<MultiDeviceExecutableNetwork>(executableNetworkPerDevice,
-                                                          metaDevices,
-                                                          multiNetworkConfig,
-                                                          enablePerfCounters);
+    auto executableNetwork = std::make_shared<MultiDeviceExecutableNetwork>(executableNetworkPerDevice,
+                                                                            startMetaDevices,
+                                                                            multiNetworkConfig,
+                                                                            enablePerfCounters);
+    if (!backgroundMetaDevices.empty()) {
+        executableNetwork->LoadDevicesInBackground(backgroundMetaDevices, metaDevices, releaseStandInDevices,
+                                                   LoadInBackground(network));
+    }
+    return executableNetwork;
+}
+
+ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadAutoNetworkImpl(const ICNNNetwork& network,
+                                                                               const std::string& candidatesList,
+                                                                               const std::map<std::string, std::string>& config) {
+    bool throughput = false;
+    auto hint = config.find(MultiDeviceConfigParams::KEY_MULTI_PERFORMANCE_HINT);
+    if (hint != config.end()) {
+        if (hint->second != MultiDeviceConfigParams::MULTI_LATENCY &&
+            hint->second != MultiDeviceConfigParams::MULTI_THROUGHPUT) {
+            THROW_IE_EXCEPTION << "Wrong value " << hint->second << " for property key "
+                               << MultiDeviceConfigParams::KEY_MULTI_PERFORMANCE_HINT << ". Expected only "
+                               << MultiDeviceConfigParams::MULTI_LATENCY << "/" << MultiDeviceConfigParams::MULTI_THROUGHPUT;
+        }
+        throughput = hint->second == MultiDeviceConfigParams::MULTI_THROUGHPUT;
+    }
+
+    auto isCPU = [] (const std::string& device) { return DeviceIDParser(device).getDeviceName() == "CPU"; };
+    std::vector<std::string> candidates;
+    if (candidatesList.empty()) {
+        candidates = GetCore()->GetAvailableDevices();
+        // GPU is the preferred accelerator unless the candidates are listed explicitly
+        std::stable_partition(candidates.begin(), candidates.end(), [] (const std::string& device) {
+            return DeviceIDParser(device).getDeviceName() == "GPU";
+        });
+    } else {
+        candidates = SplitDevices(candidatesList);
+    }
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [] (const std::string& device) {
+        auto deviceName = DeviceIDParser(device).getDeviceName();
+        return deviceName.empty() || deviceName == "MULTI" || deviceName == "HETERO" || deviceName == "BATCH";
+    }), candidates.end());
+    if (candidates.empty()) {
+        THROW_IE_EXCEPTION << NOT_FOUND_str << "There are no devices for the AUTO device to select from";
+    }
+
+    // the first accelerator which runs the network in its precision, FP32 and FP16 networks are converted by devices
+    const auto precision = GetNetworkPrecision(*network.getFunction());
+    std::string accelerator;
+    for (auto&& candidate : candidates) {
+        if (isCPU(candidate)) {
+            continue;
+        }
+        std::vector<std::string> capabilities;
+        try {
+            capabilities = GetCore()->GetMetric(candidate, METRIC_KEY(OPTIMIZATION_CAPABILITIES))
+                                      .as<std::vector<std::string>>();
+        } catch (const details::InferenceEngineException&) {
+            continue;
+        }
+        auto supports = [&] (const std::string& value) {
+            return std::find(capabilities.begin(), capabilities.end(), value) != capabilities.end();
+        };
+        if (supports(precision) || (precision != METRIC_VALUE(INT8) &&
+                                    (supports(METRIC_VALUE(FP32)) || supports(METRIC_VALUE(FP16))))) {
+            accelerator = candidate;
+            break;
+        }
+    }
+    auto cpu = std::find_if(candidates.begin(), candidates.end(), isCPU);
+
+    // the number of streams follows the hint unless it is set explicitly, the number of requests follows the streams
+    auto autoConfig = config;
+    autoConfig.emplace(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS,
+                       throughput ? PluginConfigParams::CPU_THROUGHPUT_AUTO : "1");
+    autoConfig.emplace(PluginConfigParams::KEY_GPU_THROUGHPUT_STREAMS,
+                       throughput ? PluginConfigParams::GPU_THROUGHPUT_AUTO : "1");
+
+    std::string servingDevices;
+    if (accelerator.empty()) {
+        servingDevices = (cpu != candidates.end()) ? *cpu : candidates.front();
+    } else if (cpu == candidates.end()) {
+        servingDevices = accelerator;
+    } else {
+        servingDevices = throughput ? accelerator + "," + *cpu : accelerator;
+    }
+    auto servingMetaDevices = ParseMetaDevices(servingDevices, autoConfig);
+    // the CPU compiles the network much faster than accelerators, so it serves the requests until the accelerator is ready
+    const bool loadInBackground = !accelerator.empty() && cpu != candidates.end();
+    auto startMetaDevices = loadInBackground ? ParseMetaDevices(*cpu, autoConfig) : servingMetaDevices;
+
+    std::vector<ExecutableNetwork> executableNetworks(startMetaDevices.size());
+    std::vector<std::function<void()>> loadTasks;
+    for (std::size_t i = 0; i < startMetaDevices.size(); ++i) {
+        loadTasks.emplace_back([&, i] {
+            executableNetworks[i] = GetCore()->LoadNetwork(
+                CNNNetwork{ICNNNetwork::Ptr{const_cast<ICNNNetwork*>(&network),
+                                            [](ICNNNetwork*){}}}, startMetaDevices[i].deviceName, startMetaDevices[i].config);
+        });
+    }
+    RunLoadTasksInParallel(loadTasks);
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
+    std::string startPriorities;
+    DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
+    for (std::size_t i = 0; i < startMetaDevices.size(); ++i) {
+        executableNetworkPerDevice.insert({ startMetaDevices[i].deviceName, executableNetworks[i] });
+        multiNetworkConfig.insert(startMetaDevices[i].config.begin(), startMetaDevices[i].config.end());
+        startPriorities += (startPriorities.empty() ? "" : ",") + startMetaDevices[i].deviceName;
+    }
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = startPriorities;
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_AUTO_DEVICE_CANDIDATES] = candidatesList;
+    multiNetworkConfig[MultiDeviceConfigParams::KEY_MULTI_PERFORMANCE_HINT] =
+        std::string{throughput ? MultiDeviceConfigParams::MULTI_THROUGHPUT : MultiDeviceConfigParams::MULTI_LATENCY};
+    auto policy = config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != config.end()) {
+        ParseSchedulingPolicy(policy->second);
+        multiNetworkConfig.insert(*policy);
+    }
+
+    auto perfConfig = config.find(PluginConfigParams::KEY_PERF_COUNT);
+    bool enablePerfCounters = (config.end() != perfConfig) && (perfConfig->second == PluginConfigParams::YES);
+
+    auto executableNetwork = std::make_shared<MultiDeviceExecutableNetwork>(executableNetworkPerDevice,
+                                                                            startMetaDevices,
+                                                                            multiNetworkConfig,
+                                                                            enablePerfCounters);
+    if (loadInBackground) {
+        auto acceleratorDevice = *std::find_if(servingMetaDevices.begin(), servingMetaDevices.end(),
+            [&] (const DeviceInformation& device) { return device.deviceName == accelerator; });
+        // the CPU only stands in for the accelerator when the latency is preferred
+        executableNetwork->LoadDevicesInBackground({acceleratorDevice}, servingMetaDevices, !throughput,
+                                                   LoadInBackground(network));
+    }
+    return executableNetwork;
 }
 
 QueryNetworkResult MultiDeviceInferencePlugin::QueryNetwork(const ICNNNetwork&                        network,
@@ -207,6 +467,20 @@ QueryNetworkResult MultiDeviceInferencePlugin::QueryNetwork(const ICNNNetwork&
     queryResult.supportedLayersMap.clear();
 
     auto fullConfig = mergeConfigs(_config, config);
+    // the AUTO device may serve the network by any of the candidates, so the layers supported by all of them are reported
+    auto candidates = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_AUTO_DEVICE_CANDIDATES);
+    if (candidates != fullConfig.end()) {
+        std::string devices = candidates->second;
+        if (devices.empty()) {
+            for (auto&& device : GetCore()->GetAvailableDevices()) {
+                auto deviceName = DeviceIDParser(device).getDeviceName();
+                if (deviceName != "MULTI" && deviceName != "HETERO" && deviceName != "BATCH") {
+                    devices += (devices.empty() ? "" : ",") + device;
+                }
+            }
+        }
+        fullConfig[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = devices;
+    }
     auto priorities = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
     if (priorities == fullConfig.end()) {
         THROW_IE_EXCEPTION << "KEY_MULTI_DEVICE_PRIORITIES key is not set for MULTI device";
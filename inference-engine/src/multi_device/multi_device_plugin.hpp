@@ -35,6 +35,10 @@ public:
                                                   const std::map<std::string, std::string> & config) const;
 
 protected:
+    MultiDeviceExecutableNetwork::BackgroundLoad LoadInBackground(const InferenceEngine::ICNNNetwork& network) const;
+    InferenceEngine::ExecutableNetworkInternal::Ptr LoadAutoNetworkImpl(const InferenceEngine::ICNNNetwork& network,
+                                                                        const std::string& candidates,
+                                                                        const std::map<std::string, std::string>& config);
     std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
                                                           const MultiDevicePlugin::DeviceName & deviceName) const;
 };
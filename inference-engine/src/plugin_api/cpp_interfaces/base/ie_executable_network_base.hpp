@@ -109,6 +109,10 @@ public:
         TO_STATUS(pContext = _impl->GetContext());
     }
 
+    StatusCode StartAsyncBatch(const std::vector<IInferRequest::Ptr>& requests, ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->StartAsyncBatch(requests));
+    }
+
 private:
     ~ExecutableNetworkBase() = default;
 };
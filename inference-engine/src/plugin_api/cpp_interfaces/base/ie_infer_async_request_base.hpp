@@ -73,6 +73,10 @@ public:
         TO_STATUS_NO_RESP(_impl->SetCompletionCallback(callback));
     }
 
+    StatusCode SetImmediateCompletionCallback(CompletionCallback callback) noexcept override {
+        TO_STATUS_NO_RESP(_impl->SetImmediateCompletionCallback(callback));
+    }
+
     StatusCode GetUserData(void** data, ResponseDesc* resp) noexcept override {
         TO_STATUS(_impl->GetUserData(data));
     }
@@ -89,6 +93,10 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetPriority(int priority, int64_t deadline_ms, ResponseDesc* resp) noexcept override {
+        TO_STATUS(_impl->SetPriority(priority, deadline_ms));
+    }
+
     StatusCode QueryState(IVariableState::Ptr& pState, size_t idx, ResponseDesc* resp) noexcept override {
         try {
             auto v = _impl->QueryState();
@@ -15,6 +15,7 @@
 #include "cpp_interfaces/interface/ie_iexecutable_network_internal.hpp"
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "ie_load_time_breakdown.hpp"
 
 namespace InferenceEngine {
 
@@ -88,6 +89,14 @@ public:
         _plugin = plugin;
     }
 
+    /**
+     * @brief      Sets a breakdown of time spent by LoadNetwork which created the network.
+     * @param[in]  breakdown  The breakdown
+     */
+    void SetLoadTimeBreakdown(const LoadTimeBreakdown::Ptr& breakdown) {
+        _loadTimeBreakdown = breakdown;
+    }
+
     std::vector<IVariableStateInternal::Ptr> QueryState() override {
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
@@ -114,6 +123,15 @@ public:
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
 
+    void StartAsyncBatch(const std::vector<IInferRequest::Ptr>& requests) override {
+        for (auto&& request : requests) {
+            if (nullptr == request) THROW_IE_EXCEPTION << NOT_ALLOCATED_str << "Infer request is null";
+            ResponseDesc resp;
+            const auto status = request->StartAsync(&resp);
+            if (OK != status) THROW_IE_EXCEPTION << details::as_status << status << resp.msg;
+        }
+    }
+
 protected:
     /**
      * @brief Exports an internal hardware-dependent model to a stream.
@@ -126,6 +144,14 @@ protected:
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
 
+    /**
+     * @brief Returns a value of METRIC_KEY(LOAD_TIME_BREAKDOWN), could be used by GetMetric implementations
+     * @return A map from a phase name to its time in milliseconds, empty if the network was not loaded
+     */
+    std::map<std::string, float> GetLoadTimeBreakdown() const {
+        return _loadTimeBreakdown != nullptr ? _loadTimeBreakdown->Get() : std::map<std::string, float>{};
+    }
+
     InferenceEngine::InputsDataMap _networkInputs;  //!< Holds infromation about network inputs info
     InferenceEngine::OutputsDataMap _networkOutputs;  //!< Holds information about network outputs data
 
@@ -134,6 +160,8 @@ protected:
      * @note Needed to correctly handle ownership between objects.
      */
     IInferencePlugin::Ptr _plugin;
+
+    LoadTimeBreakdown::Ptr _loadTimeBreakdown;  //!< Holds time spent by LoadNetwork in its phases
 };
 
 }  // namespace InferenceEngine
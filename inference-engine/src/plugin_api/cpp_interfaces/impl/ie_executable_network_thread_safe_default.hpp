@@ -13,6 +13,9 @@
 #include "cpp_interfaces/impl/ie_executable_network_internal.hpp"
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
+#include "cpp_interfaces/impl/ie_infer_requests_statistics.hpp"
+#include "ie_metric_helpers.hpp"
+#include "ie_plugin_config.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
 
 namespace InferenceEngine {
@@ -54,6 +57,22 @@ public:
         return CreateAsyncInferRequestFromSync();
     }
 
+    /**
+     * @brief Starts requests one by one, but first stages of the requests are passed to each executor at once
+     * @param requests Requests to start
+     */
+    void StartAsyncBatch(const std::vector<IInferRequest::Ptr>& requests) override {
+        AsyncInferRequestThreadSafeDefault::BatchStart batchStart;
+        try {
+            ExecutableNetworkInternal::StartAsyncBatch(requests);
+        } catch (...) {
+            // requests which are already started wait for their stages
+            batchStart.Submit();
+            throw;
+        }
+        batchStart.Submit();
+    }
+
 protected:
     /**
      * @brief Creates asyncronous inference request from synchronous request returned by CreateInferRequestImpl
@@ -72,10 +91,47 @@ protected:
         asyncRequest.reset(new InferRequestBase<AsyncInferRequestType>(asyncThreadSafeImpl),
             [](IInferRequest *p) { p->Release(); });
         asyncThreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
+        asyncThreadSafeImpl->SetRequestsStatistics(_requestsStatistics);
 
         return asyncRequest;
     }
 
+    /**
+     * @brief Returns names of runtime metrics which are collected while inference is running
+     * @return A vector of metric names
+     */
+    static std::vector<std::string> GetRuntimeMetricNames() {
+        return {METRIC_KEY(QUEUED_TASKS),
+                METRIC_KEY(BUSY_STREAMS),
+                METRIC_KEY(COMPLETED_INFER_REQUESTS),
+                METRIC_KEY(INFER_REQUESTS_PER_SECOND),
+                METRIC_KEY(INFER_REQUEST_LATENCY_HISTOGRAM)};
+    }
+
+    /**
+     * @brief Gets a value of a runtime metric, could be used by GetMetric implementations of derived classes
+     * @param[in]  name A metric name
+     * @param[out] result A metric value
+     * @return `true` if the name is one of runtime metrics, `false` otherwise
+     */
+    bool GetRuntimeMetric(const std::string& name, Parameter& result) const {
+        auto streamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor);
+        if (name == METRIC_KEY(QUEUED_TASKS)) {
+            result = streamsExecutor ? streamsExecutor->GetQueuedTasksNumber() : 0u;
+        } else if (name == METRIC_KEY(BUSY_STREAMS)) {
+            result = streamsExecutor ? streamsExecutor->GetBusyStreamsNumber() : 0u;
+        } else if (name == METRIC_KEY(COMPLETED_INFER_REQUESTS)) {
+            result = _requestsStatistics->GetCompletedRequests();
+        } else if (name == METRIC_KEY(INFER_REQUESTS_PER_SECOND)) {
+            result = _requestsStatistics->GetRequestsPerSecond();
+        } else if (name == METRIC_KEY(INFER_REQUEST_LATENCY_HISTOGRAM)) {
+            result = _requestsStatistics->GetLatencyHistogram();
+        } else {
+            return false;
+        }
+        return true;
+    }
+
     /**
      * @brief Creates a synchronous inference request object used to infer the network
      * @note Used by ExecutableNetworkThreadSafeDefault::CreateInferRequest as a plugin-specific implementation
@@ -88,6 +144,7 @@ protected:
 
     ITaskExecutor::Ptr _taskExecutor = nullptr;  //!< Holds a task executor
     ITaskExecutor::Ptr _callbackExecutor = nullptr;  //!< Holds a callback executor
+    InferRequestsStatistics::Ptr _requestsStatistics = std::make_shared<InferRequestsStatistics>();  //!< Holds statistics of requests
 };
 
 }  // namespace InferenceEngine
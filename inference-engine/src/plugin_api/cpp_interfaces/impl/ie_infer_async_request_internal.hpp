@@ -40,6 +40,11 @@ public:
         _callback = callback;
     }
 
+    void SetImmediateCompletionCallback(IInferRequest::CompletionCallback callback) override {
+        // the callback is called by the thread which waits for the request
+        _callback = callback;
+    }
+
     void GetUserData(void** data) override {
         if (data == nullptr) THROW_IE_EXCEPTION << NOT_ALLOCATED_str;
         *data = _userData;
@@ -58,6 +63,11 @@ public:
         _publicInterface = ptr;
     }
 
+    void SetPriority(int, int64_t deadlineMs) override {
+        // the request is not scheduled by task executors, so the priority is only checked
+        if (deadlineMs < 0) THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Deadline can't be negative";
+    }
+
     void StartAsync() override {
         checkBlobs();
         StartAsyncImpl();
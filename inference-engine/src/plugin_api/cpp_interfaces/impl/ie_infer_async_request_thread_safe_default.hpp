@@ -10,9 +10,13 @@
 
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_internal.hpp>
+#include <cpp_interfaces/impl/ie_infer_requests_statistics.hpp>
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
+#include <ie_trace.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <exception>
 #include <future>
 #include <map>
@@ -64,6 +68,61 @@ class AsyncInferRequestThreadSafeDefault : public AsyncInferRequestThreadSafeInt
     };
 
 public:
+    /**
+     * @brief While an object of the class exists, first stages of requests started by StartAsync() in the same thread
+     *        are collected instead of being passed to executors. Submit() passes collected stages of each executor
+     *        with one ITaskExecutor::runBatch() call
+     */
+    class BatchStart {
+    public:
+        BatchStart() : _previous{Current()} {
+            Current() = this;
+        }
+
+        ~BatchStart() {
+            Current() = _previous;
+        }
+
+        /**
+         * @brief Passes the collected stages to their executors, must be called even if some request fails to start
+         */
+        void Submit() {
+            auto batches = std::move(_batches);
+            _batches.clear();
+            for (auto&& batch : batches) {
+                batch._executor->runBatch(std::move(batch._tasks), batch._priorities);
+            }
+        }
+
+    private:
+        friend class AsyncInferRequestThreadSafeDefault;
+
+        struct Batch {
+            ITaskExecutor::Ptr          _executor;
+            std::vector<Task>           _tasks;
+            std::vector<TaskPriority>   _priorities;
+        };
+
+        static BatchStart*& Current() {
+            static thread_local BatchStart* current = nullptr;
+            return current;
+        }
+
+        void Add(const ITaskExecutor::Ptr& executor, Task task, const TaskPriority& priority) {
+            auto itBatch = std::find_if(_batches.begin(), _batches.end(), [&] (const Batch& batch) {
+                return batch._executor == executor;
+            });
+            if (itBatch == _batches.end()) {
+                itBatch = _batches.insert(_batches.end(), Batch{executor, {}, {}});
+            }
+            itBatch->_tasks.emplace_back(std::move(task));
+            itBatch->_priorities.emplace_back(priority);
+        }
+
+        BatchStart* _previous = nullptr;
+        std::vector<Batch> _batches;
+    };
+
     /**
      * @brief A shared pointer to AsyncInferRequestThreadSafeDefault
      */
@@ -92,6 +151,14 @@ public:
         }
     }
 
+    /**
+     * @brief Sets statistics which are updated on completion of each request
+     * @param statistics Statistics shared by requests of an executable network
+     */
+    void SetRequestsStatistics(const InferRequestsStatistics::Ptr& statistics) {
+        _requestsStatistics = statistics;
+    }
+
     /**
      * @brief      Destroys the object, stops AsyncInferRequestThreadSafeDefault::_pipeline and waits for a finish.
      */
@@ -177,6 +244,13 @@ protected:
     void RunFirstStage(const Pipeline::iterator itBeginStage, const Pipeline::iterator itEndStage,
                        const ITaskExecutor::Ptr callbackExecutor = {}) {
         _promise = {};
+        _traceStart = trace::enabled() ? trace::now() : -1;
+        if (_requestsStatistics != nullptr || _deadline.count() > 0) {
+            _requestStart = std::chrono::steady_clock::now();
+        }
+        _taskPriority.level = _priority;
+        _taskPriority.deadline = _deadline.count() > 0 ? _requestStart + _deadline
+                                                       : std::chrono::steady_clock::time_point::max();
         bool stop = [&] {
             std::lock_guard<std::mutex> lock(_mutex);
             if (!_stop) {
@@ -200,7 +274,14 @@ protected:
             try {
                 auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
                 IE_ASSERT(nullptr != firstStageExecutor);
-                firstStageExecutor->run(MakeNextStageTask(itBeginStage, itEndStage, std::move(callbackExecutor)));
+                auto firstStageTask = MakeNextStageTask(itBeginStage, itBeginStage, itEndStage,
+                                                        std::move(callbackExecutor));
+                auto batchStart = BatchStart::Current();
+                if (nullptr != batchStart) {
+                    batchStart->Add(firstStageExecutor, std::move(firstStageTask), _taskPriority);
+                } else {
+                    firstStageExecutor->runWithPriority(std::move(firstStageTask), _taskPriority);
+                }
             } catch (...) {
                 _promise.set_exception(std::current_exception());
                 throw;
@@ -233,6 +314,7 @@ protected:
      */
     void InferUsingAsync() {
         DisableCallbackGuard disableCallbackGuard{_callback};
+        NoBatchStartGuard noBatchStartGuard;
         StartAsync_ThreadUnsafe();
         Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
     }
@@ -242,6 +324,7 @@ protected:
      */
     void InferUsingSync() {
         DisableCallbackGuard disableCallbackGuard{_callback};
+        NoBatchStartGuard noBatchStartGuard;
         _syncRequest->checkBlobs();
         RunFirstStage(_syncPipeline.begin(), _syncPipeline.end(), _syncCallbackExecutor);
         // If we have exception we should extract it from future using Wait() method
@@ -285,6 +368,12 @@ protected:
 
     void SetCompletionCallback_ThreadUnsafe(IInferRequest::CompletionCallback callback) override {
         _callback = callback;
+        _immediateCallback = false;
+    }
+
+    void SetImmediateCompletionCallback_ThreadUnsafe(IInferRequest::CompletionCallback callback) override {
+        _callback = callback;
+        _immediateCallback = true;
     }
 
     void GetUserData_ThreadUnsafe(void** data) override {
@@ -300,6 +389,14 @@ protected:
         _syncRequest->SetBatch(batch);
     }
 
+    void SetPriority_ThreadUnsafe(int priority, int64_t deadlineMs) override {
+        if (deadlineMs < 0) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Deadline can't be negative for InferRequest::SetPriority";
+        }
+        _priority = priority;
+        _deadline = std::chrono::milliseconds{deadlineMs};
+    }
+
 private:
     /**
      * @brief Create a task with next pipeline stage.
@@ -308,14 +405,15 @@ private:
      * the last stage task is called or passed to callback executor if it is presented. The last stage task call the
      * callback, if it is presented, capture the `_promise` member and use it to forward completion or exception to the
      * one of `_futures` member
+     * @param[in]  itBeginStage Iterator to begin of pipeline, used to get a stage index for a timeline trace
      * @param[in]  itStage Iterator to next stage of pipeline
      * @param[in]  itEndStage End pipeline iterator
      * @param[in]  callbackExecutor Executor that will run final stage with callback call
      * @return A next stage task
      */
-    Task MakeNextStageTask(const Pipeline::iterator itStage, const Pipeline::iterator itEndStage,
-                           const ITaskExecutor::Ptr callbackExecutor) {
-        return std::bind([this, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
+    Task MakeNextStageTask(const Pipeline::iterator itBeginStage, const Pipeline::iterator itStage,
+                           const Pipeline::iterator itEndStage, const ITaskExecutor::Ptr callbackExecutor) {
+        return std::bind([this, itBeginStage, itStage, itEndStage](ITaskExecutor::Ptr& callbackExecutor) mutable {
             StatusCode requestStatus = StatusCode::OK;
             std::exception_ptr localCurrentException = nullptr;
             auto& thisStage = *itStage;
@@ -324,12 +422,17 @@ private:
             try {
                 auto& stageTask = std::get<Stage_e::task>(thisStage);
                 IE_ASSERT(nullptr != stageTask);
-                stageTask();
+                {
+                    trace::Scope traceStage{"PipelineStage", "stage", this, itStage - itBeginStage};
+                    stageTask();
+                }
                if (itEndStage != itNextStage) {
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
                     IE_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(MakeNextStageTask(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    nextStageExecutor->runWithPriority(MakeNextStageTask(itBeginStage, itNextStage, itEndStage,
+                                                                         std::move(callbackExecutor)),
+                                                       _taskPriority);
                 }
             } catch (InferenceEngine::details::InferenceEngineException& ie_ex) {
                 requestStatus = ie_ex.hasStatus() ? ie_ex.getStatus() : StatusCode::GENERAL_ERROR;
@@ -341,6 +444,12 @@ private:
 
             if ((itEndStage == itNextStage) || (nullptr != localCurrentException)) {
                 auto lastStageTask = [this, requestStatus, localCurrentException]() mutable {
+                    if (_traceStart >= 0) {
+                        trace::record("InferRequest", "request", this, -1, _traceStart, trace::now());
+                    }
+                    if (_requestsStatistics != nullptr) {
+                        _requestsStatistics->Add(std::chrono::steady_clock::now() - _requestStart);
+                    }
                     auto promise = std::move(_promise);
                     auto callback = _callback.load();
                     if (setIsRequestBusy(false)) {
@@ -361,19 +470,37 @@ private:
                     }
                 };
 
-                if (nullptr == callbackExecutor) {
+                if ((nullptr == callbackExecutor) || _immediateCallback) {
                     lastStageTask();
                 } else {
-                    callbackExecutor->run(std::move(lastStageTask));
+                    callbackExecutor->runWithPriority(std::move(lastStageTask), _taskPriority);
                 }
             }
         }, std::move(callbackExecutor));
     }
 
+    // synchronous inference waits for its stages, so they are not collected by BatchStart
+    struct NoBatchStartGuard {
+        NoBatchStartGuard() : _batchStart(BatchStart::Current()) {
+            BatchStart::Current() = nullptr;
+        }
+        ~NoBatchStartGuard() {
+            BatchStart::Current() = _batchStart;
+        }
+        BatchStart* _batchStart;
+    };
+
     void* _userData = nullptr;
     AtomicCallback _callback = {nullptr};
+    bool _immediateCallback = false;  //!< The callback is called by the last stage thread, not the callback executor
     IInferRequest::Ptr _publicInterface;
     std::promise<void> _promise;
+    int64_t _traceStart = -1;
+    InferRequestsStatistics::Ptr _requestsStatistics;
+    std::chrono::steady_clock::time_point _requestStart;
+    int _priority = 0;
+    std::chrono::milliseconds _deadline{0};
+    TaskPriority _taskPriority;  //!< The priority of stages of the started pipeline
     mutable std::mutex _mutex;
     Futures _futures;
     bool _stop = false;
@@ -91,6 +91,11 @@ public:
         SetCompletionCallback_ThreadUnsafe(callback);
     }
 
+    void SetImmediateCompletionCallback(IInferRequest::CompletionCallback callback) override {
+        CheckBusy();
+        SetImmediateCompletionCallback_ThreadUnsafe(callback);
+    }
+
     void Infer() override {
         if (setIsRequestBusy(true)) ThrowBusy();
         try {
@@ -131,6 +136,11 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetPriority(int priority, int64_t deadlineMs) override {
+        CheckBusy();
+        SetPriority_ThreadUnsafe(priority, deadlineMs);
+    }
+
 protected:
     /**
      * @brief Starts an asynchronous pipeline thread unsafe.
@@ -163,6 +173,14 @@ protected:
      */
     virtual void SetCompletionCallback_ThreadUnsafe(IInferRequest::CompletionCallback callback) = 0;
 
+    /**
+     * @brief Sets the immediate completion callback thread unsafe.
+     * @note Used by AsyncInferRequestThreadSafeInternal::SetImmediateCompletionCallback which ensures thread-safety
+     *       and calls this method after.
+     * @param[in]  callback The callback to set
+     */
+    virtual void SetImmediateCompletionCallback_ThreadUnsafe(IInferRequest::CompletionCallback callback) = 0;
+
     /**
      * @brief Performs inference of pipeline in syncronous mode
      * @note Used by AsyncInferRequestThreadSafeInternal::Infer which ensures thread-safety
@@ -223,6 +241,15 @@ protected:
      * @param[in]  batch  The dynamic batch value
      */
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    /**
+     * @brief Sets the scheduling priority thread unsafe.
+     * @note Used by AsyncInferRequestThreadSafeInternal::SetPriority which ensures thread-safety
+     *       and calls this method after.
+     * @param[in]  priority    The request priority
+     * @param[in]  deadlineMs  The deadline in milliseconds since the start of inference, 0 means no deadline
+     */
+    virtual void SetPriority_ThreadUnsafe(int priority, int64_t deadlineMs) = 0;
 };
 
 }  // namespace InferenceEngine
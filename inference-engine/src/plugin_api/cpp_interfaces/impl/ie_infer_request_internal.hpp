@@ -276,24 +276,19 @@ protected:
         if (_networkOutputs.empty()) {
             THROW_IE_EXCEPTION << "Internal error: network outputs is not set";
         }
-        auto foundInputPair = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
-                                           [&](const std::pair<std::string, InputInfo::Ptr>& pair) {
-                                               return pair.first == name;
-                                           });
-        auto foundOutputPair = std::find_if(std::begin(_networkOutputs), std::end(_networkOutputs),
-                                            [&](const std::pair<std::string, DataPtr>& pair) {
-                                                return pair.first == name;
-                                            });
-        if (foundOutputPair == std::end(_networkOutputs) && (foundInputPair == std::end(_networkInputs))) {
-            THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input or output with name: \'" << name << "\'";
-        }
+        // the maps are searched by key, so networks with many inputs don't pay a linear scan per call
+        const std::string blobName(name);
+        auto foundInputPair = _networkInputs.find(blobName);
         if (foundInputPair != std::end(_networkInputs)) {
             foundInput = foundInputPair->second;
             return true;
-        } else {
-            foundOutput = foundOutputPair->second;
-            return false;
         }
+        auto foundOutputPair = _networkOutputs.find(blobName);
+        if (foundOutputPair == std::end(_networkOutputs)) {
+            THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input or output with name: \'" << name << "\'";
+        }
+        foundOutput = foundOutputPair->second;
+        return false;
     }
 
     /**
@@ -317,10 +312,7 @@ protected:
         if (refDims.empty()) {
             SizeVector dims;
             if (isInput) {
-                auto foundInputPair = std::find_if(std::begin(_networkInputs), std::end(_networkInputs),
-                                                   [&](const std::pair<std::string, InputInfo::Ptr>& pair) {
-                                                       return pair.first == name;
-                                                   });
+                auto foundInputPair = _networkInputs.find(name);
                 if (foundInputPair == std::end(_networkInputs)) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find input with name: \'" << name << "\'";
                 }
@@ -329,10 +321,7 @@ protected:
                     ? details::product(dims)
                     : 1;
             } else {
-                auto foundOutputPair = std::find_if(std::begin(_networkOutputs), std::end(_networkOutputs),
-                                                    [&](const std::pair<std::string, DataPtr>& pair) {
-                                                        return pair.first == name;
-                                                    });
+                auto foundOutputPair = _networkOutputs.find(name);
                 if (foundOutputPair == std::end(_networkOutputs)) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "Failed to find output with name: \'" << name << "\'";
                 }
@@ -351,6 +340,40 @@ protected:
         if (blob->buffer() == nullptr) THROW_IE_EXCEPTION << strNotAllocated;
     }
 
+    /**
+     * @brief      Checks that @p blob is a batch of dense memory blobs which can be copied one by one into
+     *             consecutive batch items of the input. Throws an exception if it's not.
+     *
+     * @param[in]  blob  The batched blob to check
+     * @param[in]  info  The input information of the network input
+     */
+    void checkBatchedBlob(const BatchedBlob::Ptr& blob, const InputInfo::Ptr& info) const {
+        const auto& inputDesc = info->getTensorDesc();
+        const auto& blobDesc = blob->getTensorDesc();
+        if (inputDesc.getDims() != blobDesc.getDims()) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set batched blob. Dimensions mismatch.";
+        }
+        if (inputDesc.getLayout() != Layout::ANY && inputDesc.getLayout() != blobDesc.getLayout()) {
+            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set batched blob. Layout mismatch.";
+        }
+        if (blobDesc.getLayout() == Layout::CN) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "cannot set batched blob: batch must be the outermost dimension";
+        }
+        for (size_t i = 0; i < blob->size(); i++) {
+            const auto item = blob->getBlob(i);
+            if (!item->is<MemoryBlob>()) {
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "cannot set batched blob: supported only for memory blobs";
+            }
+            const auto& itemDesc = item->getTensorDesc();
+            if (itemDesc.getBlockingDesc() != TensorDesc(itemDesc.getPrecision(), itemDesc.getDims(), itemDesc.getLayout()).getBlockingDesc()) {
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "cannot set batched blob: items must be dense";
+            }
+            if (item->buffer() == nullptr) {
+                THROW_IE_EXCEPTION << "Input data was not allocated. Input name: '" << info->name() << "'";
+            }
+        }
+    }
+
     /**
      * @brief Checks whether pre-processing step is required for a given input
      * @param info InputInfo corresponding to input blob
@@ -0,0 +1,98 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace InferenceEngine {
+
+/**
+ * @ingroup ie_dev_api_exec_network_api
+ * @brief Live statistics of inference requests of an executable network. Requests update it with atomic counters
+ *        on completion, so it can be queried concurrently with inference.
+ */
+class InferRequestsStatistics {
+public:
+    /**
+     * @brief A shared pointer to InferRequestsStatistics object
+     */
+    using Ptr = std::shared_ptr<InferRequestsStatistics>;
+
+    /**
+     * @brief Number of latency buckets, upper bound of i-th bucket is 2^i microseconds
+     */
+    static constexpr std::size_t bucketsNumber = 32;
+
+    InferRequestsStatistics() : _lastRateTime{std::chrono::steady_clock::now()} {
+        for (auto&& bucket : _buckets) {
+            bucket = 0;
+        }
+    }
+
+    /**
+     * @brief Registers a completed request
+     * @param latency A time from the request start till its completion
+     */
+    void Add(std::chrono::steady_clock::duration latency) {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+        std::size_t bucket = 0;
+        while (bucket + 1 < bucketsNumber && (static_cast<int64_t>(1) << bucket) < us) {
+            ++bucket;
+        }
+        ++_buckets[bucket];
+        ++_completed;
+    }
+
+    /**
+     * @brief Returns a number of requests completed since the network was loaded
+     * @return A number of completed requests
+     */
+    unsigned int GetCompletedRequests() const {
+        return _completed.load();
+    }
+
+    /**
+     * @brief Returns a cumulative latency histogram
+     * @return A map from a bucket upper bound in milliseconds to a number of requests which latency does not exceed it
+     */
+    std::map<float, unsigned int> GetLatencyHistogram() const {
+        std::map<float, unsigned int> histogram;
+        unsigned int cumulative = 0;
+        for (std::size_t i = 0; i < bucketsNumber; ++i) {
+            cumulative += _buckets[i].load();
+            histogram[static_cast<float>(static_cast<int64_t>(1) << i) / 1000.f] = cumulative;
+        }
+        return histogram;
+    }
+
+    /**
+     * @brief Returns a rate of completed requests since the previous call of this method or network loading
+     * @return A number of requests per second
+     */
+    float GetRequestsPerSecond() {
+        std::lock_guard<std::mutex> lock{_rateMutex};
+        auto now = std::chrono::steady_clock::now();
+        auto completed = _completed.load();
+        auto seconds = std::chrono::duration_cast<std::chrono::duration<float>>(now - _lastRateTime).count();
+        auto rate = seconds > 0.f ? (completed - _lastRateCompleted) / seconds : 0.f;
+        _lastRateTime = now;
+        _lastRateCompleted = completed;
+        return rate;
+    }
+
+private:
+    std::atomic<unsigned int> _completed{0};
+    std::array<std::atomic<unsigned int>, bucketsNumber> _buckets;
+    std::mutex _rateMutex;
+    std::chrono::steady_clock::time_point _lastRateTime;
+    unsigned int _lastRateCompleted = 0;
+};
+
+}  // namespace InferenceEngine
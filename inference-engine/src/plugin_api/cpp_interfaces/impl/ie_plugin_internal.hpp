@@ -20,6 +20,7 @@
 #include "cpp_interfaces/impl/ie_executable_network_internal.hpp"
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "cpp_interfaces/plugin_itt.hpp"
+#include "ie_load_time_breakdown.hpp"
 
 
 using namespace InferenceEngine;
@@ -65,6 +66,8 @@ public:
 
     ExecutableNetwork LoadNetwork(const ICNNNetwork& network, const std::map<std::string, std::string>& config,
                                   RemoteContext::Ptr context) override {
+        // reuses a breakdown activated by Core or by a plugin which loads a subnetwork to this one
+        LoadTimeBreakdownActivation loadTimeBreakdown;
         InputsDataMap networkInputs, networkInputsCloned;
         OutputsDataMap networkOutputs, networkOutputsCloned;
         network.getInputsInfo(networkInputs);
@@ -81,6 +84,7 @@ public:
         impl->setNetworkInputs(networkInputsCloned);
         impl->setNetworkOutputs(networkOutputsCloned);
         impl->SetPointerToPlugin(shared_from_this());
+        impl->SetLoadTimeBreakdown(loadTimeBreakdown.Get());
 
         auto executableNetwork = make_executable_network(impl);
         return ExecutableNetwork(executableNetwork);
@@ -106,6 +106,12 @@ public:
      * @return A reference to a context
      */
     virtual RemoteContext::Ptr GetContext() const = 0;
+
+    /**
+     * @brief Starts inference of several requests in asynchronous mode
+     * @param requests Requests to start
+     */
+    virtual void StartAsyncBatch(const std::vector<IInferRequest::Ptr>& requests) = 0;
 };
 
 }  // namespace InferenceEngine
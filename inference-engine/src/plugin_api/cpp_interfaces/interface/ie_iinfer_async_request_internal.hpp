@@ -66,6 +66,20 @@ public:
      * @param callback - function to be called with the following description:
      */
     virtual void SetCompletionCallback(IInferRequest::CompletionCallback callback) = 0;
+
+    /**
+     * @brief Set callback function which will be called on success or failure of asynchronous request by the thread
+     * that completes the request
+     * @param callback - function to be called, it must not block
+     */
+    virtual void SetImmediateCompletionCallback(IInferRequest::CompletionCallback callback) = 0;
+
+    /**
+     * @brief Set a scheduling priority and a deadline of the following asynchronous inferences
+     * @param priority A priority of the request, 0 is the default one
+     * @param deadlineMs A deadline in milliseconds since the start of inference, 0 means no deadline
+     */
+    virtual void SetPriority(int priority, int64_t deadlineMs) = 0;
 };
 
 }  // namespace InferenceEngine
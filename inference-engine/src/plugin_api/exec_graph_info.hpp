@@ -51,6 +51,44 @@ static const char OUTPUT_PRECISIONS[] = "outputPrecisions";
  */
 static const char PERF_COUNTER[] = "execTimeMcs";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of CPU cycles spent by all threads of the process
+ *        during execution of the primitive. Filled only if hardware performance counters are enabled.
+ */
+static const char PERF_CYCLES[] = "execCycles";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of instructions retired during execution of the primitive.
+ *        Filled only if hardware performance counters are enabled.
+ */
+static const char PERF_INSTRUCTIONS[] = "execInstructions";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an average number of last level cache misses during execution of the primitive.
+ *        Multiplied by a cache line size and divided by execution time it estimates used memory bandwidth.
+ *        Filled only if hardware performance counters are enabled.
+ */
+static const char PERF_LLC_MISSES[] = "execLLCMisses";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an estimated number of arithmetic operations done by one execution of the primitive,
+ *        fused operations included. Together with ExecGraphInfoSerialization::PERF_COUNTER it gives achieved
+ *        FLOP/s of the primitive.
+ */
+static const char ESTIMATED_FLOPS[] = "estimatedFlops";
+
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get an estimated number of bytes moved by one execution of the primitive, that is
+ *        a size of its inputs, outputs and weights. Divided into ExecGraphInfoSerialization::ESTIMATED_FLOPS
+ *        it gives arithmetic intensity of the primitive.
+ */
+static const char ESTIMATED_BYTES[] = "estimatedBytes";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief Used to get output layouts of primitive.
@@ -84,6 +122,11 @@ static const char RUNTIME_PRECISION[] = "runtimePrecision";
  * - ExecGraphInfoSerialization::IMPL_TYPE
  * - ExecGraphInfoSerialization::OUTPUT_PRECISIONS
  * - ExecGraphInfoSerialization::PERF_COUNTER
+ * - ExecGraphInfoSerialization::PERF_CYCLES
+ * - ExecGraphInfoSerialization::PERF_INSTRUCTIONS
+ * - ExecGraphInfoSerialization::PERF_LLC_MISSES
+ * - ExecGraphInfoSerialization::ESTIMATED_FLOPS
+ * - ExecGraphInfoSerialization::ESTIMATED_BYTES
  * - ExecGraphInfoSerialization::OUTPUT_LAYOUTS
  * - ExecGraphInfoSerialization::EXECUTION_ORDER
  * - ExecGraphInfoSerialization::LAYER_TYPE
@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file with a huge page backed allocator
+ * @file ie_huge_page_allocator.hpp
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Creates an allocator which backs large allocations by huge pages to reduce TLB misses.
+ *
+ * Allocations of at least 2 MB are placed to explicitly reserved huge pages (1 GB pages are tried for allocations
+ * of at least 1 GB), otherwise to memory advised for transparent huge pages. Smaller allocations and platforms
+ * without huge pages fall back to regular memory, so allocation fails only if the system is out of memory.
+ *
+ * @ingroup ie_dev_api_memory
+ * @return A thread safe allocator
+ */
+INFERENCE_ENGINE_API_CPP(std::shared_ptr<IAllocator>) CreateHugePageAllocator();
+
+}  // namespace InferenceEngine
@@ -100,6 +100,14 @@ public:
      */
     virtual Parameter GetMetric(const std::string& deviceName, const std::string& name) const = 0;
 
+    /**
+     * @brief Returns devices available for neural networks inference
+     *
+     * @return A vector of devices. The devices are returned as { CPU, FPGA.0, FPGA.1, MYRIAD }
+     * If there more than one device of specific type, they are enumerated with .# suffix.
+     */
+    virtual std::vector<std::string> GetAvailableDevices() const = 0;
+
     /**
      * @brief Default virtual destructor
      */
@@ -0,0 +1,181 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines API to measure time spent by LoadNetwork in its phases
+ * @file ie_load_time_breakdown.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @defgroup ie_dev_api_load_time Load time breakdown API
+ * @ingroup ie_dev_api
+ * @brief A breakdown is activated for the thread calling LoadNetwork, phases are measured by LoadTimeScope objects
+ *        and the result is returned by METRIC_KEY(LOAD_TIME_BREAKDOWN) of the executable network.
+ */
+
+/**
+ * @brief Names of LoadNetwork phases
+ * @ingroup ie_dev_api_load_time
+ */
+namespace LoadTimePhase {
+static constexpr char Cloning[] = "Cloning";  //!< Cloning of the network passed to LoadNetwork
+static constexpr char Transformations[] = "Transformations";  //!< nGraph and legacy graph transformations
+static constexpr char LegacyConversion[] = "LegacyConversion";  //!< Conversion of nGraph function to CNNNetwork
+static constexpr char LowPrecisionTransformations[] = "LPT";  //!< Low precision transformations
+static constexpr char GraphInit[] = "GraphInit";  //!< Creation of a plugin graph and selection of implementations
+static constexpr char WeightsRepacking[] = "WeightsRepacking";  //!< Conversion of weights to plugin layouts
+static constexpr char KernelCompilation[] = "KernelCompilation";  //!< Compilation of kernels or a device blob
+static constexpr char MemoryAllocation[] = "MemoryAllocation";  //!< Allocation of intermediate buffers
+static constexpr char CacheExport[] = "CacheExport";  //!< Export of the compiled network to the cache directory
+static constexpr char Other[] = "Other";  //!< Time of LoadNetwork not covered by other phases
+static constexpr char Total[] = "Total";  //!< Total time of LoadNetwork
+}  // namespace LoadTimePhase
+
+/**
+ * @brief Accumulates time spent by LoadNetwork in its phases
+ * @ingroup ie_dev_api_load_time
+ */
+class INFERENCE_ENGINE_API_CLASS(LoadTimeBreakdown) {
+public:
+    /**
+     * @brief A shared pointer to LoadTimeBreakdown object
+     */
+    using Ptr = std::shared_ptr<LoadTimeBreakdown>;
+
+    /**
+     * @brief A callback called by LoadTimeScope with a name of a phase before the phase starts
+     */
+    using PhaseCallback = std::function<void(const char* phase)>;
+
+    /**
+     * @brief Adds time to a phase, could be called from several threads
+     * @param phase A phase name
+     * @param time Time spent in the phase
+     */
+    void Add(const std::string& phase, std::chrono::nanoseconds time);
+
+    /**
+     * @brief Returns time of phases in milliseconds. Phases executed in parallel are summed over threads,
+     *        LoadTimePhase::Other is the rest of LoadTimePhase::Total not covered by other phases.
+     * @return A map from a phase name to its time
+     */
+    std::map<std::string, float> Get() const;
+
+    /**
+     * @brief Returns a breakdown activated for the calling thread
+     * @return A breakdown or `nullptr` if there is no active one
+     */
+    static Ptr GetActive() noexcept;
+
+    /**
+     * @brief Sets a callback notified about started phases. An exception thrown by the callback is propagated from the
+     *        LoadTimeScope constructor, so it is used to abort LoadNetwork between phases.
+     * @param callback A callback called from threads which activated the breakdown
+     */
+    void SetPhaseCallback(PhaseCallback callback);
+
+private:
+    friend class LoadTimeScope;
+
+    friend class LoadTimeBreakdownActivation;
+
+    mutable std::mutex _mutex;
+    std::map<std::string, std::chrono::nanoseconds> _phases;
+    PhaseCallback _phaseCallback;
+};
+
+/**
+ * @brief Activates a breakdown for the calling thread from construction till destruction of the object
+ * @ingroup ie_dev_api_load_time
+ */
+class INFERENCE_ENGINE_API_CLASS(LoadTimeBreakdownActivation) {
+public:
+    /**
+     * @brief Keeps an already active breakdown or creates a new one which measures LoadTimePhase::Total
+     */
+    LoadTimeBreakdownActivation();
+
+    /**
+     * @brief Activates a given breakdown, used to measure phases executed by other threads
+     * @param breakdown A breakdown to activate
+     */
+    explicit LoadTimeBreakdownActivation(const LoadTimeBreakdown::Ptr& breakdown);
+
+    /**
+     * @brief Restores a previously active breakdown
+     */
+    ~LoadTimeBreakdownActivation();
+
+    LoadTimeBreakdownActivation(const LoadTimeBreakdownActivation&) = delete;
+    LoadTimeBreakdownActivation& operator=(const LoadTimeBreakdownActivation&) = delete;
+
+    /**
+     * @brief Returns the active breakdown
+     * @return A breakdown
+     */
+    const LoadTimeBreakdown::Ptr& Get() const noexcept {
+        return _breakdown;
+    }
+
+private:
+    LoadTimeBreakdown::Ptr _previous;
+    LoadTimeBreakdown::Ptr _breakdown;
+    bool _measuresTotal = false;
+    std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * @brief Measures a phase from construction till destruction of the object if a breakdown is active.
+ *        Nested scopes are exclusive: an outer phase is paused while an inner one is measured.
+ * @ingroup ie_dev_api_load_time
+ */
+class INFERENCE_ENGINE_API_CLASS(LoadTimeScope) {
+public:
+    /**
+     * @brief Starts measuring a phase
+     * @param phase A phase name, must outlive the object
+     * @throws An exception thrown by a callback set via LoadTimeBreakdown::SetPhaseCallback
+     */
+    explicit LoadTimeScope(const char* phase);
+
+    /**
+     * @brief Finishes measuring a phase
+     */
+    ~LoadTimeScope();
+
+    LoadTimeScope(const LoadTimeScope&) = delete;
+    LoadTimeScope& operator=(const LoadTimeScope&) = delete;
+
+private:
+    const char* _phase;
+    LoadTimeBreakdown::Ptr _breakdown;
+    LoadTimeScope* _parent = nullptr;
+    std::chrono::steady_clock::time_point _start;
+};
+
+/**
+ * @brief Runs independent loading tasks, for example LoadNetwork calls for several devices, in separate threads.
+ *        Every thread measures its phases with the breakdown active in the calling thread, so phase callbacks
+ *        and cancellation apply to all of them.
+ * @ingroup ie_dev_api_load_time
+ * @param tasks Tasks to run, a single task is run in the calling thread
+ * @throws The exception of the first failed task, thrown after all tasks are finished
+ */
+INFERENCE_ENGINE_API_CPP(void) RunLoadTasksInParallel(const std::vector<std::function<void()>>& tasks);
+
+}  // namespace InferenceEngine
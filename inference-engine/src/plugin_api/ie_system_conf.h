@@ -44,6 +44,39 @@ INFERENCE_ENGINE_API_CPP(std::vector<int>) getAvailableNUMANodes();
  */
 INFERENCE_ENGINE_API_CPP(int) getNumberOfCPUCores();
 
+/**
+ * @brief      Returns number of logical processors the process may run on. On Linux it is the affinity mask
+ *             (which also reflects a cpuset of the container) limited by the CFS quota of the cgroup
+ *             (on other OSes it is the number of hardware threads)
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Number of available logical processors, at least one
+ */
+INFERENCE_ENGINE_API_CPP(int) getNumberOfAvailableProcessors();
+
+/**
+ * @brief      Returns logical processors of the NUMA node (on Linux, on other OSes the vector is empty)
+ * @ingroup    ie_dev_api_system_conf
+ * @param[in]  numaNode  The NUMA node as returned by getAvailableNUMANodes()
+ * @return     Logical processor indices, empty if the node is unknown
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) getNUMANodeProcessors(int numaNode);
+
+/**
+ * @brief      Returns logical processors of big (performance) cores of hybrid CPUs, one processor per physical core
+ *             (on Linux and Windows, on other OSes and on CPUs with a single core type the vector is empty)
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Logical processor indices, the number of elements is the number of big physical cores
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) getBigCoreProcessors();
+
+/**
+ * @brief      Returns logical processors of little (efficient) cores of hybrid CPUs, one processor per physical core
+ *             (on Linux and Windows, on other OSes and on CPUs with a single core type the vector is empty)
+ * @ingroup    ie_dev_api_system_conf
+ * @return     Logical processor indices, the number of elements is the number of little physical cores
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<int>) getLittleCoreProcessors();
+
 /**
  * @brief      Checks whether CPU supports SSE 4.2 capability
  * @ingroup    ie_dev_api_system_conf
@@ -79,6 +112,13 @@ INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512f();
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core();
 
+/**
+ * @brief      Checks whether CPU supports AVX-512 VNNI capability
+ * @ingroup    ie_dev_api_system_conf
+ * @return     `True` is tAVX512_VNNI instructions are available, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core_vnni();
+
 /**
  * @brief      Checks whether CPU supports BFloat16 capability
  * @ingroup    ie_dev_api_system_conf
@@ -86,4 +126,18 @@ INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core();
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_bfloat16();
 
+/**
+ * @brief      Checks whether CPU supports AMX INT8 capability
+ * @ingroup    ie_dev_api_system_conf
+ * @return     `True` is AMX-TILE and AMX-INT8 instructions and tile state are available, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core_amx_int8();
+
+/**
+ * @brief      Checks whether CPU supports AMX BFloat16 capability
+ * @ingroup    ie_dev_api_system_conf
+ * @return     `True` is AMX-TILE and AMX-BF16 instructions and tile state are available, `false` otherwise
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_avx512_core_amx_bf16();
+
 }  // namespace InferenceEngine
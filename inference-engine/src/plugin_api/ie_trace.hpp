@@ -0,0 +1,95 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines API to record a timeline of inference in Chrome trace format
+ * @file ie_trace.hpp
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @defgroup ie_dev_api_trace Timeline trace API
+ * @ingroup ie_dev_api
+ * @brief Events are recorded to per-thread ring buffers without locks and dumped as Chrome trace JSON,
+ *        which can be opened with chrome://tracing or https://ui.perfetto.dev. Recording is enabled by
+ *        CONFIG_KEY(TRACE_FILE) passed to Core::SetConfig().
+ */
+namespace trace {
+
+/**
+ * @brief Checks whether events are being recorded
+ * @ingroup ie_dev_api_trace
+ * @return `true` if recording is enabled
+ */
+INFERENCE_ENGINE_API_CPP(bool) enabled() noexcept;
+
+/**
+ * @brief Returns a current timestamp used by the trace
+ * @ingroup ie_dev_api_trace
+ * @return Nanoseconds since the trace clock epoch
+ */
+INFERENCE_ENGINE_API_CPP(int64_t) now() noexcept;
+
+/**
+ * @brief Records a complete event to the ring buffer of the calling thread
+ * @ingroup ie_dev_api_trace
+ * @param name An event name, it is copied and truncated to 63 characters
+ * @param category A category of the event, must be a string literal
+ * @param id An identifier of an infer request or a graph the event belongs to
+ * @param arg An additional integer argument of the event, negative values are not dumped
+ * @param start A timestamp returned by trace::now() at the beginning of the event
+ * @param finish A timestamp returned by trace::now() at the end of the event
+ */
+INFERENCE_ENGINE_API_CPP(void) record(const char* name, const char* category, const void* id, int64_t arg,
+                                      int64_t start, int64_t finish) noexcept;
+
+/**
+ * @brief Clears recorded events and starts recording
+ * @ingroup ie_dev_api_trace
+ * @param file A path to a JSON file the trace is written to by trace::stop()
+ */
+INFERENCE_ENGINE_API_CPP(void) start(const std::string& file);
+
+/**
+ * @brief Stops recording and writes recorded events to the file passed to trace::start()
+ * @ingroup ie_dev_api_trace
+ */
+INFERENCE_ENGINE_API_CPP(void) stop();
+
+/**
+ * @brief Records a complete event from construction till destruction of the object
+ * @ingroup ie_dev_api_trace
+ */
+class Scope {
+public:
+    Scope(const char* name, const char* category, const void* id, int64_t arg = -1) noexcept
+        : _name(name), _category(category), _id(id), _arg(arg), _start(enabled() ? now() : -1) {}
+
+    ~Scope() {
+        if (_start >= 0) {
+            record(_name, _category, _id, _arg, _start, now());
+        }
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    const char* _name;
+    const char* _category;
+    const void* _id;
+    int64_t _arg;
+    int64_t _start;
+};
+
+}  // namespace trace
+}  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "threading/ie_istreams_executor.hpp"
 
@@ -29,12 +30,28 @@ public:
      */
     using Ptr = std::shared_ptr<CPUStreamsExecutor>;
 
+    /**
+     * @brief Defines priority classes of tasks passed to run()
+     */
+    enum Priority : std::uint8_t {
+        LATENCY,  //!< Tasks are taken by streams before batch tasks and preempt running batch tasks
+        BATCH     //!< Default class, tasks are taken in FIFO order
+    };
+
     /**
     * @brief Constructor
     * @param config Stream executor parameters
     */
     explicit CPUStreamsExecutor(const Config& config = {});
 
+    /**
+    * @brief Constructs a view of the executor which shares its streams and queues, but passes tasks of run()
+    *        with the given priority. Streams are stopped when the executor and all its views are destroyed
+    * @param executor The executor to share
+    * @param priority Priority class of tasks passed to run() of the view
+    */
+    CPUStreamsExecutor(const CPUStreamsExecutor& executor, Priority priority);
+
     /**
      * @brief A class destructor
      */
@@ -42,15 +59,74 @@ public:
 
     void run(Task task) override;
 
+    /**
+     * @brief Passes the task to the batch class of the executor. Batch tasks with greater priority level are taken
+     *        first, then the ones with earlier deadline. Tasks of negative level are taken after tasks passed to run()
+     * @param task A task to start
+     * @param priority A scheduling priority of the task
+     */
+    void runWithPriority(Task task, const TaskPriority& priority) override;
+
+    /**
+     * @brief Enqueues all the tasks with one lock of the task queue and wakes up streams once
+     * @param tasks Tasks to start
+     * @param priorities Scheduling priorities of the tasks, one per task
+     */
+    void runBatch(std::vector<Task> tasks, const std::vector<TaskPriority>& priorities) override;
+
+    /**
+     * @brief Passes the task to the worker queue of the given stream. The stream takes it before tasks of other
+     *        streams, other streams take it only if the stream is busy or parked. Without
+     *        @ref IStreamsExecutor::Config::_workStealing or @ref IStreamsExecutor::Config::_requestStreamAffinity
+     *        and for tasks of latency class the call is the same as run()
+     * @param task A task to start
+     * @param streamId A home stream of the task, e.g. returned by AssignHomeStream()
+     */
+    void runOnStream(Task task, int streamId);
+
+    /**
+     * @brief Returns a home stream for a new client of the executor, e.g. an infer request.
+     *        Streams are assigned round-robin among the streams which take batch tasks
+     * @return A stream id, or -1 if the executor has no streams
+     */
+    int AssignHomeStream();
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Returns a number of tasks passed to run() which are not taken by stream threads yet
+     * @return A number of queued tasks
+     */
+    unsigned int GetQueuedTasksNumber() const;
+
+    /**
+     * @brief Returns a number of stream threads which are executing tasks at the moment
+     * @return A number of busy streams
+     */
+    unsigned int GetBusyStreamsNumber() const;
+
+    /**
+     * @brief Returns a number of streams which take tasks at the moment. It is less than the number of streams
+     *        if @ref IStreamsExecutor::Config::_minActiveStreams is set and the load is low
+     * @return A number of active streams
+     */
+    unsigned int GetActiveStreamsNumber() const;
+
+    /**
+     * @brief Executes latency tasks queued to the executor if it is called by a stream thread that executes
+     *        a batch task. Long batch tasks call it at safe points, e.g. between layers of a network,
+     *        so latency tasks of other networks sharing the streams don't wait for them to finish
+     */
+    static void PreemptionPoint();
+
 private:
     struct Impl;
-    std::unique_ptr<Impl> _impl;
+    std::shared_ptr<Impl> _impl;
+    Priority _priority = BATCH;
 };
 
 }  // namespace InferenceEngine
@@ -17,6 +17,7 @@
 
 #include "threading/ie_itask_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
+#include "threading/ie_cpu_streams_executor.hpp"
 
 namespace InferenceEngine {
 
@@ -29,17 +30,24 @@ public:
 
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                      CPUStreamsExecutor::Priority priority);
+
     // for tests purposes
     size_t getExecutorsNumber();
 
     // for tests purposes
     size_t getIdleCPUStreamsExecutorsNumber();
 
+    // for tests purposes
+    size_t getSharedCPUStreamsExecutorsNumber();
+
     void clear(const std::string& id = {});
 
 private:
     std::unordered_map<std::string, ITaskExecutor::Ptr> executors;
     std::vector<std::pair<IStreamsExecutor::Config, IStreamsExecutor::Ptr> > cpuStreamsExecutors;
+    std::vector<std::pair<IStreamsExecutor::Config, CPUStreamsExecutor::Ptr> > sharedCPUStreamsExecutors;
     std::mutex streamExecutorMutex;
     std::mutex taskExecutorMutex;
 };
@@ -83,6 +91,17 @@ public:
     /// @private
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config);
 
+    /**
+     * @brief Returns a view of the streams executor shared by all callers with the same configuration.
+     * Unlike getIdleCPUStreamsExecutor(), the executor is returned even if it is used, so networks loaded with
+     * the same streams configuration don't create own threads and don't oversubscribe cores
+     * @param config Streams executor configuration
+     * @param priority Priority class of tasks passed to the returned executor
+     * @return A view of the shared executor, see CPUStreamsExecutor::CPUStreamsExecutor(const CPUStreamsExecutor&, Priority)
+     */
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                      CPUStreamsExecutor::Priority priority);
+
     /**
      * @cond
      */
@@ -90,6 +109,8 @@ public:
 
     size_t getIdleCPUStreamsExecutorsNumber();
 
+    size_t getSharedCPUStreamsExecutorsNumber();
+
     void clear(const std::string& id = {});
     /**
      * @endcond
@@ -41,7 +41,8 @@ public:
     enum ThreadBindingType : std::uint8_t {
         NONE,    //!< Don't bind threads
         CORES,   //!< Bind threads to cores
-        NUMA     //!< Bind threads to NUMA nodes
+        NUMA,    //!< Bind threads to NUMA nodes
+        HYBRID_AWARE  //!< Bind streams to big or little cores of hybrid CPUs, see @ref Config::_bigCoreStreams
     };
 
     /**
@@ -70,7 +71,10 @@ public:
 
         /**
         * @brief Create appropriate multithreaded configuration
-        *        filing unconfigured values from initial configuration using hardware properties
+        *        filing unconfigured values from initial configuration using hardware properties.
+        *        With @ref HYBRID_AWARE binding a single (latency) stream is placed on big cores, and several streams are
+        *        distributed between big and little cores with different number of threads per stream.
+        *        With @ref _latencyStreams the threads left by latency streams are distributed between other streams
         * @param initial Inital configuration
         * @return configured values
         */
@@ -83,6 +87,21 @@ public:
         int                _threadBindingStep       = 1;  //!< In case of @ref CORES binding offset type thread binded to cores with defined step
         int                _threadBindingOffset     = 0;  //!< In case of @ref CORES binding offset type thread binded to cores starting from offset
         int                _threads                 = 0;  //!< Number of threads distributed between streams. Reserved. Should not be used.
+        bool               _workStealing            = false;  //!< Each stream has own task queue and idle streams steal tasks from others
+        bool               _requestStreamAffinity   = false;  //!< Each stream has own task queue, tasks passed to it by
+                                                              //!< CPUStreamsExecutor::runOnStream() are taken by other streams
+                                                              //!< only if it is busy
+        int                _bigCoreStreams          = 0;  //!< In case of @ref HYBRID_AWARE binding the number of streams placed on big cores,
+                                                          //!< the rest of streams is placed on little cores
+        int                _threadsPerStreamBig     = 0;  //!< In case of @ref HYBRID_AWARE binding number of threads per stream on big cores
+        int                _threadsPerStreamLittle  = 0;  //!< In case of @ref HYBRID_AWARE binding number of threads per stream on little cores
+        int                _latencyStreams          = 0;  //!< Number of streams out of @ref _streams which execute only latency class tasks
+                                                          //!< and tasks of positive priority level, other streams don't take such tasks
+        int                _threadsPerLatencyStream = 0;  //!< Number of threads per latency stream, if 0 it is the same as for other streams
+        int                _minActiveStreams        = 0;  //!< If positive and less than @ref _streams, streams are parked while the load is low,
+                                                          //!< but at least this number of streams takes tasks. 0 means all the streams are active
+        int                _scaleDownDelay          = 1000;  //!< In case of @ref _minActiveStreams a time in milliseconds the load should stay
+                                                             //!< below the number of active streams before they are parked
 
         /**
          * @brief      A constructor with arguments
@@ -94,6 +113,7 @@ public:
          * @param[in]  threadBindingStep    @copybrief Config::_threadBindingStep
          * @param[in]  threadBindingOffset  @copybrief Config::_threadBindingOffset
          * @param[in]  threads              @copybrief Config::_threads
+         * @param[in]  workStealing         @copybrief Config::_workStealing
          */
         Config(
             std::string        name                    = "StreamsExecutor",
@@ -102,14 +122,16 @@ public:
             ThreadBindingType  threadBindingType       = ThreadBindingType::NONE,
             int                threadBindingStep       = 1,
             int                threadBindingOffset     = 0,
-            int                threads                 = 0) :
+            int                threads                 = 0,
+            bool               workStealing            = false) :
         _name{name},
         _streams{streams},
         _threadsPerStream{threadsPerStream},
         _threadBindingType{threadBindingType},
         _threadBindingStep{threadBindingStep},
         _threadBindingOffset{threadBindingOffset},
-        _threads{threads} {
+        _threads{threads},
+        _workStealing{workStealing} {
         }
     };
 
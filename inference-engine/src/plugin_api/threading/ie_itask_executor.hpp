@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -24,6 +25,31 @@ namespace InferenceEngine {
  */
 using Task = std::function<void()>;
 
+/**
+ * @brief A scheduling priority of a task passed to ITaskExecutor::runWithPriority
+ * @ingroup ie_dev_api_threading
+ */
+struct TaskPriority {
+    /**
+     * @brief Tasks with greater level are started first, 0 is the level of tasks passed to ITaskExecutor::run
+     */
+    int level = 0;
+
+    /**
+     * @brief Among tasks of the same level the ones with earlier deadline are started first.
+     *        The deadline only orders tasks, the task is not cancelled when it is missed
+     */
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+    /**
+     * @brief Checks whether the priority is the same as the priority of tasks passed to ITaskExecutor::run
+     * @return `true` if the level is 0 and there is no deadline
+     */
+    bool isDefault() const {
+        return (0 == level) && (std::chrono::steady_clock::time_point::max() == deadline);
+    }
+};
+
 /**
 * @interface ITaskExecutor
 * @ingroup ie_dev_api_threading
@@ -61,6 +87,22 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute InferenceEngine::Task inside task executor context with the given scheduling priority.
+     *        Default implementation ignores the priority and calls run()
+     * @param task A task to start
+     * @param priority A scheduling priority of the task
+     */
+    virtual void runWithPriority(Task task, const TaskPriority& priority);
+
+    /**
+     * @brief Execute a batch of tasks inside task executor context. Executors could submit the whole batch at once,
+     *        e.g. with one lock of a task queue. Default implementation calls runWithPriority() for each task
+     * @param tasks Tasks to start
+     * @param priorities Scheduling priorities of the tasks, one per task
+     */
+    virtual void runBatch(std::vector<Task> tasks, const std::vector<TaskPriority>& priorities);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default runAndWait() method implementation uses run() pure virtual method
@@ -8,6 +8,7 @@
 
 #include <tuple>
 #include <memory>
+#include <vector>
 
 #if !(defined(__APPLE__) || defined(_WIN32))
 #include <sched.h>
@@ -54,6 +55,15 @@ using CpuSet = std::unique_ptr<cpu_set_t, ReleaseProcessMaskDeleter>;
  */
 INFERENCE_ENGINE_API_CPP(std::tuple<CpuSet, int>) GetProcessMask();
 
+/**
+ * @brief      Get the cores affinity mask for the current process restricted to the given logical processors
+ * @ingroup    ie_dev_api_threading
+ *
+ * @param[in]  processors  Logical processor indices, e.g. returned by getBigCoreProcessors()
+ * @return     A core affinity mask, `nullptr` if the mask is empty or cannot be obtained
+ */
+INFERENCE_ENGINE_API_CPP(std::tuple<CpuSet, int>) GetProcessMask(const std::vector<int>& processors);
+
 /**
  * @brief      Pins current thread to a set of cores determined by the mask
  * @ingroup    ie_dev_api_threading
@@ -78,7 +88,7 @@ INFERENCE_ENGINE_API_CPP(bool) PinThreadToVacantCore(int thrIdx, int hyperThread
 INFERENCE_ENGINE_API_CPP(bool) PinCurrentThreadByMask(int ncores, const CpuSet& processMask);
 
 /**
- * @brief      Pins a current thread to a socket.
+ * @brief      Pins a current thread to the logical processors of a socket (NUMA node) which are in the process mask.
  * @ingroup    ie_dev_api_threading
  *
  * @param[in]  socket  The socket id
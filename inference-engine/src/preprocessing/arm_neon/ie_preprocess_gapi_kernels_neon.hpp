@@ -178,6 +178,14 @@ void calculate_i420_to_rgb(const  uchar **srcY,
                                   uchar **dstRGBx,
                                     int width);
 
+void calculate_yuv_to_rgb_planes(const uchar *srcY,
+                                 const uchar *srcU,
+                                 const uchar *srcV,
+                                       uchar *dstR,
+                                       uchar *dstG,
+                                       uchar *dstB,
+                                         int length);
+
 void copyRow_8U(const uint8_t in[],
                 uint8_t out[],
                 int length);
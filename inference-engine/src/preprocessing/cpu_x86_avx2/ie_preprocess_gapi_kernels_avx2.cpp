@@ -117,6 +117,16 @@ void calculate_i420_to_rgb(const  uchar **srcY,
     calculate_i420_to_rgb_impl(srcY, srcU, srcV, dstRGBx, width);
 }
 
+void calculate_yuv_to_rgb_planes(const uchar *srcY,
+                                 const uchar *srcU,
+                                 const uchar *srcV,
+                                       uchar *dstR,
+                                       uchar *dstG,
+                                       uchar *dstB,
+                                         int length) {
+    calculate_yuv_to_rgb_planes_impl(srcY, srcU, srcV, dstR, dstG, dstB, length);
+}
+
 void calcRowArea_8U(uchar dst[], const uchar *src[], const Size& inSz,
                     const Size& outSz, Q0_16 yalpha, const MapperUnit8U &ymap,
                     int xmaxdf, const short xindex[], const Q0_16 xalpha[],
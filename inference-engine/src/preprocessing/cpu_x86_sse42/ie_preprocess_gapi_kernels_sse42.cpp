@@ -1336,6 +1336,16 @@ void calculate_i420_to_rgb(const  uchar **srcY,
     calculate_i420_to_rgb_impl(srcY, srcU, srcV, dstRGBx, width);
 }
 
+void calculate_yuv_to_rgb_planes(const uchar *srcY,
+                                 const uchar *srcU,
+                                 const uchar *srcV,
+                                       uchar *dstR,
+                                       uchar *dstG,
+                                       uchar *dstB,
+                                         int length) {
+    calculate_yuv_to_rgb_planes_impl(srcY, srcU, srcV, dstR, dstG, dstB, length);
+}
+
 void copyRow_8U(const uint8_t in[],
                  uint8_t out[],
                  int length) {
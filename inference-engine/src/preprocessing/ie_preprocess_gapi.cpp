@@ -682,9 +682,78 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     return cv::GComputation(inputs, outputs);
 }
+
+// NV12/I420 input which is downscaled with bilinear interpolation to an 8U RGB/BGR image is
+// processed by a fused kernel, which color converts only source pixels used by the interpolation
+bool isFusedYUV420ResizeApplicable(const G::Desc &in_desc_y,
+                                   const G::Desc &out_desc,
+                                   ResizeAlgorithm algorithm,
+                                   ColorFormat output_color_format) {
+    return algorithm == RESIZE_BILINEAR
+        && in_desc_y.prec == CV_8U && out_desc.prec == CV_8U
+        && out_desc.d.C == 3
+        && (output_color_format == ColorFormat::RGB || output_color_format == ColorFormat::BGR)
+        // every output pixel needs two source columns, so it pays off only if it is less
+        // than the whole source row
+        && 2 * out_desc.d.W <= in_desc_y.d.W
+        && out_desc.d.H <= in_desc_y.d.H;
+}
+
+void executeFusedYUV420Resize(const std::vector<cv::gapi::own::Mat>& input_plane_mats,
+                              std::vector<cv::gapi::own::Mat>& output_plane_mats,
+                              ColorFormat input_color_format,
+                              ColorFormat output_color_format,
+                              int thread_num) {
+    const auto& y = input_plane_mats[0];
+    const uint8_t *u = nullptr, *v = nullptr;
+    size_t u_step = 0, v_step = 0;
+    int uv_pixel_step = 1;
+    if (input_color_format == ColorFormat::NV12) {
+        // interleaved UV plane
+        u = input_plane_mats[1].data;
+        v = input_plane_mats[1].data + 1;
+        u_step = v_step = input_plane_mats[1].step;
+        uv_pixel_step = 2;
+    } else {
+        u = input_plane_mats[1].data;
+        v = input_plane_mats[2].data;
+        u_step = input_plane_mats[1].step;
+        v_step = input_plane_mats[2].step;
+    }
+
+    uint8_t* dst[3] = {};
+    size_t dst_step = output_plane_mats[0].step;
+    int dst_pixel_step = 1;
+    if (output_plane_mats.size() == 1) {
+        // NHWC output
+        for (int c = 0; c < 3; ++c) {
+            dst[c] = output_plane_mats[0].data + c;
+        }
+        dst_pixel_step = 3;
+    } else {
+        for (int c = 0; c < 3; ++c) {
+            dst[c] = output_plane_mats[c].data;
+        }
+    }
+    if (output_color_format == ColorFormat::BGR) {
+        std::swap(dst[0], dst[2]);
+    }
+
+    const auto in_size  = cv::gapi::own::Size(y.cols, y.rows);
+    const auto out_size = cv::gapi::own::Size(output_plane_mats[0].cols, output_plane_mats[0].rows);
+    parallel_nt_static(thread_num, [&](int slice_n, const int total_slices) {
+        const int rows_per_slice = (out_size.height + total_slices - 1) / total_slices;
+        const int row_begin = slice_n * rows_per_slice;
+        const int row_end = std::min(out_size.height, row_begin + rows_per_slice);
+        if (row_begin >= row_end) return;  // no job for current thread
+
+        gapi::calcYUV420toRGBResize(y.data, y.step, u, u_step, v, v_step, uv_pixel_step, in_size,
+                                    dst, dst_step, dst_pixel_step, out_size, row_begin, row_end);
+    });
+}
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+PreprocEngine::PreprocEngine() = default;
 
 PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
     // Given our knowledge about Fluid, full graph rebuild is required
@@ -695,14 +764,14 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
+    if (_compiledGraphs.empty()) {
         return Update::REBUILD;
     }
 
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    std::tie(last_in, last_out, last_algo) = _compiledGraphs.front().call;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
@@ -757,6 +826,29 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     return Update::NOTHING;
 }
 
+std::vector<cv::GCompiled>& PreprocEngine::findCompiledGraph(const CallDesc &newCall, Update &update) {
+    auto cached = std::find_if(_compiledGraphs.begin(), _compiledGraphs.end(),
+                               [&](const CompiledGraph& graph) { return graph.call == newCall; });
+    if (cached != _compiledGraphs.end()) {
+        _compiledGraphs.splice(_compiledGraphs.begin(), _compiledGraphs, cached);
+        update = Update::NOTHING;
+        return _compiledGraphs.front().slices;
+    }
+
+    // the most recently used graph is reshaped in place if possible, so the cache is not flooded
+    // by graphs which differ in input size only (e.g. ROIs of different sizes)
+    update = needUpdate(newCall);
+    if (Update::RESHAPE == update) {
+        _compiledGraphs.front().call = newCall;
+    } else {
+        _compiledGraphs.push_front(CompiledGraph{newCall, std::vector<cv::GCompiled>(parallel_get_max_threads())});
+        if (_compiledGraphs.size() > maxCompiledGraphs) {
+            _compiledGraphs.pop_back();
+        }
+    }
+    return _compiledGraphs.front().slices;
+}
+
 bool PreprocEngine::useGAPI() {
     static const bool NO_GAPI = [](const char *str) -> bool {
         std::string var(str ? str : "");
@@ -822,19 +914,25 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
+int PreprocEngine::threadsNumber(bool omp_serial) {
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+#if IE_THREAD == IE_THREAD_OMP
+    if (omp_serial) {
+        return 1;   // disable threading for OpenMP if was asked for
+    }
+#endif
+    return 0;       // use all available threads
+}
+
 void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+    std::vector<cv::GCompiled>& compiledSlices,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
 
-    const int thread_num =
-#if IE_THREAD == IE_THREAD_OMP
-        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
-#endif
-        0;                  // use all available threads
-
-    // to suppress unused warnings
-    (void)(omp_serial);
+    const int thread_num = threadsNumber(omp_serial);
 
     // Split the whole graph into `total_slices` slices, where
     // `total_slices` is provided by the parallel runtime and assumed
@@ -845,7 +943,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
+        auto& compiled = compiledSlices[slice_n];
         if (Update::REBUILD == update || Update::RESHAPE == update) {
             //  need to compile (or reshape) own object for a particular ROI
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
@@ -888,6 +986,8 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             }
         }
 
+        if (!compiled) return;  // no job for current thread
+
         for (int i = 0; i < batch_size; ++i) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
@@ -940,6 +1040,17 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                             << batch_size << " > " << out_desc.d.N << " (expected by network)";
     }
 
+    const bool yuv420_input = (in_fmt == ColorFormat::NV12 || in_fmt == ColorFormat::I420);
+    if (yuv420_input && isFusedYUV420ResizeApplicable(in_desc, out_desc, algorithm, out_fmt)) {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_graph);
+        // batch size is always 1 for compound blobs
+        auto input_plane_mats  = bind_to_blob(inBlob,  1);
+        auto output_plane_mats = bind_to_blob(outBlob, 1);
+        executeFusedYUV420Resize(input_plane_mats[0], output_plane_mats[0], in_fmt, out_fmt,
+                                 threadsNumber(omp_serial));
+        return true;
+    }
+
     CallDesc thisCall = CallDesc{ BlobDesc{ in_desc_ie.getPrecision(),
                                             in_layout,
                                             in_desc_ie.getDims(),
@@ -949,32 +1060,29 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_desc_ie.getDims(),
                                             out_fmt },
                                   algorithm };
-    const Update update = needUpdate(thisCall);
+    Update update = Update::NOTHING;
+    auto& compiledSlices = findCompiledGraph(thisCall, update);
 
     Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
-            auto custom_desc = getGDesc(in_desc, inBlob);
-            _lastComputation = cv::util::make_optional(
-                buildGraph(custom_desc,
-                           out_desc,
-                           in_layout,
-                           out_layout,
-                           algorithm,
-                           in_fmt,
-                           out_fmt));
-        }
+    if (Update::REBUILD == update) {
+        //  rebuild the graph
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+        // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
+        auto custom_desc = getGDesc(in_desc, inBlob);
+        _lastComputation = cv::util::make_optional(
+            buildGraph(custom_desc,
+                       out_desc,
+                       in_layout,
+                       out_layout,
+                       algorithm,
+                       in_fmt,
+                       out_fmt));
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+    executeGraph(_lastComputation, compiledSlices, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 
     return true;
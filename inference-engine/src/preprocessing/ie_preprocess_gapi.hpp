@@ -8,6 +8,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <list>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -26,8 +27,14 @@ class PreprocEngine {
     using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // Compiled graphs are kept per call descriptor, so requests alternating between a few
+    // descriptors (e.g. different color formats or output sizes) do not recompile the graph
+    struct CompiledGraph {
+        CallDesc call;
+        std::vector<cv::GCompiled> slices;  // one object per thread, each computes own ROI
+    };
+    static constexpr std::size_t maxCompiledGraphs = 4;
+    std::list<CompiledGraph> _compiledGraphs;  // the most recently used graph goes first
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -36,8 +43,12 @@ class PreprocEngine {
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
+    std::vector<cv::GCompiled>& findCompiledGraph(const CallDesc &newCall, Update &update);
+
+    static int threadsNumber(bool omp_serial);
 
     void executeGraph(Opt<cv::GComputation>& lastComputation,
+                      std::vector<cv::GCompiled>& compiledSlices,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
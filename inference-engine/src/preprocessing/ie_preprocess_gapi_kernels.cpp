@@ -2329,6 +2329,50 @@ GAPI_FLUID_KERNEL(FI420toRGB, I420toRGB, false) {
     }
 };
 
+static void calculate_yuv_to_rgb_planes_fallback(const uchar *srcY, const uchar *srcU,
+                                                 const uchar *srcV, uchar *dstR, uchar *dstG,
+                                                 uchar *dstB, int length) {
+    for (int i = 0; i < length; i++) {
+        int ruv, guv, buv;
+        uvToRGBuv(srcU[i], srcV[i], ruv, guv, buv);
+        yRGBuvToRGB(srcY[i], ruv, guv, buv, dstR[i], dstG[i], dstB[i]);
+    }
+}
+
+static void yuvToRGBPlanes(const uchar *srcY, const uchar *srcU, const uchar *srcV,
+                           uchar *dstR, uchar *dstG, uchar *dstB, int length) {
+    // AVX512 implementation of wide universal intrinsics is slower than AVX2.
+    // It is turned off until the cause isn't found out.
+    #if 0
+    #ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512_core()) {
+            avx512::calculate_yuv_to_rgb_planes(srcY, srcU, srcV, dstR, dstG, dstB, length);
+            return;
+        }
+    #endif  // HAVE_AVX512
+    #endif
+
+    #ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            avx::calculate_yuv_to_rgb_planes(srcY, srcU, srcV, dstR, dstG, dstB, length);
+            return;
+        }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+        if (with_cpu_x86_sse42()) {
+            calculate_yuv_to_rgb_planes(srcY, srcU, srcV, dstR, dstG, dstB, length);
+            return;
+        }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+        neon::calculate_yuv_to_rgb_planes(srcY, srcU, srcV, dstR, dstG, dstB, length);
+        return;
+    #endif  // HAVE_NEON
+
+    calculate_yuv_to_rgb_planes_fallback(srcY, srcU, srcV, dstR, dstG, dstB, length);
+}
+
 namespace {
     template <typename src_t, typename dst_t>
     void convert_precision(const uint8_t* src, uint8_t* dst, const int width) {
@@ -2410,5 +2454,105 @@ cv::gapi::GKernelPackage preprocKernels() {
         >();
 }
 
+void calcYUV420toRGBResize(const uint8_t* srcY, size_t srcYStep,
+                           const uint8_t* srcU, size_t srcUStep,
+                           const uint8_t* srcV, size_t srcVStep,
+                           int uvPixelStep, const Size& inSz,
+                           uint8_t* const dst[3], size_t dstStep, int dstPixelStep,
+                           const Size& outSz, int outRowBegin, int outRowEnd) {
+    // the same fixed point arithmetic as cv::resize uses for 8U bilinear interpolation
+    constexpr int coefBits  = 11;
+    constexpr int coefScale = 1 << coefBits;
+
+    const int outWidth = outSz.width;
+    const int taps     = 2 * outWidth;
+    const double ratioX = static_cast<double>(inSz.width)  / outSz.width;
+    const double ratioY = static_cast<double>(inSz.height) / outSz.height;
+
+    // two source columns and their weights per output column
+    std::vector<int>   xindex(taps);
+    std::vector<short> xalpha(taps);
+    for (int x = 0; x < outWidth; x++) {
+        float fx = static_cast<float>((x + 0.5) * ratioX - 0.5);
+        int sx = static_cast<int>(std::floor(fx));
+        fx -= sx;
+        if (sx < 0) {
+            fx = 0.f;
+            sx = 0;
+        }
+        if (sx >= inSz.width - 1) {
+            fx = 0.f;
+            sx = inSz.width - 1;
+        }
+        xindex[2*x]     = sx;
+        xindex[2*x + 1] = std::min(sx + 1, inSz.width - 1);
+        xalpha[2*x]     = saturate_cast<short>((1.f - fx) * coefScale);
+        xalpha[2*x + 1] = static_cast<short>(coefScale - xalpha[2*x]);
+    }
+
+    // gathered YUV samples and their RGB values for one source row
+    std::vector<uint8_t> samples(6 * taps);
+    uint8_t* y = samples.data();
+    uint8_t* u = y + taps;
+    uint8_t* v = u + taps;
+    uint8_t* rgb[3] = {v + taps, v + 2 * taps, v + 3 * taps};
+
+    // horizontally interpolated rows, the last two are kept as consecutive output rows
+    // usually share source rows
+    std::vector<int> rows(2 * 3 * outWidth);
+    int rowIndex[2] = {-1, -1};
+
+    auto interpolateRow = [&](int sy, int keep) -> const int* {
+        for (int slot = 0; slot < 2; slot++) {
+            if (rowIndex[slot] == sy) {
+                return &rows[slot * 3 * outWidth];
+            }
+        }
+        const int slot = (rowIndex[0] == keep) ? 1 : 0;
+        rowIndex[slot] = sy;
+
+        const uint8_t* rowY = srcY + sy * srcYStep;
+        const uint8_t* rowU = srcU + (sy / 2) * srcUStep;
+        const uint8_t* rowV = srcV + (sy / 2) * srcVStep;
+        for (int i = 0; i < taps; i++) {
+            const int sx = xindex[i];
+            y[i] = rowY[sx];
+            u[i] = rowU[(sx / 2) * uvPixelStep];
+            v[i] = rowV[(sx / 2) * uvPixelStep];
+        }
+        kernels::yuvToRGBPlanes(y, u, v, rgb[0], rgb[1], rgb[2], taps);
+
+        int* row = &rows[slot * 3 * outWidth];
+        for (int c = 0; c < 3; c++) {
+            for (int x = 0; x < outWidth; x++) {
+                row[c * outWidth + x] = rgb[c][2*x] * xalpha[2*x] + rgb[c][2*x + 1] * xalpha[2*x + 1];
+            }
+        }
+        return row;
+    };
+
+    for (int outY = outRowBegin; outY < outRowEnd; outY++) {
+        float fy = static_cast<float>((outY + 0.5) * ratioY - 0.5);
+        const int sy = static_cast<int>(std::floor(fy));
+        fy -= sy;
+        const int sy0 = std::min(std::max(sy,     0), inSz.height - 1);
+        const int sy1 = std::min(std::max(sy + 1, 0), inSz.height - 1);
+        const int beta0 = saturate_cast<short>((1.f - fy) * coefScale);
+        const int beta1 = coefScale - beta0;
+
+        const int* row0 = interpolateRow(sy0, sy1);
+        const int* row1 = interpolateRow(sy1, sy0);
+        for (int c = 0; c < 3; c++) {
+            uint8_t* out = dst[c] + outY * dstStep;
+            const int* s0 = row0 + c * outWidth;
+            const int* s1 = row1 + c * outWidth;
+            for (int x = 0; x < outWidth; x++) {
+                out[x * dstPixelStep] = saturate_cast<uint8_t>(
+                    (s0[x] * beta0 + s1[x] * beta1 + (1 << (2 * coefBits - 1))) >> (2 * coefBits));
+            }
+        }
+    }
+}
+
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -156,5 +156,20 @@ namespace gapi {
 
     cv::gapi::GKernelPackage preprocKernels();
 
+    /**
+     * Fused NV12 / I420 -> RGB color conversion and bilinear resize of 8U images. Unlike
+     * NV12toRGB / I420toRGB followed by ScalePlanes, only source pixels which are used by the
+     * interpolation are converted, so downscaling does not convert the whole input image.
+     * Computes output rows [outRowBegin, outRowEnd) of R, G and B planes, which can also point
+     * to channels of the same interleaved image if dstPixelStep is 3.
+     * U and V samples are read with uvPixelStep, i.e. 2 for the interleaved UV plane of NV12.
+     */
+    void calcYUV420toRGBResize(const uint8_t* srcY, size_t srcYStep,
+                               const uint8_t* srcU, size_t srcUStep,
+                               const uint8_t* srcV, size_t srcVStep,
+                               int uvPixelStep, const Size& inSz,
+                               uint8_t* const dst[3], size_t dstStep, int dstPixelStep,
+                               const Size& outSz, int outRowBegin, int outRowEnd);
+
 }  // namespace gapi
 }  // namespace InferenceEngine
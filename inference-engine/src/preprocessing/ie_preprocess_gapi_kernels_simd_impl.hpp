@@ -602,6 +602,43 @@ inline void calculate_i420_to_rgb_impl(const  uchar **srcY, const  uchar *srcU,
     }
 }
 
+// converts pixels with one-to-one Y, U and V samples, e.g. gathered by a fused resize
+inline void calculate_yuv_to_rgb_planes_impl(const uchar *srcY, const uchar *srcU,
+                                             const uchar *srcV, uchar *dstR, uchar *dstG,
+                                             uchar *dstB, int length) {
+    int i = 0;
+
+#if MANUAL_SIMD
+
+    const int nlanes = v_uint8::nlanes;
+
+    for ( ; i <= length - nlanes; i += nlanes) {
+        v_uint8 vy = vx_load(srcY + i);
+        v_uint8 u = vx_load(srcU + i);
+        v_uint8 v = vx_load(srcV + i);
+
+        v_int32 ruv[4], guv[4], buv[4];
+        uvToRGBuv(u, v, ruv, guv, buv);
+
+        v_uint8 r, g, b;
+        yRGBuvToRGB(vy, ruv, guv, buv, r, g, b);
+
+        v_store(dstR + i, r);
+        v_store(dstG + i, g);
+        v_store(dstB + i, b);
+    }
+
+    vx_cleanup();
+
+#endif
+
+    for (; i < length; i++) {
+        int ruv, guv, buv;
+        uvToRGBuv(srcU[i], srcV[i], ruv, guv, buv);
+        yRGBuvToRGB(srcY[i], ruv, guv, buv, dstR[i], dstG[i], dstB[i]);
+    }
+}
+
 //------------------------------------------------------------------------------
 
 // vertical pass
@@ -6,6 +6,7 @@
 #include "ie_ir_itt.hpp"
 
 #include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 #include <algorithm>
 #include <deque>
@@ -24,6 +25,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset5.hpp>
 #include <ngraph/variant.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 
 #include <cpp/ie_cnn_network.h>
 #include "ie_blob_stream.hpp"
@@ -90,29 +92,36 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const
         pugi::xml_node xml;
         GenericLayerParams params;
     };
-    std::map<size_t, node_params> params;
+    // Layer and edge counts are known upfront, so hash tables below are sized once
+    // and do not rehash on large IRs
+    const auto layersNode = root.child("layers");
+    const auto edgesNode = root.child("edges");
+    const auto layersCount = static_cast<size_t>(std::distance(layersNode.children("layer").begin(),
+                                                               layersNode.children("layer").end()));
+
+    std::unordered_map<size_t, node_params> params(layersCount);
 
     std::vector<size_t> outputs;
-    std::unordered_set<std::string> opName;
+    std::unordered_set<std::string> opName(layersCount);
 
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD(node, root.child("layers"), "layer") {
+    FOREACH_CHILD(node, layersNode, "layer") {
         auto node_param = parseGenericParams(node);
-        if (opName.find(node_param.name) != opName.end())
+        if (!opName.insert(node_param.name).second)
             THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
-        opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        const auto layerId = node_param.layerId;
+        params[layerId] = {node, std::move(node_param)};
     }
 
     using edge = struct { size_t fromLayerId, fromPortId, toPortId; };
-    std::map<size_t, std::vector<edge>> edges;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    std::unordered_map<size_t, std::vector<edge>> edges(layersCount);
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node(layersCount);
 
     // Read all edges and store them for further usage
-    FOREACH_CHILD(_ec, root.child("edges"), "edge") {
+    FOREACH_CHILD(_ec, edgesNode, "edge") {
         size_t fromLayer = GetUIntAttr(_ec, "from-layer");
         size_t fromPort = GetUIntAttr(_ec, "from-port");
         size_t toLayer = GetUIntAttr(_ec, "to-layer");
@@ -120,18 +129,29 @@ std::shared_ptr<ICNNNetwork> V10Parser::parse(const pugi::xml_node& root, const
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::set<size_t> used;
+    // Run DFS starting from outputs to get nodes topological order.
+    // Explicit stack is used since long layer chains overflow the call stack with recursion
+    std::unordered_set<size_t> used(layersCount);
     std::vector<size_t> order;
-    std::function<void(size_t)> dfs = [&edges, &order, &used, &dfs](const size_t id) {
-        if (used.count(id)) return;
-        used.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+    order.reserve(layersCount);
+    std::vector<std::pair<size_t, size_t>> stack;  // layer id and index of next input edge to visit
+    for (const auto output : outputs) {
+        if (!used.insert(output).second) continue;
+        stack.emplace_back(output, 0);
+        while (!stack.empty()) {
+            const auto id = stack.back().first;
+            const auto& inEdges = edges[id];
+            auto& nextEdge = stack.back().second;
+            if (nextEdge < inEdges.size()) {
+                const auto from = inEdges[nextEdge++].fromLayerId;
+                if (used.insert(from).second)
+                    stack.emplace_back(from, 0);
+            } else {
+                order.push_back(id);
+                stack.pop_back();
+            }
         }
-        order.push_back(id);
-    };
-    std::for_each(outputs.begin(), outputs.end(), dfs);
+    }
 
     OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphNodes");
 
@@ -387,17 +407,13 @@ V10Parser::GenericLayerParams V10Parser::parseGenericParams(const pugi::xml_node
     return params;
 }
 
-bool V10Parser::LayerBaseCreator::shouldCreate(const std::string& nodeType) const {
-    InferenceEngine::details::CaselessEq<std::string> comparator;
-    return comparator(nodeType, type);
-}
-
 std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Output<ngraph::Node>>& inputs,
                                                     const pugi::xml_node& node, const Blob::CPtr& weights,
                                                     const GenericLayerParams& params) {
     static std::vector<std::shared_ptr<LayerBaseCreator>> creators = {
         std::make_shared<LayerCreator<ngraph::op::v1::AvgPool>>("AvgPool"),
         std::make_shared<LayerCreator<ngraph::op::Clamp>>("Clamp"),
+        std::make_shared<LayerCreator<ngraph::op::Constant>>("Const"),
         std::make_shared<LayerCreator<ngraph::op::Convert>>("Convert"),
         std::make_shared<LayerCreator<ngraph::op::CTCGreedyDecoder>>("CTCGreedyDecoder"),
         std::make_shared<LayerCreator<ngraph::op::v1::DeformableConvolution>>("DeformableConvolution"),
@@ -459,6 +475,13 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
         std::make_shared<LayerCreator<ngraph::op::v1::LogicalXor>>("LogicalXor"),
         std::make_shared<LayerCreator<ngraph::op::v1::LogicalNot>>("LogicalNot"),
     };
+    // Layer type lookup is done for every layer, so creators are indexed by type once
+    static const InferenceEngine::details::caseless_unordered_map<std::string, std::shared_ptr<LayerBaseCreator>> creatorsByType = [] {
+        InferenceEngine::details::caseless_unordered_map<std::string, std::shared_ptr<LayerBaseCreator>> result;
+        for (const auto& creator : creators)
+            result.emplace(creator->getType(), creator);
+        return result;
+    }();
 
     // Check that operation in default opsets
     auto isDefaultOpSet = [](const std::string& version) -> bool {
@@ -482,27 +505,27 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
     std::shared_ptr<ngraph::Node> ngraphNode;
     if (isDefaultOpSet(params.version)) {
         // Try to create operation from creators
-        for (const auto& creator : creators) {
-            if (creator->shouldCreate(params.type)) {
-                bool useCreator = false;
-                // Check that opset is registered
-                useCreator |= opsets.find(params.version) == opsets.end();
-                if (!useCreator) {
-                    // Check that creator can create operation with the version from opset
-                    const auto opset = opsets.at(params.version);
-                    // Opset should contains the same version of operation or doesn't contain operation with current type
-                    useCreator |= opset.contains_type(creator->getNodeType()) || !opset.contains_type(params.type);
-                }
-                if (useCreator)
-                    ngraphNode = creator->createLayer(inputs, node, weights, params);
-                break;
+        auto creatorIt = creatorsByType.find(params.type);
+        if (creatorIt != creatorsByType.end()) {
+            const auto& creator = creatorIt->second;
+            bool useCreator = false;
+            // Check that opset is registered
+            auto opsetIt = opsets.find(params.version);
+            useCreator |= opsetIt == opsets.end();
+            if (!useCreator) {
+                // Check that creator can create operation with the version from opset
+                const auto& opset = opsetIt->second;
+                // Opset should contains the same version of operation or doesn't contain operation with current type
+                useCreator |= opset.contains_type(creator->getNodeType()) || !opset.contains_type(params.type);
             }
+            if (useCreator)
+                ngraphNode = creator->createLayer(inputs, node, weights, params);
         }
     }
 
     // Try to create operation from loaded opsets
     if (!ngraphNode && opsets.count(params.version)) {
-        auto opset = opsets.at(params.version);
+        const auto& opset = opsets.at(params.version);
         std::string type = params.type;
         if (type == "Const") {
             type = "Constant";
@@ -578,6 +601,10 @@ std::shared_ptr<ngraph::Node> V10Parser::createNode(const std::vector<ngraph::Ou
         if (pr_data) {
             rtInfo["PrimitivesPriority"] = std::make_shared<::ngraph::VariantWrapper<std::string> >(pr_data.value());
         }
+        const auto lp_data = dn.attribute("LowPrecisionOverride");
+        if (lp_data) {
+            rtInfo["LowPrecisionOverride"] = std::make_shared<::ngraph::VariantWrapper<std::string> >(lp_data.value());
+        }
     }
 
     ngraphNode->set_friendly_name(params.name);
@@ -874,6 +901,35 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Convert>::crea
                                                  details::convertPrecision(GetStrAttr(dn, "destination_type")));
 }
 
+// Constant layer
+template <>
+std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::createLayer(
+    const ngraph::OutputVector& inputs, const pugi::xml_node& node, const Blob::CPtr& weights,
+    const GenericLayerParams& layerParsePrms) {
+    checkParameters(inputs, layerParsePrms, 0);
+    pugi::xml_node dn = node.child("data");
+    if (dn.empty())
+        THROW_IE_EXCEPTION << "Cannot read parameter for " << getType() << " layer with name: " << layerParsePrms.name;
+
+    auto el_type = details::convertPrecision(GetStrAttr(dn, "element_type"));
+    auto shape = getParameters<size_t>(dn, "shape", {});
+    size_t offset = GetUInt64Attr(dn, "offset");
+    size_t size = GetUInt64Attr(dn, "size");
+
+    if (!weights || !weights->byteSize())
+        THROW_IE_EXCEPTION << "Empty weights data in bin file or bin file cannot be found!";
+    if (weights->byteSize() < offset + size)
+        THROW_IE_EXCEPTION << "Incorrect weights in bin file!";
+    if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
+        THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for " << getType() << " op!";
+
+    // the constant references the weights blob instead of copying its part, so the blob is kept alive by the buffer
+    char* data = weights->cbuffer().as<char*>() + offset;
+    Blob::CPtr holder = weights;
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, size, holder);
+    return std::make_shared<ngraph::op::Constant>(el_type, ngraph::Shape(shape), buffer);
+}
+
 // LSTMCell layer
 template <>
 std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::v0::LSTMCell>::createLayer(
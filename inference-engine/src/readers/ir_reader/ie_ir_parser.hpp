@@ -7,6 +7,7 @@
 #ifdef IR_READER_V10
 # include <ngraph/node.hpp>
 # include <ngraph/op/util/sub_graph_base.hpp>
+# include <ngraph/runtime/shared_buffer.hpp>
 # include <ie_ngraph_utils.hpp>
 #endif  // IR_READER_V10
 
@@ -108,9 +109,6 @@ private:
                                                         const GenericLayerParams& layerParsePrms,
                                                         std::shared_ptr<ngraph::op::util::SubGraphOp> subgraph_op);
         explicit LayerBaseCreator(const std::string& type): type(type) {}
-        std::string getType() {
-            return type;
-        }
         template <class T>
         std::vector<T> getParameters(const pugi::xml_node& node, const std::string& name) {
             std::vector<T> result;
@@ -155,7 +153,9 @@ private:
                                                           const pugi::xml_node& node, const Blob::CPtr& weights,
                                                           const GenericLayerParams& layerParsePrms) = 0;
 
-        bool shouldCreate(const std::string& nodeType) const;
+        const std::string& getType() const {
+            return type;
+        }
         virtual ngraph::NodeTypeInfo getNodeType() const = 0;
     };
 
@@ -287,10 +287,16 @@ private:
                 if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
                     THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for " << type << " op!";
 
-                auto data = static_cast<char*>(adapter.get_ptr());
                 char* weights_data = weights->cbuffer().as<char*>() + offset;
 
-                std::memcpy(data, weights_data, size);
+                // constant buffer is replaced with a view of the weights blob, which is kept alive by the view
+                if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+                    Blob::CPtr holder = weights;
+                    a->set(std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(weights_data, size, holder));
+                } else {
+                    auto data = static_cast<char*>(adapter.get_ptr());
+                    std::memcpy(data, weights_data, size);
+                }
             }
         }
         void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
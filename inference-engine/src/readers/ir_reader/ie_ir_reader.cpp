@@ -34,8 +34,10 @@ CNNNetwork IRReader::read(std::istream& model, const std::vector<IExtensionPtr>&
 }
 
 CNNNetwork IRReader::read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const {
-    OV_ITT_SCOPED_TASK(itt::domains::V10Reader, "IRReader::read");
+    OV_ITT_TASK_CHAIN(taskChain, itt::domains::V10Reader, "IRReader::read", "LoadXML");
 
+    // pugixml reads the stream into a single buffer owned by the document and parses it in place,
+    // so node and attribute strings are not allocated separately
     pugi::xml_document xmlDoc;
     pugi::xml_parse_result res = xmlDoc.load(model);
     if (res.status != pugi::status_ok) {
@@ -43,6 +45,8 @@ CNNNetwork IRReader::read(std::istream& model, const Blob::CPtr& weights, const
     }
     pugi::xml_node root = xmlDoc.document_element();
 
+    OV_ITT_TASK_NEXT(taskChain, "ParseIR");
+
     auto version = details::GetIRVersion(root);
     IRParser parser(version, exts);
     return CNNNetwork(parser.parse(root, weights));
@@ -25,6 +25,8 @@ class TRANSFORMATIONS_API UnrollTensorIterator;
  * the number of iterations of the TensorIterator layer, are created and connected to each other and to the external
  * network. If the number of TensorIterator iterations is greater than 1, then additional Concat and Split layers
  * are added to the network.
+ * Loop layers are unrolled the same way if their number of iterations is known, i.e. the trip count is a constant
+ * and the execution condition is always true. The current iteration input of each body copy becomes a constant.
  */
 
 class ngraph::pass::UnrollTensorIterator: public ngraph::pass::FunctionPass {
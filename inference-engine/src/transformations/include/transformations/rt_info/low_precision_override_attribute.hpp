@@ -0,0 +1,82 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines low precision override attribute
+ * @file low_precision_override_attribute.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/node.hpp>
+#include <ngraph/variant.hpp>
+#include <transformations_visibility.hpp>
+
+namespace ngraph {
+
+/**
+ * @ingroup ie_runtime_attr_api
+ * @brief LowPrecisionOverride class represents runtime info attribute that overrides precisions
+ * low precision transformations can use for an operation. The value is a comma separated list of
+ * precisions on activations ("U8", "I8"), "FP32" keeps the operation in original precision.
+ */
+class TRANSFORMATIONS_API LowPrecisionOverride {
+private:
+    std::string low_precision_override;
+
+public:
+    /**
+     * A default constructor
+     */
+    LowPrecisionOverride() = default;
+
+    /**
+     * @brief      Constructs a new object with a given override
+     * @param[in]  low_precision_override  The low precision override value
+     */
+    explicit LowPrecisionOverride(const std::string &low_precision_override) : low_precision_override(low_precision_override) {}
+
+    /**
+     * @brief return string with low precision override value
+     */
+    std::string getLowPrecisionOverride() const;
+
+    /**
+     * @brief return precisions on activations allowed by the override, empty if the operation is kept in original precision
+     */
+    std::vector<element::Type> getPrecisions() const;
+};
+
+extern template class TRANSFORMATIONS_API VariantImpl<LowPrecisionOverride>;
+
+template<>
+class TRANSFORMATIONS_API VariantWrapper<LowPrecisionOverride> : public VariantImpl<LowPrecisionOverride> {
+public:
+    static constexpr VariantTypeInfo type_info{"Variant::RuntimeAttribute::LowPrecisionOverride", 0};
+
+    const VariantTypeInfo &get_type_info() const override {
+        return type_info;
+    }
+
+    VariantWrapper(const value_type &value) : VariantImpl<value_type>(value) {}
+
+    std::shared_ptr<ngraph::Variant> merge(const ngraph::NodeVector & nodes) override;
+
+    std::shared_ptr<ngraph::Variant> init(const std::shared_ptr<ngraph::Node> & node) override;
+};
+
+/**
+ * @ingroup ie_runtime_attr_api
+ * @brief getLowPrecisionOverride returns precisions on activations allowed for the node by LowPrecisionOverride attribute
+ * @param[in] node The node will be used to get LowPrecisionOverride attribute
+ * @param[out] precisions Allowed precisions, empty if the node is kept in original precision or the value is invalid
+ * @return true if the node has LowPrecisionOverride attribute
+ */
+TRANSFORMATIONS_API bool getLowPrecisionOverride(const ngraph::Node & node, std::vector<element::Type> & precisions);
+
+}  // namespace ngraph
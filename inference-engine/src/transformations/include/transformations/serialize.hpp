@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <map>
+#include <ostream>
 #include <string>
 
 #include "ngraph/opsets/opset.hpp"
@@ -26,6 +28,12 @@ class TRANSFORMATIONS_API Serialize;
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ *
+ * The xml is written layer by layer and constants are written to the bin
+ * stream directly from their buffers, so the memory used does not depend on
+ * the size of the weights. With deduplicate_constants equal constants are
+ * written once and share an offset. The stream constructor allows to write
+ * into files opened by a caller, e.g. into a cache blob after a header.
  */
 class ngraph::pass::Serialize : public ngraph::pass::FunctionPass {
 public:
@@ -34,12 +42,23 @@ public:
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
     Serialize(const std::string& xmlPath, const std::string& binPath,
-              Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {})
-        : m_xmlPath{xmlPath}, m_binPath{binPath}, m_version{version}, m_custom_opsets{custom_opsets} {}
+              Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {},
+              bool deduplicate_constants = false)
+        : m_xmlPath{xmlPath}, m_binPath{binPath}, m_version{version}, m_custom_opsets{custom_opsets},
+          m_deduplicate_constants{deduplicate_constants} {}
+
+    Serialize(std::ostream& xmlFile, std::ostream& binFile,
+              Version version = Version::IR_V10, std::map<std::string, ngraph::OpSet> custom_opsets = {},
+              bool deduplicate_constants = false)
+        : m_xmlFile{&xmlFile}, m_binFile{&binFile}, m_version{version}, m_custom_opsets{custom_opsets},
+          m_deduplicate_constants{deduplicate_constants} {}
 
 private:
     const std::string m_xmlPath;
     const std::string m_binPath;
+    std::ostream* const m_xmlFile = nullptr;
+    std::ostream* const m_binFile = nullptr;
     const Version m_version;
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
+    const bool m_deduplicate_constants;
 };
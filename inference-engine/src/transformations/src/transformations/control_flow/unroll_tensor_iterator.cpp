@@ -10,6 +10,7 @@
 
 #include <ngraph/graph_util.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/rt_info.hpp>
 
@@ -17,15 +18,25 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::UnrollTensorIterator, "UnrollTensorIterator
 
 bool ngraph::pass::UnrollTensorIterator::run_on_function(std::shared_ptr<ngraph::Function> f) {
     for (const auto& op : f->get_ops()) {
-        auto ti = std::dynamic_pointer_cast<ngraph::opset4::TensorIterator>(op);
+        auto ti = std::dynamic_pointer_cast<ngraph::op::util::SubGraphOp>(op);
         if (!ti || m_transformation_callback(ti)) {
             continue;
         }
 
-        const auto& function = ti->get_body();
-        const auto num_iter = ti->get_num_iterations();
+        // Loop is unrolled only if the number of iterations is known, i.e. the trip count is a constant and
+        // the execution condition is always true
+        int64_t num_iter = -1;
+        const auto loop = std::dynamic_pointer_cast<ngraph::opset5::Loop>(op);
+        if (const auto tensor_iterator = std::dynamic_pointer_cast<ngraph::opset4::TensorIterator>(op)) {
+            num_iter = tensor_iterator->get_num_iterations();
+        } else if (loop) {
+            num_iter = loop->get_num_iterations();
+        } else {
+            continue;
+        }
+        const auto& function = ti->get_function();
 
-        // negative value means inconsistent TI
+        // negative value means inconsistent TI or Loop with unknown number of iterations
         if (num_iter <= -1) {
             continue;
         }
@@ -41,6 +52,19 @@ bool ngraph::pass::UnrollTensorIterator::run_on_function(std::shared_ptr<ngraph:
             }
         }
 
+        // The current iteration number of Loop is a constant in every copy of the body
+        if (loop && loop->get_special_body_ports().current_iteration_input_idx >= 0) {
+            const auto idx = loop->get_special_body_ports().current_iteration_input_idx;
+            for (int64_t j = 0; j < num_iter; j++) {
+                const auto& param = body_functions[j]->get_parameters().at(idx);
+                auto cur_iter = opset5::Constant::create(param->get_element_type(), param->get_shape(), {j});
+                copy_runtime_info(ti, cur_iter);
+                for (auto &output : param->outputs()) {
+                    output.replace(cur_iter);
+                }
+            }
+        }
+
         // Port map : inputs and back edges
         for (const auto& desc : ti->get_input_descriptions()) {
             const std::string& type_name = desc->get_type_info().name;
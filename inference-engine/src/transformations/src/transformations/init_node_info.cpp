@@ -5,6 +5,7 @@
 #include "transformations/init_node_info.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
+#include "transformations/rt_info/low_precision_override_attribute.hpp"
 
 #include <memory>
 #include <vector>
@@ -26,6 +27,14 @@ bool ngraph::pass::InitNodeInfo::run_on_function(std::shared_ptr<ngraph::Functio
                 [](const std::string & value) -> std::shared_ptr<Variant> {
                     return std::make_shared<VariantWrapper<PrimitivesPriority> >(PrimitivesPriority(value));
                 }
+            },
+            {"LowPrecisionOverride",
+                [](const std::string & value) -> std::shared_ptr<Variant> {
+                    LowPrecisionOverride low_precision_override(value);
+                    // validate the value early, while the error can be reported to the user
+                    low_precision_override.getPrecisions();
+                    return std::make_shared<VariantWrapper<LowPrecisionOverride> >(low_precision_override);
+                }
             }
     };
 
@@ -16,6 +16,37 @@
 #include <ngraph/graph_util.hpp>
 #include <ngraph/specialize_function.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/or.hpp>
+
+namespace {
+// The sequence axis of the body slices is removed and restored either by Reshape or by Squeeze/Unsqueeze
+std::shared_ptr<ngraph::Node> squeeze_sequence_axis(const ngraph::Output<ngraph::Node>& data) {
+    auto pattern = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 1});
+    auto axis = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {0});
+    return std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{
+            std::make_shared<ngraph::opset5::Reshape>(data, pattern, false),
+            std::make_shared<ngraph::opset5::Squeeze>(data, axis)});
+}
+
+std::shared_ptr<ngraph::Node> unsqueeze_sequence_axis(const ngraph::Output<ngraph::Node>& data) {
+    auto pattern = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{3}, {1, 1, 1});
+    auto axis = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{1}, {0});
+    return std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{
+            std::make_shared<ngraph::opset5::Reshape>(data, pattern, false),
+            std::make_shared<ngraph::opset5::Unsqueeze>(data, axis)});
+}
+
+// Squeeze and Unsqueeze must work on the sliced (concatenated) axis only, Reshape is checked by the cell shapes
+bool is_sequence_axis(const std::shared_ptr<ngraph::Node>& node, int64_t axis) {
+    if (!ngraph::is_type<ngraph::opset5::Squeeze>(node) && !ngraph::is_type<ngraph::opset5::Unsqueeze>(node))
+        return true;
+    auto axes = std::dynamic_pointer_cast<ngraph::opset5::Constant>(node->get_input_node_shared_ptr(1));
+    if (!axes)
+        return false;
+    auto values = axes->cast_vector<int64_t>();
+    return values.size() == 1 && (values[0] == axis || values[0] + 3 == axis);
+}
+}  // namespace
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConvertTensorIteratorToLSTMSequence, "ConvertTensorIteratorToLSTMSequence", 0);
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConvertTensorIteratorToRNNSequence, "ConvertTensorIteratorToRNNSequence", 0);
@@ -31,8 +62,7 @@ ngraph::pass::ConvertTensorIteratorToLSTMSequence::ConvertTensorIteratorToLSTMSe
 
         // create pattern
         auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 1});
-        auto pattern_1 = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 1});
-        auto squeeze = std::make_shared<ngraph::opset5::Reshape>(data, pattern_1, false);
+        auto squeeze = squeeze_sequence_axis(data);
         auto input_H_state = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1});
         auto input_C_state = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1});
         auto input_W = std::make_shared<ngraph::opset5::Constant>(ngraph::element::f32, ngraph::Shape{4, 1});
@@ -41,8 +71,7 @@ ngraph::pass::ConvertTensorIteratorToLSTMSequence::ConvertTensorIteratorToLSTMSe
 
         auto cell = std::make_shared<ngraph::opset5::LSTMCell>(squeeze, input_H_state, input_C_state,
                                                                input_W, input_R, input_B, 1);
-        auto pattern_2 = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{3}, {1, 1, 1});
-        auto unsqueeze = std::make_shared<ngraph::opset5::Reshape>(cell, pattern_2, false);
+        auto unsqueeze = unsqueeze_sequence_axis(cell);
         ngraph::pattern::Matcher matcher(unsqueeze);
 
         bool match = false;
@@ -57,7 +86,7 @@ ngraph::pass::ConvertTensorIteratorToLSTMSequence::ConvertTensorIteratorToLSTMSe
         auto cell_v1 = std::make_shared<ngraph::opset1::LSTMCell>(squeeze, input_H_state, input_C_state,
                                                                  input_W, input_R, input_B, 1);
         if (!match) {
-            unsqueeze = std::make_shared<ngraph::opset5::Reshape>(cell_v1, pattern_2, false);
+            unsqueeze = unsqueeze_sequence_axis(cell_v1);
             matcher.clear_state();
             matcher.m_pattern_node = unsqueeze;
             for (const auto& res : func->get_results()) {
@@ -95,7 +124,8 @@ ngraph::pass::ConvertTensorIteratorToLSTMSequence::ConvertTensorIteratorToLSTMSe
                 stride = slice_input->m_stride;
                 slice_axis = slice_input->m_axis;
 
-                if (!(slice_axis == 0 || slice_axis == 1)) {
+                if (!(slice_axis == 0 || slice_axis == 1) ||
+                    !is_sequence_axis(found_cell->get_input_node_shared_ptr(0), slice_axis)) {
                     return false;
                 }
                 batch_size = param->get_shape()[slice_axis == 0 ? 1 : 0];
@@ -113,10 +143,10 @@ ngraph::pass::ConvertTensorIteratorToLSTMSequence::ConvertTensorIteratorToLSTMSe
         std::vector<std::shared_ptr<ngraph::opset5::TensorIterator::OutputDescription>> ordered_out_descs(3);
         for (const auto& output_desc : ti->get_output_descriptions()) {
             std::shared_ptr<opset5::Result> res = results[output_desc->m_body_value_index];
-            if (res->get_input_source_output(0) == pattern_map[unsqueeze]) {
+            if (res->get_input_source_output(0) == matcher.get_match_value()) {
                 auto concat_output
                         = std::dynamic_pointer_cast<ngraph::opset5::TensorIterator::ConcatOutputDescription>(output_desc);
-                if (!concat_output)
+                if (!concat_output || !is_sequence_axis(matcher.get_match_root(), concat_output->m_axis))
                     return false;
 
                 stride = concat_output->m_stride;
@@ -205,8 +235,7 @@ ngraph::pass::ConvertTensorIteratorToRNNSequence::ConvertTensorIteratorToRNNSequ
 
         // create pattern
         auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 1});
-        auto pattern_1 = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 1});
-        auto squeeze = std::make_shared<ngraph::opset5::Reshape>(data, pattern_1, false);
+        auto squeeze = squeeze_sequence_axis(data);
 
         auto input_H_state = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1});
         auto input_W = std::make_shared<ngraph::opset5::Constant>(ngraph::element::f32, ngraph::Shape{1, 1});
@@ -215,8 +244,7 @@ ngraph::pass::ConvertTensorIteratorToRNNSequence::ConvertTensorIteratorToRNNSequ
 
         auto cell = std::make_shared<ngraph::opset5::RNNCell>(squeeze, input_H_state, input_W, input_R, input_B, 1);
 
-        auto pattern_2 = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{3}, {1, 1, 1});
-        auto unsqueeze = std::make_shared<ngraph::opset5::Reshape>(cell, pattern_2, false);
+        auto unsqueeze = unsqueeze_sequence_axis(cell);
         ngraph::pattern::Matcher matcher(unsqueeze);
 
         bool match = false;
@@ -251,7 +279,8 @@ ngraph::pass::ConvertTensorIteratorToRNNSequence::ConvertTensorIteratorToRNNSequ
 
                 stride = slice_input->m_stride;
                 slice_axis = slice_input->m_axis;
-                if (!(slice_axis == 0 || slice_axis == 1)) {
+                if (!(slice_axis == 0 || slice_axis == 1) ||
+                    !is_sequence_axis(pattern_map[cell]->get_input_node_shared_ptr(0), slice_axis)) {
                     return false;
                 }
                 batch_size = param->get_shape()[slice_axis == 0 ? 1 : 0];
@@ -269,10 +298,10 @@ ngraph::pass::ConvertTensorIteratorToRNNSequence::ConvertTensorIteratorToRNNSequ
         std::vector<std::shared_ptr<ngraph::opset5::TensorIterator::OutputDescription>> ordered_out_descs(2);
         for (const auto& output_desc : ti->get_output_descriptions()) {
             std::shared_ptr<opset5::Result> res = results[output_desc->m_body_value_index];
-            if (res->get_input_source_output(0) == pattern_map[unsqueeze]) {
+            if (res->get_input_source_output(0) == matcher.get_match_value()) {
                 auto concat_output
                         = std::dynamic_pointer_cast<ngraph::opset5::TensorIterator::ConcatOutputDescription>(output_desc);
-                if (!concat_output)
+                if (!concat_output || !is_sequence_axis(matcher.get_match_root(), concat_output->m_axis))
                     return false;
 
                 stride = concat_output->m_stride;
@@ -358,8 +387,7 @@ ngraph::pass::ConvertTensorIteratorToGRUSequence::ConvertTensorIteratorToGRUSequ
 
         // create pattern
         auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 1});
-        auto pattern_1 = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 1});
-        auto squeeze = std::make_shared<ngraph::opset5::Reshape>(data, pattern_1, false);
+        auto squeeze = squeeze_sequence_axis(data);
 
         auto input_H_state = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1});
         auto input_W = std::make_shared<ngraph::opset5::Constant>(ngraph::element::f32, ngraph::Shape{3, 1});
@@ -368,8 +396,7 @@ ngraph::pass::ConvertTensorIteratorToGRUSequence::ConvertTensorIteratorToGRUSequ
 
         auto cell = std::make_shared<ngraph::opset5::GRUCell>(squeeze, input_H_state, input_W, input_R, input_B, 1);
 
-        auto pattern_2 = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{3}, {1, 1, 1});
-        auto unsqueeze = std::make_shared<ngraph::opset5::Reshape>(cell, pattern_2, false);
+        auto unsqueeze = unsqueeze_sequence_axis(cell);
         ngraph::pattern::Matcher matcher(unsqueeze);
 
         bool match = false;
@@ -404,7 +431,8 @@ ngraph::pass::ConvertTensorIteratorToGRUSequence::ConvertTensorIteratorToGRUSequ
 
                 stride = slice_input->m_stride;
                 slice_axis = slice_input->m_axis;
-                if (!(slice_axis == 0 || slice_axis == 1)) {
+                if (!(slice_axis == 0 || slice_axis == 1) ||
+                    !is_sequence_axis(pattern_map[cell]->get_input_node_shared_ptr(0), slice_axis)) {
                     return false;
                 }
                 batch_size = param->get_shape()[slice_axis == 0 ? 1 : 0];
@@ -422,10 +450,10 @@ ngraph::pass::ConvertTensorIteratorToGRUSequence::ConvertTensorIteratorToGRUSequ
         std::vector<std::shared_ptr<ngraph::opset5::TensorIterator::OutputDescription>> ordered_out_descs(2);
         for (const auto& output_desc : ti->get_output_descriptions()) {
             std::shared_ptr<opset5::Result> res = results[output_desc->m_body_value_index];
-            if (res->get_input_source_output(0) == pattern_map[unsqueeze]) {
+            if (res->get_input_source_output(0) == matcher.get_match_value()) {
                 auto concat_output
                         = std::dynamic_pointer_cast<ngraph::opset5::TensorIterator::ConcatOutputDescription>(output_desc);
-                if (!concat_output)
+                if (!concat_output || !is_sequence_axis(matcher.get_match_root(), concat_output->m_axis))
                     return false;
 
                 stride = concat_output->m_stride;
@@ -0,0 +1,82 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <set>
+#include <sstream>
+
+#include <ngraph/node.hpp>
+#include <ngraph/variant.hpp>
+
+#include "transformations/rt_info/low_precision_override_attribute.hpp"
+
+namespace ngraph {
+
+template class ngraph::VariantImpl<LowPrecisionOverride>;
+
+constexpr VariantTypeInfo VariantWrapper<LowPrecisionOverride>::type_info;
+
+std::string LowPrecisionOverride::getLowPrecisionOverride() const {
+    return low_precision_override;
+}
+
+std::vector<element::Type> LowPrecisionOverride::getPrecisions() const {
+    std::vector<element::Type> precisions;
+    std::istringstream stream(low_precision_override);
+    std::string str;
+    while (getline(stream, str, ',')) {
+        str.erase(std::remove_if(str.begin(), str.end(), ::isspace), str.end());
+        std::transform(str.begin(), str.end(), str.begin(), ::toupper);
+        if (str == "U8") {
+            precisions.push_back(element::u8);
+        } else if (str == "I8") {
+            precisions.push_back(element::i8);
+        } else if (str == "FP32" || str == "F32") {
+            return {};
+        } else {
+            throw ngraph_error(std::string(VariantWrapper<LowPrecisionOverride>::type_info.name) +
+                               " has unsupported precision: " + str);
+        }
+    }
+    return precisions;
+}
+
+std::shared_ptr<ngraph::Variant> VariantWrapper<LowPrecisionOverride>::merge(const ngraph::NodeVector & nodes) {
+    std::set<std::string> unique_overrides;
+    for (auto &node : nodes) {
+        const auto &rtInfo = node->get_rt_info();
+        if (!rtInfo.count(type_info.name)) continue;
+        auto attr = as_type_ptr<VariantWrapper<LowPrecisionOverride>>(rtInfo.at(type_info.name));
+        if (attr) unique_overrides.insert(attr->get().getLowPrecisionOverride());
+    }
+
+    // different overrides of fused operations are resolved conservatively to original precision
+    std::string final_override = unique_overrides.size() == 1 ? *unique_overrides.begin() : "FP32";
+    return std::make_shared<VariantWrapper<LowPrecisionOverride> >(LowPrecisionOverride(final_override));
+}
+
+std::shared_ptr<ngraph::Variant> VariantWrapper<LowPrecisionOverride>::init(const std::shared_ptr<ngraph::Node> & node) {
+    throw ngraph_error(std::string(type_info.name) + " has no default initialization.");
+}
+
+bool getLowPrecisionOverride(const ngraph::Node & node, std::vector<element::Type> & precisions) {
+    const auto &rtInfo = node.get_rt_info();
+    using LowPrecisionOverrideWraper = VariantWrapper<LowPrecisionOverride>;
+
+    if (!rtInfo.count(LowPrecisionOverrideWraper::type_info.name)) return false;
+
+    const auto &attr = as_type_ptr<LowPrecisionOverrideWraper>(rtInfo.at(LowPrecisionOverrideWraper::type_info.name));
+    if (!attr) return false;
+    try {
+        precisions = attr->get().getPrecisions();
+    } catch (const ngraph_error &) {
+        // an invalid override keeps the node in original precision
+        precisions.clear();
+    }
+    return true;
+}
+
+}  // namespace ngraph
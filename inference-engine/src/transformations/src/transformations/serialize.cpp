@@ -3,6 +3,7 @@
 //
 
 #include <array>
+#include <cstring>
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -38,8 +39,58 @@ struct Edge {
 };
 
 struct ConstantAtributes {
-    int size = 0;
-    int offset = 0;
+    int64_t size = 0;
+    int64_t offset = 0;
+};
+
+// Writes constants to the bin stream as they are visited, so the weights are
+// not copied into an intermediate buffer
+class ConstantWriter {
+public:
+    ConstantWriter(std::ostream& bin, bool deduplicate)
+        : m_bin(bin), m_deduplicate(deduplicate) {}
+
+    ConstantAtributes write(const uint8_t* data, int64_t size) {
+        ConstantAtributes attr;
+        attr.size = size;
+        attr.offset = m_offset;
+
+        uint64_t hash = 0;
+        if (m_deduplicate) {
+            hash = hash_data(data, size);
+            auto range = m_written.equal_range(hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                // the written constants are alive until the pass is finished
+                if (it->second.second.size == size &&
+                    std::memcmp(it->second.first, data, size) == 0) {
+                    return it->second.second;
+                }
+            }
+        }
+
+        m_bin.write(reinterpret_cast<const char*>(data), size);
+        NGRAPH_CHECK(m_bin.good(), "Failed to write constant data");
+        m_offset += size;
+        if (m_deduplicate) {
+            m_written.emplace(hash, std::make_pair(data, attr));
+        }
+        return attr;
+    }
+
+private:
+    static uint64_t hash_data(const uint8_t* data, int64_t size) {
+        // FNV-1a
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (int64_t i = 0; i < size; i++) {
+            h = (h ^ data[i]) * 0x100000001b3ULL;
+        }
+        return h;
+    }
+
+    std::ostream& m_bin;
+    const bool m_deduplicate;
+    int64_t m_offset = 0;
+    std::unordered_multimap<uint64_t, std::pair<const uint8_t*, ConstantAtributes>> m_written;
 };
 
 class XmlVisitor : public ngraph::AttributeVisitor {
@@ -176,17 +227,13 @@ const std::vector<Edge> create_edge_mapping(
 }
 
 // TODO: refactor to Vistor API when Constant will be supporting it
-ConstantAtributes dump_constant_data(std::vector<uint8_t>& bin,
+ConstantAtributes dump_constant_data(ConstantWriter& bin,
                                      const ngraph::op::Constant& c) {
     NGRAPH_CHECK(c.get_output_partial_shape(0.).is_static(),
                  "Unsupported dynamic output shape in ", c);
 
-    ConstantAtributes attr;
     const uint8_t* p = reinterpret_cast<const uint8_t*>(c.get_data_ptr());
-    attr.size = ngraph::shape_size(c.get_shape()) * c.get_element_type().size();
-    attr.offset = bin.size();
-    bin.insert(end(bin), p, p + attr.size);
-    return attr;
+    return bin.write(p, ngraph::shape_size(c.get_shape()) * c.get_element_type().size());
 }
 
 std::string get_opset_name(
@@ -364,16 +411,33 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
     return true;
 }
 
+// Prints the node at the depth of children of <net> and clears the document,
+// so only one layer is kept in the DOM at a time
+void print_and_reset(std::ostream& xml, pugi::xml_document& doc) {
+    doc.first_child().print(xml, "\t", pugi::format_default, pugi::encoding_auto, 2);
+    doc.reset();
+}
+
 void ngfunction_2_irv10(
-    pugi::xml_document& doc, std::vector<uint8_t>& bin,
+    std::ostream& xml, ConstantWriter& bin,
     ngraph::Function& f,
     const std::map<std::string, ngraph::OpSet>& custom_opsets) {
     const bool exec_graph = is_exec_graph(f);
 
-    pugi::xml_node netXml = doc.append_child("net");
-    netXml.append_attribute("name").set_value(f.get_friendly_name().c_str());
-    netXml.append_attribute("version").set_value("10");
-    pugi::xml_node layers = netXml.append_child("layers");
+    // the opening tag of <net> is written by pugixml to keep the escaping of the name
+    {
+        pugi::xml_document doc;
+        pugi::xml_node netXml = doc.append_child("net");
+        netXml.append_attribute("name").set_value(f.get_friendly_name().c_str());
+        netXml.append_attribute("version").set_value("10");
+        netXml.append_child(pugi::xml_node_type::node_pcdata);
+        std::ostringstream net;
+        netXml.print(net, "", pugi::format_raw);
+        const auto netTag = net.str();
+        xml << "<?xml version=\"1.0\"?>\n"
+            << netTag.substr(0, netTag.rfind("</net>")) << "\n\t<layers>\n";
+    }
+    pugi::xml_document doc;
 
     const std::unordered_map<ngraph::Node*, int> layer_ids =
         create_layer_ids(f);
@@ -386,7 +450,7 @@ void ngfunction_2_irv10(
 
         NGRAPH_CHECK(layer_ids.find(node) != layer_ids.end(), "Internal error");
         // <layers>
-        pugi::xml_node layer = layers.append_child("layer");
+        pugi::xml_node layer = doc.append_child("layer");
         layer.append_attribute("id").set_value(layer_ids.find(node)->second);
         layer.append_attribute("name").set_value(
             get_node_unique_name(unique_names, node).c_str());
@@ -419,8 +483,8 @@ void ngfunction_2_irv10(
         // <layers/data> constant atributes (special case)
         if (auto constant = dynamic_cast<ngraph::op::Constant*>(node)) {
             ConstantAtributes attr = dump_constant_data(bin, *constant);
-            data.append_attribute("offset").set_value(attr.offset);
-            data.append_attribute("size").set_value(attr.size);
+            data.append_attribute("offset").set_value(static_cast<long long>(attr.offset));
+            data.append_attribute("size").set_value(static_cast<long long>(attr.size));
         }
 
         int port_id = 0;
@@ -458,21 +522,25 @@ void ngfunction_2_irv10(
                 }
             }
         }
+        print_and_reset(xml, doc);
     }
+    xml << "\t</layers>\n\t<edges>\n";
     // <edges>
     const std::vector<Edge> edge_mapping = create_edge_mapping(layer_ids, f);
-    pugi::xml_node edges = netXml.append_child("edges");
     for (auto e : edge_mapping) {
-        pugi::xml_node edge = edges.append_child("edge");
+        pugi::xml_node edge = doc.append_child("edge");
         edge.append_attribute("from-layer").set_value(e.from_layer);
         edge.append_attribute("from-port").set_value(e.from_port);
         edge.append_attribute("to-layer").set_value(e.to_layer);
         edge.append_attribute("to-port").set_value(e.to_port);
+        print_and_reset(xml, doc);
     }
+    xml << "\t</edges>\n</net>\n";
     // move back dynamic shapes
     if (has_dynamic_shapes) {
         f.validate_nodes_and_infer_types();
     }
+    NGRAPH_CHECK(xml.good(), "Failed to write xml");
 }
 
 }  // namespace
@@ -480,27 +548,26 @@ void ngfunction_2_irv10(
 // ! [function_pass:serialize_cpp]
 // serialize.cpp
 bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
-    // prepare data
-    pugi::xml_document xml_doc;
-    std::vector<uint8_t> constants;
+    // create xml and bin files unless streams are given
+    std::ofstream xml_file, bin_file;
+    if (!m_xmlFile) {
+        xml_file.open(m_xmlPath, std::ios::out);
+        bin_file.open(m_binPath, std::ios::out | std::ios::binary);
+        NGRAPH_CHECK(xml_file.is_open() && bin_file.is_open(),
+                     "Can not open ", m_xmlPath, " or ", m_binPath, " for writing");
+    }
+    std::ostream& xml = m_xmlFile ? *m_xmlFile : xml_file;
+    ConstantWriter bin(m_binFile ? *m_binFile : bin_file, m_deduplicate_constants);
+
     switch (m_version) {
     case Version::IR_V10:
-        ngfunction_2_irv10(xml_doc, constants, *f, m_custom_opsets);
+        ngfunction_2_irv10(xml, bin, *f, m_custom_opsets);
         break;
     default:
         NGRAPH_UNREACHABLE("Unsupported version");
         break;
     }
 
-    // create xml file
-    std::ofstream xml_file(m_xmlPath, std::ios::out);
-    xml_doc.save(xml_file);
-
-    // create bin file
-    std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
-    bin_file.write(reinterpret_cast<const char*>(constants.data()),
-                   constants.size() * sizeof(constants[0]));
-
     // Return false because we didn't change nGraph Function
     return false;
 }
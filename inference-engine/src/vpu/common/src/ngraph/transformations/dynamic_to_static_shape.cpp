@@ -116,6 +116,14 @@ const Transformations& getDefaultTransformations() {
         {ngraph::opset3::Exp::type_info,               dynamicToStaticUnaryElementwise},
         {ngraph::opset3::Sqrt::type_info,              dynamicToStaticUnaryElementwise},
         {ngraph::opset3::LogicalNot::type_info,        dynamicToStaticUnaryElementwise},
+        {ngraph::opset3::Tanh::type_info,              dynamicToStaticUnaryElementwise},
+        {ngraph::opset3::Ceiling::type_info,           dynamicToStaticUnaryElementwise},
+        {ngraph::opset3::Erf::type_info,               dynamicToStaticUnaryElementwise},
+        {ngraph::opset3::Gelu::type_info,              dynamicToStaticUnaryElementwise},
+        {ngraph::opset5::HSwish::type_info,            dynamicToStaticUnaryElementwise},
+        {ngraph::opset5::Mish::type_info,              dynamicToStaticUnaryElementwise},
+        {ngraph::opset5::SoftPlus::type_info,          dynamicToStaticUnaryElementwise},
+        {ngraph::opset5::Swish::type_info,             dynamicToStaticUnaryElementwise},
         {ngraph::opset3::StridedSlice::type_info,      dynamicToStaticShapeStridedSlice},
         {ngraph::opset3::Squeeze::type_info,           dynamicToStaticShapeSqueeze},
         {ngraph::opset3::Gather::type_info,            dynamicToStaticShapeGather},
@@ -65,6 +65,17 @@ struct CompilationConfig final {
 
     std::map<std::string, std::vector<int>> ioStrides;
 
+    // index of HW tiling to use among tilings of a layer sorted by estimated cost, "*" applies to all layers
+    std::map<std::string, int> hwTilingChoices;
+
+    int hwTilingChoice(const std::string& layerName) const {
+        auto choice = hwTilingChoices.find(layerName);
+        if (choice == hwTilingChoices.end()) {
+            choice = hwTilingChoices.find("*");
+        }
+        return choice != hwTilingChoices.end() ? choice->second : 0;
+    }
+
     //
     // Debug options
     //
@@ -19,6 +19,13 @@ DECLARE_VPU_CONFIG(MYRIAD_NUMBER_OF_SHAVES);
 DECLARE_VPU_CONFIG(MYRIAD_NUMBER_OF_CMX_SLICES);
 DECLARE_VPU_CONFIG(MYRIAD_TILING_CMX_LIMIT_KB);
 
+/**
+ * @brief Per-layer choice of HW convolution and pooling tiling in "<layer_name>:<index>,..." format,
+ * where index selects among tilings sorted by estimated cost, 0 is the cheapest one.
+ * "*" as a layer name sets the choice for all layers not listed explicitly. Default = "" (cheapest tiling).
+ */
+DECLARE_VPU_CONFIG(MYRIAD_HW_TILING_CHOICES);
+
 DECLARE_VPU_CONFIG(MYRIAD_TENSOR_STRIDES);
 
 DECLARE_VPU_CONFIG(MYRIAD_IR_WITH_SCALES_DIRECTORY);
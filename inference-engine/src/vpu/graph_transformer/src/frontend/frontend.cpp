@@ -37,6 +37,7 @@
 #include "vpu/ngraph/transformations/eliminate_shapeof_after_dsr.hpp"
 #include <vpu/ngraph/operations/dynamic_shape_resolver.hpp>
 #include <legacy/ie_util_internal.hpp>
+#include <ie_load_time_breakdown.hpp>
 
 namespace vpu {
 
@@ -169,6 +170,7 @@ ie::ICNNNetwork::Ptr FrontEnd::convertNetwork(ie::ICNNNetwork& network) {
         return casesWithDynamicOrStaticUsage || casesWithOnlyDynamicUsage;
     };
 
+    ie::LoadTimeScope loadTimeScope(ie::LoadTimePhase::Transformations);
     auto nGraphFunc = network.getFunction();
     // Disable shape inference (WA for generic operations)
     ngraph::op::GenericIE::DisableReshape noReshape(nGraphFunc);
@@ -190,6 +192,7 @@ ie::ICNNNetwork::Ptr FrontEnd::convertNetwork(ie::ICNNNetwork& network) {
 
     vpu::MergeSubsequentDSROperations().run_on_function(nGraphFunc);
 
+    ie::LoadTimeScope legacyConversionScope(ie::LoadTimePhase::LegacyConversion);
     return InferenceEngine::details::convertFunctionToICNNNetwork(nGraphFunc, network);
 }
 
@@ -55,7 +55,10 @@ void PassImpl::run(const Model& model) {
         // Try to find "best" tiling
         //
 
-        const size_t tilingsCount = 1;
+        // cost estimation does not always predict the fastest tiling, so it can be overridden per layer
+        // with the choice measured on device
+        const auto tilingChoice = CompileEnv::get().config.hwTilingChoice(origStage->origLayerName());
+        const size_t tilingsCount = static_cast<size_t>(tilingChoice) + 1;
         const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
                                              // HWTilingNS::Direction::OUTPUT_TO_INPUT;
 
@@ -182,49 +185,51 @@ void PassImpl::run(const Model& model) {
 
         model->disconnectStage(origStage);
 
-        for (const auto &tiling : tiler.getHwTilings()) {
-            HWConvStageTiler hwStageTiler(
-                stageOptions,
-                stageIO,
-                model,
-                origStage,
-                _stageBuilder,
-                tiling,
-                stageOptions.withPool && !tiler.withPool());
+        // tilings are sorted by cost, the requested one may be absent if the layer has fewer tilings
+        const auto& hwTilings = tiler.getHwTilings();
+        const auto& tiling = hwTilings[std::min(static_cast<size_t>(tilingChoice), hwTilings.size() - 1)];
 
-            //
-            // Split/concat input/output tiles
-            //
+        HWConvStageTiler hwStageTiler(
+            stageOptions,
+            stageIO,
+            model,
+            origStage,
+            _stageBuilder,
+            tiling,
+            stageOptions.withPool && !tiler.withPool());
 
-            if (!hwStageTiler.hwInputTiles.empty()) {
-                _stageBuilder->addSplitStage(
-                    model,
-                    origStage->name() + "@split-input",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwInputTilesOffsets),
-                    hwStageTiler.hwInput,
-                    hwStageTiler.hwInputTiles);
-            }
+        //
+        // Split/concat input/output tiles
+        //
 
-            if (!hwStageTiler.hwWeightsTiles.empty()) {
-                _stageBuilder->addSplitStage(
-                    model,
-                    origStage->name() + "@split-input2",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwWeightsTilesOffsets),
-                    stageIO.origWeights,
-                    hwStageTiler.hwWeightsTiles);
-            }
+        if (!hwStageTiler.hwInputTiles.empty()) {
+            _stageBuilder->addSplitStage(
+                model,
+                origStage->name() + "@split-input",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwInputTilesOffsets),
+                hwStageTiler.hwInput,
+                hwStageTiler.hwInputTiles);
+        }
 
-            if (!hwStageTiler.hwOutputTiles.empty()) {
-                _stageBuilder->addConcatStage(
-                    model,
-                    origStage->name() + "@concat-output",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwOutputTilesOffsets),
-                    hwStageTiler.hwOutputTiles,
-                    hwStageTiler.hwOutput);
-            }
+        if (!hwStageTiler.hwWeightsTiles.empty()) {
+            _stageBuilder->addSplitStage(
+                model,
+                origStage->name() + "@split-input2",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwWeightsTilesOffsets),
+                stageIO.origWeights,
+                hwStageTiler.hwWeightsTiles);
+        }
+
+        if (!hwStageTiler.hwOutputTiles.empty()) {
+            _stageBuilder->addConcatStage(
+                model,
+                origStage->name() + "@concat-output",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwOutputTilesOffsets),
+                hwStageTiler.hwOutputTiles,
+                hwStageTiler.hwOutput);
         }
 
         //
@@ -9,7 +9,9 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <algorithm>
 
+#include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
@@ -50,7 +52,8 @@ void PassImpl::run(const Model& model) {
         // Try to find "best" tiling
         //
 
-        const size_t tilingsCount = 1;
+        const auto tilingChoice = CompileEnv::get().config.hwTilingChoice(origStage->origLayerName());
+        const size_t tilingsCount = static_cast<size_t>(tilingChoice) + 1;
         const HWTilingNS::Direction direction =
                 HWTilingNS::Direction::INPUT_TO_OUTPUT;
         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
@@ -100,31 +103,33 @@ void PassImpl::run(const Model& model) {
         model->disconnectStage(origStage);
 
 
-        for (const auto &tiling : tiler.getHwTilings()) {
-            HWPoolStageTiler hwStageTiler(stageOptions, stageIO, model, origStage, _stageBuilder, tiling);
-            //
-            // Split/concat input/output tiles
-            //
+        // tilings are sorted by cost, the requested one may be absent if the layer has fewer tilings
+        const auto& hwTilings = tiler.getHwTilings();
+        const auto& tiling = hwTilings[std::min(static_cast<size_t>(tilingChoice), hwTilings.size() - 1)];
 
-            if (!hwStageTiler.hwInputTiles.empty()) {
-                _stageBuilder->addSplitStage(
-                    model,
-                    origStage->name() + "@split-input",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwInputTilesOffsets),
-                    hwStageTiler.hwInput,
-                    hwStageTiler.hwInputTiles);
-            }
+        HWPoolStageTiler hwStageTiler(stageOptions, stageIO, model, origStage, _stageBuilder, tiling);
+        //
+        // Split/concat input/output tiles
+        //
 
-            if (!hwStageTiler.hwOutputTiles.empty()) {
-                _stageBuilder->addConcatStage(
-                    model,
-                    origStage->name() + "@concat-output",
-                    origStage->origLayer(),
-                    std::move(hwStageTiler.hwOutputTilesOffsets),
-                    hwStageTiler.hwOutputTiles,
-                    hwStageTiler.hwOutput);
-            }
+        if (!hwStageTiler.hwInputTiles.empty()) {
+            _stageBuilder->addSplitStage(
+                model,
+                origStage->name() + "@split-input",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwInputTilesOffsets),
+                hwStageTiler.hwInput,
+                hwStageTiler.hwInputTiles);
+        }
+
+        if (!hwStageTiler.hwOutputTiles.empty()) {
+            _stageBuilder->addConcatStage(
+                model,
+                origStage->name() + "@concat-output",
+                origStage->origLayer(),
+                std::move(hwStageTiler.hwOutputTilesOffsets),
+                hwStageTiler.hwOutputTiles,
+                hwStageTiler.hwOutput);
         }
 
         model->removeStage(origStage);
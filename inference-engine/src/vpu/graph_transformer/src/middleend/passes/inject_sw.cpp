@@ -13,6 +13,7 @@
 #include <memory>
 #include <set>
 #include <list>
+#include <cstdlib>
 
 #include <vpu/middleend/allocator/allocator.hpp>
 #include <vpu/compile_env.hpp>
@@ -36,6 +37,40 @@ private:
 
 const char PassImpl::s_loopAttribute[] = "loop";
 
+// Stages which must be executed strictly before or after the stage
+StageSet collectDependentStages(const Stage& stage) {
+    StageSet dependent;
+
+    StageVector stack;
+    for (const auto& prev : stage->prevStages()) {
+        stack.push_back(prev);
+    }
+    while (!stack.empty()) {
+        const auto cur = stack.back();
+        stack.pop_back();
+        if (dependent.emplace(cur).second) {
+            for (const auto& prev : cur->prevStages()) {
+                stack.push_back(prev);
+            }
+        }
+    }
+
+    for (const auto& next : stage->nextStages()) {
+        stack.push_back(next);
+    }
+    while (!stack.empty()) {
+        const auto cur = stack.back();
+        stack.pop_back();
+        if (dependent.emplace(cur).second) {
+            for (const auto& next : cur->nextStages()) {
+                stack.push_back(next);
+            }
+        }
+    }
+
+    return dependent;
+}
+
 void PassImpl::markModelWithLoops(const vpu::Model &model) const {
     std::stack<Stage> loops;
     for (const auto& stage : model->getStages()) {
@@ -103,6 +138,8 @@ void PassImpl::run(const Model& model) {
 
         model->buildStageOrder();
 
+        const auto dependentStages = collectDependentStages(hwStage);
+
         for (const auto& swStage : swStages) {
             auto hwInd = hwStage->index();
             IE_ASSERT(hwInd >= 0);
@@ -119,48 +156,20 @@ void PassImpl::run(const Model& model) {
             }
 
             //
-            // Check execution order
+            // Stages connected by a data path must keep their order, independent ones (e.g. from different
+            // branches) can be executed at the same time regardless of their positions in current order
             //
 
-            bool isOK = true;
-
-            if (swInd > hwInd) {
-                //
-                // SW producer must be executed after HW stage
-                //
-
-                for (const auto& swProducer : swStage->prevStages()) {
-                    auto swProducerInd = swProducer->index();
-                    IE_ASSERT(swProducerInd >= 0);
-                    IE_ASSERT(swProducerInd < swInd);
-
-                    if (swProducerInd >= hwInd) {
-                        isOK = false;
-                        break;
-                    }
-                }
-            } else {
-                //
-                // HW producer must be executed after SW stage
-                //
-
-                for (const auto& hwProducer : hwStage->prevStages()) {
-                    auto hwProducerInd = hwProducer->index();
-                    IE_ASSERT(hwProducerInd >= 0);
-                    IE_ASSERT(hwProducerInd < hwInd);
-
-                    if (hwProducerInd >= swInd) {
-                        isOK = false;
-                        break;
-                    }
-                }
-            }
-
-            if (isOK) {
+            if (dependentStages.count(swStage) == 0) {
                 swCandidates.push_back(swStage);
             }
         }
 
+        // nearest stages first to keep lifetimes of their data short
+        std::stable_sort(swCandidates.begin(), swCandidates.end(), [&hwStage](const Stage& lhs, const Stage& rhs) {
+            return std::abs(lhs->index() - hwStage->index()) < std::abs(rhs->index() - hwStage->index());
+        });
+
         for (const auto& swStage : swCandidates) {
             //
             // Try to inject and check allocation, if it is failed -> revert
@@ -49,6 +49,7 @@ IE_SUPPRESS_DEPRECATED_START
         ie::MYRIAD_NUMBER_OF_SHAVES,
         ie::MYRIAD_NUMBER_OF_CMX_SLICES,
         ie::MYRIAD_TILING_CMX_LIMIT_KB,
+        ie::MYRIAD_HW_TILING_CHOICES,
 
         ie::MYRIAD_TENSOR_STRIDES,
 
@@ -156,6 +157,26 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
         return stridesMap;
     };
 
+    static const auto parseTilingChoices = [](const std::string& src) {
+        std::map<std::string, int> choices;
+
+        for (const auto& item : ie::details::split(src, ",")) {
+            const auto separator = item.rfind(':');
+            IE_ASSERT(separator != std::string::npos && separator != 0)
+                    << "Invalid config value \"" << item << "\" "
+                    << "for MYRIAD_HW_TILING_CHOICES, does not match the pattern: layer_name:index";
+
+            const auto choice = std::stoi(item.substr(separator + 1));
+            IE_ASSERT(choice >= 0)
+                    << "Invalid config value \"" << item << "\" "
+                    << "for MYRIAD_HW_TILING_CHOICES, tiling index must be non-negative";
+
+            choices[item.substr(0, separator)] = choice;
+        }
+
+        return choices;
+    };
+
     const auto parseStringSet = [](const std::string& value) {
         return splitStringList<ie::details::caseless_set<std::string>>(value, ',');
     };
@@ -227,6 +248,7 @@ void ParsedConfig::parse(const std::map<std::string, std::string>& config) {
     }
 
     setOption(_compileConfig.ioStrides,                                config, ie::MYRIAD_TENSOR_STRIDES, parseStrides);
+    setOption(_compileConfig.hwTilingChoices,                          config, ie::MYRIAD_HW_TILING_CHOICES, parseTilingChoices);
 
     setOption(_printReceiveTensorTime,                       switches, config, ie::MYRIAD_ENABLE_RECEIVING_TENSOR_TIME);
     setOption(_perfCount,                                    switches, config, CONFIG_KEY(PERF_COUNT));
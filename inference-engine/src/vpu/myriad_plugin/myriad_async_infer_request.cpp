@@ -12,12 +12,18 @@ using namespace InferenceEngine;
 MyriadAsyncInferRequest::MyriadAsyncInferRequest(MyriadInferRequest::Ptr request,
                                                  const InferenceEngine::ITaskExecutor::Ptr &taskExecutorStart,
                                                  const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                                                 const InferenceEngine::ITaskExecutor::Ptr &taskExecutorSendInput,
                                                  const InferenceEngine::ITaskExecutor::Ptr &taskExecutorGetResult)
 : InferenceEngine::AsyncInferRequestThreadSafeDefault(request, taskExecutorStart, callbackExecutor),
-    _request(request), _taskExecutorGetResult(taskExecutorGetResult) {
+    _request(request), _taskExecutorSendInput(taskExecutorSendInput), _taskExecutorGetResult(taskExecutorGetResult) {
+        // host-side input packing, USB transfer of inputs and reading of results are separate stages,
+        // so while one request is executed on device the next one is already transferred to the input FIFO
         _pipeline = {
             {_requestExecutor, [this] {
-                _request->InferAsync();
+                _request->PrepareInput();
+            }},
+            {_taskExecutorSendInput, [this] {
+                _request->SendInput();
             }},
             {_taskExecutorGetResult, [this] {
                 _request->GetResult();
@@ -15,11 +15,13 @@ public:
     MyriadAsyncInferRequest(MyriadInferRequest::Ptr request,
                                 const InferenceEngine::ITaskExecutor::Ptr &taskExecutorStart,
                                 const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                                const InferenceEngine::ITaskExecutor::Ptr &taskExecutorSendInput,
                                 const InferenceEngine::ITaskExecutor::Ptr &taskExecutorGetResult);
 
     ~MyriadAsyncInferRequest() override;
 private:
     MyriadInferRequest::Ptr _request;
+    InferenceEngine::ITaskExecutor::Ptr _taskExecutorSendInput;
     InferenceEngine::ITaskExecutor::Ptr _taskExecutorGetResult;
 };
 
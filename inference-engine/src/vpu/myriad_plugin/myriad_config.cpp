@@ -31,6 +31,7 @@ const std::unordered_set<std::string>& MyriadConfig::getRunTimeOptions() const {
 IE_SUPPRESS_DEPRECATED_START
     static const std::unordered_set<std::string> options = merge(ParsedConfig::getRunTimeOptions(), {
         CONFIG_KEY(DEVICE_ID),
+        CONFIG_KEY(DYN_BATCH_ENABLED),
 
         ie::MYRIAD_ENABLE_FORCE_RESET,
 
@@ -128,6 +129,7 @@ IE_SUPPRESS_DEPRECATED_END
     setOption(_deviceConnectTimeout,                    config, ie::MYRIAD_DEVICE_CONNECT_TIMEOUT, parseSeconds);
     setOption(_powerConfig,      powerConfigs,          config, ie::MYRIAD_POWER_MANAGEMENT);
     setOption(_memoryType,       memoryTypes,           config, ie::MYRIAD_DDR_TYPE);
+    setOption(_enableDynamicBatch, switches,            config, CONFIG_KEY(DYN_BATCH_ENABLED));
 
 IE_SUPPRESS_DEPRECATED_START
     setOption(_forceReset,       switches,              config, VPU_MYRIAD_CONFIG_KEY(FORCE_RESET));
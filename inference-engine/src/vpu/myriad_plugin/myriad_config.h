@@ -72,6 +72,10 @@ public:
         return _memoryType;
     }
 
+    bool enableDynamicBatch() const {
+        return _enableDynamicBatch;
+    }
+
 protected:
     const std::unordered_set<std::string>& getCompileOptions() const override;
     const std::unordered_set<std::string>& getRunTimeOptions() const override;
@@ -88,6 +92,7 @@ private:
     std::chrono::seconds _deviceConnectTimeout = std::chrono::seconds(15);
     std::string _deviceName;
     MovidiusDdrType _memoryType = MovidiusDdrType::AUTO;
+    bool _enableDynamicBatch = false;
 };
 
 }  // namespace MyriadPlugin
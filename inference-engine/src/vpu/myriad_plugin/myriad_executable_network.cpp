@@ -7,6 +7,7 @@
 
 #include <ie_metric_helpers.hpp>
 #include <legacy/cnn_network_impl.hpp>
+#include <legacy/ie_util_internal.hpp>
 #include "exec_graph_info.hpp"
 #include <myriad_executable_network.h>
 #include <vpu/blob_reader.hpp>
@@ -14,6 +15,7 @@
 #include <vpu/utils/runtime_graph.hpp>
 #include <legacy/net_pass.h>
 #include <vpu/compile_env.hpp>
+#include <ie_load_time_breakdown.hpp>
 
 using namespace InferenceEngine;
 
@@ -46,7 +48,8 @@ ExecutableNetwork::ExecutableNetwork(
         METRIC_KEY(SUPPORTED_METRICS),
         METRIC_KEY(SUPPORTED_CONFIG_KEYS),
         METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
-        METRIC_KEY(DEVICE_THERMAL)
+        METRIC_KEY(DEVICE_THERMAL),
+        METRIC_KEY(LOAD_TIME_BREAKDOWN)
     };
 }
 
@@ -66,12 +69,31 @@ ExecutableNetwork::ExecutableNetwork(
 
     if (_device == nullptr)
         THROW_IE_EXCEPTION << "No device was detected";
-    auto compiledGraph = compileNetwork(
-        network,
-        static_cast<Platform>(_device->_platform),
-        _config.compileConfig(),
-        compilerLog,
-        _core);
+
+    // with dynamic batch the graph is compiled for a single frame and requests queue every frame separately,
+    // so the same graph serves any batch up to the network one
+    std::shared_ptr<ICNNNetwork> singleFrameNetwork;
+    if (_config.enableDynamicBatch() && network.getBatchSize() > 1) {
+        _maxBatch = static_cast<int>(network.getBatchSize());
+
+        singleFrameNetwork = cloneNetwork(network);
+        ResponseDesc resp;
+        if (singleFrameNetwork->setBatchSize(1, &resp) != StatusCode::OK) {
+            THROW_IE_EXCEPTION << "Failed to enable dynamic batch: " << resp.msg;
+        }
+    }
+
+    // the graph compiler runs transformations itself, they are measured separately from the blob compilation
+    CompiledGraph::Ptr compiledGraph;
+    {
+        LoadTimeScope loadTimeScope(LoadTimePhase::KernelCompilation);
+        compiledGraph = compileNetwork(
+            singleFrameNetwork != nullptr ? *singleFrameNetwork : network,
+            static_cast<Platform>(_device->_platform),
+            _config.compileConfig(),
+            compilerLog,
+            _core);
+    }
 
     _actualNumExecutors = compiledGraph->numExecutors;
     _graphBlob = std::move(compiledGraph->blob);
@@ -85,17 +107,17 @@ ExecutableNetwork::ExecutableNetwork(
     }
 
     const auto& networkName = network.getName();
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, compiledGraph->blobHeader, compiledGraph->numActiveStages, networkName, _actualNumExecutors);
+    {
+        LoadTimeScope loadTimeScope(LoadTimePhase::MemoryAllocation);
+        _executor->allocateGraph(_device, _graphDesc, _graphBlob, compiledGraph->blobHeader, compiledGraph->numActiveStages, networkName,
+                                  _actualNumExecutors, _maxBatch);
+    }
     if (_config.exclusiveAsyncRequests()) {
         ExecutorManager *executorManager = ExecutorManager::getInstance();
         _taskExecutor = executorManager->getExecutor("MYRIAD");
     }
 
-    for (size_t i = 0; i < _maxTaskExecutorGetResultCount; i++) {
-        std::stringstream idStream;
-        idStream << networkName << "_TaskExecutorGetResult" << i;
-        _taskExecutorGetResultIds.emplace(idStream.str());
-    }
+    initTaskExecutorIds(networkName);
 }
 
 void ExecutableNetwork::Import(std::istream& strm,
@@ -126,7 +148,7 @@ void ExecutableNetwork::Import(std::istream& strm,
     _inputInfo  = blobReader.getInputInfo();
     _outputInfo = blobReader.getOutputInfo();
 
-    _executor->allocateGraph(_device, _graphDesc, _graphBlob, blobHeader, numStages, networkName, _actualNumExecutors);
+    _executor->allocateGraph(_device, _graphDesc, _graphBlob, blobHeader, numStages, networkName, _actualNumExecutors, _maxBatch);
 
     _graphMetaData.stagesMeta.resize(numStages);
     for (auto &meta : _graphMetaData.stagesMeta) {
@@ -139,11 +161,25 @@ void ExecutableNetwork::Import(std::istream& strm,
         _taskExecutor = executorManager->getExecutor("MYRIAD");
     }
 
+    initTaskExecutorIds(networkName);
+}
+
+void ExecutableNetwork::initTaskExecutorIds(const std::string& networkName) {
+    // FIFOs of each device are served by own threads, so USB transfers to different devices do not wait for each other
     for (size_t i = 0; i < _maxTaskExecutorGetResultCount; i++) {
         std::stringstream idStream;
-        idStream << networkName << "_TaskExecutorGetResult" << i;
+        idStream << networkName << "_" << _device->_name << "_TaskExecutorGetResult" << i;
         _taskExecutorGetResultIds.emplace(idStream.str());
     }
+
+    // exclusive requests keep the whole input stage on the common executor
+    if (_config.exclusiveAsyncRequests()) {
+        _taskExecutorSendInputId = "MYRIAD";
+    } else {
+        std::stringstream idStream;
+        idStream << networkName << "_" << _device->_name << "_TaskExecutorSendInput";
+        _taskExecutorSendInputId = idStream.str();
+    }
 }
 
 ExecutableNetwork::ExecutableNetwork(std::istream& strm,
@@ -179,6 +215,8 @@ InferenceEngine::Parameter ExecutableNetwork::GetMetric(const std::string &name)
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(2u * _actualNumExecutors));
     } else if (name == METRIC_KEY(DEVICE_THERMAL)) {
         IE_SET_METRIC_RETURN(DEVICE_THERMAL, _executor->GetThermal(_device));
+    } else if (name == METRIC_KEY(LOAD_TIME_BREAKDOWN)) {
+        IE_SET_METRIC_RETURN(LOAD_TIME_BREAKDOWN, GetLoadTimeBreakdown());
     } else {
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
@@ -69,7 +69,7 @@ public:
         }
 
         return std::make_shared<MyriadInferRequest>(_graphDesc, networkInputs, networkOutputs,
-                                                    _inputInfo, _outputInfo,
+                                                    _inputInfo, _outputInfo, _maxBatch,
                                                     _graphMetaData.stagesMeta, _config, _log, _executor);
     }
 
@@ -81,13 +81,14 @@ public:
         }
 
         auto syncRequestImpl = std::make_shared<MyriadInferRequest>(_graphDesc, _networkInputs, _networkOutputs,
-                                                                    _inputInfo, _outputInfo,
+                                                                    _inputInfo, _outputInfo, _maxBatch,
                                                                     _graphMetaData.stagesMeta, _config, _log,
                                                                     _executor);
         syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+        auto taskExecutorSendInput = InferenceEngine::ExecutorManager::getInstance()->getExecutor(_taskExecutorSendInputId);
         auto taskExecutorGetResult = getNextTaskExecutor();
         auto asyncThreadSafeImpl = std::make_shared<MyriadAsyncInferRequest>(
-                syncRequestImpl, _taskExecutor, _callbackExecutor, taskExecutorGetResult);
+                syncRequestImpl, _taskExecutor, _callbackExecutor, taskExecutorSendInput, taskExecutorGetResult);
         asyncRequest.reset(new InferenceEngine::InferRequestBase<InferenceEngine::AsyncInferRequestThreadSafeDefault>(
                            asyncThreadSafeImpl),
                            [](InferenceEngine::IInferRequest *p) { p->Release(); });
@@ -127,6 +128,7 @@ private:
     MyriadConfig _config;
     const ie::ICore* _core = nullptr;
     int _actualNumExecutors = 0;
+    int _maxBatch = 1;
     std::vector<std::string> _supportedMetrics;
 
     DataInfo _inputInfo;
@@ -134,12 +136,15 @@ private:
 
     const size_t _maxTaskExecutorGetResultCount = 1;
     std::queue<std::string> _taskExecutorGetResultIds;
+    std::string _taskExecutorSendInputId;
 
     ExecutableNetwork(std::shared_ptr<IMvnc> mvnc,
         std::vector<DevicePtr> &devicePool,
         const MyriadConfig& config,
         const ie::ICore* core);
 
+    void initTaskExecutorIds(const std::string& networkName);
+
     InferenceEngine::ITaskExecutor::Ptr getNextTaskExecutor() {
         std::string id = _taskExecutorGetResultIds.front();
 
@@ -306,7 +306,8 @@ void MyriadExecutor::closeDevices(std::vector<DevicePtr> &devicePool, std::share
 void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
                                    const std::vector<char> &graphFileContent,
                                    const std::pair<const char*, size_t> &graphHeaderDesc,
-                                   size_t numStages, const std::string & networkName, int executors) {
+                                   size_t numStages, const std::string & networkName, int executors,
+                                   int framesPerRequest) {
     VPU_PROFILE(allocateGraph);
     _numStages = static_cast<int>(numStages);
     graphDesc._name = networkName;
@@ -370,6 +371,8 @@ void MyriadExecutor::allocateGraph(DevicePtr &device, GraphDesc &graphDesc,
     }
 
     unsigned int fifo_elements = (device->_platform == NC_MYRIAD_2 && executors == 1) ? 4 : 2 * executors;
+    // request result is read only after all its frames are queued, so the whole request must fit into FIFO
+    fifo_elements *= framesPerRequest;
 
     status = ncFifoCreate("input", NC_FIFO_HOST_WO, &graphDesc._inputFifoHandle);
     if (status != NC_OK) {
@@ -96,7 +96,8 @@ public:
                        const std::pair<const char*, size_t> &graphHeaderDesc,
                        size_t numStages,
                        const std::string & networkName,
-                       int executors);
+                       int executors,
+                       int framesPerRequest);
 
     void deallocateGraph(DevicePtr &device, GraphDesc &graphDesc);
 
@@ -28,6 +28,7 @@ MyriadInferRequest::MyriadInferRequest(GraphDesc &graphDesc,
                                        InferenceEngine::OutputsDataMap networkOutputs,
                                        DataInfo& compilerInputsInfo,
                                        DataInfo& compilerOutputsInfo,
+                                       int maxBatch,
                                        const std::vector<StageMetaInfo> &blobMetaData,
                                        const MyriadConfig& myriadConfig,
                                        const Logger::Ptr &log,
@@ -35,6 +36,7 @@ MyriadInferRequest::MyriadInferRequest(GraphDesc &graphDesc,
         InferRequestInternal(networkInputs, networkOutputs), _executor(executor),
         _log(log), _stagesMetaData(blobMetaData), _config(myriadConfig),
         _inputInfo(compilerInputsInfo), _outputInfo(compilerOutputsInfo),
+        _maxBatch(maxBatch), _batch(maxBatch),
         _graphDesc(graphDesc) {
     VPU_PROFILE(MyriadInferRequest);
 
@@ -77,12 +79,57 @@ MyriadInferRequest::MyriadInferRequest(GraphDesc &graphDesc,
         _outputs[networkOutput.first] = outputBlob;
     }
 
-    inputBuffer .resize(compilerInputsInfo.totalSize);
-    resultBuffer.resize(compilerOutputsInfo.totalSize);
+    inputBuffer .resize(compilerInputsInfo.totalSize * _maxBatch);
+    resultBuffer.resize(compilerOutputsInfo.totalSize * _maxBatch);
 
     VPU_THROW_UNLESS(
         !_networkOutputs.empty() && !_networkInputs.empty(),
         "No information about network's output/input");
+
+    if (_maxBatch > 1) {
+        const auto isBatchOuter = [this](const Blob::Ptr& blob) {
+            const auto& desc = blob->getTensorDesc();
+            return !desc.getDims().empty() && desc.getDims()[0] == static_cast<size_t>(_maxBatch) &&
+                   desc.getBlockingDesc().getOrder()[0] == 0;
+        };
+        for (const auto& input : _inputs) {
+            VPU_THROW_UNLESS(isBatchOuter(input.second),
+                "Dynamic batch requires batch to be the outermost dimension of {} input", input.first);
+        }
+        for (const auto& output : _outputs) {
+            VPU_THROW_UNLESS(isBatchOuter(output.second),
+                "Dynamic batch requires batch to be the outermost dimension of {} output", output.first);
+            VPU_THROW_UNLESS(_outputInfo.offset.find(output.first + "@shape") == _outputInfo.offset.end(),
+                "Dynamic batch is not supported for dynamic {} output", output.first);
+        }
+    }
+}
+
+// View of a single frame of blob with batch as the outermost dimension
+static Blob::Ptr frameBlob(const Blob::Ptr& blob, int frame, int batch) {
+    if (batch == 1) {
+        return blob;
+    }
+
+    auto desc = blob->getTensorDesc();
+    auto dims = desc.getDims();
+    dims[0] = 1;
+
+    const auto frameBytes = blob->byteSize() / batch;
+    return make_blob_with_precision(TensorDesc(desc.getPrecision(), dims, desc.getLayout()),
+                                    blob->buffer().as<uint8_t*>() + frame * frameBytes);
+}
+
+void MyriadInferRequest::SetBatch(int batch) {
+    if (_maxBatch == 1) {
+        THROW_IE_EXCEPTION << "Dynamic batch is not enabled.";
+    }
+
+    if (batch < 1 || batch > _maxBatch) {
+        THROW_IE_EXCEPTION << "Invalid dynamic batch size " << batch << " for this request.";
+    }
+
+    _batch = batch;
 }
 
 void MyriadInferRequest::InferImpl() {
@@ -93,6 +140,13 @@ void MyriadInferRequest::InferImpl() {
 void MyriadInferRequest::InferAsync() {
     VPU_PROFILE(InferAsync);
 
+    PrepareInput();
+    SendInput();
+}
+
+void MyriadInferRequest::PrepareInput() {
+    VPU_PROFILE(PrepareInput);
+
     // execute input pre-processing
     execDataPreprocessing(_inputs, true);  // "true" stands for serial preprocessing in case of OpenMP
 
@@ -101,43 +155,67 @@ void MyriadInferRequest::InferAsync() {
 
     auto getOffset = [&inputInfo] (const std::string& name) {
         const auto offsetIt = inputInfo.offset.find(name);
-        IE_ASSERT(offsetIt != inputInfo.offset.end()) << "MyriadInferRequest::InferAsync()\n"
+        IE_ASSERT(offsetIt != inputInfo.offset.end()) << "MyriadInferRequest::PrepareInput()\n"
                                                       << "Input offset [" << name << "] is not provided.";
         return offsetIt->second;
     };
 
     auto getNetInputInfo = [&networkInputs] (const std::string& name) {
         const auto foundBlob = networkInputs.find(name);
-        IE_ASSERT(foundBlob != networkInputs.end()) << "MyriadInferRequest::InferAsync()\n"
+        IE_ASSERT(foundBlob != networkInputs.end()) << "MyriadInferRequest::PrepareInput()\n"
                                                     << "Input [" << name << "] is not provided.";
         return foundBlob;
     };
 
-    for (const auto& input : _inputs) {
-        const auto& name = input.first;
-        const auto& blob = input.second;
-
-        const auto offset = getOffset(name);
-        const auto byteSize = blob->byteSize();
-        const auto requiredSize = vpu::checked_cast<size_t>(offset) + byteSize;
-        IE_ASSERT(requiredSize <= inputBuffer.size())  << "MyriadInferRequest::InferAsync()\n"
-                                                       << "Input offset is too big."
-                                                       << "Required size: " << requiredSize
-                                                       << "Input buffer size: " << inputBuffer.size();
+    // single input which already has device layout doesn't need to be gathered into the input buffer
+    if (_inputs.size() == 1) {
+        const auto& name = _inputs.begin()->first;
+        const auto& blob = _inputs.begin()->second;
+        const auto frameSize = static_cast<size_t>(_inputInfo.totalSize);
 
-        const auto foundBlob = getNetInputInfo(name);
-        const auto vpuLayout = foundBlob->second->getTensorDesc().getLayout();
-        const auto layout = blob->getTensorDesc().getLayout();
-
-        if (layout != vpuLayout) {
-            copyBlob(blob, vpuLayout, &inputBuffer[offset]);
-        } else {
-            MEMCPY(&inputBuffer[offset], blob->buffer().as<uint8_t*>(), byteSize);
+        if (getOffset(name) == 0 && blob->byteSize() == frameSize * _maxBatch &&
+            blob->getTensorDesc().getLayout() == getNetInputInfo(name)->second->getTensorDesc().getLayout()) {
+            inputPtr = blob->buffer().as<uint8_t*>();
+            return;
+        }
+    }
+    inputPtr = inputBuffer.data();
+
+    for (int frame = 0; frame < _batch; frame++) {
+        const auto frameBuffer = &inputBuffer[frame * _inputInfo.totalSize];
+
+        for (const auto& input : _inputs) {
+            const auto& name = input.first;
+            const auto blob = frameBlob(input.second, frame, _maxBatch);
+
+            const auto offset = getOffset(name);
+            const auto byteSize = blob->byteSize();
+            const auto requiredSize = vpu::checked_cast<size_t>(offset) + byteSize;
+            IE_ASSERT(requiredSize <= static_cast<size_t>(_inputInfo.totalSize))  << "MyriadInferRequest::PrepareInput()\n"
+                                                                                 << "Input offset is too big."
+                                                                                 << "Required size: " << requiredSize
+                                                                                 << "Input buffer size: " << _inputInfo.totalSize;
+
+            const auto foundBlob = getNetInputInfo(name);
+            const auto vpuLayout = foundBlob->second->getTensorDesc().getLayout();
+            const auto layout = blob->getTensorDesc().getLayout();
+
+            if (layout != vpuLayout) {
+                copyBlob(blob, vpuLayout, &frameBuffer[offset]);
+            } else {
+                MEMCPY(&frameBuffer[offset], blob->buffer().as<uint8_t*>(), byteSize);
+            }
         }
     }
+}
+
+void MyriadInferRequest::SendInput() {
+    VPU_PROFILE(SendInput);
 
-    _executor->queueInference(_graphDesc, inputBuffer.data(),
-                              _inputInfo.totalSize, nullptr, 0);
+    for (int frame = 0; frame < _batch; frame++) {
+        _executor->queueInference(_graphDesc, &inputPtr[frame * _inputInfo.totalSize],
+                                  _inputInfo.totalSize, nullptr, 0);
+    }
 }
 
 static void copyBlobAccordingUpperBound(
@@ -201,6 +279,11 @@ void MyriadInferRequest::GetResult() {
         return foundBlob->second->getTensorDesc().getLayout();
     };
 
+    if (_maxBatch > 1) {
+        GetFramesResult();
+        return;
+    }
+
     // For networks with only one output
     if (_outputInfo.offset.size() == 1) {
         const auto& it = _outputs.begin();
@@ -280,6 +363,30 @@ void MyriadInferRequest::GetResult() {
     }
 }
 
+void MyriadInferRequest::GetFramesResult() {
+    const auto frameSize = static_cast<size_t>(_outputInfo.totalSize);
+
+    for (int frame = 0; frame < _batch; frame++) {
+        const auto frameBuffer = &resultBuffer[frame * frameSize];
+        _executor->getResult(_graphDesc, frameBuffer, static_cast<unsigned>(frameSize));
+
+        for (const auto& output : _outputs) {
+            const auto offsetIt = _outputInfo.offset.find(output.first);
+            IE_ASSERT(offsetIt != _outputInfo.offset.end())  << "MyriadInferRequest::GetResult()\n"
+                                                             << "Output offset [" << output.first << "] error.";
+
+            const auto ieBlob = frameBlob(output.second, frame, _maxBatch);
+            const auto& ieOutDesc = ieBlob->getTensorDesc();
+            const auto vpuLayout = _networkOutputs[output.first]->getTensorDesc().getLayout();
+
+            const auto tmpBlob = make_blob_with_precision(
+                ie::TensorDesc{ieOutDesc.getPrecision(), ieOutDesc.getDims(), vpuLayout},
+                frameBuffer + vpu::checked_cast<size_t>(offsetIt->second));
+            copyBlob(tmpBlob, ieBlob);
+        }
+    }
+}
+
 void MyriadInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
     auto perfInfo = _executor->getPerfTimeInfo(_graphDesc._graphHandle);
 
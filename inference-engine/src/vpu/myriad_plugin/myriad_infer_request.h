@@ -31,9 +31,17 @@ class MyriadInferRequest : public InferenceEngine::InferRequestInternal {
     const DataInfo _inputInfo;
     const DataInfo _outputInfo;
 
+    // graph is compiled for a single frame when dynamic batch is enabled, frames are queued one by one
+    const int _maxBatch;
+    int _batch;
+
     GraphDesc _graphDesc;
     std::vector<uint8_t> resultBuffer;
     std::vector<uint8_t> inputBuffer;
+    // points either to inputBuffer or to the memory of the single input blob which is sent as is
+    uint8_t* inputPtr = nullptr;
+
+    void GetFramesResult();
 
 public:
     typedef std::shared_ptr<MyriadInferRequest> Ptr;
@@ -43,6 +51,7 @@ public:
                                 InferenceEngine::OutputsDataMap networkOutputs,
                                 DataInfo& compilerInputsInfo,
                                 DataInfo& compilerOutputsInfo,
+                                int maxBatch,
                                 const std::vector<StageMetaInfo> &blobMetaData,
                                 const MyriadConfig &myriadConfig,
                                 const Logger::Ptr &log,
@@ -50,8 +59,12 @@ public:
 
     void InferImpl() override;
     void InferAsync();
+    void PrepareInput();
+    void SendInput();
     void GetResult();
 
+    void SetBatch(int batch) override;
+
     void
     GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
 };
@@ -26,6 +26,7 @@ MyriadMetrics::MyriadMetrics() {
         METRIC_KEY(OPTIMIZATION_CAPABILITIES),
         METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
         METRIC_KEY(DEVICE_THERMAL),
+        METRIC_KEY(IMPORT_EXPORT_SUPPORT),
     };
 
 IE_SUPPRESS_DEPRECATED_START
@@ -46,7 +47,8 @@ IE_SUPPRESS_DEPRECATED_START
         CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
         CONFIG_KEY(PERF_COUNT),
         CONFIG_KEY(CONFIG_FILE),
-        CONFIG_KEY(DEVICE_ID)
+        CONFIG_KEY(DEVICE_ID),
+        CONFIG_KEY(DYN_BATCH_ENABLED)
     };
 IE_SUPPRESS_DEPRECATED_END
 
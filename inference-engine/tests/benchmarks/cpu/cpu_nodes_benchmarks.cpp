@@ -0,0 +1,245 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <ngraph/opsets/opset4.hpp>
+
+using namespace InferenceEngine;
+using namespace ngraph;
+
+namespace {
+
+/**
+ * @brief A single operation network and a number of floating point operations of its inference.
+ *        Zero means that the operation is memory bound and only GB/s is reported.
+ */
+struct NodeCase {
+    std::shared_ptr<Function> function;
+    double flops;
+};
+
+using NodeCaseFactory = std::function<NodeCase(const Shape&)>;
+
+std::shared_ptr<Function> makeFunction(const std::shared_ptr<Node>& node, const ParameterVector& params) {
+    ResultVector results;
+    for (auto&& output : node->outputs()) {
+        results.push_back(std::make_shared<opset4::Result>(output));
+    }
+    return std::make_shared<Function>(results, params, node->get_type_name());
+}
+
+NodeCase makeEltwise(const Shape& shape) {
+    auto a = std::make_shared<opset4::Parameter>(element::f32, shape);
+    auto b = std::make_shared<opset4::Parameter>(element::f32, shape);
+    auto add = std::make_shared<opset4::Add>(a, b);
+    return {makeFunction(add, {a, b}), static_cast<double>(shape_size(shape))};
+}
+
+NodeCase makeInterpolate(const Shape& shape) {
+    auto data = std::make_shared<opset4::Parameter>(element::f32, shape);
+    Shape outShape = shape;
+    outShape[2] *= 2;
+    outShape[3] *= 2;
+    auto sizes = opset4::Constant::create(element::i64, Shape{2}, {outShape[2], outShape[3]});
+    auto scales = opset4::Constant::create(element::f32, Shape{2}, {2.f, 2.f});
+    auto axes = opset4::Constant::create(element::i64, Shape{2}, {2, 3});
+    opset4::Interpolate::InterpolateAttrs attrs(opset4::Interpolate::InterpolateMode::linear_onnx,
+                                                opset4::Interpolate::ShapeCalcMode::scales,
+                                                {0, 0, 0, 0}, {0, 0, 0, 0});
+    auto interpolate = std::make_shared<opset4::Interpolate>(data, sizes, scales, axes, attrs);
+    // bilinear interpolation takes 4 multiplications and 3 additions per output element
+    return {makeFunction(interpolate, {data}), 7.0 * shape_size(outShape)};
+}
+
+NodeCase makeReduce(const Shape& shape) {
+    auto data = std::make_shared<opset4::Parameter>(element::f32, shape);
+    auto axes = opset4::Constant::create(element::i64, Shape{2}, {2, 3});
+    auto reduce = std::make_shared<opset4::ReduceMean>(data, axes, true);
+    return {makeFunction(reduce, {data}), static_cast<double>(shape_size(shape))};
+}
+
+NodeCase makeMVN(const Shape& shape) {
+    auto data = std::make_shared<opset4::Parameter>(element::f32, shape);
+    auto mvn = std::make_shared<opset4::MVN>(data, false, true, 1e-9);
+    // mean, variance and normalization take 6 operations per element
+    return {makeFunction(mvn, {data}), 6.0 * shape_size(shape)};
+}
+
+NodeCase makeTopK(const Shape& shape) {
+    auto data = std::make_shared<opset4::Parameter>(element::f32, shape);
+    auto k = opset4::Constant::create(element::i64, Shape{}, {std::min<size_t>(10, shape[1])});
+    auto topk = std::make_shared<opset4::TopK>(data, k, 1, opset4::TopK::Mode::MAX, opset4::TopK::SortType::SORT_VALUES);
+    return {makeFunction(topk, {data}), 0.0};
+}
+
+NodeCase makeGather(const Shape& shape) {
+    auto data = std::make_shared<opset4::Parameter>(element::f32, shape);
+    std::vector<int64_t> indices(shape[1] / 2);
+    for (size_t i = 0; i < indices.size(); i++) {
+        indices[i] = static_cast<int64_t>(i * 2);
+    }
+    auto indicesConst = opset4::Constant::create(element::i64, Shape{indices.size()}, indices);
+    auto axis = opset4::Constant::create(element::i64, Shape{}, {1});
+    auto gather = std::make_shared<opset4::Gather>(data, indicesConst, axis);
+    return {makeFunction(gather, {data}), 0.0};
+}
+
+NodeCase makeNMS(const Shape& shape) {
+    // the shape is {number of classes, number of boxes}
+    auto boxes = std::make_shared<opset4::Parameter>(element::f32, Shape{1, shape[1], 4});
+    auto scores = std::make_shared<opset4::Parameter>(element::f32, Shape{1, shape[0], shape[1]});
+    auto maxOutput = opset4::Constant::create(element::i64, Shape{}, {100});
+    auto iouThreshold = opset4::Constant::create(element::f32, Shape{}, {0.5f});
+    auto scoreThreshold = opset4::Constant::create(element::f32, Shape{}, {0.f});
+    auto nms = std::make_shared<opset4::NonMaxSuppression>(boxes, scores, maxOutput, iouThreshold, scoreThreshold,
+                                                           opset4::NonMaxSuppression::BoxEncodingType::CORNER,
+                                                           true, element::i32);
+    return {makeFunction(nms, {boxes, scores}), 0.0};
+}
+
+NodeCase makeConvolution(const Shape& shape) {
+    auto data = std::make_shared<opset4::Parameter>(element::f32, shape);
+    const size_t channels = shape[1];
+    std::vector<float> weightsData(channels * channels * 9, 0.01f);
+    auto weights = opset4::Constant::create(element::f32, Shape{channels, channels, 3, 3}, weightsData);
+    auto convolution = std::make_shared<opset4::Convolution>(data, weights, Strides{1, 1}, CoordinateDiff{1, 1},
+                                                             CoordinateDiff{1, 1}, Strides{1, 1});
+    return {makeFunction(convolution, {data}), 2.0 * shape_size(shape) * channels * 9};
+}
+
+std::string toString(const Shape& shape) {
+    std::stringstream ss;
+    for (size_t i = 0; i < shape.size(); i++) {
+        ss << (i ? "x" : "") << shape[i];
+    }
+    return ss.str();
+}
+
+void fillRandom(const Blob::Ptr& blob, std::mt19937& generator) {
+    std::uniform_real_distribution<float> distribution(0.f, 1.f);
+    auto data = blob->buffer().as<float*>();
+    for (size_t i = 0; i < blob->size(); i++) {
+        data[i] = distribution(generator);
+    }
+}
+
+Core& getCore() {
+    static Core core;
+    return core;
+}
+
+void runNodeCase(benchmark::State& state, const NodeCaseFactory& factory, const Shape& shape, bool bf16) {
+    auto nodeCase = factory(shape);
+    CNNNetwork network(nodeCase.function);
+    for (auto&& input : network.getInputsInfo()) {
+        input.second->setPrecision(Precision::FP32);
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        if (output.second->getPrecision() == Precision::FP32 || output.second->getPrecision() == Precision::FP16) {
+            output.second->setPrecision(Precision::FP32);
+        }
+    }
+
+    auto executableNetwork = getCore().LoadNetwork(network, "CPU", {
+        {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "1"},
+        {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(YES)},
+        {CONFIG_KEY(ENFORCE_BF16), bf16 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)}});
+    auto request = executableNetwork.CreateInferRequest();
+
+    std::mt19937 generator(42);
+    size_t bytes = 0;
+    for (auto&& input : network.getInputsInfo()) {
+        auto blob = request.GetBlob(input.first);
+        fillRandom(blob, generator);
+        bytes += blob->byteSize();
+    }
+    for (auto&& output : network.getOutputsInfo()) {
+        bytes += request.GetBlob(output.first)->byteSize();
+    }
+
+    // warm up and collect implementations chosen by the plugin
+    request.Infer();
+    std::set<std::string> execTypes;
+    for (auto&& counter : request.GetPerformanceCounts()) {
+        if (counter.second.status == InferenceEngineProfileInfo::EXECUTED &&
+            std::string(counter.second.layer_type) != "Input" && std::string(counter.second.layer_type) != "Output") {
+            execTypes.insert(counter.second.exec_type);
+        }
+    }
+
+    for (auto _ : state) {
+        request.Infer();
+    }
+
+    if (nodeCase.flops > 0) {
+        state.counters["GFLOP/s"] = benchmark::Counter(nodeCase.flops * 1e-9,
+                                                       benchmark::Counter::kIsIterationInvariantRate);
+    }
+    state.counters["GB/s"] = benchmark::Counter(static_cast<double>(bytes) * 1e-9,
+                                                benchmark::Counter::kIsIterationInvariantRate);
+
+    std::string label;
+    for (auto&& execType : execTypes) {
+        label += (label.empty() ? "" : ",") + execType;
+    }
+    state.SetLabel(label);
+}
+
+void registerBenchmarks() {
+    const std::vector<Shape> shapes4D = {{1, 64, 56, 56}, {1, 256, 14, 14}, {8, 32, 112, 112}};
+    const std::vector<Shape> convolutionShapes = {{1, 64, 56, 56}, {1, 256, 14, 14}};
+    const std::vector<Shape> nmsShapes = {{1, 1000}, {80, 10000}};
+    const std::vector<std::pair<std::string, std::pair<NodeCaseFactory, std::vector<Shape>>>> nodes = {
+        {"Eltwise", {makeEltwise, shapes4D}},
+        {"Interpolate", {makeInterpolate, shapes4D}},
+        {"Reduce", {makeReduce, shapes4D}},
+        {"MVN", {makeMVN, shapes4D}},
+        {"TopK", {makeTopK, shapes4D}},
+        {"Gather", {makeGather, shapes4D}},
+        {"NMS", {makeNMS, nmsShapes}},
+        {"Convolution", {makeConvolution, convolutionShapes}},
+    };
+
+    std::vector<bool> bf16Modes = {false};
+    if (with_cpu_x86_bfloat16()) {
+        bf16Modes.push_back(true);
+    }
+
+    for (auto&& node : nodes) {
+        for (auto&& shape : node.second.second) {
+            for (bool bf16 : bf16Modes) {
+                auto name = node.first + "/" + toString(shape) + "/" + (bf16 ? "BF16" : "FP32");
+                auto factory = node.second.first;
+                benchmark::RegisterBenchmark(name.c_str(), [factory, shape, bf16](benchmark::State& state) {
+                    runNodeCase(state, factory, shape, bf16);
+                })->Unit(benchmark::kMicrosecond);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    registerBenchmarks();
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -132,6 +132,26 @@ TEST(ConditionalCompilationTests, Factory) {
 #undef CCTests_TestNode2
 }
 
+TEST(ConditionalCompilationTests, IsaSelection) {
+#define CCTests_ISA_avx2 1
+
+    auto selectIsa = [] (bool isAvx512Supported, bool isAvx2Supported) {
+        if (OV_ISA(CCTests, avx512_common, isAvx512Supported))
+            return 512;
+        else if (OV_ISA(CCTests, avx2, isAvx2Supported))
+            return 256;
+        return 0;
+    };
+
+    // avx512_common is disabled, so selection falls through to avx2
+    EXPECT_EQ(selectIsa(true, true), 256);
+    EXPECT_EQ(selectIsa(false, true), 256);
+    // enabled ISA still requires the runtime check to pass
+    EXPECT_EQ(selectIsa(false, false), 0);
+
+#undef CCTests_ISA_avx2
+}
+
 #undef SELECTIVE_BUILD
 
 #ifdef SELECTIVE_BUILD_ANALYZER_ON
@@ -99,6 +99,16 @@ TEST(ConditionalCompilationTests, FactoryAnalysys) {
     delete node2;
 }
 
+TEST(ConditionalCompilationTests, IsaSelectionAnalysys) {
+    int n = 0;
+
+    if (OV_ISA(CCTests, avx512_common, false))
+        n = 512;
+    else if (OV_ISA(CCTests, avx2, true))
+        n = 256;
+    EXPECT_EQ(n, 256);
+}
+
 #undef SELECTIVE_BUILD_ANALYZER
 
 #ifdef SELECTIVE_BUILD_ANALYZER_ON
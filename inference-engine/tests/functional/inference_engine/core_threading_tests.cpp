@@ -19,6 +19,7 @@
 #include <mutex>
 #include <chrono>
 #include <fstream>
+#include <algorithm>
 
 class CoreThreadingTests : public ::testing::Test {
 public:
@@ -116,6 +117,34 @@ TEST_F(CoreThreadingTests, RegisterPlugins) {
     }, 1000);
 }
 
+// tested function: GetVersions of plugins which are created in parallel
+TEST_F(CoreThreadingTests, CreateDifferentPlugins) {
+    InferenceEngine::Core ie;
+    const unsigned int pluginsNum = 8;
+    for (unsigned int i = 0; i < pluginsNum; ++i) {
+        ie.RegisterPlugin(std::string("mock_engine") + IE_BUILD_POSTFIX, "MOCK" + std::to_string(i));
+    }
+
+    std::atomic<unsigned int> index{0};
+    runParallel([&] () {
+        const std::string deviceName = "MOCK" + std::to_string(index++ % pluginsNum);
+        ASSERT_EQ(1, ie.GetVersions(deviceName).size());
+    }, 100);
+}
+
+// tested function: GetAvailableDevices skips plugins which cannot be created
+TEST_F(CoreThreadingTests, GetAvailableDevicesSkipsNotExistingPlugin) {
+    InferenceEngine::Core ie;
+    ie.RegisterPlugin("not_existing_plugin", "NOT_EXISTING");
+
+    runParallel([&] () {
+        std::vector<std::string> devices = ie.GetAvailableDevices();
+        ASSERT_EQ(devices.end(), std::find(devices.begin(), devices.end(), "NOT_EXISTING"));
+    }, 10, 4);
+
+    ASSERT_THROW(ie.GetVersions("NOT_EXISTING"), InferenceEngine::details::InferenceEngineException);
+}
+
 // tested function: GetAvailableDevices, UnregisterPlugin
 // TODO: some initialization (e.g. thread/dlopen) sporadically fails during such stress-test scenario
 TEST_F(CoreThreadingTests, DISABLED_GetAvailableDevices) {
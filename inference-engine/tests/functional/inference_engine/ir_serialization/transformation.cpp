@@ -3,6 +3,7 @@
 //
 
 #include <fstream>
+#include <sstream>
 
 #include "gtest/gtest.h"
 #include "ie_core.hpp"
@@ -55,3 +56,36 @@ TEST_F(SerializationTransformationTest, PassManagerInstantiation) {
     ASSERT_TRUE(xml.good());
     ASSERT_TRUE(bin.good());
 }
+
+TEST_F(SerializationTransformationTest, StreamInstantiation) {
+    std::stringstream xml, bin;
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::Serialize>(xml, bin);
+    manager.run_passes(m_function);
+
+    const auto weights = bin.str();
+    auto blob = InferenceEngine::make_shared_blob<uint8_t>(
+        {InferenceEngine::Precision::U8, {weights.size()}, InferenceEngine::Layout::C});
+    blob->allocate();
+    std::copy(weights.begin(), weights.end(), blob->buffer().as<char*>());
+
+    InferenceEngine::Core ie;
+    auto network = ie.ReadNetwork(xml.str(), blob);
+    ASSERT_EQ(m_function->get_ops().size(), network.getFunction()->get_ops().size());
+}
+
+TEST_F(SerializationTransformationTest, DeduplicatedConstants) {
+    auto input = std::make_shared<ngraph::op::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4});
+    auto first = ngraph::op::Constant::create(ngraph::element::f32, ngraph::Shape{1, 4}, {1, 2, 3, 4});
+    auto second = ngraph::op::Constant::create(ngraph::element::f32, ngraph::Shape{1, 4}, {1, 2, 3, 4});
+    auto add = std::make_shared<ngraph::op::v1::Add>(std::make_shared<ngraph::op::v1::Add>(input, first), second);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{input});
+
+    std::stringstream xml, bin, dedup_xml, dedup_bin;
+    ngraph::pass::Serialize(xml, bin).run_on_function(function);
+    ngraph::pass::Serialize(dedup_xml, dedup_bin, ngraph::pass::Serialize::Version::IR_V10, {}, true)
+        .run_on_function(function);
+
+    ASSERT_EQ(2 * 4 * sizeof(float), bin.str().size());
+    ASSERT_EQ(4 * sizeof(float), dedup_bin.str().size());
+}
@@ -0,0 +1,131 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ie_load_time_breakdown.hpp>
+
+using namespace InferenceEngine;
+
+namespace {
+void sleepMs(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+}  // namespace
+
+TEST(LoadTimeBreakdownTests, phasesAreNotMeasuredWithoutActivation) {
+    ASSERT_EQ(nullptr, LoadTimeBreakdown::GetActive());
+    ASSERT_NO_THROW(LoadTimeScope{LoadTimePhase::GraphInit});
+}
+
+TEST(LoadTimeBreakdownTests, activationMeasuresTotalAndIsRestored) {
+    LoadTimeBreakdown::Ptr breakdown;
+    {
+        LoadTimeBreakdownActivation activation;
+        breakdown = activation.Get();
+        ASSERT_EQ(breakdown, LoadTimeBreakdown::GetActive());
+        {
+            LoadTimeBreakdownActivation nested;
+            ASSERT_EQ(breakdown, nested.Get());
+        }
+        ASSERT_EQ(breakdown, LoadTimeBreakdown::GetActive());
+        LoadTimeScope scope{LoadTimePhase::Cloning};
+        sleepMs(5);
+    }
+    ASSERT_EQ(nullptr, LoadTimeBreakdown::GetActive());
+
+    auto phases = breakdown->Get();
+    ASSERT_EQ(1u, phases.count(LoadTimePhase::Total));
+    ASSERT_EQ(1u, phases.count(LoadTimePhase::Other));
+    ASSERT_GE(phases[LoadTimePhase::Cloning], 5.f);
+    ASSERT_GE(phases[LoadTimePhase::Total], phases[LoadTimePhase::Cloning]);
+}
+
+TEST(LoadTimeBreakdownTests, nestedScopesAreExclusive) {
+    LoadTimeBreakdownActivation activation;
+    {
+        LoadTimeScope outer{LoadTimePhase::Transformations};
+        sleepMs(5);
+        {
+            LoadTimeScope inner{LoadTimePhase::LegacyConversion};
+            sleepMs(50);
+        }
+    }
+    auto phases = activation.Get()->Get();
+    ASSERT_GE(phases[LoadTimePhase::LegacyConversion], 50.f);
+    ASSERT_GE(phases[LoadTimePhase::Transformations], 5.f);
+    ASSERT_LT(phases[LoadTimePhase::Transformations], 50.f);
+}
+
+TEST(LoadTimeBreakdownTests, phasesOfOtherThreadsAreSummed) {
+    LoadTimeBreakdownActivation activation;
+    auto breakdown = activation.Get();
+    std::thread worker([breakdown] {
+        LoadTimeBreakdownActivation workerActivation{breakdown};
+        LoadTimeScope scope{LoadTimePhase::KernelCompilation};
+        sleepMs(5);
+    });
+    {
+        LoadTimeScope scope{LoadTimePhase::KernelCompilation};
+        sleepMs(5);
+    }
+    worker.join();
+    ASSERT_GE(breakdown->Get()[LoadTimePhase::KernelCompilation], 10.f);
+}
+
+TEST(LoadTimeBreakdownTests, phaseCallbackIsNotifiedAndCanAbortPhase) {
+    LoadTimeBreakdownActivation activation;
+    std::vector<std::string> phases;
+    activation.Get()->SetPhaseCallback([&phases] (const char* phase) {
+        if (phase == std::string(LoadTimePhase::KernelCompilation)) {
+            throw std::runtime_error("cancelled");
+        }
+        phases.push_back(phase);
+    });
+    {
+        LoadTimeScope outer{LoadTimePhase::Transformations};
+        LoadTimeScope inner{LoadTimePhase::Cloning};
+    }
+    ASSERT_EQ((std::vector<std::string>{LoadTimePhase::Transformations, LoadTimePhase::Cloning}), phases);
+    ASSERT_THROW(LoadTimeScope{LoadTimePhase::KernelCompilation}, std::runtime_error);
+    // the aborted scope is not registered, so following scopes are measured as usual
+    activation.Get()->SetPhaseCallback({});
+    {
+        LoadTimeScope scope{LoadTimePhase::MemoryAllocation};
+        sleepMs(5);
+    }
+    auto times = activation.Get()->Get();
+    ASSERT_EQ(0u, times.count(LoadTimePhase::KernelCompilation));
+    ASSERT_GE(times[LoadTimePhase::MemoryAllocation], 5.f);
+}
+
+TEST(LoadTimeBreakdownTests, parallelLoadTasksUseBreakdownOfCallingThread) {
+    LoadTimeBreakdownActivation activation;
+    auto breakdown = activation.Get();
+    std::vector<std::function<void()>> tasks(3, [breakdown] {
+        ASSERT_EQ(breakdown, LoadTimeBreakdown::GetActive());
+        LoadTimeScope scope{LoadTimePhase::KernelCompilation};
+        sleepMs(5);
+    });
+    RunLoadTasksInParallel(tasks);
+    ASSERT_GE(breakdown->Get()[LoadTimePhase::KernelCompilation], 15.f);
+}
+
+TEST(LoadTimeBreakdownTests, parallelLoadTasksRethrowAfterAllAreFinished) {
+    std::atomic<int> finished{0};
+    std::vector<std::function<void()>> tasks = {
+        [] { throw std::runtime_error("load failed"); },
+        [&finished] { sleepMs(20); ++finished; },
+    };
+    ASSERT_THROW(RunLoadTasksInParallel(tasks), std::runtime_error);
+    ASSERT_EQ(1, finished.load());
+}
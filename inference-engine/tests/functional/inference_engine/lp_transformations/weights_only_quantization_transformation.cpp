@@ -0,0 +1,88 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include <transformations/init_node_info.hpp>
+#include "low_precision/weights_only_quantization.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+class WeightsOnlyQuantizationTests : public Test {
+public:
+    static std::shared_ptr<opset1::MatMul> transform(const Shape& weightsShape, const std::vector<float>& weights,
+                                                     bool transposeB) {
+        const size_t k = transposeB ? weightsShape.back() : weightsShape[weightsShape.size() - 2];
+        const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, k });
+        const auto constant = opset1::Constant::create(element::f32, weightsShape, weights);
+        const auto matMul = std::make_shared<opset1::MatMul>(input, constant, false, transposeB);
+        const auto function = std::make_shared<Function>(NodeVector{ matMul }, ParameterVector{ input });
+
+        pass::Manager manager;
+        manager.register_pass<pass::InitNodeInfo>();
+        manager.register_pass<pass::low_precision::WeightsOnlyQuantization>();
+        manager.run_passes(function);
+        return matMul;
+    }
+};
+
+TEST_F(WeightsOnlyQuantizationTests, perOutputChannel) {
+    // K = 4, N = 2, the second channel is zero
+    const auto matMul = transform(Shape{ 4, 2 }, { 0.75f, 0.f, -2.f, 0.f, 0.5f, 0.f, 0.25f, 0.f }, false);
+
+    const auto multiply = as_type_ptr<opset1::Multiply>(matMul->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, multiply);
+    ASSERT_EQ(1ul, multiply->get_rt_info().count("DEQUANTIZATION"));
+
+    const auto convert = as_type_ptr<opset1::Convert>(multiply->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, convert);
+    ASSERT_EQ(1ul, convert->get_rt_info().count("DISABLED_CONSTANT_FOLDING"));
+    ASSERT_EQ(element::f32, convert->get_output_element_type(0));
+
+    const auto weights = as_type_ptr<opset1::Constant>(convert->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, weights);
+    ASSERT_EQ(element::i8, weights->get_output_element_type(0));
+    ASSERT_EQ(std::vector<int8_t>({ 48, 0, -127, 0, 32, 0, 16, 0 }), weights->cast_vector<int8_t>());
+
+    const auto scales = as_type_ptr<opset1::Constant>(multiply->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, scales);
+    ASSERT_EQ(Shape({ 1, 2 }), scales->get_shape());
+    ASSERT_EQ(std::vector<float>({ 2.f / 127.f, 1.f }), scales->cast_vector<float>());
+}
+
+TEST_F(WeightsOnlyQuantizationTests, perOutputChannelTransposed) {
+    // N = 2, K = 3
+    const auto matMul = transform(Shape{ 2, 3 }, { 0.f, 1.27f, -0.5f, 127.f, -127.f, 12.7f }, true);
+
+    const auto multiply = as_type_ptr<opset1::Multiply>(matMul->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, multiply);
+    const auto weights = as_type_ptr<opset1::Constant>(multiply->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(0));
+    ASSERT_NE(nullptr, weights);
+    ASSERT_EQ(std::vector<int8_t>({ 0, 127, -50, 127, -127, 13 }), weights->cast_vector<int8_t>());
+
+    const auto scales = as_type_ptr<opset1::Constant>(multiply->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, scales);
+    ASSERT_EQ(Shape({ 2, 1 }), scales->get_shape());
+}
+
+TEST_F(WeightsOnlyQuantizationTests, notConstantWeights) {
+    const auto input = std::make_shared<opset1::Parameter>(element::f32, Shape{ 1, 4 });
+    const auto weights = std::make_shared<opset1::Parameter>(element::f32, Shape{ 4, 2 });
+    const auto matMul = std::make_shared<opset1::MatMul>(input, weights);
+    const auto function = std::make_shared<Function>(NodeVector{ matMul }, ParameterVector{ input, weights });
+
+    pass::Manager manager;
+    manager.register_pass<pass::low_precision::WeightsOnlyQuantization>();
+    manager.run_passes(function);
+
+    ASSERT_EQ(weights, matMul->get_input_node_shared_ptr(1));
+}
@@ -21,6 +21,7 @@
 #include <ngraph/op/relu.hpp>
 #include <ngraph/op/result.hpp>
 #include <ngraph/opsets/opset.hpp>
+#include <ngraph/opsets/opset3.hpp>
 #include <ngraph/graph_util.hpp>
 
 #include <legacy/ie_util_internal.hpp>
@@ -145,6 +146,37 @@ TEST_F(NGraphReshapeTests, ReshapeSpatialReLU) {
     ASSERT_EQ(ngraph->get_results()[0]->get_shape(), ngraph::Shape({1, 3, 25, 25}));
 }
 
+TEST_F(NGraphReshapeTests, CNNReshapeFoldsShapeSubgraph) {
+    std::shared_ptr<ngraph::Function> ngraph;
+    {
+        auto param = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+        param->set_friendly_name("data");
+        // ShapeOf->Gather->Concat->Reshape flattens all dimensions but batch
+        auto shape = std::make_shared<ngraph::opset3::ShapeOf>(param);
+        auto batch = std::make_shared<ngraph::opset3::Gather>(shape,
+            ngraph::opset3::Constant::create(ngraph::element::i64, {1}, {0}),
+            ngraph::opset3::Constant::create(ngraph::element::i64, {}, {0}));
+        auto pattern = std::make_shared<ngraph::opset3::Concat>(ngraph::OutputVector{batch,
+            ngraph::opset3::Constant::create(ngraph::element::i64, {1}, {-1})}, 0);
+        auto reshape = std::make_shared<ngraph::opset3::Reshape>(param, pattern, false);
+        // the weights subgraph doesn't define any shape
+        auto weights = std::make_shared<ngraph::opset3::Convert>(
+            ngraph::opset3::Constant::create(ngraph::element::f16, {48}, std::vector<float>(48, 1.f)), ngraph::element::f32);
+        auto add = std::make_shared<ngraph::opset3::Add>(reshape, weights);
+        add->set_friendly_name("add");
+        ngraph = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{param});
+    }
+
+    CNNNetwork cnnNetwork(ngraph);
+    ASSERT_EQ(SizeVector({1, 48}), cnnNetwork.getOutputsInfo()["add"]->getTensorDesc().getDims());
+
+    cnnNetwork.reshape({{"data", {2, 3, 4, 4}}});
+    ASSERT_EQ(SizeVector({2, 48}), cnnNetwork.getOutputsInfo()["add"]->getTensorDesc().getDims());
+
+    cnnNetwork.reshape({{"data", {5, 3, 4, 4}}});
+    ASSERT_EQ(SizeVector({5, 48}), cnnNetwork.getOutputsInfo()["add"]->getTensorDesc().getDims());
+}
+
 TEST_F(NGraphReshapeTests, CNNReshapeSpatialReLU) {
     std::shared_ptr<const ngraph::Function> ngraph;
     {
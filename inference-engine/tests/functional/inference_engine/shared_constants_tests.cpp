@@ -0,0 +1,122 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/op/constant.hpp>
+
+using namespace InferenceEngine;
+
+class SharedConstantsTests : public ::testing::Test {
+protected:
+    // x + const, the constant of 4 floats is read from the weights at the given offset
+    static std::string model(size_t offset) {
+        return R"V0G0N(
+<net name="shared_constants" version="10">
+    <layers>
+        <layer id="0" name="x" type="Parameter" version="opset1">
+            <data element_type="f32" shape="1,4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="const" type="Const" version="opset1">
+            <data element_type="f32" offset=")V0G0N" + std::to_string(offset) + R"V0G0N(" shape="1,4" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="sum" type="Add" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="sum/sink_port_0" type="Result" version="opset1">
+            <input>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+    }
+
+    static Blob::CPtr weights(const std::vector<float>& values) {
+        auto blob = make_shared_blob<uint8_t>({Precision::U8, {values.size() * sizeof(float)}, Layout::C});
+        blob->allocate();
+        std::copy(values.begin(), values.end(), blob->buffer().as<float*>());
+        return blob;
+    }
+
+    static const void* constData(const CNNNetwork& network) {
+        for (auto&& node : network.getFunction()->get_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<const ngraph::op::Constant>(node))
+                return constant->get_data_ptr();
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(SharedConstantsTests, constantsAreNotSharedByDefault) {
+    Core ie;
+    auto first = ie.ReadNetwork(model(0), weights({1, 2, 3, 4}));
+    auto second = ie.ReadNetwork(model(0), weights({1, 2, 3, 4}));
+    ASSERT_NE(constData(first), constData(second));
+}
+
+TEST_F(SharedConstantsTests, equalConstantsShareBuffer) {
+    Core ie;
+    ie.SetConfig({{CONFIG_KEY(SHARE_CONSTANTS), CONFIG_VALUE(YES)}});
+    auto first = ie.ReadNetwork(model(0), weights({1, 2, 3, 4}));
+    auto second = ie.ReadNetwork(model(16), weights({0, 0, 0, 0, 1, 2, 3, 4}));
+    auto different = ie.ReadNetwork(model(0), weights({1, 2, 3, 5}));
+
+    ASSERT_EQ(constData(first), constData(second));
+    ASSERT_NE(constData(first), constData(different));
+
+    // the shared buffer outlives the network it was read with
+    first = CNNNetwork();
+    auto values = static_cast<const float*>(constData(second));
+    ASSERT_EQ(std::vector<float>({1, 2, 3, 4}), std::vector<float>(values, values + 4));
+}
+
+TEST_F(SharedConstantsTests, coreThrowsOnShareConstantsForDevice) {
+    Core ie;
+    ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(SHARE_CONSTANTS), CONFIG_VALUE(YES)}}, "CPU"),
+                 details::InferenceEngineException);
+    ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(SHARE_CONSTANTS), "ON"}}), details::InferenceEngineException);
+}
@@ -2,7 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <future>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -186,6 +191,106 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(StreamsExecutorConfigTests, hybridAwareConfigDistributesStreamsBetweenCoreTypes) {
+    IStreamsExecutor::Config initial{"TestCPUStreamsExecutor", 4};
+    initial._threadBindingType = IStreamsExecutor::ThreadBindingType::HYBRID_AWARE;
+    auto config = IStreamsExecutor::Config::MakeDefaultMultiThreaded(initial);
+    const int bigCores = static_cast<int>(getBigCoreProcessors().size());
+    const int littleCores = static_cast<int>(getLittleCoreProcessors().size());
+    if (IStreamsExecutor::ThreadBindingType::HYBRID_AWARE != config._threadBindingType) {
+        // not a hybrid CPU or the threads number is limited by environment
+        ASSERT_EQ(0, config._bigCoreStreams);
+        return;
+    }
+    ASSERT_NE(0, bigCores);
+    ASSERT_NE(0, littleCores);
+    ASSERT_GE(config._bigCoreStreams, 1);
+    ASSERT_LE(config._bigCoreStreams, config._streams);
+    ASSERT_LE(config._bigCoreStreams * config._threadsPerStreamBig, std::max(bigCores, config._bigCoreStreams));
+    ASSERT_LE((config._streams - config._bigCoreStreams) * config._threadsPerStreamLittle,
+              std::max(littleCores, config._streams - config._bigCoreStreams));
+}
+
+TEST(StreamsExecutorConfigTests, hybridAwareLatencyStreamIsPlacedOnBigCores) {
+    IStreamsExecutor::Config initial{"TestCPUStreamsExecutor", 1};
+    initial._threadBindingType = IStreamsExecutor::ThreadBindingType::HYBRID_AWARE;
+    auto config = IStreamsExecutor::Config::MakeDefaultMultiThreaded(initial);
+    if (IStreamsExecutor::ThreadBindingType::HYBRID_AWARE == config._threadBindingType) {
+        ASSERT_EQ(1, config._bigCoreStreams);
+        ASSERT_EQ(static_cast<int>(getBigCoreProcessors().size()), config._threadsPerStreamBig);
+        ASSERT_EQ(0, config._threadsPerStreamLittle);
+    }
+}
+
+TEST(CPUStreamsExecutorMetricsTests, queuedTasksAndBusyStreamsAreCounted) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    std::promise<void> started;
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+    auto first = async(executor, [&] { started.set_value(); releaseFuture.wait(); });
+    started.get_future().wait();
+    auto second = async(executor, [] {});
+
+    ASSERT_EQ(1u, executor->GetBusyStreamsNumber());
+    ASSERT_EQ(1u, executor->GetQueuedTasksNumber());
+
+    release.set_value();
+    first.wait();
+    second.wait();
+    while (executor->GetBusyStreamsNumber() != 0) {
+        std::this_thread::yield();
+    }
+    ASSERT_EQ(0u, executor->GetQueuedTasksNumber());
+}
+
+TEST(CPUStreamsExecutorPriorityTests, latencyTasksAreTakenBeforeBatchTasks) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    auto latencyExecutor = std::make_shared<CPUStreamsExecutor>(*executor, CPUStreamsExecutor::LATENCY);
+    std::promise<void> started;
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+    auto first = async(executor, [&] { started.set_value(); releaseFuture.wait(); });
+    started.get_future().wait();
+
+    // the only stream executes queued tasks one by one
+    std::vector<int> order;
+    auto batch = async(executor, [&] { order.push_back(0); });
+    auto latency = async(latencyExecutor, [&] { order.push_back(1); });
+    ASSERT_EQ(2u, executor->GetQueuedTasksNumber());
+
+    release.set_value();
+    first.wait();
+    batch.wait();
+    latency.wait();
+    ASSERT_EQ((std::vector<int>{1, 0}), order);
+}
+
+TEST(CPUStreamsExecutorPriorityTests, batchTaskIsPreemptedByLatencyTask) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    auto latencyExecutor = std::make_shared<CPUStreamsExecutor>(*executor, CPUStreamsExecutor::LATENCY);
+    std::promise<void> started;
+    std::atomic<bool> latencyDone{false};
+    bool preempted = false;
+    auto batch = async(executor, [&] {
+        started.set_value();
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!latencyDone && std::chrono::steady_clock::now() < deadline) {
+            CPUStreamsExecutor::PreemptionPoint();
+            std::this_thread::yield();
+        }
+        preempted = latencyDone;
+    });
+    started.get_future().wait();
+    auto latency = async(latencyExecutor, [&] { latencyDone = true; });
+
+    batch.wait();
+    latency.wait();
+    ASSERT_TRUE(preempted);
+}
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -193,6 +298,18 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                               streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE,
+                                               1, 0, 0, true});
+    },
+    [] {
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2};
+        config._threadBindingType = IStreamsExecutor::ThreadBindingType::HYBRID_AWARE;
+        return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config::MakeDefaultMultiThreaded(config));
+    },
     [] {
         auto threads = parallel_get_max_threads();
         return std::make_shared<ImmediateExecutor>();
@@ -207,8 +324,209 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
+    },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                               streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE,
+                                               1, 0, 0, true});
     }
 );
 
 INSTANTIATE_TEST_CASE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+TEST(CPUStreamsExecutorPriorityTests, prioritizedTasksAreTakenByLevelThenDeadline) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    std::promise<void> started;
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+    auto first = async(executor, [&] { started.set_value(); releaseFuture.wait(); });
+    started.get_future().wait();
+
+    std::vector<int> order;
+    std::vector<std::future<void>> futures;
+    auto runWithPriority = [&] (int id, int level, std::chrono::milliseconds deadline) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&order, id] { order.push_back(id); });
+        futures.emplace_back(p->get_future());
+        TaskPriority priority;
+        priority.level = level;
+        if (deadline.count() > 0) {
+            priority.deadline = std::chrono::steady_clock::now() + deadline;
+        }
+        executor->runWithPriority([p] {(*p)();}, priority);
+    };
+    futures.emplace_back(async(executor, [&] { order.push_back(0); }));
+    runWithPriority(1, -1, std::chrono::milliseconds{0});
+    runWithPriority(2, 0, std::chrono::milliseconds{2000});
+    runWithPriority(3, 0, std::chrono::milliseconds{1000});
+    runWithPriority(4, 1, std::chrono::milliseconds{0});
+    ASSERT_EQ(5u, executor->GetQueuedTasksNumber());
+
+    release.set_value();
+    first.wait();
+    for (auto&& future : futures) {
+        future.wait();
+    }
+    ASSERT_EQ((std::vector<int>{4, 3, 2, 0, 1}), order);
+}
+
+TEST(CPUStreamsExecutorPriorityTests, batchOfTasksIsTakenInPriorityOrder) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(
+        IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1, IStreamsExecutor::ThreadBindingType::NONE});
+    std::promise<void> started;
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+    auto first = async(executor, [&] { started.set_value(); releaseFuture.wait(); });
+    started.get_future().wait();
+
+    std::vector<int> order;
+    std::vector<std::future<void>> futures;
+    std::vector<Task> tasks;
+    std::vector<TaskPriority> priorities(3);
+    for (int id = 0; id < 3; ++id) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&order, id] { order.push_back(id); });
+        futures.emplace_back(p->get_future());
+        tasks.emplace_back([p] {(*p)();});
+    }
+    priorities[2].level = 1;
+    executor->runBatch(std::move(tasks), priorities);
+    ASSERT_EQ(3u, executor->GetQueuedTasksNumber());
+
+    release.set_value();
+    first.wait();
+    for (auto&& future : futures) {
+        future.wait();
+    }
+    ASSERT_EQ((std::vector<int>{2, 0, 1}), order);
+}
+
+TEST(StreamsExecutorConfigTests, latencyStreamsThreadsAreExcludedFromOtherStreams) {
+    IStreamsExecutor::Config initial{"TestCPUStreamsExecutor", 7};
+    initial._threads = 20;
+    initial._latencyStreams = 1;
+    initial._threadsPerLatencyStream = 8;
+    auto config = IStreamsExecutor::Config::MakeDefaultMultiThreaded(initial);
+    ASSERT_EQ(8, config._threadsPerLatencyStream);
+    ASSERT_EQ(2, config._threadsPerStream);
+}
+
+TEST(CPUStreamsExecutorPriorityTests, latencyStreamExecutesOnlyLatencyTasks) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config._latencyStreams = 1;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+    auto latencyExecutor = std::make_shared<CPUStreamsExecutor>(*executor, CPUStreamsExecutor::LATENCY);
+    std::promise<void> started;
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+    auto first = async(executor, [&] { started.set_value(); releaseFuture.wait(); });
+    started.get_future().wait();
+
+    // the batch stream is busy, but the latency stream doesn't take the batch task
+    auto batch = async(executor, [] {});
+    async(latencyExecutor, [] {}).wait();
+    auto p = std::make_shared<std::packaged_task<void()>>([] {});
+    auto prioritized = p->get_future();
+    TaskPriority priority;
+    priority.level = 1;
+    executor->runWithPriority([p] {(*p)();}, priority);
+    prioritized.wait();
+    ASSERT_EQ(1u, executor->GetQueuedTasksNumber());
+
+    release.set_value();
+    first.wait();
+    batch.wait();
+}
+
+TEST(CPUStreamsExecutorAutoscalingTests, streamsAreParkedAtLowLoadAndActivatedByQueuedTasks) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 4, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config._minActiveStreams = 1;
+    config._scaleDownDelay = 0;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+    ASSERT_EQ(4u, executor->GetActiveStreamsNumber());
+
+    // tasks started one by one keep only one stream busy
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (executor->GetActiveStreamsNumber() != 1 && std::chrono::steady_clock::now() < deadline) {
+        async(executor, [] {}).wait();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(1u, executor->GetActiveStreamsNumber());
+
+    // each task waits for the others, so they are finished in time only if all the streams are activated
+    std::atomic<int> started{0};
+    std::vector<Future> futures;
+    for (int i = 0; i < 4; i++) {
+        futures.emplace_back(async(executor, [&] {
+            ++started;
+            while (started < 4 && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+        }));
+    }
+    for (auto&& future : futures) {
+        future.wait();
+    }
+    ASSERT_EQ(4, started.load());
+    ASSERT_LT(std::chrono::steady_clock::now(), deadline);
+    ASSERT_EQ(4u, executor->GetActiveStreamsNumber());
+}
+
+TEST(CPUStreamsExecutorAffinityTests, tasksOfHomeStreamAreExecutedByTheSameThread) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 4, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config._requestStreamAffinity = true;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+
+    std::vector<int> homeStreams;
+    for (int i = 0; i < 4; i++) {
+        homeStreams.push_back(executor->AssignHomeStream());
+    }
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3}), homeStreams);
+
+    std::vector<std::thread::id> threads(4);
+    for (int round = 0; round < 10; round++) {
+        for (int stream = 0; stream < 4; stream++) {
+            std::packaged_task<std::thread::id()> task{[] { return std::this_thread::get_id(); }};
+            auto future = task.get_future();
+            executor->runOnStream([&task] { task(); }, stream);
+            auto thread = future.get();
+            if (0 == round) {
+                threads[stream] = thread;
+            } else {
+                ASSERT_EQ(threads[stream], thread);
+            }
+        }
+    }
+    for (int stream = 1; stream < 4; stream++) {
+        ASSERT_EQ(threads.end(), std::find(threads.begin() + stream, threads.end(), threads[stream - 1]));
+    }
+}
+
+TEST(CPUStreamsExecutorAffinityTests, taskOfBusyHomeStreamIsTakenByOtherStream) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 2, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config._requestStreamAffinity = true;
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::packaged_task<void()> blocking{[released] { released.wait(); }};
+    auto blocked = blocking.get_future();
+    executor->runOnStream([&blocking] { blocking(); }, 0);
+
+    std::packaged_task<void()> next{[] {}};
+    auto done = next.get_future();
+    executor->runOnStream([&next] { next(); }, 0);
+    ASSERT_EQ(std::future_status::ready, done.wait_for(std::chrono::seconds(10)));
+
+    release.set_value();
+    blocked.wait();
+}
+
+TEST(SystemConfTests, availableProcessorsRespectProcessLimits) {
+    const int processors = getNumberOfAvailableProcessors();
+    ASSERT_GE(processors, 1);
+    ASSERT_LE(processors, std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+    ASSERT_LE(getNumberOfCPUCores(), processors);
+}
@@ -0,0 +1,72 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_trace.hpp>
+
+using namespace InferenceEngine;
+
+class TraceTests : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::remove(traceFile.c_str());
+    }
+
+    std::string readTrace() const {
+        std::ifstream in(traceFile);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    const std::string traceFile = "trace_tests.json";
+};
+
+TEST_F(TraceTests, eventsAreNotRecordedWhenDisabled) {
+    ASSERT_FALSE(trace::enabled());
+    { trace::Scope scope{"disabled", "test", nullptr}; }
+    trace::start(traceFile);
+    ASSERT_TRUE(trace::enabled());
+    trace::stop();
+    ASSERT_FALSE(trace::enabled());
+    ASSERT_EQ(std::string::npos, readTrace().find("disabled"));
+}
+
+TEST_F(TraceTests, eventsOfAllThreadsAreDumped) {
+    trace::start(traceFile);
+    { trace::Scope scope{"mainThread", "test", this, 1}; }
+    std::thread([this] {
+        trace::Scope scope{"workerThread", "test", this};
+    }).join();
+    trace::stop();
+
+    auto trace = readTrace();
+    ASSERT_EQ(0, trace.find("{\"traceEvents\":["));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"mainThread\""));
+    ASSERT_NE(std::string::npos, trace.find("\"index\":1"));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"workerThread\""));
+}
+
+TEST_F(TraceTests, coreStartsAndStopsRecording) {
+    Core ie;
+    ie.SetConfig({{CONFIG_KEY(TRACE_FILE), traceFile}});
+    ASSERT_TRUE(trace::enabled());
+    ie.SetConfig({{CONFIG_KEY(TRACE_FILE), ""}});
+    ASSERT_FALSE(trace::enabled());
+    ASSERT_EQ(0, readTrace().find("{\"traceEvents\":["));
+}
+
+TEST_F(TraceTests, coreThrowsOnTraceFileForDevice) {
+    Core ie;
+    ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(TRACE_FILE), traceFile}}, "CPU"), details::InferenceEngineException);
+}
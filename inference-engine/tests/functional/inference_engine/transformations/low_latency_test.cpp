@@ -351,3 +351,149 @@ TEST(TransformationTests, LowLatencyLSTMReshape) {
     auto res = compare_functions(f, f_ref);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, LowLatencyLSTMLoop) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        auto H_init = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        auto C_init = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        auto Xi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        auto H_t = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        auto C_t = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        // Body
+        auto axis = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+        auto squeeze = std::make_shared<opset5::Squeeze>(Xi, axis);
+
+        auto w_val = std::vector<float>(512 * 16, 0);
+        auto r_val = std::vector<float>(512 * 128, 0);
+        auto b_val = std::vector<float>(512, 0);
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512, 16}, w_val);
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512, 128}, r_val);
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512}, b_val);
+
+        auto lstm_cell = std::make_shared<opset5::LSTMCell>(squeeze, H_t, C_t, W, R, B, 128);
+        auto res_1 = std::make_shared<opset5::Result>(lstm_cell->output(0));
+        auto unsqueeze = std::make_shared<opset5::Unsqueeze>(lstm_cell->output(0), axis);
+        auto res_2 = std::make_shared<opset5::Result>(unsqueeze);
+        auto res_3 = std::make_shared<opset5::Result>(lstm_cell->output(1));
+        auto body_condition = std::make_shared<opset5::Result>(
+                ngraph::opset5::Constant::create(ngraph::element::boolean, ngraph::Shape{1}, {true}));
+        auto body = std::make_shared<ngraph::Function>(OutputVector{res_1, res_2, res_3, body_condition},
+                                                       ParameterVector{Xi, H_t, C_t});
+
+        auto trip_count = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {1});
+        auto exec_condition = ngraph::opset5::Constant::create(ngraph::element::boolean, ngraph::Shape{}, {true});
+        auto loop = std::make_shared<opset5::Loop>(trip_count, exec_condition);
+        loop->set_function(body);
+        loop->set_special_body_ports(opset5::Loop::SpecialBodyPorts{-1, 3});
+        loop->set_friendly_name("LSTMLoop");
+
+        loop->set_merged_input(C_t, C_init, res_3);
+        loop->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+        loop->set_merged_input(H_t, H_init, res_1);
+
+        auto out0 = loop->get_iter_value(res_1, -1);
+        auto out1 = loop->get_concatenated_slices(res_2, 0, 1, 1, -1, 0);
+        loop->validate_and_infer_types();
+
+        auto res_loop_1 = std::make_shared<opset5::Result>(loop->output(1));
+        auto res_loop_2 = std::make_shared<opset5::Result>(loop->output(0));
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{res_loop_1, res_loop_2},
+                                               ngraph::ParameterVector{X, H_init, C_init});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::LowLatency>();
+        manager.register_pass<ngraph::pass::UnrollTensorIterator>();
+        manager.run_passes(f);
+    }
+    {
+        auto Xi = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        auto H_t = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+        auto C_t = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 128});
+
+        const std::string variable_name_H("LSTMLoop/variable0");
+        const std::string variable_name_C("LSTMLoop/variable1");
+        auto read_value_H = std::make_shared<opset5::ReadValue>(H_t, variable_name_H);
+        auto read_value_C = std::make_shared<opset5::ReadValue>(C_t, variable_name_C);
+        // Body
+        auto axis = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{}, {0});
+        auto squeeze = std::make_shared<opset5::Squeeze>(Xi, axis);
+
+        auto w_val = std::vector<float>(512 * 16, 0);
+        auto r_val = std::vector<float>(512 * 128, 0);
+        auto b_val = std::vector<float>(512, 0);
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512, 16}, w_val);
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512, 128}, r_val);
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{512}, b_val);
+
+        auto lstm_cell = std::make_shared<opset5::LSTMCell>(squeeze, read_value_H, read_value_C, W, R, B, 128);
+        auto assign_H = std::make_shared<opset5::Assign>(lstm_cell->output(0), variable_name_H);
+        auto assign_C = std::make_shared<opset5::Assign>(lstm_cell->output(1), variable_name_C);
+        auto unsqueeze = std::make_shared<opset5::Unsqueeze>(lstm_cell->output(0), axis);
+        auto res_2 = std::make_shared<opset5::Result>(unsqueeze);
+        auto res_1 = std::make_shared<opset5::Result>(lstm_cell->output(0));
+        f_ref = std::make_shared<ngraph::Function>(OutputVector{res_1, res_2}, ParameterVector{Xi, H_t, C_t});
+        f_ref->add_sinks({assign_C, assign_H});
+        assign_H->add_control_dependency(read_value_H);
+        assign_C->add_control_dependency(read_value_C);
+    }
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, LowLatencyGRUSequence) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        auto H = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 128});
+        auto seq_lengths = ngraph::opset5::Constant::create(ngraph::element::i32, ngraph::Shape{1}, {1});
+
+        auto w_val = std::vector<float>(384 * 16, 0);
+        auto r_val = std::vector<float>(384 * 128, 0);
+        auto b_val = std::vector<float>(384, 0);
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 384, 16}, w_val);
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 384, 128}, r_val);
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 384}, b_val);
+
+        auto gru_sequence = std::make_shared<opset5::GRUSequence>(X, H, seq_lengths, W, R, B, 128,
+                                                                  op::RecurrentSequenceDirection::FORWARD);
+        auto res_1 = std::make_shared<opset5::Result>(gru_sequence->output(0));
+        auto res_2 = std::make_shared<opset5::Result>(gru_sequence->output(1));
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{res_1, res_2}, ngraph::ParameterVector{X, H});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::LowLatency>();
+        manager.run_passes(f);
+    }
+    {
+        auto X = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 16});
+        auto H = std::make_shared<opset5::Parameter>(element::f32, Shape{1, 1, 128});
+        auto seq_lengths = ngraph::opset5::Constant::create(ngraph::element::i32, ngraph::Shape{1}, {1});
+
+        const std::string variable_name_H("GRUSequence/variable0");
+        auto read_value_H = std::make_shared<opset5::ReadValue>(H, variable_name_H);
+
+        auto w_val = std::vector<float>(384 * 16, 0);
+        auto r_val = std::vector<float>(384 * 128, 0);
+        auto b_val = std::vector<float>(384, 0);
+        auto W = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 384, 16}, w_val);
+        auto R = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 384, 128}, r_val);
+        auto B = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1, 384}, b_val);
+
+        auto gru_sequence = std::make_shared<opset5::GRUSequence>(X, read_value_H, seq_lengths, W, R, B, 128,
+                                                                  op::RecurrentSequenceDirection::FORWARD);
+        auto assign_H = std::make_shared<opset5::Assign>(gru_sequence->output(1), variable_name_H);
+        auto res_1 = std::make_shared<opset5::Result>(gru_sequence->output(0));
+        auto res_2 = std::make_shared<opset5::Result>(gru_sequence->output(1));
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{res_1, res_2}, ngraph::ParameterVector{X, H});
+        f_ref->add_sinks({assign_H});
+        assign_H->add_control_dependency(read_value_H);
+    }
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,71 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/variant.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/low_precision_override_attribute.hpp>
+
+using namespace testing;
+
+namespace {
+std::shared_ptr<ngraph::opset1::Relu> makeRelu(const std::string & lowPrecisionOverride, std::shared_ptr<ngraph::Function> & f) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(input);
+    relu->get_rt_info()["LowPrecisionOverride"] = std::make_shared<ngraph::VariantWrapper<std::string> >(lowPrecisionOverride);
+    f = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input});
+    return relu;
+}
+}  // namespace
+
+TEST(TransformationTests, LowPrecisionOverrideFP32) {
+    std::shared_ptr<ngraph::Function> f;
+    auto relu = makeRelu("FP32", f);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.run_passes(f);
+
+    std::vector<ngraph::element::Type> precisions{ngraph::element::u8};
+    ASSERT_TRUE(ngraph::getLowPrecisionOverride(*relu, precisions));
+    ASSERT_TRUE(precisions.empty());
+}
+
+TEST(TransformationTests, LowPrecisionOverridePrecisions) {
+    std::shared_ptr<ngraph::Function> f;
+    auto relu = makeRelu("U8, I8", f);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    manager.run_passes(f);
+
+    std::vector<ngraph::element::Type> precisions;
+    ASSERT_TRUE(ngraph::getLowPrecisionOverride(*relu, precisions));
+    ASSERT_EQ(precisions, (std::vector<ngraph::element::Type>{ngraph::element::u8, ngraph::element::i8}));
+}
+
+TEST(TransformationTests, LowPrecisionOverrideInvalidValue) {
+    std::shared_ptr<ngraph::Function> f;
+    makeRelu("U4", f);
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::InitNodeInfo>();
+    ASSERT_THROW(manager.run_passes(f), ngraph::ngraph_error);
+}
+
+TEST(TransformationTests, LowPrecisionOverrideIsAbsent) {
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+    auto relu = std::make_shared<ngraph::opset1::Relu>(input);
+
+    std::vector<ngraph::element::Type> precisions;
+    ASSERT_FALSE(ngraph::getLowPrecisionOverride(*relu, precisions));
+}
@@ -3,6 +3,7 @@
 //
 
 #include "multi-device/multi_device_config.hpp"
+#include "auto-batch/auto_batch_config.hpp"
 
 #include "behavior/infer_request_callback.hpp"
 
@@ -23,6 +24,13 @@ const std::vector<std::map<std::string, std::string>> multiConfigs = {
         {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}}
 };
 
+const std::vector<std::map<std::string, std::string>> autoBatchConfigs = {
+        {{ AUTO_BATCH_CONFIG_KEY(DEVICE) , CommonTestUtils::DEVICE_CPU}},
+        {{ AUTO_BATCH_CONFIG_KEY(DEVICE) , CommonTestUtils::DEVICE_CPU},
+         { AUTO_BATCH_CONFIG_KEY(SIZE) , "4"},
+         { AUTO_BATCH_CONFIG_KEY(TIMEOUT) , "0"}}
+};
+
 INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CallbackTests,
         ::testing::Combine(
             ::testing::ValuesIn(netPrecisions),
@@ -36,4 +44,11 @@ INSTANTIATE_TEST_CASE_P(smoke_Multi_BehaviorTests, CallbackTests,
                 ::testing::Values(CommonTestUtils::DEVICE_MULTI),
                 ::testing::ValuesIn(multiConfigs)),
         CallbackTests::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_AutoBatch_BehaviorTests, CallbackTests,
+        ::testing::Combine(
+                ::testing::ValuesIn(netPrecisions),
+                ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+                ::testing::ValuesIn(autoBatchConfigs)),
+        CallbackTests::getTestCaseName);
 }  // namespace
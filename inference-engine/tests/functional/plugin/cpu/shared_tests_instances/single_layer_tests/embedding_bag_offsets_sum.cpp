@@ -46,4 +46,22 @@ INSTANTIATE_TEST_CASE_P(smoke, EmbeddingBagOffsetsSumLayerTest,
                                 ::testing::ValuesIn(indPrecisions),
                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                         EmbeddingBagOffsetsSumLayerTest::getTestCaseName);
+
+// a few bags with deep embeddings are split along the embedding depth between threads
+const auto embBagOffsetSumDeepArgSet = ::testing::Combine(
+        ::testing::Values(std::vector<size_t>{5, 1024}),
+        ::testing::ValuesIn(indices),
+        ::testing::ValuesIn(offsets),
+        ::testing::Values(static_cast<size_t>(0)),
+        ::testing::ValuesIn(with_weights),
+        ::testing::ValuesIn(with_default_index)
+);
+
+INSTANTIATE_TEST_CASE_P(smoke_DeepEmbeddings, EmbeddingBagOffsetsSumLayerTest,
+                        ::testing::Combine(
+                                embBagOffsetSumDeepArgSet,
+                                ::testing::Values(InferenceEngine::Precision::FP32),
+                                ::testing::Values(InferenceEngine::Precision::I32),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EmbeddingBagOffsetsSumLayerTest::getTestCaseName);
 }  // namespace
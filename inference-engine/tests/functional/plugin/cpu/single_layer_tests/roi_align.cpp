@@ -0,0 +1,130 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph/opsets/opset3.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,    // feature map shape
+        std::vector<float>,     // ROIs, 4 coordinates for each
+        std::vector<int>,       // batch indices of ROIs
+        std::vector<int>,       // pooled height and width
+        int,                    // sampling ratio
+        float,                  // spatial scale
+        std::string             // mode
+> ROIAlignSpecificParams;
+
+typedef std::tuple<
+        ROIAlignSpecificParams,
+        CPUSpecificParams> ROIAlignLayerCPUTestParamsSet;
+
+class ROIAlignLayerCPUTest : public testing::WithParamInterface<ROIAlignLayerCPUTestParamsSet>,
+                             virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ROIAlignLayerCPUTestParamsSet> obj) {
+        ROIAlignSpecificParams roiAlignParams;
+        CPUSpecificParams cpuParams;
+        std::tie(roiAlignParams, cpuParams) = obj.param;
+
+        std::vector<size_t> inputShape;
+        std::vector<float> rois;
+        std::vector<int> batchIndices;
+        std::vector<int> pooledShape;
+        int samplingRatio;
+        float spatialScale;
+        std::string mode;
+        std::tie(inputShape, rois, batchIndices, pooledShape, samplingRatio, spatialScale, mode) = roiAlignParams;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "ROIs=" << batchIndices.size() << "_";
+        result << "pooled=" << CommonTestUtils::vec2str(pooledShape) << "_";
+        result << "ratio=" << samplingRatio << "_";
+        result << "scale=" << spatialScale << "_";
+        result << "mode=" << mode;
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+        return result.str();
+    }
+
+protected:
+    void SetUp() {
+        ROIAlignSpecificParams roiAlignParams;
+        CPUSpecificParams cpuParams;
+        std::tie(roiAlignParams, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+
+        std::vector<size_t> inputShape;
+        std::vector<float> rois;
+        std::vector<int> batchIndices;
+        std::vector<int> pooledShape;
+        int samplingRatio;
+        float spatialScale;
+        std::string mode;
+        std::tie(inputShape, rois, batchIndices, pooledShape, samplingRatio, spatialScale, mode) = roiAlignParams;
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {inputShape});
+        auto roisConst = ngraph::opset3::Constant::create(ngraph::element::f32, {batchIndices.size(), 4}, rois);
+        auto indicesConst = ngraph::opset3::Constant::create(ngraph::element::i32, {batchIndices.size()}, batchIndices);
+        auto roiAlign = std::make_shared<ngraph::opset3::ROIAlign>(params[0], roisConst, indicesConst,
+                                                                   pooledShape[0], pooledShape[1], samplingRatio,
+                                                                   spatialScale, mode);
+        roiAlign->get_rt_info() = CPUTestsBase::setCPUInfo(inFmts, outFmts, priority);
+        const ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(roiAlign)};
+        function = std::make_shared<ngraph::Function>(results, params, "roi_align");
+    }
+};
+
+TEST_P(ROIAlignLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckCPUImpl(executableNetwork, "ROIAlign", inFmts, outFmts, selectedType);
+}
+
+namespace {
+
+std::vector<CPUSpecificParams> filterCPUInfoForDevice() {
+    std::vector<CPUSpecificParams> resCPUParams;
+    if (with_cpu_x86_avx512f()) {
+        resCPUParams.push_back(CPUSpecificParams{{nChw16c}, {nChw16c}, {}, "unknown_FP32"});
+    } else if (with_cpu_x86_sse42()) {
+        resCPUParams.push_back(CPUSpecificParams{{nChw8c}, {nChw8c}, {}, "unknown_FP32"});
+    }
+    resCPUParams.push_back(CPUSpecificParams{{nhwc}, {nhwc}, {}, "unknown_FP32"});
+    resCPUParams.push_back(CPUSpecificParams{{nchw}, {nchw}, {}, "unknown_FP32"});
+    return resCPUParams;
+}
+
+// the second ROI is partly outside of the feature map
+const std::vector<float> rois = {
+        1.f, 1.f, 9.f, 7.f,
+        -2.f, 4.f, 12.f, 14.f,
+        0.f, 0.f, 15.f, 15.f,
+};
+
+const auto roiAlignParams = ::testing::Combine(
+        ::testing::Values(std::vector<size_t>{2, 20, 16, 16}),
+        ::testing::Values(rois),
+        ::testing::Values(std::vector<int>{0, 1, 1}),
+        ::testing::Values(std::vector<int>{3, 4}),
+        ::testing::Values(0, 2),
+        ::testing::Values(1.f, 0.5f),
+        ::testing::Values("avg", "max"));
+
+INSTANTIATE_TEST_CASE_P(smoke_ROIAlign_CPU, ROIAlignLayerCPUTest,
+        ::testing::Combine(
+                roiAlignParams,
+                ::testing::ValuesIn(filterCPUInfoForDevice())),
+        ROIAlignLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
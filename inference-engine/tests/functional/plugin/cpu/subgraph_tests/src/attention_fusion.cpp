@@ -0,0 +1,119 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/variant.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const size_t heads = 2;
+const size_t length = 5;
+const size_t depth = 4;
+const float scale = 0.5f;
+
+// softmax(Q * K^T * scale + mask) * V, the mask is broadcasted over heads and rows
+CNNNetwork makeNetwork() {
+    const ngraph::Shape shape{1, heads, length, depth};
+    auto Q = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, shape);
+    Q->set_friendly_name("Q");
+    auto K = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, shape);
+    K->set_friendly_name("K");
+    auto V = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, shape);
+    V->set_friendly_name("V");
+    auto mask = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 1, length});
+    mask->set_friendly_name("mask");
+
+    auto scores = std::make_shared<ngraph::opset5::MatMul>(Q, K, false, true);
+    auto scaleConst = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{}, {scale});
+    auto scaled = std::make_shared<ngraph::opset5::Multiply>(scores, scaleConst);
+    auto masked = std::make_shared<ngraph::opset5::Add>(scaled, mask);
+    auto probs = std::make_shared<ngraph::opset5::Softmax>(masked, 3);
+    auto context = std::make_shared<ngraph::opset5::MatMul>(probs, V);
+    context->set_friendly_name("context");
+    auto result = std::make_shared<ngraph::opset5::Result>(context);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                         ngraph::ParameterVector{Q, K, V, mask}));
+}
+
+std::vector<float> makeData(size_t size, size_t seed) {
+    std::vector<float> data(size);
+    for (size_t i = 0; i < size; ++i)
+        data[i] = static_cast<float>((i * 7 + seed) % 11) * 0.25f - 1.25f;
+    return data;
+}
+
+}  // namespace
+
+TEST(CPUAttentionFusionTest, smoke_MatMulSoftmaxMatMulIsFused) {
+    auto network = makeNetwork();
+    Core ie;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    size_t attentionCount = 0;
+    auto function = execNet.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, function);
+    for (const auto &node : function->get_ops()) {
+        auto it = node->get_rt_info().find(ExecGraphInfoSerialization::LAYER_TYPE);
+        ASSERT_NE(node->get_rt_info().end(), it);
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        ASSERT_NE(nullptr, value);
+        ASSERT_NE("SoftMax", value->get());
+        if (value->get() == "Attention")
+            attentionCount++;
+    }
+    ASSERT_EQ(1u, attentionCount);
+
+    const size_t size = heads * length * depth;
+    auto q = makeData(size, 1), k = makeData(size, 3), v = makeData(size, 5);
+    std::vector<float> mask(length, 0.f);
+    mask[length - 1] = -10000.f;
+
+    auto request = execNet.CreateInferRequest();
+    const TensorDesc desc(Precision::FP32, {1, heads, length, depth}, Layout::NCHW);
+    ASSERT_NO_THROW(request.SetBlob("Q", make_shared_blob<float>(desc, q.data())));
+    ASSERT_NO_THROW(request.SetBlob("K", make_shared_blob<float>(desc, k.data())));
+    ASSERT_NO_THROW(request.SetBlob("V", make_shared_blob<float>(desc, v.data())));
+    ASSERT_NO_THROW(request.SetBlob("mask", make_shared_blob<float>({Precision::FP32, {1, 1, 1, length}, Layout::NCHW},
+                                                                     mask.data())));
+    ASSERT_NO_THROW(request.Infer());
+
+    auto output = request.GetBlob("context")->cbuffer().as<const float*>();
+    for (size_t h = 0; h < heads; ++h) {
+        const float* qh = q.data() + h * length * depth;
+        const float* kh = k.data() + h * length * depth;
+        const float* vh = v.data() + h * length * depth;
+        for (size_t i = 0; i < length; ++i) {
+            std::vector<float> probs(length);
+            float maxScore = -INFINITY, sum = 0.f;
+            for (size_t j = 0; j < length; ++j) {
+                float dot = 0.f;
+                for (size_t d = 0; d < depth; ++d)
+                    dot += qh[i * depth + d] * kh[j * depth + d];
+                probs[j] = dot * scale + mask[j];
+                maxScore = std::max(maxScore, probs[j]);
+            }
+            for (size_t j = 0; j < length; ++j) {
+                probs[j] = std::exp(probs[j] - maxScore);
+                sum += probs[j];
+            }
+            for (size_t d = 0; d < depth; ++d) {
+                float expected = 0.f;
+                for (size_t j = 0; j < length; ++j)
+                    expected += probs[j] / sum * vh[j * depth + d];
+                ASSERT_NEAR(expected, output[(h * length + i) * depth + d], 1e-5f);
+            }
+        }
+    }
+}
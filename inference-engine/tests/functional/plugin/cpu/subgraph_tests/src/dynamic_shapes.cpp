@@ -0,0 +1,169 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+CNNNetwork makeNetwork() {
+    auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 8, 8});
+    param->set_friendly_name("input");
+    auto scale = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {2.f});
+    auto multiply = std::make_shared<ngraph::opset5::Multiply>(param, scale);
+    multiply->set_friendly_name("multiply");
+    auto result = std::make_shared<ngraph::opset5::Result>(multiply);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+// transformations of the network do not depend on input shapes, so the transformed function is reshaped
+CNNNetwork makeConvNetwork(const ngraph::Shape& shape) {
+    auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, shape);
+    param->set_friendly_name("input");
+    std::vector<float> weightsData(4 * 3 * 3 * 3);
+    for (size_t i = 0; i < weightsData.size(); ++i) {
+        weightsData[i] = static_cast<float>(i % 5) - 2.f;
+    }
+    auto weights = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{4, 3, 3, 3}, weightsData);
+    auto conv = std::make_shared<ngraph::opset5::Convolution>(param, weights, ngraph::Strides{1, 1},
+                                                              ngraph::CoordinateDiff{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                              ngraph::Strides{1, 1});
+    auto relu = std::make_shared<ngraph::opset5::Relu>(conv);
+    auto pool = std::make_shared<ngraph::opset5::MaxPool>(relu, ngraph::Strides{2, 2}, ngraph::Shape{0, 0},
+                                                          ngraph::Shape{0, 0}, ngraph::Shape{2, 2});
+    pool->set_friendly_name("pool");
+    auto result = std::make_shared<ngraph::opset5::Result>(pool);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+Blob::Ptr inferConv(InferRequest& request, const SizeVector& dims) {
+    auto input = make_shared_blob<float>({Precision::FP32, dims, Layout::NCHW});
+    input->allocate();
+    auto inputData = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); ++i) {
+        inputData[i] = static_cast<float>(i % 13) / 13.f;
+    }
+    request.SetBlob("input", input);
+    request.Infer();
+    return request.GetBlob("pool");
+}
+
+void inferAndCheck(InferRequest& request, const SizeVector& dims) {
+    auto input = make_shared_blob<float>({Precision::FP32, dims, Layout::NCHW});
+    input->allocate();
+    auto inputData = input->buffer().as<float*>();
+    for (size_t i = 0; i < input->size(); ++i) {
+        inputData[i] = static_cast<float>(i % 17);
+    }
+    ASSERT_NO_THROW(request.SetBlob("input", input));
+    ASSERT_NO_THROW(request.Infer());
+
+    auto output = request.GetBlob("multiply");
+    ASSERT_EQ(dims, output->getTensorDesc().getDims());
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t i = 0; i < output->size(); ++i) {
+        ASSERT_FLOAT_EQ(2.f * inputData[i], outputData[i]);
+    }
+}
+
+}  // namespace
+
+TEST(CPUDynamicShapesTest, smoke_InferWithChangingInputShapes) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES}});
+    auto request = execNet.CreateInferRequest();
+
+    inferAndCheck(request, {1, 3, 16, 16});
+    inferAndCheck(request, {1, 3, 8, 8});
+    inferAndCheck(request, {2, 3, 4, 12});
+    // cached graph is reused
+    inferAndCheck(request, {1, 3, 16, 16});
+}
+
+TEST(CPUDynamicShapesTest, smoke_SetBlobWithOtherShapeThrowsWithoutOption) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU);
+    auto request = execNet.CreateInferRequest();
+
+    auto input = make_shared_blob<float>({Precision::FP32, {1, 3, 16, 16}, Layout::NCHW});
+    input->allocate();
+    ASSERT_THROW(request.SetBlob("input", input), details::InferenceEngineException);
+}
+
+TEST(CPUDynamicShapesTest, smoke_CacheHitsAndMissesAreReported) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES},
+                                   {PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_CAPACITY, "1"}});
+    auto request = execNet.CreateInferRequest();
+
+    inferAndCheck(request, {1, 3, 16, 16});
+    inferAndCheck(request, {1, 3, 16, 16});
+    inferAndCheck(request, {2, 3, 16, 16});
+    // evicted by the previous shapes
+    inferAndCheck(request, {1, 3, 16, 16});
+
+    ASSERT_EQ(1u, execNet.GetMetric(METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_HITS)).as<unsigned int>());
+    ASSERT_EQ(3u, execNet.GetMetric(METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_MISSES)).as<unsigned int>());
+}
+
+TEST(CPUDynamicShapesTest, smoke_ProfilesAreCompiledByLoadNetwork) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES},
+                                   {PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_CAPACITY, "0"},
+                                   {PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_PROFILES, "input[1,3,16,16];input[2,3,4,12]"}});
+    auto request = execNet.CreateInferRequest();
+
+    inferAndCheck(request, {1, 3, 16, 16});
+    inferAndCheck(request, {2, 3, 4, 12});
+    inferAndCheck(request, {1, 3, 8, 8});
+    inferAndCheck(request, {1, 3, 16, 16});
+
+    // profiles are kept regardless of the cache capacity
+    ASSERT_EQ(3u, execNet.GetMetric(METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_HITS)).as<unsigned int>());
+    ASSERT_EQ(0u, execNet.GetMetric(METRIC_KEY(CPU_DYNAMIC_SHAPES_CACHE_MISSES)).as<unsigned int>());
+}
+
+TEST(CPUDynamicShapesTest, smoke_ProfilesRequireDynamicShapes) {
+    Core ie;
+    ASSERT_THROW(ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_PROFILES, "input[1,3,16,16]"}}),
+                 details::InferenceEngineException);
+    ASSERT_THROW(ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES},
+                                 {PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_PROFILES, "other[1,3,16,16]"}}),
+                 details::InferenceEngineException);
+}
+
+TEST(CPUDynamicShapesTest, smoke_ReshapedTransformedNetworkMatchesLoadedOne) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeConvNetwork({1, 3, 8, 8}), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES, PluginConfigParams::YES}});
+    auto request = execNet.CreateInferRequest();
+
+    for (auto&& dims : std::vector<SizeVector>{{1, 3, 16, 12}, {2, 3, 10, 10}}) {
+        auto output = inferConv(request, dims);
+
+        auto referenceNet = ie.LoadNetwork(makeConvNetwork(ngraph::Shape(dims.begin(), dims.end())),
+                                           CommonTestUtils::DEVICE_CPU);
+        auto referenceRequest = referenceNet.CreateInferRequest();
+        auto reference = inferConv(referenceRequest, dims);
+
+        ASSERT_EQ(reference->getTensorDesc().getDims(), output->getTensorDesc().getDims());
+        auto outputData = output->cbuffer().as<const float*>();
+        auto referenceData = reference->cbuffer().as<const float*>();
+        for (size_t i = 0; i < reference->size(); ++i) {
+            ASSERT_FLOAT_EQ(referenceData[i], outputData[i]) << i;
+        }
+    }
+}
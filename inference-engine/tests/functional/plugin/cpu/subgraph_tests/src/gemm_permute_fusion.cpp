@@ -0,0 +1,86 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/variant.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const size_t seqLength = 3;
+const size_t heads = 2;
+const size_t depth = 4;
+
+std::shared_ptr<ngraph::Node> makeTranspose(const ngraph::Output<ngraph::Node>& input, const std::vector<int64_t>& order) {
+    auto orderConst = ngraph::opset5::Constant::create(ngraph::element::i64, ngraph::Shape{order.size()}, order);
+    return std::make_shared<ngraph::opset5::Transpose>(input, orderConst);
+}
+
+// the head split of an attention block: [1, S, H, D] inputs are viewed as [1, H, S, D] and [1, H, D, S],
+// the [1, H, S, S] product is written back as [1, S, H, S]
+CNNNetwork makeNetwork() {
+    const ngraph::Shape shape{1, seqLength, heads, depth};
+    auto A = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, shape);
+    A->set_friendly_name("A");
+    auto B = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, shape);
+    B->set_friendly_name("B");
+
+    auto matMul = std::make_shared<ngraph::opset5::MatMul>(makeTranspose(A, {0, 2, 1, 3}), makeTranspose(B, {0, 2, 3, 1}));
+    auto output = makeTranspose(matMul, {0, 2, 1, 3});
+    output->set_friendly_name("output");
+    auto result = std::make_shared<ngraph::opset5::Result>(output);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{A, B}));
+}
+
+}  // namespace
+
+TEST(CPUGemmPermuteFusionTest, smoke_PermutesAreFoldedIntoGemm) {
+    auto network = makeNetwork();
+    Core ie;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    auto function = execNet.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, function);
+    for (const auto &node : function->get_ops()) {
+        auto it = node->get_rt_info().find(ExecGraphInfoSerialization::LAYER_TYPE);
+        ASSERT_NE(node->get_rt_info().end(), it);
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        ASSERT_NE(nullptr, value);
+        ASSERT_NE("Permute", value->get());
+    }
+
+    const size_t size = seqLength * heads * depth;
+    std::vector<float> a(size), b(size);
+    for (size_t i = 0; i < size; ++i) {
+        a[i] = static_cast<float>(i % 5) - 2.f;
+        b[i] = static_cast<float>(i % 7) * 0.5f - 1.f;
+    }
+
+    auto request = execNet.CreateInferRequest();
+    const TensorDesc desc(Precision::FP32, {1, seqLength, heads, depth}, Layout::NCHW);
+    ASSERT_NO_THROW(request.SetBlob("A", make_shared_blob<float>(desc, a.data())));
+    ASSERT_NO_THROW(request.SetBlob("B", make_shared_blob<float>(desc, b.data())));
+    ASSERT_NO_THROW(request.Infer());
+
+    auto output = request.GetBlob("output")->cbuffer().as<const float*>();
+    for (size_t i = 0; i < seqLength; ++i) {
+        for (size_t h = 0; h < heads; ++h) {
+            for (size_t j = 0; j < seqLength; ++j) {
+                float expected = 0.f;
+                for (size_t d = 0; d < depth; ++d)
+                    expected += a[(i * heads + h) * depth + d] * b[(j * heads + h) * depth + d];
+                ASSERT_FLOAT_EQ(expected, output[(i * heads + h) * seqLength + j]);
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const std::vector<float> meanValues = {10.f, 20.f, 30.f};
+
+CNNNetwork makeNetwork() {
+    auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 4, 4});
+    param->set_friendly_name("input");
+    auto relu = std::make_shared<ngraph::opset5::Relu>(param);
+    relu->set_friendly_name("relu");
+    auto result = std::make_shared<ngraph::opset5::Result>(relu);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}));
+}
+
+using InputMeanValuesParams = std::tuple<Precision, Layout>;
+
+class CPUInputMeanValuesTest : public testing::TestWithParam<InputMeanValuesParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InputMeanValuesParams>& obj) {
+        return std::string(std::get<0>(obj.param).name()) + "_" + (std::get<1>(obj.param) == Layout::NHWC ? "NHWC" : "NCHW");
+    }
+};
+
+}  // namespace
+
+// precision conversion and mean subtraction are fused when the user layout matches the input node layout
+TEST_P(CPUInputMeanValuesTest, smoke_MeanValuesAreSubtracted) {
+    Precision precision;
+    Layout layout;
+    std::tie(precision, layout) = GetParam();
+
+    auto network = makeNetwork();
+    auto inputInfo = network.getInputsInfo().begin()->second;
+    inputInfo->setPrecision(precision);
+    inputInfo->setLayout(layout);
+    auto& preProcess = inputInfo->getPreProcess();
+    preProcess.init(meanValues.size());
+    for (size_t c = 0; c < meanValues.size(); ++c) {
+        preProcess[c]->meanValue = meanValues[c];
+    }
+    preProcess.setVariant(MEAN_VALUE);
+
+    Core ie;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto request = execNet.CreateInferRequest();
+
+    const TensorDesc inputDesc(precision, {1, 3, 4, 4}, layout);
+    Blob::Ptr input;
+    if (precision == Precision::U8) {
+        input = make_shared_blob<uint8_t>(inputDesc);
+        input->allocate();
+        std::fill_n(input->buffer().as<uint8_t*>(), input->size(), 25);
+    } else {
+        input = make_shared_blob<float>(inputDesc);
+        input->allocate();
+        std::fill_n(input->buffer().as<float*>(), input->size(), 25.f);
+    }
+    ASSERT_NO_THROW(request.SetBlob("input", input));
+    ASSERT_NO_THROW(request.Infer());
+
+    auto output = request.GetBlob("relu");
+    ASSERT_EQ(Layout::NCHW, output->getTensorDesc().getLayout());
+    auto outputData = output->cbuffer().as<const float*>();
+    const size_t planeSize = 4 * 4;
+    for (size_t i = 0; i < output->size(); ++i) {
+        ASSERT_FLOAT_EQ(std::max(0.f, 25.f - meanValues[i / planeSize]), outputData[i]);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_InputMeanValues, CPUInputMeanValuesTest,
+                        testing::Combine(testing::Values(Precision::U8, Precision::FP32),
+                                         testing::Values(Layout::NCHW, Layout::NHWC)),
+                        CPUInputMeanValuesTest::getTestCaseName);
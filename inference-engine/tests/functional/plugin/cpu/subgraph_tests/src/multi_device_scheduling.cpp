@@ -0,0 +1,42 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <multi-device/multi_device_config.hpp>
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+using namespace InferenceEngine;
+
+class MultiDeviceSchedulingTest : public ::testing::TestWithParam<std::string> {};
+
+TEST_P(MultiDeviceSchedulingTest, smoke_DispatchedRequestsAreCounted) {
+    Core ie;
+    CNNNetwork network(ngraph::builder::subgraph::makeConvPoolRelu());
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_MULTI,
+                                  {{MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES, CommonTestUtils::DEVICE_CPU},
+                                   {MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, GetParam()}});
+    ASSERT_EQ(GetParam(), execNet.GetConfig(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY).as<std::string>());
+
+    constexpr unsigned int numInferences = 5;
+    auto request = execNet.CreateInferRequest();
+    for (unsigned int i = 0; i < numInferences; ++i) {
+        ASSERT_NO_THROW(request.Infer());
+    }
+
+    std::map<std::string, unsigned int> dispatched = execNet.GetMetric(METRIC_KEY(MULTI_DEVICE_DISPATCHED_REQUESTS));
+    ASSERT_EQ(numInferences, dispatched[CommonTestUtils::DEVICE_CPU]);
+    std::map<std::string, float> latencies = execNet.GetMetric(METRIC_KEY(MULTI_DEVICE_AVERAGE_LATENCIES));
+    ASSERT_LT(0.f, latencies[CommonTestUtils::DEVICE_CPU]);
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_Multi, MultiDeviceSchedulingTest,
+                        ::testing::Values(MultiDeviceConfigParams::MULTI_DEVICE_PRIORITY,
+                                          MultiDeviceConfigParams::MULTI_ROUND_ROBIN,
+                                          MultiDeviceConfigParams::MULTI_SHORTEST_EXPECTED_COMPLETION,
+                                          MultiDeviceConfigParams::MULTI_WEIGHTED_THROUGHPUT));
@@ -0,0 +1,74 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const size_t rows = 4;
+const size_t depth = 3;
+const std::vector<uint8_t> table = {1, 2, 3,  4, 5, 6,  7, 8, 9,  10, 11, 12};
+const std::vector<float> scales = {0.5f, 1.f, 2.f, 0.25f};
+const std::vector<float> zeroPoints = {1.f, 2.f, 3.f, 4.f};
+const std::vector<int32_t> indices = {0, 2, 3, 1, 1};
+const std::vector<int32_t> offsets = {0, 2};
+
+// table is dequantized per row: (table - zero_points) * scales
+CNNNetwork makeNetwork() {
+    auto tableConst = ngraph::opset3::Constant::create(ngraph::element::u8, ngraph::Shape{rows, depth}, table);
+    auto convert = std::make_shared<ngraph::opset3::Convert>(tableConst, ngraph::element::f32);
+    auto zeroPointsConst = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{rows, 1}, zeroPoints);
+    auto subtract = std::make_shared<ngraph::opset3::Subtract>(convert, zeroPointsConst);
+    auto scalesConst = ngraph::opset3::Constant::create(ngraph::element::f32, ngraph::Shape{rows, 1}, scales);
+    auto multiply = std::make_shared<ngraph::opset3::Multiply>(subtract, scalesConst);
+
+    auto indicesParam = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::i32, ngraph::Shape{indices.size()});
+    indicesParam->set_friendly_name("indices");
+    auto offsetsConst = ngraph::opset3::Constant::create(ngraph::element::i32, ngraph::Shape{offsets.size()}, offsets);
+    auto embedding = std::make_shared<ngraph::opset3::EmbeddingBagOffsetsSum>(multiply, indicesParam, offsetsConst);
+    embedding->set_friendly_name("embedding");
+    auto result = std::make_shared<ngraph::opset3::Result>(embedding);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{indicesParam}));
+}
+
+}  // namespace
+
+TEST(CPUQuantizedEmbeddingTableTest, smoke_RowsAreDequantizedInEmbeddingBag) {
+    auto network = makeNetwork();
+    network.getInputsInfo().begin()->second->setPrecision(Precision::I32);
+
+    Core ie;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto request = execNet.CreateInferRequest();
+
+    auto input = make_shared_blob<int32_t>({Precision::I32, {indices.size()}, Layout::C});
+    input->allocate();
+    std::copy(indices.begin(), indices.end(), input->buffer().as<int32_t*>());
+    ASSERT_NO_THROW(request.SetBlob("indices", input));
+    ASSERT_NO_THROW(request.Infer());
+
+    auto output = request.GetBlob("embedding");
+    ASSERT_EQ(Precision::FP32, output->getTensorDesc().getPrecision());
+    auto outputData = output->cbuffer().as<const float*>();
+    for (size_t bag = 0; bag < offsets.size(); ++bag) {
+        const size_t end = bag + 1 < offsets.size() ? offsets[bag + 1] : indices.size();
+        for (size_t d = 0; d < depth; ++d) {
+            float expected = 0.f;
+            for (size_t i = offsets[bag]; i < end; ++i) {
+                const size_t row = indices[i];
+                expected += (table[row * depth + d] - zeroPoints[row]) * scales[row];
+            }
+            ASSERT_FLOAT_EQ(expected, outputData[bag * depth + d]);
+        }
+    }
+}
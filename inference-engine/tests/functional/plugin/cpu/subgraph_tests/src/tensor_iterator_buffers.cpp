@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+const size_t seqLength = 5;
+const size_t depth = 8;
+
+// a body which is not an RNN cell: H = H * 0.5 + X, iteration slices are viewed in place and H is double buffered
+CNNNetwork makeNetwork(int64_t stride) {
+    auto X = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, seqLength, depth});
+    X->set_friendly_name("X");
+    auto H = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, depth});
+    H->set_friendly_name("H");
+
+    auto Xi = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, depth});
+    auto Hi = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, depth});
+    auto half = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{}, {0.5f});
+    auto scaled = std::make_shared<ngraph::opset5::Multiply>(Hi, half);
+    auto next = std::make_shared<ngraph::opset5::Add>(scaled, Xi);
+    auto res = std::make_shared<ngraph::opset5::Result>(next);
+    auto body = std::make_shared<ngraph::Function>(ngraph::OutputVector{res}, ngraph::ParameterVector{Xi, Hi});
+
+    auto tensorIterator = std::make_shared<ngraph::opset5::TensorIterator>();
+    tensorIterator->set_body(body);
+    if (stride > 0)
+        tensorIterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 1);
+    else
+        tensorIterator->set_sliced_input(Xi, X, -1, -1, 1, 0, 1);
+    tensorIterator->set_merged_input(Hi, H, res);
+
+    auto sequence = stride > 0 ? tensorIterator->get_concatenated_slices(res, 0, 1, 1, -1, 1) :
+                    tensorIterator->get_concatenated_slices(res, -1, -1, 1, 0, 1);
+    auto last = tensorIterator->get_iter_value(res, -1);
+    auto sequenceResult = std::make_shared<ngraph::opset5::Result>(sequence);
+    sequenceResult->set_friendly_name("sequence");
+    auto lastResult = std::make_shared<ngraph::opset5::Result>(last);
+    lastResult->set_friendly_name("last");
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{sequenceResult, lastResult},
+                                                         ngraph::ParameterVector{X, H}));
+}
+
+void checkIterations(int64_t stride) {
+    auto network = makeNetwork(stride);
+    Core ie;
+    auto execNet = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    std::vector<float> x(seqLength * depth), h(depth);
+    for (size_t i = 0; i < x.size(); ++i)
+        x[i] = static_cast<float>(i % 7) - 3.f;
+    for (size_t d = 0; d < depth; ++d)
+        h[d] = static_cast<float>(d);
+
+    // the second request checks that buffers are consistent between executions
+    for (int run = 0; run < 2; ++run) {
+        auto request = execNet.CreateInferRequest();
+        auto xBlob = make_shared_blob<float>({Precision::FP32, {1, seqLength, depth}, Layout::CHW}, x.data());
+        auto hBlob = make_shared_blob<float>({Precision::FP32, {1, 1, depth}, Layout::CHW}, h.data());
+        ASSERT_NO_THROW(request.SetBlob("X", xBlob));
+        ASSERT_NO_THROW(request.SetBlob("H", hBlob));
+        ASSERT_NO_THROW(request.Infer());
+        ASSERT_NO_THROW(request.Infer());
+
+        // outputs are named after the TensorIterator ports, the concatenated one goes first
+        auto sequence = request.GetBlob(network.getOutputsInfo().begin()->first)->cbuffer().as<const float*>();
+        auto last = request.GetBlob(network.getOutputsInfo().rbegin()->first)->cbuffer().as<const float*>();
+        for (size_t d = 0; d < depth; ++d) {
+            float expected = h[d];
+            for (size_t i = 0; i < seqLength; ++i) {
+                const size_t t = stride > 0 ? i : seqLength - 1 - i;
+                expected = expected * 0.5f + x[t * depth + d];
+                ASSERT_FLOAT_EQ(expected, sequence[t * depth + d]);
+            }
+            ASSERT_FLOAT_EQ(expected, last[d]);
+        }
+    }
+}
+
+}  // namespace
+
+TEST(CPUTensorIteratorBuffersTest, smoke_ForwardIterations) {
+    checkIterations(1);
+}
+
+TEST(CPUTensorIteratorBuffersTest, smoke_ReverseIterations) {
+    checkIterations(-1);
+}
@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_core.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include "common_test_utils/test_constants.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// convolution results are consumed both by the network output and by the next layer
+CNNNetwork makeNetwork() {
+    auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3, 16, 16});
+    param->set_friendly_name("input");
+    auto weights = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{4, 3, 1, 1},
+                                                    std::vector<float>(12, 0.5f));
+    auto conv = std::make_shared<ngraph::opset5::Convolution>(param, weights, ngraph::Strides{1, 1},
+                                                              ngraph::CoordinateDiff{0, 0}, ngraph::CoordinateDiff{0, 0},
+                                                              ngraph::Strides{1, 1});
+    conv->set_friendly_name("conv");
+    auto pool = std::make_shared<ngraph::opset5::MaxPool>(conv, ngraph::Strides{2, 2}, ngraph::Shape{0, 0},
+                                                          ngraph::Shape{0, 0}, ngraph::Shape{2, 2});
+    pool->set_friendly_name("pool");
+    auto convResult = std::make_shared<ngraph::opset5::Result>(conv);
+    auto poolResult = std::make_shared<ngraph::opset5::Result>(pool);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{convResult, poolResult},
+                                                         ngraph::ParameterVector{param}));
+}
+
+std::string outputExecType(InferRequest& request, const std::string& name) {
+    auto perfCounts = request.GetPerformanceCounts();
+    auto found = perfCounts.find("out_" + name);
+    return found != perfCounts.end() ? found->second.exec_type : "";
+}
+
+}  // namespace
+
+TEST(CPUZeroCopyOutputsTest, smoke_OutputsAreWrittenToUserBlobs) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES}});
+    auto request = execNet.CreateInferRequest();
+
+    auto input = make_shared_blob<float>({Precision::FP32, {1, 3, 16, 16}, Layout::NCHW});
+    input->allocate();
+    std::fill_n(input->buffer().as<float*>(), input->size(), 1.f);
+    auto convOutput = make_shared_blob<float>({Precision::FP32, {1, 4, 16, 16}, Layout::NCHW});
+    convOutput->allocate();
+    ASSERT_NO_THROW(request.SetBlob("input", input));
+    ASSERT_NO_THROW(request.SetBlob("conv", convOutput));
+    ASSERT_NO_THROW(request.Infer());
+
+    ASSERT_EQ("zero_copy", outputExecType(request, "conv"));
+    ASSERT_EQ("zero_copy", outputExecType(request, "pool"));
+
+    auto convData = convOutput->cbuffer().as<const float*>();
+    for (size_t i = 0; i < convOutput->size(); ++i) {
+        ASSERT_FLOAT_EQ(1.5f, convData[i]);
+    }
+    auto poolOutput = request.GetBlob("pool");
+    auto poolData = poolOutput->cbuffer().as<const float*>();
+    for (size_t i = 0; i < poolOutput->size(); ++i) {
+        ASSERT_FLOAT_EQ(1.5f, poolData[i]);
+    }
+}
+
+TEST(CPUZeroCopyOutputsTest, smoke_OutputsAreCopiedWithDynamicBatch) {
+    Core ie;
+    auto execNet = ie.LoadNetwork(makeNetwork(), CommonTestUtils::DEVICE_CPU,
+                                  {{PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES},
+                                   {PluginConfigParams::KEY_DYN_BATCH_LIMIT, "1"}});
+    auto request = execNet.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+
+    ASSERT_EQ("copy", outputExecType(request, "conv"));
+}
@@ -16,6 +16,8 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::GNAConfigParams::KEY_GNA_DEVICE_MODE, InferenceEngine::GNAConfigParams::GNA_SW_FP32},
                     {InferenceEngine::GNAConfigParams::KEY_GNA_LIB_N_THREADS, "2"}},
+            {{InferenceEngine::GNAConfigParams::KEY_GNA_DEVICE_MODE, InferenceEngine::GNAConfigParams::GNA_SW_FP32},
+                    {InferenceEngine::GNAConfigParams::KEY_GNA_REQUESTS_NUM, "2"}},
             {{InferenceEngine::GNAConfigParams::KEY_GNA_SCALE_FACTOR, "NAN"}},
             {{InferenceEngine::GNAConfigParams::KEY_GNA_PRECISION, "FP8"}},
             {{InferenceEngine::GNAConfigParams::KEY_GNA_DEVICE_MODE, "AUTO"}},
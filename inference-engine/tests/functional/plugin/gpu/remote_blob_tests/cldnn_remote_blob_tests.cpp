@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -85,6 +86,63 @@ TEST_F(RemoteBlob_Test, smoke_canInputUserBlob) {
     }
 }
 
+TEST_F(RemoteBlob_Test, smoke_canInputHostBlob) {
+    CNNNetwork net(fn_ptr);
+
+    net.getInputsInfo().begin()->second->setLayout(Layout::NCHW);
+    net.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+
+    auto ie = PluginCache::get().ie();
+    auto exec_net = ie->LoadNetwork(net, CommonTestUtils::DEVICE_GPU);
+
+    // regular inference
+    auto inf_req_regular = exec_net.CreateInferRequest();
+    auto fakeImageData = FuncTestUtils::createAndFillBlob(net.getInputsInfo().begin()->second->getTensorDesc());
+    inf_req_regular.SetBlob(net.getInputsInfo().begin()->first, fakeImageData);
+
+    inf_req_regular.Infer();
+    auto outputBlob_regular = inf_req_regular.GetBlob(net.getOutputsInfo().begin()->first);
+
+    // inference using host blob allocated by the plugin
+    auto inf_req_host = exec_net.CreateInferRequest();
+    auto host_blob = make_shared_host_blob(net.getInputsInfo().begin()->second->getTensorDesc(), exec_net.GetContext());
+    host_blob->allocate();
+    {
+        auto src = fakeImageData->cbuffer().as<const uint8_t*>();
+        auto dst = host_blob->buffer().as<uint8_t*>();
+        std::copy(src, src + fakeImageData->byteSize(), dst);
+    }
+    inf_req_host.SetBlob(net.getInputsInfo().begin()->first, host_blob);
+
+    inf_req_host.Infer();
+    auto outputBlob_host = inf_req_host.GetBlob(net.getOutputsInfo().begin()->first);
+
+    // compare results
+    {
+        ASSERT_EQ(net.getOutputsInfo().begin()->second->getPrecision(), InferenceEngine::Precision::FP32);
+        ASSERT_EQ(outputBlob_regular->size(), outputBlob_host->size());
+        auto thr = FuncTestUtils::GetComparisonThreshold(InferenceEngine::Precision::FP32);
+        FuncTestUtils::compareBlobs(outputBlob_regular, outputBlob_host, thr);
+    }
+}
+
+TEST_F(RemoteBlob_Test, smoke_hostBlobMemoryIsReused) {
+    CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    auto exec_net = ie->LoadNetwork(net, CommonTestUtils::DEVICE_GPU);
+    const auto& desc = net.getInputsInfo().begin()->second->getTensorDesc();
+
+    gpu_handle_param handle = nullptr;
+    {
+        auto host_blob = std::dynamic_pointer_cast<RemoteBlob>(make_shared_host_blob(desc, exec_net.GetContext()));
+        host_blob->allocate();
+        handle = host_blob->getParams().at(GPU_PARAM_KEY(MEM_HANDLE)).as<gpu_handle_param>();
+    }
+    auto host_blob = std::dynamic_pointer_cast<RemoteBlob>(make_shared_host_blob(desc, exec_net.GetContext()));
+    host_blob->allocate();
+    ASSERT_EQ(handle, host_blob->getParams().at(GPU_PARAM_KEY(MEM_HANDLE)).as<gpu_handle_param>());
+}
+
 TEST_F(RemoteBlob_Test, smoke_canInferOnUserContext) {
 #if defined _WIN32
     GTEST_SKIP();
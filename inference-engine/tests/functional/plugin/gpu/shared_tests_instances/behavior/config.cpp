@@ -3,6 +3,7 @@
 //
 
 #include "multi-device/multi_device_config.hpp"
+#include "cldnn/cldnn_config.hpp"
 
 #include "behavior/config.hpp"
 
@@ -19,7 +20,13 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CONFIG_FILE, "unknown_file"}},
             {{InferenceEngine::PluginConfigParams::KEY_DUMP_KERNELS, "ON"}},
             {{InferenceEngine::PluginConfigParams::KEY_TUNING_MODE, "TUNING_UNKNOWN_MODE"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID, "DEVICE_UNKNOWN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DEVICE_ID, "DEVICE_UNKNOWN"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_KERNELS_CACHE_MAX_SIZE, "UNLIMITED"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_MAX_NUM_THREADS, "ALL"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_LAZY_KERNELS_COMPILATION, "ON"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_PARALLEL_BRANCHES, "ON"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_DYN_BATCH_SINGLE_NETWORK, "ON"}},
+            {{InferenceEngine::CLDNNConfigParams::KEY_CLDNN_DEVICE_MEMORY_LIMIT, "HALF"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -44,6 +44,9 @@ namespace {
             {{InferenceEngine::MYRIAD_ENABLE_WEIGHTS_ANALYSIS, CONFIG_VALUE(YES)}},
             {{InferenceEngine::MYRIAD_ENABLE_WEIGHTS_ANALYSIS, CONFIG_VALUE(NO)}},
 
+            {{CONFIG_KEY(DYN_BATCH_ENABLED), CONFIG_VALUE(YES)}},
+            {{CONFIG_KEY(DYN_BATCH_ENABLED), CONFIG_VALUE(NO)}},
+
             // Deprecated
             {{VPU_MYRIAD_CONFIG_KEY(FORCE_RESET), CONFIG_VALUE(YES)}},
             {{VPU_MYRIAD_CONFIG_KEY(FORCE_RESET), CONFIG_VALUE(NO)}},
@@ -109,6 +112,8 @@ namespace {
             {{InferenceEngine::MYRIAD_ENABLE_WEIGHTS_ANALYSIS, "ON"}},
             {{InferenceEngine::MYRIAD_ENABLE_WEIGHTS_ANALYSIS, "OFF"}},
 
+            {{CONFIG_KEY(DYN_BATCH_ENABLED), "ON"}},
+
             // Deprecated
             {{VPU_MYRIAD_CONFIG_KEY(PROTOCOL), "BLUETOOTH"}},
             {{VPU_MYRIAD_CONFIG_KEY(PROTOCOL), "LAN"}},
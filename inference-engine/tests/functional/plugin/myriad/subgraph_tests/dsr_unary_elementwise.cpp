@@ -50,7 +50,11 @@ INSTANTIATE_TEST_CASE_P(smoke_DynamicUnaryElementwise, DSR_UnaryElementwise,
                           ngraph::opset3::Relu::type_info,
                           ngraph::opset3::Sigmoid::type_info,
                           ngraph::opset3::Softmax::type_info,
-                          ngraph::opset3::Sqrt::type_info),
+                          ngraph::opset3::Sqrt::type_info,
+                          ngraph::opset3::Tanh::type_info,
+                          ngraph::opset3::Ceiling::type_info,
+                          ngraph::opset3::Erf::type_info,
+                          ngraph::opset3::Gelu::type_info),
         ::testing::Values(CommonTestUtils::DEVICE_MYRIAD)));
 
 }  // namespace
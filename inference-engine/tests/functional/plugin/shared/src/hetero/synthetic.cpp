@@ -9,6 +9,8 @@
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
 #include <random>
+#include <map>
+#include <sstream>
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -147,4 +149,36 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     ASSERT_NE(nullptr, cnnNetwork.getFunction());
 }
 
+TEST_P(HeteroSyntheticTest, subgraphsMetricFollowsAffinities) {
+    SetUpAffinity();
+    LoadNetwork();
+    std::vector<std::string> subgraphs = executableNetwork.GetMetric(METRIC_KEY(HETERO_SUBGRAPHS));
+    ASSERT_FALSE(subgraphs.empty());
+    std::map<std::string, std::string> layerDevices;
+    for (auto&& subgraph : subgraphs) {
+        auto separator = subgraph.find(':');
+        ASSERT_NE(std::string::npos, separator) << subgraph;
+        std::stringstream layers{subgraph.substr(separator + 1)};
+        std::string layer;
+        while (std::getline(layers >> std::ws, layer, ',')) {
+            ASSERT_TRUE(layerDevices.emplace(layer, subgraph.substr(0, separator)).second) << layer;
+        }
+    }
+    for (auto&& node : function->get_ordered_ops()) {
+        auto itAffinity = node->get_rt_info().find("affinity");
+        if (itAffinity != node->get_rt_info().end()) {
+            ASSERT_EQ(ngraph::as_type_ptr<ngraph::VariantWrapper<std::string>>(itAffinity->second)->get(),
+                      layerDevices[node->get_friendly_name()]) << node->get_friendly_name();
+        }
+    }
+}
+
+TEST_P(HeteroSyntheticTest, optimalNumberOfInferRequestsCoversAllSubgraphs) {
+    SetUpAffinity();
+    LoadNetwork();
+    std::vector<std::string> subgraphs = executableNetwork.GetMetric(METRIC_KEY(HETERO_SUBGRAPHS));
+    unsigned int optimalNumber = executableNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+    ASSERT_LE(subgraphs.size(), optimalNumber);
+}
+
 }  //  namespace HeteroTests
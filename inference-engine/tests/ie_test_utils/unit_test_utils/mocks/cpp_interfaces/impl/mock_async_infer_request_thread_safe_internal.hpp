@@ -58,8 +58,10 @@ public:
             const PreProcessInfo&));
 
     MOCK_METHOD1(SetCompletionCallback_ThreadUnsafe, void(IInferRequest::CompletionCallback));
+    MOCK_METHOD1(SetImmediateCompletionCallback_ThreadUnsafe, void(IInferRequest::CompletionCallback));
 
     MOCK_METHOD1(SetBatch, void(int));
     MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+    MOCK_METHOD2(SetPriority_ThreadUnsafe, void(int, int64_t));
     MOCK_METHOD0(QueryState, std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>>(void));
 };
@@ -26,6 +26,8 @@ public:
     MOCK_METHOD3(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &, const InferenceEngine::PreProcessInfo&));
     MOCK_CONST_METHOD2(GetPreProcess, void(const char* name, const InferenceEngine::PreProcessInfo**));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
+    MOCK_METHOD1(SetImmediateCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
     MOCK_METHOD1(SetBatch, void(int));
+    MOCK_METHOD2(SetPriority, void(int, int64_t));
     MOCK_METHOD0(QueryState, std::vector<IVariableStateInternal::Ptr>());
 };
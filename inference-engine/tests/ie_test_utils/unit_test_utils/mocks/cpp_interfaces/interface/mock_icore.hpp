@@ -24,6 +24,7 @@ public:
         const InferenceEngine::ICNNNetwork&, const std::string&, const std::map<std::string, std::string>&));
 
     MOCK_QUALIFIED_METHOD2(GetMetric, const, InferenceEngine::Parameter(const std::string&, const std::string&));
+    MOCK_QUALIFIED_METHOD0(GetAvailableDevices, const, std::vector<std::string>());
 
     ~MockICore() = default;
 };
@@ -35,4 +35,5 @@ public:
     MOCK_CONST_METHOD1(GetConfig, Parameter(const std::string &name));
     MOCK_CONST_METHOD1(GetMetric, Parameter(const std::string &name));
     MOCK_CONST_METHOD0(GetContext, RemoteContext::Ptr(void));
+    MOCK_METHOD1(StartAsyncBatch, void(const std::vector<IInferRequest::Ptr>&));
 };
@@ -30,6 +30,7 @@ public:
     MOCK_QUALIFIED_METHOD3(GetConfig, const noexcept, StatusCode(const std::string &name, Parameter &result, ResponseDesc *resp));
     MOCK_QUALIFIED_METHOD3(GetMetric, const noexcept, StatusCode(const std::string &name, Parameter &result, ResponseDesc *resp));
     MOCK_QUALIFIED_METHOD2(GetContext, const noexcept, StatusCode(RemoteContext::Ptr &pContext, ResponseDesc *resp));
+    MOCK_QUALIFIED_METHOD2(StartAsyncBatch, noexcept, StatusCode(const std::vector<IInferRequest::Ptr> &, ResponseDesc *));
     MOCK_QUALIFIED_METHOD3(QueryState, noexcept, StatusCode(IVariableState::Ptr &, size_t, ResponseDesc *));
     MOCK_QUALIFIED_METHOD0(Release, noexcept, void());
 };
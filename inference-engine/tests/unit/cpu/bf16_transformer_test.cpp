@@ -167,3 +167,51 @@ TEST(BF16TransformerTest, DISABLED_KeepMemoryPrecisionWithGEMM) {
     ASSERT_EQ(prc_mem_r, Precision::BF16);
     ASSERT_EQ(prc_mem_w, Precision::BF16);
 }
+
+TEST(BF16TransformerTest, ConvertToFloatForUnsupportedBranch) {
+    /*     _____
+     *    [_inp_]
+     *     __|___
+     *    [_relu_]
+     *     __|_________
+     *  __|__      ____|____
+     * [_fc1_]    [_softmax_]
+     *
+     *  Softmax does not support BF16, but relu output goes to FC as well. It should stay BF16
+     *  and softmax should get FP32 data through the Convert layer.
+     */
+    Shape shape = {3, 2};
+    Type type = ngraph::element::f32;
+    auto input = make_shared<Parameter>(type, shape);
+    auto relu = make_shared<Relu>(input);
+    relu->set_friendly_name("relu");
+
+    auto fc1_w = make_shared<Constant>(type, Shape{2, 2}, 1);
+    auto fc1_b = make_shared<Constant>(type, Shape{2}, 1);
+    auto fc1 = make_shared<FullyConnected>(relu, fc1_w, fc1_b, shape);
+
+    auto softmax = make_shared<ngraph::op::v1::Softmax>(relu, 1);
+    softmax->set_friendly_name("softmax");
+
+    auto function = make_shared<ngraph::Function>(
+            ngraph::NodeVector      {fc1, softmax},
+            ngraph::ParameterVector {input});
+
+    auto net = create_net(function, IE);
+
+    // Apply tested BF16 transformation
+    MKLDNNPlugin::BF16Transformer transformer;
+    transformer.convertToBFloat16(net);
+
+    // Check precision
+    auto layers = get_layer_collection(net);
+    IE_SUPPRESS_DEPRECATED_START
+    Precision prc_relu = layers["relu"]->outData[0]->getPrecision();
+    auto convert = InferenceEngine::getCreatorLayer(layers["softmax"]->insData[0].lock()).lock();
+    IE_SUPPRESS_DEPRECATED_END
+
+    ASSERT_EQ(prc_relu, Precision::BF16);
+    ASSERT_EQ(convert->type, "Convert");
+    ASSERT_EQ(convert->outData[0]->getPrecision(), Precision::FP32);
+    ASSERT_EQ(convert->insData[0].lock(), layers["relu"]->outData[0]);
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include <ngraph/ngraph.hpp>
+#include <cpp/ie_cnn_network.h>
+
+#include <legacy/details/ie_cnn_network_tools.h>
+#include <legacy/convert_function_to_cnn_network.hpp>
+#include <quantized_tensors.h>
+
+using ngraph::Shape;
+using namespace ngraph::op;
+using std::make_shared;
+using InferenceEngine::Precision;
+
+namespace {
+
+std::shared_ptr<Constant> make_scalar(float value, const std::string& name) {
+    auto constant = make_shared<Constant>(ngraph::element::f32, Shape{1}, std::vector<float>{value});
+    constant->set_friendly_name(name);
+    return constant;
+}
+
+std::shared_ptr<ngraph::Node> make_fq(const ngraph::Output<ngraph::Node>& input, const std::string& name,
+                                      float inLow, float inHigh, float outLow, float outHigh) {
+    auto fq = make_shared<FakeQuantize>(input,
+                                        make_scalar(inLow, name + "_il"), make_scalar(inHigh, name + "_ih"),
+                                        make_scalar(outLow, name + "_ol"), make_scalar(outHigh, name + "_oh"), 256);
+    fq->set_friendly_name(name);
+    return fq;
+}
+
+std::map<std::string, InferenceEngine::CNNLayerPtr> quantized_layers(InferenceEngine::details::CNNNetworkImpl& net) {
+    std::map<std::string, InferenceEngine::CNNLayerPtr> res;
+    for (auto &layer : InferenceEngine::details::CNNNetSortTopologically(net)) {
+        res[layer->name] = layer;
+    }
+    return res;
+}
+
+float const_value(const InferenceEngine::CNNLayerPtr& layer) {
+    return layer->blobs["custom"]->cbuffer().as<const float*>()[0];
+}
+
+std::shared_ptr<InferenceEngine::details::CNNNetworkImpl> create_legacy_net(std::shared_ptr<ngraph::Function> &func) {
+    InferenceEngine::CNNNetwork ng_net(func);
+    return InferenceEngine::details::convertFunctionToICNNNetwork(func, ng_net);
+}
+
+}  // namespace
+
+TEST(QuantizedTensorsTest, ConcatAndMaxPoolChainIsKeptInU8) {
+    /*     _____
+     *    [_inp_]
+     *   ___|_______
+     * [_fq1_]  [_fq2_]
+     *   __|_______|__
+     *  [____concat___]
+     *       __|__
+     *     [_pool_]
+     *      __|__
+     *     [_fq3_]
+     *
+     *  fq1 and fq2 have the same output grid [0, 2.55] with 256 levels, so the concat and the pool
+     *  get U8 indices of the grid and the input range of fq3 is moved to the indices.
+     */
+    auto input = make_shared<Parameter>(ngraph::element::f32, Shape{1, 3, 4, 4});
+    auto fq1 = make_fq(input, "fq1", 0.f, 10.f, 0.f, 2.55f);
+    auto fq2 = make_fq(input, "fq2", -5.f, 5.f, 0.f, 2.55f);
+
+    auto concat = make_shared<Concat>(ngraph::OutputVector{fq1, fq2}, 1);
+    concat->set_friendly_name("concat");
+    auto pool = make_shared<ngraph::op::v1::MaxPool>(concat, ngraph::Strides{2, 2}, Shape{0, 0}, Shape{0, 0},
+                                                     Shape{2, 2}, ngraph::op::RoundingType::FLOOR);
+    pool->set_friendly_name("pool");
+    auto fq3 = make_fq(pool, "fq3", 0.51f, 1.02f, -1.f, 1.f);
+
+    auto function = make_shared<ngraph::Function>(ngraph::NodeVector{fq3}, ngraph::ParameterVector{input});
+    auto net = create_legacy_net(function);
+
+    MKLDNNPlugin::KeepQuantizedTensorsInU8(*net);
+
+    auto layers = quantized_layers(*net);
+    ASSERT_EQ(layers["fq1"]->outData[0]->getPrecision(), Precision::U8);
+    ASSERT_EQ(layers["fq2"]->outData[0]->getPrecision(), Precision::U8);
+    ASSERT_EQ(layers["concat"]->outData[0]->getPrecision(), Precision::U8);
+    ASSERT_EQ(layers["pool"]->outData[0]->getPrecision(), Precision::U8);
+    ASSERT_EQ(layers["fq3"]->outData[0]->getPrecision(), Precision::FP32);
+
+    ASSERT_FLOAT_EQ(const_value(layers["fq1_ol"]), 0.f);
+    ASSERT_FLOAT_EQ(const_value(layers["fq1_oh"]), 255.f);
+    ASSERT_FLOAT_EQ(const_value(layers["fq2_oh"]), 255.f);
+    ASSERT_FLOAT_EQ(const_value(layers["fq1_ih"]), 10.f);
+    ASSERT_NEAR(const_value(layers["fq3_il"]), 51.f, 1e-3f);
+    ASSERT_NEAR(const_value(layers["fq3_ih"]), 102.f, 1e-3f);
+    ASSERT_FLOAT_EQ(const_value(layers["fq3_ol"]), -1.f);
+}
+
+TEST(QuantizedTensorsTest, ChainWithDifferentGridsIsNotChanged) {
+    auto input = make_shared<Parameter>(ngraph::element::f32, Shape{1, 3, 4, 4});
+    auto fq1 = make_fq(input, "fq1", 0.f, 10.f, 0.f, 2.55f);
+    auto fq2 = make_fq(input, "fq2", 0.f, 10.f, 0.f, 5.1f);
+
+    auto concat = make_shared<Concat>(ngraph::OutputVector{fq1, fq2}, 1);
+    concat->set_friendly_name("concat");
+    auto fq3 = make_fq(concat, "fq3", 0.f, 1.f, 0.f, 1.f);
+
+    auto function = make_shared<ngraph::Function>(ngraph::NodeVector{fq3}, ngraph::ParameterVector{input});
+    auto net = create_legacy_net(function);
+
+    MKLDNNPlugin::KeepQuantizedTensorsInU8(*net);
+
+    auto layers = quantized_layers(*net);
+    ASSERT_EQ(layers["fq1"]->outData[0]->getPrecision(), Precision::FP32);
+    ASSERT_EQ(layers["concat"]->outData[0]->getPrecision(), Precision::FP32);
+    ASSERT_FLOAT_EQ(const_value(layers["fq1_oh"]), 2.55f);
+    ASSERT_FLOAT_EQ(const_value(layers["fq3_ih"]), 1.f);
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+#include <runtime/gna_float_kernels.hpp>
+
+using namespace GNAPluginNS::runtime;
+
+class GNAFloatKernelsTest : public ::testing::Test {
+ protected:
+    static std::vector<float> sequence(size_t size, float scale) {
+        std::vector<float> data(size);
+        for (size_t i = 0; i < size; i++) {
+            data[i] = scale * std::sin(static_cast<float>(i));
+        }
+        return data;
+    }
+};
+
+TEST_F(GNAFloatKernelsTest, affineMatchesReference) {
+    const uint32_t M = 19, N = 3, K = 37;
+    auto A = sequence(M * K, 1.0f);
+    auto Bt = sequence(N * K, 0.5f);
+    auto bias = sequence(M, 2.0f);
+    std::vector<float> C(M * N);
+
+    getFloatKernels().affine(M, N, K, A.data(), K, Bt.data(), K, bias.data(), nullptr, C.data(), N, 1);
+
+    for (uint32_t i = 0; i < M; i++) {
+        for (uint32_t j = 0; j < N; j++) {
+            float sum = bias[i];
+            for (uint32_t k = 0; k < K; k++) {
+                sum += A[i * K + k] * Bt[j * K + k];
+            }
+            ASSERT_NEAR(sum, C[i * N + j], 1e-4f) << "row " << i << " frame " << j;
+        }
+    }
+}
+
+TEST_F(GNAFloatKernelsTest, affineComputesActiveRowsOnly) {
+    const uint32_t M = 8, N = 2, K = 21;
+    auto A = sequence(M * K, 1.0f);
+    auto Bt = sequence(N * K, 1.0f);
+    auto bias = sequence(M, 1.0f);
+    std::vector<uint32_t> rows = {5, 1};
+    std::vector<float> C(rows.size() * N);
+
+    getFloatKernels().affine(rows.size(), N, K, A.data(), K, Bt.data(), K, bias.data(), rows.data(), C.data(), N, 1);
+
+    for (uint32_t l = 0; l < rows.size(); l++) {
+        for (uint32_t j = 0; j < N; j++) {
+            float sum = bias[rows[l]];
+            for (uint32_t k = 0; k < K; k++) {
+                sum += A[rows[l] * K + k] * Bt[j * K + k];
+            }
+            ASSERT_NEAR(sum, C[l * N + j], 1e-4f);
+        }
+    }
+}
+
+TEST_F(GNAFloatKernelsTest, elementwiseMatchReference) {
+    const uint32_t N = 45;
+    auto A = sequence(N, 1.0f);
+    auto X = sequence(N, 80.0f);
+    auto Y = sequence(N, 3.0f);
+    auto diagonal = Y;
+    std::vector<float> relu(N), clamp(N);
+
+    getFloatKernels().diagonal(N, A.data(), X.data(), diagonal.data());
+    getFloatKernels().relu(N, X.data(), relu.data(), 0.25f);
+    getFloatKernels().clamp(N, X.data(), clamp.data(), -50.0f, 50.0f);
+
+    for (uint32_t i = 0; i < N; i++) {
+        ASSERT_NEAR(Y[i] + A[i] * X[i], diagonal[i], 1e-4f);
+        ASSERT_EQ(X[i] < 0.0f ? X[i] * 0.25f : X[i], relu[i]);
+        ASSERT_EQ(X[i] > 50.0f ? 50.0f : (X[i] < -50.0f ? -50.0f : X[i]), clamp[i]);
+    }
+}
@@ -22,6 +22,8 @@ const std::map<std::string, std::string>  supportedConfigKeysWithDefaults = {
     {GNA_CONFIG_KEY(PWL_UNIFORM_DESIGN), CONFIG_VALUE(NO)},
     {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(NO)},
     {GNA_CONFIG_KEY(LIB_N_THREADS), "1"},
+    {GNA_CONFIG_KEY(REQUESTS_NUM), "1"},
+    {GNA_CONFIG_KEY(SEQUENTIAL_BATCH), CONFIG_VALUE(NO)},
     {CONFIG_KEY(SINGLE_THREAD), CONFIG_VALUE(YES)}
 };
 
@@ -169,6 +171,20 @@ TEST_F(GNAPluginConfigTest, GnaConfigLibNThreadsTest) {
     ExpectThrow(GNA_CONFIG_KEY(LIB_N_THREADS), "abc");
 }
 
+TEST_F(GNAPluginConfigTest, GnaConfigRequestsNumTest) {
+    SetAndCompare(GNA_CONFIG_KEY(REQUESTS_NUM), "4");
+    EXPECT_EQ(config.gnaFlags.gna_requests_num, 4);
+    ExpectThrow(GNA_CONFIG_KEY(REQUESTS_NUM), "");
+    ExpectThrow(GNA_CONFIG_KEY(REQUESTS_NUM), "0");
+    ExpectThrow(GNA_CONFIG_KEY(REQUESTS_NUM), "128");
+    ExpectThrow(GNA_CONFIG_KEY(REQUESTS_NUM), "abc");
+}
+
+TEST_F(GNAPluginConfigTest, GnaConfigSequentialBatchTest) {
+    SetAndCheckFlag(GNA_CONFIG_KEY(SEQUENTIAL_BATCH),
+                    config.gnaFlags.sequential_batch);
+}
+
 TEST_F(GNAPluginConfigTest, GnaConfigSingleThreadTest) {
     SetAndCheckFlag(CONFIG_KEY(SINGLE_THREAD),
                     config.gnaFlags.gna_openmp_multithreading,
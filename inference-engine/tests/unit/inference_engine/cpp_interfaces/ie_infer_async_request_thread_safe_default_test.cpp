@@ -3,6 +3,7 @@
 //
 
 #include <deque>
+#include <mutex>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
@@ -60,6 +61,15 @@ struct DeferedExecutor : public ITaskExecutor {
     std::deque<Task> tasks;
 };
 
+struct BatchCountingExecutor : public DeferedExecutor {
+    void runBatch(std::vector<Task> tasks, const std::vector<TaskPriority>& priorities) override {
+        ++batches;
+        DeferedExecutor::runBatch(std::move(tasks), priorities);
+    }
+
+    int batches = 0;
+};
+
 class InferRequestThreadSafeDefaultTests : public ::testing::Test {
 protected:
     shared_ptr<TestAsyncInferRequestThreadSafeDefault> testRequest;
@@ -247,6 +257,57 @@ TEST_F(InferRequestThreadSafeDefaultTests, callbackIsCalledIfAsyncRequestFailed)
     ASSERT_TRUE(wasCalled);
 }
 
+TEST_F(InferRequestThreadSafeDefaultTests, immediateCallbackIsPostedWithoutCallbackExecutor) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
+    auto callbackExecutor = std::make_shared<DeferedExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, callbackExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    std::deque<std::function<void()>> posted;
+    std::mutex postedMutex;
+    StatusCode callbackStatus = StatusCode::GENERAL_ERROR;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                callbackStatus = status;
+            };
+    cppRequest.SetCompletionCallback(callback, [&](std::function<void()> task) {
+        std::lock_guard<std::mutex> lock{postedMutex};
+        posted.emplace_back(std::move(task));
+    });
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(1);
+
+    testRequest->StartAsync();
+    testRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+    ASSERT_TRUE(callbackExecutor->tasks.empty());
+    ASSERT_EQ(1u, posted.size());
+    posted.front()();
+    ASSERT_EQ(StatusCode::OK, callbackStatus);
+}
+
+TEST_F(InferRequestThreadSafeDefaultTests, batchStartPassesFirstStagesWithOneExecutorCall) {
+    auto taskExecutor = std::make_shared<BatchCountingExecutor>();
+    auto firstRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, nullptr);
+    auto secondRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, nullptr);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(2);
+
+    {
+        AsyncInferRequestThreadSafeDefault::BatchStart batchStart;
+        ASSERT_NO_THROW(firstRequest->StartAsync());
+        ASSERT_NO_THROW(secondRequest->StartAsync());
+        ASSERT_TRUE(taskExecutor->tasks.empty());
+        batchStart.Submit();
+    }
+    ASSERT_EQ(1, taskExecutor->batches);
+    ASSERT_EQ(2u, taskExecutor->tasks.size());
+    taskExecutor->executeAll();
+    ASSERT_EQ(StatusCode::OK, firstRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(StatusCode::OK, secondRequest->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+}
+
 TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailedAndNoCallback) {
     auto taskExecutor = std::make_shared<CPUStreamsExecutor>();
     testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor, taskExecutor);
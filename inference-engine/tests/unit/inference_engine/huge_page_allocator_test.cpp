@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "ie_huge_page_allocator.hpp"
+
+using namespace InferenceEngine;
+
+TEST(HugePageAllocatorTests, canAllocateSmallAndLargeBuffers) {
+    auto allocator = CreateHugePageAllocator();
+    ASSERT_NE(allocator, nullptr);
+    for (size_t size : {size_t{0}, size_t{100}, size_t{2} << 20, (size_t{5} << 20) + 3}) {
+        void* handle = allocator->alloc(size);
+        ASSERT_NE(handle, nullptr) << "size " << size;
+        std::memset(allocator->lock(handle), 1, size);
+        allocator->unlock(handle);
+        EXPECT_TRUE(allocator->free(handle)) << "size " << size;
+    }
+}
+
+TEST(HugePageAllocatorTests, largeBuffersAreAlignedToHugePages) {
+    auto allocator = CreateHugePageAllocator();
+    const size_t hugePageSize = size_t{2} << 20;
+    void* handle = allocator->alloc(hugePageSize * 3);
+    ASSERT_NE(handle, nullptr);
+#ifdef __linux__
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(handle) % hugePageSize, 0u);
+#endif
+    EXPECT_TRUE(allocator->free(handle));
+}
+
+TEST(HugePageAllocatorTests, cannotFreeForeignHandle) {
+    auto allocator = CreateHugePageAllocator();
+    EXPECT_TRUE(allocator->free(nullptr));
+    std::unique_ptr<char[]> foreign(new char[10]);
+    EXPECT_FALSE(allocator->free(foreign.get()));
+}
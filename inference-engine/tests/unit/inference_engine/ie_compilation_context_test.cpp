@@ -0,0 +1,78 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset5.hpp>
+
+#include "compilation_context.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> createFunction(float constValue, const ngraph::Shape& shape = {1, 3, 16, 16}) {
+    auto param = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, shape);
+    param->set_friendly_name("input");
+    auto constant = ngraph::opset5::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {constValue});
+    auto add = std::make_shared<ngraph::opset5::Add>(param, constant);
+    add->set_friendly_name("add");
+    auto result = std::make_shared<ngraph::opset5::Result>(add);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param});
+}
+
+}  // namespace
+
+TEST(NetworkCompilationContextTests, hashIsStableForTheSameNetwork) {
+    CNNNetwork net1(createFunction(1.f));
+    CNNNetwork net2(createFunction(1.f));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, "CPU", {}),
+              NetworkCompilationContext::computeHash(net2, "CPU", {}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnWeights) {
+    CNNNetwork net1(createFunction(1.f));
+    CNNNetwork net2(createFunction(2.f));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, "CPU", {}),
+              NetworkCompilationContext::computeHash(net2, "CPU", {}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnShapes) {
+    CNNNetwork net1(createFunction(1.f, {1, 3, 16, 16}));
+    CNNNetwork net2(createFunction(1.f, {1, 3, 32, 32}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, "CPU", {}),
+              NetworkCompilationContext::computeHash(net2, "CPU", {}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnDeviceAndConfig) {
+    CNNNetwork net(createFunction(1.f));
+    const auto hash = NetworkCompilationContext::computeHash(net, "CPU", {});
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(net, "GPU", {}));
+    ASSERT_NE(hash, NetworkCompilationContext::computeHash(net, "CPU", {{"PERF_COUNT", "YES"}}));
+}
+
+TEST(NetworkCompilationContextTests, hashDependsOnInputPrecision) {
+    CNNNetwork net1(createFunction(1.f));
+    CNNNetwork net2(createFunction(1.f));
+    net2.getInputsInfo().begin()->second->setPrecision(Precision::U8);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, "CPU", {}),
+              NetworkCompilationContext::computeHash(net2, "CPU", {}));
+}
+
+TEST(NetworkCompilationContextTests, blobPathIsInsideCacheDir) {
+    const auto path = NetworkCompilationContext::blobPath("cache", "0123456789abcdef");
+    ASSERT_EQ(0, path.find("cache"));
+    ASSERT_NE(std::string::npos, path.find("0123456789abcdef.blob"));
+}
+
+TEST(NetworkCompilationContextTests, blobPathsOfDifferentFingerprintsShareHashPrefix) {
+    const auto avx2Path = NetworkCompilationContext::blobPath("cache", "0123456789abcdef", "avx2:1;avx512f:0");
+    const auto avx512Path = NetworkCompilationContext::blobPath("cache", "0123456789abcdef", "avx2:1;avx512f:1");
+    ASSERT_NE(avx2Path, avx512Path);
+    ASSERT_NE(std::string::npos, avx2Path.find("0123456789abcdef."));
+    ASSERT_NE(std::string::npos, avx512Path.find("0123456789abcdef."));
+    ASSERT_EQ(avx2Path, NetworkCompilationContext::blobPath("cache", "0123456789abcdef", "avx2:1;avx512f:0"));
+}
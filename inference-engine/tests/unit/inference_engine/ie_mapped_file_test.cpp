@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <details/ie_exception.hpp>
+
+#include "ie_mapped_file.hpp"
+
+using namespace InferenceEngine;
+
+class MappedFileTests : public ::testing::Test {
+protected:
+    const std::string fileName = "MappedFileTests.bin";
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+    }
+
+    void writeFile(const std::string& content) {
+        std::ofstream file(fileName, std::ios::binary);
+        file << content;
+    }
+};
+
+TEST_F(MappedFileTests, canMapFileContent) {
+    const std::string content = "0123456789abcdef";
+    writeFile(content);
+
+    details::MappedFile file(fileName.c_str());
+    ASSERT_EQ(content.size(), file.size());
+    ASSERT_EQ(content, std::string(file.data(), file.size()));
+}
+
+TEST_F(MappedFileTests, canMapEmptyFile) {
+    writeFile("");
+
+    details::MappedFile file(fileName.c_str());
+    ASSERT_EQ(0, file.size());
+}
+
+TEST_F(MappedFileTests, writesDoNotChangeFile) {
+    writeFile("abc");
+    {
+        details::MappedFile file(fileName.c_str());
+        file.data()[0] = 'x';
+    }
+    details::MappedFile file(fileName.c_str());
+    ASSERT_EQ('a', file.data()[0]);
+}
+
+TEST_F(MappedFileTests, throwsOnMissingFile) {
+    ASSERT_THROW(details::MappedFile("not_existing_file.bin"), details::InferenceEngineException);
+}
@@ -5,36 +5,36 @@
 #include <vector>
 #include <gtest/gtest.h>
 
-#include "mkldnn_memory_solver.hpp"
+#include <memory_solver.hpp>
 #include "details/ie_exception.hpp"
 
-using Box = MKLDNNPlugin::MemorySolver::Box;
+using Box = MemorySolver::Box;
 
 
 TEST(MemSolverTest, CanConstruct) {
     {   // Empty vector<Box>
-        MKLDNNPlugin::MemorySolver ms(std::vector<Box>{});
+        MemorySolver ms(std::vector<Box>{});
     }
 
     {   // vector with default Box
-        MKLDNNPlugin::MemorySolver ms(std::vector<Box>{{}});
+        MemorySolver ms(std::vector<Box>{{}});
     }
 
     {   // vector with Box with non-default Box
-        MKLDNNPlugin::MemorySolver ms(std::vector<Box>{{1, 3, 3}});
+        MemorySolver ms(std::vector<Box>{{1, 3, 3}});
     }
 
     {   // vector with Box with size == 0
-        MKLDNNPlugin::MemorySolver ms(std::vector<Box>{{0, 0, 0}});
+        MemorySolver ms(std::vector<Box>{{0, 0, 0}});
     }
 
     {   // vector with Box with finish == -1
-        MKLDNNPlugin::MemorySolver ms(std::vector<Box>{{3, -1, 6}});
+        MemorySolver ms(std::vector<Box>{{3, -1, 6}});
     }
 
-    // TODO: enable after implement TODO from src/mkldnn_plugin/mkldnn_memory_solver.cpp#L17
+    // TODO: enable after implement TODO from src/plugin_api/memory_solver.hpp
 //    {   // vector with Box with negative values
-//        MKLDNNPlugin::MemorySolver ms(std::vector<Box> {{-5, -5, -5, -5}});
+//        MemorySolver ms(std::vector<Box> {{-5, -5, -5, -5}});
 //    }
 }
 
@@ -47,7 +47,7 @@ TEST(MemSolverTest, GetOffset) {
             {n, ++n, 2, 3},   //      0  1  2  3  4
     };
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     ms.solve();
 
     //  The correct answer is [0, 2, 0, 2] or [2, 0, 2, 0].
@@ -65,7 +65,7 @@ TEST(MemSolverTest, GetOffsetThrowException) {
             {n, ++n, 2, id++},   //      0  1  2  3  4
     };
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     ms.solve();
 
     EXPECT_THROW(ms.getOffset(100), InferenceEngine::details::InferenceEngineException);
@@ -79,7 +79,7 @@ TEST(MemSolverTest, LinearAndEven) {
             {n, ++n, 2},      //  |__|____||____|__
     };                        //      0  1  2  3
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), 4);
     EXPECT_EQ(ms.maxDepth(), 4);
     EXPECT_EQ(ms.maxTopDepth(), 2);
@@ -93,7 +93,7 @@ TEST(MemSolverTest, LinearAndNotEven) {
             {n, ++n, 3},      //  |__|____||____|__
     };                        //      0  1  2  3
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), 5);
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
@@ -108,7 +108,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
             {n, n += 2, 3},      //  |__|_______|___|_______|__
     };                           //      2  3  4  5  6  7  8
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), 5);
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
@@ -122,7 +122,7 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
             {2, 3, 2},         //      2  3  4  5  6  7  8
     };
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
@@ -136,7 +136,7 @@ TEST(MemSolverTest, OverlappingBoxes) {
             {2, 3, 2},         //      2  3  4  5  6  7  8
     };
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), 6);
     EXPECT_EQ(ms.maxDepth(), 6);
     EXPECT_EQ(ms.maxTopDepth(), 2);
@@ -151,7 +151,7 @@ TEST(MemSolverTest, EndOnSeveralBegins) {
             {3, 4, 2},         //      0  1  2  3  4  5  6
     };
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), 6);
     EXPECT_EQ(ms.maxDepth(), 6);
     EXPECT_EQ(ms.maxTopDepth(), 3);
@@ -166,7 +166,7 @@ TEST(MemSolverTest, ToEndBoxes) {
             {3, 4,  2},         //      0  1  2  3  4  5  6
     };
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), 8);
     EXPECT_EQ(ms.maxDepth(), 8);
     EXPECT_EQ(ms.maxTopDepth(), 4);
@@ -181,7 +181,7 @@ TEST(MemSolverTest, LastAndToEndBox) {
             {3, 4,  2},         //      0  1  2  3  4  5  6
     };
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), 6);
     EXPECT_EQ(ms.maxDepth(), 6);
     EXPECT_EQ(ms.maxTopDepth(), 3);
@@ -218,7 +218,7 @@ TEST(MemSolverTest, OptimalAlexnet) {
     for (const auto &sh : shapes) boxes.push_back({n, ++n, sh[0] * sh[1] * sh[2]});
 
     // For linear topology bottom score is reachable minRequired == maxDepth
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), ms.maxDepth());
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
@@ -232,7 +232,7 @@ TEST(MemSolverTest, NoOverlapping) {
             {2, 4, 2, n++},   //      2  3  4  5  6  7  8
     };
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     ms.solve();
     // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
     // EXPECT_EQ(ms.solve(), 5);
@@ -258,7 +258,7 @@ TEST(MemSolverTest, BestSolution1) {
             {6, 7, 3, n++},   //      2  3  4  5  6  7  8
     };
 
-    MKLDNNPlugin::MemorySolver ms(boxes);
+    MemorySolver ms(boxes);
     EXPECT_EQ(ms.solve(), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
@@ -273,3 +273,43 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+TEST(MemSolverTest, BestOfIsNotWorseThanGreedy) {
+    int n = 0;                //  |         _____________
+    std::vector<Box> boxes{   //  |   _____|___1_________|
+            {4, 8, 1, n++},   //  |  |_2_____|    ____
+            {6, 7, 3, n++},   //  |  |    |      |    |
+            {2, 3, 3, n++},   //  |__|_3__|______|_3__|___
+            {2, 4, 2, n++},   //      2  3  4  5  6  7  8
+    };
+
+    MemorySolver greedy(boxes);
+    MemorySolver ms(boxes);
+    int64_t size = ms.solve(MemorySolver::Strategy::BestOf);
+    EXPECT_LE(size, greedy.solve());
+    EXPECT_GE(size, ms.maxDepth());
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = ms.getOffset(box1.id);
+        int off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+TEST(MemSolverTest, BestOfPlacesShortLivedBoxesLow) {
+    int n = 0;                //  |   ___________
+    std::vector<Box> boxes{   //  |  |_0_________|
+            {0, 3, 2, n++},   //  |__|_1__|______
+            {0, 1, 2, n++},   //      0  1  2  3
+    };
+
+    MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(MemorySolver::Strategy::BestOf), 4);
+    EXPECT_EQ(ms.getOffset(1), 0);
+    EXPECT_EQ(ms.getOffset(0), 2);
+}
@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "common_test_utils/test_common.hpp"
+
+#include "precision_utils.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace InferenceEngine;
+
+class PrecisionUtilsTests : public CommonTestUtils::TestsCommon {
+protected:
+    static uint32_t bits(float value) {
+        uint32_t result;
+        std::memcpy(&result, &value, sizeof(result));
+        return result;
+    }
+
+    // arrays are long enough to be split between threads and have a tail for the scalar code
+    static std::vector<float> f32Values() {
+        std::vector<float> values = {0.f, 1.f, -1.f, 0.5f, 65504.f, 65519.f, 65520.f, -70000.f, 6.1e-5f, 3.05e-5f,
+                                     1e-45f, 3.4e38f, std::numeric_limits<float>::infinity(),
+                                     -std::numeric_limits<float>::infinity(),
+                                     std::numeric_limits<float>::quiet_NaN()};
+        uint32_t state = 1;
+        while (values.size() < 100003) {
+            state = state * 1664525u + 1013904223u;
+            float value;
+            std::memcpy(&value, &state, sizeof(value));
+            values.push_back(value);
+        }
+        return values;
+    }
+};
+
+TEST_F(PrecisionUtilsTests, f16tof32ArraysMatchScalarConversion) {
+    std::vector<ie_fp16> src(65536 * 2 + 5);
+    for (size_t i = 0; i < src.size(); i++) {
+        src[i] = static_cast<ie_fp16>(i);
+    }
+    std::vector<float> dst(src.size());
+    PrecisionUtils::f16tof32Arrays(dst.data(), src.data(), src.size(), 2.f, 1.f);
+
+    for (size_t i = 0; i < src.size(); i++) {
+        const float expected = PrecisionUtils::f16tof32(src[i]) * 2.f + 1.f;
+        if (std::isnan(expected)) {
+            ASSERT_TRUE(std::isnan(dst[i])) << i;
+        } else {
+            ASSERT_EQ(bits(expected), bits(dst[i])) << i;
+        }
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysMatchScalarConversion) {
+    const auto src = f32Values();
+    std::vector<ie_fp16> dst(src.size());
+    PrecisionUtils::f32tof16Arrays(dst.data(), src.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(PrecisionUtils::f32tof16(src[i] * 1.f + 0.f), dst[i]) << i;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16KeepsSignOfInfinity) {
+    EXPECT_EQ(0x7C00, static_cast<uint16_t>(PrecisionUtils::f32tof16(std::numeric_limits<float>::infinity())));
+    EXPECT_EQ(0xFC00, static_cast<uint16_t>(PrecisionUtils::f32tof16(-std::numeric_limits<float>::infinity())));
+}
+
+TEST_F(PrecisionUtilsTests, bf16ArraysMatchScalarConversion) {
+    const auto src = f32Values();
+    std::vector<ie_bf16> bf16(src.size());
+    PrecisionUtils::f32tobf16Arrays(bf16.data(), src.data(), src.size());
+    std::vector<float> f32(src.size());
+    PrecisionUtils::bf16tof32Arrays(f32.data(), bf16.data(), bf16.size());
+
+    for (size_t i = 0; i < src.size(); i++) {
+        ASSERT_EQ(PrecisionUtils::f32tobf16(src[i] * 1.f + 0.f), bf16[i]) << i;
+        const float expected = PrecisionUtils::bf16tof32(bf16[i]) * 1.f + 0.f;
+        if (std::isnan(expected)) {
+            ASSERT_TRUE(std::isnan(f32[i])) << i;
+        } else {
+            ASSERT_EQ(bits(expected), bits(f32[i])) << i;
+        }
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tobf16RoundsToNearestEven) {
+    EXPECT_EQ(0x3F80, PrecisionUtils::f32tobf16(1.f));
+    // exactly between 0x3F80 and 0x3F81 rounds to the even one
+    EXPECT_EQ(0x3F80, PrecisionUtils::f32tobf16(1.f + 1.f / 256));
+    EXPECT_EQ(0x3F81, PrecisionUtils::f32tobf16(1.f + 1.5f / 256));
+    EXPECT_TRUE(std::isnan(PrecisionUtils::bf16tof32(PrecisionUtils::f32tobf16(std::numeric_limits<float>::quiet_NaN()))));
+}
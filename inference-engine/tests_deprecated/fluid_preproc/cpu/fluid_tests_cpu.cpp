@@ -393,6 +393,18 @@ INSTANTIATE_TEST_CASE_P(ColorFormat_NV12, PreprocTest,
                                 Values(std::make_pair(1, 3)),
                                 Values(TEST_SIZES_PREPROC)));
 
+// downscale by more than 2 times in width is done by the fused color conversion and resize
+INSTANTIATE_TEST_CASE_P(ColorFormat_NV12_FusedDownscale, PreprocTest,
+                        Combine(Values(U8toU8),
+                                Values(IE::ResizeAlgorithm::RESIZE_BILINEAR),
+                                Values(IE::ColorFormat::NV12),
+                                Values(IE::Layout::NCHW),
+                                Values(IE::Layout::NHWC, IE::Layout::NCHW),
+                                Values(std::make_pair(1, 3)),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(300, 300)),
+                                       std::make_pair(cv::Size(1280,  720), cv::Size(224, 224)),
+                                       std::make_pair(cv::Size( 640,  480), cv::Size( 99,  77)))));
+
 
 INSTANTIATE_TEST_CASE_P(DISABLED_PlainPrecisionConversions, PreprocTest,
                         Combine(Values(std::make_pair(IE::Precision::U16,IE::Precision::FP32),
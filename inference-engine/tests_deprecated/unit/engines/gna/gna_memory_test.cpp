@@ -437,4 +437,106 @@ TEST_F(GNAMemoryTest, canUpdateSizeOfPushRequestWithBindRequestWhenAlloc) {
     ASSERT_FLOAT_EQ(pFutureInput[0], 1);
     ASSERT_FLOAT_EQ(pFutureInput[1], 2);
     ASSERT_FLOAT_EQ(pFutureInput[2], 3);
-}
\ No newline at end of file
+}
+TEST_F(GNAMemoryTest, canShareReusableMemoryOfLayersNotUsedAtSameTime) {
+    float *pOutputs[4] = {};
+    float *pInputs[4] = {};
+
+    for (int layer = 0; layer != 5; layer++) {
+        mem.set_exec_order(layer);
+        if (layer != 0) {
+            mem.bind_ptr(&pInputs[layer - 1], &pOutputs[layer - 1]);
+        }
+        if (layer != 4) {
+            mem.reserve_reusable_ptr(&pOutputs[layer], 64, 64);
+        }
+    }
+    mem.commit();
+
+    // output of layer is written together with preceding activation, so only first and last outputs are not used at same time
+    ASSERT_EQ(mem.getRWBytes(), 3 * 64);
+    ASSERT_EQ(pOutputs[0], pOutputs[3]);
+    ASSERT_NE(pOutputs[0], pOutputs[1]);
+    ASSERT_NE(pOutputs[1], pOutputs[2]);
+    ASSERT_NE(pOutputs[0], pOutputs[2]);
+    ASSERT_EQ(pInputs[3], pOutputs[3]);
+}
+
+TEST_F(GNAMemoryTest, canKeepReusableMemoryUsedDuringWholeInference) {
+    float *pOutputs[4] = {};
+    float *pInputs[4] = {};
+    float *pNetworkOutput = nullptr;
+
+    for (int layer = 0; layer != 5; layer++) {
+        mem.set_exec_order(layer);
+        if (layer != 0) {
+            mem.bind_ptr(&pInputs[layer - 1], &pOutputs[layer - 1]);
+        }
+        if (layer != 4) {
+            mem.reserve_reusable_ptr(&pOutputs[layer], 64, 64);
+        }
+    }
+    mem.set_exec_order(-1);
+    mem.bind_ptr(&pNetworkOutput, &pOutputs[0]);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 4 * 64);
+    ASSERT_NE(pOutputs[0], pOutputs[3]);
+    ASSERT_EQ(pNetworkOutput, pOutputs[0]);
+}
+
+TEST_F(GNAMemoryTest, canPlaceReusableMemoryOverReleasedInplaceSource) {
+    float *pOutput = nullptr;
+    float *pInput = nullptr;
+    float *pInplaceOutput = nullptr;
+    float *pNextInput = nullptr;
+
+    mem.set_exec_order(0);
+    mem.reserve_reusable_ptr(&pOutput, 128, 64);
+    mem.set_exec_order(1);
+    mem.reserve_reusable_ptr(&pInplaceOutput, 64, 64, &pInput);
+    mem.bind_ptr(&pInput, &pOutput);
+    mem.set_exec_order(2);
+    mem.bind_ptr(&pNextInput, &pInplaceOutput);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 128);
+    ASSERT_EQ(pInplaceOutput, pOutput);
+    ASSERT_EQ(pNextInput, pOutput);
+}
+
+TEST_F(GNAMemoryTest, canNotPlaceReusableMemoryOverInplaceSourceUsedLater) {
+    float *pOutput = nullptr;
+    float *pInput = nullptr;
+    float *pInplaceOutput = nullptr;
+    float *pNextInput = nullptr;
+
+    mem.set_exec_order(0);
+    mem.reserve_reusable_ptr(&pOutput, 64, 64);
+    mem.set_exec_order(1);
+    mem.reserve_reusable_ptr(&pInplaceOutput, 64, 64, &pInput);
+    mem.bind_ptr(&pInput, &pOutput);
+    mem.set_exec_order(2);
+    mem.bind_ptr(&pNextInput, &pOutput);
+    mem.commit();
+
+    ASSERT_EQ(mem.getRWBytes(), 2 * 64);
+    ASSERT_NE(pInplaceOutput, pOutput);
+}
+
+TEST_F(GNAMemoryTest, canPlaceReusableMemoryBeforeOtherReadWriteMemory) {
+    float input[] = {1, 2, 3};
+    float *pInput = nullptr;
+    float *pOutput = nullptr;
+
+    mem.push_ptr(&pInput, input, sizeof(input), 64);
+    mem.set_exec_order(0);
+    mem.reserve_reusable_ptr(&pOutput, 64, 64);
+    mem.commit();
+
+    ASSERT_EQ(mem.getReusableBytes(), 64);
+    ASSERT_EQ(mem.getRWBytes(), 128);
+    ASSERT_EQ(pInput, pOutput + 16);
+    ASSERT_FLOAT_EQ(pInput[0], 1);
+    ASSERT_FLOAT_EQ(pInput[2], 3);
+}
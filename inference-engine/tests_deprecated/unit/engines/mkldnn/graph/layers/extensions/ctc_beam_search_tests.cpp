@@ -0,0 +1,240 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include "tests_common.hpp"
+#include <ie_core.hpp>
+
+#include <map>
+
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+
+struct ctc_beam_search_test_params {
+    // T, N, C
+    InferenceEngine::SizeVector in_dims;
+    int                         beam_width;
+    int                         blank_index;
+    std::vector<int>            seq_lengths;
+    std::vector<float>          src;
+    std::vector<float>          reference;
+
+    std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+};
+
+// finds the most probable labeling by the summation of probabilities of all paths
+void ref_ctc_decode(InferenceEngine::TBlob<float> &src, const std::vector<int> &seq_lengths, int blank_index,
+                    InferenceEngine::TBlob<float> &dst) {
+    const float *src_data = src.data();
+    float *dst_data = dst.data();
+    InferenceEngine::SizeVector dims = src.getTensorDesc().getDims();
+    size_t T = dims[0];
+    size_t N = dims[1];
+    size_t C = dims[2];
+    if (blank_index < 0) blank_index += C;
+
+    std::fill(dst_data, dst_data + dst.size(), -1.f);
+    for (size_t n = 0; n < N; n++) {
+        size_t paths = 1;
+        for (int t = 0; t < seq_lengths[n]; t++)
+            paths *= C;
+
+        std::map<std::vector<int>, double> labelings;
+        for (size_t path = 0; path < paths; path++) {
+            size_t rest = path;
+            double prob = 1.0;
+            int prev = -1;
+            std::vector<int> labeling;
+            for (int t = 0; t < seq_lengths[n]; t++) {
+                int c = static_cast<int>(rest % C);
+                rest /= C;
+                prob *= src_data[(t * N + n) * C + c];
+                if (c != blank_index && c != prev)
+                    labeling.push_back(c);
+                prev = c;
+            }
+            labelings[labeling] += prob;
+        }
+
+        auto best = labelings.begin();
+        for (auto it = labelings.begin(); it != labelings.end(); it++) {
+            if (it->second > best->second)
+                best = it;
+        }
+        for (size_t i = 0; i < best->first.size(); i++)
+            dst_data[n * T + i] = static_cast<float>(best->first[i]);
+    }
+}
+
+class MKLDNNCPUExtCTCBeamSearchTests : public TestsCommon, public WithParamInterface<ctc_beam_search_test_params> {
+    std::string model_t = R"V0G0N(
+<net Name="CTCBeamSearch_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="Probabilities" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    _IN_
+                </port>
+            </output>
+        </layer>
+        <layer name="SeqIndicators" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    _IND_
+                </port>
+            </output>
+        </layer>
+        <layer name="decoder" id="3" type="CTCBeamSearchDecoder" precision="FP32">
+            <data beam_width="_BW_" blank_index="_BI_"/>
+            <input>
+                <port id="1">
+                    _IN_
+                </port>
+                <port id="2">
+                    _IND_
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    _OUT_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="2"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::string getModel(ctc_beam_search_test_params p) {
+        std::string model = model_t;
+        std::string in, ind, out;
+
+        for (auto& dim : p.in_dims) {
+            in += "<dim>";
+            in += std::to_string(dim) + "</dim>\n";
+        }
+        ind += "<dim>" + std::to_string(p.in_dims[0]) + "</dim>\n";
+        ind += "<dim>" + std::to_string(p.in_dims[1]) + "</dim>\n";
+        out += "<dim>" + std::to_string(p.in_dims[1]) + "</dim>\n";
+        out += "<dim>" + std::to_string(p.in_dims[0]) + "</dim>\n";
+        out += "<dim>1</dim>\n<dim>1</dim>\n";
+
+        REPLACE_WITH_STR(model, "_IN_", in);
+        REPLACE_WITH_STR(model, "_IND_", ind);
+        REPLACE_WITH_STR(model, "_OUT_", out);
+        REPLACE_WITH_NUM(model, "_BW_", p.beam_width);
+        REPLACE_WITH_NUM(model, "_BI_", p.blank_index);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            ctc_beam_search_test_params p = ::testing::WithParamInterface<ctc_beam_search_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::Core core;
+            InferenceEngine::CNNNetwork network;
+            ASSERT_NO_THROW(network = core.ReadNetwork(model, InferenceEngine::Blob::CPtr()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(network);
+
+            size_t T = p.in_dims[0];
+            size_t N = p.in_dims[1];
+            size_t C = p.in_dims[2];
+
+            // Input Data
+            InferenceEngine::Blob::Ptr srcData = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, p.in_dims, InferenceEngine::Layout::CHW });
+            srcData->allocate();
+            float *src = srcData->buffer().as<float*>();
+            if (p.src.size()) {
+                memcpy(src, &p.src[0], sizeof(float)*p.src.size());
+            } else {
+                // distinct and normalized probabilities
+                for (size_t i = 0; i < T * N; i++) {
+                    float sum = 0.f;
+                    for (size_t c = 0; c < C; c++) {
+                        src[i * C + c] = 1.f + static_cast<float>((i * 7 + c * 13 + i * c * 5) % 17) + 0.01f * c;
+                        sum += src[i * C + c];
+                    }
+                    for (size_t c = 0; c < C; c++)
+                        src[i * C + c] /= sum;
+                }
+            }
+            auto * srcDataPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(srcData.get());
+            if (srcDataPtr == nullptr)
+                FAIL() << "Cannot cast blob to TBlob<float>.";
+
+            InferenceEngine::Blob::Ptr indData = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, { T, N }, InferenceEngine::Layout::NC });
+            indData->allocate();
+            float *ind = indData->buffer().as<float*>();
+            for (size_t t = 0; t < T; t++) {
+                for (size_t n = 0; n < N; n++)
+                    ind[t * N + n] = static_cast<int>(t) < p.seq_lengths[n] ? 1.f : 0.f;
+            }
+
+            // Output Data
+            InferenceEngine::OutputsDataMap out;
+            out = network.getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            // Output Reference
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_ctc_decode(*srcDataPtr, p.seq_lengths, p.blank_index, dst_ref);
+            for (size_t i = 0; i < p.reference.size(); i++) {
+                ASSERT_EQ(dst_ref.data()[i], p.reference[i]);
+            }
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("Probabilities", srcData));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("SeqIndicators", indData));
+
+            // Infer
+            graph.Infer(srcs, outputBlobs);
+            compare(*output, dst_ref, 0.f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtCTCBeamSearchTests, TestsCTCBeamSearch) {}
+
+INSTANTIATE_TEST_CASE_P(
+    TestsCTCBeamSearch, MKLDNNCPUExtCTCBeamSearchTests,
+        ::testing::Values(
+            // Params: in_dims, beam_width, blank_index, seq_lengths, src, reference
+            // beams are wide enough to keep all prefixes, so the search is exact
+            // the greedy path is blank-blank while the label 0 collects most of the probability
+            ctc_beam_search_test_params{ { 2, 2, 3 }, 4, -1, { 2, 1 },
+                                         { 0.4f, 0.f, 0.6f,   0.4f, 0.f, 0.6f,
+                                           0.4f, 0.f, 0.6f,   0.4f, 0.f, 0.6f },
+                                         { 0.f, -1.f, -1.f, -1.f } },
+            ctc_beam_search_test_params{ { 2, 1, 3 }, 4, 0, { 2 },
+                                         { 0.6f, 0.4f, 0.f,   0.6f, 0.4f, 0.f },
+                                         { 1.f, -1.f } },
+            ctc_beam_search_test_params{ { 5, 3, 4 }, 512, -1, { 5, 3, 1 }, {}, {} },
+            ctc_beam_search_test_params{ { 6, 2, 3 }, 512, 1, { 6, 4 }, {}, {} }
+        ));
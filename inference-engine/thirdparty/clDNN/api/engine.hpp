@@ -22,6 +22,8 @@
 #include <stdexcept>
 #include <vector>
 #include <map>
+#include <thread>
+#include <algorithm>
 
 namespace cldnn {
 
@@ -60,6 +62,8 @@ struct engine_configuration {
     const std::string compiler_options;       ///< OpenCL compiler options string.
     const std::string single_kernel_name;     ///< If provided, runs specific layer.
     const bool enable_parallelisation;        ///< Enables parallel execution of primitives which don't depend on each other. Disabled by default.
+                                              ///< Kernels are ordered by the events of their dependencies instead of queue barriers
+                                              ///< (requires out-of-order queue support, i.e. NEO driver).
     const std::string engine_log;             ///< Specifies a file to which engine log should be dumped. Empty by default (means no logging).
     const std::string sources_dumps_dir;      ///< Specifies a directory where sources of cldnn::program objects should be dumped.
                                               ///< Empty by default (means no dumping).
@@ -73,6 +77,10 @@ struct engine_configuration {
                                               ///< (switched off for older drivers then NEO).
     uint16_t n_streams;                       ///< Number of queues executed in parallel
     const std::string kernels_cache_path;     ///< Path to compiled kernels cache
+    const uint64_t kernels_cache_max_size;    ///< Maximum total size in bytes of binaries in the kernels cache, 0 means no limit
+    const uint16_t n_threads;                 ///< Maximum number of host threads used to compile kernels
+    const bool lazy_kernels_compilation;      ///< Build kernels of internal programs (e.g. condition branches) on demand
+                                              ///< or in the background once the outer program is ready
     const std::string tuning_cache_path;      ///< Path to tuning kernel cache
 
     /// @brief Constructs engine configuration with specified options.
@@ -87,7 +95,7 @@ struct engine_configuration {
         bool dump_custom_program = false,
         const std::string& options = std::string(),
         const std::string& single_kernel = std::string(),
-        bool primitives_parallelisation = true,
+        bool primitives_parallelisation = false,
         const std::string& engine_log = std::string(),
         const std::string& sources_dumps_dir = std::string(),
         priority_mode_types priority_mode = priority_mode_types::disabled,
@@ -95,6 +103,9 @@ struct engine_configuration {
         bool memory_pool = true,
         uint16_t n_streams = 1,
         const std::string& kernels_cache_path = "",
+        uint64_t kernels_cache_max_size = 0,
+        uint16_t n_threads = std::max(static_cast<uint16_t>(std::thread::hardware_concurrency()), static_cast<uint16_t>(1)),
+        bool lazy_kernels_compilation = false,
         const std::string& tuning_cache_path = "cache.json")
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
@@ -109,10 +120,16 @@ struct engine_configuration {
         , enable_memory_pool(memory_pool)
         , n_streams(n_streams)
         , kernels_cache_path(kernels_cache_path)
+        , kernels_cache_max_size(kernels_cache_max_size)
+        , n_threads(n_threads)
+        , lazy_kernels_compilation(lazy_kernels_compilation)
         , tuning_cache_path(tuning_cache_path) {
         if (n_streams == 0) {
             throw std::invalid_argument("Invalid streams count set in engine config");
         }
+        if (n_threads == 0) {
+            throw std::invalid_argument("Invalid threads count set in engine config");
+        }
     }
 };
 
@@ -172,6 +189,11 @@ struct engine {
     /// @brief Returns total size of currently resources allocated using given engine
     uint64_t get_temp_used_device_memory_size() const;
 
+    /// @brief Returns current and peak sizes of resources allocated using given engine, split by allocation type.
+    /// @details Keys are "<type>_current" and "<type>_peak" with <type> one of cl_mem, usm_host, usm_shared, usm_device,
+    /// plus "total_current" and "total_peak" for all allocations.
+    std::map<std::string, uint64_t> get_memory_statistics() const;
+
     /// @brief Returns type of the engine.
     engine_types get_type() const;
 
@@ -83,10 +83,38 @@ struct fully_connected : public primitive_base<fully_connected> {
         bias(bias)
     {}
 
+    /// @brief Constructs fully connected layer with compressed weights.
+    /// @details Integer weights are dequantized in the kernel as (weights - zero_point) * scale per output feature,
+    /// while the input and the output stay floating point.
+    /// @param id This primitive id.
+    /// @param input Input primitive id.
+    /// @param weights Primitive id containing i8 weights data.
+    /// @param bias Primitive id containing bias data. Provide empty string if using Relu without bias.
+    /// @param decompression_scale Primitive id containing decompression scales, one per output feature.
+    /// @param decompression_zero_point Primitive id containing decompression zero points, one per output feature.
+    fully_connected(const primitive_id& id,
+                    const primitive_id& input,
+                    const primitive_id& weights,
+                    const primitive_id& bias,
+                    const primitive_id& decompression_scale,
+                    const primitive_id& decompression_zero_point,
+                    const data_types data_type,
+                    const padding& output_padding = padding())
+        : primitive_base(id, { input }, output_padding, optional_data_type{data_type}),
+          weights(weights),
+          bias(bias),
+          decompression_scale(decompression_scale),
+          decompression_zero_point(decompression_zero_point)
+    {}
+
     /// @brief Primitive id containing weights data.
     primitive_id weights;
     /// @brief Primitive id containing bias data.
     primitive_id bias;
+    /// @brief Primitive id containing per output feature scales of compressed weights.
+    primitive_id decompression_scale;
+    /// @brief Primitive id containing per output feature zero points of compressed weights.
+    primitive_id decompression_zero_point;
 
 protected:
     std::vector<std::reference_wrapper<const primitive_id>> get_dependencies() const override {
@@ -96,6 +124,11 @@ protected:
         if (!bias.empty())
             ret.push_back(bias);
 
+        if (!decompression_scale.empty()) {
+            ret.push_back(decompression_scale);
+            ret.push_back(decompression_zero_point);
+        }
+
         return ret;
     }
 };
@@ -113,6 +113,12 @@ struct network {
     /// @brief Provides user-supplied @ref memory for output primitives defined by user in source @ref topology.
     void set_output_memory(const primitive_id& id, const memory& mem) const;
 
+    /// @brief Limits the number of batches computed by next executions of the network.
+    /// @details Kernels which enumerate output batches in a separate dimension process only the first @p batch batches
+    /// of outputs which have the batch of network inputs, other kernels process all batches.
+    /// Value 0 resets the limit.
+    void set_execution_batch(uint32_t batch) const;
+
     /// @brief Return stream id.
     uint16_t get_stream_id();
 
@@ -115,7 +115,7 @@ struct reorder : public primitive_base<reorder> {
     /// @param id This primitive id.
     /// @param input input primitive id.
     /// @param input input2 primitive id.
-    /// @param output_layout Requested memory layout.
+    /// @param output_layout Requested memory layout, its spatial sizes may differ from the input ones (bilinear resize).
     /// @param values_to_subtract Array of mean subtract values.
     reorder(const primitive_id& id,
         const primitive_id& input,
@@ -127,13 +127,14 @@ struct reorder : public primitive_base<reorder> {
           output_format(output_layout.format),
           mean(""),
           subtract_per_feature(values_to_subtract),
-          mean_mode(mode) {}
+          mean_mode(mode),
+          output_size(output_layout.size) {}
 
     /// @brief Constructs reorder primitive with two inputs, which takes mean subtract values from another primitive.
     /// @param id This primitive id.
     /// @param input input primitive id.
     /// @param input input2 primitive id.
-    /// @param output_layout Requested memory layout.
+    /// @param output_layout Requested memory layout, its spatial sizes may differ from the input ones (bilinear resize).
     /// @param mean Primitive id to get mean subtract values.
     reorder(const primitive_id& id,
         const primitive_id& input,
@@ -144,7 +145,8 @@ struct reorder : public primitive_base<reorder> {
         : primitive_base(id, { input, input2 }, output_layout.data_padding, optional_data_type{ output_layout.data_type }),
         output_format(output_layout.format),
         mean(mean),
-        mean_mode(mode) {}
+        mean_mode(mode),
+        output_size(output_layout.size) {}
 
     /// @brief Requested memory format.
     format output_format;
@@ -154,6 +156,9 @@ struct reorder : public primitive_base<reorder> {
     std::vector<float> subtract_per_feature;
     /// @brief Mode of mean execution
     reorder_mean_mode mean_mode;
+    /// @brief Requested output size of the reorder from two NV12 planes. The image is bilinearly resized,
+    /// if its spatial sizes differ from ones of the Y plane. Not used by other reorders.
+    tensor output_size = tensor(0);
 
 protected:
     std::vector<std::reference_wrapper<const primitive_id>> get_dependencies() const override {
@@ -0,0 +1,69 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "api/primitive.hpp"
+#include <vector>
+
+namespace cldnn {
+/// @addtogroup cpp_api C++ API
+/// @{
+/// @addtogroup cpp_topology Network Topology
+/// @{
+/// @addtogroup cpp_primitives Primitives
+/// @{
+
+/// @brief Performs scaled dot-product attention in one primitive.
+/// @details For every batch b and head h (feature) computes
+///   output[b, h] = softmax(scale * query[b, h] * key[b, h]^T + mask) * value[b, h]
+/// where query is [b, h, seq_q, head_size], value is [b, h, seq_k, head_size] and key is
+/// [b, h, seq_k, head_size] if @p transpose_key is set or [b, h, head_size, seq_k] otherwise.
+/// Softmax is taken along the keys, the optional mask is broadcasted over [b, h, seq_q, seq_k].
+/// The primitive is created by graph optimizer from gemm -> (scale) -> (eltwise sum) -> softmax -> gemm chain,
+/// so [b, h, seq_q, seq_k] scores are never stored in global memory.
+struct attention : public primitive_base<attention> {
+    CLDNN_DECLARE_PRIMITIVE(attention)
+
+    /// @brief Constructs attention primitive.
+    /// @param id This primitive id.
+    /// @param inputs Query, key, value and optional mask primitive ids.
+    /// @param data_type Output data type.
+    /// @param scale Multiplier of query * key^T products.
+    /// @param transpose_key Key is stored as [seq_k, head_size] matrices.
+    attention(const primitive_id& id,
+              const std::vector<primitive_id>& inputs,
+              const data_types data_type,
+              const float scale = 1.0f,
+              const bool transpose_key = true,
+              const padding& output_padding = padding())
+        : primitive_base(id, inputs, output_padding, optional_data_type{ data_type }),
+          scale(scale),
+          transpose_key(transpose_key) {
+        if (inputs.size() != 3 && inputs.size() != 4) {
+            throw std::invalid_argument("Invalid inputs count - attention expects either three or four inputs");
+        }
+    }
+
+    /// @brief Multiplier of query * key^T products.
+    float scale;
+    /// @brief Key is stored as [seq_k, head_size] matrices.
+    bool transpose_key;
+};
+/// @}
+/// @}
+/// @}
+}  // namespace cldnn
@@ -0,0 +1,152 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "attention_kernel_tile_slm.h"
+#include "kernel_selector_utils.h"
+#include <algorithm>
+#include <string>
+
+namespace kernel_selector {
+static size_t GetSlmSize(const attention_params& params, size_t key_block, size_t query_block) {
+    const size_t head_size = params.inputs[0].X().v;
+    return query_block * head_size * BytesPerElement(params.inputs[0].GetDType()) +
+           key_block * head_size * BytesPerElement(params.inputs[1].GetDType()) +
+           key_block * head_size * BytesPerElement(params.inputs[2].GetDType()) +
+           query_block * key_block * BytesPerElement(Datatype::F32);
+}
+
+ParamsKey AttentionKernelTileSLM::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableInputDataType(Datatype::INT8);
+    k.EnableInputDataType(Datatype::UINT8);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    k.EnableDifferentTypes();
+    return k;
+}
+
+AttentionKernelTileSLM::TileSizes AttentionKernelTileSLM::GetTileSizes(const attention_params& params) const {
+    const size_t seq_len_q = params.inputs[0].Y().v;
+    const size_t seq_len_k = params.inputs[2].Y().v;
+    const size_t max_slm = params.engineInfo.maxLocalMemSize;
+
+    TileSizes tiles = {64, 1};
+    while (tiles.key_block > 8 && (tiles.key_block / 2 >= seq_len_k || GetSlmSize(params, tiles.key_block, 1) > max_slm))
+        tiles.key_block /= 2;
+
+    const size_t max_query_block = std::min<size_t>(16, params.engineInfo.maxWorkGroupSize / tiles.key_block);
+    while (tiles.query_block * 2 <= max_query_block && tiles.query_block < seq_len_q &&
+           GetSlmSize(params, tiles.key_block, tiles.query_block * 2) <= max_slm)
+        tiles.query_block *= 2;
+
+    return tiles;
+}
+
+bool AttentionKernelTileSLM::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::ATTENTION || o.GetType() != KernelType::ATTENTION)
+        return false;
+
+    const attention_params& params = static_cast<const attention_params&>(p);
+    if (params.inputs.size() != 3 && params.inputs.size() != 4)
+        return false;
+
+    if (!params.fused_ops.empty())
+        return false;
+
+    const auto& query = params.inputs[0];
+    const auto& key = params.inputs[1];
+    const auto& value = params.inputs[2];
+    const size_t key_head_size = params.transpose_key ? key.X().v : key.Y().v;
+    const size_t key_seq_len = params.transpose_key ? key.Y().v : key.X().v;
+
+    if (query.X().v != key_head_size || key_seq_len != value.Y().v || value.X().v != query.X().v)
+        return false;
+
+    if (key.Batch().v != query.Batch().v || key.Feature().v != query.Feature().v ||
+        value.Batch().v != query.Batch().v || value.Feature().v != query.Feature().v)
+        return false;
+
+    auto tiles = GetTileSizes(params);
+    if (tiles.key_block > params.engineInfo.maxWorkGroupSize ||
+        GetSlmSize(params, tiles.key_block, tiles.query_block) > params.engineInfo.maxLocalMemSize)
+        return false;
+
+    return true;
+}
+
+CommonDispatchData AttentionKernelTileSLM::SetDefault(const attention_params& params) const {
+    CommonDispatchData dispatchData;
+    const auto& output = params.output;
+    auto tiles = GetTileSizes(params);
+
+    dispatchData.gws = { tiles.key_block,
+                         Align(output.Y().v, tiles.query_block),
+                         output.Batch().v * output.Feature().v };
+    dispatchData.lws = { tiles.key_block, tiles.query_block, 1 };
+
+    return dispatchData;
+}
+
+JitConstants AttentionKernelTileSLM::GetJitConstants(const attention_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+    auto tiles = GetTileSizes(params);
+    const size_t head_size = params.inputs[0].X().v;
+
+    jit.AddConstants({
+        MakeJitConstant("HEAD_SIZE", head_size),
+        MakeJitConstant("SEQ_LEN_Q", params.inputs[0].Y().v),
+        MakeJitConstant("SEQ_LEN_K", params.inputs[2].Y().v),
+        MakeJitConstant("KEY_BLOCK", tiles.key_block),
+        MakeJitConstant("QUERY_BLOCK", tiles.query_block),
+        MakeJitConstant("ACC_COUNT", CeilDiv(head_size, tiles.key_block)),
+        MakeJitConstant("SCALE", params.scale),
+        MakeJitConstant("TRANSPOSE_KEY", params.transpose_key),
+        MakeJitConstant("HAS_MASK", params.inputs.size() == 4),
+    });
+    jit.Merge(MakeTypeJitConstants(Datatype::F32, "ACCUMULATOR"));
+
+    return jit;
+}
+
+KernelsData AttentionKernelTileSLM::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options)) {
+        return {};
+    }
+
+    KernelData kd = KernelData::Default<attention_params>(params);
+    attention_params& newParams = *static_cast<attention_params*>(kd.params.get());
+
+    auto dispatchData = SetDefault(newParams);
+    auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
+    auto cldnn_jit = GetJitConstants(newParams);
+    std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+    auto& kernel = kd.kernels[0];
+    FillCLKernelData(kernel, dispatchData, params.engineInfo, kernelName, jit, entry_point,
+                     DEFAULT, false, false, static_cast<int>(newParams.inputs.size()));
+
+    kd.estimatedTime = FORCE_PRIORITY_3;
+
+    return {kd};
+}
+}  // namespace kernel_selector
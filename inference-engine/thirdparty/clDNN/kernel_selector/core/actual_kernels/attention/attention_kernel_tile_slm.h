@@ -0,0 +1,63 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "kernel_base_opencl.h"
+
+namespace kernel_selector {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// attention_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct attention_params : public base_params {
+    attention_params() : base_params(KernelType::ATTENTION), scale(1.0f), transpose_key(true) {}
+
+    float scale;
+    bool transpose_key;
+
+    virtual ParamsKey GetParamsKey() const { return base_params::GetParamsKey(); }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// attention_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct attention_optional_params : optional_params {
+    attention_optional_params() : optional_params(KernelType::ATTENTION) {}
+};
+
+// Work group keeps a block of query rows in SLM and walks over blocks of keys/values,
+// softmax is computed on the fly with running max and sum of every row.
+class AttentionKernelTileSLM : public KernelBaseOpenCL {
+public:
+    AttentionKernelTileSLM() : KernelBaseOpenCL("attention_tile_slm") {}
+    virtual ~AttentionKernelTileSLM() = default;
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    struct TileSizes {
+        size_t key_block;
+        size_t query_block;
+    };
+
+    bool Validate(const Params& p, const optional_params& o) const override;
+    TileSizes GetTileSizes(const attention_params& params) const;
+    CommonDispatchData SetDefault(const attention_params& params) const;
+    JitConstants GetJitConstants(const attention_params& params) const;
+};
+}  // namespace kernel_selector
@@ -109,6 +109,7 @@ ConvolutionKernelBase::DispatchData ConvolutionKernel_b_fs_yx_fsv16::SetDefault(
     dispatchData.lws[0] = 1;
     dispatchData.lws[1] = sub_group_size;
     dispatchData.lws[2] = 1;
+    dispatchData.batch_dim = 2;
 
     if (b == 1)
         dispatchData.efficiency = FORCE_PRIORITY_2;
@@ -92,6 +92,7 @@ ConvolutionKernelBase::DispatchData ConvolutionKernel_b_fs_yx_fsv16_1x1::SetDefa
     dispatchData.lws[0] = 1;
     dispatchData.lws[1] = sub_group_size;
     dispatchData.lws[2] = 1;
+    dispatchData.batch_dim = 2;
 
     auto bBlockSizeX = x % autoTune.blockWidth == 0;
     auto bBlockSizeXY = out.X().pad.Total() + out.Y().pad.Total() == 0;
@@ -81,6 +81,7 @@ ConvolutionKernelBase::DispatchData ConvolutionKernel_b_fs_yx_fsv16_depthwise::S
     dispatchData.lws[0] = 1;
     dispatchData.lws[1] = sub_group_size;
     dispatchData.lws[2] = 1;
+    dispatchData.batch_dim = 2;
 
     if (out.Batch().v == 1)
         dispatchData.efficiency = FORCE_PRIORITY_1;
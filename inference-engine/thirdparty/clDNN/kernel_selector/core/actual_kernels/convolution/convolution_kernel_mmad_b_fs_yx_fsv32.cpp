@@ -119,6 +119,7 @@ ConvolutionKernelBase::DispatchData ConvolutionKernel_mmad_b_fs_yx_fsv32::SetDef
     dispatchData.lws[0] = 8;
     dispatchData.lws[1] = ow_group;
     dispatchData.lws[2] = 1;
+    dispatchData.batch_dim = 2;
 
     return dispatchData;
 }
@@ -214,6 +214,7 @@ EltwiseKernelBase::DispatchData EltwiseKernel_b_fs_yx_fsv16::SetDefault(const el
         dispatchData.lws[1]--;
     }
     dispatchData.lws[2] = 1;
+    dispatchData.batch_dim = 2;
 
     dispatchData.efficiency = FORCE_PRIORITY_1;
     return dispatchData;
@@ -237,6 +238,7 @@ KernelsData EltwiseKernel_b_fs_yx_fsv16::GetKernelsData(const Params& params, co
 
     kernel.workGroups.global = dispatchData.gws;
     kernel.workGroups.local = dispatchData.lws;
+    kernel.workGroups.batch_dim = dispatchData.batch_dim;
 
     kernel.kernelString = GetKernelString(kernelName, jit, entry_point, params.engineInfo, DEFAULT);
     kernel.arguments = GetArgsDesc((uint32_t)newParams.inputs.size(),
@@ -31,7 +31,16 @@ ParamsKey EltwiseKernel_fs_b_yx_fsv32::GetSupportedKey() const {
 }
 
 JitConstants EltwiseKernel_fs_b_yx_fsv32::GetJitConstants(const eltwise_params& params) const {
-    return GetJitConstantsCommon(params, true);
+    JitConstants jit = GetJitConstantsCommon(params, true);
+
+    if (!params.fused_ops.empty()) {
+        jit.AddConstant(MakeJitConstant("FEATURE_SLICE_SIZE", 32));
+
+        FusedOpsConfiguration conf = {"", {"b", "f", "y", "x"}, "value", Datatype::F16};
+        jit.Merge(MakeFusedOpsJitConstants(params, {conf}));
+    }
+
+    return jit;
 }
 
 bool EltwiseKernel_fs_b_yx_fsv32::Validate(const Params& params, const optional_params& o) const {
@@ -69,7 +78,14 @@ bool EltwiseKernel_fs_b_yx_fsv32::Validate(const Params& params, const optional_
         }
     }
 
-    if (!bCheckSizes || !bSupportedCount || !bCheckUpdateInput || !bCheckUseOutput) {
+    // Fused ops compute coordinates from the linear offset, so the output must be dense
+    bool bCheckFusedOps = true;
+    if (!ewParams.fused_ops.empty()) {
+        bCheckFusedOps = output.X().pad.Total() == 0 && output.Y().pad.Total() == 0 &&
+                         output.Batch().pad.Total() == 0 && output.Feature().pad.before == 0;
+    }
+
+    if (!bCheckSizes || !bSupportedCount || !bCheckUpdateInput || !bCheckUseOutput || !bCheckFusedOps) {
         return false;
     }
 
@@ -109,7 +125,7 @@ KernelsData EltwiseKernel_fs_b_yx_fsv32::GetKernelsData(const Params& params, co
     kernel.workGroups.local = GetOptimalLocalWorkGroupSizes(kernel.workGroups.global, params.engineInfo);
 
     kernel.kernelString = GetKernelString(kernelName, jit, entry_point, params.engineInfo, DEFAULT);
-    kernel.arguments = GetArgsDesc((uint32_t)newParams.inputs.size(), false, false);
+    kernel.arguments = GetArgsDesc((uint32_t)newParams.inputs.size(), false, false, GetFusedPrimitiveInputsCount(params));
 
     kd.estimatedTime = FORCE_PRIORITY_8;
 
@@ -29,6 +29,12 @@ JitConstants FullyConnectedKernelBase::GetJitConstants(const fully_connected_par
 
     jit.AddConstant(MakeJitConstant("INPUT0_ELEMENTS_COUNT", x_size));
 
+    if (params.compressed) {
+        jit.AddConstant(MakeJitConstant("COMPRESSED_WEIGHTS", 1));
+        jit.AddConstant(MakeJitConstant("DECOMPRESSION_SCALE", params.decompression_scale));
+        jit.AddConstant(MakeJitConstant("DECOMPRESSION_ZP", params.decompression_zero_point));
+    }
+
     return jit;
 }
 
@@ -121,6 +127,15 @@ KernelsData FullyConnectedKernelBase::GetCommonKernelsData(const Params &params,
                      1,
                      fused_deps_total);
 
+    // Decompression parameters follow the bias in kernel arguments
+    if (newParams.compressed) {
+        auto fused_args_it = std::find_if(kernel.arguments.begin(), kernel.arguments.end(), [](const ArgumentDescriptor& arg) {
+            return arg.t == ArgumentDescriptor::Types::INPUT_OF_FUSED_PRIMITIVE;
+        });
+        kernel.arguments.insert(fused_args_it, {{ArgumentDescriptor::Types::SCALE_TABLE, 0},
+                                                {ArgumentDescriptor::Types::WEIGHTS_ZERO_POINTS, 0}});
+    }
+
     // TODO Pass estimated time only through DispatchData
     kd.estimatedTime = estimated_time;
     kd.autoTuneIndex = autoTuneIndex;
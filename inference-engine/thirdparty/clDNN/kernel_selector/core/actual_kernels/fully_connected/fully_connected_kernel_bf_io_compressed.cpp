@@ -0,0 +1,94 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "fully_connected_kernel_bf_io_compressed.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+ParamsKey FullyConnected_bf_io_compressed::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableInputWeightsType(WeightsType::INT8);
+    k.EnableDifferentInputWeightsTypes();
+    k.EnableAllInputLayout();
+    k.EnableOutputLayout(DataLayout::bf);
+    k.EnableBatching();
+    k.EnableBiasPerFeature();
+    k.EnableNonBiasTerm();
+    k.EnableFCCompressedWeights();
+    return k;
+}
+
+bool FullyConnected_bf_io_compressed::Validate(const Params& params, const optional_params& options) const {
+    if (!Parent::Validate(params, options))
+        return false;
+
+    const auto& fc_params = static_cast<const fully_connected_params&>(params);
+    if (!fc_params.compressed)
+        return false;
+
+    // one scale and zero point per output feature
+    const auto ofm = fc_params.output.Feature().v;
+    return fc_params.decompression_scale.LogicalSize() == ofm &&
+           fc_params.decompression_zero_point.LogicalSize() == ofm;
+}
+
+FullyConnected_bf_io_compressed::DispatchData FullyConnected_bf_io_compressed::SetDefault(const fully_connected_params& params,
+                                                                                          int) const {
+    auto dispatchData = Parent::SetDefault(params);
+
+    dispatchData.gws = { params.output.Feature().v, params.output.Batch().v, 1 };
+    dispatchData.lws = GetOptimalLocalWorkGroupSizes(dispatchData.gws, params.engineInfo);
+    dispatchData.batch_dim = 1;
+
+    return dispatchData;
+}
+
+JitConstants FullyConnected_bf_io_compressed::GetJitConstants(const fully_connected_params& params,
+                                                              const DispatchData& dispatchData) const {
+    JitConstants jit = Parent::GetJitConstants(params, dispatchData);
+    const auto accumulator_dt = Datatype::F32;
+
+    jit.Merge(MakeTypeJitConstants(accumulator_dt, "ACCUMULATOR"));
+    jit.Merge(MakeActivationJitConstants(params.activations, accumulator_dt, "_TYPED"));
+
+    if (!params.fused_ops.empty()) {
+        FusedOpsConfiguration conf = { "", {"b", "ofm", "0", "0"}, "result", accumulator_dt, 1 };
+        jit.Merge(MakeFusedOpsJitConstants(params, { conf }));
+    }
+    return jit;
+}
+
+KernelsData FullyConnected_bf_io_compressed::GetKernelsData(const Params& params, const optional_params& optParams) const {
+    KernelsData res = {};
+    for (size_t i = 0; i < autoTuneOptions.size(); i++) {
+        KernelsData kd = GetTunedKernelsDataByIndex(params,
+                                                    optParams,
+                                                    DataLayout::bf,
+                                                    WeightsLayout::io,
+                                                    FORCE_PRIORITY_3,
+                                                    static_cast<int>(i));
+        if (!kd.empty()) {
+            res.emplace_back(kd[0]);
+        }
+    }
+
+    return res;
+}
+
+}  // namespace kernel_selector
@@ -0,0 +1,42 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <vector>
+
+#include "fully_connected_kernel_base.h"
+
+namespace kernel_selector {
+
+// Floating point fully connected with INT8 weights in io layout, dequantized with per output feature scale and zero point.
+class FullyConnected_bf_io_compressed : public FullyConnectedKernelBase {
+public:
+    using Parent = FullyConnectedKernelBase;
+    FullyConnected_bf_io_compressed() : FullyConnectedKernelBase("fully_connected_gpu_bf_io_compressed") {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    std::vector<FusedOpType> GetSupportedFusedOps() const override {
+        return { FusedOpType::ACTIVATION,
+                 FusedOpType::SCALE,
+                 FusedOpType::ELTWISE };
+    }
+    bool Validate(const Params& params, const optional_params& options) const override;
+    DispatchData SetDefault(const fully_connected_params& params, int autoTuneIndex = -1) const override;
+    JitConstants GetJitConstants(const fully_connected_params& params, const DispatchData& dispatchData) const override;
+};
+}  // namespace kernel_selector
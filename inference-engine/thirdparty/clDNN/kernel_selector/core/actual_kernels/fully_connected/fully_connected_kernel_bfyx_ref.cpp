@@ -52,6 +52,7 @@ FullyConnected_bfyx_Ref::DispatchData FullyConnected_bfyx_Ref::SetDefault(const
 
     dispatchData.gws = { params.output.Feature().v, params.output.Batch().v, 1 };
     dispatchData.lws = GetOptimalLocalWorkGroupSizes(dispatchData.gws, params.engineInfo);
+    dispatchData.batch_dim = 1;
 
     return dispatchData;
 }
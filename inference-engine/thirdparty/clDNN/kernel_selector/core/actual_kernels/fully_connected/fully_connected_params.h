@@ -28,10 +28,18 @@ struct fully_connected_params : public weight_bias_params {
 
     QuantizationType quantization = QuantizationType::NONE;
 
+    // Integer weights of floating point layer, dequantized in the kernel as (w - zero_point) * scale per output feature
+    bool compressed = false;
+    DataTensor decompression_scale;
+    DataTensor decompression_zero_point;
+
     virtual ParamsKey GetParamsKey() const {
         ParamsKey k = weight_bias_params::GetParamsKey();
 
         k.EnableQuantization(quantization);
+        if (compressed) {
+            k.EnableFCCompressedWeights();
+        }
 
         return k;
     }
@@ -20,7 +20,7 @@
 #include <vector>
 
 namespace kernel_selector {
-static size_t GetGatherChannelIndex(const gather_params& params) {
+size_t GetGatherChannelIndex(const gather_params& params) {
     Tensor::DataChannelName name = Tensor::DataChannelName::X;
 
     size_t inputSize = params.inputs[0].GetDims().size();
@@ -50,6 +50,8 @@ ParamsKey GatherKernelRef::GetSupportedKey() const {
     k.EnableInputDataType(Datatype::F16);
     k.EnableInputDataType(Datatype::F32);
     k.EnableInputDataType(Datatype::INT32);
+    k.EnableInputDataType(Datatype::INT8);
+    k.EnableInputDataType(Datatype::UINT8);
     k.EnableOutputDataType(Datatype::F16);
     k.EnableOutputDataType(Datatype::F32);
     k.EnableOutputDataType(Datatype::INT32);
@@ -61,6 +63,10 @@ ParamsKey GatherKernelRef::GetSupportedKey() const {
     k.EnableOutputLayout(DataLayout::bfzyx);
     k.EnableInputLayout(DataLayout::bfwzyx);
     k.EnableOutputLayout(DataLayout::bfwzyx);
+    k.EnableInputLayout(DataLayout::b_fs_yx_fsv16);
+    k.EnableOutputLayout(DataLayout::b_fs_yx_fsv16);
+    k.EnableInputLayout(DataLayout::b_fs_zyx_fsv16);
+    k.EnableOutputLayout(DataLayout::b_fs_zyx_fsv16);
     k.EnableTensorOffset();
     k.EnableTensorPitches();
     k.EnableBatching();
@@ -155,9 +161,9 @@ CommonDispatchData GatherKernelRef::SetDefault(const gather_params& params, cons
     CommonDispatchData dispatchData;
     const auto& output = params.output;
 
-    if (output.GetLayout() == DataLayout::bfyx) {
+    if (output.Dimentions() == 4) {
         dispatchData.gws = {output.X().v, output.Y().v, output.Feature().v * output.Batch().v};
-    } else if (output.GetLayout() == DataLayout::bfzyx) {
+    } else if (output.Dimentions() == 5) {
         dispatchData.gws = {output.X().v, output.Y().v * output.Z().v, output.Feature().v * output.Batch().v};
     } else {
         dispatchData.gws = {output.X().v * output.Y().v, output.Z().v * output.W().v, output.Feature().v * output.Batch().v};
@@ -199,7 +205,9 @@ bool GatherKernelRef::Validate(const Params& p, const optional_params& o) const
     return true;
 }
 
-KernelsData GatherKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
+KernelsData GatherKernelRef::GetCommonKernelsData(const Params& params,
+                                                  const optional_params& options,
+                                                  float estimatedTime) const {
     if (!Validate(params, options)) {
         return {};
     }
@@ -216,8 +224,12 @@ KernelsData GatherKernelRef::GetKernelsData(const Params& params, const optional
 
     FillCLKernelData(kernel, dispatchData, params.engineInfo, kernelName, jit, entry_point, "", false, false, 2, GetFusedPrimitiveInputsCount(params));
 
-    kd.estimatedTime = DONT_USE_IF_HAVE_SOMETHING_ELSE;
+    kd.estimatedTime = estimatedTime;
 
     return {kd};
 }
+
+KernelsData GatherKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
+    return GetCommonKernelsData(params, options, DONT_USE_IF_HAVE_SOMETHING_ELSE);
+}
 }  // namespace kernel_selector
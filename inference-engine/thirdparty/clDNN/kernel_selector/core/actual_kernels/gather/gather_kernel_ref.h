@@ -17,6 +17,8 @@
 #pragma once
 
 #include "kernel_base_opencl.h"
+#include <string>
+#include <vector>
 
 namespace kernel_selector {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -37,6 +39,9 @@ struct gather_optional_params : optional_params {
     gather_optional_params() : optional_params(KernelType::GATHER) {}
 };
 
+// position of the gather axis in b, f, (w, z,) y, x order of the dictionary dims
+size_t GetGatherChannelIndex(const gather_params& params);
+
 class GatherKernelRef : public KernelBaseOpenCL {
 public:
     GatherKernelRef() : KernelBaseOpenCL("gather_ref") {}
@@ -52,6 +57,8 @@ public:
     }
 
 protected:
+    explicit GatherKernelRef(const std::string& kernelName) : KernelBaseOpenCL(kernelName) {}
     bool Validate(const Params& p, const optional_params& o) const override;
+    KernelsData GetCommonKernelsData(const Params& params, const optional_params& options, float estimatedTime) const;
 };
 }  // namespace kernel_selector
@@ -0,0 +1,176 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "gather_kernel_rows.h"
+#include "kernel_selector_utils.h"
+#include <string>
+#include <vector>
+
+namespace kernel_selector {
+
+namespace {
+constexpr size_t sub_group_size = 16;
+
+// output is [outer][indices][row] and dictionary is [outer][axis][row], all of them are contiguous
+struct GatherRows {
+    size_t outer;
+    size_t axis;
+    size_t row;
+    size_t indices;
+};
+
+GatherRows GetGatherRows(const gather_params& params) {
+    GatherRows rows = {1, 1, 1, params.inputs[1].LogicalSize()};
+
+    const auto& dims = params.inputs[0].GetDims();
+    const size_t axis = GetGatherChannelIndex(params);
+    // dims are stored starting from x, the axis index is counted starting from batch
+    for (size_t i = 0; i < dims.size(); i++) {
+        const size_t channel = dims.size() - 1 - i;
+        if (channel < axis)
+            rows.outer *= dims[i].v;
+        else if (channel == axis)
+            rows.axis = dims[i].v;
+        else
+            rows.row *= dims[i].v;
+    }
+
+    return rows;
+}
+
+size_t GetVectorSize(const gather_params& params) {
+    // fused ops need coordinates of every element, so they are applied to one element per work item
+    if (!params.fused_ops.empty())
+        return 1;
+
+    const size_t row = GetGatherRows(params).row;
+    for (size_t vec_size : {8, 4, 2}) {
+        if (row % (vec_size * sub_group_size) == 0)
+            return vec_size;
+    }
+    return 1;
+}
+
+bool IsDense(const DataTensor& tensor) {
+    return tensor.GetFirstElementOffset() == 0 && tensor.LogicalSize() == tensor.PhysicalSize();
+}
+}  // namespace
+
+ParamsKey GatherKernelRows::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableInputDataType(Datatype::INT32);
+    k.EnableInputDataType(Datatype::INT8);
+    k.EnableInputDataType(Datatype::UINT8);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::INT32);
+    k.EnableOutputDataType(Datatype::INT8);
+    k.EnableOutputDataType(Datatype::UINT8);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableInputLayout(DataLayout::bfzyx);
+    k.EnableOutputLayout(DataLayout::bfzyx);
+    k.EnableInputLayout(DataLayout::bfwzyx);
+    k.EnableOutputLayout(DataLayout::bfwzyx);
+    k.EnableInputLayout(DataLayout::b_fs_yx_fsv16);
+    k.EnableOutputLayout(DataLayout::b_fs_yx_fsv16);
+    k.EnableInputLayout(DataLayout::b_fs_zyx_fsv16);
+    k.EnableOutputLayout(DataLayout::b_fs_zyx_fsv16);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    k.EnableDifferentTypes();
+    k.EnableSubGroup();
+    k.EnableSubGroupShort();
+    return k;
+}
+
+bool GatherKernelRows::Validate(const Params& p, const optional_params& o) const {
+    if (!GatherKernelRef::Validate(p, o))
+        return false;
+
+    const gather_params& params = static_cast<const gather_params&>(p);
+    const auto& dictionary = params.inputs[0];
+    const auto& indices = params.inputs[1];
+    const auto& output = params.output;
+
+    if (!IsDense(dictionary) || !IsDense(indices) || !IsDense(output) || !indices.SimpleLayout())
+        return false;
+
+    // blocked batches are contiguous as well if no feature padding is needed
+    if (!dictionary.SimpleLayout() || !output.SimpleLayout()) {
+        if (dictionary.GetLayout() != output.GetLayout() || GetGatherChannelIndex(params) != 0 ||
+            !params.fused_ops.empty() || dictionary.Feature().v % 16 != 0 ||
+            dictionary.Feature().v != output.Feature().v || dictionary.Z().v != output.Z().v ||
+            dictionary.Y().v != output.Y().v || dictionary.X().v != output.X().v)
+            return false;
+    }
+
+    // block writes need aligned rows
+    const auto rows = GetGatherRows(params);
+    if (rows.row % sub_group_size != 0 || output.LogicalSize() != rows.outer * rows.indices * rows.row)
+        return false;
+
+    return true;
+}
+
+CommonDispatchData GatherKernelRows::SetDefault(const gather_params& params, const optional_params&) const {
+    CommonDispatchData dispatchData;
+    const auto rows = GetGatherRows(params);
+
+    dispatchData.gws = { rows.row / GetVectorSize(params), rows.indices, rows.outer };
+    dispatchData.lws = { sub_group_size, 1, 1 };
+    for (size_t lws : {128, 64, 32}) {
+        if (dispatchData.gws[0] % lws == 0 && lws <= params.engineInfo.maxWorkGroupSize) {
+            dispatchData.lws[0] = lws;
+            break;
+        }
+    }
+
+    return dispatchData;
+}
+
+JitConstants GatherKernelRows::GetJitConstants(const gather_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+    const auto rows = GetGatherRows(params);
+
+    jit.AddConstant(MakeJitConstant("SUB_GROUP_SIZE", sub_group_size));
+    jit.AddConstant(MakeJitConstant("VEC_SIZE", GetVectorSize(params)));
+    jit.AddConstant(MakeJitConstant("AXIS_SIZE", rows.axis));
+    jit.AddConstant(MakeJitConstant("ROW_SIZE", rows.row));
+    jit.AddConstant(MakeJitConstant("INDICES_COUNT", rows.indices));
+
+    if (!params.fused_ops.empty()) {
+        std::vector<std::string> idx_order;
+        switch (params.output.Dimentions()) {
+            case 6: idx_order = {"b", "f", "w", "z", "y", "x"}; break;
+            case 5: idx_order = {"b", "f", "z", "y", "x"}; break;
+            default: idx_order = {"b", "f", "y", "x"}; break;
+        }
+
+        FusedOpsConfiguration conf = { "", idx_order, "val", params.inputs[0].GetDType() };
+        jit.Merge(MakeFusedOpsJitConstants(params, {conf}));
+    }
+
+    return jit;
+}
+
+KernelsData GatherKernelRows::GetKernelsData(const Params& params, const optional_params& options) const {
+    return GetCommonKernelsData(params, options, FORCE_PRIORITY_3);
+}
+}  // namespace kernel_selector
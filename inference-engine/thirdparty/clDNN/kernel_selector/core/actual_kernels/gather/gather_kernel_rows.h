@@ -0,0 +1,41 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "gather_kernel_ref.h"
+#include <vector>
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// GatherKernelRows
+// Gathers which copy whole contiguous rows of the dictionary (embedding lookups and alike): every sub-group
+// copies a part of a row with block reads and writes.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class GatherKernelRows : public GatherKernelRef {
+public:
+    GatherKernelRows() : GatherKernelRef("gather_rows") {}
+    virtual ~GatherKernelRows() {}
+
+    JitConstants GetJitConstants(const gather_params& params) const override;
+    CommonDispatchData SetDefault(const gather_params& params, const optional_params&) const override;
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+};
+}  // namespace kernel_selector
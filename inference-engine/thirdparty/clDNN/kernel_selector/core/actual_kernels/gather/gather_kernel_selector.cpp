@@ -16,10 +16,14 @@
 
 #include "gather_kernel_selector.h"
 #include "gather_kernel_ref.h"
+#include "gather_kernel_rows.h"
 
 namespace kernel_selector {
 
-gather_kernel_selector::gather_kernel_selector() { Attach<GatherKernelRef>(); }
+gather_kernel_selector::gather_kernel_selector() {
+    Attach<GatherKernelRef>();
+    Attach<GatherKernelRows>();
+}
 
 KernelsData gather_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::GATHER);
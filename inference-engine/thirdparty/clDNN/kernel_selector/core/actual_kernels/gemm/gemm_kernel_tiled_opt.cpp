@@ -175,21 +175,13 @@ JitConstants GemmKernelTiledOpt::GetJitConstants(const gemm_params& params) cons
 }
 
 KernelsData GemmKernelTiledOpt::GetKernelsData(const Params& params, const optional_params& options) const {
-    const auto& gmm_params = static_cast<const gemm_params&>(params);
-
-    return GetCommonKernelsData(params, options, gmm_params.transpose_input0 || gmm_params.transpose_input1 ? FORCE_PRIORITY_6 : FORCE_PRIORITY_3);
+    return GetCommonKernelsData(params, options, FORCE_PRIORITY_3);
 }
 
 bool GemmKernelTiledOpt::Validate(const Params& params, const optional_params& options) const {
     if (!Parent::Validate(params, options))
         return false;
 
-    const auto& gmm_params = static_cast<const gemm_params&>(params);
-    bool gemm_leftovers = gmm_params.inputs[0].X().v % 16 || gmm_params.inputs[0].Y().v % 16 ||
-                          gmm_params.inputs[1].X().v % 16 || gmm_params.inputs[1].Y().v % 16;
-    if ((gmm_params.transpose_input0 || gmm_params.transpose_input1) && gemm_leftovers)
-        return false;
-
     return true;
 }
 }  // namespace kernel_selector
@@ -40,6 +40,7 @@ ParamsKey MVNKernelBfyxOpt::GetSupportedKey() const {
     k.EnableMVNMode(MVNMode::WITHIN_CHANNELS);
     k.EnableMVNMode(MVNMode::ACROSS_CHANNELS);
     k.EnableMVNNormalizeVariance();
+    k.EnableSubGroup();
     return k;
 }
 
@@ -0,0 +1,111 @@
+/*
+// Copyright (c) 2016-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "permute_kernel_base.h"
+#include "kernel_selector_utils.h"
+#include <string>
+#include <vector>
+
+namespace kernel_selector {
+
+std::vector<std::string> PermuteKernelBase::GetDimNames(const permute_params& params) {
+    switch (DataTensor::ChannelsCount(params.inputs[0].GetLayout())) {
+        case 6: return {"b", "f", "x", "y", "z", "w" };
+        case 5: return {"b", "f", "x", "y", "z" };
+        default: return {"b", "f", "x", "y" };
+    }
+}
+
+bool PermuteKernelBase::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::PERMUTE || o.GetType() != KernelType::PERMUTE) {
+        return false;
+    }
+
+    const permute_params& params = static_cast<const permute_params&>(p);
+    for (auto& fused_op : params.fused_ops) {
+        if (!IsFusedPrimitiveSupported(fused_op))
+            return false;
+    }
+
+    return true;
+}
+
+JitConstants PermuteKernelBase::GetJitConstants(const permute_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+
+    std::vector<std::string> in_idx = GetDimNames(params);
+    std::vector<std::string> out_idx;
+
+    assert(params.order.size() == in_idx.size());
+    for (auto& o : params.order) {
+        out_idx.push_back(in_idx[o]);
+    }
+
+    std::string input_order = in_idx[0] + "," + in_idx[1];
+    std::string output_order = out_idx[0] + "," + out_idx[1];
+
+    for (size_t i = in_idx.size() - 1; i > 1; i--) {
+        input_order += "," + in_idx[i];
+        output_order += "," + out_idx[i];
+    }
+
+    jit.AddConstant(MakeJitConstant("IN_IDX", "INPUT0_GET_INDEX(" + input_order + ")"));
+    jit.AddConstant(MakeJitConstant("OUT_IDX", "OUTPUT_GET_INDEX(" + output_order + ")"));
+
+    if (!params.fused_ops.empty()) {
+        if (out_idx.size() == 4)
+            std::swap(out_idx[2], out_idx[3]);
+        else if (out_idx.size() == 5)
+            std::swap(out_idx[2], out_idx[4]);
+        else if (out_idx.size() == 6) {
+            std::swap(out_idx[2], out_idx[5]);
+            std::swap(out_idx[3], out_idx[4]);
+        }
+
+        FusedOpsConfiguration conf = {"", out_idx, "input_var", params.inputs[0].GetDType(), 1};
+        jit.Merge(MakeFusedOpsJitConstants(params, {conf}));
+    }
+
+    return jit;
+}
+
+KernelsData PermuteKernelBase::GetCommonKernelsData(const Params& params,
+                                                    const optional_params& options,
+                                                    float estimatedTime) const {
+    assert(params.GetType() == KernelType::PERMUTE);
+
+    if (!Validate(params, options)) {
+        return {};
+    }
+
+    KernelData kd = KernelData::Default<permute_params>(params);
+    permute_params& newParams = *static_cast<permute_params*>(kd.params.get());
+
+    auto dispatchData = SetDefault(newParams);
+    auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
+    auto cldnn_jit = GetJitConstants(newParams);
+    std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+    auto& kernel = kd.kernels[0];
+
+    FillCLKernelData(kernel, dispatchData, params.engineInfo, kernelName, jit, entry_point,
+                     DEFAULT, false, false, 1, GetFusedPrimitiveInputsCount(params));
+
+    kd.estimatedTime = estimatedTime;
+
+    return {kd};
+}
+}  // namespace kernel_selector
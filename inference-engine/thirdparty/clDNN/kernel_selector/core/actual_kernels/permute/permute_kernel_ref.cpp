@@ -41,70 +41,17 @@ ParamsKey PermuteKernelRef::GetSupportedKey() const {
     return k;
 }
 
-JitConstants PermuteKernelRef::GetJitConstants(const permute_params& params) const {
-    JitConstants jit = MakeBaseParamsJitConstants(params);
+CommonDispatchData PermuteKernelRef::SetDefault(const permute_params& params) const {
+    CommonDispatchData dispatchData;
+    const auto& in = params.inputs[0];
 
-    std::vector<std::string> in_idx;
-    std::vector<std::string> out_idx;
-    switch (DataTensor::ChannelsCount(params.inputs[0].GetLayout())) {
-        case 6: in_idx = {"b", "f", "x", "y", "z", "w" }; break;
-        case 5: in_idx = {"b", "f", "x", "y", "z" }; break;
-        default: in_idx = {"b", "f", "x", "y" }; break;
-    }
+    dispatchData.gws = {in.X().v, in.Y().v * in.Z().v * in.W().v, in.Feature().v * in.Batch().v};
+    dispatchData.lws = GetOptimalLocalWorkGroupSizes(dispatchData.gws, params.engineInfo);
 
-    assert(params.order.size() == in_idx.size());
-    for (auto& o : params.order) {
-        out_idx.push_back(in_idx[o]);
-    }
-
-    std::string input_order = in_idx[0] + "," + in_idx[1];
-    std::string output_order = out_idx[0] + "," + out_idx[1];
-
-    for (size_t i = in_idx.size() - 1; i > 1; i--) {
-        input_order += "," + in_idx[i];
-        output_order += "," + out_idx[i];
-    }
-
-    jit.AddConstant(MakeJitConstant("IN_IDX", "INPUT0_GET_INDEX(" + input_order + ")"));
-    jit.AddConstant(MakeJitConstant("OUT_IDX", "OUTPUT_GET_INDEX(" + output_order + ")"));
-
-    if (!params.fused_ops.empty()) {
-        if (out_idx.size() == 4)
-            std::swap(out_idx[2], out_idx[3]);
-        else if (out_idx.size() == 5)
-            std::swap(out_idx[2], out_idx[4]);
-        else if (out_idx.size() == 6) {
-            std::swap(out_idx[2], out_idx[5]);
-            std::swap(out_idx[3], out_idx[4]);
-        }
-
-        FusedOpsConfiguration conf = {"", out_idx, "input_var", params.inputs[0].GetDType(), 1};
-        jit.Merge(MakeFusedOpsJitConstants(params, {conf}));
-    }
-
-    return jit;
+    return dispatchData;
 }
 
 KernelsData PermuteKernelRef::GetKernelsData(const Params& params, const optional_params& options) const {
-    assert(params.GetType() == KernelType::PERMUTE);
-
-    KernelData kd = KernelData::Default<permute_params>(params);
-    permute_params& newParams = *static_cast<permute_params*>(kd.params.get());
-
-    auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
-    auto cldnn_jit = GetJitConstants(newParams);
-    std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
-
-    const auto& in = newParams.inputs[0];
-    auto& kernel = kd.kernels[0];
-
-    kernel.workGroups.global = {in.X().v, in.Y().v * in.Z().v * in.W().v, in.Feature().v * in.Batch().v};
-    kernel.workGroups.local = GetOptimalLocalWorkGroupSizes(kernel.workGroups.global, params.engineInfo);
-    kernel.kernelString = GetKernelString(kernelName, jit, entry_point, params.engineInfo, DEFAULT);
-    kernel.arguments = GetArgsDesc(1, false, false, GetFusedPrimitiveInputsCount(params));
-
-    kd.estimatedTime = DONT_USE_IF_HAVE_SOMETHING_ELSE;
-
-    return {kd};
+    return GetCommonKernelsData(params, options, DONT_USE_IF_HAVE_SOMETHING_ELSE);
 }
 }  // namespace kernel_selector
@@ -15,38 +15,21 @@
 
 #pragma once
 
-#include "kernel_base_opencl.h"
-#include <vector>
+#include "permute_kernel_base.h"
 
 namespace kernel_selector {
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// permute_params
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-struct permute_params : public base_params {
-    permute_params() : base_params(KernelType::PERMUTE) {}
-
-    std::vector<uint16_t> order;
-
-    virtual ParamsKey GetParamsKey() const { return base_params::GetParamsKey(); }
-};
-
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// permute_optional_params
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-struct permute_optional_params : optional_params {
-    permute_optional_params() : optional_params(KernelType::PERMUTE) {}
-};
-
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // PermuteKernelRef
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-class PermuteKernelRef : public KernelBaseOpenCL {
+class PermuteKernelRef : public PermuteKernelBase {
 public:
-    PermuteKernelRef() : KernelBaseOpenCL("permute_ref") {}
+    PermuteKernelRef() : PermuteKernelBase("permute_ref") {}
     virtual ~PermuteKernelRef() {}
 
-    JitConstants GetJitConstants(const permute_params& params) const;
     KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
     ParamsKey GetSupportedKey() const override;
+
+protected:
+    CommonDispatchData SetDefault(const permute_params& params) const override;
 };
 }  // namespace kernel_selector
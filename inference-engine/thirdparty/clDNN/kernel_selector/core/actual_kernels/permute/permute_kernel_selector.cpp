@@ -15,10 +15,14 @@
 
 #include "permute_kernel_selector.h"
 #include "permute_kernel_ref.h"
+#include "permute_kernel_tile_slm.h"
 
 namespace kernel_selector {
 
-permute_kernel_selector::permute_kernel_selector() { Attach<PermuteKernelRef>(); }
+permute_kernel_selector::permute_kernel_selector() {
+    Attach<PermuteKernelRef>();
+    Attach<PermuteKernelTileSLM>();
+}
 
 KernelsData permute_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
     return GetNaiveBestKernel(params, options, KernelType::PERMUTE);
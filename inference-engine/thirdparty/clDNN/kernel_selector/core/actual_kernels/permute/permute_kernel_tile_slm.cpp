@@ -0,0 +1,201 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "permute_kernel_tile_slm.h"
+#include "kernel_selector_utils.h"
+#include <string>
+#include <vector>
+
+namespace kernel_selector {
+
+namespace {
+constexpr size_t max_tile_size = 16;
+constexpr size_t min_tile_size = 8;
+
+// index of the dimension (in permute order notation: b, f, x, y, z, w) which is contiguous in memory
+size_t GetInnermostDim(const DataTensor& tensor) {
+    switch (tensor.GetLayout()) {
+        case DataLayout::b_fs_yx_fsv16:
+        case DataLayout::b_fs_zyx_fsv16:
+        case DataLayout::b_fs_yx_fsv32:
+        case DataLayout::b_fs_zyx_fsv32:
+            return 1;
+        default:
+            return 2;
+    }
+}
+
+size_t GetDimSize(const DataTensor& tensor, size_t dim) {
+    switch (dim) {
+        case 0: return tensor.Batch().v;
+        case 1: return tensor.Feature().v;
+        case 2: return tensor.X().v;
+        case 3: return tensor.Y().v;
+        case 4: return tensor.Z().v;
+        default: return tensor.W().v;
+    }
+}
+
+std::string GetDimSizeName(size_t dim) {
+    switch (dim) {
+        case 0: return "INPUT0_BATCH_NUM";
+        case 1: return "INPUT0_FEATURE_NUM";
+        case 2: return "INPUT0_SIZE_X";
+        case 3: return "INPUT0_SIZE_Y";
+        case 4: return "INPUT0_SIZE_Z";
+        default: return "INPUT0_SIZE_W";
+    }
+}
+
+// input dimension which is read contiguously
+size_t GetReadDim(const permute_params& params) {
+    return GetInnermostDim(params.inputs[0]);
+}
+
+// input dimension which becomes the contiguous dimension of the output
+size_t GetWriteDim(const permute_params& params) {
+    return params.order[GetInnermostDim(params.output)];
+}
+
+// dimensions which are not tiled, from the inner ones to the outer ones
+std::vector<size_t> GetOtherDims(const permute_params& params) {
+    std::vector<size_t> other_dims;
+    for (size_t dim : {2, 3, 4, 5, 1, 0}) {
+        if (dim < params.order.size() && dim != GetReadDim(params) && dim != GetWriteDim(params))
+            other_dims.push_back(dim);
+    }
+    return other_dims;
+}
+
+size_t GetTileSize(const permute_params& params) {
+    const auto& in = params.inputs[0];
+    if (GetDimSize(in, GetReadDim(params)) >= max_tile_size && GetDimSize(in, GetWriteDim(params)) >= max_tile_size)
+        return max_tile_size;
+    return min_tile_size;
+}
+}  // namespace
+
+ParamsKey PermuteKernelTileSLM::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableInputDataType(Datatype::INT8);
+    k.EnableInputDataType(Datatype::UINT8);
+    k.EnableInputDataType(Datatype::INT32);
+    k.EnableInputDataType(Datatype::INT64);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::INT8);
+    k.EnableOutputDataType(Datatype::UINT8);
+    k.EnableOutputDataType(Datatype::INT32);
+    k.EnableOutputDataType(Datatype::INT64);
+    k.EnableDifferentTypes();
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableInputLayout(DataLayout::bfzyx);
+    k.EnableOutputLayout(DataLayout::bfzyx);
+    k.EnableInputLayout(DataLayout::bfwzyx);
+    k.EnableOutputLayout(DataLayout::bfwzyx);
+    k.EnableInputLayout(DataLayout::b_fs_yx_fsv16);
+    k.EnableOutputLayout(DataLayout::b_fs_yx_fsv16);
+    k.EnableInputLayout(DataLayout::b_fs_zyx_fsv16);
+    k.EnableOutputLayout(DataLayout::b_fs_zyx_fsv16);
+    k.EnableInputLayout(DataLayout::b_fs_yx_fsv32);
+    k.EnableOutputLayout(DataLayout::b_fs_yx_fsv32);
+    k.EnableInputLayout(DataLayout::b_fs_zyx_fsv32);
+    k.EnableOutputLayout(DataLayout::b_fs_zyx_fsv32);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    return k;
+}
+
+bool PermuteKernelTileSLM::Validate(const Params& p, const optional_params& o) const {
+    if (!PermuteKernelBase::Validate(p, o))
+        return false;
+
+    const permute_params& params = static_cast<const permute_params&>(p);
+    if (params.inputs[0].GetLayout() != params.output.GetLayout())
+        return false;
+
+    // permutes keeping the contiguous dimension in place are already coalesced in the reference kernel
+    if (GetReadDim(params) == GetWriteDim(params))
+        return false;
+
+    return true;
+}
+
+JitConstants PermuteKernelTileSLM::GetJitConstants(const permute_params& params) const {
+    JitConstants jit = PermuteKernelBase::GetJitConstants(params);
+
+    const std::vector<std::string> dim_names = GetDimNames(params);
+    const size_t read_dim = GetReadDim(params);
+    const size_t write_dim = GetWriteDim(params);
+
+    jit.AddConstant(MakeJitConstant("TILE_SIZE", GetTileSize(params)));
+    jit.AddConstant(MakeJitConstant("READ_DIM", dim_names[read_dim]));
+    jit.AddConstant(MakeJitConstant("READ_DIM_SIZE", GetDimSizeName(read_dim)));
+    jit.AddConstant(MakeJitConstant("WRITE_DIM", dim_names[write_dim]));
+    jit.AddConstant(MakeJitConstant("WRITE_DIM_SIZE", GetDimSizeName(write_dim)));
+
+    // all the other dimensions are enumerated by the third gws dimension, from the inner ones to the outer ones
+    const std::vector<size_t> other_dims = GetOtherDims(params);
+    std::string declare_other_dims = "uint other_dims = (uint)get_global_id(2);";
+    for (size_t i = 0; i + 1 < other_dims.size(); i++) {
+        declare_other_dims += " const uint " + dim_names[other_dims[i]] + " = other_dims % " +
+                              GetDimSizeName(other_dims[i]) + ";";
+        declare_other_dims += " other_dims /= " + GetDimSizeName(other_dims[i]) + ";";
+    }
+    declare_other_dims += " const uint " + dim_names[other_dims.back()] + " = other_dims;";
+
+    jit.AddConstant(MakeJitConstant("DECLARE_OTHER_DIMS", declare_other_dims));
+
+    return jit;
+}
+
+CommonDispatchData PermuteKernelTileSLM::SetDefault(const permute_params& params) const {
+    CommonDispatchData dispatchData;
+    const auto& in = params.inputs[0];
+    const size_t tile_size = GetTileSize(params);
+    const size_t read_dim = GetReadDim(params);
+    const size_t write_dim = GetWriteDim(params);
+
+    size_t other_dims = 1;
+    for (auto dim : GetOtherDims(params))
+        other_dims *= GetDimSize(in, dim);
+
+    dispatchData.gws = { Align(GetDimSize(in, read_dim), tile_size),
+                         CeilDiv(GetDimSize(in, write_dim), tile_size),
+                         other_dims };
+    dispatchData.lws = { tile_size, 1, 1 };
+
+    return dispatchData;
+}
+
+KernelsData PermuteKernelTileSLM::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options))
+        return {};
+
+    const permute_params& newParams = static_cast<const permute_params&>(params);
+    const auto& in = newParams.inputs[0];
+
+    // small tiles waste most of the work group, leave them to the reference kernel
+    const bool big_enough = GetDimSize(in, GetReadDim(newParams)) >= min_tile_size &&
+                            GetDimSize(in, GetWriteDim(newParams)) >= min_tile_size;
+
+    return GetCommonKernelsData(params, options, big_enough ? FORCE_PRIORITY_3 : DONT_USE_IF_HAVE_SOMETHING_ELSE);
+}
+}  // namespace kernel_selector
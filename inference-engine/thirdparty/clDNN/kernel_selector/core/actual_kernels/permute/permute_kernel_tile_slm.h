@@ -0,0 +1,40 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "permute_kernel_base.h"
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PermuteKernelTileSLM
+// Permutes which move the innermost dimension of the memory layout (0213, 0231, 0312 and alike) are done as
+// tile transposes through local memory, so both reads and writes go along the contiguous dimension.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class PermuteKernelTileSLM : public PermuteKernelBase {
+public:
+    PermuteKernelTileSLM() : PermuteKernelBase("permute_tile_slm") {}
+    virtual ~PermuteKernelTileSLM() {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+    JitConstants GetJitConstants(const permute_params& params) const override;
+    CommonDispatchData SetDefault(const permute_params& params) const override;
+};
+}  // namespace kernel_selector
@@ -80,6 +80,7 @@ PoolingKernelBase::DispatchData PoolingKernel_b_fs_yx_fsv16::SetDefault(const po
     dispatchData.lws[0] = 1;
     dispatchData.lws[1] = alignment;
     dispatchData.lws[2] = 1;
+    dispatchData.batch_dim = 2;
 
     dispatchData.efficiency = FORCE_PRIORITY_2;
 
@@ -0,0 +1,156 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "reduce_kernel_bfyx_opt.h"
+#include "kernel_selector_utils.h"
+#include <algorithm>
+#include <vector>
+#include <string>
+#include "common_tools.h"
+
+namespace kernel_selector {
+
+static const size_t SIMD = 16;
+static const size_t MAX_LWS = 256;
+// Smaller reductions are left to the reference kernel with one work item per output element
+static const size_t MIN_REDUCE_SIZE = 2 * SIMD;
+
+static size_t calc_reduce_size(const reduce_params& params) {
+    const auto& input = params.inputs[0];
+    size_t reduce_size = 1;
+    for (auto axis : params.reduceAxes) {
+        switch (axis) {
+            case 0: reduce_size *= input.Batch().v; break;
+            case 1: reduce_size *= input.Feature().v; break;
+            case 2: reduce_size *= input.X().v; break;
+            case 3: reduce_size *= input.Y().v; break;
+            case 4: reduce_size *= input.Z().v; break;
+            case 5: reduce_size *= input.W().v; break;
+        }
+    }
+    return reduce_size;
+}
+
+// All modes accumulate in 32-bit types, so sub-group reductions are available for every input type
+static Datatype calc_accumulator_type(const reduce_params& params) {
+    switch (params.inputs[0].GetDType()) {
+        case Datatype::F16:
+        case Datatype::F32:
+            return Datatype::F32;
+        default:
+            return Datatype::INT32;
+    }
+}
+
+static size_t calc_lws(const reduce_params& params) {
+    auto max_lws = std::min(MAX_LWS, static_cast<size_t>(params.engineInfo.maxWorkGroupSize));
+    max_lws = std::max(SIMD, max_lws - max_lws % SIMD);
+    return std::min(max_lws, Align(calc_reduce_size(params), SIMD));
+}
+
+ParamsKey ReduceKernelBfyxOpt::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+    k.EnableInputDataType(Datatype::INT32);
+    k.EnableInputDataType(Datatype::INT8);
+    k.EnableInputDataType(Datatype::UINT8);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableOutputDataType(Datatype::INT32);
+    k.EnableOutputDataType(Datatype::INT8);
+    k.EnableOutputDataType(Datatype::UINT8);
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableInputLayout(DataLayout::bfzyx);
+    k.EnableOutputLayout(DataLayout::bfzyx);
+    k.EnableInputLayout(DataLayout::bfwzyx);
+    k.EnableOutputLayout(DataLayout::bfwzyx);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    k.EnableDifferentTypes();
+    k.EnableSubGroup();
+    return k;
+}
+
+bool ReduceKernelBfyxOpt::Validate(const Params& p, const optional_params& o) const {
+    if (!ReduceKernelBase::Validate(p, o))
+        return false;
+
+    const auto& params = static_cast<const reduce_params&>(p);
+    if (calc_reduce_size(params) < MIN_REDUCE_SIZE)
+        return false;
+
+    return true;
+}
+
+CommonDispatchData ReduceKernelBfyxOpt::SetDefault(const reduce_params& params, const optional_params&) const {
+    CommonDispatchData dispatchData;
+
+    const size_t lws = calc_lws(params);
+
+    dispatchData.gws = { lws, params.output.LogicalSize(), 1 };
+    dispatchData.lws = { lws, 1, 1 };
+
+    return dispatchData;
+}
+
+JitConstants ReduceKernelBfyxOpt::GetJitConstants(const reduce_params& params) const {
+    auto jit = ReduceKernelBase::GetJitConstants(params);
+    const size_t lws = calc_lws(params);
+
+    const auto acc_dt = calc_accumulator_type(params);
+    const auto final_acc_dt = GetFinalAccumulatorType(params) == Datatype::F32 ? Datatype::F32 : acc_dt;
+
+    jit.AddConstant(MakeJitConstant("SIMD", SIMD));
+    jit.AddConstant(MakeJitConstant("LWS", lws));
+    jit.AddConstant(MakeJitConstant("SUB_GROUPS_COUNT", lws / SIMD));
+    jit.AddConstant(MakeJitConstant("REDUCE_SIZE", calc_reduce_size(params)));
+    jit.Merge(MakeTypeJitConstants(GetActivationType(params), "ACTIVATION"));
+    jit.Merge(MakeTypeJitConstants(acc_dt, "ACCUMULATOR"));
+    jit.Merge(MakeTypeJitConstants(final_acc_dt, "FINAL_ACCUMULATOR"));
+
+    if (!params.fused_ops.empty()) {
+        auto input_dt = GetActivationType(params);
+
+        std::vector<std::string> idx_order;
+        switch (DataTensor::ChannelsCount(params.inputs[0].GetLayout())) {
+            case 6: idx_order = {"b", "f", "w", "z", "y", "x" }; break;
+            case 5: idx_order = {"b", "f", "z", "y", "x" }; break;
+            default: idx_order = {"b", "f", "y", "x" }; break;
+        }
+
+        FusedOpsConfiguration conf = {"",
+                                      idx_order,
+                                      "reduce_result",
+                                      input_dt,
+                                      1,
+                                      LoadType::LT_UNALIGNED,
+                                      BoundaryCheck::DISABLED,
+                                      IndexType::TENSOR_COORD,
+                                      Tensor::DataChannelName::X};
+
+        jit.Merge(MakeFusedOpsJitConstants(params, {conf}));
+    }
+
+    return jit;
+}
+
+KernelsData ReduceKernelBfyxOpt::GetKernelsData(const Params& params, const optional_params& options) const {
+    return GetCommonKernelsData(params, options, FORCE_PRIORITY_6);
+}
+}  // namespace kernel_selector
@@ -0,0 +1,43 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "reduce_kernel_base.h"
+#include <vector>
+
+namespace kernel_selector {
+// Reduces every output element with a whole work group: work items accumulate strided parts of the
+// reduced volume, then partial results are combined with sub-group reductions and local memory.
+class ReduceKernelBfyxOpt : public ReduceKernelBase {
+public:
+    ReduceKernelBfyxOpt() : ReduceKernelBase("reduce_gpu_bfyx_opt") {}
+    virtual ~ReduceKernelBfyxOpt() {}
+    CommonDispatchData SetDefault(const reduce_params& params, const optional_params&) const override;
+    JitConstants GetJitConstants(const reduce_params& params) const override;
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+    std::vector<FusedOpType> GetSupportedFusedOps() const override {
+        return { FusedOpType::QUANTIZE,
+                 FusedOpType::SCALE,
+                 FusedOpType::ELTWISE,
+                 FusedOpType::ACTIVATION };
+    }
+
+protected:
+    bool Validate(const Params&, const optional_params&) const override;
+};
+}  // namespace kernel_selector
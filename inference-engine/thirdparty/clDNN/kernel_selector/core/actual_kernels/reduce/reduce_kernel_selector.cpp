@@ -17,12 +17,14 @@
 #include "reduce_kernel_selector.h"
 #include "reduce_kernel_ref.h"
 #include "reduce_kernel_b_fs_yx_fsv16.h"
+#include "reduce_kernel_bfyx_opt.h"
 
 namespace kernel_selector {
 
 reduce_kernel_selector::reduce_kernel_selector() {
     Attach<ReduceKernelRef>();
     Attach<ReduceKernel_b_fs_yx_fsv16>();
+    Attach<ReduceKernelBfyxOpt>();
 }
 
 KernelsData reduce_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
@@ -32,6 +32,18 @@ ParamsKey reorder_biplanar_nv12::GetSupportedKey() const {
     return k;
 }
 
+bool reorder_biplanar_nv12::Validate(const Params& p, const optional_params& o) const {
+    if (!ReorderKernelBase::Validate(p, o)) {
+        return false;
+    }
+
+    // resizing conversion is handled by reorder_biplanar_nv12_resize
+    const reorder_params& params = static_cast<const reorder_params&>(p);
+    const auto& input = params.inputs[0];
+    const auto& output = params.output;
+    return input.X().v == output.X().v && input.Y().v == output.Y().v;
+}
+
 JitConstants reorder_biplanar_nv12::GetJitConstants(const reorder_params& params) const {
     auto jit = ReorderKernelBase::GetJitConstants(params);
     jit.Merge(GetTensorFriendlyWorkGroupsJit(params.inputs[0]));
@@ -44,6 +56,9 @@ KernelsData reorder_biplanar_nv12::GetKernelsData(const Params& params, const op
         return {};
     }
     KernelsData kd = GetCommonKernelsData(orgParams, options, FORCE_PRIORITY_9);
+    if (kd.empty()) {
+        return kd;
+    }
     kd[0].kernels[0].arguments = GetArgsDesc(2, false, false);
     return kd;
 }
@@ -25,5 +25,8 @@ public:
     KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
     ParamsKey GetSupportedKey() const override;
     JitConstants GetJitConstants(const reorder_params& params) const override;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
 };
 }  // namespace kernel_selector
@@ -0,0 +1,88 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "reorder_biplanar_nv12_resize.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+ParamsKey reorder_biplanar_nv12_resize::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::UINT8);
+    k.EnableInputDataType(Datatype::INT8);
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+    k.EnableDifferentTypes();
+    k.EnableInputLayout(DataLayout::nv12);
+    k.EnableOutputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::byxf);
+    k.EnableOutputLayout(DataLayout::yxfb);
+    k.EnableOutputLayout(DataLayout::b_fs_yx_fsv4);
+    k.EnableOutputLayout(DataLayout::b_fs_yx_fsv16);
+    k.EnableOutputLayout(DataLayout::fs_b_yx_fsv32);
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    return k;
+}
+
+bool reorder_biplanar_nv12_resize::Validate(const Params& p, const optional_params& o) const {
+    if (!ReorderKernelBase::Validate(p, o)) {
+        return false;
+    }
+
+    const reorder_params& params = static_cast<const reorder_params&>(p);
+    if (params.inputs.size() != 2) {
+        return false;
+    }
+
+    // the same size is handled by reorder_biplanar_nv12
+    const auto& input = params.inputs[0];
+    const auto& output = params.output;
+    return input.X().v != output.X().v || input.Y().v != output.Y().v;
+}
+
+JitConstants reorder_biplanar_nv12_resize::GetJitConstants(const reorder_params& params) const {
+    auto jit = ReorderKernelBase::GetJitConstants(params);
+    const auto& input = params.inputs[0];
+    const auto& output = params.output;
+    jit.AddConstant(MakeJitConstant("SCALE_X", static_cast<float>(input.X().v) / static_cast<float>(output.X().v)));
+    jit.AddConstant(MakeJitConstant("SCALE_Y", static_cast<float>(input.Y().v) / static_cast<float>(output.Y().v)));
+    return jit;
+}
+
+ReorderKernelBase::DispatchData reorder_biplanar_nv12_resize::SetDefault(const reorder_params& params) const {
+    DispatchData dispatchData;
+
+    const auto& output = params.output;
+    dispatchData.gws = { output.X().v, output.Y().v, output.Batch().v };
+    dispatchData.lws = GetOptimalLocalWorkGroupSizes(dispatchData.gws, params.engineInfo);
+
+    return dispatchData;
+}
+
+KernelsData reorder_biplanar_nv12_resize::GetKernelsData(const Params& params, const optional_params& options) const {
+    const reorder_params& orgParams = static_cast<const reorder_params&>(params);
+    KernelsData kd = GetCommonKernelsData(orgParams, options, FORCE_PRIORITY_9);
+    if (kd.empty()) {
+        return kd;
+    }
+
+    kd[0].kernels[0].arguments = GetArgsDesc(2, false, false);
+    if (orgParams.mode == MeanSubtractMode::IN_BUFFER) {
+        kd[0].kernels[0].arguments.push_back({ArgumentDescriptor::Types::BIAS, 0});
+    }
+    return kd;
+}
+}  // namespace kernel_selector
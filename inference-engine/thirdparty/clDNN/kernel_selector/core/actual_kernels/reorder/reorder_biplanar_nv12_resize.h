@@ -0,0 +1,34 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "reorder_kernel_base.h"
+
+namespace kernel_selector {
+// Converts Y and UV planes to BGR and bilinearly resizes the image to the output spatial size in a single pass.
+class reorder_biplanar_nv12_resize : public ReorderKernelBase {
+public:
+    reorder_biplanar_nv12_resize() : ReorderKernelBase("reorder_biplanar_nv12_resize") {}
+    virtual ~reorder_biplanar_nv12_resize() {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+    JitConstants GetJitConstants(const reorder_params& params) const override;
+    DispatchData SetDefault(const reorder_params& params) const override;
+};
+}  // namespace kernel_selector
@@ -21,6 +21,7 @@
 #include "reorder_kernel_to_yxfb_batched.h"
 #include "reorder_kernel_binary.h"
 #include "reorder_biplanar_nv12.h"
+#include "reorder_biplanar_nv12_resize.h"
 #include "reorder_kernel_fs_b_yx_fsv32_to_bfyx.h"
 
 namespace kernel_selector {
@@ -33,6 +34,7 @@ reorder_kernel_selector::reorder_kernel_selector() {
     Attach<ReorderToWinograd2x3Kernel>();
     Attach<ReorderKernel_to_yxfb_batched>();
     Attach<reorder_biplanar_nv12>();
+    Attach<reorder_biplanar_nv12_resize>();
     Attach<ReorderKernel_fs_b_yx_fsv32_to_bfyx>();
 }
 
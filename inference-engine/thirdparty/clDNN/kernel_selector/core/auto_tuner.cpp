@@ -14,6 +14,7 @@
 
 
 #include "auto_tuner.h"
+#include <cstdio>
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -185,20 +186,14 @@ void TuningCache::StoreKernel(const Params& params, uint32_t computeUnitsCount,
     auto paramStr = params.to_cache_string_v2();
     auto computeUnitsStr = std::to_string(computeUnitsCount);
     auto& v2Cache = cache[version2Marker];
+    auto& deviceCache = GetOrAddObject(GetOrAddObject(v2Cache, computeUnitsStr.c_str()), kTypeStr.c_str());
 
-    if (!v2Cache.HasMember(computeUnitsStr.c_str())) {
-        auto newName = rapidjson::Value(computeUnitsStr.c_str(), cache.GetAllocator());
-        auto newObj = rapidjson::Value(rapidjson::Type::kObjectType);
-        v2Cache.AddMember(newName, newObj, cache.GetAllocator());
-    }
-
-    if (!v2Cache[computeUnitsStr.c_str()].HasMember(kTypeStr.c_str())) {
-        auto newName = rapidjson::Value(kTypeStr.c_str(), cache.GetAllocator());
-        auto newObj = rapidjson::Value(rapidjson::Type::kObjectType);
-        v2Cache[computeUnitsStr.c_str()].AddMember(newName, newObj, cache.GetAllocator());
+    // Retuning replaces the existing entry
+    auto oldIt = deviceCache.FindMember(paramStr.c_str());
+    if (oldIt != deviceCache.MemberEnd()) {
+        deviceCache.RemoveMember(oldIt);
     }
-
-    auto& deviceCache = v2Cache[computeUnitsStr.c_str()][kTypeStr.c_str()];
+    removedEntries.erase(std::make_tuple(computeUnitsStr, kTypeStr, paramStr));
 
     auto paramName = rapidjson::Value(paramStr.c_str(), cache.GetAllocator());
     auto implDetails = rapidjson::Value(rapidjson::Type::kArrayType);
@@ -267,11 +262,66 @@ bool TuningCache::RemoveKernel_v2(const Params& params, uint32_t computeUnitsCou
         return false;
 
     kTypeIt->value.RemoveMember(paramIt);
+    removedEntries.insert(std::make_tuple(computeUnitsStr, kTypeStr, paramStr));
     return true;
 }
 
+rapidjson::Value& TuningCache::GetOrAddObject(rapidjson::Value& parent, const char* name) {
+    if (!parent.HasMember(name)) {
+        auto newName = rapidjson::Value(name, cache.GetAllocator());
+        auto newObj = rapidjson::Value(rapidjson::Type::kObjectType);
+        parent.AddMember(newName, newObj, cache.GetAllocator());
+    }
+    return parent[name];
+}
+
+void TuningCache::MergeEntries_v2(const rapidjson::Document& other) {
+    auto otherV2It = other.FindMember(version2Marker);
+    if (otherV2It == other.MemberEnd() || !otherV2It->value.IsObject())
+        return;
+
+    auto& v2Cache = cache[version2Marker];
+    for (auto& computeUnits : otherV2It->value.GetObject()) {
+        if (!computeUnits.value.IsObject())
+            continue;
+        for (auto& kType : computeUnits.value.GetObject()) {
+            if (!kType.value.IsObject())
+                continue;
+            for (auto& entry : kType.value.GetObject()) {
+                EntryKey key(computeUnits.name.GetString(), kType.name.GetString(), entry.name.GetString());
+                if (removedEntries.count(key))
+                    continue;
+
+                auto& deviceCache = GetOrAddObject(GetOrAddObject(v2Cache, computeUnits.name.GetString()),
+                                                   kType.name.GetString());
+                // Entries of this cache take precedence
+                if (deviceCache.HasMember(entry.name))
+                    continue;
+
+                auto newName = rapidjson::Value(entry.name, cache.GetAllocator());
+                auto newValue = rapidjson::Value(entry.value, cache.GetAllocator());
+                deviceCache.AddMember(newName, newValue, cache.GetAllocator());
+            }
+        }
+    }
+}
+
 void TuningCache::Save(const std::string& cacheFilePath) {
-    std::ofstream cachedKernelsFile(cacheFilePath);
+    {
+        std::ifstream onDiskFile(cacheFilePath);
+        if (onDiskFile && onDiskFile.good()) {
+            rapidjson::Document onDisk;
+            rapidjson::IStreamWrapper isw{ onDiskFile };
+            onDisk.ParseStream(isw);
+            if (!onDisk.HasParseError() && onDisk.IsObject()) {
+                MergeEntries_v2(onDisk);
+            }
+        }
+    }
+
+    // Write to a temporary file first, so readers never see a partially written cache
+    const std::string tempFilePath = cacheFilePath + ".tmp";
+    std::ofstream cachedKernelsFile(tempFilePath);
     rapidjson::StringBuffer buffer(0, 1024);
     rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
     writer.SetFormatOptions(rapidjson::PrettyFormatOptions::kFormatSingleLineArray);
@@ -279,6 +329,19 @@ void TuningCache::Save(const std::string& cacheFilePath) {
     auto temp = buffer.GetString();
     cachedKernelsFile << temp;
     cachedKernelsFile.close();
+    if (!cachedKernelsFile) {
+        std::remove(tempFilePath.c_str());
+        throw std::runtime_error("Tuning file: " + cacheFilePath + " could not be written!");
+    }
+
+    if (std::rename(tempFilePath.c_str(), cacheFilePath.c_str()) != 0) {
+        // rename doesn't replace existing files on some platforms
+        std::remove(cacheFilePath.c_str());
+        if (std::rename(tempFilePath.c_str(), cacheFilePath.c_str()) != 0) {
+            std::remove(tempFilePath.c_str());
+            throw std::runtime_error("Tuning file: " + cacheFilePath + " could not be written!");
+        }
+    }
 
     needsSave = false;
 }
@@ -18,6 +18,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <set>
 #include <string>
 #include "kernel_selector_common.h"
 #include "kernel_selector_params.h"
@@ -54,6 +55,8 @@ public:
     // Removes the cached kernel for specified params if it exists, for all cache versions.
     void RemoveKernel(const Params& params);
     // Saves the internal cache to specified file.
+    // Entries present in the file but not in the internal cache (e.g. stored meanwhile by tuning of other networks
+    // against the same file) are kept, unless they were removed from this cache. The file is replaced atomically.
     void Save(const std::string& cacheFilePath);
 
     bool NeedsSave() const { return needsSave; }
@@ -65,8 +68,13 @@ private:
     bool RemoveKernel_v1(const Params& params, uint32_t computeUnitsCount);
     bool RemoveKernel_v2(const Params& params, uint32_t computeUnitsCount);
 
+    void MergeEntries_v2(const rapidjson::Document& other);
+    rapidjson::Value& GetOrAddObject(rapidjson::Value& parent, const char* name);
+
+    using EntryKey = std::tuple<std::string, std::string, std::string>;  // compute units, kernel type, params
 
     rapidjson::Document cache;
+    std::set<EntryKey> removedEntries;
     bool needsSave;
 
     static constexpr const char* version1Marker = "version_1";
@@ -0,0 +1,132 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+#if TRANSPOSE_KEY
+#   define KEY_INDEX(b, h, k, d) INPUT1_GET_INDEX(b, h, k, d)
+#else
+#   define KEY_INDEX(b, h, k, d) INPUT1_GET_INDEX(b, h, d, k)
+#endif
+
+// size 1 dimensions of the mask are broadcasted
+#define MASK_INDEX(b, h, q, k) INPUT3_GET_INDEX((b) % INPUT3_BATCH_NUM, (h) % INPUT3_FEATURE_NUM, \
+                                                (q) % INPUT3_SIZE_Y, (k) % INPUT3_SIZE_X)
+
+__attribute__((reqd_work_group_size(KEY_BLOCK, QUERY_BLOCK, 1)))
+KERNEL(attention_tile_slm)(
+    const __global INPUT0_TYPE* query,
+    const __global INPUT1_TYPE* key,
+    const __global INPUT2_TYPE* value,
+#if HAS_MASK
+    const __global INPUT3_TYPE* mask,
+#endif
+    __global OUTPUT_TYPE* output)
+{
+    // gws(KEY_BLOCK, align(SEQ_LEN_Q, QUERY_BLOCK), batch * heads)
+    __local INPUT0_TYPE query_tile[QUERY_BLOCK * HEAD_SIZE];
+    __local INPUT1_TYPE key_tile[KEY_BLOCK * HEAD_SIZE];
+    __local INPUT2_TYPE value_tile[KEY_BLOCK * HEAD_SIZE];
+    __local ACCUMULATOR_TYPE scores[QUERY_BLOCK * KEY_BLOCK];
+
+    // local id 0 is a key in the current block for scores and a head element for the output
+    const uint lid = (uint)get_local_id(0);
+    const uint qi = (uint)get_local_id(1);
+    const uint q = (uint)get_global_id(1);
+    const uint b = (uint)get_global_id(2) / OUTPUT_FEATURE_NUM;
+    const uint h = (uint)get_global_id(2) % OUTPUT_FEATURE_NUM;
+    const bool q_valid = q < SEQ_LEN_Q;
+
+    for (uint d = lid; d < HEAD_SIZE; d += KEY_BLOCK)
+        query_tile[qi * HEAD_SIZE + d] = q_valid ? query[INPUT0_GET_INDEX(b, h, q, d)] : INPUT0_VAL_ZERO;
+
+    ACCUMULATOR_TYPE acc[ACC_COUNT];
+    for (uint i = 0; i < ACC_COUNT; ++i)
+        acc[i] = ACCUMULATOR_VAL_ZERO;
+    ACCUMULATOR_TYPE row_max = ACCUMULATOR_VAL_MIN;
+    ACCUMULATOR_TYPE row_sum = ACCUMULATOR_VAL_ZERO;
+
+    for (uint k_start = 0; k_start < SEQ_LEN_K; k_start += KEY_BLOCK) {
+        // tiles of the previous block are consumed by the whole work group
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint kk = qi; kk < KEY_BLOCK; kk += QUERY_BLOCK) {
+            const uint k = k_start + kk;
+            for (uint d = lid; d < HEAD_SIZE; d += KEY_BLOCK) {
+                key_tile[kk * HEAD_SIZE + d] = k < SEQ_LEN_K ? key[KEY_INDEX(b, h, k, d)] : INPUT1_VAL_ZERO;
+                value_tile[kk * HEAD_SIZE + d] = k < SEQ_LEN_K ? value[INPUT2_GET_INDEX(b, h, k, d)] : INPUT2_VAL_ZERO;
+            }
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        const uint k = k_start + lid;
+        ACCUMULATOR_TYPE score = ACCUMULATOR_VAL_MIN;
+        if (k < SEQ_LEN_K) {
+            ACCUMULATOR_TYPE dot = ACCUMULATOR_VAL_ZERO;
+            for (uint d = 0; d < HEAD_SIZE; ++d)
+                dot += TO_ACCUMULATOR_TYPE(query_tile[qi * HEAD_SIZE + d]) * TO_ACCUMULATOR_TYPE(key_tile[lid * HEAD_SIZE + d]);
+            score = dot * TO_ACCUMULATOR_TYPE(SCALE);
+#if HAS_MASK
+            if (q_valid)
+                score += TO_ACCUMULATOR_TYPE(mask[MASK_INDEX(b, h, q, k)]);
+#endif
+        }
+        scores[qi * KEY_BLOCK + lid] = score;
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        ACCUMULATOR_TYPE block_max = row_max;
+        for (uint kk = 0; kk < KEY_BLOCK; ++kk)
+            block_max = ACCUMULATOR_MAX_FUNC(block_max, scores[qi * KEY_BLOCK + kk]);
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        // scores of the block are replaced by not normalized probabilities
+        scores[qi * KEY_BLOCK + lid] = k < SEQ_LEN_K ? exp(score - block_max) : ACCUMULATOR_VAL_ZERO;
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        // rescale what was accumulated with the previous maximum
+        const ACCUMULATOR_TYPE correction = exp(row_max - block_max);
+        row_sum *= correction;
+        for (uint i = 0; i < ACC_COUNT; ++i)
+            acc[i] *= correction;
+
+        for (uint kk = 0; kk < KEY_BLOCK; ++kk) {
+            const ACCUMULATOR_TYPE p = scores[qi * KEY_BLOCK + kk];
+            row_sum += p;
+            for (uint i = 0; i < ACC_COUNT; ++i) {
+                const uint d = lid + i * KEY_BLOCK;
+                if (d < HEAD_SIZE)
+                    acc[i] += p * TO_ACCUMULATOR_TYPE(value_tile[kk * HEAD_SIZE + d]);
+            }
+        }
+        row_max = block_max;
+    }
+
+    if (!q_valid)
+        return;
+
+    for (uint i = 0; i < ACC_COUNT; ++i) {
+        const uint d = lid + i * KEY_BLOCK;
+        if (d < HEAD_SIZE) {
+            const ACCUMULATOR_TYPE res = acc[i] / row_sum;
+            output[OUTPUT_GET_INDEX(b, h, q, d)] = ACTIVATION(TO_OUTPUT_TYPE(res), ACTIVATION_PARAMS);
+        }
+    }
+}
+
+#undef KEY_INDEX
+#undef MASK_INDEX
@@ -18,7 +18,11 @@
 
 KERNEL(eltwise_fs_b_yx_fsv32)(
     INPUTS_DECLS
-    __global UNIT_TYPE* output)
+    __global UNIT_TYPE* output
+#if HAS_FUSED_OPS_DECLS
+    , FUSED_OPS_DECLS
+#endif
+)
 {
     const uint global_id = get_global_id(0);
 
@@ -27,12 +31,30 @@ KERNEL(eltwise_fs_b_yx_fsv32)(
     MAKE_VECTOR_TYPE(UNIT_TYPE, 8) res;
 
     DO_ELTWISE
-    
+
     res = ACTIVATION(res, ACTIVATION_PARAMS);
 
-    vstore8(res, global_id, output);
+#if HAS_FUSED_OPS
+    // 8 elements of a work item belong to one features slice and share batch and spatial coordinates
+    const uint offset = global_id * 8;
+    const uint slice_offset = offset / FEATURE_SLICE_SIZE;
+    const uint x = slice_offset % OUTPUT_SIZE_X;
+    const uint y = slice_offset / OUTPUT_SIZE_X % OUTPUT_SIZE_Y;
+    const uint b = slice_offset / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y) % OUTPUT_BATCH_NUM;
+    const uint f_start = slice_offset / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y * OUTPUT_BATCH_NUM) * FEATURE_SLICE_SIZE +
+                         offset % FEATURE_SLICE_SIZE;
+
+    UNIT_TYPE values[8];
+    vstore8(res, 0, values);
+    __attribute__((opencl_unroll_hint(8)))
+    for (uint i = 0; i < 8; i++) {
+        const uint f = f_start + i;
+        UNIT_TYPE value = values[i];
+        FUSED_OPS;
+        values[i] = FUSED_OPS_RESULT;
+    }
+    res = vload8(0, values);
+#endif
 
+    vstore8(res, global_id, output);
 }
-
-
-
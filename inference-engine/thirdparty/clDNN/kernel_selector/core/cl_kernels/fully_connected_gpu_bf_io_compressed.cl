@@ -0,0 +1,66 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/include_all.cl"
+
+// Weights are INT8 in io layout, so neighbouring work items read neighbouring bytes of the weights.
+// Dequantization (w - zp) * scale is per output feature, so it is applied to the accumulated dot products:
+// sum(in * (w - zp) * scale) == scale * (sum(in * w) - zp * sum(in))
+KERNEL(fully_connected_gpu_bf_io_compressed)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global FILTER_TYPE* weights
+#if BIAS_TERM
+    , const __global BIAS_TYPE* biases
+#endif
+    , const __global DECOMPRESSION_SCALE_TYPE* decompression_scale
+    , const __global DECOMPRESSION_ZP_TYPE* decompression_zp
+#if HAS_FUSED_OPS_DECLS
+    , FUSED_OPS_DECLS
+#endif
+    )
+{
+    const uint ofm = get_global_id(0);
+    const uint b = get_global_id(1);
+
+    ACCUMULATOR_TYPE dot_prod = ACCUMULATOR_VAL_ZERO;
+    ACCUMULATOR_TYPE input_sum = ACCUMULATOR_VAL_ZERO;
+
+    uint input_idx = b * INPUT0_ELEMENTS_COUNT;
+    uint weight_idx = ofm;
+    for (uint i = 0; i < INPUT0_ELEMENTS_COUNT; i++)
+    {
+        const ACCUMULATOR_TYPE in = TO_ACCUMULATOR_TYPE(input[input_idx]);
+        dot_prod = mad(in, TO_ACCUMULATOR_TYPE(weights[weight_idx]), dot_prod);
+        input_sum += in;
+        input_idx += 1;
+        weight_idx += FILTER_OFM_NUM;
+    }
+
+    const ACCUMULATOR_TYPE scale = TO_ACCUMULATOR_TYPE(decompression_scale[ofm]);
+    const ACCUMULATOR_TYPE zp = TO_ACCUMULATOR_TYPE(decompression_zp[ofm]);
+    ACCUMULATOR_TYPE result = scale * mad(-zp, input_sum, dot_prod);
+#if BIAS_TERM
+    result += TO_ACCUMULATOR_TYPE(biases[ofm]);
+#endif
+
+    const uint dst_index = b * FILTER_OFM_NUM + ofm;
+#if HAS_FUSED_OPS
+    FUSED_OPS;
+    output[dst_index] = FUSED_OPS_RESULT;
+#else
+    output[dst_index] = TO_OUTPUT_TYPE(ACTIVATION_TYPED(result, ACTIVATION_PARAMS_TYPED));
+#endif
+}
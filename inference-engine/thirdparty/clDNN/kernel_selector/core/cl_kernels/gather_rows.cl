@@ -0,0 +1,65 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+#include "include/mmad.cl"
+
+#define IN_VEC_TYPE         MAKE_VECTOR_TYPE(INPUT0_TYPE, VEC_SIZE)
+#define OUT_VEC_TYPE        MAKE_VECTOR_TYPE(OUTPUT_TYPE, VEC_SIZE)
+#define TO_OUT_VEC_TYPE(x)  CAT(convert_, OUT_VEC_TYPE)(x)
+
+__attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE)))
+KERNEL(gather_rows)(const __global INPUT0_TYPE* dictionary,
+                    const __global INPUT1_TYPE* indices,
+                    __global OUTPUT_TYPE* output
+#if HAS_FUSED_OPS_DECLS
+                    , FUSED_OPS_DECLS
+#endif
+)
+{
+    // gws(ROW_SIZE / VEC_SIZE, INDICES_COUNT, outer dims of the dictionary)
+    const uint row_offset = ((uint)get_global_id(0) - get_sub_group_local_id()) * VEC_SIZE;
+    const uint index_id = (uint)get_global_id(1);
+    const uint outer = (uint)get_global_id(2);
+
+    const uint index = (uint)indices[index_id];
+    const ulong dictionary_offset = ((ulong)outer * AXIS_SIZE + index) * ROW_SIZE + row_offset;
+    const ulong output_offset = ((ulong)outer * INDICES_COUNT + index_id) * ROW_SIZE + row_offset;
+
+#if HAS_FUSED_OPS
+    INPUT0_TYPE val = BLOCK_READN(INPUT0_TYPE, 1, dictionary, dictionary_offset);
+
+    ulong out_idx = output_offset + get_sub_group_local_id();
+    const uint x = out_idx % OUTPUT_SIZE_X; out_idx /= OUTPUT_SIZE_X;
+    const uint y = out_idx % OUTPUT_SIZE_Y; out_idx /= OUTPUT_SIZE_Y;
+#if OUTPUT_DIMS > 4
+    const uint z = out_idx % OUTPUT_SIZE_Z; out_idx /= OUTPUT_SIZE_Z;
+#endif
+#if OUTPUT_DIMS > 5
+    const uint w = out_idx % OUTPUT_SIZE_W; out_idx /= OUTPUT_SIZE_W;
+#endif
+    const uint f = out_idx % OUTPUT_FEATURE_NUM;
+    const uint b = out_idx / OUTPUT_FEATURE_NUM;
+
+    FUSED_OPS;
+    BLOCK_WRITEN(OUTPUT_TYPE, 1, output, output_offset, TO_OUTPUT_TYPE(FUSED_OPS_RESULT));
+#else
+    IN_VEC_TYPE val = BLOCK_READN(INPUT0_TYPE, VEC_SIZE, dictionary, dictionary_offset);
+    BLOCK_WRITEN(OUTPUT_TYPE, VEC_SIZE, output, output_offset, TO_OUT_VEC_TYPE(ACTIVATION(val, ACTIVATION_PARAMS)));
+#endif
+}
+
+#undef IN_VEC_TYPE
+#undef OUT_VEC_TYPE
+#undef TO_OUT_VEC_TYPE
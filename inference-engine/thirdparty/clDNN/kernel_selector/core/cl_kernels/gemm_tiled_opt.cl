@@ -24,6 +24,18 @@
 #define BLOCK_SHUFFLE(data, sg_lid) as_half16(intel_sub_group_shuffle(as_short16(data), sg_lid))
 #endif // INPUT0_TYPE_SIZE == 4
 
+// Transposes SIMD_WIDTH x SIMD_WIDTH tile kept by the sub-group:
+// element i of work item j becomes element j of work item i
+#define TRANSPOSE_TILE(type, tile)                                              \
+    do {                                                                        \
+        MAKE_VECTOR_TYPE(type, SIMD_WIDTH) transposed;                          \
+        unroll_for (uint col_id = 0; col_id < SIMD_WIDTH; col_id++) {           \
+            MAKE_VECTOR_TYPE(type, SIMD_WIDTH) tile_col = BLOCK_SHUFFLE(tile, col_id); \
+            transposed[col_id] = tile_col[sglid];                               \
+        }                                                                       \
+        tile = transposed;                                                      \
+    } while (0)
+
 #if TILE_K > SIMD_WIDTH
     #define BLOCK_READ_A(ptr, offset) CAT(UNIT_BLOCK_READ, A_VEC_SIZE)(ptr, offset)
 #else // TILE_K > SIMD_WIDTH
@@ -162,14 +174,22 @@ KERNEL(gemm_tiled_opt)(
 
         // Loading B tile
         unroll_for (uint b_load_id = 0; b_load_id < TILE_K; b_load_id++) {
+#if !TRANSPOSE_INPUT1
 #if TILE_N_NOT_DIVISIBLE
             b_tile[b_load_id] = b_raw_global_id > N - 1 ? 0 : b_ptr[sglid];
 #else // TILE_N_NOT_DIVISIBLE
             b_tile[b_load_id] = BLOCK_READ_B(b_ptr, 0);
 #endif // TILE_N_NOT_DIVISIBLE
-#if !TRANSPOSE_INPUT1
             b_ptr += N;
 #else // !TRANSPOSE_INPUT1
+            // Rows of the transposed matrix B are read along K and aren't aligned for block reads if K is a leftover
+#if TILE_N_NOT_DIVISIBLE
+            b_tile[b_load_id] = tile_n_offset + b_load_id > N - 1 ? 0 : b_ptr[sglid];
+#elif TILE_K_NOT_DIVISIBLE
+            b_tile[b_load_id] = b_ptr[sglid];
+#else // TILE_K_NOT_DIVISIBLE
+            b_tile[b_load_id] = BLOCK_READ_B(b_ptr, 0);
+#endif // TILE_N_NOT_DIVISIBLE
             b_ptr += K;
 #endif // !TRANSPOSE_INPUT1
         } // Loading B tile end
@@ -178,36 +198,12 @@ KERNEL(gemm_tiled_opt)(
         b_ptr -= K * SIMD_WIDTH - SIMD_WIDTH;
 
         // B tile shuffling for NT, TT cases
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col0 = BLOCK_SHUFFLE(b_tile, 0);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col1 = BLOCK_SHUFFLE(b_tile, 1);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col2 = BLOCK_SHUFFLE(b_tile, 2);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col3 = BLOCK_SHUFFLE(b_tile, 3);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col4 = BLOCK_SHUFFLE(b_tile, 4);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col5 = BLOCK_SHUFFLE(b_tile, 5);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col6 = BLOCK_SHUFFLE(b_tile, 6);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col7 = BLOCK_SHUFFLE(b_tile, 7);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col8 = BLOCK_SHUFFLE(b_tile, 8);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col9 = BLOCK_SHUFFLE(b_tile, 9);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col10 = BLOCK_SHUFFLE(b_tile, 10);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col11 = BLOCK_SHUFFLE(b_tile, 11);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col12 = BLOCK_SHUFFLE(b_tile, 12);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col13 = BLOCK_SHUFFLE(b_tile, 13);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col14 = BLOCK_SHUFFLE(b_tile, 14);
-        MAKE_VECTOR_TYPE(INPUT1_TYPE, SIMD_WIDTH) b_tile_col15 = BLOCK_SHUFFLE(b_tile, 15);
-
-        b_tile.s0 = b_tile_col0[sglid]; b_tile.s1 = b_tile_col1[sglid];
-        b_tile.s2 = b_tile_col2[sglid]; b_tile.s3 = b_tile_col3[sglid];
-        b_tile.s4 = b_tile_col4[sglid]; b_tile.s5 = b_tile_col5[sglid];
-        b_tile.s6 = b_tile_col6[sglid]; b_tile.s7 = b_tile_col7[sglid];
-        b_tile.s8 = b_tile_col8[sglid]; b_tile.s9 = b_tile_col9[sglid];
-        b_tile.sa = b_tile_col10[sglid]; b_tile.sb = b_tile_col11[sglid];
-        b_tile.sc = b_tile_col12[sglid]; b_tile.sd = b_tile_col13[sglid];
-        b_tile.se = b_tile_col14[sglid]; b_tile.sf = b_tile_col15[sglid];
+        TRANSPOSE_TILE(INPUT1_TYPE, b_tile);
 #endif // TRANSPOSE_INPUT1
 
         // Loading A tile and tile C calculation
-        unroll_for (uint dot_id = 0; dot_id < tile_m_iterations; dot_id++) {
 #if !TRANSPOSE_INPUT0
+        unroll_for (uint dot_id = 0; dot_id < tile_m_iterations; dot_id++) {
 #if TILE_K_NOT_DIVISIBLE
             A_FLOATN a_read = a_ptr[dot_id * K + sglid];
 #else // TILE_K_NOT_DIVISIBLE
@@ -224,42 +220,23 @@ KERNEL(gemm_tiled_opt)(
 #endif // TILE_K > SIMD_WIDTH
                 }
             }
-#else // !TRANSPOSE_INPUT0
-            a_tile[dot_id] = BLOCK_READ_A(a_ptr, dot_id * M);
-#endif // !TRANSPOSE_INPUT0
         } // Loading A tile and tile C calculation end
 
-#if !TRANSPOSE_INPUT0
         a_ptr += TILE_K;
 #else // !TRANSPOSE_INPUT0
+        // Rows of the transposed matrix A are read along M, all TILE_K of them are needed even for the M leftover
+        unroll_for (uint a_load_id = 0; a_load_id < TILE_K; a_load_id++) {
+#if TILE_M_NOT_DIVISIBLE
+            a_tile[a_load_id] = tile_m_offset + sglid > M - 1 ? 0 : a_ptr[a_load_id * M + sglid];
+#else // TILE_M_NOT_DIVISIBLE
+            a_tile[a_load_id] = BLOCK_READ_A(a_ptr, a_load_id * M);
+#endif // TILE_M_NOT_DIVISIBLE
+        }
+
         a_ptr += TILE_K * M;
 
         // A tile shuffling for TN, TT cases
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col0 = BLOCK_SHUFFLE(a_tile, 0);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col1 = BLOCK_SHUFFLE(a_tile, 1);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col2 = BLOCK_SHUFFLE(a_tile, 2);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col3 = BLOCK_SHUFFLE(a_tile, 3);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col4 = BLOCK_SHUFFLE(a_tile, 4);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col5 = BLOCK_SHUFFLE(a_tile, 5);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col6 = BLOCK_SHUFFLE(a_tile, 6);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col7 = BLOCK_SHUFFLE(a_tile, 7);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col8 = BLOCK_SHUFFLE(a_tile, 8);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col9 = BLOCK_SHUFFLE(a_tile, 9);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col10 = BLOCK_SHUFFLE(a_tile, 10);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col11 = BLOCK_SHUFFLE(a_tile, 11);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col12 = BLOCK_SHUFFLE(a_tile, 12);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col13 = BLOCK_SHUFFLE(a_tile, 13);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col14 = BLOCK_SHUFFLE(a_tile, 14);
-        MAKE_VECTOR_TYPE(INPUT0_TYPE, SIMD_WIDTH) a_tile_col15 = BLOCK_SHUFFLE(a_tile, 15);
-
-        a_tile.s0 = a_tile_col0[sglid]; a_tile.s1 = a_tile_col1[sglid];
-        a_tile.s2 = a_tile_col2[sglid]; a_tile.s3 = a_tile_col3[sglid];
-        a_tile.s4 = a_tile_col4[sglid]; a_tile.s5 = a_tile_col5[sglid];
-        a_tile.s6 = a_tile_col6[sglid]; a_tile.s7 = a_tile_col7[sglid];
-        a_tile.s8 = a_tile_col8[sglid]; a_tile.s9 = a_tile_col9[sglid];
-        a_tile.sa = a_tile_col10[sglid]; a_tile.sb = a_tile_col11[sglid];
-        a_tile.sc = a_tile_col12[sglid]; a_tile.sd = a_tile_col13[sglid];
-        a_tile.se = a_tile_col14[sglid]; a_tile.sf = a_tile_col15[sglid];
+        TRANSPOSE_TILE(INPUT0_TYPE, a_tile);
 
         // Tile C calculation for TN, TT cases
         unroll_for (uint dot_id = 0; dot_id < tile_m_iterations; dot_id++) {
@@ -273,6 +250,7 @@ KERNEL(gemm_tiled_opt)(
 
 #if TILE_K_NOT_DIVISIBLE
     // Loading leftovers of the matrix B
+#if !TRANSPOSE_INPUT1
     unroll_for (uint b_load_id = 0; b_load_id < TILE_K_LEFTOVER; b_load_id++) {
 #if TILE_N_NOT_DIVISIBLE
         b_tile[b_load_id] = b_raw_global_id > N - 1 ? 0 : b_ptr[sglid];
@@ -280,16 +258,39 @@ KERNEL(gemm_tiled_opt)(
         b_tile[b_load_id] = BLOCK_READ_B(b_ptr, 0);
 #endif // TILE_N_NOT_DIVISIBLE
         b_ptr += N;
-    } // Loading leftovers of the matrix B end
+    }
+#else // !TRANSPOSE_INPUT1
+    unroll_for (uint b_load_id = 0; b_load_id < SIMD_WIDTH; b_load_id++) {
+        b_tile[b_load_id] = sglid > TILE_K_LEFTOVER - 1 || tile_n_offset + b_load_id > N - 1 ? 0 : b_ptr[b_load_id * K + sglid];
+    }
+
+    TRANSPOSE_TILE(INPUT1_TYPE, b_tile);
+#endif // !TRANSPOSE_INPUT1
+    // Loading leftovers of the matrix B end
 
     // Loading leftovers of the matrix A and tile C calculation
+#if !TRANSPOSE_INPUT0
     unroll_for (uint dot_id = 0; dot_id < tile_m_iterations; dot_id++) {
-        INPUT0_TYPE a_read = a_ptr[dot_id * K + sglid];
+        INPUT0_TYPE a_read = sglid > TILE_K_LEFTOVER - 1 ? 0 : a_ptr[dot_id * K + sglid];
 
         unroll_for (uint simd_id = 0; simd_id < TILE_K_LEFTOVER; simd_id++) {
             c_tile[dot_id] = mad((INPUT0_TYPE)(sub_group_broadcast(a_read, simd_id)), b_tile[simd_id], c_tile[dot_id]);
         }
-    } // Loading leftovers of the matrix A and tile C calculation end
+    }
+#else // !TRANSPOSE_INPUT0
+    unroll_for (uint a_load_id = 0; a_load_id < SIMD_WIDTH; a_load_id++) {
+        a_tile[a_load_id] = a_load_id > TILE_K_LEFTOVER - 1 || tile_m_offset + sglid > M - 1 ? 0 : a_ptr[a_load_id * M + sglid];
+    }
+
+    TRANSPOSE_TILE(INPUT0_TYPE, a_tile);
+
+    unroll_for (uint dot_id = 0; dot_id < tile_m_iterations; dot_id++) {
+        unroll_for (uint simd_id = 0; simd_id < TILE_K_LEFTOVER; simd_id++) {
+            c_tile[dot_id] = mad((INPUT0_TYPE)(sub_group_broadcast(a_tile[dot_id], simd_id)), b_tile[simd_id], c_tile[dot_id]);
+        }
+    }
+#endif // !TRANSPOSE_INPUT0
+    // Loading leftovers of the matrix A and tile C calculation end
 #endif // TILE_K_NOT_DIVISIBLE
 
 #if HAS_FUSED_OPS && FUSED_OPS_CAN_USE_PRELOAD
@@ -354,6 +355,7 @@ KERNEL(gemm_tiled_opt)(
 
 #undef unroll_for
 #undef BLOCK_SHUFFLE
+#undef TRANSPOSE_TILE
 #undef BLOCK_READ_A
 #undef BLOCK_READ_B
 #undef BLOCK_WRITE_C
@@ -49,12 +49,15 @@ KERNEL (mvn_gpu_bfyx_opt)(
         my_sum += (float)input[data_set_offset + workers_per_data_set * ITEMS_NUM + in_data_set_idx];
     }
 
-    lg_storage[in_data_set_idx] = my_sum;
+    //sub-groups reduce their partial sums first, so only one value per sub-group goes through local memory
+    my_sum = sub_group_reduce_add(my_sum);
+    if (get_sub_group_local_id() == 0)
+        lg_storage[get_sub_group_id()] = my_sum;
 
     barrier(CLK_LOCAL_MEM_FENCE);
     if (in_data_set_idx == 0)
     {
-        for (uint i=1; i<LWS; ++i)
+        for (uint i=1; i<get_num_sub_groups(); ++i)
             my_sum += lg_storage[i];
 
         lg_storage[0] = my_sum / data_set_size;
@@ -103,12 +106,14 @@ KERNEL (mvn_gpu_bfyx_opt)(
         my_variance = fma(tmp, tmp, my_variance);
     }
 
-    lg_storage[in_data_set_idx] = my_variance;
+    my_variance = sub_group_reduce_add(my_variance);
+    if (get_sub_group_local_id() == 0)
+        lg_storage[get_sub_group_id()] = my_variance;
 
     barrier(CLK_LOCAL_MEM_FENCE);
     if (in_data_set_idx == 0)
     {
-        for (uint i=1; i<LWS; ++i)
+        for (uint i=1; i<get_num_sub_groups(); ++i)
             my_variance += lg_storage[i];
 
         my_variance /= data_set_size;
@@ -0,0 +1,64 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+// one more column avoids bank conflicts while the tile is read transposed
+#define TILE_STRIDE (TILE_SIZE + 1)
+
+__attribute__((reqd_work_group_size(TILE_SIZE, 1, 1)))
+KERNEL (permute_tile_slm)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output
+#if HAS_FUSED_OPS_DECLS
+    , FUSED_OPS_DECLS
+#endif
+    )
+{
+    // gws(align(READ_DIM_SIZE, TILE_SIZE), ceil(WRITE_DIM_SIZE / TILE_SIZE), other dims)
+    __local INPUT0_TYPE tile[TILE_SIZE * TILE_STRIDE];
+
+    const uint lid = (uint)get_local_id(0);
+    const uint read_start = (uint)get_group_id(0) * TILE_SIZE;
+    const uint write_start = (uint)get_global_id(1) * TILE_SIZE;
+    DECLARE_OTHER_DIMS;
+
+    // neighbour work items read neighbour elements of READ_DIM
+    if (read_start + lid < READ_DIM_SIZE) {
+        const uint READ_DIM = read_start + lid;
+        for (uint i = 0; i < TILE_SIZE && write_start + i < WRITE_DIM_SIZE; ++i) {
+            const uint WRITE_DIM = write_start + i;
+            tile[i * TILE_STRIDE + lid] = input[IN_IDX];
+        }
+    }
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // and write neighbour elements of WRITE_DIM, which is contiguous in the output
+    if (write_start + lid < WRITE_DIM_SIZE) {
+        const uint WRITE_DIM = write_start + lid;
+        for (uint i = 0; i < TILE_SIZE && read_start + i < READ_DIM_SIZE; ++i) {
+            const uint READ_DIM = read_start + i;
+            INPUT0_TYPE input_var = tile[lid * TILE_STRIDE + i];
+#if HAS_FUSED_OPS
+            FUSED_OPS;
+            output[OUT_IDX] = FUSED_OPS_RESULT;
+#else
+            output[OUT_IDX] = ACTIVATION(input_var, ACTIVATION_PARAMS);
+#endif
+        }
+    }
+}
+
+#undef TILE_STRIDE
@@ -0,0 +1,228 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+#if REDUCE_MAX_MODE
+    #define INIT_VAL ACCUMULATOR_VAL_MIN
+#elif REDUCE_MIN_MODE
+    #define INIT_VAL ACCUMULATOR_VAL_MAX
+#elif REDUCE_PROD_MODE || REDUCE_AND_MODE
+    #define INIT_VAL ACCUMULATOR_VAL_ONE
+#else
+    #define INIT_VAL ACCUMULATOR_VAL_ZERO
+#endif
+
+inline ACCUMULATOR_TYPE FUNC(apply_reduce)(ACCUMULATOR_TYPE acc, ACCUMULATOR_TYPE input) {
+    #if REDUCE_SUM_MODE || REDUCE_MEAN_MODE || REDUCE_LOG_SUM_MODE
+        acc += input;
+    #elif REDUCE_MAX_MODE
+        acc = ACCUMULATOR_MAX_FUNC(acc, input);
+    #elif REDUCE_MIN_MODE
+        acc = ACCUMULATOR_MIN_FUNC(acc, input);
+    #elif REDUCE_PROD_MODE
+        acc *= input;
+    #elif REDUCE_AND_MODE
+        acc = acc && input;
+    #elif REDUCE_OR_MODE
+        acc = acc || input;
+    #elif REDUCE_SUM_SQUARE_MODE || REDUCE_L2_MODE
+        acc += input * input;
+    #elif REDUCE_L1_MODE
+        acc += ACCUMULATOR_ABS_FUNC(input);
+    #elif REDUCE_LOG_SUM_EXP_MODE
+        acc += TO_ACCUMULATOR_TYPE(exp(TO_FINAL_ACCUMULATOR_TYPE(input)));
+    #endif
+
+    return acc;
+}
+
+// Combines partial results of the whole sub-group, every work item gets the combined value
+inline ACCUMULATOR_TYPE FUNC(sub_group_reduce)(ACCUMULATOR_TYPE acc) {
+    #if REDUCE_MAX_MODE
+        acc = sub_group_reduce_max(acc);
+    #elif REDUCE_MIN_MODE
+        acc = sub_group_reduce_min(acc);
+    #elif REDUCE_PROD_MODE
+        for (uint offset = SIMD / 2; offset > 0; offset /= 2)
+            acc *= intel_sub_group_shuffle_down(acc, ACCUMULATOR_VAL_ONE, offset);
+        acc = intel_sub_group_shuffle(acc, 0);
+    #elif REDUCE_AND_MODE
+        acc = sub_group_all(acc != ACCUMULATOR_VAL_ZERO);
+    #elif REDUCE_OR_MODE
+        acc = sub_group_any(acc != ACCUMULATOR_VAL_ZERO);
+    #else
+        acc = sub_group_reduce_add(acc);
+    #endif
+
+    return acc;
+}
+
+inline FINAL_ACCUMULATOR_TYPE FUNC(final_reduce)(FINAL_ACCUMULATOR_TYPE acc) {
+    #if REDUCE_MEAN_MODE
+        acc /= REDUCE_SIZE;
+    #elif REDUCE_L2_MODE
+        acc = sqrt(acc);
+    #elif REDUCE_LOG_SUM_MODE || REDUCE_LOG_SUM_EXP_MODE
+        acc = log(acc);
+    #endif
+
+    return acc;
+}
+
+__attribute__((intel_reqd_sub_group_size(SIMD)))
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL(reduce_gpu_bfyx_opt)(
+    const __global INPUT0_TYPE* data,
+    __global OUTPUT_TYPE* output
+#if HAS_FUSED_OPS_DECLS
+    , FUSED_OPS_DECLS
+#endif
+)
+{
+    // One work group per output element
+    const uint linear_idx = (uint)get_global_id(1);
+    const uint lid = (uint)get_local_id(0);
+
+    const uint x = linear_idx % OUTPUT_SIZE_X;
+    const uint y = linear_idx / OUTPUT_SIZE_X % OUTPUT_SIZE_Y;
+#if INPUT0_DIMS == 4
+    const uint b = linear_idx / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y) / OUTPUT_FEATURE_NUM;
+    const uint f = linear_idx / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y) % OUTPUT_FEATURE_NUM;
+    const uint out_idx = OUTPUT_GET_INDEX(b, f, y, x);
+#elif INPUT0_DIMS == 5
+    const uint z = linear_idx / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y) % OUTPUT_SIZE_Z;
+    const uint b = linear_idx / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y * OUTPUT_SIZE_Z) / OUTPUT_FEATURE_NUM;
+    const uint f = linear_idx / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y * OUTPUT_SIZE_Z) % OUTPUT_FEATURE_NUM;
+    const uint out_idx = OUTPUT_GET_INDEX(b, f, z, y, x);
+#elif INPUT0_DIMS == 6
+    const uint z = linear_idx / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y) % OUTPUT_SIZE_Z;
+    const uint w = linear_idx / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y * OUTPUT_SIZE_Z) % OUTPUT_SIZE_W;
+    const uint b = linear_idx / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y * OUTPUT_SIZE_Z * OUTPUT_SIZE_W) / OUTPUT_FEATURE_NUM;
+    const uint f = linear_idx / (OUTPUT_SIZE_X * OUTPUT_SIZE_Y * OUTPUT_SIZE_Z * OUTPUT_SIZE_W) % OUTPUT_FEATURE_NUM;
+    const uint out_idx = OUTPUT_GET_INDEX(b, f, w, z, y, x);
+#endif
+
+    // Input coordinates of kept axes, reduced axes are walked below
+#ifndef REDUCE_BATCH
+    const uint batch_out = BATCH_NUM_IDX_COMP(linear_idx);
+#endif
+#ifndef REDUCE_FEATURE
+    const uint feature_out = FEATURE_NUM_IDX_COMP(linear_idx);
+#endif
+#if INPUT0_DIMS == 6 && !defined(REDUCE_W)
+    const uint w_out = SIZE_W_IDX_COMP(linear_idx);
+#endif
+#if INPUT0_DIMS >= 5 && !defined(REDUCE_Z)
+    const uint z_out = SIZE_Z_IDX_COMP(linear_idx);
+#endif
+#ifndef REDUCE_Y
+    const uint y_out = SIZE_Y_IDX_COMP(linear_idx);
+#endif
+#ifndef REDUCE_X
+    const uint x_out = SIZE_X_IDX_COMP(linear_idx);
+#endif
+
+    // Stage 1: every work item accumulates elements lid, lid + LWS, ... of the reduced volume,
+    // neighbouring work items read neighbouring elements of the innermost reduced axis
+    ACCUMULATOR_TYPE acc = INIT_VAL;
+    for (uint i = lid; i < REDUCE_SIZE; i += LWS) {
+        uint r = i;
+#ifdef REDUCE_X
+        const uint xi = r % INPUT0_SIZE_X;
+        r /= INPUT0_SIZE_X;
+#else
+        const uint xi = x_out;
+#endif
+#ifdef REDUCE_Y
+        const uint yi = r % INPUT0_SIZE_Y;
+        r /= INPUT0_SIZE_Y;
+#else
+        const uint yi = y_out;
+#endif
+#if INPUT0_DIMS >= 5
+#ifdef REDUCE_Z
+        const uint zi = r % INPUT0_SIZE_Z;
+        r /= INPUT0_SIZE_Z;
+#else
+        const uint zi = z_out;
+#endif
+#endif
+#if INPUT0_DIMS == 6
+#ifdef REDUCE_W
+        const uint wi = r % INPUT0_SIZE_W;
+        r /= INPUT0_SIZE_W;
+#else
+        const uint wi = w_out;
+#endif
+#endif
+#ifdef REDUCE_FEATURE
+        const uint fi = r % INPUT0_FEATURE_NUM;
+        r /= INPUT0_FEATURE_NUM;
+#else
+        const uint fi = feature_out;
+#endif
+#ifdef REDUCE_BATCH
+        const uint bi = r;
+#else
+        const uint bi = batch_out;
+#endif
+
+#if INPUT0_DIMS == 6
+        const uint input_idx = INPUT0_GET_INDEX(bi, fi, wi, zi, yi, xi);
+#elif INPUT0_DIMS == 5
+        const uint input_idx = INPUT0_GET_INDEX(bi, fi, zi, yi, xi);
+#else
+        const uint input_idx = INPUT0_GET_INDEX(bi, fi, yi, xi);
+#endif
+        acc = FUNC_CALL(apply_reduce)(acc, TO_ACCUMULATOR_TYPE(data[input_idx]));
+    }
+
+    // Stage 2: sub-groups combine their partial results and the first sub-group combines the rest
+    acc = FUNC_CALL(sub_group_reduce)(acc);
+
+#if SUB_GROUPS_COUNT > 1
+    __local ACCUMULATOR_TYPE partial_results[SUB_GROUPS_COUNT];
+
+    const uint sgid = get_sub_group_id();
+    const uint sglid = get_sub_group_local_id();
+    if (sglid == 0)
+        partial_results[sgid] = acc;
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    if (sgid != 0)
+        return;
+
+    acc = sglid < SUB_GROUPS_COUNT ? partial_results[sglid] : INIT_VAL;
+    acc = FUNC_CALL(sub_group_reduce)(acc);
+#endif
+
+    if (lid != 0)
+        return;
+
+    FINAL_ACCUMULATOR_TYPE final_acc = FUNC_CALL(final_reduce)(TO_FINAL_ACCUMULATOR_TYPE(acc));
+
+    OUTPUT_TYPE final_result;
+    ACTIVATION_TYPE reduce_result = TO_ACTIVATION_TYPE(final_acc);
+#if HAS_FUSED_OPS
+    FUSED_OPS;
+    final_result = FUSED_OPS_RESULT;
+#else
+    final_result = TO_OUTPUT_TYPE(ACTIVATION(reduce_result, ACTIVATION_PARAMS));
+#endif
+    output[out_idx] = final_result;
+}
+
+#undef INIT_VAL
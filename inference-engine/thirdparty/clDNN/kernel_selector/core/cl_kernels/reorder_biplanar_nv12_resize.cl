@@ -0,0 +1,77 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/fetch.cl"
+#include "include/data_types.cl"
+
+inline uint FUNC(get_output_index)(uint b, uint f, uint y, uint x)
+{
+#if defined OUTPUT_LAYOUT_BFYX || defined OUTPUT_LAYOUT_BYXF || defined OUTPUT_LAYOUT_YXFB
+    return GET_DATA_INDEX(OUTPUT, b, f, y, x);
+#elif defined OUTPUT_LAYOUT_B_FS_YX_FSV16
+    return GET_DATA_B_FS_YX_FSV16_INDEX(OUTPUT, b, f, y, x);
+#elif defined OUTPUT_LAYOUT_B_FS_YX_FSV4
+    return GET_DATA_B_FS_YX_FSV4_INDEX(OUTPUT, b, f, y, x);
+#elif defined OUTPUT_LAYOUT_FS_B_YX_FSV32
+    return GET_DATA_FS_B_YX_FSV32_INDEX(OUTPUT, b, f, y, x);
+#else
+#error reorder_biplanar_nv12_resize.cl: output format - not supported
+#endif
+}
+
+// Pixel centers of the output are mapped to the input ones (half pixel coordinates) and sampled by the linear filter,
+// the UV plane is sampled at half of the Y plane coordinates.
+__constant sampler_t linear_sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP_TO_EDGE | CLK_FILTER_LINEAR;
+
+KERNEL(reorder_biplanar_nv12_resize)(
+    read_only image2d_t input,
+    read_only image2d_t input_uv,
+    __global OUTPUT_REORDER_TYPE* output
+#ifdef MEAN_SUBTRACT_IN_BUFFER
+    , __global MEAN_SUBTRACT_TYPE* mean_subtract
+#endif
+    )
+{
+    const uint x = get_global_id(0);
+    const uint y = get_global_id(1);
+    const uint b = get_global_id(2);
+
+    const float2 coord = (float2)(((float)x + 0.5f) * SCALE_X, ((float)y + 0.5f) * SCALE_Y);
+    float4 Y = read_imagef(input, linear_sampler, coord);
+    float4 UV = read_imagef(input_uv, linear_sampler, coord * 0.5f);
+
+    float Ycomponent = mad(Y.x, 296.82f, -18.624f);
+    float Ucomponent = mad(UV.x, 255.0f, -128.f);
+    float Vcomponent = mad(UV.y, 255.0f, -128.f);
+
+    float B = clamp(mad(Vcomponent, 1.596f, Ycomponent), 0.f, 255.f);
+    float R = clamp(mad(Ucomponent, 2.018f, Ycomponent), 0.f, 255.f);
+    float G = clamp(mad(Vcomponent, -0.813f, mad(Ucomponent, -0.391f, Ycomponent)), 0.f, 255.f);
+
+#if defined MEAN_SUBTRACT_INSIDE_PARAMS
+    R = MEAN_OP(R, VALUE_TO_SUBTRACT[0]);
+    G = MEAN_OP(G, VALUE_TO_SUBTRACT[1]);
+    B = MEAN_OP(B, VALUE_TO_SUBTRACT[2]);
+#elif defined MEAN_SUBTRACT_IN_BUFFER
+    // the mean image has the size of the output
+    R = MEAN_OP(R, mean_subtract[GET_DATA_INDEX_SAFE(MEAN_SUBTRACT, b, 0, y, x)]);
+    G = MEAN_OP(G, mean_subtract[GET_DATA_INDEX_SAFE(MEAN_SUBTRACT, b, 1, y, x)]);
+    B = MEAN_OP(B, mean_subtract[GET_DATA_INDEX_SAFE(MEAN_SUBTRACT, b, 2, y, x)]);
+#endif
+
+    output[FUNC_CALL(get_output_index)(b, 0, y, x)] = ACTIVATION_FUNC_TYPED(OUTPUT_REORDER, TO_OUTPUT_REORDER_TYPE(R), NL_M, NL_N);
+    output[FUNC_CALL(get_output_index)(b, 1, y, x)] = ACTIVATION_FUNC_TYPED(OUTPUT_REORDER, TO_OUTPUT_REORDER_TYPE(G), NL_M, NL_N);
+    output[FUNC_CALL(get_output_index)(b, 2, y, x)] = ACTIVATION_FUNC_TYPED(OUTPUT_REORDER, TO_OUTPUT_REORDER_TYPE(B), NL_M, NL_N);
+}
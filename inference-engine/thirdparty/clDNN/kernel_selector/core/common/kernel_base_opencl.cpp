@@ -184,6 +184,7 @@ void KernelBaseOpenCL::FillCLKernelData(clKernelData& kernel,
     KernelBase::CheckDispatchData(kernelMapName, dispatchData);
     kernel.workGroups.global = dispatchData.gws;
     kernel.workGroups.local = dispatchData.lws;
+    kernel.workGroups.batch_dim = dispatchData.batch_dim;
     kernel.kernelString = GetKernelString(kernelMapName, jit, entryPoint, engine_info, exeMode);
     kernel.arguments = GetArgsDesc(number_of_inputs, weights, bias, number_of_inputs_for_fused_prims);
 }
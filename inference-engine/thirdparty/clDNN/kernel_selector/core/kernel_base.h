@@ -30,8 +30,10 @@ struct CommonDispatchData {
     std::vector<size_t> gws;
     std::vector<size_t> lws;
     float efficiency;
+    // gws dimension which enumerates output batches only, so its size may be limited at runtime
+    int batch_dim;
 
-    CommonDispatchData() : gws({0, 0, 0}), lws({0, 0, 0}), efficiency(0.0f) {}
+    CommonDispatchData() : gws({0, 0, 0}), lws({0, 0, 0}), efficiency(0.0f), batch_dim(-1) {}
 };
 
 std::string toString(const kernel_selector::CommonDispatchData& dispatchData);
@@ -73,6 +73,8 @@ struct KernelString {
 struct WorkGroupSizes {
     std::vector<size_t> global;
     std::vector<size_t> local;
+    // Global dimension which enumerates output batches only, -1 if batches can't be limited at runtime
+    int batch_dim = -1;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
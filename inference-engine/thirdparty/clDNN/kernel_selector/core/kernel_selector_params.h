@@ -146,6 +146,7 @@ public:
                         uint32_t deformable : 1;
                     } conv;
                     struct fc_t {
+                        uint32_t compressed_weights : 1;
                     } fc;
                     struct softmax_t {
                         uint32_t dimX : 1;
@@ -314,6 +315,7 @@ public:
     void EnableLocalConvolution() { key.restrict.val.dedicated.conv.local = 1; }
     void EnableGroupedConvolution() { key.restrict.val.dedicated.conv.grouped = 1; }
     void EnableDeformableMode() { key.restrict.val.dedicated.conv.deformable = 1; }
+    void EnableFCCompressedWeights() { key.restrict.val.dedicated.fc.compressed_weights = 1; }
 
     void EnableFusedConvEltwSplitSupport() { key.restrict.val.dedicated.fused_conv_eltw.split = 1; }
     void EnableFusedConvEltwDilation() { key.restrict.val.dedicated.fused_conv_eltw.dilation = 1; }
@@ -27,10 +27,22 @@
 #include <vector>
 #include <memory>
 #include <set>
+#include <map>
 #include <stdexcept>
 
 namespace cldnn {
 
+namespace {
+
+// internal programs built on this thread in lazy compilation mode, their kernels are warmed up in the background
+// by the next outer program compiled on this thread
+std::vector<program_impl::ptr>& deferred_programs() {
+    static thread_local std::vector<program_impl::ptr> programs;
+    return programs;
+}
+
+}  // namespace
+
 engine::engine(engine_types type, const device& dev, const engine_configuration& configuration)
     : _impl(new engine_impl(*dev.get(), configuration)) {
     if (type != engine_types::ocl)
@@ -66,6 +78,10 @@ uint64_t engine::get_temp_used_device_memory_size() const {
     return _impl->get_used_device_memory();
 }
 
+std::map<std::string, uint64_t> engine::get_memory_statistics() const {
+    return _impl->get_memory_statistics();
+}
+
 engine_types engine::get_type() const {
     return _impl->type();
 }
@@ -87,6 +103,7 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf) {
     result.dump_custom_program = conf.dump_custom_program != 0;
     result.single_kernel_name = conf.single_kernel_name;
     result.host_out_of_order = true;
+    result.out_of_order_dependencies = conf.enable_parallelisation != 0;
     result.use_unifed_shared_memory = true;  // Switch on/off USM.
     result.log = conf.engine_log;
     result.ocl_sources_dumps_dir = conf.sources_dumps_dir;
@@ -94,6 +111,8 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf) {
     result.throttle_mode = conf.throttle_mode;
     result.queues_num = conf.n_streams;
     result.kernels_cache_path = conf.kernels_cache_path;
+    result.kernels_cache_max_size = conf.kernels_cache_max_size;
+    result.n_threads = conf.n_threads;
     result.tuning_cache_path = conf.tuning_cache_path;
     return result;
 }
@@ -215,6 +234,8 @@ program_impl::ptr engine_impl::build_program(const topology_impl& topology,
                                             bool is_internal,
                                             bool no_optimizations) {
     program_impl::ptr progr_impl{ new program_impl(*this, topology, options, is_internal, no_optimizations), false };
+    if (is_internal && _configuration.lazy_kernels_compilation)
+        deferred_programs().push_back(progr_impl);
     return progr_impl;
 }
 
@@ -222,6 +243,8 @@ program_impl::ptr engine_impl::build_program(const std::set<std::shared_ptr<prog
                                             const build_options& options,
                                             bool is_internal) {
     program_impl::ptr progr_impl{ new program_impl(*this, nodes, options, is_internal), false };
+    if (is_internal && _configuration.lazy_kernels_compilation)
+        deferred_programs().push_back(progr_impl);
     return progr_impl;
 }
 
@@ -254,14 +277,42 @@ void engine_impl::wait_for_events(std::vector<event_impl::ptr> const& events) {
 
 gpu::device_info_internal engine_impl::get_device_info() const { return _context->get_device_info(); }
 
+std::map<std::string, uint64_t> engine_impl::get_memory_statistics() const {
+    static const std::vector<std::pair<std::string, allocation_type>> types = {
+        {"cl_mem", allocation_type::cl_mem},
+        {"usm_host", allocation_type::usm_host},
+        {"usm_shared", allocation_type::usm_shared},
+        {"usm_device", allocation_type::usm_device}};
+
+    std::map<std::string, uint64_t> statistics;
+    for (const auto& type : types) {
+        statistics[type.first + "_current"] = _memory_pool.get_temp_memory_used(type.second);
+        statistics[type.first + "_peak"] = _memory_pool.get_max_peak_memory_used(type.second);
+    }
+    statistics["total_current"] = _memory_pool.get_temp_memory_used();
+    statistics["total_peak"] = _memory_pool.get_max_peak_device_memory_used();
+    return statistics;
+}
+
 void* engine_impl::get_user_context() const { return static_cast<void*>(_context->context().get()); }
 
-void engine_impl::compile_program(program_impl& program) {
+void engine_impl::compile_program(program_impl& program, bool is_internal) {
     auto& cache = _context->get_kernels_cache(program.get_id());
     if (!program.get_options().get<build_option_type::serialize_network>()->serialization_network_name.empty())
         cache.get_context().set_serialization_flag(true);
-    // TODO: better compilation logic instead of a simple 'compile all'?
+
+    // In lazy mode kernels of internal programs (condition branches, constant subgraphs) are built when they are
+    // requested for the first time or in the background after the outer program is ready
+    if (is_internal && _configuration.lazy_kernels_compilation)
+        return;
+
     cache.build_all();
+
+    auto& internal_programs = deferred_programs();
+    if (!is_internal && !internal_programs.empty()) {
+        program.start_kernels_warm_up(internal_programs);
+        internal_programs.clear();
+    }
 }
 
 bool engine_impl::use_memory_pool() const {
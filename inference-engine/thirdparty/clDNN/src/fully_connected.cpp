@@ -54,6 +54,10 @@ bool is_batch_after_spatial(const std::string order) {
 format::type get_preferred_format(const fully_connected_node& node) {
     auto input_layout = node.input().get_output_layout();
 
+    // compressed weights kernel produces bf output for any input layout
+    if (node.compressed_weights())
+        return format::bfyx;
+
     if (data_type_traits::is_floating_point(input_layout.data_type) &&
         (is_batch_after_spatial(input_layout.format.order()) ||
          input_layout.format == format::bs_x_bsv16 ||
@@ -123,6 +127,10 @@ std::string fully_connected_inst::to_string(fully_connected_node const& node) {
     json_composite fc_info;
     fc_info.add("weights id", weights_id);
     fc_info.add("bias id", bias_id);
+    if (node.compressed_weights()) {
+        fc_info.add("decompression scale id", desc->decompression_scale);
+        fc_info.add("decompression zero point id", desc->decompression_zero_point);
+    }
 
     node_info->add("fully connected info", fc_info);
     node_info->dump(primitive_description);
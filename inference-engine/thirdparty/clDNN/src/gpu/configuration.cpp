@@ -25,6 +25,7 @@ configuration::configuration()
       meaningful_kernels_names(false),
       dump_custom_program(false),
       host_out_of_order(true),
+      out_of_order_dependencies(false),
       use_unifed_shared_memory(false),
       compiler_options(""),
       single_kernel_name(""),
@@ -34,6 +35,8 @@ configuration::configuration()
       throttle_mode(throttle_mode_types::disabled),
       queues_num(0),
       tuning_cache_path("cache.json"),
-      kernels_cache_path("") {}
+      kernels_cache_path(""),
+      kernels_cache_max_size(0),
+      n_threads(1) {}
 }  // namespace gpu
 }  // namespace cldnn
@@ -33,6 +33,7 @@ struct configuration {
     bool meaningful_kernels_names;
     bool dump_custom_program;
     bool host_out_of_order;
+    bool out_of_order_dependencies;
     bool use_unifed_shared_memory;
     std::string compiler_options;
     std::string single_kernel_name;
@@ -43,6 +44,8 @@ struct configuration {
     uint16_t queues_num;
     std::string tuning_cache_path;
     std::string kernels_cache_path;
+    uint64_t kernels_cache_max_size;
+    uint16_t n_threads;
 };
 }  // namespace gpu
 }  // namespace cldnn
@@ -45,6 +45,10 @@ protected:
 
         args.weights = (memory_impl::cptr) &instance.weights_memory();
         args.bias = (memory_impl::cptr) (instance.bias_term() ? &instance.bias_memory() : nullptr);
+        if (instance.compressed_weights()) {
+            args.scale_table = (memory_impl::cptr) &instance.decompression_scale_memory();
+            args.weights_zero_points = (memory_impl::cptr) &instance.decompression_zero_point_memory();
+        }
 
         return args;
     }
@@ -68,6 +72,12 @@ public:
             fc_params.quantization = kernel_selector::QuantizationType::NONE;
         }
 
+        if (arg.compressed_weights()) {
+            fc_params.compressed = true;
+            fc_params.decompression_scale = convert_data_tensor(arg.decompression_scale().get_output_layout());
+            fc_params.decompression_zero_point = convert_data_tensor(arg.decompression_zero_point().get_output_layout());
+        }
+
         fc_optional_params.tuningParams.runner =
             std::make_shared<gpu::kernel_runner>(arg.get_program().get_engine(), arg.get_program().get_id(), true);
 
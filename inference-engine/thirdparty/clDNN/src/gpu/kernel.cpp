@@ -17,6 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <iterator>
+#include <algorithm>
 #include "kernel.h"
 #include "memory_gpu.h"
 #include "memory_impl.h"
@@ -271,16 +272,26 @@ void kernel::cleanup(uint32_t queue_id) {
 
 event_impl::ptr kernel::run(uint32_t queue_id,
                             const kernel_selector::cl_kernel_data& kernel_data,
-                            const std::vector<event_impl::ptr>& dependencies) const {
+                            const std::vector<event_impl::ptr>& dependencies,
+                            uint32_t batch) const {
 
     if (_cl_kernels.find(queue_id) == _cl_kernels.end() || _cl_kernels.at(queue_id).get() == NULL) {
         throw std::runtime_error("[clDNN] Kernel for layer " + kernel_data.layerID + " is not found for stream " + std::to_string(queue_id));
     }
 
+    auto global = kernel_data.workGroups.global;
+    const auto& local = kernel_data.workGroups.local;
+    auto batch_dim = kernel_data.workGroups.batch_dim;
+    if (batch != 0 && batch_dim >= 0 && static_cast<size_t>(batch_dim) < global.size()) {
+        // Work groups must stay whole, so the limited batch is rounded up to the local size
+        size_t lws = static_cast<size_t>(batch_dim) < local.size() && local[batch_dim] != 0 ? local[batch_dim] : 1;
+        global[batch_dim] = std::min(global[batch_dim], (batch + lws - 1) / lws * lws);
+    }
+
     return context()->enqueue_kernel(queue_id,
                                      _cl_kernels.at(queue_id),
-                                     toNDRange(kernel_data.workGroups.global),
-                                     toNDRange(kernel_data.workGroups.local),
+                                     toNDRange(global),
+                                     toNDRange(local),
                                      dependencies);
 }
 
@@ -99,9 +99,11 @@ public:
     void set_arguments(uint32_t queue_id,
                        const kernel_selector::cl_kernel_data& kernel_data,
                        const kernel_arguments_data& args);
+    // Non-zero batch limits the batch dimension of global work size if the kernel has one
     event_impl::ptr run(uint32_t queue_id,
                         const kernel_selector::cl_kernel_data& kernel_data,
-                        const std::vector<event_impl::ptr>& dependencies) const;
+                        const std::vector<event_impl::ptr>& dependencies,
+                        uint32_t batch = 0) const;
 };
 
 }  // namespace gpu
@@ -25,6 +25,12 @@
 #include <string>
 #include <memory>
 #include <utility>
+#include <vector>
+#include <cstdio>
+#include <ctime>
+#include <atomic>
+#include <exception>
+#include <thread>
 
 #include "kernel_selector_helper.h"
 
@@ -43,8 +49,14 @@
 #include <locale>
 #include <codecvt>
 #endif
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/stat.h>
 #else
 #include <Windows.h>
+#include <process.h>
+#include <sys/utime.h>
 #endif
 
 namespace {
@@ -67,6 +79,108 @@ std::wstring multiByteCharToWString(const char* str) {
 }
 #endif  // ENABLE_UNICODE_PATH_SUPPORT
 
+const char* const cacheFileExtension = ".cl_cache";
+
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+using path_string = std::wstring;
+path_string toPathString(const std::string& path) { return multiByteCharToWString(path.c_str()); }
+#else
+using path_string = std::string;
+path_string toPathString(const std::string& path) { return path; }
+#endif
+
+struct cache_file {
+    std::string path;
+    uint64_t size;
+    uint64_t last_use;
+};
+
+// Marks the file as recently used, eviction drops the least recently used binaries first
+void touchFile(const std::string& path) {
+    auto filename = toPathString(path);
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    _wutime(filename.c_str(), nullptr);
+#elif defined(_WIN32)
+    _utime(filename.c_str(), nullptr);
+#else
+    utime(filename.c_str(), nullptr);
+#endif
+}
+
+void removeFile(const std::string& path) {
+    auto filename = toPathString(path);
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    _wremove(filename.c_str());
+#else
+    std::remove(filename.c_str());
+#endif
+}
+
+// Replaces the destination in one step, so concurrent readers get either the old or the new file
+bool renameFile(const std::string& from, const std::string& to) {
+    auto src = toPathString(from);
+    auto dst = toPathString(to);
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    return MoveFileExW(src.c_str(), dst.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#elif defined(_WIN32)
+    return MoveFileExA(src.c_str(), dst.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return std::rename(src.c_str(), dst.c_str()) == 0;
+#endif
+}
+
+std::vector<cache_file> listCacheFiles(const std::string& dir) {
+    std::vector<cache_file> files;
+    const std::string extension = cacheFileExtension;
+#ifdef _WIN32
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+    WIN32_FIND_DATAW data;
+    HANDLE handle = FindFirstFileW(toPathString(dir + "*" + extension).c_str(), &data);
+#else
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA((dir + "*" + extension).c_str(), &data);
+#endif
+    if (handle == INVALID_HANDLE_VALUE)
+        return files;
+    do {
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            continue;
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+        std::wstring_convert<std::codecvt_utf8<wchar_t>> wstring_decoder;
+        std::string name = wstring_decoder.to_bytes(data.cFileName);
+#else
+        std::string name = data.cFileName;
+#endif
+        uint64_t size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+        uint64_t last_use = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) |
+                            data.ftLastWriteTime.dwLowDateTime;
+        files.push_back({dir + name, size, last_use});
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+    } while (FindNextFileW(handle, &data));
+#else
+    } while (FindNextFileA(handle, &data));
+#endif
+    FindClose(handle);
+#else
+    DIR* directory = opendir(dir.c_str());
+    if (directory == nullptr)
+        return files;
+    while (struct dirent* entry = readdir(directory)) {
+        std::string name = entry->d_name;
+        if (name.size() <= extension.size() ||
+            name.compare(name.size() - extension.size(), extension.size(), extension) != 0)
+            continue;
+        struct stat info;
+        std::string path = dir + name;
+        if (stat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode))
+            continue;
+        files.push_back({path, static_cast<uint64_t>(info.st_size), static_cast<uint64_t>(info.st_mtime)});
+    }
+    closedir(directory);
+#endif
+    return files;
+}
+
 static std::vector<unsigned char> loadBinaryFromFile(std::string path) {
     std::lock_guard<std::mutex> lock(cacheAccessMutex);
 
@@ -88,25 +202,64 @@ static std::vector<unsigned char> loadBinaryFromFile(std::string path) {
         std::vector<unsigned char> ret(nsize);
 
         auto res = fread(ret.data(), sizeof(unsigned char), nsize, fp);
-        (void)res;
         fclose(fp);
+        if (res != nsize)
+            return {};
+        touchFile(path);
         return ret;
     }
 
     return {};
 }
 
+// The binary is written to a temporary file first and then renamed, so other processes sharing the cache directory
+// never see a partially written file
 static void saveBinaryToFile(std::string path, const std::vector<unsigned char> buffer) {
     std::lock_guard<std::mutex> lock(cacheAccessMutex);
+#ifdef _WIN32
+    std::string tmp_path = path + ".tmp" + std::to_string(_getpid());
+#else
+    std::string tmp_path = path + ".tmp" + std::to_string(getpid());
+#endif
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-    std::wstring widefilename = multiByteCharToWString(path.c_str());
+    std::wstring widefilename = multiByteCharToWString(tmp_path.c_str());
     const wchar_t* filename = widefilename.c_str();
 #else
-    const char* filename = path.c_str();
+    const char* filename = tmp_path.c_str();
 #endif
-    std::ofstream out_file(filename, std::ios::out | std::ios::binary);
-    if (out_file.is_open()) {
-        out_file.write((char*)&buffer[0], buffer.size());
+    bool written = false;
+    {
+        std::ofstream out_file(filename, std::ios::out | std::ios::binary);
+        if (out_file.is_open()) {
+            out_file.write((char*)&buffer[0], buffer.size());
+            written = out_file.good();
+        }
+    }
+    if (!written || !renameFile(tmp_path, path))
+        removeFile(tmp_path);
+}
+
+// Removes the least recently used binaries until the cache directory fits into max_size bytes.
+// The file which has just been stored is kept even if it is larger than the limit.
+static void evictCacheFiles(const std::string& dir, uint64_t max_size, const std::string& keep) {
+    std::lock_guard<std::mutex> lock(cacheAccessMutex);
+    auto files = listCacheFiles(dir);
+    uint64_t total_size = 0;
+    for (const auto& file : files)
+        total_size += file.size;
+    if (total_size <= max_size)
+        return;
+
+    std::sort(files.begin(), files.end(), [](const cache_file& a, const cache_file& b) {
+        return a.last_use < b.last_use;
+    });
+    for (const auto& file : files) {
+        if (total_size <= max_size)
+            break;
+        if (file.path == keep)
+            continue;
+        removeFile(file.path);
+        total_size -= file.size;
     }
 }
 
@@ -176,6 +329,38 @@ inline bool does_options_support_batch_compilation(const std::string& options) {
     return options.find("-D") == std::string::npos && options.find("-I") == std::string::npos;
 }
 
+// Runs func(0) ... func(tasks - 1) on up to max_threads threads, rethrows the first exception after all threads finish
+template <typename F>
+void parallelRun(size_t tasks, size_t max_threads, const F& func) {
+    size_t threads_num = std::min(tasks, max_threads);
+    if (threads_num <= 1) {
+        for (size_t i = 0; i < tasks; i++)
+            func(i);
+        return;
+    }
+
+    std::atomic<size_t> next_task{0};
+    std::vector<std::exception_ptr> errors(threads_num);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threads_num; t++) {
+        threads.emplace_back([&, t]() {
+            try {
+                for (size_t i = next_task++; i < tasks; i = next_task++)
+                    func(i);
+            } catch (...) {
+                errors[t] = std::current_exception();
+                next_task = tasks;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
 }  // namespace
 
 namespace cldnn {
@@ -258,13 +443,14 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
     // Compute hash value for each bucket
     // Hash calculation might require additional optimizations, but currently execution time of this part is much smaller than loading
     // of the precompiled binaries or get_undef_jit calls
-    // Hash is computed for string that contains compilation options + driver version +
+    // Hash is computed for string that contains compilation options + device name + driver version +
     // full source code (jit + template + undef sections) of all kernels in the bucket
+    const auto& device_info = _context.get_device_info();
     for (auto& c : scode) {
         program_code& code = c.second;
         auto options = c.first;
         for (size_t i = 0; i < code.source.size(); i++) {
-            std::string full_code = options + " " + _context.get_device_info().driver_version;
+            std::string full_code = options + " " + device_info.dev_name + " " + device_info.driver_version;
             for (auto& ss : code.source[i])
                 full_code += ss;
             code.hash_values.push_back(std::hash<std::string>()(full_code));
@@ -311,7 +497,7 @@ static std::vector<unsigned char> getProgramBinaries(cl::Program program) {
     return program.getInfo<CL_PROGRAM_BINARIES>().front();
 }
 
-kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const {
+std::string kernels_cache::get_dump_file_name(const program_code& program_source) const {
     static uint32_t current_file_index = 0;
 
     bool dump_sources = !_context.get_configuration().ocl_sources_dumps_dir.empty() || program_source.dump_custom_program;
@@ -324,89 +510,98 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
 
         dump_file_name += "clDNN_program_" + std::to_string(current_file_index++) + "_part_";
     }
+    return dump_file_name;
+}
+
+kernels_cache::kernels_map kernels_cache::build_batch(const program_code& program_source, size_t batch_idx,
+                                                      const std::string& dump_file_name, std::string& err_log) const {
+    bool dump_sources = !dump_file_name.empty();
 
     try {
         kernels_map kmap;
-        std::string err_log;  // accumulated build log from all program's parts (only contains messages from parts which
-                              // failed to compile)
-
-        uint32_t part_idx = 0;
-        for (size_t i = 0; i < program_source.source.size(); i++) {
-            auto sources_bucket_to_compile = program_source.source[i];
-            const auto& hash_value = program_source.hash_values[i];
-            std::string cached_bin_name = get_cache_path() + std::to_string(hash_value) + ".cl_cache";
-            cl::Program::Binaries precompiled_kernels = {};
-            if (is_cache_enabled()) {
-                // Try to load file with name ${hash_value}.cl_cache which contains precompiled kernels for current bucket
-                // If read is successful, then remove kernels from compilation bucket
-                auto bin = loadBinaryFromFile(cached_bin_name);
-                if (!bin.empty()) {
-                    precompiled_kernels.push_back(bin);
-                }
-            }
-            auto current_dump_file_name = dump_file_name + std::to_string(part_idx++) + ".cl";
-            std::ofstream dump_file;
-
-            if (dump_sources) {
-                dump_file.open(current_dump_file_name);
 
-                if (dump_file.good()) {
-                    for (auto& s : sources_bucket_to_compile)
-                        dump_file << s;
-                }
+        const auto& sources_bucket_to_compile = program_source.source[batch_idx];
+        const auto& hash_value = program_source.hash_values[batch_idx];
+        std::string cached_bin_name = get_cache_path() + std::to_string(hash_value) + cacheFileExtension;
+        cl::Program::Binaries precompiled_kernels = {};
+        if (is_cache_enabled()) {
+            // Try to load file with name ${hash_value}.cl_cache which contains precompiled kernels for current bucket
+            // If read is successful, then remove kernels from compilation bucket
+            auto bin = loadBinaryFromFile(cached_bin_name);
+            if (!bin.empty()) {
+                precompiled_kernels.push_back(bin);
             }
+        }
+        auto current_dump_file_name = dump_file_name + std::to_string(batch_idx) + ".cl";
+        std::ofstream dump_file;
 
-            try {
-                cl::vector<cl::Kernel> kernels;
-                // Run compilation
-                if (precompiled_kernels.empty()) {
-                    cl::Program program(_context.context(), sources_bucket_to_compile);
-                    program.build({_context.device()}, program_source.options.c_str());
-
-                    if (dump_sources && dump_file.good()) {
-                        dump_file << "\n/* Build Log:\n";
-                        for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
-                            dump_file << p.second << "\n";
+        if (dump_sources) {
+            dump_file.open(current_dump_file_name);
 
-                        dump_file << "*/\n";
-                    }
+            if (dump_file.good()) {
+                for (auto& s : sources_bucket_to_compile)
+                    dump_file << s;
+            }
+        }
 
-                    program.createKernels(&kernels);
-                    if (is_cache_enabled()) {
-                        // If kernels caching is enabled, then we save compiled bucket to binary file with name ${code_hash_value}.cl_cache
-                        // Note: Bin file contains full bucket, not separate kernels, so kernels reuse across different models is quite limited
-                        // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
-                        // compile time.
-                        saveBinaryToFile(cached_bin_name, getProgramBinaries(program));
-                    }
-                } else {
+        try {
+            cl::vector<cl::Kernel> kernels;
+            if (!precompiled_kernels.empty()) {
+                try {
                     cl::Program program(_context.context(), {_context.device()}, precompiled_kernels);
                     program.build({_context.device()}, program_source.options.c_str());
                     program.createKernels(&kernels);
+                } catch (const cl::Error&) {
+                    // The binary is damaged or was built by a different driver, so it's compiled from sources
+                    // and overwritten below
+                    kernels.clear();
+                    precompiled_kernels.clear();
                 }
+            }
+            // Run compilation
+            if (precompiled_kernels.empty()) {
+                cl::Program program(_context.context(), sources_bucket_to_compile);
+                program.build({_context.device()}, program_source.options.c_str());
 
-                for (auto& k : kernels) {
-                    auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
-                    kmap.emplace(kernel_name, kernels_cache::kernel_type(k, _context.get_device_info().supports_usm));
-                }
-            } catch (const cl::BuildError& err) {
-                if (dump_sources && dump_file.good())
+                if (dump_sources && dump_file.good()) {
                     dump_file << "\n/* Build Log:\n";
-
-                for (auto& p : err.getBuildLog()) {
-                    if (dump_sources && dump_file.good())
+                    for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
                         dump_file << p.second << "\n";
 
-                    err_log += p.second + '\n';
+                    dump_file << "*/\n";
+                }
+
+                program.createKernels(&kernels);
+                if (is_cache_enabled()) {
+                    // If kernels caching is enabled, then we save compiled bucket to binary file with name ${code_hash_value}.cl_cache
+                    // Note: Bin file contains full bucket, not separate kernels, so kernels reuse across different models is quite limited
+                    // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
+                    // compile time.
+                    saveBinaryToFile(cached_bin_name, getProgramBinaries(program));
+                    auto max_cache_size = _context.get_configuration().kernels_cache_max_size;
+                    if (max_cache_size > 0)
+                        evictCacheFiles(get_cache_path(), max_cache_size, cached_bin_name);
                 }
+            }
+
+            for (auto& k : kernels) {
+                auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
+                kmap.emplace(kernel_name, kernels_cache::kernel_type(k, _context.get_device_info().supports_usm));
+            }
+        } catch (const cl::BuildError& err) {
+            if (dump_sources && dump_file.good())
+                dump_file << "\n/* Build Log:\n";
 
+            for (auto& p : err.getBuildLog()) {
                 if (dump_sources && dump_file.good())
-                    dump_file << "*/\n";
+                    dump_file << p.second << "\n";
+
+                err_log += p.second + '\n';
             }
-        }
 
-        if (!err_log.empty())
-            throw std::runtime_error("Program build failed:\n" + std::move(err_log));
+            if (dump_sources && dump_file.good())
+                dump_file << "*/\n";
+        }
 
         return kmap;
     } catch (const cl::Error& err) {
@@ -428,17 +623,45 @@ void kernels_cache::build_all() {
         return;
 
     std::lock_guard<std::mutex> lock(_context.get_cache_mutex());
+    // kernels could have been built by a background warm-up while waiting for the lock
+    if (!_pending_compilation)
+        return;
 
     auto sorted_program_code = get_program_source(_kernels_code);
 
-    _one_time_kernels.clear();
+    // Every batch is a separate cl::Program, so batches are built concurrently. Builds of different program objects
+    // are thread-safe in OpenCL, shared state (cache files, dump file names) is updated under locks or beforehand.
+    struct batch {
+        const program_code* program;
+        size_t idx;
+        std::string dump_file_name;
+    };
+    std::vector<batch> batches;
     for (auto& program : sorted_program_code) {
-        auto kernels = build_program(program.second);
+        auto dump_file_name = get_dump_file_name(program.second);
+        for (size_t i = 0; i < program.second.source.size(); i++)
+            batches.push_back({&program.second, i, dump_file_name});
+    }
+
+    std::vector<kernels_map> batch_kernels(batches.size());
+    std::vector<std::string> batch_logs(batches.size());  // build logs of batches which failed to compile
+    parallelRun(batches.size(), _context.get_configuration().n_threads, [&](size_t i) {
+        batch_kernels[i] = build_batch(*batches[i].program, batches[i].idx, batches[i].dump_file_name, batch_logs[i]);
+    });
 
-        for (auto& k : kernels) {
+    std::string err_log;
+    for (const auto& log : batch_logs)
+        err_log += log;
+    if (!err_log.empty())
+        throw std::runtime_error("Program build failed:\n" + std::move(err_log));
+
+    _one_time_kernels.clear();
+    for (size_t i = 0; i < batches.size(); i++) {
+        const auto& program = *batches[i].program;
+        for (auto& k : batch_kernels[i]) {
             const auto& entry_point = k.first;
-            const auto& k_id = program.second.entry_point_to_id[entry_point];
-            if (program.second.one_time) {
+            const auto& k_id = program.entry_point_to_id.at(entry_point);
+            if (program.one_time) {
                 _one_time_kernels[k_id] = k.second;
             } else {
                 _kernels[k_id] = k.second;
@@ -95,7 +95,9 @@ private:
     uint32_t _prog_id;
 
     sorted_code get_program_source(const kernels_code& kernels_source_code) const;
-    kernels_map build_program(const program_code& pcode) const;
+    std::string get_dump_file_name(const program_code& pcode) const;
+    kernels_map build_batch(const program_code& pcode, size_t batch_idx, const std::string& dump_file_name,
+                            std::string& err_log) const;
 
     std::string get_cache_path() const;
     bool is_cache_enabled() const;
@@ -92,6 +92,7 @@ public:
     }
 
     cl::Event get() override { return _last_ocl_event; }
+    const std::vector<event_impl::ptr>& get_events() const { return _events; }
     std::shared_ptr<gpu_toolkit> get_context() const { return _ctx; }
 
     void reset() override {
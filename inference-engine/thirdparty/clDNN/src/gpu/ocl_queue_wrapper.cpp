@@ -64,6 +64,20 @@ std::string events_list_to_string(std::vector<cldnn::event_impl::ptr> events) {
     ret += ")";
     return ret;
 }
+
+// Grouped events are expanded, so that the wait list covers every kernel of a multi-kernel primitive
+// and not only the last enqueued one.
+void collect_ocl_events(std::vector<cldnn::event_impl::ptr> const& deps, std::vector<cl::Event>& ocl_events) {
+    for (auto& dep : deps) {
+        if (auto group_ev = dynamic_cast<cldnn::gpu::base_events*>(dep.get())) {
+            collect_ocl_events(group_ev->get_events(), ocl_events);
+        } else if (auto ocl_base_ev = dynamic_cast<cldnn::gpu::ocl_base_event*>(dep.get())) {
+            auto ev = ocl_base_ev->get();
+            if (ev() != nullptr)
+                ocl_events.push_back(ev);
+        }
+    }
+}
 }  // namespace
 
 namespace cldnn {
@@ -78,12 +92,8 @@ event_impl::ptr gpu_queue::enqueue_kernel(kernels_cache::kernel_type const& kern
                                           std::vector<event_impl::ptr> const& deps) {
     std::vector<cl::Event> dep_events;
     auto dep_events_ptr = &dep_events;
-    if (!context()->get_configuration().host_out_of_order) {
-        for (auto& dep : deps) {
-            if (auto ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get())) {
-                dep_events.push_back(ocl_base_ev->get());
-            }
-        }
+    if (uses_events_dependencies()) {
+        collect_ocl_events(deps, dep_events);
     } else {
         dep_events_ptr = nullptr;
 
@@ -93,7 +103,7 @@ event_impl::ptr gpu_queue::enqueue_kernel(kernels_cache::kernel_type const& kern
     cl::Event ret_ev;
 
     try {
-        if (!context()->get_configuration().host_out_of_order || _output_event ||
+        if (uses_events_dependencies() || _output_event ||
             context()->get_configuration().enable_profiling) {
             _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, &ret_ev);
         } else {
@@ -111,14 +121,11 @@ event_impl::ptr gpu_queue::enqueue_marker(std::vector<event_impl::ptr> const& de
         return _events_pool->get_from_user_pool(context(), true);
 
     bool enabled_single_kernel = context()->get_configuration().single_kernel_name == "" ? false : true;
-    if (!context()->get_configuration().host_out_of_order) {
+    if (uses_events_dependencies()) {
         cl::Event ret_ev;
         if (!enabled_single_kernel) {
             std::vector<cl::Event> dep_events;
-            for (auto& dep : deps) {
-                if (auto ocl_base_ev = dynamic_cast<ocl_base_event*>(dep.get()))
-                    dep_events.push_back(ocl_base_ev->get());
-            }
+            collect_ocl_events(deps, dep_events);
 
             try {
                 _command_queue.enqueueMarkerWithWaitList(&dep_events, &ret_ev);
@@ -169,6 +176,11 @@ void gpu_queue::release_pending_memory() {
     _mm_free(ptr);
 }
 
+bool gpu_queue::uses_events_dependencies() {
+    auto& config = context()->get_configuration();
+    return !config.host_out_of_order || config.out_of_order_dependencies;
+}
+
 void gpu_queue::sync_events(std::vector<event_impl::ptr> const& deps) {
     bool needs_barrier = false;
     for (auto& dep : deps) {
@@ -94,6 +94,10 @@ public:
     std::shared_ptr<gpu_toolkit> context() { return _context.lock(); }
 
 private:
+    // Kernels wait for the events of their dependencies only, so independent branches of a network may overlap
+    // in an out-of-order queue. Otherwise a barrier is enqueued before a kernel whose dependencies are not complete.
+    bool uses_events_dependencies();
+
     uint32_t id;
     std::weak_ptr<gpu_toolkit> _context;
     queue_type _command_queue;
@@ -123,6 +123,7 @@ gpu_toolkit::gpu_toolkit(const device_impl& device_impl, const configuration& co
                    << "    compiler options: " << _configuration.compiler_options << "\n"
                    << "    single kernel name: " << _configuration.single_kernel_name << "\n"
                    << "    out-of-order: " << std::boolalpha << config.host_out_of_order << "\n"
+                   << "    out-of-order dependencies: " << std::boolalpha << config.out_of_order_dependencies << "\n"
                    << "    engine log: " << _configuration.log << "\n"
                    << "    sources dumps: " << _configuration.ocl_sources_dumps_dir << "\n"
                    << "\nEngine info:\n"
@@ -160,27 +160,25 @@ protected:
             return aggregate_events(events, net_id);
         }
 
+        auto batch = instance.get_network().get_execution_batch(instance.node);
+
         std::vector<event_impl::ptr> tmp_events(events);
         std::vector<event_impl::ptr> all_events;
 
         // TODO - split should be handle in kernel selector by providing multiple kernels.
         auto split = get_split();
 
+        // is any user of the prim's users is an detecion output, set prim as a output event (event won't be
+        // nullptr)
+        bool output_event = instance.node.is_output() || is_any_user_cpu(instance.node.get_users());
+
         // we iterate over split first in order to be able parallelism with OOOQ mechanism.
         for (size_t k = 0; k < _kernels.size(); ++k) {
             std::vector<event_impl::ptr> new_events;
             for (decltype(split) i = 0; i < split; i++) {
-                // is any user of the prim's users is an detecion output, set prim as a output event (event won't be
-                // nullptr)
-                auto users = instance.node.get_users();
-                bool next_prim_is_cpu = is_any_user_cpu(users);
-                if (next_prim_is_cpu) {
-                    _kernels[k].set_output_event(net_id, true);
-                } else {
-                    _kernels[k].set_output_event(net_id, instance.node.is_output());
-                }
+                _kernels[k].set_output_event(net_id, output_event);
 
-                auto event = _kernels[k].run(net_id, _kernel_data.kernels[k], tmp_events);
+                auto event = _kernels[k].run(net_id, _kernel_data.kernels[k], tmp_events, batch);
                 new_events.push_back(event);
                 all_events.push_back(event);
             }
@@ -69,6 +69,7 @@
 #include "api/tile.hpp"
 #include "api/resample.hpp"
 #include "api/gather_tree.hpp"
+#include "api_extension/attention.hpp"
 #include "api_extension/fused_conv_eltwise.hpp"
 #include "api_extension/lstm_dynamic_input.hpp"
 #include "api_extension/lstm_dynamic_timeloop.hpp"
@@ -155,6 +156,7 @@ REGISTER_GPU(ctc_greedy_decoder);
 REGISTER_GPU(cum_sum);
 REGISTER_GPU(embedding_bag);
 REGISTER_GPU(extract_image_patches);
+REGISTER_GPU(attention);
 
 #undef REGISTER_GPU
 
@@ -26,8 +26,10 @@
 #include "quantize_inst.h"
 #include "binary_convolution_inst.h"
 #include "activation_inst.h"
+#include "attention_inst.h"
 #include "batch_to_space_inst.h"
 #include "crop_inst.h"
+#include "data_inst.h"
 #include "eltwise_inst.h"
 #include "fused_conv_eltwise_inst.h"
 #include "gemm_inst.h"
@@ -63,6 +65,7 @@
 void prepare_primitive_fusing::run(program_impl& p) {
     fuse_reorders(p);
     fuse_sigmoid_mul_to_swish(p);
+    fuse_attention(p);
     fuse_bias(p);
     fuse_simple_primitives(p);
     fuse_activations(p);
@@ -133,6 +136,171 @@ void prepare_primitive_fusing::fuse_sigmoid_mul_to_swish(program_impl &p) {
     }
 }
 
+void prepare_primitive_fusing::fuse_attention(program_impl &p) {
+    // Replaces gemm(query, key) -> [scale] -> [eltwise sum with mask] -> softmax -> gemm(value) chain
+    // with attention primitive, so [b, heads, seq, seq] scores are never written to global memory
+    auto get_scalar = [](program_node& node, float& value) -> bool {
+        if (!node.is_type<data>() || node.get_output_layout().count() != 1)
+            return false;
+
+        auto& mem = node.as<data>().get_attached_memory();
+        switch (mem.get_layout().data_type) {
+            case data_types::f32: {
+                mem_lock<float> src{ mem };
+                value = src.data()[0];
+                return true;
+            }
+            case data_types::f16: {
+                mem_lock<half_t> src{ mem };
+                value = static_cast<float>(src.data()[0]);
+                return true;
+            }
+            default:
+                return false;
+        }
+    };
+
+    auto can_be_fused = [](program_node& node) -> bool {
+        return !node.is_output() && node.get_users().size() == 1 && !node.has_fused_primitives();
+    };
+
+    auto is_supported_input = [](program_node& node) -> bool {
+        auto layout = node.get_output_layout();
+        return layout.format.dimension() == 4 &&
+               (layout.data_type == data_types::f32 || layout.data_type == data_types::f16 ||
+                layout.data_type == data_types::i8 || layout.data_type == data_types::u8);
+    };
+
+    // mask can also be computed with eltwise or scale, so the scores branch is the one starting with gemm
+    auto is_scores = [](program_node& node) -> bool {
+        return node.is_type<gemm>() ||
+               ((node.is_type<scale>() || node.is_type<eltwise>()) && node.get_dependency(0).is_type<gemm>()) ||
+               (node.is_type<eltwise>() && node.get_dependencies().size() == 2 && node.get_dependency(1).is_type<gemm>());
+    };
+
+    auto itr = p.get_processing_order().begin();
+    while (itr != p.get_processing_order().end()) {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
+        if (node->is_output())
+            continue;
+
+        program_helpers::do_for_types<gemm>(*node, [&](gemm_node& node) {
+            auto desc = node.get_primitive();
+            auto output_type = node.get_output_layout().data_type;
+            if (node.inputs_count() != 2 || desc->transpose_input0 || desc->transpose_input1 || desc->alpha != 1.0f ||
+                node.has_fused_primitives() || (output_type != data_types::f32 && output_type != data_types::f16))
+                return;
+
+            auto& probs = node.input(0);
+            if (!probs.is_type<softmax>() || !can_be_fused(probs) ||
+                probs.as<softmax>().get_primitive()->dimension != softmax::normalize_x)
+                return;
+
+            std::vector<program_node*> fused_nodes = { &probs };
+            program_node* scores = &probs.get_dependency(0);
+            program_node* mask = nullptr;
+            float attention_scale = 1.0f;
+
+            if (scores->is_type<eltwise>() && scores->as<eltwise>().get_primitive()->mode == eltwise_mode::sum &&
+                can_be_fused(*scores)) {
+                auto& sum = scores->as<eltwise>();
+                auto sum_desc = sum.get_primitive();
+                if (sum.get_dependencies().size() != 2 || !sum_desc->coefficients.empty() || !sum_desc->stride.empty())
+                    return;
+
+                size_t scores_idx = is_scores(sum.get_dependency(0)) ? 0 : 1;
+                mask = &sum.get_dependency(1 - scores_idx);
+                if (sum.get_dependency(scores_idx).get_output_layout().size != sum.get_output_layout().size)
+                    return;
+
+                auto mask_type = mask->get_output_layout().data_type;
+                if (mask->get_output_layout().format.dimension() != 4 ||
+                    (mask_type != data_types::f32 && mask_type != data_types::f16))
+                    return;
+
+                fused_nodes.push_back(scores);
+                scores = &sum.get_dependency(scores_idx);
+            }
+
+            if ((scores->is_type<scale>() || scores->is_type<eltwise>()) && can_be_fused(*scores)) {
+                size_t scores_idx = 0;
+                if (scores->is_type<scale>()) {
+                    auto& mul = scores->as<scale>();
+                    if (mul.bias_term() || !get_scalar(mul.scale_in(), attention_scale))
+                        return;
+                } else {
+                    auto& mul = scores->as<eltwise>();
+                    if (mul.get_dependencies().size() != 2 || mul.get_primitive()->mode != eltwise_mode::prod ||
+                        !mul.get_primitive()->coefficients.empty() || !mul.get_primitive()->stride.empty())
+                        return;
+                    if (!get_scalar(mul.get_dependency(1), attention_scale)) {
+                        if (!get_scalar(mul.get_dependency(0), attention_scale))
+                            return;
+                        scores_idx = 1;
+                    }
+                }
+                fused_nodes.push_back(scores);
+                scores = &scores->get_dependency(scores_idx);
+            }
+
+            if (!scores->is_type<gemm>() || !can_be_fused(*scores))
+                return;
+
+            auto& qk = scores->as<gemm>();
+            if (qk.inputs_count() != 2 || qk.get_primitive()->transpose_input0)
+                return;
+
+            fused_nodes.push_back(scores);
+            attention_scale *= qk.get_primitive()->alpha;
+
+            auto& query = qk.input(0);
+            auto& key = qk.input(1);
+            auto& value = node.input(1);
+            if (!is_supported_input(query) || !is_supported_input(key) || !is_supported_input(value))
+                return;
+
+            // gemm broadcasts batches, attention doesn't
+            auto query_size = query.get_output_layout().size;
+            for (auto& input : { &key, &value }) {
+                auto size = input->get_output_layout().size;
+                if (size.batch[0] != query_size.batch[0] || size.feature[0] != query_size.feature[0])
+                    return;
+            }
+
+            std::vector<primitive_id> inputs = { query.id(), key.id(), value.id() };
+            if (mask)
+                inputs.push_back(mask->id());
+
+            auto attention_prim = std::make_shared<cldnn::attention>(node.id() + "_attention", inputs, output_type,
+                                                                     attention_scale, qk.get_primitive()->transpose_input1);
+            auto& attention = p.get_or_create(attention_prim);
+
+            p.add_optimized_primitive_info(node.id(), {attention.id()});
+            for (auto fused_node : fused_nodes)
+                p.add_optimized_primitive_info(fused_node->id(), {attention.id()});
+
+            p.add_connection(query, attention);
+            p.add_connection(key, attention);
+            p.add_connection(value, attention);
+            if (mask)
+                p.add_connection(*mask, attention);
+            p.replace_all_usages(node, attention);
+            p.get_processing_order().insert_next(&node, &attention);
+
+            p.remove_all_connections(node);
+            p.remove_if_dangling(node);
+            for (auto fused_node : fused_nodes) {
+                p.remove_all_connections(*fused_node);
+                p.remove_if_dangling(*fused_node);
+            }
+
+            attention.calc_output_layout();
+        });
+    }
+}
+
 void prepare_primitive_fusing::fuse_reorders(program_impl &p) {
     // This loop tries fusing several reorders one by one (if present) into one reorder
     auto itr = p.get_processing_order().begin();
@@ -340,11 +508,19 @@ void prepare_primitive_fusing::fuse_bias(program_impl &p) {
         } else if (replace_candidate.is_type<fully_connected>()) {
             auto& fc = replace_candidate.as<fully_connected>();
             auto desc = fc.get_primitive();
-            auto fc_with_bias_prim = std::make_shared<fully_connected>(desc->id + "_tmp",
-                                                                       desc->input[0],
-                                                                       desc->weights,
-                                                                       bias_name,
-                                                                       fc.get_output_layout().data_type);
+            auto fc_with_bias_prim = fc.compressed_weights() ?
+                std::make_shared<fully_connected>(desc->id + "_tmp",
+                                                  desc->input[0],
+                                                  desc->weights,
+                                                  bias_name,
+                                                  desc->decompression_scale,
+                                                  desc->decompression_zero_point,
+                                                  fc.get_output_layout().data_type) :
+                std::make_shared<fully_connected>(desc->id + "_tmp",
+                                                  desc->input[0],
+                                                  desc->weights,
+                                                  bias_name,
+                                                  fc.get_output_layout().data_type);
 
             auto& new_fc_node = p.get_or_create(fc_with_bias_prim);
             fuse_bias_f(fc, new_fc_node, bias_node, eltw_node);
@@ -454,6 +630,13 @@ void prepare_primitive_fusing::fuse_simple_primitives(program_impl &p) {
             return false;
         };
 
+        // LayerNorm: gamma/beta scale and eltwise ops are applied by the planar fp kernels right after normalization
+        auto mvn_supports_scale_shift_fusings = [&](mvn_node& node) -> bool {
+            auto in_fmt = node.get_dependency(0).get_output_layout().format;
+
+            return mvn_supports_fusings(node) || in_fmt == format::bfyx || in_fmt == format::bfzyx;
+        };
+
         auto pooling_supports_fusings = [](pooling_node& node) -> bool {
             auto pooling_mode = node.as<pooling>().get_primitive()->mode;
 
@@ -491,9 +674,11 @@ void prepare_primitive_fusing::fuse_simple_primitives(program_impl &p) {
             return false;
         };
 
-        auto eltwise_supports_fusings = [&](eltwise_node& node) -> bool {
+        // fs_b_yx_fsv32 kernel applies fused activation, scale and quantize, but fused eltwise would make
+        // the slow reference kernel to be selected
+        auto eltwise_supports_fusings = [&](eltwise_node& node, bool fuse_eltwise) -> bool {
             auto out_layout = node.get_output_layout();
-            if (out_layout.data_type == data_types::f16 && out_layout.size.batch[0] > 1 &&
+            if (fuse_eltwise && out_layout.data_type == data_types::f16 && out_layout.size.batch[0] > 1 &&
                 (_lo.get_optimization_attributes().fs_b_yx_fsv32_network || out_layout.format == format::fs_b_yx_fsv32)) {
                 return false;
             }
@@ -551,7 +736,7 @@ void prepare_primitive_fusing::fuse_simple_primitives(program_impl &p) {
             // Here we need to check that Eltwise already has fused ops to avoid missing Activation primitive in
             // case `Conv -> Eltwise -> Activation` which will be replaced via fused_conv_eltwise primitive later
             // without handling any fused ops
-            should_fuse |= input_data.is_type<eltwise>() && eltwise_supports_fusings(input_data.as<eltwise>()) && input_data.has_fused_primitives();
+            should_fuse |= input_data.is_type<eltwise>() && eltwise_supports_fusings(input_data.as<eltwise>(), false) && input_data.has_fused_primitives();
 
             if (!should_fuse)
                 return;
@@ -580,7 +765,7 @@ void prepare_primitive_fusing::fuse_simple_primitives(program_impl &p) {
 
             should_fuse |= input_data.is_type<resample>();
 
-            should_fuse |= input_data.is_type<mvn>() && mvn_supports_fusings(input_data.as<mvn>());
+            should_fuse |= input_data.is_type<mvn>() && mvn_supports_scale_shift_fusings(input_data.as<mvn>());
 
             should_fuse |= input_data.is_type<normalize>() &&
                           (input_data.get_dependency(0).get_output_layout().data_type == data_types::u8 ||
@@ -610,7 +795,7 @@ void prepare_primitive_fusing::fuse_simple_primitives(program_impl &p) {
 
             should_fuse |= input_data.is_type<scale>();
 
-            should_fuse |= input_data.is_type<eltwise>() && eltwise_supports_fusings(input_data.as<eltwise>());
+            should_fuse |= input_data.is_type<eltwise>() && eltwise_supports_fusings(input_data.as<eltwise>(), false);
 
             if (!should_fuse)
                 return;
@@ -700,7 +885,7 @@ void prepare_primitive_fusing::fuse_simple_primitives(program_impl &p) {
                            reduce_supports_fusings(input_data.as<reduce>())
                            && quantize_node.get_scale_shift_opt();
 
-            should_fuse |= input_data.is_type<eltwise>() && eltwise_supports_fusings(input_data.as<eltwise>()) && quantize_node.get_scale_shift_opt();
+            should_fuse |= input_data.is_type<eltwise>() && eltwise_supports_fusings(input_data.as<eltwise>(), false) && quantize_node.get_scale_shift_opt();
 
             should_fuse |= input_data.is_type<scale>() && quantize_node.get_scale_shift_opt();
 
@@ -729,14 +914,14 @@ void prepare_primitive_fusing::fuse_simple_primitives(program_impl &p) {
 
             for (size_t i = 0; i < parents.size(); i++) {
                 can_fuse_parents[i] = (parents[i]->is_type<convolution>() && conv_supports_fusings(parents[i]->as<convolution>())) ||
-                                      (parents[i]->is_type<mvn>() && mvn_supports_fusings(parents[i]->as<mvn>())) ||
+                                      (parents[i]->is_type<mvn>() && mvn_supports_scale_shift_fusings(parents[i]->as<mvn>())) ||
                                       (parents[i]->is_type<deconvolution>()) ||
                                       (parents[i]->is_type<permute>()) ||
                                       (parents[i]->is_type<space_to_depth>()) ||
                                       (parents[i]->is_type<gemm>() && gemm_supports_fusings(parents[i]->as<gemm>())) ||
                                       (parents[i]->is_type<batch_to_space>()) ||
                                       (parents[i]->is_type<space_to_batch>()) ||
-                                      (parents[i]->is_type<eltwise>() && eltwise_supports_fusings(parents[i]->as<eltwise>())) ||
+                                      (parents[i]->is_type<eltwise>() && eltwise_supports_fusings(parents[i]->as<eltwise>(), true)) ||
                                       (parents[i]->is_type<scale>()) ||
                                       (parents[i]->is_type<depth_to_space>() && dts_supports_fusings(parents[i]->as<depth_to_space>())) ||
                                       (parents[i]->is_type<reduce>() && reduce_supports_fusings(parents[i]->as<reduce>()));
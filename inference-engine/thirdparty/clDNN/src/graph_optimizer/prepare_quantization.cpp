@@ -20,15 +20,18 @@
 #include "api/binary_convolution.hpp"
 #include "api/scale.hpp"
 #include "api/pooling.hpp"
+#include "api/fully_connected.hpp"
 
 #include "quantize_inst.h"
 #include "binary_convolution_inst.h"
 #include "scale_inst.h"
 #include "eltwise_inst.h"
 #include "data_inst.h"
+#include "fully_connected_inst.h"
 #include "pass_manager.h"
 #include "program_helpers.h"
 #include <algorithm>
+#include <cmath>
 #include "to_string_utils.h"
 #include "error_handler.h"
 
@@ -795,10 +798,182 @@ void prepare_quantization::prepare_dequantize_merge(program_impl &p) {
     }
 }
 
+void prepare_quantization::prepare_compressed_weights(program_impl &p) {
+    auto itr = p.get_processing_order().begin();
+    while (itr != p.get_processing_order().end()) {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
+        // Replaces constant FakeQuantize on floating point weights of small batch fully connected layers
+        // with i8 weights and per output feature scale and zero point which are applied in the kernel.
+        // Such layers are bound by weights reading, so the bandwidth gain outweighs the dequantization cost.
+        auto compressed_fc_f = [&](fully_connected_node& fc_node) {
+            if (fc_node.compressed_weights())
+                return;
+
+            auto input_layout = fc_node.input().get_output_layout();
+            if (input_layout.data_type != data_types::f16 && input_layout.data_type != data_types::f32)
+                return;
+
+            if (input_layout.size.batch[0] > 16)
+                return;
+
+            auto& weights = fc_node.weights();
+            if (!weights.is_type<quantize>() || weights.get_users().size() != 1)
+                return;
+
+            auto& quantize_node = weights.as<quantize>();
+            auto levels = quantize_node.get_levels();
+            if (levels <= 2 || levels > 256 || quantize_node.get_dependencies().size() != 5)
+                return;
+
+            for (auto& dep : quantize_node.get_dependencies()) {
+                if (!dep->is_type<data>())
+                    return;
+            }
+
+            auto& mem_weights = quantize_node.get_dependency(0).as<data>().get_attached_memory();
+            auto weights_layout = mem_weights.get_layout();
+            if (weights_layout.data_type != data_types::f32 && weights_layout.data_type != data_types::f16)
+                return;
+
+            if ((weights_layout.format != format::bfyx && weights_layout.format != format::oiyx) ||
+                weights_layout.data_padding)
+                return;
+
+            int ofm = weights_layout.size.batch[0];
+            int per_ofm = static_cast<int>(weights_layout.count()) / ofm;
+
+            // Ranges are either per tensor or per output feature
+            std::vector<memory_impl*> ranges;
+            for (size_t i = 1; i < 5; i++) {
+                auto& mem = quantize_node.get_dependency(i).as<data>().get_attached_memory();
+                auto count = mem.get_layout().count();
+                if (count != 1 && count != static_cast<size_t>(ofm))
+                    return;
+                if (mem.get_layout().data_type != data_types::f32 && mem.get_layout().data_type != data_types::f16)
+                    return;
+                ranges.push_back(&mem);
+            }
+
+            auto read_values = [](memory_impl& mem) -> std::vector<float> {
+                std::vector<float> values(mem.get_layout().count());
+                if (mem.get_layout().data_type == data_types::f16) {
+                    mem_lock<uint16_t> data{mem};
+                    for (size_t i = 0; i < values.size(); i++)
+                        values[i] = half_to_float(data.data()[i]);
+                } else {
+                    mem_lock<float> data{mem};
+                    std::copy(data.data(), data.data() + values.size(), values.begin());
+                }
+                return values;
+            };
+
+            auto in_lo = read_values(*ranges[0]);
+            auto in_hi = read_values(*ranges[1]);
+            auto out_lo = read_values(*ranges[2]);
+            auto out_hi = read_values(*ranges[3]);
+            auto at = [](const std::vector<float>& v, int o) { return v.size() == 1 ? v[0] : v[o]; };
+
+            auto scale_layout = layout{data_types::f32, format::bfyx, tensor{1, ofm, 1, 1}};
+            auto mem_scale = p.get_engine().allocate_memory(scale_layout, mem_weights.get_net_id(), false);
+            auto mem_zp = p.get_engine().allocate_memory(scale_layout, mem_weights.get_net_id(), false);
+            auto mem_i8_weights = p.get_engine().allocate_memory({data_types::i8, weights_layout.format, weights_layout.size},
+                                                                 mem_weights.get_net_id(), false);
+            {
+                mem_lock<float> scale_data{mem_scale};
+                mem_lock<float> zp_data{mem_zp};
+                for (int o = 0; o < ofm; o++) {
+                    float scale = (at(out_hi, o) - at(out_lo, o)) / (levels - 1);
+                    if (scale == 0.f)
+                        return;
+                    // Quantized values are stored shifted by -128 to fit i8, so the shift is folded into zero point
+                    scale_data.data()[o] = scale;
+                    zp_data.data()[o] = -128.f - at(out_lo, o) / scale;
+                }
+            }
+
+            auto values = read_values(mem_weights);
+            {
+                mem_lock<int8_t> i8_data{mem_i8_weights};
+                for (int o = 0; o < ofm; o++) {
+                    float lo = at(in_lo, o);
+                    float hi = at(in_hi, o);
+                    for (int i = 0; i < per_ofm; i++) {
+                        float x = values[o * per_ofm + i];
+                        float q;
+                        if (x <= std::min(lo, hi))
+                            q = 0.f;
+                        else if (x > std::max(lo, hi))
+                            q = static_cast<float>(levels - 1);
+                        else
+                            q = std::round((x - lo) / (hi - lo) * (levels - 1));
+                        i8_data.data()[o * per_ofm + i] = static_cast<int8_t>(static_cast<int>(q) - 128);
+                    }
+                }
+            }
+
+            layout dummy_layout(data_types::f32, format::bfyx, tensor(1, 1, 1, 1));
+            float zero = 0.f;
+            auto weights_prim = std::make_shared<data>(fc_node.id() + "_compressed_weights", memory::attach(dummy_layout, &zero, 1));
+            auto scale_prim = std::make_shared<data>(fc_node.id() + "_decompression_scale", memory::attach(dummy_layout, &zero, 1));
+            auto zp_prim = std::make_shared<data>(fc_node.id() + "_decompression_zp", memory::attach(dummy_layout, &zero, 1));
+            auto& new_weights = p.get_or_create(weights_prim);
+            auto& new_scale = p.get_or_create(scale_prim);
+            auto& new_zp = p.get_or_create(zp_prim);
+            new_weights.as<data>().attach_memory(*mem_i8_weights);
+            new_scale.as<data>().attach_memory(*mem_scale);
+            new_zp.as<data>().attach_memory(*mem_zp);
+            p.get_inputs().push_back(&new_weights);
+            p.get_inputs().push_back(&new_scale);
+            p.get_inputs().push_back(&new_zp);
+
+            auto old_fc_prim = fc_node.get_primitive();
+            auto new_fc_prim = std::make_shared<fully_connected>(fc_node.id() + "_compressed",
+                                                                 old_fc_prim->input[0],
+                                                                 new_weights.id(),
+                                                                 old_fc_prim->bias,
+                                                                 new_scale.id(),
+                                                                 new_zp.id(),
+                                                                 fc_node.get_output_layout().data_type,
+                                                                 old_fc_prim->output_padding);
+
+            auto& new_fc_node = p.get_or_create(new_fc_prim);
+            auto quantize_id = quantize_node.id();
+
+            // New node copies the old dependencies, so quantize in the weights slot is swapped with compressed weights
+            // and decompression parameters are appended in the order of primitive parameters
+            p.replace(fc_node, new_fc_node);
+            p.remove_connection(quantize_node, new_fc_node);
+            new_fc_node.dependencies.insert(new_fc_node.dependencies.begin() + 1, &new_weights);
+            new_weights.users.push_back(&new_fc_node);
+            p.add_connection(new_scale, new_fc_node);
+            p.add_connection(new_zp, new_fc_node);
+            p.get_processing_order().insert(&new_fc_node, &new_weights);
+            p.get_processing_order().insert(&new_fc_node, &new_scale);
+            p.get_processing_order().insert(&new_fc_node, &new_zp);
+
+            // Remove FakeQuantize on weights together with its constant inputs
+            while (!quantize_node.get_dependencies().empty()) {
+                auto& dep = quantize_node.get_dependency(0);
+                p.remove_connection(dep, quantize_node);
+                p.remove_if_dangling(dep);
+            }
+            p.add_optimized_primitive_info(quantize_id, {new_fc_node.id()});
+            p.remove_if_dangling(quantize_node);
+
+            new_fc_node.recalc_output_layout();
+        };
+
+        program_helpers::do_for_types<fully_connected>(*node, compressed_fc_f);
+    }
+}
+
 void prepare_quantization::run(program_impl& p) {
     prepare_packed_quantize(p);
     prepare_scale_shift_opt(p);
     prepare_dequantize_merge(p);
     remove_fake_reorders(p);
     prepare_asymmetric_quantization(p);
+    prepare_compressed_weights(p);
 }
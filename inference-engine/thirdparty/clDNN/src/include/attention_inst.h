@@ -0,0 +1,55 @@
+/*
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "api_extension/attention.hpp"
+#include "primitive_inst.h"
+#include <string>
+
+namespace cldnn {
+template <>
+struct typed_program_node<attention> : public typed_program_node_base<attention> {
+    using parent = typed_program_node_base<attention>;
+
+public:
+    using parent::parent;
+
+    program_node& input(size_t idx = 0) const { return get_dependency(idx); }
+    program_node& query() const { return get_dependency(0); }
+    program_node& key() const { return get_dependency(1); }
+    program_node& value() const { return get_dependency(2); }
+    program_node& mask() const { return get_dependency(3); }
+    bool has_mask() const { return get_dependencies().size() == 4; }
+};
+
+using attention_node = typed_program_node<attention>;
+
+template <>
+class typed_primitive_inst<attention> : public typed_primitive_inst_base<attention> {
+    using parent = typed_primitive_inst_base<attention>;
+
+public:
+    static layout calc_output_layout(attention_node const& node);
+    static std::string to_string(attention_node const& node);
+
+public:
+    typed_primitive_inst(network_impl& network, attention_node const& node);
+};
+
+using attention_inst = typed_primitive_inst<attention>;
+
+}  // namespace cldnn
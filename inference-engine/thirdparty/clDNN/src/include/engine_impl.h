@@ -28,6 +28,7 @@
 #include <vector>
 #include <utility>
 #include <string>
+#include <map>
 
 namespace cldnn {
 namespace gpu {
@@ -76,7 +77,7 @@ public:
     refcounted_obj_ptr<program_impl> build_program(const std::set<std::shared_ptr<program_node>>& nodes,
                                                    const build_options& options,
                                                    bool is_internal);
-    void compile_program(program_impl& prog);
+    void compile_program(program_impl& prog, bool is_internal = false);
 
     refcounted_obj_ptr<network_impl> allocate_network(const program_impl& program,
                                                       uint16_t stream_id,
@@ -126,6 +127,7 @@ public:
 
     uint64_t get_max_used_device_memory() const { return _memory_pool.get_max_peak_device_memory_used(); }
     uint64_t get_used_device_memory() const { return _memory_pool.get_temp_memory_used(); }
+    std::map<std::string, uint64_t> get_memory_statistics() const;
 
     void dump_memory_pool(const program_impl& program, std::string& path, std::string& dependencies) {
         _memory_pool.dump_memory_pool(program, path, dependencies);
@@ -34,6 +34,9 @@ public:
     program_node& weights() const { return get_dependency(1); }
     program_node& bias() const { return get_dependency(2); }
     bool bias_term() const { return !get_primitive()->bias.empty(); }
+    bool compressed_weights() const { return !get_primitive()->decompression_scale.empty(); }
+    program_node& decompression_scale() const { return get_dependency(bias_term() ? 3 : 2); }
+    program_node& decompression_zero_point() const { return get_dependency(bias_term() ? 4 : 3); }
 };
 
 using fully_connected_node = typed_program_node<fully_connected>;
@@ -52,7 +55,11 @@ public:
     memory_impl& weights_memory() const { return dep_memory(1); }
     memory_impl& bias_memory() const { return dep_memory(2); }
 
+    memory_impl& decompression_scale_memory() const { return dep_memory(bias_term() ? 3 : 2); }
+    memory_impl& decompression_zero_point_memory() const { return dep_memory(bias_term() ? 4 : 3); }
+
     bool bias_term() const { return !argument.bias.empty(); }
+    bool compressed_weights() const { return !argument.decompression_scale.empty(); }
 };
 
 using fully_connected_inst = typed_primitive_inst<fully_connected>;
@@ -29,7 +29,7 @@ struct memory_impl : refcounted_obj<memory_impl> {
 
     virtual ~memory_impl() {
         if (_engine != nullptr && !_reused) {
-            _engine->get_memory_pool().subtract_memory_used(_bytes_count);
+            _engine->get_memory_pool().subtract_memory_used(_bytes_count, _type);
         }
     }
     virtual void* lock() = 0;
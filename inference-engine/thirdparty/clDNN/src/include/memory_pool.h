@@ -112,6 +112,10 @@ class memory_pool {
     engine_impl* _engine;
     std::atomic<uint64_t> _temp_memory_used;
     std::atomic<uint64_t> _max_peak_memory_used;
+    // Same counters split by allocation type, indexed with allocation_type values
+    static const size_t allocation_types_count = static_cast<size_t>(allocation_type::usm_device) + 1;
+    std::atomic<uint64_t> _temp_memory_used_by_type[allocation_types_count];
+    std::atomic<uint64_t> _max_peak_memory_used_by_type[allocation_types_count];
 
 public:
     explicit memory_pool(engine_impl& engine);
@@ -147,8 +151,10 @@ public:
 
     uint64_t get_temp_memory_used() const { return _temp_memory_used; }
     uint64_t get_max_peak_device_memory_used() const { return _max_peak_memory_used; }
-    void add_memory_used(size_t value);
-    void subtract_memory_used(size_t value);
+    uint64_t get_temp_memory_used(allocation_type type) const { return _temp_memory_used_by_type[static_cast<size_t>(type)]; }
+    uint64_t get_max_peak_memory_used(allocation_type type) const { return _max_peak_memory_used_by_type[static_cast<size_t>(type)]; }
+    void add_memory_used(size_t value, allocation_type type);
+    void subtract_memory_used(size_t value, allocation_type type);
 };
 
 }  // namespace cldnn
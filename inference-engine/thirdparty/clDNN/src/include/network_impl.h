@@ -56,6 +56,9 @@ public:
     void reset_execution(bool wait = true);
     void set_input_data(const primitive_id& id, memory_impl& data);
     void set_output_memory(const primitive_id& id, memory_impl& mem);
+    void set_execution_batch(uint32_t batch);
+    // Number of batches the node is computed for, 0 means all batches
+    uint32_t get_execution_batch(const program_node& node) const;
 
     void set_learning_rate(const float lr);
     float get_learning_rate();
@@ -100,6 +103,8 @@ private:
     bool _internal;
     bool _reset_arguments;
     float _learning_rate = static_cast<float>(0.00001);
+    uint32_t _execution_batch = 0;
+    uint32_t _full_batch = 0;
 
     std::map<primitive_id, std::shared_ptr<primitive_inst>> _primitives;
     std::vector<std::shared_ptr<primitive_inst>> _inputs;
@@ -108,11 +113,14 @@ private:
     std::list<std::shared_ptr<primitive_inst>> _data_outputs;
 
     std::unordered_map<primitive_id, event_impl::ptr> _events;
+    // Mutable data with the primitive whose event it takes after execution
+    std::vector<std::pair<primitive_id, primitive_id>> _mutable_data_events;
 
     void allocate_primitive_instance(program_node const& node);
     void transfer_memory_to_device(std::shared_ptr<primitive_inst> instance, program_node const& node);
     void allocate_mutable_data_for_streams(std::vector<std::shared_ptr<program_node>>& mutable_data_nodes);
     void add_to_exec_order(const primitive_id& id);
+    void build_mutable_data_events();
     std::shared_ptr<primitive_inst> find_in_internal_networks(const primitive_id& id);
     std::shared_ptr<primitive_inst> find_primitive(const primitive_id& id);
     void check_names();
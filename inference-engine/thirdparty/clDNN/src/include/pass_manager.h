@@ -165,6 +165,7 @@ private:
     void prepare_dequantize_merge(program_impl& p);
     void remove_fake_reorders(program_impl& p);
     void prepare_asymmetric_quantization(program_impl& p);
+    void prepare_compressed_weights(program_impl& p);
 };
 
 class prepare_conv_eltw_fusing : public base_pass {
@@ -197,6 +198,7 @@ public:
 private:
     void run(program_impl& p) override;
     void fuse_sigmoid_mul_to_swish(program_impl &p);
+    void fuse_attention(program_impl &p);
     void fuse_bias(program_impl &p);
     void fuse_reorders(program_impl& p);
     void fuse_activations(program_impl& p);
@@ -110,6 +110,8 @@ public:
 
     event_impl::ptr execute(const std::vector<event_impl::ptr>& events);
     void set_arguments();
+    // Sets arguments again only if memory of dependencies or output was replaced since they were set last time
+    void update_arguments();
     void cleanup();
     bool validate() const {
         if (_impl == nullptr)
@@ -172,6 +174,10 @@ protected:
         true;  // by default all primitives has valid inputs, exception is input_layout (see input_layout_inst)
     bool _has_mutable_input = false;
 
+    // Memory of dependencies followed by output memory the arguments were set with. References keep the objects alive,
+    // so a replaced memory can't be mistaken for a new one allocated at the same address
+    std::vector<memory_impl::ptr> _arguments_memory;
+
     memory_impl::ptr allocate_output();
     static std::vector<std::shared_ptr<primitive_inst>> build_exec_deps(
         std::vector<std::shared_ptr<primitive_inst>> const& mem_deps);
@@ -30,6 +30,7 @@
 #include <map>
 #include <utility>
 #include <set>
+#include <future>
 
 namespace cldnn {
 
@@ -221,6 +222,8 @@ public:
 
     void reset_program();
     uint32_t get_id() const { return prog_id; }
+    // starts building kernels of the given internal programs in the background
+    void start_kernels_warm_up(const std::vector<program_impl::ptr>& internal_programs);
 
 private:
     uint32_t prog_id = 0;
@@ -237,6 +240,8 @@ private:
     std::list<optimized_info> optimized;
     primitives_info prim_info;
     graph_optimizer_info optimizer_passes_info;
+    // must be declared after the members used by the warm-up to be destroyed (and waited for) first
+    std::future<void> kernels_warm_up;
 
     primitives_info get_current_stage_info() const;
     /*
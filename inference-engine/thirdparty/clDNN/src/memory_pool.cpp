@@ -47,9 +47,13 @@ memory_impl::ptr memory_pool::alloc_memory(const layout& layout, allocation_type
         throw std::runtime_error("exceeded max size of memory object allocation");
     }
 
-    add_memory_used(layout.bytes_count());
+    // Images are always cl_mem objects, whatever type was requested
+    const auto used_type = layout.format.is_image_2d() ? allocation_type::cl_mem : type;
+    add_memory_used(layout.bytes_count(), used_type);
 
-    if (_max_peak_memory_used > context->get_device_info().max_global_mem_size) {
+    // Allocations of released networks are not counted, so a failed network build doesn't block later allocations
+    if (_temp_memory_used > context->get_device_info().max_global_mem_size) {
+        subtract_memory_used(layout.bytes_count(), used_type);
         throw std::runtime_error("exceeded global device memory");
     }
 
@@ -393,6 +397,10 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
 }
 
 memory_pool::memory_pool(engine_impl& engine) : _engine(&engine), _temp_memory_used(0), _max_peak_memory_used(0) {
+    for (size_t i = 0; i < allocation_types_count; i++) {
+        _temp_memory_used_by_type[i] = 0;
+        _max_peak_memory_used_by_type[i] = 0;
+    }
 }
 
 void memory_pool::dump_memory_pool(const program_impl& program, std::string& path, std::string& dep) {
@@ -444,15 +452,22 @@ void memory_pool::color_graph(const program_impl& program) {
     }
 }
 
-void memory_pool::add_memory_used(size_t value) {
+void memory_pool::add_memory_used(size_t value, allocation_type type) {
     _temp_memory_used += value;
     if (_temp_memory_used > _max_peak_memory_used) {
         _max_peak_memory_used = _temp_memory_used.load();
     }
+
+    const auto idx = static_cast<size_t>(type);
+    _temp_memory_used_by_type[idx] += value;
+    if (_temp_memory_used_by_type[idx] > _max_peak_memory_used_by_type[idx]) {
+        _max_peak_memory_used_by_type[idx] = _temp_memory_used_by_type[idx].load();
+    }
 }
 
-void memory_pool::subtract_memory_used(size_t value) {
+void memory_pool::subtract_memory_used(size_t value, allocation_type type) {
     _temp_memory_used -= value;
+    _temp_memory_used_by_type[static_cast<size_t>(type)] -= value;
 }
 
 }  // namespace cldnn
@@ -75,6 +75,10 @@ void network::set_output_memory(const primitive_id& id, const memory& mem) const
     _impl->set_output_memory(id, *mem.get());
 }
 
+void network::set_execution_batch(uint32_t batch) const {
+    _impl->set_execution_batch(batch);
+}
+
 uint32_t network::get_id() {
     return _impl->get_id();
 }
@@ -400,6 +404,25 @@ void network_impl::set_output_memory(const primitive_id& id, memory_impl& mem) {
     output->set_output_memory(mem);
 }
 
+void network_impl::set_execution_batch(uint32_t batch) {
+    _full_batch = 0;
+    for (auto& input : _inputs)
+        _full_batch = std::max(_full_batch, static_cast<uint32_t>(input->output_memory().get_layout().size.batch[0]));
+
+    _execution_batch = batch < _full_batch ? batch : 0;
+}
+
+uint32_t network_impl::get_execution_batch(const program_node& node) const {
+    if (_execution_batch == 0)
+        return 0;
+
+    // Batch of nodes after reshapes may be unrelated to the batch of network inputs
+    if (node.get_output_layout().size.batch[0] != static_cast<int32_t>(_full_batch))
+        return 0;
+
+    return _execution_batch;
+}
+
 void cldnn::network_impl::check_names() {
     for (auto const& prim : _primitives) {
         if (find_in_internal_networks(prim.first) != nullptr)
@@ -488,6 +511,38 @@ void network_impl::build_exec_order() {
             add_to_exec_order(node->id());
         }
     }
+    build_mutable_data_events();
+}
+
+void network_impl::build_mutable_data_events() {
+    auto& processing_order = _program->get_processing_order();
+    for (auto& inst : processing_order) {
+        // Special handling for mutable data. The event should be the same as the user or dependency with highest
+        // processing_num as the mutable_data can be updated when is both user or dependency.
+        if (!inst->is_type<mutable_data>())
+            continue;
+
+        decltype(processing_order.get_processing_number(inst)) proc_num = 0;
+        const program_node* event_source = nullptr;
+        for (auto& user : inst->get_users()) {
+            auto user_proc_num = processing_order.get_processing_number(user);
+            if (user_proc_num > proc_num) {
+                event_source = user;
+                proc_num = user_proc_num;
+            }
+        }
+
+        for (auto& dep : inst->get_dependencies()) {
+            auto dep_proc_num = processing_order.get_processing_number(dep);
+            if (dep_proc_num > proc_num) {
+                event_source = dep;
+                proc_num = dep_proc_num;
+            }
+        }
+
+        if (event_source)
+            _mutable_data_events.emplace_back(inst->id(), event_source->id());
+    }
 }
 void network_impl::add_to_exec_order(const primitive_id& id) {
     auto inst = get_primitive(id);
@@ -542,9 +597,9 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
 #endif
 
         // If a node has mutable input or it's an output, then the input/output buffers might be changed
-        // So we need to set arguments on each execution.
+        // So we need to check them on each execution and set the arguments again if they were replaced.
         if (inst->has_mutable_input() || inst->is_output()) {
-            inst->set_arguments();
+            inst->update_arguments();
         }
         execute_primitive(inst, events);
 #ifdef DEBUG_DUMP_PATH
@@ -559,29 +614,8 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
 #endif
     }
 
-    for (auto& inst : _program->get_processing_order()) {
-        // Special handling for mutable data. The event should be the same as the user or dependency with highest
-        // processing_num as the mutable_data can be updated when is both user or dependency.
-        if (inst->is_type<mutable_data>()) {
-            decltype(_program->get_processing_order().get_processing_number(inst)) proc_num = 0;
-            for (auto& user : inst->get_users()) {
-                auto user_proc_num = _program->get_processing_order().get_processing_number(user);
-                if (user_proc_num > proc_num) {
-                    _events[inst->id()] = _events[user->id()];
-                    proc_num = user_proc_num;
-                }
-            }
-
-            if (!inst->get_dependencies().empty()) {
-                for (auto& dep : inst->get_dependencies()) {
-                    auto dep_proc_num = _program->get_processing_order().get_processing_number(dep);
-                    if (dep_proc_num > proc_num) {
-                        _events[inst->id()] = _events[dep->id()];
-                        proc_num = dep_proc_num;
-                    }
-                }
-            }
-        }
+    for (auto& mutable_data_event : _mutable_data_events) {
+        _events[mutable_data_event.first] = _events[mutable_data_event.second];
     }
 
     for (auto& dout : _data_outputs) {  // data primitives are not executed so if they are marked as output we need to add
@@ -675,7 +709,7 @@ std::vector<std::shared_ptr<primitive_inst>> network_impl::get_primitives(const
 
 void network_impl::execute_primitive(const std::shared_ptr<primitive_inst>& primitive,
                                      const std::vector<refcounted_obj_ptr<event_impl>>& events) {
-    auto id = primitive->id();
+    const auto& id = primitive->id();
     auto it = _events.find(id);
     bool found = (it != _events.end());
     CLDNN_ERROR_BOOL(id,
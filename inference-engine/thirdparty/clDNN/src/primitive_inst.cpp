@@ -81,7 +81,7 @@ void primitive_inst::set_output_memory(memory_impl& mem) {
 }
 
 event_impl::ptr primitive_inst::execute(const std::vector<event_impl::ptr>& events) {
-    const auto primitive_id = id();
+    const auto& primitive_id = id();
     CLDNN_ERROR_BOOL(primitive_id,
                      "Invalid/unset input",
                      !_has_valid_input,
@@ -94,7 +94,7 @@ event_impl::ptr primitive_inst::execute(const std::vector<event_impl::ptr>& even
     std::vector<event_impl::ptr> dependencies;
     dependencies.reserve(_exec_deps.size());
     for (auto& input : _exec_deps) {
-        auto id = input->id();
+        const auto& id = input->id();
         try {
             // if the requested event deos not exits it means that it has not been executed, so the processing_order is
             // wrong or synchronization failed.
@@ -110,13 +110,28 @@ event_impl::ptr primitive_inst::execute(const std::vector<event_impl::ptr>& even
 }
 
 void primitive_inst::set_arguments() {
-    const auto primitive_id = id();
+    const auto& primitive_id = id();
     CLDNN_ERROR_BOOL(primitive_id,
                      "Invalid/unset input",
                      !_has_valid_input,
                      "Cannot set arguments for primitive " + primitive_id + " with invalid/unset input");
 
     _impl->set_arguments(*this);
+
+    _arguments_memory.clear();
+    _arguments_memory.reserve(_deps.size() + 1);
+    for (auto& dep : _deps)
+        _arguments_memory.emplace_back(&dep->output_memory());
+    _arguments_memory.emplace_back(_output);
+}
+
+void primitive_inst::update_arguments() {
+    bool changed = _arguments_memory.size() != _deps.size() + 1 || _arguments_memory.back() != _output;
+    for (size_t i = 0; i < _deps.size() && !changed; i++)
+        changed = _arguments_memory[i].get() != &_deps[i]->output_memory();
+
+    if (changed)
+        set_arguments();
 }
 
 void primitive_inst::cleanup() {
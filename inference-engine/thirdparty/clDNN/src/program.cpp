@@ -128,9 +128,20 @@ program_impl::program_impl(engine_impl& engine_ref,
 }
 
 program_impl::~program_impl() {
+    if (kernels_warm_up.valid())
+        kernels_warm_up.wait();
     engine->get_context()->remove_program(prog_id);
 }
 
+void program_impl::start_kernels_warm_up(const std::vector<program_impl::ptr>& internal_programs) {
+    auto context = engine->get_context();
+    // Errors are not reported here: kernels which failed to build are built again and report the error when requested
+    kernels_warm_up = std::async(std::launch::async, [context, internal_programs]() {
+        for (auto& program : internal_programs)
+            context->get_kernels_cache(program->get_id()).build_all();
+    });
+}
+
 program_node& program_impl::get_node(primitive_id const& id) {
     try {
         return *nodes_map.at(id);
@@ -368,7 +379,7 @@ void program_impl::build_program(bool is_internal) {
     run_graph_compilation();
     { post_optimize_graph(is_internal); }
     prepare_memory_dependencies();
-    engine->compile_program(*this);
+    engine->compile_program(*this, is_internal);
 
     if (!is_internal)
         prim_info = get_current_stage_info();
@@ -45,6 +45,12 @@ layout reorder_inst::calc_output_layout(reorder_node const& node) {
     if (ifmt.is_nv12()) {
         auto data_size = tensor{ input_layout.size.batch[0], input_layout.size.feature[0] * 3,
                                  input_layout.size.spatial[0], input_layout.size.spatial[1] };
+        // conversion from two planes may resize the image
+        auto output_size = node.get_primitive()->output_size;
+        if (output_size.spatial[0] > 0 && output_size.spatial[1] > 0) {
+            data_size.spatial[0] = output_size.spatial[0];
+            data_size.spatial[1] = output_size.spatial[1];
+        }
         if (ofmt != ifmt)
             return layout(odt, ofmt, data_size, op);
 
@@ -0,0 +1,167 @@
+// Copyright (c) 2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+
+#include <api/engine.hpp>
+#include <api/input_layout.hpp>
+#include <api/memory.hpp>
+#include <api/data.hpp>
+#include <api/eltwise.hpp>
+#include <api/gemm.hpp>
+#include <api/scale.hpp>
+#include <api/softmax.hpp>
+#include <api/activation.hpp>
+#include <api/topology.hpp>
+#include <api/network.hpp>
+
+#include "test_utils/test_utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace {
+struct attention_test_params {
+    size_t batch;
+    size_t heads;
+    size_t seq_len;
+    size_t head_size;
+    float scale;
+    bool transpose_key;
+    bool eltwise_scale;
+    bool mask;
+};
+
+// query, key and value are [b, h, seq, head_size], key is transposed in memory if !transpose_key
+template <typename T>
+void test_attention(data_types dt, const attention_test_params& p, float tolerance) {
+    const auto& engine = get_test_engine();
+    const int b = static_cast<int>(p.batch), h = static_cast<int>(p.heads);
+    const int s = static_cast<int>(p.seq_len), d = static_cast<int>(p.head_size);
+
+    auto query = memory::allocate(engine, { dt, format::bfyx, { b, h, d, s } });
+    auto key = memory::allocate(engine, { dt, format::bfyx, p.transpose_key ? tensor{ b, h, d, s } : tensor{ b, h, s, d } });
+    auto value = memory::allocate(engine, { dt, format::bfyx, { b, h, d, s } });
+    auto mask = memory::allocate(engine, { data_types::f32, format::bfyx, { b, 1, s, 1 } });
+    auto scale_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 1, 1 } });
+
+    const size_t size = p.batch * p.heads * p.seq_len * p.head_size;
+    auto query_data = generate_random_1d<T>(size, -2, 2);
+    auto key_data = generate_random_1d<T>(size, -2, 2);
+    auto value_data = generate_random_1d<T>(size, -2, 2);
+    std::vector<float> mask_data(p.batch * p.seq_len, 0.f);
+    for (size_t bi = 0; bi < p.batch; ++bi)
+        for (size_t ki = p.seq_len - bi - 1; ki < p.seq_len; ++ki)
+            mask_data[bi * p.seq_len + ki] = -10000.f;
+    set_values(query, query_data);
+    set_values(key, key_data);
+    set_values(value, value_data);
+    set_values(mask, mask_data);
+    set_values(scale_mem, { p.scale });
+
+    topology topology(
+        input_layout("query", query.get_layout()),
+        input_layout("key", key.get_layout()),
+        input_layout("value", value.get_layout()),
+        data("scale_data", scale_mem),
+        gemm("gemm_qk", { "query", "key" }, data_types::f32, false, p.transpose_key));
+    if (p.eltwise_scale)
+        topology.add(eltwise("scores_scaled", { "gemm_qk", "scale_data" }, eltwise_mode::prod));
+    else
+        topology.add(scale("scores_scaled", "gemm_qk", "scale_data"));
+    std::string scores = "scores_scaled";
+    if (p.mask) {
+        topology.add(input_layout("mask", mask.get_layout()));
+        topology.add(eltwise("scores_masked", { scores, "mask" }, eltwise_mode::sum));
+        scores = "scores_masked";
+    }
+    topology.add(softmax("probs", scores, softmax::normalize_x));
+    topology.add(gemm("gemm_pv", { "probs", "value" }, data_types::f32));
+    topology.add(activation("output", "gemm_pv", activation_func::linear, { 1.f, 0.f }));
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    network network(engine, topology, options);
+    network.set_input_data("query", query);
+    network.set_input_data("key", key);
+    network.set_input_data("value", value);
+    if (p.mask)
+        network.set_input_data("mask", mask);
+    auto outputs = network.execute();
+
+    auto executed = network.get_executed_primitive_ids();
+    EXPECT_NE(std::find(executed.begin(), executed.end(), "gemm_pv_attention"), executed.end());
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "probs"), executed.end());
+
+    auto output = outputs.at("output").get_memory();
+    auto output_ptr = output.pointer<float>();
+    ASSERT_EQ(output_ptr.size(), size);
+
+    auto key_at = [&](size_t bh, size_t k, size_t i) -> float {
+        return static_cast<float>(p.transpose_key ? key_data[(bh * p.seq_len + k) * p.head_size + i]
+                                                  : key_data[(bh * p.head_size + i) * p.seq_len + k]);
+    };
+
+    for (size_t bh = 0; bh < p.batch * p.heads; ++bh) {
+        for (size_t q = 0; q < p.seq_len; ++q) {
+            std::vector<float> probs(p.seq_len);
+            for (size_t k = 0; k < p.seq_len; ++k) {
+                float dot = 0.f;
+                for (size_t i = 0; i < p.head_size; ++i)
+                    dot += static_cast<float>(query_data[(bh * p.seq_len + q) * p.head_size + i]) * key_at(bh, k, i);
+                probs[k] = dot * p.scale + (p.mask ? mask_data[bh / p.heads * p.seq_len + k] : 0.f);
+            }
+            float max_val = *std::max_element(probs.begin(), probs.end());
+            float sum = 0.f;
+            for (auto& v : probs) {
+                v = std::exp(v - max_val);
+                sum += v;
+            }
+            for (size_t i = 0; i < p.head_size; ++i) {
+                float expected = 0.f;
+                for (size_t k = 0; k < p.seq_len; ++k)
+                    expected += probs[k] / sum * static_cast<float>(value_data[(bh * p.seq_len + k) * p.head_size + i]);
+                ASSERT_NEAR(expected, output_ptr[(bh * p.seq_len + q) * p.head_size + i], tolerance)
+                    << "bh=" << bh << " q=" << q << " i=" << i;
+            }
+        }
+    }
+}
+}  // namespace
+
+TEST(attention_gpu, fp32_scale_mask) {
+    test_attention<float>(data_types::f32, { 2, 2, 37, 24, 0.2f, true, false, true }, 1e-4f);
+}
+
+TEST(attention_gpu, fp32_eltwise_scale_key_not_transposed) {
+    test_attention<float>(data_types::f32, { 1, 3, 20, 64, 0.125f, false, true, false }, 1e-4f);
+}
+
+TEST(attention_gpu, fp32_long_sequence) {
+    test_attention<float>(data_types::f32, { 1, 2, 130, 16, 0.25f, true, true, true }, 1e-4f);
+}
+
+TEST(attention_gpu, fp16_scale_mask) {
+    test_attention<FLOAT16>(data_types::f16, { 2, 4, 64, 64, 0.125f, true, false, true }, 1e-2f);
+}
+
+TEST(attention_gpu, int8_scale_mask) {
+    test_attention<int8_t>(data_types::i8, { 2, 2, 33, 32, 0.05f, true, false, true }, 1e-4f);
+}
@@ -227,6 +227,96 @@ TEST(cl_mem_check, check_2_inputs) {
     checkStatus(clReleaseMemObject(nv12_image_plane_y), "clReleaseMemObject");
 }
 
+TEST(cl_mem_check, check_2_inputs_resize) {
+    auto ocl_instance = std::make_shared<OpenCL>();
+    int width = 224;
+    int height = 224;
+    int out_width = width / 2;
+    int out_height = height / 2;
+    cl_int err;
+
+    auto data = createSampleData(width, height);
+    cl_image_format image_format;
+    image_format.image_channel_order = CL_R;
+    image_format.image_channel_data_type = CL_UNORM_INT8;
+    cl_image_desc image_desc = { CL_MEM_OBJECT_IMAGE2D, (size_t)width, (size_t)height, 0,
+                                 0, 0, 0, 0, 0, NULL };
+
+    cl_mem nv12_image_plane_y = clCreateImage(ocl_instance->_context.get(), CL_MEM_READ_WRITE, &image_format, &image_desc, NULL, &err);
+    checkStatus(err, "Creating nv12 image plane_y failed");
+
+    image_format.image_channel_order = CL_RG;
+    image_desc.image_width = width / 2;
+    image_desc.image_height = height / 2;
+    image_desc.image_depth = 1;
+
+    cl_mem nv12_image_plane_uv = clCreateImage(ocl_instance->_context.get(), CL_MEM_READ_WRITE, &image_format, &image_desc, NULL, &err);
+    checkStatus(err, "Creating nv12 image plane_uv failed");
+
+    size_t origin[3] = { 0, 0, 0 };
+    size_t y_region[3] = { (size_t)width, (size_t)height, 1 };
+    size_t uv_region[3] = { (size_t)width / 2, (size_t)height / 2, 1 };
+
+    err = clEnqueueWriteImage(ocl_instance->_queue.get(), nv12_image_plane_y, true, origin, y_region, 0, 0, &data[0], 0, NULL, NULL);
+    checkStatus(err, "Writing nv12 image plane_y failed");
+
+    err = clEnqueueWriteImage(ocl_instance->_queue.get(), nv12_image_plane_uv, true, origin, uv_region, 0, 0, &data[width * height], 0, NULL, NULL);
+    checkStatus(err, "Writing nv12 image plane_uv failed");
+
+    device_query query(static_cast<void*>(ocl_instance->_context.get()));
+    auto devices = query.get_available_devices();
+
+    auto engine_config = cldnn::engine_configuration();
+    engine engine(devices.begin()->second, engine_config);
+
+    auto input = input_layout("input", { data_types::i8, format::nv12, {1,1,height,width} });
+    auto input2 = input_layout("input2", { data_types::i8, format::nv12, {1,1,height / 2,width / 2} });
+    auto output_format = cldnn::format::bfyx;
+    layout output_layout(data_types::f32, output_format, { 1,3,out_height,out_width });
+    auto input_memory = cldnn::memory::share_image(engine, input.layout, nv12_image_plane_y,  0);
+    auto input_memory2 = cldnn::memory::share_image(engine,  input2.layout, nv12_image_plane_uv, 0);
+
+    topology topology;
+    topology.add(input);
+    topology.add(input2);
+    topology.add(reorder("reorder", "input", "input2", output_layout));
+
+    network network(engine, topology);
+    network.set_input_data("input", input_memory);
+    network.set_input_data("input2", input_memory2);
+
+    auto outputs = network.execute();
+
+    // downscaling by 2 samples the middle of each 2x2 block of the Y plane and the center of a UV pixel
+    std::vector<float> reference_results(out_width * out_height * 3);
+    for (int i = 0; i < out_height; i++) {
+        for (int j = 0; j < out_width; j++) {
+            float y_comp = (data[2 * i * width + 2 * j] + data[2 * i * width + 2 * j + 1] +
+                            data[(2 * i + 1) * width + 2 * j] + data[(2 * i + 1) * width + 2 * j + 1]) / 4.f;
+            int u_comp = data[width * height + i * width + 2 * j];
+            int v_comp = data[width * height + i * width + 2 * j + 1];
+
+            float B = (1.164f * (y_comp - 16) + 1.596f * (float)(v_comp - 128));
+            float G = (1.164f * (y_comp - 16) - 0.813f * (float)(v_comp - 128) - 0.391f * (u_comp - 128));
+            float R = (1.164f * (y_comp - 16) + 2.018f * (float)(u_comp - 128));
+
+            reference_results[j + out_width * i] = std::min(std::max(R, 0.f), 255.f);
+            reference_results[j + out_width * i + out_width * out_height] = std::min(std::max(G, 0.f), 255.f);
+            reference_results[j + out_width * i + out_width * out_height * 2] = std::min(std::max(B, 0.f), 255.f);
+        }
+    }
+
+    auto output_prim = outputs.begin()->second.get_memory();
+    EXPECT_EQ(output_prim.get_layout().size, output_layout.size);
+    auto output_ptr = output_prim.pointer<float>();
+    int size = out_width * out_height * 3;
+    for (auto i = 0; i < size; i++) {
+        EXPECT_NEAR(reference_results[i], output_ptr[i], 1.001f);
+    }
+    checkStatus(clReleaseMemObject(nv12_image_plane_uv), "clReleaseMemObject");
+    checkStatus(clReleaseMemObject(nv12_image_plane_y), "clReleaseMemObject");
+}
+
 TEST(cl_mem_check, check_input) {
     auto ocl_instance = std::make_shared<OpenCL>();
     int width = 224;
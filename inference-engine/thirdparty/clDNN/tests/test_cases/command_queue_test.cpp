@@ -21,6 +21,8 @@
 #include <api/input_layout.hpp>
 #include "test_utils/test_utils.h"
 #include "api/arg_max_min.hpp"
+#include "api/activation.hpp"
+#include "api/eltwise.hpp"
 
 using namespace cldnn;
 using namespace tests;
@@ -130,4 +132,41 @@ TEST(command_queue_test, test_priority_and_throttle_hints) {
             throttle_mode_types::low);
     cldnn::engine engine(configuration);
     exexute_network(engine);
-}
\ No newline at end of file
+}
+TEST(command_queue_test, test_parallel_branches) {
+    engine_configuration configuration =
+        engine_configuration(
+            false,          // profiling
+            false,          // decorate_kernel_names
+            false,          // dump_custom_program
+            "",             // options
+            "",             // single_kernel
+            true);          // primitives_parallelisation
+    cldnn::engine engine(configuration);
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 2, 2, 2 } });
+    vector<float> input_vec = { -2.f, -1.f, 0.f, 1.f, 2.f, 3.f, -4.f, 5.f };
+    set_values(input, input_vec);
+
+    // two independent branches joined by an eltwise, no barrier between the branches is required
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu", "input", activation_func::relu));
+    topology.add(activation("abs", "input", activation_func::abs));
+    topology.add(activation("linear", "abs", activation_func::linear, { 2.f, 1.f }));
+    topology.add(eltwise("sum", "relu", "linear", eltwise_mode::sum));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+
+    // the second execution checks that events from the previous one are not waited for incorrectly
+    for (int run = 0; run < 2; ++run) {
+        auto outputs = network.execute();
+        auto output = outputs.at("sum").get_memory();
+        auto output_ptr = output.pointer<float>();
+        for (size_t i = 0; i < input_vec.size(); ++i) {
+            float expected = std::max(0.f, input_vec[i]) + 2.f * std::abs(input_vec[i]) + 1.f;
+            EXPECT_FLOAT_EQ(expected, output_ptr[i]);
+        }
+    }
+}
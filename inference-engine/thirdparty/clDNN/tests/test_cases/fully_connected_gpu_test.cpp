@@ -304,6 +304,111 @@ TEST(fully_connected_gpu, no_biases_int8) {
     EXPECT_EQ(-52.0f, output_ptr[3]);
 }
 
+TEST(fully_connected_gpu, compressed_weights_fake_quantize) {
+    // FakeQuantize on weights is replaced with i8 weights dequantized in the kernel when data is optimized,
+    // the result must match the network where quantized weights are computed as constants
+    const auto& engine = get_test_engine();
+
+    const int in_B = 2;
+    const int in_F = 64;
+    const int W_B = 32;
+    const int levels = 255;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { in_B, in_F, 1, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { W_B, in_F, 1, 1 } });
+    auto bias = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, W_B, 1 } });
+    auto input_low = memory::allocate(engine, { data_types::f32, format::bfyx, { W_B, 1, 1, 1 } });
+    auto input_high = memory::allocate(engine, { data_types::f32, format::bfyx, { W_B, 1, 1, 1 } });
+    auto output_low = memory::allocate(engine, { data_types::f32, format::bfyx, { W_B, 1, 1, 1 } });
+    auto output_high = memory::allocate(engine, { data_types::f32, format::bfyx, { W_B, 1, 1, 1 } });
+
+    auto ranges = generate_random_1d<float>(W_B, 1, 2);
+    std::vector<float> low(W_B), high(W_B);
+    for (int i = 0; i < W_B; i++) {
+        low[i] = -ranges[i];
+        high[i] = ranges[i];
+    }
+
+    set_values(input, generate_random_1d<float>(in_B * in_F, -1, 1));
+    set_values(weights, generate_random_1d<float>(W_B * in_F, -2, 2));
+    set_values(bias, generate_random_1d<float>(W_B, -1, 1));
+    set_values(input_low, low);
+    set_values(input_high, high);
+    set_values(output_low, low);
+    set_values(output_high, high);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("bias", bias),
+        data("in_lo", input_low),
+        data("in_hi", input_high),
+        data("out_lo", output_low),
+        data("out_hi", output_high),
+        quantize("weights_quantized", "weights", "in_lo", "in_hi", "out_lo", "out_hi", levels, data_types::f32),
+        fully_connected("fc", "input", "weights_quantized", "bias"),
+        reorder("output", "fc", format::bfyx, data_types::f32)
+    );
+
+    auto execute = [&](bool optimize_data) {
+        build_options build_opt;
+        build_opt.set_option(build_option::optimize_data(optimize_data));
+        network network(engine, topology, build_opt);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+        auto output = outputs.at("output").get_memory().pointer<float>();
+        return std::vector<float>(output.begin(), output.end());
+    };
+
+    auto reference = execute(false);
+    auto compressed = execute(true);
+
+    ASSERT_EQ(reference.size(), compressed.size());
+    for (size_t i = 0; i < reference.size(); i++) {
+        EXPECT_NEAR(reference[i], compressed[i], 2e-2f) << "i = " << i;
+    }
+}
+
+TEST(fully_connected_gpu, execution_batch) {
+    // Network compiled for 4 batches computes the first 2 of them the same way as a full execution
+    const auto& engine = get_test_engine();
+
+    const int in_B = 4;
+    const int in_F = 32;
+    const int W_B = 16;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { in_B, in_F, 1, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { W_B, in_F, 1, 1 } });
+    auto bias = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, W_B, 1 } });
+
+    auto input_data = generate_random_1d<float>(in_B * in_F, -1, 1);
+    set_values(input, input_data);
+    set_values(weights, generate_random_1d<float>(W_B * in_F, -1, 1));
+    set_values(bias, generate_random_1d<float>(W_B, -1, 1));
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("bias", bias),
+        fully_connected("fc", "input", "weights", "bias")
+    );
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto full_outputs = network.execute();
+    auto full = full_outputs.at("fc").get_memory().pointer<float>();
+    std::vector<float> reference(full.begin(), full.end());
+
+    network.set_execution_batch(2);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+    auto limited = outputs.at("fc").get_memory().pointer<float>();
+
+    for (size_t i = 0; i < 2 * W_B; i++) {
+        EXPECT_FLOAT_EQ(reference[i], limited[i]) << "i = " << i;
+    }
+}
+
 TEST(fully_connected_gpu, xb_f32_batch_1) {
     //  Input  : 3x1
     //  Output : 4x1
@@ -987,3 +987,143 @@ TEST(gather_gpu_fp32, 322_axisF) {
         EXPECT_EQ(expected_results[i], output_ptr[i]) << i;
     }
 }
+
+TEST(gather_gpu_fp16, embedding_axisB) {
+    //  Dictionary : 10x64x1x1
+    //  Indexes : 1x6x1x1
+    //  Axis : 0
+    //  Output : 1x6x1x64
+    //  Whole rows of the dictionary are copied
+
+    engine engine;
+
+    const int vocabulary = 10;
+    const int embedding = 64;
+    auto input1 = memory::allocate(engine, { data_types::f16, format::bfyx, { vocabulary, embedding, 1, 1 } }); // Dictionary
+    auto input2 = memory::allocate(engine, { data_types::i32, format::bfyx, { 1, 6, 1, 1 } }); // Indexes
+    auto axis = cldnn::gather::gather_axis::along_b;
+
+    std::vector<FLOAT16> dictionary;
+    for (int i = 0; i < vocabulary * embedding; i++)
+        dictionary.push_back(FLOAT16(static_cast<float>(i)));
+    set_values(input1, dictionary);
+
+    const std::vector<int32_t> indices = { 9, 0, 3, 3, 7, 1 };
+    set_values(input2, indices);
+
+    topology topology;
+    topology.add(input_layout("InputDictionary", input1.get_layout()));
+    topology.add(input_layout("InputText", input2.get_layout()));
+    topology.add(
+        gather("gather", "InputDictionary", "InputText", axis, format::bfyx, tensor(1, 6, 1, embedding))
+    );
+
+    network network(engine, topology);
+
+    network.set_input_data("InputDictionary", input1);
+    network.set_input_data("InputText", input2);
+
+    auto outputs = network.execute();
+
+    auto output = outputs.at("gather").get_memory();
+    auto output_ptr = output.pointer<uint16_t>();
+
+    for (size_t i = 0; i < indices.size(); ++i) {
+        for (int e = 0; e < embedding; ++e) {
+            EXPECT_EQ(static_cast<float>(indices[i] * embedding + e), float16_to_float32(output_ptr[i * embedding + e]));
+        }
+    }
+}
+
+TEST(gather_gpu_int8, embedding_axisB) {
+    //  Dictionary : 5x32x1x1
+    //  Indexes : 1x4x1x1
+    //  Axis : 0
+    //  Output : 1x4x1x32
+
+    engine engine;
+
+    const int vocabulary = 5;
+    const int embedding = 32;
+    auto input1 = memory::allocate(engine, { data_types::i8, format::bfyx, { vocabulary, embedding, 1, 1 } }); // Dictionary
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 4, 1, 1 } }); // Indexes
+    auto axis = cldnn::gather::gather_axis::along_b;
+
+    std::vector<int8_t> dictionary;
+    for (int i = 0; i < vocabulary * embedding; i++)
+        dictionary.push_back(static_cast<int8_t>(i - 80));
+    set_values(input1, dictionary);
+
+    const std::vector<float> indices = { 4.f, 2.f, 0.f, 2.f };
+    set_values(input2, indices);
+
+    topology topology;
+    topology.add(input_layout("InputDictionary", input1.get_layout()));
+    topology.add(input_layout("InputText", input2.get_layout()));
+    topology.add(
+        gather("gather", "InputDictionary", "InputText", axis, format::bfyx, tensor(1, 4, 1, embedding))
+    );
+
+    network network(engine, topology);
+
+    network.set_input_data("InputDictionary", input1);
+    network.set_input_data("InputText", input2);
+
+    auto outputs = network.execute();
+
+    auto output = outputs.at("gather").get_memory();
+    auto output_ptr = output.pointer<int8_t>();
+
+    for (size_t i = 0; i < indices.size(); ++i) {
+        for (int e = 0; e < embedding; ++e) {
+            EXPECT_EQ(dictionary[static_cast<int>(indices[i]) * embedding + e], output_ptr[i * embedding + e]);
+        }
+    }
+}
+
+TEST(gather_gpu_fp32, b_fs_yx_fsv16_axisB) {
+    //  Dictionary : 4x16x2x2 in b_fs_yx_fsv16
+    //  Indexes : 3x1x1x1
+    //  Axis : 0
+    //  Output : 3x16x2x2 in b_fs_yx_fsv16, gathered without reorders
+
+    engine engine;
+
+    const int batch_size = 16 * 2 * 2;
+    auto input1 = memory::allocate(engine, { data_types::f32, format::b_fs_yx_fsv16, { 4, 16, 2, 2 } }); // Dictionary
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 3, 1, 1, 1 } }); // Indexes
+    auto axis = cldnn::gather::gather_axis::along_b;
+
+    std::vector<float> dictionary;
+    for (int i = 0; i < 4 * batch_size; i++)
+        dictionary.push_back(static_cast<float>(i));
+    set_values(input1, dictionary);
+
+    const std::vector<float> indices = { 2.f, 0.f, 3.f };
+    set_values(input2, indices);
+
+    topology topology;
+    topology.add(input_layout("InputDictionary", input1.get_layout()));
+    topology.add(input_layout("InputText", input2.get_layout()));
+    topology.add(
+        gather("gather", "InputDictionary", "InputText", axis, format::b_fs_yx_fsv16, tensor(3, 16, 2, 2))
+    );
+
+    network network(engine, topology);
+
+    network.set_input_data("InputDictionary", input1);
+    network.set_input_data("InputText", input2);
+
+    auto outputs = network.execute();
+
+    auto output = outputs.at("gather").get_memory();
+    EXPECT_EQ(output.get_layout().format, format::b_fs_yx_fsv16);
+    auto output_ptr = output.pointer<float>();
+
+    // batches of a blocked layout are contiguous, so they are compared in memory order
+    for (size_t i = 0; i < indices.size(); ++i) {
+        for (int j = 0; j < batch_size; ++j) {
+            EXPECT_EQ(dictionary[static_cast<int>(indices[i]) * batch_size + j], output_ptr[i * batch_size + j]);
+        }
+    }
+}
@@ -569,3 +569,72 @@ TEST(memory_pool, add_mem_dep_test) {
     EXPECT_EQ(out2_ptr[2], 7.0f);
     EXPECT_EQ(out2_ptr[3], 8.0f);
 }
+
+TEST(memory_pool, arguments_follow_replaced_input_and_output_memory) {
+    // Kernel arguments are kept between executions, so replaced input and output memory must be noticed
+    const auto& engine = get_test_engine();
+
+    auto input_memory1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+    auto input_memory2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+    auto output_memory = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+    set_values(input_memory1, { -1.0f, 2.0f, -3.0f, 4.0f });
+    set_values(input_memory2, { 5.0f, -6.0f, 7.0f, -8.0f });
+
+    topology topology(
+        input_layout("input", input_memory1.get_layout()),
+        activation("abs", "input", activation_func::abs),
+        activation("out", "abs", activation_func::negative)
+    );
+
+    network network(engine, topology);
+
+    network.set_input_data("input", input_memory1);
+    auto outputs = network.execute();
+    auto out1_ptr = outputs.at("out").get_memory().pointer<float>();
+    EXPECT_EQ(out1_ptr[0], -1.0f);
+    EXPECT_EQ(out1_ptr[3], -4.0f);
+
+    network.set_input_data("input", input_memory2);
+    network.set_output_memory("out", output_memory);
+    outputs = network.execute();
+    auto out2 = outputs.at("out").get_memory();
+    EXPECT_TRUE(out2 == output_memory);
+
+    auto out2_ptr = out2.pointer<float>();
+    EXPECT_EQ(out2_ptr[0], -5.0f);
+    EXPECT_EQ(out2_ptr[1], -6.0f);
+    EXPECT_EQ(out2_ptr[2], -7.0f);
+    EXPECT_EQ(out2_ptr[3], -8.0f);
+}
+
+TEST(memory_pool, memory_statistics_by_allocation_type) {
+    const cldnn::engine engine;// here we need new engine
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 4, 1, 1 } });
+    set_values(input, { -1.f, 2.f, -3.f, 4.f });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu", "input", activation_func::relu));
+    topology.add(activation("relu1", "relu", activation_func::relu));
+
+    uint64_t network_current = 0;
+    {
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        network.execute();
+
+        auto stats = engine.get_memory_statistics();
+        network_current = stats.at("total_current");
+        EXPECT_EQ(stats.at("total_current"), engine.get_temp_used_device_memory_size());
+        EXPECT_EQ(stats.at("total_peak"), engine.get_max_used_device_memory_size());
+        EXPECT_EQ(stats.at("cl_mem_current") + stats.at("usm_host_current") +
+                  stats.at("usm_shared_current") + stats.at("usm_device_current"),
+                  stats.at("total_current"));
+    }
+
+    // Memory of released network is not counted anymore, peak values are kept
+    auto stats = engine.get_memory_statistics();
+    EXPECT_LT(stats.at("total_current"), network_current);
+    EXPECT_GE(stats.at("total_peak"), network_current);
+}
@@ -836,3 +836,63 @@ TEST(permute_gpu_f32, basic_bfzyx_permute_0_2_3_4_1)
     }
 
 }
+
+// shapes big enough to be permuted through local memory tiles
+static void permute_tile_test(const tensor& in_size, format fmt, const std::vector<uint16_t>& permute_order) {
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, in_size });
+    auto input_data = generate_random_1d<float>(in_size.count(), -10, 10);
+    set_values(input, input_data);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        reorder("reorder", "input", fmt, data_types::f32),
+        permute("permute", "reorder", permute_order),
+        reorder("reorder_out", "permute", format::bfyx, data_types::f32));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    ASSERT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "reorder_out");
+
+    // sizes and coordinates are in b, f, x, y order, the same as the permute order refers to
+    const std::vector<int> in_sizes = { in_size.batch[0], in_size.feature[0], in_size.spatial[0], in_size.spatial[1] };
+    std::vector<int> out_sizes(4);
+    for (size_t i = 0; i < 4; i++)
+        out_sizes[i] = in_sizes[permute_order[i]];
+
+    auto bfyx_offset = [](const std::vector<int>& sizes, const std::vector<int>& coords) {
+        return ((coords[0] * sizes[1] + coords[1]) * sizes[3] + coords[3]) * sizes[2] + coords[2];
+    };
+
+    auto output = outputs.begin()->second.get_memory();
+    auto output_ptr = output.pointer<float>();
+    std::vector<int> in_coords(4), out_coords(4);
+    for (in_coords[0] = 0; in_coords[0] < in_sizes[0]; in_coords[0]++)
+    for (in_coords[1] = 0; in_coords[1] < in_sizes[1]; in_coords[1]++)
+    for (in_coords[3] = 0; in_coords[3] < in_sizes[3]; in_coords[3]++)
+    for (in_coords[2] = 0; in_coords[2] < in_sizes[2]; in_coords[2]++) {
+        for (size_t i = 0; i < 4; i++)
+            out_coords[i] = in_coords[permute_order[i]];
+        ASSERT_EQ(input_data[bfyx_offset(in_sizes, in_coords)], output_ptr[bfyx_offset(out_sizes, out_coords)]);
+    }
+}
+
+TEST(permute_gpu_f32, tile_bfyx_permute_0_1_3_2) {
+    permute_tile_test({ 2, 3, 35, 20 }, format::bfyx, { 0, 1, 3, 2 });
+}
+
+TEST(permute_gpu_f32, tile_bfyx_permute_0_2_3_1) {
+    permute_tile_test({ 1, 24, 17, 9 }, format::bfyx, { 0, 2, 3, 1 });
+}
+
+TEST(permute_gpu_f32, tile_bfyx_permute_0_3_1_2) {
+    permute_tile_test({ 2, 40, 33, 3 }, format::bfyx, { 0, 3, 1, 2 });
+}
+
+TEST(permute_gpu_f32, tile_b_fs_yx_fsv16_permute_0_2_3_1) {
+    permute_tile_test({ 1, 20, 18, 5 }, format::b_fs_yx_fsv16, { 0, 2, 3, 1 });
+}
@@ -702,6 +702,39 @@ TEST_P(general_reduce_gpu_f32_f32, base) { execute(); }
                             TestParamType_general_reduce_gpu(17, 4, 1, 1, 12, 15, format::bfyx, reduce_mode::mean, {reduce::along_b}, "reduce_ref", true, data_types::f32, false, data_types::f32)
                         ), general_reduce_gpu::PrintToStringParamName);
 
+ INSTANTIATE_TEST_CASE_P(reduce_gpu_bfyx_opt_i8_i8,
+                        general_reduce_gpu_i8_i8,
+                        ::testing::Values(
+                            TestParamType_general_reduce_gpu(2, 12, 1, 1, 8, 8, format::bfyx, reduce_mode::logical_or, {reduce::along_y, reduce::along_x}, "reduce_gpu_bfyx_opt", false, data_types::i8, true, data_types::i8),
+                            TestParamType_general_reduce_gpu(2, 40, 1, 1, 3, 2, format::bfyx, reduce_mode::logical_and, {reduce::along_f}, "reduce_gpu_bfyx_opt", true, data_types::i8, true, data_types::i8)
+                        ), general_reduce_gpu::PrintToStringParamName);
+
+ INSTANTIATE_TEST_CASE_P(reduce_gpu_bfyx_opt_i8_f32,
+                        general_reduce_gpu_i8_f32,
+                        ::testing::Values(
+                            TestParamType_general_reduce_gpu(3, 5, 1, 1, 17, 19, format::bfyx, reduce_mode::mean, {reduce::along_y, reduce::along_x}, "reduce_gpu_bfyx_opt", false, data_types::i8, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(2, 9, 1, 1, 3, 11, format::bfyx, reduce_mode::max, {reduce::along_f, reduce::along_x}, "reduce_gpu_bfyx_opt", false, data_types::i8, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(2, 40, 1, 1, 3, 2, format::bfyx, reduce_mode::sum, {reduce::along_f}, "reduce_gpu_bfyx_opt", false, data_types::i8, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(4, 3, 1, 1, 9, 7, format::bfyx, reduce_mode::l1, {reduce::along_b, reduce::along_y}, "reduce_gpu_bfyx_opt", true, data_types::i8, false, data_types::f32)
+                        ), general_reduce_gpu::PrintToStringParamName);
+
+ INSTANTIATE_TEST_CASE_P(reduce_gpu_bfyx_opt_f32_f32,
+                        general_reduce_gpu_f32_f32,
+                        ::testing::Values(
+                            TestParamType_general_reduce_gpu(2, 4, 1, 1, 64, 33, format::bfyx, reduce_mode::mean, {reduce::along_x}, "reduce_gpu_bfyx_opt", false, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(3, 7, 1, 1, 17, 13, format::bfyx, reduce_mode::sum, {reduce::along_y, reduce::along_x}, "reduce_gpu_bfyx_opt", false, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(2, 96, 1, 1, 5, 7, format::bfyx, reduce_mode::max, {reduce::along_f}, "reduce_gpu_bfyx_opt", false, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(16, 3, 1, 1, 4, 9, format::bfyx, reduce_mode::min, {reduce::along_b, reduce::along_y}, "reduce_gpu_bfyx_opt", false, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(4, 16, 1, 1, 12, 12, format::bfyx, reduce_mode::l2, {reduce::along_f, reduce::along_y, reduce::along_x}, "reduce_gpu_bfyx_opt", false, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(2, 5, 1, 7, 8, 9, format::bfzyx, reduce_mode::l1, {reduce::along_z, reduce::along_y, reduce::along_x}, "reduce_gpu_bfyx_opt", false, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(3, 11, 1, 7, 2, 5, format::bfzyx, reduce_mode::log_sum_exp, {reduce::along_f, reduce::along_z}, "reduce_gpu_bfyx_opt", false, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(2, 3, 4, 5, 6, 7, format::bfwzyx, reduce_mode::mean, {reduce::along_w, reduce::along_y, reduce::along_x}, "reduce_gpu_bfyx_opt", false, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(2, 6, 3, 5, 4, 4, format::bfwzyx, reduce_mode::sum_square, {reduce::along_b, reduce::along_f, reduce::along_w}, "reduce_gpu_bfyx_opt", false, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(2, 32, 1, 1, 7, 9, format::bfyx, reduce_mode::mean, {reduce::along_f}, "reduce_gpu_bfyx_opt", true, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(2, 3, 1, 6, 8, 9, format::bfzyx, reduce_mode::log_sum, {reduce::along_z, reduce::along_y, reduce::along_x}, "reduce_gpu_bfyx_opt", true, data_types::f32, false, data_types::f32),
+                            TestParamType_general_reduce_gpu(3, 4, 2, 3, 16, 5, format::bfwzyx, reduce_mode::max, {reduce::along_f, reduce::along_y, reduce::along_x}, "reduce_gpu_bfyx_opt", true, data_types::f32, false, data_types::f32)
+                        ), general_reduce_gpu::PrintToStringParamName);
+
 INSTANTIATE_TEST_CASE_P(DISABLED_reduce_gpu_ref_f32_f32,
                         general_reduce_gpu_f32_f32,
                         ::testing::Values(
@@ -11,6 +11,9 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <sstream>
+#include <thread>
+#include <atomic>
 
 #include <gflags/gflags.h>
 
@@ -26,6 +29,15 @@ static constexpr char help_message[] =
 static constexpr char model_message[] =
                                              "Required. Path to the XML model.";
 
+static constexpr char manifest_message[] =
+                                             "Optional. Path to the manifest file with models to compile instead of -m.\n"
+"                                             Every line holds path to the XML model and optionally path to the output file,\n"
+"                                             lines starting with '#' are skipped. All models are compiled with the same options.";
+
+static constexpr char nthreads_message[] =
+                                             "Optional. Number of models from the manifest compiled concurrently.\n"
+"                                             Default value: number of hardware threads.";
+
 static constexpr char targetDeviceMessage[] =
                                              "Required. Specify a target device for which executable network will be compiled.\n"
 "                                             Use \"-d HETERO:<comma-separated_devices_list>\" format to specify HETERO plugin.\n"
@@ -78,12 +90,19 @@ static constexpr char tiling_cmx_limit_message[] =
 "                                             Value should be equal or greater than -1.\n"
 "                                             Overwrites value from config.";
 
+static constexpr char tune_tiling_message[] =
+                                             "Optional. Specifies number of HW tilings to try for every layer.\n"
+"                                             Each variant is measured on the device and the fastest tiling\n"
+"                                             of every layer is stored into the output blob.";
+
 // FPGA-specific
 static constexpr char dla_arch_name[] =
                                              "Optional. Specify architecture name used to compile executable network for FPGA device.";
 
 DEFINE_bool(h, false, help_message);
 DEFINE_string(m, "", model_message);
+DEFINE_string(manifest, "", manifest_message);
+DEFINE_uint32(nthreads, 0, nthreads_message);
 DEFINE_string(d, "", targetDeviceMessage);
 DEFINE_string(o, "", output_message);
 DEFINE_string(c, "", config_message);
@@ -96,6 +115,7 @@ DEFINE_string(iol, "", iol_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
 DEFINE_string(VPU_TILING_CMX_LIMIT_KB, "", tiling_cmx_limit_message);
+DEFINE_uint32(VPU_TUNE_TILING, 0, tune_tiling_message);
 DEFINE_string(DLA_ARCH_NAME, "", dla_arch_name);
 
 static void showUsage() {
@@ -104,6 +124,8 @@ static void showUsage() {
     std::cout << " Common options:                             "                                   << std::endl;
     std::cout << "    -h                                       "   << help_message                 << std::endl;
     std::cout << "    -m                           <value>     "   << model_message                << std::endl;
+    std::cout << "    -manifest                    <value>     "   << manifest_message             << std::endl;
+    std::cout << "    -nthreads                    <value>     "   << nthreads_message             << std::endl;
     std::cout << "    -d                           <value>     "   << targetDeviceMessage          << std::endl;
     std::cout << "    -o                           <value>     "   << output_message               << std::endl;
     std::cout << "    -c                           <value>     "   << config_message               << std::endl;
@@ -118,6 +140,7 @@ static void showUsage() {
     std::cout << "      -VPU_NUMBER_OF_SHAVES      <value>     "   << number_of_shaves_message     << std::endl;
     std::cout << "      -VPU_NUMBER_OF_CMX_SLICES  <value>     "   << number_of_cmx_slices_message << std::endl;
     std::cout << "      -VPU_TILING_CMX_LIMIT_KB   <value>     "   << tiling_cmx_limit_message     << std::endl;
+    std::cout << "      -VPU_TUNE_TILING           <value>     "   << tune_tiling_message          << std::endl;
     std::cout                                                                                      << std::endl;
     std::cout << " FPGA-specific options:                      "                                   << std::endl;
     std::cout << "      -DLA_ARCH_NAME             <value>     "   << dla_arch_name                << std::endl;
@@ -132,10 +155,18 @@ static bool parseCommandLine(int* argc, char*** argv, InferenceEngine::Core& ie)
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_manifest.empty()) {
         throw std::invalid_argument("Path to model xml file is required");
     }
 
+    if (!FLAGS_m.empty() && !FLAGS_manifest.empty()) {
+        throw std::invalid_argument("Model xml file and manifest can't be specified together");
+    }
+
+    if (!FLAGS_o.empty() && !FLAGS_manifest.empty()) {
+        throw std::invalid_argument("Output file names should be specified in the manifest");
+    }
+
     if (FLAGS_d.empty()) {
         throw std::invalid_argument("Target device name is required");
     }
@@ -464,6 +495,201 @@ std::string getFileNameFromPath(const std::string& path,
 
 using TimeDiff = std::chrono::milliseconds;
 
+static std::map<std::string, long long> measureLayers(InferenceEngine::Core& ie,
+                                                      const InferenceEngine::CNNNetwork& network,
+                                                      std::map<std::string, std::string> config) {
+    constexpr int numIterations = 10;
+
+    config[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
+    auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, config);
+    auto request = executableNetwork.CreateInferRequest();
+
+    // first inference warms up the device and is not taken into account
+    request.Infer();
+
+    std::map<std::string, long long> layerTimes;
+    for (int i = 0; i < numIterations; i++) {
+        request.Infer();
+        for (const auto& layer : request.GetPerformanceCounts()) {
+            layerTimes[layer.first] += layer.second.realTime_uSec;
+        }
+    }
+
+    return layerTimes;
+}
+
+// Compiles network with every tiling choice in turn and picks the fastest one for each layer separately.
+// Returns value for MYRIAD_HW_TILING_CHOICES option.
+static std::string tuneTiling(InferenceEngine::Core& ie,
+                              const InferenceEngine::CNNNetwork& network,
+                              const std::map<std::string, std::string>& config) {
+    std::map<std::string, std::pair<int, long long>> bestChoices;
+
+    for (int choice = 0; choice < static_cast<int>(FLAGS_VPU_TUNE_TILING); choice++) {
+        auto choiceConfig = config;
+        choiceConfig[InferenceEngine::MYRIAD_HW_TILING_CHOICES] = "*:" + std::to_string(choice);
+
+        for (const auto& layer : measureLayers(ie, network, choiceConfig)) {
+            auto best = bestChoices.find(layer.first);
+            if (best == bestChoices.end()) {
+                bestChoices.emplace(layer.first, std::make_pair(choice, layer.second));
+            } else if (layer.second < best->second.second) {
+                best->second = std::make_pair(choice, layer.second);
+            }
+        }
+    }
+
+    std::string choices;
+    for (const auto& layer : bestChoices) {
+        if (layer.second.first == 0) {
+            continue;
+        }
+        if (!choices.empty()) {
+            choices += ",";
+        }
+        choices += layer.first + ":" + std::to_string(layer.second.first);
+    }
+
+    return choices;
+}
+
+static InferenceEngine::CNNNetwork readNetwork(InferenceEngine::Core& ie, const std::string& modelPath) {
+    auto network = ie.ReadNetwork(modelPath);
+
+    setDefaultIO(network);
+    processPrecisions(network);
+    processLayout(network);
+
+    return network;
+}
+
+static std::string getDefaultOutputName(const std::string& modelPath) {
+    return getFileNameFromPath(fileNameNoExt(modelPath)) + ".blob";
+}
+
+// Returns LoadNetwork time, tiling tuning and export are not taken into account.
+static TimeDiff compileNetwork(InferenceEngine::Core& ie,
+                               const InferenceEngine::CNNNetwork& network,
+                               const std::string& outputName,
+                               std::map<std::string, std::string> config,
+                               bool verbose) {
+    if (FLAGS_VPU_TUNE_TILING > 1 && FLAGS_d.find("MYRIAD") != std::string::npos) {
+        const auto choices = tuneTiling(ie, network, config);
+        if (verbose) {
+            std::cout << "Tuned HW tiling choices: " << (choices.empty() ? "default" : choices) << std::endl;
+            std::cout << std::endl;
+        }
+
+        if (!choices.empty()) {
+            config[InferenceEngine::MYRIAD_HW_TILING_CHOICES] = choices;
+        }
+    }
+
+    auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+    auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, config);
+    const auto loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+
+    std::ofstream outputFile{outputName};
+    if (!outputFile.is_open()) {
+        throw std::runtime_error("Output file " + outputName + " can't be opened for writing");
+    }
+    executableNetwork.Export(outputFile);
+
+    return loadNetworkTimeElapsed;
+}
+
+struct ManifestEntry {
+    std::string modelPath;
+    std::string outputName;
+
+    // filled in by compilation
+    bool compiled = false;
+    std::string error;
+    TimeDiff loadNetworkTime {0};
+    TimeDiff totalTime {0};
+};
+
+static std::vector<ManifestEntry> parseManifest(char comment = '#') {
+    std::ifstream file(FLAGS_manifest);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Manifest file " + FLAGS_manifest + " can't be opened");
+    }
+
+    std::vector<ManifestEntry> entries;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream lineStream(line);
+        ManifestEntry entry;
+        if (!(lineStream >> entry.modelPath) || entry.modelPath[0] == comment) {
+            continue;
+        }
+        if (!(lineStream >> entry.outputName)) {
+            entry.outputName = getDefaultOutputName(entry.modelPath);
+        }
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+// Compiles all models from the manifest sharing one Core, models are taken by a fixed number of workers.
+// Returns true if every model has been compiled.
+static bool compileManifest(InferenceEngine::Core& ie, const std::map<std::string, std::string>& config) {
+    auto entries = parseManifest();
+
+    auto numWorkers = FLAGS_nthreads != 0 ? static_cast<size_t>(FLAGS_nthreads) :
+                                            static_cast<size_t>(std::thread::hardware_concurrency());
+    numWorkers = std::max<size_t>(1, std::min(numWorkers, entries.size()));
+
+    std::cout << "Compiling " << entries.size() << " models with " << numWorkers << " workers" << std::endl;
+    std::cout << std::endl;
+
+    std::atomic<size_t> nextEntry {0};
+    auto worker = [&]() {
+        for (auto idx = nextEntry++; idx < entries.size(); idx = nextEntry++) {
+            auto& entry = entries[idx];
+            const auto timeBegin = std::chrono::steady_clock::now();
+            try {
+                const auto network = readNetwork(ie, entry.modelPath);
+                entry.loadNetworkTime = compileNetwork(ie, network, entry.outputName, config, false);
+                entry.compiled = true;
+            } catch (const std::exception& error) {
+                entry.error = error.what();
+            } catch (...) {
+                entry.error = "Unknown/internal exception happened.";
+            }
+            entry.totalTime = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBegin);
+        }
+    };
+
+    const auto timeBegin = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < numWorkers; i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+    const auto timeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBegin);
+
+    size_t numFailed = 0;
+    for (const auto& entry : entries) {
+        if (entry.compiled) {
+            std::cout << "[ OK ] " << entry.modelPath << " -> " << entry.outputName
+                      << ", LoadNetwork: " << entry.loadNetworkTime.count() << " ms"
+                      << ", total: " << entry.totalTime.count() << " ms" << std::endl;
+        } else {
+            numFailed++;
+            std::cout << "[FAIL] " << entry.modelPath << ": " << entry.error << std::endl;
+        }
+    }
+    std::cout << std::endl;
+    std::cout << "Compiled " << entries.size() - numFailed << " of " << entries.size()
+              << " models in " << timeElapsed.count() << " ms" << std::endl;
+
+    return numFailed == 0;
+}
+
 int main(int argc, char* argv[]) {
     TimeDiff loadNetworkTimeElapsed {0};
 
@@ -477,11 +703,11 @@ int main(int argc, char* argv[]) {
             return EXIT_SUCCESS;
         }
 
-        auto network = ie.ReadNetwork(FLAGS_m);
+        if (!FLAGS_manifest.empty()) {
+            return compileManifest(ie, configure()) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
 
-        setDefaultIO(network);
-        processPrecisions(network);
-        processLayout(network);
+        auto network = readNetwork(ie, FLAGS_m);
 
         std::cout << "Network inputs:" << std::endl;
         for (auto&& layer : network.getInputsInfo()) {
@@ -493,22 +719,8 @@ int main(int argc, char* argv[]) {
         }
         std::cout << std::endl;
 
-        auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-        auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure());
-        loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
-
-        std::string outputName = FLAGS_o;
-        if (outputName.empty()) {
-            outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
-        }
-
-        std::ofstream outputFile{outputName};
-        if (!outputFile.is_open()) {
-            std::cout << "Output file " << outputName << " can't be opened for writing" << std::endl;
-            return EXIT_FAILURE;
-        } else {
-            executableNetwork.Export(outputFile);
-        }
+        const auto outputName = FLAGS_o.empty() ? getDefaultOutputName(FLAGS_m) : FLAGS_o;
+        loadNetworkTimeElapsed = compileNetwork(ie, network, outputName, configure(), true);
     } catch (const std::exception& error) {
         std::cerr << error.what() << std::endl;
         return EXIT_FAILURE;
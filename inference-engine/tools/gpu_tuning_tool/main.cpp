@@ -0,0 +1,193 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <sstream>
+#include <map>
+#include <vector>
+#include <string>
+
+#include <gflags/gflags.h>
+
+#include "inference_engine.hpp"
+#include "samples/common.hpp"
+
+static constexpr char help_message[] =
+                                             "Optional. Print the usage message.";
+
+static constexpr char model_message[] =
+                                             "Required. Path to the XML model or to a text file with one XML model path per line.\n"
+"                                             Empty lines and lines starting with '#' in the text file are skipped.";
+
+static constexpr char targetDeviceMessage[] =
+                                             "Optional. Specify a GPU device to tune kernels for. Default value: \"GPU\".";
+
+static constexpr char output_message[] =
+                                             "Required. Path to the tuning file. Entries of the existing file are reused and kept,\n"
+"                                             so the same file can be tuned incrementally for different models.";
+
+static constexpr char mode_message[] =
+                                             "Optional. Tuning mode: TUNING_CREATE tunes primitives not present in the file,\n"
+"                                             TUNING_RETUNE tunes all primitives, TUNING_UPDATE only removes invalid entries.\n"
+"                                             Default value: TUNING_CREATE.";
+
+static constexpr char config_message[] =
+                                             "Optional. Path to the configuration file.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", model_message);
+DEFINE_string(d, "GPU", targetDeviceMessage);
+DEFINE_string(o, "", output_message);
+DEFINE_string(mode, InferenceEngine::PluginConfigParams::TUNING_CREATE, mode_message);
+DEFINE_string(c, "", config_message);
+
+static void showUsage() {
+    std::cout << "gpu_tuning_tool [OPTIONS]" << std::endl;
+    std::cout                                                                                      << std::endl;
+    std::cout << " Options:                                    "                                   << std::endl;
+    std::cout << "    -h                                       "   << help_message                 << std::endl;
+    std::cout << "    -m                           <value>     "   << model_message                << std::endl;
+    std::cout << "    -d                           <value>     "   << targetDeviceMessage          << std::endl;
+    std::cout << "    -o                           <value>     "   << output_message               << std::endl;
+    std::cout << "    -mode                        <value>     "   << mode_message                 << std::endl;
+    std::cout << "    -c                           <value>     "   << config_message               << std::endl;
+    std::cout << std::endl;
+}
+
+static bool parseCommandLine(int* argc, char*** argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty()) {
+        throw std::invalid_argument("Path to model xml file or model list is required");
+    }
+
+    if (FLAGS_o.empty()) {
+        throw std::invalid_argument("Path to tuning file is required");
+    }
+
+    if (FLAGS_mode != InferenceEngine::PluginConfigParams::TUNING_CREATE &&
+        FLAGS_mode != InferenceEngine::PluginConfigParams::TUNING_RETUNE &&
+        FLAGS_mode != InferenceEngine::PluginConfigParams::TUNING_UPDATE) {
+        throw std::invalid_argument("Unsupported tuning mode " + FLAGS_mode);
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << (*argv)[arg] << " ";
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+static std::map<std::string, std::string> parseConfigFile(char comment = '#') {
+    std::map<std::string, std::string> config;
+
+    std::ifstream file(FLAGS_c);
+    if (file.is_open()) {
+        std::string key, value;
+        while (file >> key >> value) {
+            if (key.empty() || key[0] == comment) {
+                continue;
+            }
+            config[key] = value;
+        }
+    }
+    return config;
+}
+
+static std::map<std::string, std::string> configure() {
+    auto config = parseConfigFile();
+
+    config[InferenceEngine::PluginConfigParams::KEY_TUNING_MODE] = FLAGS_mode;
+    config[InferenceEngine::PluginConfigParams::KEY_TUNING_FILE] = FLAGS_o;
+
+    return config;
+}
+
+static std::vector<std::string> getModelPaths(char comment = '#') {
+    if (fileExt(FLAGS_m) == "xml") {
+        return { FLAGS_m };
+    }
+
+    std::ifstream file(FLAGS_m);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Model list " + FLAGS_m + " could not be read");
+    }
+
+    std::vector<std::string> models;
+    std::string line;
+    while (std::getline(file, line)) {
+        trim(line);
+        if (line.empty() || line[0] == comment) {
+            continue;
+        }
+        models.push_back(line);
+    }
+    return models;
+}
+
+using TimeDiff = std::chrono::milliseconds;
+
+int main(int argc, char* argv[]) {
+    try {
+        std::cout << "Inference Engine: " << InferenceEngine::GetInferenceEngineVersion() << std::endl;
+        std::cout << std::endl;
+
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        InferenceEngine::Core ie;
+        const auto config = configure();
+        const auto models = getModelPaths();
+
+        size_t failed = 0;
+        for (auto&& model : models) {
+            std::cout << "Tuning " << model << std::endl;
+            try {
+                auto network = ie.ReadNetwork(model);
+
+                // Loading the network tunes kernels missing in the tuning file and stores them to it
+                auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+                auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, config);
+                auto loadNetworkTimeElapsed =
+                    std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+
+                std::cout << "    Done in " << loadNetworkTimeElapsed.count() << " ms" << std::endl;
+            } catch (const std::exception& error) {
+                std::cerr << "    Failed: " << error.what() << std::endl;
+                failed++;
+            }
+        }
+
+        std::cout << std::endl;
+        std::cout << "Tuned " << models.size() - failed << " of " << models.size() << " models, tuning file: " << FLAGS_o << std::endl;
+        std::cout << "Use it with " << InferenceEngine::PluginConfigParams::KEY_TUNING_MODE << " "
+                  << InferenceEngine::PluginConfigParams::TUNING_USE_EXISTING << " to skip measurements at LoadNetwork" << std::endl;
+
+        if (failed != 0) {
+            return EXIT_FAILURE;
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,247 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+
+#include <inference_engine.hpp>
+#include <ngraph/pass/pass_profile.hpp>
+
+static constexpr char help_message[] =
+                                             "Optional. Print the usage message.";
+
+static constexpr char models_message[] =
+                                             "Optional. Comma-separated paths to XML models.";
+
+static constexpr char models_list_message[] =
+                                             "Optional. Path to a text file with paths to XML models, one per line.\n"
+"                                             At least one of -m and -l options is required.";
+
+static constexpr char target_device_message[] =
+                                             "Optional. Target device to load models to. Default value: CPU.";
+
+static constexpr char iterations_message[] =
+                                             "Optional. Number of LoadNetwork calls per model, the fastest one is reported.\n"
+"                                             Default value: 3.";
+
+static constexpr char report_message[] =
+                                             "Optional. Path to the output CSV report. Default value: pass_profile.csv.";
+
+static constexpr char baseline_message[] =
+                                             "Optional. Path to a CSV report of a previous run to compare total times with.";
+
+static constexpr char threshold_message[] =
+                                             "Optional. Allowed slowdown against the baseline in percent. Default value: 10.";
+
+DEFINE_bool(h, false, help_message);
+DEFINE_string(m, "", models_message);
+DEFINE_string(l, "", models_list_message);
+DEFINE_string(d, "CPU", target_device_message);
+DEFINE_uint32(n, 3, iterations_message);
+DEFINE_string(report, "pass_profile.csv", report_message);
+DEFINE_string(baseline, "", baseline_message);
+DEFINE_double(threshold, 10.0, threshold_message);
+
+static constexpr char total_transformations_row[] = "<transformations>";
+static constexpr char total_load_network_row[] = "<LoadNetwork>";
+
+static void showUsage() {
+    std::cout << "pass_profile_tool [OPTIONS]" << std::endl;
+    std::cout                                                                                      << std::endl;
+    std::cout << " Options:                                    "                                   << std::endl;
+    std::cout << "    -h                                       "   << help_message                 << std::endl;
+    std::cout << "    -m                           <value>     "   << models_message               << std::endl;
+    std::cout << "    -l                           <value>     "   << models_list_message          << std::endl;
+    std::cout << "    -d                           <value>     "   << target_device_message        << std::endl;
+    std::cout << "    -n                           <value>     "   << iterations_message           << std::endl;
+    std::cout << "    -report                      <value>     "   << report_message               << std::endl;
+    std::cout << "    -baseline                    <value>     "   << baseline_message             << std::endl;
+    std::cout << "    -threshold                   <value>     "   << threshold_message            << std::endl;
+    std::cout << std::endl;
+    std::cout << " Transformations run by the plugin on the calling thread of LoadNetwork are profiled,"  << std::endl;
+    std::cout << " the report contains time and match statistics of each pass and totals per model."   << std::endl;
+}
+
+static bool parseCommandLine(int* argc, char*** argv) {
+    gflags::ParseCommandLineNonHelpFlags(argc, argv, true);
+
+    if (FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_m.empty() && FLAGS_l.empty()) {
+        throw std::invalid_argument("Path to models is required");
+    }
+
+    if (FLAGS_n == 0) {
+        throw std::invalid_argument("Number of iterations should be positive");
+    }
+
+    if (1 < *argc) {
+        std::stringstream message;
+        message << "Unknown arguments: ";
+        for (auto arg = 1; arg < *argc; arg++) {
+            message << (*argv)[arg];
+            if (arg < *argc) {
+                message << " ";
+            }
+        }
+        throw std::invalid_argument(message.str());
+    }
+
+    return true;
+}
+
+static std::vector<std::string> getModels() {
+    std::vector<std::string> models;
+    std::stringstream modelsStream(FLAGS_m);
+    for (std::string model; std::getline(modelsStream, model, ',');) {
+        if (!model.empty()) {
+            models.push_back(model);
+        }
+    }
+    if (!FLAGS_l.empty()) {
+        std::ifstream list(FLAGS_l);
+        if (!list.is_open()) {
+            throw std::invalid_argument("Cannot open models list " + FLAGS_l);
+        }
+        for (std::string model; std::getline(list, model);) {
+            if (!model.empty() && model[0] != '#') {
+                models.push_back(model);
+            }
+        }
+    }
+    return models;
+}
+
+struct ModelProfile {
+    double loadNetworkMs = 0.0;
+    ngraph::pass::PassProfile passes;
+};
+
+static double toMs(std::chrono::nanoseconds time) {
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(time).count();
+}
+
+static ModelProfile profileModel(InferenceEngine::Core& ie, const std::string& model) {
+    auto network = ie.ReadNetwork(model);
+    ModelProfile best;
+    for (uint32_t i = 0; i < FLAGS_n; i++) {
+        ModelProfile current;
+        auto start = std::chrono::steady_clock::now();
+        {
+            ngraph::pass::PassProfile::ScopedActivation activation(current.passes);
+            auto executableNetwork = ie.LoadNetwork(network, FLAGS_d);
+        }
+        current.loadNetworkMs = toMs(std::chrono::steady_clock::now() - start);
+        if (i == 0 || current.passes.get_total_time() < best.passes.get_total_time()) {
+            best = std::move(current);
+        }
+    }
+    return best;
+}
+
+// model -> total row name -> time in milliseconds
+using Totals = std::map<std::string, std::map<std::string, double>>;
+
+static Totals readTotals(const std::string& report) {
+    std::ifstream in(report);
+    if (!in.is_open()) {
+        throw std::invalid_argument("Cannot open baseline report " + report);
+    }
+    Totals totals;
+    std::string line;
+    std::getline(in, line);  // header
+    while (std::getline(in, line)) {
+        std::vector<std::string> fields;
+        std::stringstream lineStream(line);
+        for (std::string field; std::getline(lineStream, field, ';');) {
+            fields.push_back(field);
+        }
+        if (fields.size() == 7 && (fields[1] == total_transformations_row || fields[1] == total_load_network_row)) {
+            totals[fields[0]][fields[1]] = std::stod(fields[6]);
+        }
+    }
+    return totals;
+}
+
+int main(int argc, char* argv[]) {
+    try {
+        if (!parseCommandLine(&argc, &argv)) {
+            return EXIT_SUCCESS;
+        }
+
+        std::ofstream report(FLAGS_report);
+        if (!report.is_open()) {
+            throw std::invalid_argument("Cannot open report " + FLAGS_report);
+        }
+        report << "model;pass;runs;changed runs;match attempts;matches;time (ms)" << std::endl;
+        report << std::fixed << std::setprecision(3);
+
+        InferenceEngine::Core ie;
+        Totals totals;
+        for (auto&& model : getModels()) {
+            auto profile = profileModel(ie, model);
+            for (auto&& record : profile.passes.get_records()) {
+                report << model << ';' << record.name << ';' << record.runs << ';' << record.changed_runs << ';'
+                       << record.match_attempts << ';' << record.matches << ';' << toMs(record.time) << std::endl;
+            }
+            auto transformationsMs = toMs(profile.passes.get_total_time());
+            report << model << ';' << total_transformations_row << ";;;;;" << transformationsMs << std::endl;
+            report << model << ';' << total_load_network_row << ";;;;;" << profile.loadNetworkMs << std::endl;
+            totals[model][total_transformations_row] = transformationsMs;
+            totals[model][total_load_network_row] = profile.loadNetworkMs;
+            std::cout << model << ": transformations " << transformationsMs << " ms, LoadNetwork "
+                      << profile.loadNetworkMs << " ms" << std::endl;
+        }
+        std::cout << "Report is stored to " << FLAGS_report << std::endl;
+
+        if (!FLAGS_baseline.empty()) {
+            bool regressed = false;
+            auto baseline = readTotals(FLAGS_baseline);
+            for (auto&& model : totals) {
+                auto baselineModel = baseline.find(model.first);
+                if (baselineModel == baseline.end()) {
+                    continue;
+                }
+                for (auto&& total : model.second) {
+                    auto baselineTotal = baselineModel->second.find(total.first);
+                    if (baselineTotal == baselineModel->second.end() || baselineTotal->second <= 0.0) {
+                        continue;
+                    }
+                    auto slowdown = (total.second / baselineTotal->second - 1.0) * 100.0;
+                    if (slowdown > FLAGS_threshold) {
+                        regressed = true;
+                        std::cout << "[ REGRESSION ] " << model.first << " " << total.first << ": "
+                                  << baselineTotal->second << " ms -> " << total.second << " ms (+"
+                                  << slowdown << "%)" << std::endl;
+                    }
+                }
+            }
+            if (regressed) {
+                return EXIT_FAILURE;
+            }
+            std::cout << "No regressions against " << FLAGS_baseline << std::endl;
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    } catch (...) {
+        std::cerr << "Unknown/internal exception happened." << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
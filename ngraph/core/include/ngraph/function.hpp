@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -181,6 +182,14 @@ namespace ngraph
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
 
+        // Ops order computed by get_ordered_ops and the Node edges version it is valid for.
+        // Weak pointers are kept to not prolong life of nodes removed from the graph.
+        void invalidate_ordered_ops() { m_ordered_ops_valid = false; }
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<std::weak_ptr<Node>> m_ordered_ops;
+        mutable size_t m_ordered_ops_version{0};
+        mutable bool m_ordered_ops_valid{false};
+
         ResultVector m_results;
 
         // List of the nodes with side effect in graph.
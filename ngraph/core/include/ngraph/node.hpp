@@ -42,6 +42,7 @@
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/output_vector.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/type.hpp"
 
@@ -254,6 +255,11 @@ namespace ngraph
 
         virtual bool is_dynamic() const;
         size_t get_instance_id() const { return m_instance_id; }
+        /// \brief Returns counter of data and control edge changes made to any node. Function
+        ///        compares it with the value it sorted ops at to reuse the order of ops.
+        static size_t get_edges_version() { return m_edges_version; }
+        /// \brief Marks that data or control edges of some node were changed
+        static void mark_edges_changed() { ++m_edges_version; }
         /// \brief Writes a description of a node to a stream
         /// \param os The stream; should be returned
         /// \param depth How many levels of inputs to describe
@@ -469,15 +475,21 @@ namespace ngraph
 
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        static std::atomic<size_t> m_edges_version;
+        struct Provenance
+        {
+            std::unordered_set<std::string> tags;
+            std::set<std::shared_ptr<Node>> group;
+        };
+        Provenance& get_provenance();
+        // Provenance is rarely used, so it is allocated on the first write only
+        std::unique_ptr<Provenance> m_provenance;
+        StableVector<descriptor::Input> m_inputs;
+        StableVector<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
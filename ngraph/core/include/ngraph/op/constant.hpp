@@ -248,6 +248,7 @@ namespace ngraph
                 {
                     m_data = data;
                     constructor_validate_and_infer_types();
+                    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
                 }
 
                 Constant(const Constant& other);
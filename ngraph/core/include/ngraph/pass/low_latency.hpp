@@ -7,7 +7,7 @@
 #include <memory>
 #include <vector>
 
-#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pass/pass.hpp>
 
 namespace ngraph
 {
@@ -18,10 +18,13 @@ namespace ngraph
 } // namespace ngraph
 
 /**
- * @brief The transformation finds all TensorIterator layers in the network, processes all back
- * edges that describe a connection between Result and Parameter of the TensorIterator body,
+ * @brief The transformation finds all TensorIterator and Loop layers in the network, processes all back
+ * edges that describe a connection between Result and Parameter of the TensorIterator/Loop body,
  * and inserts ReadValue layer between Parameter and the next layers after this Parameter,
  * and Assign layer after the layers before the Result layer.
+ * RNNSequence, GRUSequence and LSTMSequence layers get ReadValue layers on their initial
+ * hidden (and cell) state inputs and Assign layers on their last state outputs, so stacked
+ * sequences keep a separate state for every layer.
  * Supported platforms: CPU, GNA.
  *
  *  The example below describes the changes to the inner part (body, back edges) of the Tensor
@@ -41,15 +44,15 @@ namespace ngraph
  *  sequence dimension to 1 and with the UnrollTensorIterator transformation.
  *  For convenience, we have already enabled the unconditional execution of the UnrollTensorIterator
  *  transformation when using the LowLatency transformation for CPU, GNA plugins, no action is
- *  required here.
+ *  required here. Loop layers are unrolled only if their number of iterations is known.
  *  After applying both of these transformations, the resulting network can be inferred step by
  *  step, the states will store between inferences.
  *
  */
 
-class ngraph::pass::LowLatency : public ngraph::pass::MatcherPass
+class ngraph::pass::LowLatency : public ngraph::pass::FunctionPass
 {
 public:
     NGRAPH_RTTI_DECLARATION;
-    LowLatency();
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 };
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "ngraph/pass/pass.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 #include "ngraph/pass/validate.hpp"
 
 namespace ngraph
@@ -72,6 +73,11 @@ public:
     void run_passes(std::shared_ptr<Function>);
 
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
+    /// \brief Set a profile which collects execution time of passes during run_passes.
+    /// Passes are also collected into a profile activated on the calling thread by
+    /// PassProfile::ScopedActivation.
+    /// \param profile Profile to collect into, nullptr disables own profile of the manager
+    void set_profile(const std::shared_ptr<PassProfile>& profile) { m_profile = profile; }
     /// \brief Set flag to enable/disable running Validate pass after executing
     /// each registered pass
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
@@ -117,4 +123,5 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    std::shared_ptr<PassProfile> m_profile;
 };
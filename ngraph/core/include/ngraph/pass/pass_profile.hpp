@@ -0,0 +1,103 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief Collects execution time of transformations run by pass::Manager and statistics
+        /// of MatcherPasses run by GraphRewrite.
+        ///
+        /// A profile is active on a thread while a ScopedActivation object exists or while
+        /// pass::Manager with the profile set by Manager::set_profile runs passes. Transformations
+        /// run by nested managers (e.g. inside a FunctionPass) on the same thread are collected
+        /// into the active profile too, so the whole plugin pipeline is collected when LoadNetwork
+        /// is called within the activation scope. Names of records are paths of transformation
+        /// names separated by '/', records of repeated runs of the same path are accumulated.
+        /// A profile must not be active on several threads at the same time.
+        class NGRAPH_API PassProfile
+        {
+        public:
+            struct Record
+            {
+                /// \brief Transformation path, e.g. "CommonOptimizations/ConstantFolding"
+                std::string name;
+                /// \brief Number of runs of FunctionPass or GraphRewrite, 0 for MatcherPass
+                size_t runs = 0;
+                /// \brief Total execution time
+                std::chrono::nanoseconds time{0};
+                /// \brief Number of runs which changed the function
+                size_t changed_runs = 0;
+                /// \brief Number of nodes the MatcherPass was applied to
+                size_t match_attempts = 0;
+                /// \brief Number of MatcherPass applications which returned true
+                size_t matches = 0;
+            };
+
+            /// \brief Makes the profile active on the calling thread till destruction
+            class NGRAPH_API ScopedActivation
+            {
+            public:
+                explicit ScopedActivation(PassProfile& profile);
+                ~ScopedActivation();
+
+                ScopedActivation(const ScopedActivation&) = delete;
+                ScopedActivation& operator=(const ScopedActivation&) = delete;
+
+            private:
+                PassProfile* m_previous;
+            };
+
+            /// \return Records in order of the first run of each path
+            const std::vector<Record>& get_records() const { return m_records; }
+            /// \return Time of all top level passes
+            std::chrono::nanoseconds get_total_time() const;
+
+            void clear();
+
+            /// \return Profile active on the calling thread or nullptr
+            static PassProfile* get_active();
+
+            /// \brief Starts a run of a transformation nested into currently running ones
+            /// \return An index of the record
+            size_t begin_pass(const std::string& name);
+            /// \brief Finishes the run started by the latest begin_pass
+            void end_pass(size_t record, std::chrono::nanoseconds time, bool changed);
+            /// \brief Accumulates statistics of a MatcherPass nested into currently running pass
+            void add_matcher(const std::string& name,
+                             std::chrono::nanoseconds time,
+                             size_t match_attempts,
+                             size_t matches);
+
+        private:
+            Record& get_record(const std::string& name);
+
+            std::vector<Record> m_records;
+            std::unordered_map<std::string, size_t> m_record_index;
+            std::vector<std::string> m_path;
+        };
+    }
+}
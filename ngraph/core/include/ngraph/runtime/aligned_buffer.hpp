@@ -86,6 +86,9 @@ namespace ngraph
         AttributeAdapter(std::shared_ptr<runtime::AlignedBuffer>& value);
         void* get_ptr() override;
         size_t size() override;
+        /// \brief Replaces the referenced buffer, e.g. with a SharedBuffer over memory owned by
+        /// the caller, so that the data does not have to be copied into the allocated one
+        void set(const std::shared_ptr<runtime::AlignedBuffer>& value) { m_ref = value; }
 
         static constexpr DiscreteTypeInfo type_info{
             "AttributeAdapter<std::shared_ptr<runtime::AlignedBuffer>>", 0};
@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief Growable sequence whose elements never move in memory.
+    ///
+    /// Used instead of std::deque for the input/output descriptors of a node: descriptors keep
+    /// raw pointers to each other, so element addresses must survive growth, while a deque
+    /// allocates a ~512 byte block even for one or two elements. Every element is allocated
+    /// separately and only a vector of pointers is kept, which costs a few words per node.
+    template <typename T>
+    class StableVector
+    {
+        using Storage = std::vector<std::unique_ptr<T>>;
+
+        template <typename Value, typename BaseIterator>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = typename std::remove_const<Value>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            explicit Iterator(BaseIterator it)
+                : m_it(it)
+            {
+            }
+            Value& operator*() const { return **m_it; }
+            Value* operator->() const { return m_it->get(); }
+            Iterator& operator++()
+            {
+                ++m_it;
+                return *this;
+            }
+            Iterator operator++(int) { return Iterator(m_it++); }
+            bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+            bool operator!=(const Iterator& other) const { return m_it != other.m_it; }
+        private:
+            BaseIterator m_it;
+        };
+
+    public:
+        using value_type = T;
+        using iterator = Iterator<T, typename Storage::iterator>;
+        using const_iterator = Iterator<const T, typename Storage::const_iterator>;
+
+        StableVector() = default;
+        StableVector(StableVector&&) = default;
+        StableVector& operator=(StableVector&&) = default;
+
+        StableVector(const StableVector& other)
+        {
+            m_elements.reserve(other.size());
+            for (const auto& element : other.m_elements)
+            {
+                m_elements.emplace_back(new T(*element));
+            }
+        }
+
+        StableVector& operator=(const StableVector& other)
+        {
+            if (this != &other)
+            {
+                StableVector copy(other);
+                m_elements.swap(copy.m_elements);
+            }
+            return *this;
+        }
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            m_elements.emplace_back(new T(std::forward<Args>(args)...));
+            return *m_elements.back();
+        }
+
+        size_t size() const { return m_elements.size(); }
+        bool empty() const { return m_elements.empty(); }
+        T& operator[](size_t i) { return *m_elements[i]; }
+        const T& operator[](size_t i) const { return *m_elements[i]; }
+        T& at(size_t i) { return *m_elements.at(i); }
+        const T& at(size_t i) const { return *m_elements.at(i); }
+        iterator begin() { return iterator(m_elements.begin()); }
+        iterator end() { return iterator(m_elements.end()); }
+        const_iterator begin() const { return const_iterator(m_elements.begin()); }
+        const_iterator end() const { return const_iterator(m_elements.end()); }
+    private:
+        Storage m_elements;
+    };
+}
@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
-
 #include <utility>
+#include <vector>
+
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
 #include "ngraph/shape_util.hpp"
@@ -95,6 +97,110 @@ namespace ngraph
                         --axis;
                     return axis;
                 }
+
+                // Row-major strides of shape left padded with ones to rank, broadcasted axes get
+                // zero stride
+                inline std::vector<size_t> broadcast_strides(const Shape& shape, size_t rank)
+                {
+                    std::vector<size_t> strides(rank, 0);
+                    size_t stride = 1;
+                    for (size_t i = 0; i < shape.size(); ++i)
+                    {
+                        const size_t dim = shape[shape.size() - 1 - i];
+                        strides[rank - 1 - i] = dim == 1 ? 0 : stride;
+                        stride *= dim;
+                    }
+                    return strides;
+                }
+
+                // NumPy broadcasting of three tensors: the innermost output axis is a plain loop,
+                // outer axes are walked with an odometer updating the input offsets by strides
+                template <typename T, typename U, typename Functor>
+                void numpy_autobroadcast_select(const U* arg0,
+                                                const T* arg1,
+                                                const T* arg2,
+                                                T* out,
+                                                const Shape& arg0_shape,
+                                                const Shape& arg1_shape,
+                                                const Shape& arg2_shape,
+                                                Functor elementwise_functor)
+                {
+                    if (arg0_shape == arg1_shape && arg1_shape == arg2_shape)
+                    {
+                        for (size_t i = 0, end = shape_size(arg0_shape); i < end; ++i)
+                            out[i] = elementwise_functor(arg0[i], arg1[i], arg2[i]);
+                        return;
+                    }
+
+                    const size_t rank = std::max(
+                        {arg0_shape.size(), arg1_shape.size(), arg2_shape.size(), size_t(1)});
+                    Shape output_shape(rank, 1);
+                    for (const Shape* shape : {&arg0_shape, &arg1_shape, &arg2_shape})
+                    {
+                        for (size_t i = 0; i < shape->size(); ++i)
+                        {
+                            auto& dim = output_shape[rank - shape->size() + i];
+                            if (dim == 1)
+                                dim = (*shape)[i];
+                        }
+                    }
+                    if (shape_size(output_shape) == 0)
+                        return;
+
+                    const auto strides0 = broadcast_strides(arg0_shape, rank);
+                    const auto strides1 = broadcast_strides(arg1_shape, rank);
+                    const auto strides2 = broadcast_strides(arg2_shape, rank);
+
+                    const size_t inner = output_shape[rank - 1];
+                    const size_t outer = shape_size(output_shape) / inner;
+                    const size_t inner0 = strides0[rank - 1];
+                    const size_t inner1 = strides1[rank - 1];
+                    const size_t inner2 = strides2[rank - 1];
+
+                    std::vector<size_t> counter(rank, 0);
+                    size_t offset0 = 0, offset1 = 0, offset2 = 0;
+                    for (size_t o = 0; o < outer; ++o)
+                    {
+                        for (size_t i = 0; i < inner; ++i)
+                            *out++ = elementwise_functor(arg0[offset0 + i * inner0],
+                                                         arg1[offset1 + i * inner1],
+                                                         arg2[offset2 + i * inner2]);
+
+                        for (size_t axis = rank - 1; axis-- > 0;)
+                        {
+                            offset0 += strides0[axis];
+                            offset1 += strides1[axis];
+                            offset2 += strides2[axis];
+                            if (++counter[axis] < output_shape[axis])
+                                break;
+                            offset0 -= strides0[axis] * output_shape[axis];
+                            offset1 -= strides1[axis] * output_shape[axis];
+                            offset2 -= strides2[axis] * output_shape[axis];
+                            counter[axis] = 0;
+                        }
+                    }
+                }
+
+                // PDPD broadcasting aligns shape with the target shape starting from axis and
+                // trims trailing ones, the result is NumPy broadcastable to the target shape
+                inline Shape pdpd_padded_shape(const Shape& shape, size_t target_rank, int64_t axis)
+                {
+                    if (axis == -1)
+                    {
+                        axis = target_rank - shape.size();
+                    }
+
+                    Shape padded_shape = shape;
+                    // Trim trailing ones
+                    while (padded_shape.size() > 0 && padded_shape.back() == 1)
+                    {
+                        padded_shape.pop_back();
+                    }
+
+                    padded_shape.insert(padded_shape.begin(), static_cast<size_t>(axis), 1);
+                    padded_shape.resize(target_rank, 1);
+                    return padded_shape;
+                }
             }
 
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -264,81 +370,36 @@ namespace ngraph
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
-                    // We'll be using CoordinateTransform to handle the broadcasting. No need to
-                    // process arg0 and output shape will be the same as arg0. We need to process
-                    // arg1 and the general procedure is as follows:
+                    // No need to process arg0 and output shape will be the same as arg0. arg1 is
+                    // processed as follows:
                     //
                     // (1) Trim trailing ones from arg1 shape.
                     // (2) Left and right pad arg1 to match arg0 shape. Axis is the index start
                     //     to align between arg0 and arg1.
-                    // (3) Squeeze (remove ones from) arg1 shape, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast arg1 to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     23.
+                    // (3) Padding doesn't change the layout of arg1, so the padded shape is
+                    //     NumPy broadcasted to arg0 shape by the fast paths above.
                     //
                     // Example:
                     //
-                    //    Input shape->   Padded shape->   Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [ 3, 4, 5, 6]
-                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [    4, 5   ]     {0,3}
+                    //    Input shape->   Padded shape
+                    //    -----------  ------------
+                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]
+                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]
                     //                      |  |  |
                     //                      v  v  v
                     //                     Output shape
                     //                     ------------
                     //                    [ 3, 4, 5, 6]
-                    {
-                        int64_t axis = broadcast_spec.m_axis;
-                        if (axis == -1)
-                        {
-                            axis = arg0_shape.size() - arg1_shape.size();
-                        }
-
-                        Shape arg1_padded_shape = arg1_shape;
-                        // Trim trailing ones
-                        while (arg1_padded_shape.size() > 0 && arg1_padded_shape.back() == 1)
-                        {
-                            arg1_padded_shape.pop_back();
-                        }
-
-                        for (int64_t i = 0; i < axis; ++i)
-                        {
-                            arg1_padded_shape.insert(arg1_padded_shape.begin(), 1);
-                        }
-
-                        while (arg1_padded_shape.size() < arg0_shape.size())
-                        {
-                            arg1_padded_shape.insert(arg1_padded_shape.end(), 1);
-                        }
-
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg1_squeezed_axes;
-
-                        for (size_t i = 0; i < arg0_shape.size(); i++)
-                        {
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-                        }
-
-                        CoordinateTransform arg0_transform(arg0_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(arg0_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes, false);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(output_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
-                        }
-                    }
+                    autobroadcast_binop(
+                        arg0,
+                        arg1,
+                        out,
+                        arg0_shape,
+                        internal::pdpd_padded_shape(
+                            arg1_shape, arg0_shape.size(), broadcast_spec.m_axis),
+                        op::AutoBroadcastSpec::NUMPY,
+                        elementwise_functor);
+                    break;
                 }
             }
 
@@ -382,85 +443,14 @@ namespace ngraph
                     }
                     break;
                 case op::AutoBroadcastType::NUMPY:
-                    // Uses same approach as autobroadcast_binop.
-                    {
-                        Shape arg0_padded_shape = arg0_shape;
-                        Shape arg1_padded_shape = arg1_shape;
-                        Shape arg2_padded_shape = arg2_shape;
-
-                        while (arg1_padded_shape.size() < arg2_padded_shape.size())
-                        {
-                            arg1_padded_shape.insert(arg1_padded_shape.begin(), 1);
-                        }
-
-                        while (arg2_padded_shape.size() < arg1_padded_shape.size())
-                        {
-                            arg2_padded_shape.insert(arg2_padded_shape.begin(), 1);
-                        }
-
-                        while (arg0_padded_shape.size() < arg1_padded_shape.size())
-                        {
-                            arg0_padded_shape.insert(arg0_padded_shape.begin(), 1);
-                        }
-
-                        Shape arg0_squeezed_shape;
-                        Shape arg1_squeezed_shape;
-                        Shape arg2_squeezed_shape;
-                        AxisSet arg0_squeezed_axes;
-                        AxisSet arg1_squeezed_axes;
-                        AxisSet arg2_squeezed_axes;
-                        Shape output_shape;
-
-                        for (size_t i = 0; i < arg1_padded_shape.size(); i++)
-                        {
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-
-                            if (arg2_padded_shape[i] == 1)
-                            {
-                                arg2_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg2_squeezed_shape.push_back(arg2_padded_shape[i]);
-                            }
-
-                            if (arg0_padded_shape[i] == 1)
-                            {
-                                arg0_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                            }
-
-                            output_shape.push_back(arg1_padded_shape[i] == 1
-                                                       ? arg2_padded_shape[i]
-                                                       : arg1_padded_shape[i]);
-                        }
-
-                        CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform arg2_transform(arg2_squeezed_shape);
-                        CoordinateTransform output_transform(output_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes, false);
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes, false);
-                            Coordinate arg2_coord = reduce(output_coord, arg2_squeezed_axes, false);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)],
-                                                    arg2[arg2_transform.index(arg2_coord)]);
-                        }
-                    }
+                    internal::numpy_autobroadcast_select(arg0,
+                                                         arg1,
+                                                         arg2,
+                                                         out,
+                                                         arg0_shape,
+                                                         arg1_shape,
+                                                         arg2_shape,
+                                                         elementwise_functor);
                     break;
                 case op::AutoBroadcastType::PDPD:
                 {
@@ -471,79 +461,17 @@ namespace ngraph
                         axis = arg1_shape.size() - arg2_shape.size();
                     }
 
-                    Shape arg0_padded_shape = arg0_shape;
-                    Shape arg2_padded_shape = arg2_shape;
-                    // Trim trailing ones
-                    while (arg0_padded_shape.size() > 0 && arg0_padded_shape.back() == 1)
-                    {
-                        arg0_padded_shape.pop_back();
-                    }
-
-                    for (int64_t i = 0; i < axis; ++i)
-                    {
-                        arg0_padded_shape.insert(arg0_padded_shape.begin(), 1);
-                    }
-
-                    while (arg0_padded_shape.size() < arg1_shape.size())
-                    {
-                        arg0_padded_shape.insert(arg0_padded_shape.end(), 1);
-                    }
-
-                    while (arg2_padded_shape.size() > 0 && arg2_padded_shape.back() == 1)
-                    {
-                        arg2_padded_shape.pop_back();
-                    }
-
-                    for (int64_t i = 0; i < axis; ++i)
-                    {
-                        arg2_padded_shape.insert(arg2_padded_shape.begin(), 1);
-                    }
-
-                    while (arg2_padded_shape.size() < arg1_shape.size())
-                    {
-                        arg2_padded_shape.insert(arg2_padded_shape.end(), 1);
-                    }
-
-                    Shape arg0_squeezed_shape;
-                    AxisSet arg0_squeezed_axes;
-                    Shape arg2_squeezed_shape;
-                    AxisSet arg2_squeezed_axes;
-
-                    for (size_t i = 0; i < arg1_shape.size(); i++)
-                    {
-                        if (arg0_padded_shape[i] == 1)
-                        {
-                            arg0_squeezed_axes.insert(i);
-                        }
-                        else
-                        {
-                            arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                        }
-                        if (arg2_padded_shape[i] == 1)
-                        {
-                            arg2_squeezed_axes.insert(i);
-                        }
-                        else
-                        {
-                            arg2_squeezed_shape.push_back(arg2_padded_shape[i]);
-                        }
-                    }
-
-                    CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                    CoordinateTransform arg1_transform(arg1_shape);
-                    CoordinateTransform arg2_transform(arg2_squeezed_shape);
-                    CoordinateTransform output_transform(arg1_shape);
-
-                    for (const Coordinate& output_coord : output_transform)
-                    {
-                        Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes, false);
-                        Coordinate arg2_coord = reduce(output_coord, arg2_squeezed_axes, false);
-                        out[output_transform.index(output_coord)] =
-                            elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                arg1[arg1_transform.index(output_coord)],
-                                                arg2[arg2_transform.index(arg2_coord)]);
-                    }
+                    internal::numpy_autobroadcast_select(
+                        arg0,
+                        arg1,
+                        arg2,
+                        out,
+                        internal::pdpd_padded_shape(arg0_shape, arg1_shape.size(), axis),
+                        arg1_shape,
+                        internal::pdpd_padded_shape(arg2_shape, arg1_shape.size(), axis),
+                        elementwise_functor);
                 }
+                break;
                 }
             }
         }
@@ -16,12 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cfenv>
 #include <cmath>
 #include <functional>
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/util.hpp"
 
@@ -264,6 +266,137 @@ namespace ngraph
                 std::fesetround(old_mode);
             }
 
+            /// \brief Convolution of NC_I... input with OC_C_F... filter without input dilation.
+            ///
+            /// Computes the same sums as general_convolution in the same order, but walks raw
+            /// offsets instead of CoordinateTransform iterators and computes (batch, output
+            /// channel) planes in parallel.
+            template <typename INPUT,
+                      typename FILTER,
+                      typename OUTPUT,
+                      typename ACCUMULATION = typename widen<OUTPUT>::type>
+            void direct_convolution(const INPUT* in,
+                                    const FILTER* filter,
+                                    OUTPUT* out,
+                                    const Shape& in_shape,
+                                    const Shape& filter_shape,
+                                    const Shape& out_shape,
+                                    const Strides& stride,
+                                    const Strides& filter_dilation,
+                                    const CoordinateDiff& in_pad_below,
+                                    const float* input_scale = nullptr,
+                                    const INPUT* input_zero_point = nullptr,
+                                    const float* filter_scale = nullptr,
+                                    const FILTER* filter_zero_point = nullptr,
+                                    const float* output_scale = nullptr,
+                                    const OUTPUT* output_zero_point = nullptr)
+            {
+                const bool is_quantized = input_scale && input_zero_point && filter_scale &&
+                                          filter_zero_point && output_scale && output_zero_point;
+
+                const Shape in_spatial(in_shape.begin() + 2, in_shape.end());
+                const Shape filter_spatial(filter_shape.begin() + 2, filter_shape.end());
+                const Shape out_spatial(out_shape.begin() + 2, out_shape.end());
+                const size_t n_spatial_dimensions = in_spatial.size();
+                const size_t n_in_channels = in_shape[1];
+                const size_t n_out_channels = out_shape[1];
+                const size_t in_spatial_size = shape_size(in_spatial);
+                const size_t filter_spatial_size = shape_size(filter_spatial);
+                const size_t out_spatial_size = shape_size(out_spatial);
+
+                // row-major increment of a coordinate within shape
+                const auto next = [n_spatial_dimensions](Coordinate& coord, const Shape& shape) {
+                    for (size_t i = n_spatial_dimensions; i-- > 0;)
+                    {
+                        if (++coord[i] < shape[i])
+                        {
+                            return;
+                        }
+                        coord[i] = 0;
+                    }
+                };
+
+                auto old_mode = std::fegetround();
+                parallel_for(
+                    out_shape[0] * n_out_channels,
+                    [&](size_t plane) {
+                        // rounding mode is per thread
+                        std::fesetround(FE_TONEAREST);
+                        const size_t batch_index = plane / n_out_channels;
+                        const size_t out_channel = plane % n_out_channels;
+                        const INPUT* in_batch = in + batch_index * n_in_channels * in_spatial_size;
+                        const FILTER* filter_out_channel =
+                            filter + out_channel * n_in_channels * filter_spatial_size;
+                        OUTPUT* out_plane = out + plane * out_spatial_size;
+
+                        Coordinate out_coord(n_spatial_dimensions, 0);
+                        Coordinate filter_coord(n_spatial_dimensions, 0);
+                        for (size_t out_idx = 0; out_idx < out_spatial_size; ++out_idx)
+                        {
+                            ACCUMULATION result = 0;
+                            std::fill(filter_coord.begin(), filter_coord.end(), 0);
+                            for (size_t filter_idx = 0; filter_idx < filter_spatial_size;
+                                 ++filter_idx)
+                            {
+                                // skip filter positions that fall into the padding
+                                bool in_bounds = true;
+                                size_t in_idx = 0;
+                                for (size_t i = 0; i < n_spatial_dimensions; ++i)
+                                {
+                                    std::ptrdiff_t in_coord =
+                                        static_cast<std::ptrdiff_t>(out_coord[i] * stride[i] +
+                                                                    filter_coord[i] *
+                                                                        filter_dilation[i]) -
+                                        in_pad_below[i];
+                                    if (in_coord < 0 ||
+                                        in_coord >= static_cast<std::ptrdiff_t>(in_spatial[i]))
+                                    {
+                                        in_bounds = false;
+                                        break;
+                                    }
+                                    in_idx = in_idx * in_spatial[i] + in_coord;
+                                }
+                                if (in_bounds)
+                                {
+                                    const INPUT* in_ptr = in_batch + in_idx;
+                                    const FILTER* filter_ptr = filter_out_channel + filter_idx;
+                                    for (size_t in_channel = 0; in_channel < n_in_channels;
+                                         ++in_channel)
+                                    {
+                                        ACCUMULATION in_v = static_cast<ACCUMULATION>(
+                                            in_ptr[in_channel * in_spatial_size]);
+                                        ACCUMULATION f_v = static_cast<ACCUMULATION>(
+                                            filter_ptr[in_channel * filter_spatial_size]);
+                                        if (is_quantized)
+                                        {
+                                            in_v = in_v -
+                                                   static_cast<ACCUMULATION>(*input_zero_point);
+                                            f_v = f_v -
+                                                  static_cast<ACCUMULATION>(*filter_zero_point);
+                                        }
+                                        result += in_v * f_v;
+                                    }
+                                }
+                                next(filter_coord, filter_spatial);
+                            }
+                            if (is_quantized)
+                            {
+                                float scale = *input_scale * *filter_scale / *output_scale;
+                                out_plane[out_idx] = static_cast<OUTPUT>(std::round(
+                                                         static_cast<float>(result) * scale)) +
+                                                     *output_zero_point;
+                            }
+                            else
+                            {
+                                out_plane[out_idx] = result;
+                            }
+                            next(out_coord, out_spatial);
+                        }
+                    },
+                    n_in_channels * filter_spatial_size * out_spatial_size);
+                std::fesetround(old_mode);
+            }
+
             template <typename INPUT,
                       typename FILTER,
                       typename OUTPUT,
@@ -287,6 +420,27 @@ namespace ngraph
                              const OUTPUT* output_zero_point = nullptr)
 
             {
+                if (std::all_of(in_dilation.begin(), in_dilation.end(), [](size_t dilation) {
+                        return dilation == 1;
+                    }))
+                {
+                    direct_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(in,
+                                                                            filter,
+                                                                            out,
+                                                                            in_shape,
+                                                                            filter_shape,
+                                                                            out_shape,
+                                                                            stride,
+                                                                            filter_dilation,
+                                                                            in_pad_below,
+                                                                            input_scale,
+                                                                            input_zero_point,
+                                                                            filter_scale,
+                                                                            filter_zero_point,
+                                                                            output_scale,
+                                                                            output_zero_point);
+                    return;
+                }
                 general_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(in,
                                                                          filter,
                                                                          out,
@@ -21,8 +21,12 @@
 
 #include <cfenv>
 #include <functional>
+#include <numeric>
+#include <vector>
+
 #include "convolution.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -31,11 +35,13 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Coordinate based implementation of dot. It is kept to validate dot
+            ///        against it.
             template <typename INPUT0,
                       typename INPUT1,
                       typename OUTPUT,
                       typename ACCUMULATION = typename widen<OUTPUT>::type>
-            void dot(const INPUT0* arg0,
+            void dot_naive(const INPUT0* arg0,
                      const INPUT1* arg1,
                      OUTPUT* out,
                      const Shape& arg0_shape,
@@ -165,6 +171,103 @@ namespace ngraph
                     std::fesetround(old_mode);
                 }
             }
+
+            /// \brief Dot product of arg0 {M..., K...} and arg1 {K..., N...}, where K... are
+            ///        the reduction_axes_count dotted axes.
+            ///
+            /// Row-major data makes this a product of M x K and K x N matrices. Output rows are
+            /// computed in parallel. Within a row k is the outer loop, so arg1 is read by rows,
+            /// while every output element accumulates its products in order of k as dot_naive
+            /// does, so results are the same.
+            template <typename INPUT0,
+                      typename INPUT1,
+                      typename OUTPUT,
+                      typename ACCUMULATION = typename widen<OUTPUT>::type>
+            void dot(const INPUT0* arg0,
+                     const INPUT1* arg1,
+                     OUTPUT* out,
+                     const Shape& arg0_shape,
+                     const Shape& arg1_shape,
+                     const Shape& out_shape,
+                     size_t reduction_axes_count,
+                     const float* input0_scale = nullptr,
+                     const INPUT0* input0_zero_point = nullptr,
+                     const float* input1_scale = nullptr,
+                     const INPUT1* input1_zero_point = nullptr,
+                     const float* output_scale = nullptr,
+                     const OUTPUT* output_zero_point = nullptr)
+            {
+                const bool is_quantized = input0_scale && input0_zero_point && input1_scale &&
+                                          input1_zero_point && output_scale && output_zero_point;
+
+                const auto product = [](Shape::const_iterator begin, Shape::const_iterator end) {
+                    return std::accumulate(begin, end, size_t{1}, std::multiplies<size_t>());
+                };
+                const size_t M =
+                    product(arg0_shape.begin(), arg0_shape.end() - reduction_axes_count);
+                const size_t K =
+                    product(arg1_shape.begin(), arg1_shape.begin() + reduction_axes_count);
+                const size_t N =
+                    product(arg1_shape.begin() + reduction_axes_count, arg1_shape.end());
+
+                const ACCUMULATION zero_point0 =
+                    is_quantized ? static_cast<ACCUMULATION>(*input0_zero_point) : 0;
+                const ACCUMULATION zero_point1 =
+                    is_quantized ? static_cast<ACCUMULATION>(*input1_zero_point) : 0;
+
+                auto old_mode = std::fegetround();
+                parallel_for(M,
+                             [&](size_t m) {
+                                 // rounding mode is per thread
+                                 std::fesetround(FE_TONEAREST);
+                                 std::vector<ACCUMULATION> sums(N, 0);
+                                 const INPUT0* arg0_row = arg0 + m * K;
+                                 for (size_t k = 0; k < K; ++k)
+                                 {
+                                     const INPUT1* arg1_row = arg1 + k * N;
+                                     ACCUMULATION a = static_cast<ACCUMULATION>(arg0_row[k]);
+                                     if (is_quantized)
+                                     {
+                                         a = a - zero_point0;
+                                         for (size_t n = 0; n < N; ++n)
+                                         {
+                                             sums[n] = sums[n] +
+                                                       (a * (static_cast<ACCUMULATION>(arg1_row[n]) -
+                                                             zero_point1));
+                                         }
+                                     }
+                                     else
+                                     {
+                                         for (size_t n = 0; n < N; ++n)
+                                         {
+                                             sums[n] = sums[n] +
+                                                       (a * static_cast<ACCUMULATION>(arg1_row[n]));
+                                         }
+                                     }
+                                 }
+
+                                 OUTPUT* out_row = out + m * N;
+                                 if (is_quantized)
+                                 {
+                                     float scale = *input0_scale * *input1_scale / *output_scale;
+                                     for (size_t n = 0; n < N; ++n)
+                                     {
+                                         out_row[n] = static_cast<OUTPUT>(std::round(
+                                                          static_cast<float>(sums[n]) * scale)) +
+                                                      *output_zero_point;
+                                     }
+                                 }
+                                 else
+                                 {
+                                     for (size_t n = 0; n < N; ++n)
+                                     {
+                                         out_row[n] = sums[n];
+                                     }
+                                 }
+                             },
+                             K * N);
+                std::fesetround(old_mode);
+            }
         }
     }
 }
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Calls func for each index in [0, count) using up to all hardware threads.
+            ///
+            /// \param count      Number of work items
+            /// \param func       Callable taking an item index. Items must be independent.
+            /// \param item_cost  Rough number of operations per item. Small amounts of work are
+            ///                   done in the calling thread, as starting threads costs more.
+            ///
+            /// Exceptions thrown by func are rethrown in the calling thread after all threads
+            /// are joined.
+            template <typename F>
+            void parallel_for(size_t count, F&& func, size_t item_cost = 1 << 16)
+            {
+                constexpr size_t min_work_per_thread = 1 << 16;
+                size_t threads_count = std::max(1u, std::thread::hardware_concurrency());
+                threads_count = std::min(threads_count, count);
+                threads_count = std::min(
+                    threads_count, std::max<size_t>(1, count * item_cost / min_work_per_thread));
+                if (threads_count <= 1)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        func(i);
+                    }
+                    return;
+                }
+
+                std::atomic<size_t> next_index{0};
+                std::vector<std::exception_ptr> errors(threads_count);
+                const auto worker = [&](size_t t) {
+                    try
+                    {
+                        for (size_t i = next_index++; i < count; i = next_index++)
+                        {
+                            func(i);
+                        }
+                    }
+                    catch (...)
+                    {
+                        errors[t] = std::current_exception();
+                    }
+                };
+                std::vector<std::thread> threads;
+                for (size_t t = 1; t < threads_count; ++t)
+                {
+                    threads.emplace_back(worker, t);
+                }
+                worker(0);
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                for (const auto& error : errors)
+                {
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+        }
+    }
+}
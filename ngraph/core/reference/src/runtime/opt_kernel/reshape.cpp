@@ -253,15 +253,34 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
-    switch (in_shape.size())
+    // Trailing axes which keep their places are contiguous in both input and output, so they
+    // are copied as one element. Identity order (plain reshape) turns into a single memcpy.
+    size_t rank = in_shape.size();
+    while (rank > 0 && in_axis_order.size() == in_shape.size() &&
+           in_axis_order[rank - 1] == rank - 1)
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+        elem_size *= in_shape[rank - 1];
+        --rank;
+    }
+
+    const Shape shape(in_shape.begin(), in_shape.begin() + rank);
+    const AxisVector axis_order(in_axis_order.begin(), in_axis_order.begin() + rank);
+    // output is written in row-major order, only the number of its elements matters
+    Shape reshaped(rank);
+    for (size_t i = 0; i < rank; i++)
+    {
+        reshaped[i] = shape[axis_order[i]];
+    }
+
+    switch (rank)
+    {
+    case 0: reshape_in0(in, out, shape, axis_order, reshaped, elem_size); break;
+    case 1: reshape_in1(in, out, shape, axis_order, reshaped, elem_size); break;
+    case 2: reshape_in2(in, out, shape, axis_order, reshaped, elem_size); break;
+    case 3: reshape_in3(in, out, shape, axis_order, reshaped, elem_size); break;
+    case 4: reshape_in4(in, out, shape, axis_order, reshaped, elem_size); break;
+    case 5: reshape_in5(in, out, shape, axis_order, reshaped, elem_size); break;
+    case 6: reshape_in6(in, out, shape, axis_order, reshaped, elem_size); break;
+    default: reference::reshape(in, out, shape, axis_order, reshaped, elem_size); break;
     }
 }
@@ -32,6 +32,7 @@ descriptor::Input::Input(Node* node, size_t index, Output& output)
 {
     m_src_node = std::shared_ptr<Node>(output.get_node());
     output.add_input(this);
+    Node::mark_edges_changed();
 }
 
 descriptor::Input::Input(Node* node, size_t index)
@@ -57,8 +58,10 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    Node::mark_edges_changed();
 
-    if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
+    static const bool replace_check = getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK");
+    if (replace_check)
     {
         // the result of clone_with_new_inputs will be thrown away or
         // an exception will be thrown by `m_node`'s class c-tor
@@ -79,6 +82,7 @@ void descriptor::Input::remove_output()
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
+        Node::mark_edges_changed();
     }
 }
 
@@ -61,6 +61,12 @@ void descriptor::Tensor::set_element_type(const element::Type& element_type)
 
 void descriptor::Tensor::set_partial_shape(const PartialShape& partial_shape)
 {
+    // Revalidation of a graph mostly infers the same static shapes again
+    if (partial_shape.is_static() && m_partial_shape.is_static() &&
+        m_partial_shape == partial_shape)
+    {
+        return;
+    }
     m_partial_shape = partial_shape;
     if (m_partial_shape.is_static())
     {
@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "itt.hpp"
 #include "ngraph/factory_adapter.hpp"
@@ -24,6 +26,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/op_types.hpp"
+#include "ngraph/runtime/reference/parallel.hpp"
 #include "ngraph/util.hpp"
 #include "ngraph/validation_util.hpp"
 
@@ -124,6 +127,31 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    // While no edges were changed since the last sort, all the sorted nodes are still
+    // reachable from the function results, sinks and parameters and thus alive
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    const size_t version = Node::get_edges_version();
+    if (m_ordered_ops_valid && m_ordered_ops_version == version)
+    {
+        vector<shared_ptr<Node>> ordered_ops;
+        ordered_ops.reserve(m_ordered_ops.size());
+        for (const auto& node : m_ordered_ops)
+        {
+            if (auto op = node.lock())
+            {
+                ordered_ops.push_back(std::move(op));
+            }
+            else
+            {
+                break;
+            }
+        }
+        if (ordered_ops.size() == m_ordered_ops.size())
+        {
+            return ordered_ops;
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -138,7 +166,11 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+    m_ordered_ops.assign(ordered_ops.begin(), ordered_ops.end());
+    m_ordered_ops_version = version;
+    m_ordered_ops_valid = true;
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -302,11 +334,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    invalidate_ordered_ops();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    invalidate_ordered_ops();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -355,20 +389,115 @@ int64_t Function::get_result_index(const Output<Node>& value) const
 bool Function::evaluate(const HostTensorVector& output_tensors,
                         const HostTensorVector& input_tensors) const
 {
+    OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::evaluate");
+
     std::map<RawNodeOutput, HostTensorPtr> value_map;
     for (size_t i = 0; i < m_parameters.size(); ++i)
     {
         value_map[m_parameters.at(i)->output(0)] = input_tensors.at(i);
     }
-    OutputVector outputs;
     std::map<RawNodeOutput, HostTensorPtr> output_tensor_map;
     for (size_t i = 0; i < m_results.size(); ++i)
     {
-        auto result = m_results.at(i)->output(0);
-        output_tensor_map[result] = output_tensors.at(i);
-        outputs.push_back(result);
+        output_tensor_map[m_results.at(i)->output(0)] = output_tensors.at(i);
+    }
+
+    // Only ops the results depend on are evaluated. Number of their consumers is counted to
+    // release intermediate tensors as soon as the last consumer is evaluated.
+    const auto ordered_ops = get_ordered_ops();
+    unordered_set<Node*> required(m_results.size());
+    for (const auto& result : m_results)
+    {
+        required.insert(result.get());
+    }
+    std::map<RawNodeOutput, size_t> uses;
+    for (auto it = ordered_ops.rbegin(); it != ordered_ops.rend(); ++it)
+    {
+        Node* node = it->get();
+        if (required.count(node) == 0)
+        {
+            continue;
+        }
+        for (const auto& input : node->inputs())
+        {
+            const auto source = input.get_source_output();
+            required.insert(source.get_node());
+            ++uses[source];
+        }
+    }
+
+    // Ops are grouped by their distance from the inputs. Ops of one group do not depend on each
+    // other, so they are evaluated concurrently.
+    unordered_map<Node*, size_t> depths(required.size());
+    vector<vector<Node*>> levels;
+    for (const auto& op : ordered_ops)
+    {
+        Node* node = op.get();
+        if (required.count(node) == 0 ||
+            (node->get_output_size() > 0 && value_map.count(node->output(0)) != 0))
+        {
+            continue;
+        }
+        size_t depth = 0;
+        for (const auto& input : node->inputs())
+        {
+            const auto producer = depths.find(input.get_source_output().get_node());
+            if (producer != depths.end())
+            {
+                depth = std::max(depth, producer->second + 1);
+            }
+        }
+        depths[node] = depth;
+        if (levels.size() <= depth)
+        {
+            levels.resize(depth + 1);
+        }
+        levels[depth].push_back(node);
+    }
+
+    for (const auto& level : levels)
+    {
+        // value_map is only read while the level is evaluated and updated afterwards
+        vector<HostTensorVector> level_outputs(level.size());
+        runtime::reference::parallel_for(level.size(), [&](size_t i) {
+            Node* node = level[i];
+            HostTensorVector input_tensors;
+            for (const auto& input : node->inputs())
+            {
+                input_tensors.push_back(value_map.at(input.get_source_output()));
+            }
+            HostTensorVector& node_outputs = level_outputs[i];
+            for (const auto& output : node->outputs())
+            {
+                auto it = output_tensor_map.find(output);
+                node_outputs.push_back(it == output_tensor_map.end()
+                                           ? make_shared<HostTensor>(output)
+                                           : it->second);
+            }
+            NGRAPH_CHECK(node->evaluate(node_outputs, input_tensors), "Evaluation failed on ", node);
+        });
+
+        for (size_t i = 0; i < level.size(); ++i)
+        {
+            Node* node = level[i];
+            for (size_t j = 0; j < level_outputs[i].size(); ++j)
+            {
+                const RawNodeOutput output(node, j);
+                if (uses.count(output) != 0)
+                {
+                    value_map[output] = level_outputs[i][j];
+                }
+            }
+            for (const auto& input : node->inputs())
+            {
+                const RawNodeOutput source = input.get_source_output();
+                if (--uses[source] == 0)
+                {
+                    value_map.erase(source);
+                }
+            }
+        }
     }
-    evaluate_nodes(value_map, output_tensor_map, outputs);
     return true;
 }
 
@@ -376,12 +505,14 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    invalidate_ordered_ops();
     return true;
 }
 
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -390,11 +521,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    invalidate_ordered_ops();
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    invalidate_ordered_ops();
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -404,6 +537,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    invalidate_ordered_ops();
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
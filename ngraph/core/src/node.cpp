@@ -27,21 +27,21 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_edges_version(0);
 
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
     , m_control_dependencies(node.m_control_dependencies)
-    // skip m_node_type -- will be generated automatically
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_friendly_name(node.m_friendly_name)
     // skip m_unique_name -- will be generated automatically
-    , m_provenance_tags(node.m_provenance_tags)
-    , m_provenance_group(node.m_provenance_group)
+    , m_provenance(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr)
     , m_inputs(node.m_inputs) // will be modified in the body
     // skip m_outputs -- should be initialized outside
     , m_op_annotations(node.m_op_annotations)
@@ -61,8 +61,7 @@ Node& Node::operator=(const Node& node)
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
     this->m_friendly_name = node.m_friendly_name;
-    this->m_provenance_tags = node.m_provenance_tags;
-    this->m_provenance_group = node.m_provenance_group;
+    this->m_provenance.reset(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr);
     this->m_inputs = node.m_inputs;
     this->m_op_annotations = node.m_op_annotations;
     this->m_rt_info = node.m_rt_info;
@@ -297,14 +296,26 @@ void Node::set_friendly_name(const string& name)
     m_friendly_name = name;
 }
 
+Node::Provenance& Node::get_provenance()
+{
+    if (!m_provenance)
+    {
+        m_provenance.reset(new Provenance());
+    }
+    return *m_provenance;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_provenance().group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_provenance)
+    {
+        m_provenance->group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -323,7 +334,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty;
+    return m_provenance ? m_provenance->group : empty;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -355,7 +367,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (m_provenance->group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -393,13 +405,15 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const std::unordered_set<std::string> empty;
+    return m_provenance ? m_provenance->tags : empty;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    auto& provenance = get_provenance();
+    provenance.tags.insert(tag);
+    for (auto node : provenance.group)
     {
         node->add_provenance_tag(tag);
     }
@@ -407,7 +421,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance)
+    {
+        m_provenance->tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -476,6 +493,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        mark_edges_changed();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -513,6 +531,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            mark_edges_changed();
         }
     }
     {
@@ -535,6 +554,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    mark_edges_changed();
 }
 
 void Node::clear_control_dependents()
@@ -965,7 +985,11 @@ bool Node::constant_fold(OutputVector& output_values, const OutputVector& input_
     {
         if (auto constant = as_type_ptr<op::v0::Constant>(input.get_node_shared_ptr()))
         {
-            auto host_tensor = make_shared<runtime::HostTensor>(constant);
+            // evaluate reads inputs only, so constant data is used in place instead of a copy
+            auto host_tensor = make_shared<runtime::HostTensor>(
+                constant->get_output_element_type(0),
+                constant->get_output_shape(0),
+                const_cast<void*>(constant->get_data_ptr()));
             input_tensors.push_back(host_tensor);
         }
         else
@@ -985,7 +1009,12 @@ bool Node::constant_fold(OutputVector& output_values, const OutputVector& input_
     {
         for (size_t i = 0; i < output_tensors.size(); ++i)
         {
-            output_values[i] = make_shared<op::Constant>(output_tensors[i]);
+            // folded constant takes ownership of evaluated data without copying it
+            auto tensor = output_tensors[i];
+            auto buffer = make_shared<runtime::SharedBuffer<HostTensorPtr>>(
+                static_cast<char*>(tensor->get_data_ptr()), tensor->get_size_in_bytes(), tensor);
+            output_values[i] = make_shared<op::Constant>(
+                tensor->get_element_type(), tensor->get_shape(), buffer);
         }
         return true;
     }
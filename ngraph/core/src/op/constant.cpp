@@ -632,6 +632,7 @@ bool op::v0::Constant::visit_attributes(AttributeVisitor& visitor)
         allocate_buffer();
     }
     visitor.on_attribute("value", m_data);
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
     return true;
 }
 
@@ -331,13 +331,13 @@ Shape PartialShape::to_shape() const
         throw std::invalid_argument("to_shape was called on a dynamic shape.");
     }
 
-    std::vector<size_t> shape_dimensions(m_dimensions.size());
+    Shape shape(m_dimensions.size());
     std::transform(m_dimensions.begin(),
                    m_dimensions.end(),
-                   shape_dimensions.begin(),
+                   shape.begin(),
                    [](const Dimension& d) { return d.get_length(); });
 
-    return shape_dimensions;
+    return shape;
 }
 
 bool PartialShape::merge_into(PartialShape& dst, const PartialShape& src)
@@ -388,6 +388,12 @@ bool PartialShape::broadcast_merge_into(PartialShape& dst,
             // Ranks are both static.
             auto dst_rank = dst.rank().get_length();
             auto src_rank = src.rank().get_length();
+            // Equal static shapes are merged as is. This is the common case on revalidation,
+            // so it is handled without building a new shape
+            if (dst_rank == src_rank && dst.is_static() && src.is_static() && dst == src)
+            {
+                return true;
+            }
             auto new_rank = std::max(dst_rank, src_rank);
             std::vector<Dimension> dims(new_rank);
             bool success = true;
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
 #include <pattern/op/wrap_type.hpp>
@@ -26,7 +27,10 @@
 #include "itt.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/sink.hpp"
+#include "ngraph/op/util/op_types.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -62,6 +66,9 @@ using namespace ngraph;
 // GraphRewrite will automatically add this nodes in the beginning of execution queue.
 // If MatcherPass register more than one node make sure that this nodes are registered in
 // topological order.
+// Nodes are offered only to matchers whose root type is the node type or one of its parents
+// (matchers without typed root are offered to every node), and nodes replaced by previous
+// rewrites are skipped.
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::GraphRewrite, "ngraph::pass::GraphRewrite", 0);
 
@@ -81,9 +88,10 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         nodes_to_run.emplace_back(node);
     }
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers with type based root node are offered only to nodes of that type (or derived
+    // types), others are offered to every node
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> generic_matchers;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index)
     {
         // Skip passes that are disabled
@@ -93,8 +101,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher)
         {
-            all_roots_has_type = false;
-            break;
+            generic_matchers.push_back(matcher_index);
+            continue;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -108,7 +116,7 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
         // it's type
         // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
+        // and matcher is applied to all nodes.
         NodeTypeInfo root_type_info = root->get_type_info();
         if (auto p = dynamic_pointer_cast<pattern::op::Pattern>(root))
         {
@@ -118,16 +126,66 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             }
             else
             {
-                all_roots_has_type = false;
-                break;
+                generic_matchers.push_back(matcher_index);
+                continue;
             }
         }
         type_to_matcher[root_type_info].push_back(matcher_index);
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // Matchers for each node type including ones registered for its parent types and generic
+    // ones, in order of the registration. Collected once per node type.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> node_type_to_matchers;
+    auto get_matchers = [&](const NodeTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto cached = node_type_to_matchers.find(type_info);
+        if (cached != node_type_to_matchers.end())
+        {
+            return cached->second;
+        }
+
+        std::vector<size_t> matchers_to_run(generic_matchers);
+        for (const DiscreteTypeInfo* node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent)
+        {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end())
+            {
+                matchers_to_run.insert(
+                    matchers_to_run.end(), matchers->second.begin(), matchers->second.end());
+            }
+        }
+        std::sort(matchers_to_run.begin(), matchers_to_run.end());
+
+        return node_type_to_matchers.emplace(type_info, std::move(matchers_to_run)).first->second;
+    };
+
+    // Node replaced by one of previous rewrites is not a part of the function anymore
+    auto is_detached = [](const std::shared_ptr<Node>& node) {
+        if (node->get_output_size() == 0 || op::is_output(node) || op::is_parameter(node) ||
+            std::dynamic_pointer_cast<op::Sink>(node))
+        {
+            return false;
+        }
+        for (const auto& output : node->outputs())
+        {
+            if (!output.get_target_inputs().empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // Statistics of matchers are collected only if a pass profile is active
+    struct MatcherStatistics
+    {
+        std::chrono::steady_clock::duration time{0};
+        size_t attempts = 0;
+        size_t matches = 0;
+    };
+    auto profile = PassProfile::get_active();
+    std::vector<MatcherStatistics> matcher_statistics(profile ? m_matchers.size() : 0);
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
@@ -164,13 +222,14 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty())
     {
         auto node = nodes_to_run.front();
         nodes_to_run.pop_front();
+        if (is_detached(node))
+        {
+            continue;
+        }
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
         {
@@ -184,58 +243,43 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type)
+
+        for (size_t matcher_index : get_matchers(node->get_type_info()))
         {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info)
+            bool status = false;
+            if (profile)
             {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end())
-                {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
+                auto start = std::chrono::steady_clock::now();
+                status = run_matcher_pass(m_matchers[matcher_index], node);
+                auto& statistics = matcher_statistics[matcher_index];
+                statistics.time += std::chrono::steady_clock::now() - start;
+                statistics.attempts++;
+                statistics.matches += status ? 1 : 0;
             }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run)
+            else
             {
-                if (run_matcher_pass(m_matchers[matcher_index], node))
-                {
-                    rewritten = true;
-                    break;
-                }
+                status = run_matcher_pass(m_matchers[matcher_index], node);
             }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else
-        {
-            for (auto& m_pass : m_matchers)
+            if (status)
             {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node))
-                {
-                    rewritten = true;
-                    break;
-                }
+                rewritten = true;
+                break;
             }
         }
     }
+
+    for (size_t matcher_index = 0; matcher_index < matcher_statistics.size(); ++matcher_index)
+    {
+        const auto& statistics = matcher_statistics[matcher_index];
+        if (statistics.attempts != 0)
+        {
+            profile->add_matcher(
+                m_matchers[matcher_index]->get_name(),
+                std::chrono::duration_cast<std::chrono::nanoseconds>(statistics.time),
+                statistics.attempts,
+                statistics.matches);
+        }
+    }
     return rewritten;
 }
 
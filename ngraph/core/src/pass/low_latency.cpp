@@ -7,39 +7,35 @@
 #include <memory>
 
 #include <ngraph/opsets/opset5.hpp>
-#include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/variant.hpp>
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::LowLatency, "LowLatency", 0);
 
-ngraph::pass::LowLatency::LowLatency()
+namespace
 {
-    auto tensor_iterator = ngraph::pattern::wrap_type<opset5::TensorIterator>();
-    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
-        auto ti = std::dynamic_pointer_cast<ngraph::opset5::TensorIterator>(m.get_match_root());
-        if (!ti)
-        {
-            return false;
-        }
+    // Inserts ReadValue/Assign pairs for all back edges of TensorIterator or Loop body
+    void process_sub_graph_op(const std::shared_ptr<ngraph::op::util::SubGraphOp>& sub_graph_op)
+    {
+        using namespace ngraph;
 
-        // Mark the TI layer to be unrolled. Enable unconditional ti unrolling for all plugins.
-        auto& rt_info = ti->get_rt_info();
+        // Mark the TI/Loop layer to be unrolled. Enable unconditional unrolling for all plugins.
+        auto& rt_info = sub_graph_op->get_rt_info();
         rt_info["UNROLL_TI"] = std::make_shared<ngraph::VariantWrapper<int64_t>>(1);
 
         int64_t variable_id = 0;
         std::vector<std::shared_ptr<ngraph::op::Sink>> assigns;
-        const auto& func = ti->get_function();
-        for (const auto& in : ti->get_input_descriptions())
+        const auto& func = sub_graph_op->get_function();
+        for (const auto& in : sub_graph_op->get_input_descriptions())
         {
             // Process all back edges
             if (const auto& merged_in = std::dynamic_pointer_cast<
-                    ngraph::opset5::TensorIterator::MergedInputDescription>(in))
+                    ngraph::op::util::SubGraphOp::MergedInputDescription>(in))
             {
                 // Insert ReadValue nodes: Parameter -> (new ReadValue) -> consumers
                 const auto& inputs_to = func->get_parameters()
                                             .at(merged_in->m_body_parameter_index)
                                             ->get_output_target_inputs(0);
-                const std::string variable_name(ti->get_friendly_name() + "/" +
+                const std::string variable_name(sub_graph_op->get_friendly_name() + "/" +
                                                 func->get_parameters()
                                                     .at(merged_in->m_body_parameter_index)
                                                     ->get_friendly_name() +
@@ -63,9 +59,59 @@ ngraph::pass::LowLatency::LowLatency()
         }
         // save Assign in the func so that it gets into graph traversals and isn't deleted.
         func->add_sinks(assigns);
-        return false;
-    };
+    }
+
+    // Replaces the initial state inputs of RNN/GRU/LSTM sequence by ReadValue layers and saves the final
+    // states with Assign layers: state_init -> (new ReadValue) -> Sequence -> state_out -> (new Assign)
+    std::vector<std::shared_ptr<ngraph::op::Sink>>
+        process_sequence(const std::shared_ptr<ngraph::Node>& sequence, size_t states_count)
+    {
+        using namespace ngraph;
+
+        std::vector<std::shared_ptr<ngraph::op::Sink>> assigns;
+        // states are inputs 1, ..., states_count of sequence and its outputs with the same indices
+        for (size_t idx = 1; idx <= states_count; ++idx)
+        {
+            const auto state_init = sequence->input_value(idx);
+            const std::string variable_name(sequence->get_friendly_name() + "/" +
+                                            state_init.get_node()->get_friendly_name() +
+                                            "/variable_" + std::to_string(idx - 1));
+            auto read_value = std::make_shared<opset5::ReadValue>(state_init, variable_name);
+            read_value->set_friendly_name(variable_name);
+            sequence->input(idx).replace_source_output(read_value->output(0));
+
+            auto assign = std::make_shared<opset5::Assign>(sequence->output(idx), variable_name);
+            // control dependency so that ReadValue is processed before Assign
+            assign->add_control_dependency(read_value);
+            assigns.emplace_back(assign);
+        }
+        return assigns;
+    }
+} // namespace
 
-    auto m = std::make_shared<ngraph::pattern::Matcher>(tensor_iterator, "LowLatency");
-    register_matcher(m, callback);
+bool ngraph::pass::LowLatency::run_on_function(std::shared_ptr<ngraph::Function> f)
+{
+    bool is_changed = false;
+    std::vector<std::shared_ptr<ngraph::op::Sink>> assigns;
+    for (const auto& op : f->get_ordered_ops())
+    {
+        if (is_type<opset5::TensorIterator>(op) || is_type<opset5::Loop>(op))
+        {
+            process_sub_graph_op(std::static_pointer_cast<op::util::SubGraphOp>(op));
+            is_changed = true;
+        }
+        else if (is_type<opset5::LSTMSequence>(op))
+        {
+            const auto sequence_assigns = process_sequence(op, 2);
+            assigns.insert(assigns.end(), sequence_assigns.begin(), sequence_assigns.end());
+        }
+        else if (is_type<opset5::GRUSequence>(op) || is_type<opset5::RNNSequence>(op))
+        {
+            const auto sequence_assigns = process_sequence(op, 1);
+            assigns.insert(assigns.end(), sequence_assigns.begin(), sequence_assigns.end());
+        }
+    }
+    // save Assign in the function so that it gets into graph traversals and isn't deleted.
+    f->add_sinks(assigns);
+    return is_changed || !assigns.empty();
 }
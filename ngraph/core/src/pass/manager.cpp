@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <iostream>
 #include <memory>
@@ -73,6 +74,37 @@ namespace ngraph
                 static PerfCounters counters;
                 return counters;
             }
+
+            /// \brief Collects a run of a pass into the active profile, if any
+            class ProfileScope
+            {
+            public:
+                ProfileScope(PassProfile* profile, const std::string& name)
+                    : m_profile(profile)
+                {
+                    if (m_profile)
+                    {
+                        m_record = m_profile->begin_pass(name);
+                        m_start = std::chrono::steady_clock::now();
+                    }
+                }
+
+                ~ProfileScope()
+                {
+                    if (m_profile)
+                    {
+                        m_profile->end_pass(
+                            m_record, std::chrono::steady_clock::now() - m_start, m_changed);
+                    }
+                }
+
+                void set_changed(bool changed) { m_changed = changed; }
+            private:
+                PassProfile* m_profile;
+                size_t m_record = 0;
+                std::chrono::steady_clock::time_point m_start;
+                bool m_changed = false;
+            };
         }
     }
 }
@@ -98,6 +130,13 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
 
     static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
 
+    std::unique_ptr<PassProfile::ScopedActivation> profile_activation;
+    if (m_profile)
+    {
+        profile_activation.reset(new PassProfile::ScopedActivation(*m_profile));
+    }
+    auto profile = PassProfile::get_active();
+
     size_t index = 0;
     stopwatch pass_timer;
     stopwatch overall_timer;
@@ -113,6 +152,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
 
         OV_ITT_SCOPED_TASK(itt::domains::nGraphPass_LT,
                            pass::perf_counters()[pass->get_type_info()]);
+        ProfileScope profile_scope(profile, pass->get_name());
 
         pass_timer.start();
 
@@ -171,6 +211,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             }
         }
         NGRAPH_SUPPRESS_DEPRECATED_END
+        profile_scope.set_changed(function_changed);
 
         if (m_visualize)
         {
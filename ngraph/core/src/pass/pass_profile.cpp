@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/pass/pass_profile.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    pass::PassProfile*& active_profile()
+    {
+        static thread_local pass::PassProfile* profile = nullptr;
+        return profile;
+    }
+}
+
+pass::PassProfile::ScopedActivation::ScopedActivation(PassProfile& profile)
+    : m_previous(active_profile())
+{
+    active_profile() = &profile;
+}
+
+pass::PassProfile::ScopedActivation::~ScopedActivation()
+{
+    active_profile() = m_previous;
+}
+
+pass::PassProfile* pass::PassProfile::get_active()
+{
+    return active_profile();
+}
+
+chrono::nanoseconds pass::PassProfile::get_total_time() const
+{
+    chrono::nanoseconds total{0};
+    for (const auto& record : m_records)
+    {
+        if (record.name.find('/') == string::npos)
+        {
+            total += record.time;
+        }
+    }
+    return total;
+}
+
+void pass::PassProfile::clear()
+{
+    m_records.clear();
+    m_record_index.clear();
+    m_path.clear();
+}
+
+pass::PassProfile::Record& pass::PassProfile::get_record(const string& name)
+{
+    auto it = m_record_index.find(name);
+    if (it == m_record_index.end())
+    {
+        it = m_record_index.emplace(name, m_records.size()).first;
+        m_records.emplace_back();
+        m_records.back().name = name;
+    }
+    return m_records[it->second];
+}
+
+size_t pass::PassProfile::begin_pass(const string& name)
+{
+    m_path.push_back(m_path.empty() ? name : m_path.back() + "/" + name);
+    get_record(m_path.back());
+    return m_record_index.at(m_path.back());
+}
+
+void pass::PassProfile::end_pass(size_t record, chrono::nanoseconds time, bool changed)
+{
+    auto& r = m_records.at(record);
+    r.runs++;
+    r.time += time;
+    r.changed_runs += changed ? 1 : 0;
+    m_path.pop_back();
+}
+
+void pass::PassProfile::add_matcher(const string& name,
+                                    chrono::nanoseconds time,
+                                    size_t match_attempts,
+                                    size_t matches)
+{
+    Record* record = nullptr;
+    if (m_path.empty())
+    {
+        record = &get_record(name);
+    }
+    else
+    {
+        // a MatcherPass registered in pass::Manager directly runs inside a GraphRewrite of the
+        // same name, so its statistics are merged into the record of the GraphRewrite
+        const auto& current = m_path.back();
+        auto last = current.rfind('/');
+        auto current_name = last == string::npos ? current : current.substr(last + 1);
+        record = current_name == name ? &get_record(current) : &get_record(current + "/" + name);
+    }
+    record->match_attempts += match_attempts;
+    record->matches += matches;
+    if (record->name != (m_path.empty() ? string() : m_path.back()))
+    {
+        record->time += time;
+    }
+}
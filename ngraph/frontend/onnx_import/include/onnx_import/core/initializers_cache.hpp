@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "ngraph/op/constant.hpp"
+
+namespace ONNX_NAMESPACE
+{
+    class TensorProto;
+}
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        /// \brief      InitializersCache lets initializers with the same type, shape and raw data
+        ///             share one buffer across imports of different models and subgraphs.
+        ///
+        /// \note       The cache is disabled by default. It holds weak references only, so a
+        ///             buffer lives as long as one of the functions using it.
+        class InitializersCache
+        {
+        public:
+            static InitializersCache& get();
+
+            /// \brief      Enables or disables reuse of the known initializers.
+            ///
+            /// \param[in]  enabled    The value to set.
+            void set_enabled(bool enabled) { m_enabled = enabled; }
+            bool is_enabled() const { return m_enabled; }
+
+            /// \brief      Creates a Constant node for the initializer.
+            ///
+            /// \note       When the cache is enabled and an initializer with the same raw data
+            ///             was created before, the Constant references its buffer instead of
+            ///             decoding the data again. Initializers without inline raw data are
+            ///             always decoded.
+            ///
+            /// \param[in]  tensor_proto   The initializer to create a Constant for.
+            ///
+            /// \return     The Constant node named as the initializer.
+            std::shared_ptr<ngraph::op::Constant>
+                get_ng_constant(const ONNX_NAMESPACE::TensorProto& tensor_proto);
+
+        private:
+            InitializersCache() = default;
+
+            std::unordered_multimap<std::size_t, std::weak_ptr<ngraph::op::Constant>>
+                m_constants;
+            std::size_t m_purge_size{64};
+            std::mutex m_mutex;
+            std::atomic<bool> m_enabled{false};
+        };
+
+    } // namespace onnx_import
+} // namespace ngraph
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -606,8 +607,34 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+                const auto byte_size = shape_size(m_shape) * sizeof(T);
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    // constant references mapped external data instead of holding its copy
+                    auto buffer =
+                        detail::TensorExternalData(*m_tensor_proto).load_external_mmap_data();
+                    if (buffer->size() >= byte_size &&
+                        reinterpret_cast<std::uintptr_t>(buffer->get_ptr()) % alignof(T) == 0)
+                    {
+                        constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                }
+                else if (m_tensor_proto->has_raw_data() &&
+                         m_tensor_proto->raw_data().size() >= byte_size)
+                {
+                    // raw data has the layout of the constant, so it is copied once as is
+                    constant = std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                if (!constant)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -85,6 +85,16 @@ namespace ngraph
         ONNX_IMPORTER_API
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path);
 
+        /// \brief      Enables or disables sharing of initializers between imported models.
+        ///
+        /// \note       When enabled, initializers with the same type, shape and raw data share
+        ///             one buffer across all imports in the process (including If and Loop
+        ///             bodies) and are decoded only once. Disabled by default.
+        ///
+        /// \param[in]  enabled    The value to set.
+        ONNX_IMPORTER_API
+        void set_initializers_sharing(bool enabled);
+
     } // namespace onnx_import
 
 } // namespace ngraph
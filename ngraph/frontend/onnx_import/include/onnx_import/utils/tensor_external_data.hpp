@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 
+#include "ngraph/runtime/shared_buffer.hpp"
+
 namespace ngraph
 {
     namespace onnx_import
@@ -39,6 +42,17 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                using Buffer = std::shared_ptr<runtime::SharedBuffer<std::shared_ptr<void>>>;
+
+                /// \brief      Map external data from tensor passed to constructor into memory
+                ///
+                /// \note       The region is mapped copy-on-write, so it is not read until
+                ///             it is accessed. Where mapping is not supported the data is
+                ///             read into memory owned by the buffer instead.
+                ///
+                /// \return     Buffer referencing external data which keeps it alive
+                Buffer load_external_mmap_data() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
@@ -14,15 +14,20 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <exception>
 #include <functional>
 #include <numeric>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/provenance.hpp"
 #include "onnx_import/core/graph.hpp"
+#include "onnx_import/core/initializers_cache.hpp"
 #include "onnx_import/core/node.hpp"
 #include "onnx_import/exceptions.hpp"
 #include "onnx_import/utils/common.hpp"
@@ -46,6 +51,34 @@ namespace ngraph
                 return result;
             }
 
+            /// \brief      Calls func for each index in [0, count) using all hardware threads.
+            ///
+            /// \note       Indices are handed out one by one, so items of very different cost
+            ///             are balanced between threads. func must not throw.
+            template <typename F>
+            static void parallel_for(std::size_t count, F&& func)
+            {
+                const std::size_t threads_count = std::min<std::size_t>(
+                    count, std::max(1u, std::thread::hardware_concurrency()));
+                std::atomic<std::size_t> next_index{0};
+                const auto worker = [&]() {
+                    for (std::size_t i = next_index++; i < count; i = next_index++)
+                    {
+                        func(i);
+                    }
+                };
+                std::vector<std::thread> threads;
+                for (std::size_t t = 1; t < threads_count; ++t)
+                {
+                    threads.emplace_back(worker);
+                }
+                worker();
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+            }
+
             /// \brief      Gets the operator represented by provided node unique identificator.
             ///
             /// \param[in]  node_proto  The node protobuf representation object.
@@ -76,17 +109,44 @@ namespace ngraph
             , m_cache{std::move(cache)}
         {
             std::map<std::string, Tensor> initializers;
+            // Decoding of initializers dominates import time of large models. They do not
+            // depend on each other, so their Constants are created in parallel up front and
+            // errors are reported below in the initializers order.
+            const auto& initializer_protos = m_graph_proto->initializer();
+            const std::size_t initializers_count = initializer_protos.size();
+            std::vector<std::shared_ptr<default_opset::Constant>> constants(initializers_count);
+            std::vector<std::exception_ptr> errors(initializers_count);
+            detail::parallel_for(initializers_count, [&](std::size_t i) {
+                const auto& initializer_tensor = initializer_protos.Get(static_cast<int>(i));
+                if (initializer_tensor.has_name())
+                {
+                    try
+                    {
+                        constants[i] =
+                            InitializersCache::get().get_ng_constant(initializer_tensor);
+                    }
+                    catch (...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                }
+            });
+
             // Process all initializers in the graph
-            for (const auto& initializer_tensor : m_graph_proto->initializer())
+            for (std::size_t i = 0; i < initializers_count; ++i)
             {
+                const auto& initializer_tensor = initializer_protos.Get(static_cast<int>(i));
                 if (initializer_tensor.has_name())
                 {
                     Tensor tensor = Tensor{initializer_tensor};
-                    std::shared_ptr<default_opset::Constant> ng_constant;
+                    std::shared_ptr<default_opset::Constant> ng_constant = constants[i];
                     // For each initializer create a Constant node and store it in cache
                     try
                     {
-                        ng_constant = tensor.get_ng_constant();
+                        if (errors[i])
+                        {
+                            std::rethrow_exception(errors[i]);
+                        }
                     }
                     catch (const error::invalid_external_data&)
                     {
@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "onnx_import/core/initializers_cache.hpp"
+#include "onnx_import/core/tensor.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace
+        {
+            bool is_same(const op::Constant& constant,
+                         const Tensor& tensor,
+                         const std::string& raw_data)
+            {
+                return constant.get_element_type() == tensor.get_ng_type() &&
+                       constant.get_shape() == tensor.get_shape() &&
+                       shape_size(constant.get_shape()) * constant.get_element_type().size() ==
+                           raw_data.size() &&
+                       std::memcmp(constant.get_data_ptr(), raw_data.data(), raw_data.size()) == 0;
+            }
+        }
+
+        InitializersCache& InitializersCache::get()
+        {
+            static InitializersCache cache;
+            return cache;
+        }
+
+        std::shared_ptr<op::Constant>
+            InitializersCache::get_ng_constant(const ONNX_NAMESPACE::TensorProto& tensor_proto)
+        {
+            const Tensor tensor{tensor_proto};
+            if (!m_enabled || !tensor_proto.has_raw_data() ||
+                detail::tensor::detail::has_tensor_external_data(tensor_proto))
+            {
+                return tensor.get_ng_constant();
+            }
+
+            const auto& raw_data = tensor_proto.raw_data();
+            const auto hash = std::hash<std::string>{}(raw_data);
+            std::shared_ptr<op::Constant> known;
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                const auto range = m_constants.equal_range(hash);
+                for (auto it = range.first; it != range.second && !known; ++it)
+                {
+                    auto candidate = it->second.lock();
+                    if (candidate && is_same(*candidate, tensor, raw_data))
+                    {
+                        known = candidate;
+                    }
+                }
+            }
+
+            if (known)
+            {
+                // the buffer keeps the known constant alive, so it outlives the function it
+                // was imported with
+                auto data = static_cast<char*>(const_cast<void*>(known->get_data_ptr()));
+                using Buffer = runtime::SharedBuffer<std::shared_ptr<op::Constant>>;
+                auto buffer = std::make_shared<Buffer>(data, raw_data.size(), known);
+                auto constant = std::make_shared<op::Constant>(
+                    known->get_element_type(), known->get_shape(), buffer);
+                if (tensor_proto.has_name())
+                {
+                    constant->set_friendly_name(tensor.get_name());
+                }
+                return constant;
+            }
+
+            auto constant = tensor.get_ng_constant();
+            std::lock_guard<std::mutex> lock{m_mutex};
+            // expired entries are dropped when the cache doubles, so inserts stay amortized O(1)
+            if (m_constants.size() >= m_purge_size)
+            {
+                for (auto it = m_constants.begin(); it != m_constants.end();)
+                {
+                    it = it->second.expired() ? m_constants.erase(it) : std::next(it);
+                }
+                m_purge_size = std::max<std::size_t>(m_purge_size, 2 * m_constants.size());
+            }
+            m_constants.emplace(hash, constant);
+            return constant;
+        }
+
+    } // namespace onnx_import
+} // namespace ngraph
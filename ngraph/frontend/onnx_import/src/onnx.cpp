@@ -21,6 +21,7 @@
 
 #include "ngraph/except.hpp"
 #include "onnx_import/core/graph.hpp"
+#include "onnx_import/core/initializers_cache.hpp"
 #include "onnx_import/core/model.hpp"
 #include "onnx_import/core/transform.hpp"
 #include "onnx_import/onnx.hpp"
@@ -160,6 +161,11 @@ namespace ngraph
                 op_name, version, domain == "ai.onnx" ? "" : domain);
         }
 
+        void set_initializers_sharing(bool enabled)
+        {
+            InitializersCache::get().set_enabled(enabled);
+        }
+
     } // namespace onnx_import
 
 } // namespace ngraph
@@ -16,6 +16,12 @@
 
 #include <fstream>
 #include <sstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
@@ -84,6 +90,59 @@ namespace ngraph
                 return read_data;
             }
 
+            TensorExternalData::Buffer TensorExternalData::load_external_mmap_data() const
+            {
+#ifndef _WIN32
+                const int fd = open(m_data_location.c_str(), O_RDONLY);
+                if (fd == -1)
+                    throw error::invalid_external_data{*this};
+
+                struct stat file_stat = {};
+                const bool stat_ok = fstat(fd, &file_stat) != -1;
+                const size_t file_size = stat_ok ? static_cast<size_t>(file_stat.st_size) : 0;
+                const size_t offset = static_cast<size_t>(m_offset);
+                if (!stat_ok || offset > file_size ||
+                    offset + static_cast<size_t>(m_data_lenght) > file_size)
+                {
+                    close(fd);
+                    throw error::invalid_external_data{*this};
+                }
+                // zero length means the rest of the file
+                const size_t length = m_data_lenght == 0 ? file_size - offset : m_data_lenght;
+
+                if (length != 0)
+                {
+                    // mmap offset has to be aligned to page size, so the mapping may start
+                    // a bit before the requested region
+                    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                    const size_t map_offset = offset / page_size * page_size;
+                    const size_t map_size = length + offset - map_offset;
+                    void* map = mmap(nullptr,
+                                     map_size,
+                                     PROT_READ | PROT_WRITE,
+                                     MAP_PRIVATE,
+                                     fd,
+                                     static_cast<off_t>(map_offset));
+                    close(fd);
+                    if (map != MAP_FAILED)
+                    {
+                        std::shared_ptr<void> holder(
+                            map, [map_size](void* ptr) { munmap(ptr, map_size); });
+                        return std::make_shared<runtime::SharedBuffer<std::shared_ptr<void>>>(
+                            static_cast<char*>(map) + (offset - map_offset), length, holder);
+                    }
+                }
+                else
+                {
+                    close(fd);
+                }
+#endif
+                auto data = std::make_shared<std::string>(load_external_data());
+                std::shared_ptr<void> holder = data;
+                return std::make_shared<runtime::SharedBuffer<std::shared_ptr<void>>>(
+                    &(*data)[0], data->size(), holder);
+            }
+
             std::string TensorExternalData::to_string() const
             {
                 std::stringstream s;
@@ -0,0 +1,195 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Element index of shape broadcasted to the right-aligned output coordinate
+    size_t broadcast_index(const Shape& shape, const Coordinate& output_coord)
+    {
+        size_t index = 0;
+        const size_t padding = output_coord.size() - shape.size();
+        for (size_t i = 0; i < shape.size(); ++i)
+        {
+            index = index * shape[i] + (shape[i] == 1 ? 0 : output_coord[padding + i]);
+        }
+        return index;
+    }
+
+    // Per-element coordinate based broadcasting, which the reference implementation used before
+    template <typename T>
+    vector<T> select_per_coordinate(const vector<char>& arg0,
+                                    const vector<T>& arg1,
+                                    const vector<T>& arg2,
+                                    const Shape& arg0_shape,
+                                    const Shape& arg1_shape,
+                                    const Shape& arg2_shape,
+                                    const Shape& output_shape)
+    {
+        vector<T> out;
+        for (const Coordinate& coord : CoordinateTransform(output_shape))
+        {
+            out.push_back(arg0[broadcast_index(arg0_shape, coord)]
+                              ? arg1[broadcast_index(arg1_shape, coord)]
+                              : arg2[broadcast_index(arg2_shape, coord)]);
+        }
+        return out;
+    }
+
+    template <typename T>
+    vector<T> iota_vector(size_t size, T start = 0)
+    {
+        vector<T> v(size);
+        iota(v.begin(), v.end(), start);
+        return v;
+    }
+
+    vector<char> mask_vector(size_t size)
+    {
+        vector<char> v(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            v[i] = i % 3 == 0;
+        }
+        return v;
+    }
+
+    auto select_functor = [](char s, float x, float y) { return static_cast<bool>(s) ? x : y; };
+}
+
+TEST(autobroadcast_binop, pdpd)
+{
+    const Shape arg0_shape{2, 3, 4};
+    const Shape arg1_shape{3, 1};
+    const auto arg0 = iota_vector<float>(shape_size(arg0_shape));
+    const vector<float> arg1{100.f, 200.f, 300.f};
+
+    vector<float> out(shape_size(arg0_shape));
+    runtime::reference::autobroadcast_binop(arg0.data(),
+                                            arg1.data(),
+                                            out.data(),
+                                            arg0_shape,
+                                            arg1_shape,
+                                            op::AutoBroadcastSpec(op::AutoBroadcastType::PDPD, 1),
+                                            [](float x, float y) { return x + y; });
+
+    for (const Coordinate& c : CoordinateTransform(arg0_shape))
+    {
+        const size_t idx = (c[0] * 3 + c[1]) * 4 + c[2];
+        EXPECT_EQ(arg0[idx] + arg1[c[1]], out[idx]);
+    }
+}
+
+TEST(autobroadcast_select, numpy)
+{
+    const vector<vector<Shape>> shapes{
+        // arg0, arg1, arg2, output
+        {{2, 3, 4}, {2, 3, 4}, {2, 3, 4}, {2, 3, 4}},
+        {{}, {2, 3, 4}, {4}, {2, 3, 4}},
+        {{2, 1, 4}, {3, 1}, {1}, {2, 3, 4}},
+        {{5, 1}, {1, 6}, {5, 6}, {5, 6}},
+        {{1, 1, 2, 1}, {3, 1, 1}, {7}, {1, 3, 2, 7}},
+        {{0, 3}, {1, 3}, {3}, {0, 3}}};
+
+    for (const auto& s : shapes)
+    {
+        const auto arg0 = mask_vector(shape_size(s[0]));
+        const auto arg1 = iota_vector<float>(shape_size(s[1]), 1.f);
+        const auto arg2 = iota_vector<float>(shape_size(s[2]), -100.f);
+
+        vector<float> out(shape_size(s[3]));
+        runtime::reference::autobroadcast_select(arg0.data(),
+                                                 arg1.data(),
+                                                 arg2.data(),
+                                                 out.data(),
+                                                 s[0],
+                                                 s[1],
+                                                 s[2],
+                                                 op::AutoBroadcastSpec::NUMPY,
+                                                 select_functor);
+        EXPECT_EQ(select_per_coordinate(arg0, arg1, arg2, s[0], s[1], s[2], s[3]), out);
+    }
+}
+
+TEST(autobroadcast_select, pdpd)
+{
+    const Shape arg0_shape{3, 1};
+    const Shape arg1_shape{2, 3, 4};
+    const Shape arg2_shape{3};
+    const auto arg0 = mask_vector(shape_size(arg0_shape));
+    const auto arg1 = iota_vector<float>(shape_size(arg1_shape), 1.f);
+    const auto arg2 = iota_vector<float>(shape_size(arg2_shape), -100.f);
+
+    vector<float> out(shape_size(arg1_shape));
+    runtime::reference::autobroadcast_select(arg0.data(),
+                                             arg1.data(),
+                                             arg2.data(),
+                                             out.data(),
+                                             arg0_shape,
+                                             arg1_shape,
+                                             arg2_shape,
+                                             op::AutoBroadcastSpec(op::AutoBroadcastType::PDPD, 1),
+                                             select_functor);
+    EXPECT_EQ(
+        select_per_coordinate(
+            arg0, arg1, arg2, Shape{1, 3, 1}, arg1_shape, Shape{1, 3, 1}, arg1_shape),
+        out);
+}
+
+TEST(benchmark, autobroadcast_select)
+{
+    const Shape arg0_shape{64, 1, 128};
+    const Shape arg1_shape{64, 256, 128};
+    const Shape arg2_shape{128};
+    const auto arg0 = mask_vector(shape_size(arg0_shape));
+    const auto arg1 = iota_vector<float>(shape_size(arg1_shape));
+    const auto arg2 = iota_vector<float>(shape_size(arg2_shape));
+    vector<float> out(shape_size(arg1_shape));
+
+    stopwatch timer;
+    timer.start();
+    const auto expected =
+        select_per_coordinate(arg0, arg1, arg2, arg0_shape, arg1_shape, arg2_shape, arg1_shape);
+    timer.stop();
+    cout << "per coordinate: " << timer.get_milliseconds() << " ms" << endl;
+
+    timer.start();
+    runtime::reference::autobroadcast_select(arg0.data(),
+                                             arg1.data(),
+                                             arg2.data(),
+                                             out.data(),
+                                             arg0_shape,
+                                             arg1_shape,
+                                             arg2_shape,
+                                             op::AutoBroadcastSpec::NUMPY,
+                                             select_functor);
+    timer.stop();
+    cout << "strided: " << timer.get_milliseconds() << " ms" << endl;
+    EXPECT_EQ(expected, out);
+}
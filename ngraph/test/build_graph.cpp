@@ -363,3 +363,32 @@ TEST(build_graph, build_graph_with_remove_result)
     nodes = f->get_ops();
     EXPECT_EQ(nodes.size(), 5);
 }
+
+TEST(build_graph, ordered_ops_follow_graph_changes)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto relu = make_shared<op::Relu>(arg);
+    auto res = make_shared<op::Result>(relu);
+    auto f = make_shared<Function>(ResultVector{res}, ParameterVector{arg});
+
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, (NodeVector{arg, relu, res}));
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+
+    auto abs = make_shared<op::Abs>(relu);
+    res->input(0).replace_source_output(abs);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, (NodeVector{arg, relu, abs, res}));
+
+    // order kept by the function does not prolong life of removed nodes
+    weak_ptr<Node> weak_abs = abs;
+    res->input(0).replace_source_output(relu);
+    abs.reset();
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops, (NodeVector{arg, relu, res}));
+    EXPECT_TRUE(weak_abs.expired());
+
+    auto res2 = make_shared<op::Result>(relu);
+    f->add_results(ResultVector{res2});
+    EXPECT_EQ(f->get_ordered_ops().size(), 4);
+}
@@ -2045,6 +2045,35 @@ TEST(constant_folding, constant_transpose)
     ASSERT_TRUE(test::all_close_f(values_permute, values_out, MIN_FLOAT_TOLERANCE_BITS));
 }
 
+TEST(constant_folding, constant_transpose_inner_axis_kept)
+{
+    Shape shape_in{2, 3, 2};
+    vector<int32_t> values_in{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    Shape shape_perm{3};
+    vector<int64_t> values_perm{1, 0, 2};
+
+    auto constant_in = make_shared<op::Constant>(element::i32, shape_in, values_in);
+    auto constant_perm = make_shared<op::Constant>(element::i64, shape_perm, values_perm);
+    auto transpose = make_shared<op::Transpose>(constant_in, constant_perm);
+    auto f = make_shared<Function>(transpose, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Transpose>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+
+    auto new_const =
+        as_type_ptr<op::Constant>(f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_shape(), (Shape{3, 2, 2}));
+
+    vector<int32_t> values_permute{0, 1, 6, 7, 2, 3, 8, 9, 4, 5, 10, 11};
+    ASSERT_EQ(values_permute, new_const->get_vector<int32_t>());
+}
+
 template <typename T>
 void range_test(T start, T stop, T step, const vector<T>& values_expected)
 {
@@ -113,3 +113,21 @@ TEST(node_input_output, output_create_const)
 
     EXPECT_THROW(add->output(1), std::out_of_range);
 }
+
+TEST(node_input_output, many_inputs_keep_targets)
+{
+    // Output descriptors refer to input descriptors by address, which must stay valid while
+    // the inputs of a node are being appended
+    auto x = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    OutputVector args(1000, x);
+    auto concat = make_shared<op::Concat>(args, 0);
+
+    auto targets = x->output(0).get_target_inputs();
+    ASSERT_EQ(targets.size(), args.size());
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        EXPECT_EQ(targets.count(concat->input(i)), 1);
+        EXPECT_EQ(concat->input(i).get_source_output(), Output<Node>(x, 0));
+    }
+    EXPECT_EQ(concat->get_output_shape(0), (Shape{1000, 2}));
+}
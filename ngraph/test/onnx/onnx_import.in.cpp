@@ -194,6 +194,39 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_add_abc_initializers)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_initializers_sharing)
+{
+    const auto constant_data = [](const std::shared_ptr<Function>& function) -> const void* {
+        for (const auto& op : function->get_ops())
+        {
+            if (op->get_friendly_name() == "A")
+            {
+                return as_type_ptr<onnx_import::default_opset::Constant>(op)->get_data_ptr();
+            }
+        }
+        return nullptr;
+    };
+    const auto model_path =
+        file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_initializers.prototxt");
+
+    auto not_shared = onnx_import::import_onnx_model(model_path);
+    onnx_import::set_initializers_sharing(true);
+    auto first = onnx_import::import_onnx_model(model_path);
+    auto second = onnx_import::import_onnx_model(model_path);
+    onnx_import::set_initializers_sharing(false);
+
+    ASSERT_NE(constant_data(first), nullptr);
+    EXPECT_EQ(constant_data(first), constant_data(second));
+    EXPECT_NE(constant_data(first), constant_data(not_shared));
+
+    // the shared buffer outlives the function it was imported with
+    first.reset();
+    auto test_case = test::TestCase<TestEngine>(second);
+    test_case.add_input<float>({1, 2, 3, 4});
+    test_case.add_expected_output<float>({3, 6, 9, 12});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_model_override_op)
 {
     onnx_import::register_operator(
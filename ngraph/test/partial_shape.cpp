@@ -494,6 +494,15 @@ TEST(partial_shape, partial_shape_broadcast_merge_into_dynamic_rank)
     ASSERT_TRUE(s2.same_scheme(PartialShape::dynamic()));
 }
 
+TEST(partial_shape, partial_shape_broadcast_merge_into_equal_static)
+{
+    PartialShape s1{2, 3, 4};
+    ASSERT_TRUE(
+        PartialShape::broadcast_merge_into(s1, PartialShape{2, 3, 4}, op::AutoBroadcastType::NUMPY));
+    ASSERT_TRUE(s1.same_scheme(PartialShape{2, 3, 4}));
+    ASSERT_EQ(s1.to_shape(), (Shape{2, 3, 4}));
+}
+
 TEST(partial_shape, partial_shape_broadcast_merge_into)
 {
     PartialShape s1{5, Dimension::dynamic(), 3, 4};
@@ -0,0 +1,143 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/pass_profile.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+using namespace ::testing;
+using namespace std;
+using namespace ngraph;
+
+class ProfileRenameReLU : public ngraph::pass::MatcherPass
+{
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ProfileRenameReLU()
+        : MatcherPass()
+    {
+        auto relu = pattern::wrap_type<opset3::Relu>();
+        ngraph::matcher_pass_callback callback = [](pattern::Matcher& m) {
+            m.get_match_root()->set_friendly_name("renamed");
+            return true;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(relu, "ProfileRenameReLU");
+        this->register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(ProfileRenameReLU, "ProfileRenameReLU", 0);
+
+class ProfileRewrite : public ngraph::pass::GraphRewrite
+{
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ProfileRewrite() { add_matcher<ProfileRenameReLU>(); }
+};
+
+NGRAPH_RTTI_DEFINITION(ProfileRewrite, "ProfileRewrite", 0);
+
+class ProfileNestedManager : public ngraph::pass::FunctionPass
+{
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    bool run_on_function(std::shared_ptr<Function> f) override
+    {
+        pass::Manager manager(get_pass_config());
+        manager.register_pass<ProfileRewrite>();
+        manager.run_passes(f);
+        return false;
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(ProfileNestedManager, "ProfileNestedManager", 0);
+
+static std::shared_ptr<Function> get_profile_test_function()
+{
+    auto data = std::make_shared<opset3::Parameter>(element::f32, Shape{3, 1, 2});
+    auto relu1 = std::make_shared<opset3::Relu>(data);
+    auto relu2 = std::make_shared<opset3::Relu>(relu1);
+    auto sigmoid = std::make_shared<opset3::Sigmoid>(relu2);
+    return std::make_shared<Function>(NodeVector{sigmoid}, ParameterVector{data});
+}
+
+static const pass::PassProfile::Record* find_record(const pass::PassProfile& profile,
+                                                    const std::string& name)
+{
+    for (const auto& record : profile.get_records())
+    {
+        if (record.name == name)
+        {
+            return &record;
+        }
+    }
+    return nullptr;
+}
+
+TEST(PassProfile, collects_nested_passes_and_matchers)
+{
+    auto f = get_profile_test_function();
+    auto profile = std::make_shared<pass::PassProfile>();
+
+    pass::Manager manager;
+    manager.set_per_pass_validation(false);
+    manager.register_pass<ProfileNestedManager>();
+    manager.set_profile(profile);
+    manager.run_passes(f);
+
+    auto nested = find_record(*profile, "ProfileNestedManager");
+    ASSERT_NE(nested, nullptr);
+    EXPECT_EQ(nested->runs, 1);
+    EXPECT_EQ(nested->changed_runs, 0);
+
+    auto rewrite = find_record(*profile, "ProfileNestedManager/ProfileRewrite");
+    ASSERT_NE(rewrite, nullptr);
+    EXPECT_EQ(rewrite->runs, 1);
+    EXPECT_EQ(rewrite->changed_runs, 1);
+
+    auto matcher = find_record(*profile, "ProfileNestedManager/ProfileRewrite/ProfileRenameReLU");
+    ASSERT_NE(matcher, nullptr);
+    EXPECT_EQ(matcher->runs, 0);
+    EXPECT_EQ(matcher->match_attempts, 2);
+    EXPECT_EQ(matcher->matches, 2);
+
+    EXPECT_EQ(profile->get_total_time(), nested->time);
+    EXPECT_EQ(pass::PassProfile::get_active(), nullptr);
+}
+
+TEST(PassProfile, matcher_registered_in_manager_is_merged)
+{
+    auto f = get_profile_test_function();
+    pass::PassProfile profile;
+    {
+        pass::PassProfile::ScopedActivation activation(profile);
+        pass::Manager manager;
+        manager.set_per_pass_validation(false);
+        manager.register_pass<ProfileRenameReLU>();
+        manager.run_passes(f);
+        manager.run_passes(f);
+    }
+
+    ASSERT_EQ(profile.get_records().size(), 1);
+    const auto& record = profile.get_records().front();
+    EXPECT_EQ(record.name, "ProfileRenameReLU");
+    EXPECT_EQ(record.runs, 2);
+    EXPECT_EQ(record.match_attempts, 4);
+    EXPECT_EQ(record.matches, 4);
+}
+
+TEST(PassProfile, nothing_is_collected_without_activation)
+{
+    auto f = get_profile_test_function();
+    pass::PassProfile profile;
+    pass::Manager manager;
+    manager.register_pass<ProfileRewrite>();
+    manager.run_passes(f);
+    EXPECT_TRUE(profile.get_records().empty());
+}
@@ -65,6 +65,18 @@
     *        OV_CASE(Precision::I8, int8_t),
     *        OV_CASE(Precision::FP32, float));
     *
+    *  III. ISA-specific code path selection:
+    *
+    *    if (OV_ISA(MyModule, avx512_common, mayiuse(avx512_common))) {
+    *        kernel.reset(new jit_kernel<avx512_common>());
+    *    } else if (OV_ISA(MyModule, avx2, mayiuse(avx2))) {
+    *        kernel.reset(new jit_kernel<avx2>());
+    *    }
+    *
+    *      The analyzer records the ISA whose runtime check was passed. The selective build
+    *    replaces checks for ISAs which were not recorded by a constant false, so the branch
+    *    falls through to the next one and the code behind it is dropped by the compiler.
+    *
 */
 
 #include <openvino/itt.hpp>
@@ -137,7 +149,8 @@ bool match(Ctx && ctx, T && val, Case && cs, Cases&&... cases) {
 #define OV_CC_DOMAINS(Module)                                                                       \
     OV_ITT_DOMAIN(OV_CC_CAT(SIMPLE_, Module));  /* Domain for simple scope surrounded by ifdefs */  \
     OV_ITT_DOMAIN(OV_CC_CAT(SWITCH_, Module));  /* Domain for switch/cases */                       \
-    OV_ITT_DOMAIN(OV_CC_CAT(FACTORY_, Module)); /* Domain for factories */
+    OV_ITT_DOMAIN(OV_CC_CAT(FACTORY_, Module)); /* Domain for factories */                         \
+    OV_ITT_DOMAIN(OV_CC_CAT(ISA_, Module));     /* Domain for ISA-specific code paths */
 
 namespace internal {
 
@@ -185,6 +198,14 @@ bool match(char const *region, Ctx && ctx, T && val, Case && cs, Cases&&... case
     return match<domain, Fn>(region, std::forward<Ctx>(ctx), std::forward<T>(val), std::forward<Cases>(cases)...);
 }
 
+template<openvino::itt::domain_t(*domain)()>
+bool isa_used(char const *isa, bool is_supported) {
+    if (is_supported) {
+        openvino::itt::ScopedTask<domain> task(openvino::itt::handle(isa));
+    }
+    return is_supported;
+}
+
 }  // namespace internal
 
 #define OV_SCOPE(Module, region, ...)                                                       \
@@ -206,6 +227,9 @@ bool match(char const *region, Ctx && ctx, T && val, Case && cs, Cases&&... case
         std::make_tuple(Case1, Case2),                                                      \
         OV_CC_TOSTRING(OV_CASE2 OV_CC_LBR Case1, Case2, Type1, Type2 OV_CC_RBR))
 
+#define OV_ISA(Module, isa, ...)                                                            \
+    openvino::cc::internal::isa_used<OV_CC_CAT(ISA_, Module)>(OV_CC_TOSTRING(isa), (__VA_ARGS__))
+
 #elif defined(SELECTIVE_BUILD)       // OpenVINO selective build is enabled
 
 #define OV_CC_DOMAINS(Module)
@@ -249,6 +273,9 @@ bool match(char const *region, Ctx && ctx, T && val, Case && cs, Cases&&... case
 
 #define OV_CASE2(Case1, Case2, Type1, Type2) openvino::cc::internal::make_case_wrapper<std::tuple<Type1, Type2>>(std::make_tuple(Case1, Case2))
 
+#define OV_ISA(Module, isa, ...)                \
+    (OV_CC_SCOPE_IS_ENABLED(OV_CC_CAT3(Module, _ISA_, isa)) && (__VA_ARGS__))
+
 #else
 
 #define OV_CC_DOMAINS(Module)
@@ -262,6 +289,8 @@ bool match(char const *region, Ctx && ctx, T && val, Case && cs, Cases&&... case
 
 #define OV_CASE2(Case1, Case2, Type1, Type2) openvino::cc::internal::make_case_wrapper<std::tuple<Type1, Type2>>(std::make_tuple(Case1, Case2))
 
+#define OV_ISA(Module, isa, ...) (__VA_ARGS__)
+
 #endif
 
 }  // namespace cc
@@ -32,7 +32,8 @@ from abc import ABC, abstractmethod
 
 Domain = ['SIMPLE_',
           'SWITCH_',
-          'FACTORY_']
+          'FACTORY_',
+          'ISA_']
 
 FILE_HEADER = "#pragma once\n\n"
 FILE_FOOTER = "\n"
@@ -40,6 +41,7 @@ FILE_FOOTER = "\n"
 ENABLED_SCOPE_FMT = "#define %s_%s 1\n"
 ENABLED_SWITCH_FMT = "#define %s_%s 1\n#define %s_%s_cases %s\n"
 ENABLED_FACTORY_INSTANCE_FMT = "#define %s_%s 1\n"
+ENABLED_ISA_FMT = "#define %s_ISA_%s 1\n"
 
 class IScope(ABC):
     @abstractmethod
@@ -82,10 +84,18 @@ class Factory(IScope):
             if r:
                 f.write(ENABLED_FACTORY_INSTANCE_FMT % (module, r))
 
+class Isa(IScope):
+    def __init__(self, name):
+        self.name = name
+
+    def generate(self, f, module):
+        f.write(ENABLED_ISA_FMT % (module, self.name))
+
 class Module:
     def __init__(self, name):
         self.name = name
         self.scopes = {}
+        self.isas = {}
 
     def scope(self, name):
         if name not in self.scopes:
@@ -102,10 +112,17 @@ class Module:
             self.scopes[name] = Switch(name)
         return self.scopes.get(name)
 
+    def isa(self, name):
+        if name not in self.isas:
+            self.isas[name] = Isa(name)
+        return self.isas.get(name)
+
     def generate(self, f):
         for _, scope in self.scopes.items():
             scope.generate(f, self.name)
-        if self.scopes:
+        for _, isa in self.isas.items():
+            isa.generate(f, self.name)
+        if self.scopes or self.isas:
             f.write("\n")
 
 class Stat:
@@ -144,6 +161,12 @@ class Stat:
                     for cre in list(filter(lambda row: row[1] == 'CREATE', factories)):
                         self.module(cre[0]).factory(cre[2]).create(cre[3])
 
+                    # ISA-specific code paths
+                    isas = list(filter(lambda row: row[0].startswith(Domain[3]), rows))
+                    for row in isas:
+                        moduleName = row[0][len(Domain[3]):]
+                        self.module(moduleName).isa(row[1].strip())
+
     def generate(self, out):
         with open(out, 'w') as f:
             f.write(FILE_HEADER)
@@ -0,0 +1,24 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace TimeTest {
+/**
+* @brief Reports a named value which is not a duration (throughput, memory usage)
+* into the statistics file, next to the timers
+* @param name - name of the metric
+* @param value - value of the metric
+*/
+void reportMetric(const std::string& name, float value);
+
+/**
+* @brief Get peak resident set size of the current process
+* @return peak RSS in kilobytes, 0 if it can't be obtained on current OS
+*/
+size_t getPeakRSSInKB();
+}
@@ -59,9 +59,12 @@ def aggregate_stats(stats: dict):
 
 def prepare_executable_cmd(args: dict):
     """Generate common part of cmd from arguments to execute"""
-    return [str(args["executable"].resolve(strict=True)),
-            "-m", str(args["model"].resolve(strict=True)),
-            "-d", args["device"]]
+    cmd = [str(args["executable"].resolve(strict=True)),
+           "-m", str(args["model"].resolve(strict=True)),
+           "-d", args["device"]]
+    if args.get("nstreams"):
+        cmd += ["-nstreams", str(args["nstreams"])]
+    return cmd
 
 
 def run_timetest(args: dict, log=None):
@@ -124,6 +127,9 @@ def cli_parser():
                         dest="device",
                         type=str,
                         help='target device to infer on')
+    parser.add_argument('-nstreams',
+                        type=str,
+                        help='number of streams for throughput pipelines')
     parser.add_argument('-niter',
                         default=3,
                         type=check_positive_int,
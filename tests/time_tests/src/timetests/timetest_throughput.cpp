@@ -0,0 +1,138 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <gflags/gflags.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "common.h"
+#include "timetests_helper/timer.h"
+#include "timetests_helper/metrics.h"
+using namespace InferenceEngine;
+
+DECLARE_string(nstreams);
+
+using Clock = std::chrono::high_resolution_clock;
+
+/// @brief duration of steady state inference which is measured
+static constexpr std::chrono::seconds steadyStateDuration(10);
+
+
+/**
+ * @brief Returns config enabling requested number of streams on devices
+ * supporting throughput streams
+ */
+static std::map<std::string, std::string> getStreamsConfig(const std::string &device) {
+  std::map<std::string, std::string> config;
+  const bool isAuto = FLAGS_nstreams == "AUTO";
+  if (device == "CPU") {
+    config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] =
+        isAuto ? CONFIG_VALUE(CPU_THROUGHPUT_AUTO) : FLAGS_nstreams;
+  } else if (device == "GPU") {
+    config[CONFIG_KEY(GPU_THROUGHPUT_STREAMS)] =
+        isAuto ? CONFIG_VALUE(GPU_THROUGHPUT_AUTO) : FLAGS_nstreams;
+  }
+  return config;
+}
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * Besides LoadNetwork time the pipeline measures steady state throughput
+ * (frames per second) and 99th percentile of request latency (microseconds)
+ * with all infer requests kept busy, and peak RSS of the process (kilobytes).
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    Core ie;
+    CNNNetwork cnnNetwork;
+    ExecutableNetwork exeNetwork;
+
+    {
+      SCOPED_TIMER(read_network);
+      cnnNetwork = ie.ReadNetwork(model);
+    }
+
+    {
+      SCOPED_TIMER(load_network);
+      exeNetwork = ie.LoadNetwork(cnnNetwork, device, getStreamsConfig(device));
+    }
+
+    auto batchSize = cnnNetwork.getBatchSize();
+    batchSize = batchSize != 0 ? batchSize : 1;
+
+    const auto nireq = exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    const InferenceEngine::ConstInputsDataMap inputsInfo(exeNetwork.GetInputsInfo());
+    std::vector<InferRequest> inferRequests(std::max(nireq, 1u));
+    for (auto &inferRequest : inferRequests) {
+      inferRequest = exeNetwork.CreateInferRequest();
+      fillBlobs(inferRequest, inputsInfo, batchSize);
+      // first inference of every request warms it up and is not measured
+      inferRequest.Infer();
+    }
+
+    // requests are restarted as soon as they are done until the measured period ends,
+    // they are waited round robin as all of them execute the same network
+    std::vector<Clock::time_point> startTimes(inferRequests.size());
+    std::vector<float> latencies;
+    const auto steadyStateStart = Clock::now();
+    for (size_t i = 0; i < inferRequests.size(); i++) {
+      startTimes[i] = Clock::now();
+      inferRequests[i].StartAsync();
+    }
+
+    size_t running = inferRequests.size();
+    for (size_t i = 0; running != 0; i = (i + 1) % inferRequests.size()) {
+      if (startTimes[i] == Clock::time_point())
+        continue;
+
+      inferRequests[i].Wait(IInferRequest::WaitMode::RESULT_READY);
+      const auto now = Clock::now();
+      latencies.push_back(std::chrono::duration_cast<std::chrono::microseconds>(now - startTimes[i]).count());
+
+      if (now - steadyStateStart < steadyStateDuration) {
+        startTimes[i] = now;
+        inferRequests[i].StartAsync();
+      } else {
+        startTimes[i] = Clock::time_point();
+        running--;
+      }
+    }
+    const auto steadyStateTime = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - steadyStateStart).count();
+
+    std::sort(latencies.begin(), latencies.end());
+    const auto p99Idx = std::min(latencies.size() - 1, latencies.size() * 99 / 100);
+    TimeTest::reportMetric("throughput", latencies.size() * batchSize * 1e6f / steadyStateTime);
+    TimeTest::reportMetric("latency_p99", latencies[p99Idx]);
+
+    const auto peakRSS = TimeTest::getPeakRSSInKB();
+    if (peakRSS != 0)
+      TimeTest::reportMetric("peak_rss", static_cast<float>(peakRSS));
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::details::InferenceEngineException &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}
@@ -30,6 +30,11 @@ static const char target_device_message[] =
 static const char statistics_path_message[] =
     "Required. Path to a file to write statistics.";
 
+/// @brief message for number of streams argument
+static const char streams_message[] =
+    "Optional. Number of streams used by throughput pipelines (CPU and GPU). "
+    "Default value: AUTO, which lets a plugin pick the number of streams.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -48,6 +53,10 @@ DEFINE_string(d, "", target_device_message);
 /// It is a required parameter
 DEFINE_string(s, "", statistics_path_message);
 
+/// @brief Define parameter for set number of streams <br>
+/// It is an optional parameter
+DEFINE_string(nstreams, "AUTO", streams_message);
+
 /**
  * @brief This function show a help message
  */
@@ -62,4 +71,6 @@ static void showUsage() {
             << std::endl;
   std::cout << "    -s \"<path>\"               " << statistics_path_message
             << std::endl;
+  std::cout << "    -nstreams \"<value>\"       " << streams_message
+            << std::endl;
 }
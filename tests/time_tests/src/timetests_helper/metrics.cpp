@@ -0,0 +1,40 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "timetests_helper/metrics.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "statistics_writer.h"
+
+namespace TimeTest {
+
+void reportMetric(const std::string &name, float value) {
+  StatisticsWriter::Instance().write({name, value});
+}
+
+size_t getPeakRSSInKB() {
+#ifdef __linux__
+  size_t result = 0;
+  FILE *file = fopen("/proc/self/status", "r");
+  if (file != nullptr) {
+    const char *name = "VmHWM:";
+    char line[128];
+    while (fgets(line, sizeof(line), file) != nullptr) {
+      if (strncmp(line, name, strlen(name)) == 0) {
+        result = strtoul(line + strlen(name), nullptr, 10);
+        break;
+      }
+    }
+    fclose(file);
+  }
+  return result;
+#else
+  return 0;
+#endif
+}
+
+} // namespace TimeTest
@@ -184,7 +184,8 @@ def validate_test_case(request, test_info):
             "device": {
                 "type": "object",
                 "properties": {
-                    "name": {"type": "string"}
+                    "name": {"type": "string"},
+                    "nstreams": {"type": "string"}
                 },
                 "required": ["name"]
             },
@@ -23,6 +23,8 @@ from scripts.run_timetest import run_timetest
 from test_runner.utils import expand_env_vars
 
 REFS_FACTOR = 1.2      # 120%
+# steps where bigger average value is better, the rest of the steps are durations or memory usage
+HIGHER_IS_BETTER_STEPS = ["throughput"]
 
 
 def test_timetest(instance, executable, niter, cl_cache_dir, test_info, temp_dir, validate_test_case,
@@ -53,6 +55,7 @@ def test_timetest(instance, executable, niter, cl_cache_dir, test_info, temp_dir
         "executable": Path(executable),
         "model": Path(model_path),
         "device": instance["device"]["name"],
+        "nstreams": instance["device"].get("nstreams"),
         "niter": niter
     }
     if exe_args["device"] == "GPU":
@@ -73,7 +76,11 @@ def test_timetest(instance, executable, niter, cl_cache_dir, test_info, temp_dir
     comparison_status = 0
     for step_name, references in instance["references"].items():
         for metric, reference_val in references.items():
-            if aggr_stats[step_name][metric] > reference_val * REFS_FACTOR:
+            if step_name in HIGHER_IS_BETTER_STEPS and metric == "avg":
+                failed = aggr_stats[step_name][metric] < reference_val / REFS_FACTOR
+            else:
+                failed = aggr_stats[step_name][metric] > reference_val * REFS_FACTOR
+            if failed:
                 logging.error("Comparison failed for '{}' step for '{}' metric. Reference: {}. Current values: {}"
                               .format(step_name, metric, reference_val, aggr_stats[step_name][metric]))
                 comparison_status = 1